@@ -0,0 +1,1290 @@
+/*
+ * Throughput benchmarks for every public function in ../api-manifest.tsv.
+ *
+ * Each function is run over one or more input distributions -- eight
+ * realistic strings each, cycled in order -- chosen for what it parses: short
+ * and long integers in both signs plus malformed text for the integer
+ * families, ports, IPv4, IPv6 and Unix socket paths for the networking
+ * functions, and short and malformed lists for the list parsers. The
+ * explicit-base parsers run in automatic mode over 0x/0o/0b-prefixed
+ * integers and over sixteen-digit hex IDs of the trace-context kind; the
+ * 128-bit parsers run over values past 2^64 and 32-digit W3C trace IDs, and
+ * the size parsers over SI and IEC byte counts and the duration parsers over
+ * simple and compound durations. The floating-point parsers run over short
+ * config values and 17-digit round-trip text; bench_floating compares them
+ * with strtod() and strtof(). The integer
+ * formatters write the values of the valid integer inputs. The
+ * longest-prefix-match lookups run against a table of the sixteen valid CIDR
+ * inputs; bench_lpm measures them at 100k and 1M prefixes. Failed calls
+ * are part of the workload: the error is reset the way a caller would, and the
+ * cost of raising it is included.
+ *
+ * Every case is timed BENCH_REPETITIONS times and the fastest run is
+ * reported as ns/op and ops/sec, which filters out most scheduler noise. The
+ * batch functions count one op per element, so their figures are directly
+ * comparable with the single-string forms.
+ *
+ *   bench_convert [-b baseline] [-o output] [filter]
+ *
+ * filter keeps only functions whose name contains it. -o also writes the
+ * results to a file; -b reads a file written that way and adds the change
+ * against it, so a regression shows up as a positive percentage before an
+ * upgrade rather than after. CMakeLists.txt refuses to configure if a
+ * manifest function has no case here.
+ */
+#include <p101_convert/errors.h>
+#include <p101_convert/floating.h>
+#include <p101_convert/integer.h>
+#include <p101_convert/lpm.h>
+#include <p101_convert/networking.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/un.h>
+#include <time.h>
+#include <unistd.h>
+
+enum
+{
+    BENCH_INPUTS          = 8,
+    BENCH_INPUT_MASK      = BENCH_INPUTS - 1,
+    BENCH_TARGET_OPS      = 200000,
+    BENCH_REPETITIONS     = 5,
+    BENCH_MAX_BASELINE    = 4096,
+    BENCH_MAX_NAME        = 96,
+    BENCH_MAX_DISTRIBUTED = 4,
+    BENCH_BUILDS_PER_OP   = 256
+};
+
+struct bench_inputs
+{
+    const char *name;
+    const char *text[BENCH_INPUTS];
+    size_t      length[BENCH_INPUTS];
+};
+
+typedef long (*bench_runner)(const struct p101_env *env, struct p101_error *err, const struct bench_inputs *inputs, long iterations);
+
+struct bench_case
+{
+    const char          *function;
+    bench_runner         run;
+    struct bench_inputs *distributions[BENCH_MAX_DISTRIBUTED];
+};
+
+struct bench_result
+{
+    char   function[BENCH_MAX_NAME];
+    char   distribution[BENCH_MAX_NAME];
+    double ns_per_op;
+};
+
+static volatile uint64_t sink;
+
+/* ------------------------------------------------------------ distributions */
+
+static struct bench_inputs integer_short = {
+    "short", {"0", "7", "-3", "42", "+19", "-128", "255", " 100"},
+     {0}
+};
+static struct bench_inputs integer_long = {
+    "long", {"2147483647", "-2147483648", "4294967295", "9223372036854775807", "-9223372036854775808", "18446744073709551615", "1234567890123", "-98765432101"},
+     {0}
+};
+static struct bench_inputs integer_invalid = {
+    "invalid", {"", "x", "12x", "--1", "1 ", "0x10", "+", "99999999999999999999"},
+     {0}
+};
+static struct bench_inputs integer_prefixed = {
+    "prefixed", {"0x1f", "0o755", "0b1010", "0xdeadbeef", "-0x80", "755", "0644", "0xFFFFFFFFFFFFFFFF"},
+     {0}
+};
+static struct bench_inputs hex_id = {
+    "hex_id", {"0x00f067aa0ba902b7", "0x4bf92f3577b34da6", "0xa3ce929d0e0e4736", "0x0af7651916cd43dd", "0x8448eb211c80319c", "0xb7ad6b7169203331", "0x0123456789abcdef", "0xfedcba9876543210"},
+     {0}
+};
+static struct bench_inputs integer_wide = {
+    "wide", {"18446744073709551616", "340282366920938463463374607431768211455", "100000000000000000000000000000000000", "12345678901234567890123", "9223372036854775807", "1", "79228162514264337593543950336", "+4294967296"},
+     {0}
+};
+static struct bench_inputs trace_id = {
+    "trace_id", {"4bf92f3577b34da6a3ce929d0e0e4736", "0af7651916cd43dd8448eb211c80319c", "00000000000000000000000000000001", "ffffffffffffffffffffffffffffffff", "b7ad6b7169203331b7ad6b7169203331", "0123456789ABCDEF0123456789ABCDEF", "5b8efff798038103d269b633813fc60c", "dc1b7dc0ed1e4db4a5c8b25cd05f1e8f"},
+     {0}
+};
+static struct bench_inputs size_valid = {
+    "valid", {"64K", "1.5GiB", "512MB", "4096", "10G", "2Mi", "1.25KiB", "8EiB"},
+     {0}
+};
+static struct bench_inputs size_invalid = {
+    "invalid", {"", "10 G", "1.5", "1.K", "-1K", "5XB", "0.0001K", "20EiB"},
+     {0}
+};
+static struct bench_inputs duration_valid = {
+    "valid", {"250ms", "5s", "1h30m", "30s", "1.5h", "100us", "2m30.5s", "-10ms"},
+     {0}
+};
+static struct bench_inputs duration_invalid = {
+    "invalid", {"", "5", "5 s", "1d", "1h 30m", ".5s", "5sec", "3000000h"},
+     {0}
+};
+static struct bench_inputs real_short = {
+    "short", {"0.5", "1500", "-2.25", "3.14", "0.001", "1e-6", "2.5e3", "100"},
+     {0}
+};
+static struct bench_inputs real_long = {
+    "long", {"0.10000000000000001", "3.1415926535897931", "-2.7182818284590451", "6.0221407599999999e+23", "1.0000000000000002", "2.2250738585072014e-308", "0.30000000000000004", "-1.7976931348623157e+308"},
+     {0}
+};
+static struct bench_inputs real_invalid = {
+    "invalid", {"", "1,5", "1.5x", "abc", "1e", "0x1p3", "1e400", "--1"},
+     {0}
+};
+static struct bench_inputs port_valid = {
+    "valid", {"80", "443", "8080", "65535", "0", "22", "3306", "53"},
+     {0}
+};
+static struct bench_inputs port_invalid = {
+    "invalid", {"65536", "-1", "http", "", "80x", "99999", " ", "1e3"},
+     {0}
+};
+static struct bench_inputs address_ipv4 = {
+    "ipv4", {"127.0.0.1", "192.168.1.1", "10.0.0.255", "0.0.0.0", "255.255.255.255", "8.8.8.8", "172.16.254.1", "1.2.3.4"},
+     {0}
+};
+static struct bench_inputs address_ipv6 = {
+    "ipv6", {"::1", "::", "fe80::1", "2001:db8::8a2e:370:7334", "::ffff:192.0.2.1", "2001:db8:0:0:0:0:2:1", "ff02::1", "1:2:3:4:5:6:7:8"},
+     {0}
+};
+static struct bench_inputs address_unix = {
+    "unix", {"/tmp/sock", "./socket", "/var/run/app.sock", "/a", "run/x.sock", "/very/long/path/to/some/service.socket", "./s", "/tmp/a/b/c"},
+     {0}
+};
+static struct bench_inputs address_invalid = {
+    "invalid", {"", "localhost", "1.2.3", "1.2.3.256", "::g", "hostname.example", "12345", "[::1]"},
+     {0}
+};
+static struct bench_inputs endpoint_ipv4 = {
+    "ipv4", {"127.0.0.1:80", "192.168.1.1:8080", "10.0.0.255:443", "0.0.0.0:0", "255.255.255.255:65535", "8.8.8.8:53", "172.16.254.1:3306", "1.2.3.4:22"},
+     {0}
+};
+static struct bench_inputs endpoint_ipv6 = {
+    "ipv6", {"[::1]:80", "[::]:0", "[fe80::1]:8080", "[2001:db8::8a2e:370:7334]:443", "[::ffff:192.0.2.1]:53", "[2001:db8:0:0:0:0:2:1]:22", "[ff02::1]:5353", "[1:2:3:4:5:6:7:8]:65535"},
+     {0}
+};
+static struct bench_inputs endpoint_invalid = {
+    "invalid", {"", "localhost:80", "1.2.3.4", "::1:80", "1.2.3.4:65536", "[::1]80", "/tmp/sock", "1.2.3.256:80"},
+     {0}
+};
+static struct bench_inputs cidr_ipv4 = {
+    "ipv4", {"10.0.0.0/8", "192.168.1.0/24", "172.16.0.0/12", "0.0.0.0/0", "8.8.8.8/32", "100.64.0.0/10", "192.0.2.128/25", "1.2.3.4/30"},
+     {0}
+};
+static struct bench_inputs cidr_ipv6 = {
+    "ipv6", {"::/0", "2001:db8::/32", "fe80::/10", "::1/128", "2001:db8:0:0:0:0:2:0/112", "ff00::/8", "::ffff:192.0.2.0/120", "1:2:3:4::/64"},
+     {0}
+};
+static struct bench_inputs cidr_invalid = {
+    "invalid", {"", "10.0.0.0", "10.0.0.0/33", "10.0.0.0/08", "/8", "::/129", "1.2.3.256/8", "10.0.0.0/x"},
+     {0}
+};
+static struct bench_inputs list_valid = {
+    "short", {"80,443,8080", "1,2,3,4,5,6,7,8", "-1", "42", "100,200", "9223372036854775807,0", "7,7,7", "1,22,333,4444"},
+     {0}
+};
+static struct bench_inputs list_invalid = {
+    "invalid", {"", "1,,2", "1,2,", "a,b", "1 ,2", "1;2", ",", "1,2,3,4,5,6,7,8,9"},
+     {0}
+};
+
+static struct bench_inputs *const all_distributions[] = {&integer_short, &integer_long, &integer_invalid, &integer_prefixed, &hex_id, &integer_wide, &trace_id, &size_valid, &size_invalid, &duration_valid, &duration_invalid, &real_short, &real_long, &real_invalid, &port_valid, &port_invalid, &address_ipv4, &address_ipv6, &address_unix, &address_invalid, &endpoint_ipv4, &endpoint_ipv6, &endpoint_invalid, &cidr_ipv4, &cidr_ipv6, &cidr_invalid, &list_valid, &list_invalid};
+
+/* ------------------------------------------------------------------ runners */
+
+/* One runner per calling convention; each is instantiated for every public
+ * function of that shape below. */
+#define BENCH_PARSE(function, type)                                                                                                                                                                                                                                \
+    static long bench_##function(const struct p101_env *env, struct p101_error *err, const struct bench_inputs *inputs, long iterations)                                                                                                                           \
+    {                                                                                                                                                                                                                                                              \
+        for(long i = 0; i < iterations; i++)                                                                                                                                                                                                                       \
+        {                                                                                                                                                                                                                                                          \
+            sink += (uint64_t)function(env, err, inputs->text[i & BENCH_INPUT_MASK], (type)0);                                                                                                                                                                     \
+            if(p101_error_has_error(err))                                                                                                                                                                                                                          \
+            {                                                                                                                                                                                                                                                      \
+                p101_error_reset(err);                                                                                                                                                                                                                             \
+            }                                                                                                                                                                                                                                                      \
+        }                                                                                                                                                                                                                                                          \
+        return iterations;                                                                                                                                                                                                                                         \
+    }
+
+#define BENCH_PARSE_N(function, type)                                                                                                                                                                                                                              \
+    static long bench_##function(const struct p101_env *env, struct p101_error *err, const struct bench_inputs *inputs, long iterations)                                                                                                                           \
+    {                                                                                                                                                                                                                                                              \
+        for(long i = 0; i < iterations; i++)                                                                                                                                                                                                                       \
+        {                                                                                                                                                                                                                                                          \
+            sink += (uint64_t)function(env, err, inputs->text[i & BENCH_INPUT_MASK], inputs->length[i & BENCH_INPUT_MASK], (type)0);                                                                                                                               \
+            if(p101_error_has_error(err))                                                                                                                                                                                                                          \
+            {                                                                                                                                                                                                                                                      \
+                p101_error_reset(err);                                                                                                                                                                                                                             \
+            }                                                                                                                                                                                                                                                      \
+        }                                                                                                                                                                                                                                                          \
+        return iterations;                                                                                                                                                                                                                                         \
+    }
+
+#define BENCH_PARSE_PREFIX(function, type)                                                                                                                                                                                                                         \
+    static long bench_##function(const struct p101_env *env, struct p101_error *err, const struct bench_inputs *inputs, long iterations)                                                                                                                           \
+    {                                                                                                                                                                                                                                                              \
+        const char *end;                                                                                                                                                                                                                                           \
+        for(long i = 0; i < iterations; i++)                                                                                                                                                                                                                       \
+        {                                                                                                                                                                                                                                                          \
+            sink += (uint64_t)function(env, err, inputs->text[i & BENCH_INPUT_MASK], &end, (type)0);                                                                                                                                                               \
+            sink += (uint64_t)(end - inputs->text[i & BENCH_INPUT_MASK]);                                                                                                                                                                                          \
+            if(p101_error_has_error(err))                                                                                                                                                                                                                          \
+            {                                                                                                                                                                                                                                                      \
+                p101_error_reset(err);                                                                                                                                                                                                                             \
+            }                                                                                                                                                                                                                                                      \
+        }                                                                                                                                                                                                                                                          \
+        return iterations;                                                                                                                                                                                                                                         \
+    }
+
+#define BENCH_PARSE_BASE(function, type)                                                                                                                                                                                                                           \
+    static long bench_##function(const struct p101_env *env, struct p101_error *err, const struct bench_inputs *inputs, long iterations)                                                                                                                           \
+    {                                                                                                                                                                                                                                                              \
+        for(long i = 0; i < iterations; i++)                                                                                                                                                                                                                       \
+        {                                                                                                                                                                                                                                                          \
+            sink += (uint64_t)function(env, err, inputs->text[i & BENCH_INPUT_MASK], 0, (type)0);                                                                                                                                                                  \
+            if(p101_error_has_error(err))                                                                                                                                                                                                                          \
+            {                                                                                                                                                                                                                                                      \
+                p101_error_reset(err);                                                                                                                                                                                                                             \
+            }                                                                                                                                                                                                                                                      \
+        }                                                                                                                                                                                                                                                          \
+        return iterations;                                                                                                                                                                                                                                         \
+    }
+
+#define BENCH_TRY_PARSE(function, type)                                                                                                                                                                                                                            \
+    static long bench_##function(const struct p101_env *env, struct p101_error *err, const struct bench_inputs *inputs, long iterations)                                                                                                                           \
+    {                                                                                                                                                                                                                                                              \
+        type value;                                                                                                                                                                                                                                                \
+        (void)env;                                                                                                                                                                                                                                                 \
+        (void)err;                                                                                                                                                                                                                                                 \
+        value = 0;                                                                                                                                                                                                                                                 \
+        for(long i = 0; i < iterations; i++)                                                                                                                                                                                                                       \
+        {                                                                                                                                                                                                                                                          \
+            sink += (uint64_t)function(inputs->text[i & BENCH_INPUT_MASK], &value);                                                                                                                                                                                \
+            sink += (uint64_t)value;                                                                                                                                                                                                                               \
+        }                                                                                                                                                                                                                                                          \
+        return iterations;                                                                                                                                                                                                                                         \
+    }
+
+#define BENCH_PARSE_ARRAY(function, type)                                                                                                                                                                                                                          \
+    static long bench_##function(const struct p101_env *env, struct p101_error *err, const struct bench_inputs *inputs, long iterations)                                                                                                                           \
+    {                                                                                                                                                                                                                                                              \
+        type    out[BENCH_INPUTS];                                                                                                                                                                                                                                 \
+        uint8_t status[BENCH_INPUTS];                                                                                                                                                                                                                              \
+        long    calls;                                                                                                                                                                                                                                             \
+        calls = iterations / BENCH_INPUTS;                                                                                                                                                                                                                         \
+        for(long i = 0; i < calls; i++)                                                                                                                                                                                                                            \
+        {                                                                                                                                                                                                                                                          \
+            sink += function(env, err, inputs->text, BENCH_INPUTS, out, status);                                                                                                                                                                                   \
+            sink += (uint64_t)out[i & BENCH_INPUT_MASK];                                                                                                                                                                                                           \
+        }                                                                                                                                                                                                                                                          \
+        return calls * BENCH_INPUTS;                                                                                                                                                                                                                               \
+    }
+
+#define BENCH_PARSE_LIST(function, type)                                                                                                                                                                                                                           \
+    static long bench_##function(const struct p101_env *env, struct p101_error *err, const struct bench_inputs *inputs, long iterations)                                                                                                                           \
+    {                                                                                                                                                                                                                                                              \
+        type out[BENCH_INPUTS];                                                                                                                                                                                                                                    \
+        for(long i = 0; i < iterations; i++)                                                                                                                                                                                                                       \
+        {                                                                                                                                                                                                                                                          \
+            sink += function(env, err, inputs->text[i & BENCH_INPUT_MASK], ",", out, BENCH_INPUTS);                                                                                                                                                                \
+            if(p101_error_has_error(err))                                                                                                                                                                                                                          \
+            {                                                                                                                                                                                                                                                      \
+                p101_error_reset(err);                                                                                                                                                                                                                             \
+            }                                                                                                                                                                                                                                                      \
+        }                                                                                                                                                                                                                                                          \
+        return iterations;                                                                                                                                                                                                                                         \
+    }
+
+#define BENCH_FORMAT(function, type)                                                                                                                                                                                                                               \
+    static long bench_##function(const struct p101_env *env, struct p101_error *err, const struct bench_inputs *inputs, long iterations)                                                                                                                           \
+    {                                                                                                                                                                                                                                                              \
+        type values[BENCH_INPUTS];                                                                                                                                                                                                                                 \
+        char text[P101_INTEGER_TEXT_SIZE];                                                                                                                                                                                                                         \
+        for(size_t i = 0; i < BENCH_INPUTS; i++)                                                                                                                                                                                                                   \
+        {                                                                                                                                                                                                                                                          \
+            values[i] = (type)strtoull(inputs->text[i], NULL, 10);                                                                                                                                                                                                 \
+        }                                                                                                                                                                                                                                                          \
+        for(long i = 0; i < iterations; i++)                                                                                                                                                                                                                       \
+        {                                                                                                                                                                                                                                                          \
+            sink += function(env, err, values[i & BENCH_INPUT_MASK], text, sizeof(text));                                                                                                                                                                          \
+        }                                                                                                                                                                                                                                                          \
+        return iterations;                                                                                                                                                                                                                                         \
+    }
+
+static long bench_p101_parse_in_port_t(const struct p101_env *env, struct p101_error *err, const struct bench_inputs *inputs, long iterations)
+{
+    for(long i = 0; i < iterations; i++)
+    {
+        sink += p101_parse_in_port_t(env, err, inputs->text[i & BENCH_INPUT_MASK]);
+        if(p101_error_has_error(err))
+        {
+            p101_error_reset(err);
+        }
+    }
+    return iterations;
+}
+
+static long bench_p101_convert_address(const struct p101_env *env, struct p101_error *err, const struct bench_inputs *inputs, long iterations)
+{
+    struct sockaddr_storage addr;
+
+    for(long i = 0; i < iterations; i++)
+    {
+        sink += p101_convert_address(env, err, inputs->text[i & BENCH_INPUT_MASK], &addr);
+        if(p101_error_has_error(err))
+        {
+            p101_error_reset(err);
+        }
+    }
+    return iterations;
+}
+
+static long bench_p101_convert_address_array(const struct p101_env *env, struct p101_error *err, const struct bench_inputs *inputs, long iterations)
+{
+    struct sockaddr_storage addrs[BENCH_INPUTS];
+    socklen_t               lengths[BENCH_INPUTS];
+    uint8_t                 status[BENCH_INPUTS];
+    long                    calls;
+
+    calls = iterations / BENCH_INPUTS;
+    for(long i = 0; i < calls; i++)
+    {
+        sink += p101_convert_address_array(env, err, inputs->text, BENCH_INPUTS, addrs, lengths, status);
+        sink += lengths[i & BENCH_INPUT_MASK];
+    }
+    return calls * BENCH_INPUTS;
+}
+
+static long bench_p101_convert_compact_address(const struct p101_env *env, struct p101_error *err, const struct bench_inputs *inputs, long iterations)
+{
+    struct p101_compact_address compact;
+
+    for(long i = 0; i < iterations; i++)
+    {
+        sink += p101_convert_compact_address(env, err, inputs->text[i & BENCH_INPUT_MASK], &compact);
+        if(p101_error_has_error(err))
+        {
+            p101_error_reset(err);
+        }
+    }
+    return iterations;
+}
+
+static long bench_p101_compact_address_to_sockaddr(const struct p101_env *env, struct p101_error *err, const struct bench_inputs *inputs, long iterations)
+{
+    struct p101_compact_address compact[BENCH_INPUTS];
+    struct sockaddr_storage     addr;
+
+    for(size_t i = 0; i < BENCH_INPUTS; i++)
+    {
+        p101_convert_compact_address(env, err, inputs->text[i], &compact[i]);
+        p101_error_reset(err);
+    }
+    for(long i = 0; i < iterations; i++)
+    {
+        sink += p101_compact_address_to_sockaddr(env, err, &compact[i & BENCH_INPUT_MASK], &addr);
+    }
+    return iterations;
+}
+
+static long bench_p101_convert_endpoint(const struct p101_env *env, struct p101_error *err, const struct bench_inputs *inputs, long iterations)
+{
+    struct sockaddr_storage addr;
+
+    for(long i = 0; i < iterations; i++)
+    {
+        sink += p101_convert_endpoint(env, err, inputs->text[i & BENCH_INPUT_MASK], inputs->length[i & BENCH_INPUT_MASK], &addr);
+        if(p101_error_has_error(err))
+        {
+            p101_error_reset(err);
+        }
+    }
+    return iterations;
+}
+
+static long bench_p101_convert_cidr(const struct p101_env *env, struct p101_error *err, const struct bench_inputs *inputs, long iterations)
+{
+    struct p101_cidr cidr;
+
+    for(long i = 0; i < iterations; i++)
+    {
+        sink += p101_convert_cidr(env, err, inputs->text[i & BENCH_INPUT_MASK], false, &cidr);
+        if(p101_error_has_error(err))
+        {
+            p101_error_reset(err);
+        }
+    }
+    return iterations;
+}
+
+static size_t parse_prefixes(const struct p101_env *env, struct p101_error *err, const struct bench_inputs *inputs, struct p101_cidr *prefixes)
+{
+    size_t count;
+
+    count = 0;
+    for(size_t i = 0; i < BENCH_INPUTS; i++)
+    {
+        if(p101_convert_cidr(env, err, inputs->text[i], false, &prefixes[count]))
+        {
+            count++;
+        }
+        p101_error_reset(err);
+    }
+
+    return count;
+}
+
+static long bench_p101_lpm_size(const struct p101_env *env, struct p101_error *err, const struct bench_inputs *inputs, long iterations)
+{
+    struct p101_cidr prefixes[BENCH_INPUTS];
+    size_t           count;
+
+    count = parse_prefixes(env, err, inputs, prefixes);
+    for(long i = 0; i < iterations; i++)
+    {
+        sink += p101_lpm_size(env, err, prefixes, count);
+    }
+    return iterations;
+}
+
+/* A build fills a 256 KiB direct table per family, so far fewer are run. */
+static long bench_p101_lpm_build(const struct p101_env *env, struct p101_error *err, const struct bench_inputs *inputs, long iterations)
+{
+    struct p101_cidr prefixes[BENCH_INPUTS];
+    size_t           count;
+    size_t           size;
+    void            *memory;
+    long             builds;
+
+    count  = parse_prefixes(env, err, inputs, prefixes);
+    size   = p101_lpm_size(env, err, prefixes, count);
+    memory = malloc(size);
+    if(memory == NULL)
+    {
+        return 1;
+    }
+    builds = iterations / BENCH_BUILDS_PER_OP;
+    for(long i = 0; i < builds; i++)
+    {
+        sink += (uintptr_t)p101_lpm_build(env, err, prefixes, count, memory, size);
+    }
+    free(memory);
+    return builds;
+}
+
+/* One table of every valid CIDR input, built on first use and kept. */
+static const struct p101_lpm *bench_table(const struct p101_env *env, struct p101_error *err)
+{
+    static const struct p101_lpm *lpm;
+    static void                  *memory;
+    struct p101_cidr              prefixes[2 * BENCH_INPUTS];
+    size_t                        count;
+    size_t                        size;
+
+    if(lpm == NULL)
+    {
+        count  = parse_prefixes(env, err, &cidr_ipv4, prefixes);
+        count += parse_prefixes(env, err, &cidr_ipv6, &prefixes[count]);
+        size   = p101_lpm_size(env, err, prefixes, count);
+        memory = malloc(size);
+        if(memory != NULL)
+        {
+            lpm = p101_lpm_build(env, err, prefixes, count, memory, size);
+        }
+    }
+    return lpm;
+}
+
+static long bench_p101_lpm_lookup(const struct p101_env *env, struct p101_error *err, const struct bench_inputs *inputs, long iterations)
+{
+    struct sockaddr_storage addr[BENCH_INPUTS];
+    const struct p101_lpm  *lpm;
+
+    lpm = bench_table(env, err);
+    for(size_t i = 0; i < BENCH_INPUTS; i++)
+    {
+        p101_convert_address(env, err, inputs->text[i], &addr[i]);
+    }
+    for(long i = 0; i < iterations; i++)
+    {
+        sink += p101_lpm_lookup(env, err, lpm, (const struct sockaddr *)&addr[i & BENCH_INPUT_MASK]);
+    }
+    return iterations;
+}
+
+static long bench_p101_lpm_lookup_compact(const struct p101_env *env, struct p101_error *err, const struct bench_inputs *inputs, long iterations)
+{
+    struct p101_compact_address compact[BENCH_INPUTS];
+    const struct p101_lpm      *lpm;
+
+    lpm = bench_table(env, err);
+    for(size_t i = 0; i < BENCH_INPUTS; i++)
+    {
+        p101_convert_compact_address(env, err, inputs->text[i], &compact[i]);
+    }
+    for(long i = 0; i < iterations; i++)
+    {
+        sink += p101_lpm_lookup_compact(env, err, lpm, &compact[i & BENCH_INPUT_MASK]);
+    }
+    return iterations;
+}
+
+static long bench_p101_format_address(const struct p101_env *env, struct p101_error *err, const struct bench_inputs *inputs, long iterations)
+{
+    struct sockaddr_storage addr[BENCH_INPUTS];
+    char                    text[sizeof(((struct sockaddr_un *)0)->sun_path) + 1];
+
+    for(size_t i = 0; i < BENCH_INPUTS; i++)
+    {
+        p101_convert_address(env, err, inputs->text[i], &addr[i]);
+    }
+    for(long i = 0; i < iterations; i++)
+    {
+        sink += p101_format_address(env, err, (const struct sockaddr *)&addr[i & BENCH_INPUT_MASK], text, sizeof(text));
+    }
+    return iterations;
+}
+
+static long bench_p101_format_endpoint(const struct p101_env *env, struct p101_error *err, const struct bench_inputs *inputs, long iterations)
+{
+    struct sockaddr_storage addr[BENCH_INPUTS];
+    char                    text[P101_ENDPOINT_TEXT_SIZE];
+
+    for(size_t i = 0; i < BENCH_INPUTS; i++)
+    {
+        p101_convert_endpoint(env, err, inputs->text[i], inputs->length[i], &addr[i]);
+    }
+    for(long i = 0; i < iterations; i++)
+    {
+        sink += p101_format_endpoint(env, err, (const struct sockaddr *)&addr[i & BENCH_INPUT_MASK], text, sizeof(text));
+    }
+    return iterations;
+}
+
+static long bench_p101_parse_uint128(const struct p101_env *env, struct p101_error *err, const struct bench_inputs *inputs, long iterations)
+{
+    static const struct p101_uint128 zero = {0, 0};
+
+    for(long i = 0; i < iterations; i++)
+    {
+        struct p101_uint128 value;
+
+        value = p101_parse_uint128(env, err, inputs->text[i & BENCH_INPUT_MASK], zero);
+        sink += value.high ^ value.low;
+        if(p101_error_has_error(err))
+        {
+            p101_error_reset(err);
+        }
+    }
+    return iterations;
+}
+
+static long bench_p101_parse_uint128_base(const struct p101_env *env, struct p101_error *err, const struct bench_inputs *inputs, long iterations)
+{
+    static const struct p101_uint128 zero = {0, 0};
+
+    for(long i = 0; i < iterations; i++)
+    {
+        struct p101_uint128 value;
+
+        value = p101_parse_uint128_base(env, err, inputs->text[i & BENCH_INPUT_MASK], 16, zero);
+        sink += value.high ^ value.low;
+        if(p101_error_has_error(err))
+        {
+            p101_error_reset(err);
+        }
+    }
+    return iterations;
+}
+
+static long bench_p101_parse_hex_id(const struct p101_env *env, struct p101_error *err, const struct bench_inputs *inputs, long iterations)
+{
+    uint8_t id[16];
+
+    for(long i = 0; i < iterations; i++)
+    {
+        sink += p101_parse_hex_id(env, err, inputs->text[i & BENCH_INPUT_MASK], id, sizeof(id));
+        sink += id[0];
+        if(p101_error_has_error(err))
+        {
+            p101_error_reset(err);
+        }
+    }
+    return iterations;
+}
+
+static long bench_p101_parse_duration_timespec(const struct p101_env *env, struct p101_error *err, const struct bench_inputs *inputs, long iterations)
+{
+    static const struct timespec zero = {0, 0};
+
+    for(long i = 0; i < iterations; i++)
+    {
+        struct timespec ts;
+
+        ts = p101_parse_duration_timespec(env, err, inputs->text[i & BENCH_INPUT_MASK], zero);
+        sink += (uint64_t)ts.tv_sec ^ (uint64_t)ts.tv_nsec;
+        if(p101_error_has_error(err))
+        {
+            p101_error_reset(err);
+        }
+    }
+    return iterations;
+}
+
+static long bench_p101_parse_double(const struct p101_env *env, struct p101_error *err, const struct bench_inputs *inputs, long iterations)
+{
+    for(long i = 0; i < iterations; i++)
+    {
+        double   value;
+        uint64_t bits;
+
+        value = p101_parse_double(env, err, inputs->text[i & BENCH_INPUT_MASK], 0.0);
+        memcpy(&bits, &value, sizeof(bits));
+        sink += bits;
+        if(p101_error_has_error(err))
+        {
+            p101_error_reset(err);
+        }
+    }
+    return iterations;
+}
+
+static long bench_p101_parse_float(const struct p101_env *env, struct p101_error *err, const struct bench_inputs *inputs, long iterations)
+{
+    for(long i = 0; i < iterations; i++)
+    {
+        float    value;
+        uint32_t bits;
+
+        value = p101_parse_float(env, err, inputs->text[i & BENCH_INPUT_MASK], 0.0F);
+        memcpy(&bits, &value, sizeof(bits));
+        sink += bits;
+        if(p101_error_has_error(err))
+        {
+            p101_error_reset(err);
+        }
+    }
+    return iterations;
+}
+BENCH_FORMAT(p101_format_char, char)
+BENCH_FORMAT(p101_format_int, int)
+BENCH_FORMAT(p101_format_int16_t, int16_t)
+BENCH_FORMAT(p101_format_int32_t, int32_t)
+BENCH_FORMAT(p101_format_int64_t, int64_t)
+BENCH_FORMAT(p101_format_int8_t, int8_t)
+BENCH_FORMAT(p101_format_long, long)
+BENCH_FORMAT(p101_format_long_long, long long)
+BENCH_FORMAT(p101_format_short, short)
+BENCH_FORMAT(p101_format_signed_char, signed char)
+BENCH_FORMAT(p101_format_uint16_t, uint16_t)
+BENCH_FORMAT(p101_format_uint32_t, uint32_t)
+BENCH_FORMAT(p101_format_uint64_t, uint64_t)
+BENCH_FORMAT(p101_format_uint8_t, uint8_t)
+BENCH_FORMAT(p101_format_unsigned_char, unsigned char)
+BENCH_FORMAT(p101_format_unsigned_int, unsigned int)
+BENCH_FORMAT(p101_format_unsigned_long, unsigned long)
+BENCH_FORMAT(p101_format_unsigned_long_long, unsigned long long)
+BENCH_FORMAT(p101_format_unsigned_short, unsigned short)
+BENCH_PARSE(p101_parse_char, char)
+BENCH_PARSE_N(p101_parse_char_n, char)
+BENCH_PARSE_PREFIX(p101_parse_char_prefix, char)
+BENCH_PARSE(p101_parse_duration, int64_t)
+BENCH_PARSE(p101_parse_int, int)
+BENCH_PARSE(p101_parse_int16_t, int16_t)
+BENCH_PARSE_ARRAY(p101_parse_int16_t_array, int16_t)
+BENCH_PARSE_BASE(p101_parse_int16_t_base, int16_t)
+BENCH_PARSE_N(p101_parse_int16_t_n, int16_t)
+BENCH_PARSE_PREFIX(p101_parse_int16_t_prefix, int16_t)
+BENCH_PARSE(p101_parse_int32_t, int32_t)
+BENCH_PARSE_ARRAY(p101_parse_int32_t_array, int32_t)
+BENCH_PARSE_BASE(p101_parse_int32_t_base, int32_t)
+BENCH_PARSE_N(p101_parse_int32_t_n, int32_t)
+BENCH_PARSE_PREFIX(p101_parse_int32_t_prefix, int32_t)
+BENCH_PARSE(p101_parse_int64_t, int64_t)
+BENCH_PARSE_ARRAY(p101_parse_int64_t_array, int64_t)
+BENCH_PARSE_BASE(p101_parse_int64_t_base, int64_t)
+BENCH_PARSE_LIST(p101_parse_int64_t_list, int64_t)
+BENCH_PARSE_N(p101_parse_int64_t_n, int64_t)
+BENCH_PARSE_PREFIX(p101_parse_int64_t_prefix, int64_t)
+BENCH_PARSE(p101_parse_int8_t, int8_t)
+BENCH_PARSE_ARRAY(p101_parse_int8_t_array, int8_t)
+BENCH_PARSE_BASE(p101_parse_int8_t_base, int8_t)
+BENCH_PARSE_N(p101_parse_int8_t_n, int8_t)
+BENCH_PARSE_PREFIX(p101_parse_int8_t_prefix, int8_t)
+BENCH_PARSE_N(p101_parse_int_n, int)
+BENCH_PARSE_PREFIX(p101_parse_int_prefix, int)
+BENCH_PARSE(p101_parse_long, long)
+BENCH_PARSE(p101_parse_long_long, long long)
+BENCH_PARSE_N(p101_parse_long_long_n, long long)
+BENCH_PARSE_PREFIX(p101_parse_long_long_prefix, long long)
+BENCH_PARSE_N(p101_parse_long_n, long)
+BENCH_PARSE_PREFIX(p101_parse_long_prefix, long)
+BENCH_PARSE(p101_parse_negative_char, signed char)
+BENCH_PARSE_N(p101_parse_negative_char_n, signed char)
+BENCH_PARSE_PREFIX(p101_parse_negative_char_prefix, signed char)
+BENCH_PARSE(p101_parse_negative_int, int)
+BENCH_PARSE(p101_parse_negative_int16_t, int16_t)
+BENCH_PARSE_N(p101_parse_negative_int16_t_n, int16_t)
+BENCH_PARSE_PREFIX(p101_parse_negative_int16_t_prefix, int16_t)
+BENCH_PARSE(p101_parse_negative_int32_t, int32_t)
+BENCH_PARSE_N(p101_parse_negative_int32_t_n, int32_t)
+BENCH_PARSE_PREFIX(p101_parse_negative_int32_t_prefix, int32_t)
+BENCH_PARSE(p101_parse_negative_int64_t, int64_t)
+BENCH_PARSE_N(p101_parse_negative_int64_t_n, int64_t)
+BENCH_PARSE_PREFIX(p101_parse_negative_int64_t_prefix, int64_t)
+BENCH_PARSE(p101_parse_negative_int8_t, int8_t)
+BENCH_PARSE_N(p101_parse_negative_int8_t_n, int8_t)
+BENCH_PARSE_PREFIX(p101_parse_negative_int8_t_prefix, int8_t)
+BENCH_PARSE_N(p101_parse_negative_int_n, int)
+BENCH_PARSE_PREFIX(p101_parse_negative_int_prefix, int)
+BENCH_PARSE(p101_parse_negative_long, long)
+BENCH_PARSE(p101_parse_negative_long_long, long long)
+BENCH_PARSE_N(p101_parse_negative_long_long_n, long long)
+BENCH_PARSE_PREFIX(p101_parse_negative_long_long_prefix, long long)
+BENCH_PARSE_N(p101_parse_negative_long_n, long)
+BENCH_PARSE_PREFIX(p101_parse_negative_long_prefix, long)
+BENCH_PARSE(p101_parse_negative_short, short)
+BENCH_PARSE_N(p101_parse_negative_short_n, short)
+BENCH_PARSE_PREFIX(p101_parse_negative_short_prefix, short)
+BENCH_PARSE(p101_parse_positive_char, char)
+BENCH_PARSE_N(p101_parse_positive_char_n, char)
+BENCH_PARSE_PREFIX(p101_parse_positive_char_prefix, char)
+BENCH_PARSE(p101_parse_positive_int, int)
+BENCH_PARSE(p101_parse_positive_int16_t, int16_t)
+BENCH_PARSE_N(p101_parse_positive_int16_t_n, int16_t)
+BENCH_PARSE_PREFIX(p101_parse_positive_int16_t_prefix, int16_t)
+BENCH_PARSE(p101_parse_positive_int32_t, int32_t)
+BENCH_PARSE_N(p101_parse_positive_int32_t_n, int32_t)
+BENCH_PARSE_PREFIX(p101_parse_positive_int32_t_prefix, int32_t)
+BENCH_PARSE(p101_parse_positive_int64_t, int64_t)
+BENCH_PARSE_N(p101_parse_positive_int64_t_n, int64_t)
+BENCH_PARSE_PREFIX(p101_parse_positive_int64_t_prefix, int64_t)
+BENCH_PARSE(p101_parse_positive_int8_t, int8_t)
+BENCH_PARSE_N(p101_parse_positive_int8_t_n, int8_t)
+BENCH_PARSE_PREFIX(p101_parse_positive_int8_t_prefix, int8_t)
+BENCH_PARSE_N(p101_parse_positive_int_n, int)
+BENCH_PARSE_PREFIX(p101_parse_positive_int_prefix, int)
+BENCH_PARSE(p101_parse_positive_long, long)
+BENCH_PARSE(p101_parse_positive_long_long, long long)
+BENCH_PARSE_N(p101_parse_positive_long_long_n, long long)
+BENCH_PARSE_PREFIX(p101_parse_positive_long_long_prefix, long long)
+BENCH_PARSE_N(p101_parse_positive_long_n, long)
+BENCH_PARSE_PREFIX(p101_parse_positive_long_prefix, long)
+BENCH_PARSE(p101_parse_positive_short, short)
+BENCH_PARSE_N(p101_parse_positive_short_n, short)
+BENCH_PARSE_PREFIX(p101_parse_positive_short_prefix, short)
+BENCH_PARSE(p101_parse_short, short)
+BENCH_PARSE_N(p101_parse_short_n, short)
+BENCH_PARSE_PREFIX(p101_parse_short_prefix, short)
+BENCH_PARSE(p101_parse_uint16_t, uint16_t)
+BENCH_PARSE_ARRAY(p101_parse_uint16_t_array, uint16_t)
+BENCH_PARSE_BASE(p101_parse_uint16_t_base, uint16_t)
+BENCH_PARSE_N(p101_parse_uint16_t_n, uint16_t)
+BENCH_PARSE_PREFIX(p101_parse_uint16_t_prefix, uint16_t)
+BENCH_PARSE(p101_parse_uint16_t_size, uint16_t)
+BENCH_PARSE(p101_parse_uint32_t, uint32_t)
+BENCH_PARSE_ARRAY(p101_parse_uint32_t_array, uint32_t)
+BENCH_PARSE_BASE(p101_parse_uint32_t_base, uint32_t)
+BENCH_PARSE_N(p101_parse_uint32_t_n, uint32_t)
+BENCH_PARSE_PREFIX(p101_parse_uint32_t_prefix, uint32_t)
+BENCH_PARSE(p101_parse_uint32_t_size, uint32_t)
+BENCH_PARSE(p101_parse_uint64_t, uint64_t)
+BENCH_PARSE_ARRAY(p101_parse_uint64_t_array, uint64_t)
+BENCH_PARSE_BASE(p101_parse_uint64_t_base, uint64_t)
+BENCH_PARSE_LIST(p101_parse_uint64_t_list, uint64_t)
+BENCH_PARSE_N(p101_parse_uint64_t_n, uint64_t)
+BENCH_PARSE_PREFIX(p101_parse_uint64_t_prefix, uint64_t)
+BENCH_PARSE(p101_parse_uint64_t_size, uint64_t)
+BENCH_PARSE(p101_parse_uint8_t, uint8_t)
+BENCH_PARSE_ARRAY(p101_parse_uint8_t_array, uint8_t)
+BENCH_PARSE_BASE(p101_parse_uint8_t_base, uint8_t)
+BENCH_PARSE_N(p101_parse_uint8_t_n, uint8_t)
+BENCH_PARSE_PREFIX(p101_parse_uint8_t_prefix, uint8_t)
+BENCH_PARSE(p101_parse_uint8_t_size, uint8_t)
+BENCH_PARSE(p101_parse_unsigned_char, unsigned char)
+BENCH_PARSE_N(p101_parse_unsigned_char_n, unsigned char)
+BENCH_PARSE_PREFIX(p101_parse_unsigned_char_prefix, unsigned char)
+BENCH_PARSE(p101_parse_unsigned_int, unsigned int)
+BENCH_PARSE_N(p101_parse_unsigned_int_n, unsigned int)
+BENCH_PARSE_PREFIX(p101_parse_unsigned_int_prefix, unsigned int)
+BENCH_PARSE(p101_parse_unsigned_long, unsigned long)
+BENCH_PARSE(p101_parse_unsigned_long_long, unsigned long long)
+BENCH_PARSE_N(p101_parse_unsigned_long_long_n, unsigned long long)
+BENCH_PARSE_PREFIX(p101_parse_unsigned_long_long_prefix, unsigned long long)
+BENCH_PARSE_N(p101_parse_unsigned_long_n, unsigned long)
+BENCH_PARSE_PREFIX(p101_parse_unsigned_long_prefix, unsigned long)
+BENCH_PARSE(p101_parse_unsigned_short, unsigned short)
+BENCH_PARSE_N(p101_parse_unsigned_short_n, unsigned short)
+BENCH_PARSE_PREFIX(p101_parse_unsigned_short_prefix, unsigned short)
+BENCH_TRY_PARSE(p101_try_parse_char, char)
+BENCH_TRY_PARSE(p101_try_parse_int, int)
+BENCH_TRY_PARSE(p101_try_parse_int16_t, int16_t)
+BENCH_TRY_PARSE(p101_try_parse_int32_t, int32_t)
+BENCH_TRY_PARSE(p101_try_parse_int64_t, int64_t)
+BENCH_TRY_PARSE(p101_try_parse_int8_t, int8_t)
+BENCH_TRY_PARSE(p101_try_parse_long, long)
+BENCH_TRY_PARSE(p101_try_parse_long_long, long long)
+BENCH_TRY_PARSE(p101_try_parse_negative_char, signed char)
+BENCH_TRY_PARSE(p101_try_parse_negative_int, int)
+BENCH_TRY_PARSE(p101_try_parse_negative_int16_t, int16_t)
+BENCH_TRY_PARSE(p101_try_parse_negative_int32_t, int32_t)
+BENCH_TRY_PARSE(p101_try_parse_negative_int64_t, int64_t)
+BENCH_TRY_PARSE(p101_try_parse_negative_int8_t, int8_t)
+BENCH_TRY_PARSE(p101_try_parse_negative_long, long)
+BENCH_TRY_PARSE(p101_try_parse_negative_long_long, long long)
+BENCH_TRY_PARSE(p101_try_parse_negative_short, short)
+BENCH_TRY_PARSE(p101_try_parse_positive_char, char)
+BENCH_TRY_PARSE(p101_try_parse_positive_int, int)
+BENCH_TRY_PARSE(p101_try_parse_positive_int16_t, int16_t)
+BENCH_TRY_PARSE(p101_try_parse_positive_int32_t, int32_t)
+BENCH_TRY_PARSE(p101_try_parse_positive_int64_t, int64_t)
+BENCH_TRY_PARSE(p101_try_parse_positive_int8_t, int8_t)
+BENCH_TRY_PARSE(p101_try_parse_positive_long, long)
+BENCH_TRY_PARSE(p101_try_parse_positive_long_long, long long)
+BENCH_TRY_PARSE(p101_try_parse_positive_short, short)
+BENCH_TRY_PARSE(p101_try_parse_short, short)
+BENCH_TRY_PARSE(p101_try_parse_uint16_t, uint16_t)
+BENCH_TRY_PARSE(p101_try_parse_uint32_t, uint32_t)
+BENCH_TRY_PARSE(p101_try_parse_uint64_t, uint64_t)
+BENCH_TRY_PARSE(p101_try_parse_uint8_t, uint8_t)
+BENCH_TRY_PARSE(p101_try_parse_unsigned_char, unsigned char)
+BENCH_TRY_PARSE(p101_try_parse_unsigned_int, unsigned int)
+BENCH_TRY_PARSE(p101_try_parse_unsigned_long, unsigned long)
+BENCH_TRY_PARSE(p101_try_parse_unsigned_long_long, unsigned long long)
+BENCH_TRY_PARSE(p101_try_parse_unsigned_short, unsigned short)
+
+#define BENCH_CASE(function, ...) {#function, bench_##function, {__VA_ARGS__}}
+
+/* Every function in api-manifest.tsv; CMakeLists.txt checks this list. */
+static const struct bench_case cases[] = {
+    BENCH_CASE(p101_compact_address_to_sockaddr, &address_ipv4, &address_ipv6),
+    BENCH_CASE(p101_convert_address, &address_ipv4, &address_ipv6, &address_unix, &address_invalid),
+    BENCH_CASE(p101_convert_address_array, &address_ipv4, &address_ipv6, &address_unix, &address_invalid),
+    BENCH_CASE(p101_convert_cidr, &cidr_ipv4, &cidr_ipv6, &cidr_invalid),
+    BENCH_CASE(p101_convert_compact_address, &address_ipv4, &address_ipv6, &address_unix, &address_invalid),
+    BENCH_CASE(p101_convert_endpoint, &endpoint_ipv4, &endpoint_ipv6, &endpoint_invalid),
+    BENCH_CASE(p101_format_address, &address_ipv4, &address_ipv6, &address_unix),
+    BENCH_CASE(p101_format_char, &integer_short, &integer_long),
+    BENCH_CASE(p101_format_endpoint, &endpoint_ipv4, &endpoint_ipv6),
+    BENCH_CASE(p101_format_int, &integer_short, &integer_long),
+    BENCH_CASE(p101_format_int16_t, &integer_short, &integer_long),
+    BENCH_CASE(p101_format_int32_t, &integer_short, &integer_long),
+    BENCH_CASE(p101_format_int64_t, &integer_short, &integer_long),
+    BENCH_CASE(p101_format_int8_t, &integer_short, &integer_long),
+    BENCH_CASE(p101_format_long, &integer_short, &integer_long),
+    BENCH_CASE(p101_format_long_long, &integer_short, &integer_long),
+    BENCH_CASE(p101_format_short, &integer_short, &integer_long),
+    BENCH_CASE(p101_format_signed_char, &integer_short, &integer_long),
+    BENCH_CASE(p101_format_uint16_t, &integer_short, &integer_long),
+    BENCH_CASE(p101_format_uint32_t, &integer_short, &integer_long),
+    BENCH_CASE(p101_format_uint64_t, &integer_short, &integer_long),
+    BENCH_CASE(p101_format_uint8_t, &integer_short, &integer_long),
+    BENCH_CASE(p101_format_unsigned_char, &integer_short, &integer_long),
+    BENCH_CASE(p101_format_unsigned_int, &integer_short, &integer_long),
+    BENCH_CASE(p101_format_unsigned_long, &integer_short, &integer_long),
+    BENCH_CASE(p101_format_unsigned_long_long, &integer_short, &integer_long),
+    BENCH_CASE(p101_format_unsigned_short, &integer_short, &integer_long),
+    BENCH_CASE(p101_lpm_build, &cidr_ipv4, &cidr_ipv6),
+    BENCH_CASE(p101_lpm_lookup, &address_ipv4, &address_ipv6),
+    BENCH_CASE(p101_lpm_lookup_compact, &address_ipv4, &address_ipv6),
+    BENCH_CASE(p101_lpm_size, &cidr_ipv4, &cidr_ipv6),
+    BENCH_CASE(p101_parse_char, &integer_short, &integer_long, &integer_invalid),
+    BENCH_CASE(p101_parse_char_n, &integer_short, &integer_long, &integer_invalid),
+    BENCH_CASE(p101_parse_char_prefix, &integer_short, &integer_long, &integer_invalid),
+    BENCH_CASE(p101_parse_double, &real_short, &real_long, &real_invalid),
+    BENCH_CASE(p101_parse_duration, &duration_valid, &duration_invalid),
+    BENCH_CASE(p101_parse_duration_timespec, &duration_valid, &duration_invalid),
+    BENCH_CASE(p101_parse_float, &real_short, &real_long, &real_invalid),
+    BENCH_CASE(p101_parse_hex_id, &trace_id, &integer_invalid),
+    BENCH_CASE(p101_parse_in_port_t, &port_valid, &port_invalid),
+    BENCH_CASE(p101_parse_int, &integer_short, &integer_long, &integer_invalid),
+    BENCH_CASE(p101_parse_int16_t, &integer_short, &integer_long, &integer_invalid),
+    BENCH_CASE(p101_parse_int16_t_array, &integer_short, &integer_long, &integer_invalid),
+    BENCH_CASE(p101_parse_int16_t_base, &integer_prefixed, &hex_id, &integer_invalid),
+    BENCH_CASE(p101_parse_int16_t_n, &integer_short, &integer_long, &integer_invalid),
+    BENCH_CASE(p101_parse_int16_t_prefix, &integer_short, &integer_long, &integer_invalid),
+    BENCH_CASE(p101_parse_int32_t, &integer_short, &integer_long, &integer_invalid),
+    BENCH_CASE(p101_parse_int32_t_array, &integer_short, &integer_long, &integer_invalid),
+    BENCH_CASE(p101_parse_int32_t_base, &integer_prefixed, &hex_id, &integer_invalid),
+    BENCH_CASE(p101_parse_int32_t_n, &integer_short, &integer_long, &integer_invalid),
+    BENCH_CASE(p101_parse_int32_t_prefix, &integer_short, &integer_long, &integer_invalid),
+    BENCH_CASE(p101_parse_int64_t, &integer_short, &integer_long, &integer_invalid),
+    BENCH_CASE(p101_parse_int64_t_array, &integer_short, &integer_long, &integer_invalid),
+    BENCH_CASE(p101_parse_int64_t_base, &integer_prefixed, &hex_id, &integer_invalid),
+    BENCH_CASE(p101_parse_int64_t_list, &list_valid, &list_invalid),
+    BENCH_CASE(p101_parse_int64_t_n, &integer_short, &integer_long, &integer_invalid),
+    BENCH_CASE(p101_parse_int64_t_prefix, &integer_short, &integer_long, &integer_invalid),
+    BENCH_CASE(p101_parse_int8_t, &integer_short, &integer_long, &integer_invalid),
+    BENCH_CASE(p101_parse_int8_t_array, &integer_short, &integer_long, &integer_invalid),
+    BENCH_CASE(p101_parse_int8_t_base, &integer_prefixed, &hex_id, &integer_invalid),
+    BENCH_CASE(p101_parse_int8_t_n, &integer_short, &integer_long, &integer_invalid),
+    BENCH_CASE(p101_parse_int8_t_prefix, &integer_short, &integer_long, &integer_invalid),
+    BENCH_CASE(p101_parse_int_n, &integer_short, &integer_long, &integer_invalid),
+    BENCH_CASE(p101_parse_int_prefix, &integer_short, &integer_long, &integer_invalid),
+    BENCH_CASE(p101_parse_long, &integer_short, &integer_long, &integer_invalid),
+    BENCH_CASE(p101_parse_long_long, &integer_short, &integer_long, &integer_invalid),
+    BENCH_CASE(p101_parse_long_long_n, &integer_short, &integer_long, &integer_invalid),
+    BENCH_CASE(p101_parse_long_long_prefix, &integer_short, &integer_long, &integer_invalid),
+    BENCH_CASE(p101_parse_long_n, &integer_short, &integer_long, &integer_invalid),
+    BENCH_CASE(p101_parse_long_prefix, &integer_short, &integer_long, &integer_invalid),
+    BENCH_CASE(p101_parse_negative_char, &integer_short, &integer_long, &integer_invalid),
+    BENCH_CASE(p101_parse_negative_char_n, &integer_short, &integer_long, &integer_invalid),
+    BENCH_CASE(p101_parse_negative_char_prefix, &integer_short, &integer_long, &integer_invalid),
+    BENCH_CASE(p101_parse_negative_int, &integer_short, &integer_long, &integer_invalid),
+    BENCH_CASE(p101_parse_negative_int16_t, &integer_short, &integer_long, &integer_invalid),
+    BENCH_CASE(p101_parse_negative_int16_t_n, &integer_short, &integer_long, &integer_invalid),
+    BENCH_CASE(p101_parse_negative_int16_t_prefix, &integer_short, &integer_long, &integer_invalid),
+    BENCH_CASE(p101_parse_negative_int32_t, &integer_short, &integer_long, &integer_invalid),
+    BENCH_CASE(p101_parse_negative_int32_t_n, &integer_short, &integer_long, &integer_invalid),
+    BENCH_CASE(p101_parse_negative_int32_t_prefix, &integer_short, &integer_long, &integer_invalid),
+    BENCH_CASE(p101_parse_negative_int64_t, &integer_short, &integer_long, &integer_invalid),
+    BENCH_CASE(p101_parse_negative_int64_t_n, &integer_short, &integer_long, &integer_invalid),
+    BENCH_CASE(p101_parse_negative_int64_t_prefix, &integer_short, &integer_long, &integer_invalid),
+    BENCH_CASE(p101_parse_negative_int8_t, &integer_short, &integer_long, &integer_invalid),
+    BENCH_CASE(p101_parse_negative_int8_t_n, &integer_short, &integer_long, &integer_invalid),
+    BENCH_CASE(p101_parse_negative_int8_t_prefix, &integer_short, &integer_long, &integer_invalid),
+    BENCH_CASE(p101_parse_negative_int_n, &integer_short, &integer_long, &integer_invalid),
+    BENCH_CASE(p101_parse_negative_int_prefix, &integer_short, &integer_long, &integer_invalid),
+    BENCH_CASE(p101_parse_negative_long, &integer_short, &integer_long, &integer_invalid),
+    BENCH_CASE(p101_parse_negative_long_long, &integer_short, &integer_long, &integer_invalid),
+    BENCH_CASE(p101_parse_negative_long_long_n, &integer_short, &integer_long, &integer_invalid),
+    BENCH_CASE(p101_parse_negative_long_long_prefix, &integer_short, &integer_long, &integer_invalid),
+    BENCH_CASE(p101_parse_negative_long_n, &integer_short, &integer_long, &integer_invalid),
+    BENCH_CASE(p101_parse_negative_long_prefix, &integer_short, &integer_long, &integer_invalid),
+    BENCH_CASE(p101_parse_negative_short, &integer_short, &integer_long, &integer_invalid),
+    BENCH_CASE(p101_parse_negative_short_n, &integer_short, &integer_long, &integer_invalid),
+    BENCH_CASE(p101_parse_negative_short_prefix, &integer_short, &integer_long, &integer_invalid),
+    BENCH_CASE(p101_parse_positive_char, &integer_short, &integer_long, &integer_invalid),
+    BENCH_CASE(p101_parse_positive_char_n, &integer_short, &integer_long, &integer_invalid),
+    BENCH_CASE(p101_parse_positive_char_prefix, &integer_short, &integer_long, &integer_invalid),
+    BENCH_CASE(p101_parse_positive_int, &integer_short, &integer_long, &integer_invalid),
+    BENCH_CASE(p101_parse_positive_int16_t, &integer_short, &integer_long, &integer_invalid),
+    BENCH_CASE(p101_parse_positive_int16_t_n, &integer_short, &integer_long, &integer_invalid),
+    BENCH_CASE(p101_parse_positive_int16_t_prefix, &integer_short, &integer_long, &integer_invalid),
+    BENCH_CASE(p101_parse_positive_int32_t, &integer_short, &integer_long, &integer_invalid),
+    BENCH_CASE(p101_parse_positive_int32_t_n, &integer_short, &integer_long, &integer_invalid),
+    BENCH_CASE(p101_parse_positive_int32_t_prefix, &integer_short, &integer_long, &integer_invalid),
+    BENCH_CASE(p101_parse_positive_int64_t, &integer_short, &integer_long, &integer_invalid),
+    BENCH_CASE(p101_parse_positive_int64_t_n, &integer_short, &integer_long, &integer_invalid),
+    BENCH_CASE(p101_parse_positive_int64_t_prefix, &integer_short, &integer_long, &integer_invalid),
+    BENCH_CASE(p101_parse_positive_int8_t, &integer_short, &integer_long, &integer_invalid),
+    BENCH_CASE(p101_parse_positive_int8_t_n, &integer_short, &integer_long, &integer_invalid),
+    BENCH_CASE(p101_parse_positive_int8_t_prefix, &integer_short, &integer_long, &integer_invalid),
+    BENCH_CASE(p101_parse_positive_int_n, &integer_short, &integer_long, &integer_invalid),
+    BENCH_CASE(p101_parse_positive_int_prefix, &integer_short, &integer_long, &integer_invalid),
+    BENCH_CASE(p101_parse_positive_long, &integer_short, &integer_long, &integer_invalid),
+    BENCH_CASE(p101_parse_positive_long_long, &integer_short, &integer_long, &integer_invalid),
+    BENCH_CASE(p101_parse_positive_long_long_n, &integer_short, &integer_long, &integer_invalid),
+    BENCH_CASE(p101_parse_positive_long_long_prefix, &integer_short, &integer_long, &integer_invalid),
+    BENCH_CASE(p101_parse_positive_long_n, &integer_short, &integer_long, &integer_invalid),
+    BENCH_CASE(p101_parse_positive_long_prefix, &integer_short, &integer_long, &integer_invalid),
+    BENCH_CASE(p101_parse_positive_short, &integer_short, &integer_long, &integer_invalid),
+    BENCH_CASE(p101_parse_positive_short_n, &integer_short, &integer_long, &integer_invalid),
+    BENCH_CASE(p101_parse_positive_short_prefix, &integer_short, &integer_long, &integer_invalid),
+    BENCH_CASE(p101_parse_short, &integer_short, &integer_long, &integer_invalid),
+    BENCH_CASE(p101_parse_short_n, &integer_short, &integer_long, &integer_invalid),
+    BENCH_CASE(p101_parse_short_prefix, &integer_short, &integer_long, &integer_invalid),
+    BENCH_CASE(p101_parse_uint128, &integer_short, &integer_wide, &integer_invalid),
+    BENCH_CASE(p101_parse_uint128_base, &trace_id, &integer_invalid),
+    BENCH_CASE(p101_parse_uint16_t, &integer_short, &integer_long, &integer_invalid),
+    BENCH_CASE(p101_parse_uint16_t_array, &integer_short, &integer_long, &integer_invalid),
+    BENCH_CASE(p101_parse_uint16_t_base, &integer_prefixed, &hex_id, &integer_invalid),
+    BENCH_CASE(p101_parse_uint16_t_n, &integer_short, &integer_long, &integer_invalid),
+    BENCH_CASE(p101_parse_uint16_t_prefix, &integer_short, &integer_long, &integer_invalid),
+    BENCH_CASE(p101_parse_uint16_t_size, &size_valid, &size_invalid),
+    BENCH_CASE(p101_parse_uint32_t, &integer_short, &integer_long, &integer_invalid),
+    BENCH_CASE(p101_parse_uint32_t_array, &integer_short, &integer_long, &integer_invalid),
+    BENCH_CASE(p101_parse_uint32_t_base, &integer_prefixed, &hex_id, &integer_invalid),
+    BENCH_CASE(p101_parse_uint32_t_n, &integer_short, &integer_long, &integer_invalid),
+    BENCH_CASE(p101_parse_uint32_t_prefix, &integer_short, &integer_long, &integer_invalid),
+    BENCH_CASE(p101_parse_uint32_t_size, &size_valid, &size_invalid),
+    BENCH_CASE(p101_parse_uint64_t, &integer_short, &integer_long, &integer_invalid),
+    BENCH_CASE(p101_parse_uint64_t_array, &integer_short, &integer_long, &integer_invalid),
+    BENCH_CASE(p101_parse_uint64_t_base, &integer_prefixed, &hex_id, &integer_invalid),
+    BENCH_CASE(p101_parse_uint64_t_list, &list_valid, &list_invalid),
+    BENCH_CASE(p101_parse_uint64_t_n, &integer_short, &integer_long, &integer_invalid),
+    BENCH_CASE(p101_parse_uint64_t_prefix, &integer_short, &integer_long, &integer_invalid),
+    BENCH_CASE(p101_parse_uint64_t_size, &size_valid, &size_invalid),
+    BENCH_CASE(p101_parse_uint8_t, &integer_short, &integer_long, &integer_invalid),
+    BENCH_CASE(p101_parse_uint8_t_array, &integer_short, &integer_long, &integer_invalid),
+    BENCH_CASE(p101_parse_uint8_t_base, &integer_prefixed, &hex_id, &integer_invalid),
+    BENCH_CASE(p101_parse_uint8_t_n, &integer_short, &integer_long, &integer_invalid),
+    BENCH_CASE(p101_parse_uint8_t_prefix, &integer_short, &integer_long, &integer_invalid),
+    BENCH_CASE(p101_parse_uint8_t_size, &size_valid, &size_invalid),
+    BENCH_CASE(p101_parse_unsigned_char, &integer_short, &integer_long, &integer_invalid),
+    BENCH_CASE(p101_parse_unsigned_char_n, &integer_short, &integer_long, &integer_invalid),
+    BENCH_CASE(p101_parse_unsigned_char_prefix, &integer_short, &integer_long, &integer_invalid),
+    BENCH_CASE(p101_parse_unsigned_int, &integer_short, &integer_long, &integer_invalid),
+    BENCH_CASE(p101_parse_unsigned_int_n, &integer_short, &integer_long, &integer_invalid),
+    BENCH_CASE(p101_parse_unsigned_int_prefix, &integer_short, &integer_long, &integer_invalid),
+    BENCH_CASE(p101_parse_unsigned_long, &integer_short, &integer_long, &integer_invalid),
+    BENCH_CASE(p101_parse_unsigned_long_long, &integer_short, &integer_long, &integer_invalid),
+    BENCH_CASE(p101_parse_unsigned_long_long_n, &integer_short, &integer_long, &integer_invalid),
+    BENCH_CASE(p101_parse_unsigned_long_long_prefix, &integer_short, &integer_long, &integer_invalid),
+    BENCH_CASE(p101_parse_unsigned_long_n, &integer_short, &integer_long, &integer_invalid),
+    BENCH_CASE(p101_parse_unsigned_long_prefix, &integer_short, &integer_long, &integer_invalid),
+    BENCH_CASE(p101_parse_unsigned_short, &integer_short, &integer_long, &integer_invalid),
+    BENCH_CASE(p101_parse_unsigned_short_n, &integer_short, &integer_long, &integer_invalid),
+    BENCH_CASE(p101_parse_unsigned_short_prefix, &integer_short, &integer_long, &integer_invalid),
+    BENCH_CASE(p101_try_parse_char, &integer_short, &integer_long, &integer_invalid),
+    BENCH_CASE(p101_try_parse_int, &integer_short, &integer_long, &integer_invalid),
+    BENCH_CASE(p101_try_parse_int16_t, &integer_short, &integer_long, &integer_invalid),
+    BENCH_CASE(p101_try_parse_int32_t, &integer_short, &integer_long, &integer_invalid),
+    BENCH_CASE(p101_try_parse_int64_t, &integer_short, &integer_long, &integer_invalid),
+    BENCH_CASE(p101_try_parse_int8_t, &integer_short, &integer_long, &integer_invalid),
+    BENCH_CASE(p101_try_parse_long, &integer_short, &integer_long, &integer_invalid),
+    BENCH_CASE(p101_try_parse_long_long, &integer_short, &integer_long, &integer_invalid),
+    BENCH_CASE(p101_try_parse_negative_char, &integer_short, &integer_long, &integer_invalid),
+    BENCH_CASE(p101_try_parse_negative_int, &integer_short, &integer_long, &integer_invalid),
+    BENCH_CASE(p101_try_parse_negative_int16_t, &integer_short, &integer_long, &integer_invalid),
+    BENCH_CASE(p101_try_parse_negative_int32_t, &integer_short, &integer_long, &integer_invalid),
+    BENCH_CASE(p101_try_parse_negative_int64_t, &integer_short, &integer_long, &integer_invalid),
+    BENCH_CASE(p101_try_parse_negative_int8_t, &integer_short, &integer_long, &integer_invalid),
+    BENCH_CASE(p101_try_parse_negative_long, &integer_short, &integer_long, &integer_invalid),
+    BENCH_CASE(p101_try_parse_negative_long_long, &integer_short, &integer_long, &integer_invalid),
+    BENCH_CASE(p101_try_parse_negative_short, &integer_short, &integer_long, &integer_invalid),
+    BENCH_CASE(p101_try_parse_positive_char, &integer_short, &integer_long, &integer_invalid),
+    BENCH_CASE(p101_try_parse_positive_int, &integer_short, &integer_long, &integer_invalid),
+    BENCH_CASE(p101_try_parse_positive_int16_t, &integer_short, &integer_long, &integer_invalid),
+    BENCH_CASE(p101_try_parse_positive_int32_t, &integer_short, &integer_long, &integer_invalid),
+    BENCH_CASE(p101_try_parse_positive_int64_t, &integer_short, &integer_long, &integer_invalid),
+    BENCH_CASE(p101_try_parse_positive_int8_t, &integer_short, &integer_long, &integer_invalid),
+    BENCH_CASE(p101_try_parse_positive_long, &integer_short, &integer_long, &integer_invalid),
+    BENCH_CASE(p101_try_parse_positive_long_long, &integer_short, &integer_long, &integer_invalid),
+    BENCH_CASE(p101_try_parse_positive_short, &integer_short, &integer_long, &integer_invalid),
+    BENCH_CASE(p101_try_parse_short, &integer_short, &integer_long, &integer_invalid),
+    BENCH_CASE(p101_try_parse_uint16_t, &integer_short, &integer_long, &integer_invalid),
+    BENCH_CASE(p101_try_parse_uint32_t, &integer_short, &integer_long, &integer_invalid),
+    BENCH_CASE(p101_try_parse_uint64_t, &integer_short, &integer_long, &integer_invalid),
+    BENCH_CASE(p101_try_parse_uint8_t, &integer_short, &integer_long, &integer_invalid),
+    BENCH_CASE(p101_try_parse_unsigned_char, &integer_short, &integer_long, &integer_invalid),
+    BENCH_CASE(p101_try_parse_unsigned_int, &integer_short, &integer_long, &integer_invalid),
+    BENCH_CASE(p101_try_parse_unsigned_long, &integer_short, &integer_long, &integer_invalid),
+    BENCH_CASE(p101_try_parse_unsigned_long_long, &integer_short, &integer_long, &integer_invalid),
+    BENCH_CASE(p101_try_parse_unsigned_short, &integer_short, &integer_long, &integer_invalid),
+};
+
+/* ------------------------------------------------------------------- driver */
+
+static double now_ns(void)
+{
+    struct timespec ts;
+
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ((double)ts.tv_sec * 1e9) + (double)ts.tv_nsec;
+}
+
+static void measure_lengths(void)
+{
+    for(size_t d = 0; d < sizeof(all_distributions) / sizeof(all_distributions[0]); d++)
+    {
+        for(size_t i = 0; i < BENCH_INPUTS; i++)
+        {
+            all_distributions[d]->length[i] = strlen(all_distributions[d]->text[i]);
+        }
+    }
+}
+
+static size_t load_baseline(const char *path, struct bench_result *baseline, size_t capacity)
+{
+    FILE  *file;
+    char   line[256];
+    size_t count;
+
+    file = fopen(path, "r");
+    if(file == NULL)
+    {
+        perror(path);
+        return 0;
+    }
+
+    count = 0;
+    while(count < capacity && fgets(line, sizeof(line), file) != NULL)
+    {
+        if(sscanf(line, "%95s %95s %lf", baseline[count].function, baseline[count].distribution, &baseline[count].ns_per_op) == 3 && baseline[count].ns_per_op > 0)
+        {
+            count++;
+        }
+    }
+
+    fclose(file);
+    return count;
+}
+
+static const struct bench_result *find_baseline(const struct bench_result *baseline, size_t count, const char *function, const char *distribution)
+{
+    for(size_t i = 0; i < count; i++)
+    {
+        if(strcmp(baseline[i].function, function) == 0 && strcmp(baseline[i].distribution, distribution) == 0)
+        {
+            return &baseline[i];
+        }
+    }
+
+    return NULL;
+}
+
+static double run_case(const struct p101_env *env, struct p101_error *err, const struct bench_case *bench, const struct bench_inputs *inputs)
+{
+    double best;
+
+    best = 0;
+    for(int r = 0; r < BENCH_REPETITIONS; r++)
+    {
+        double start;
+        double elapsed;
+        long   ops;
+
+        start   = now_ns();
+        ops     = bench->run(env, err, inputs, BENCH_TARGET_OPS);
+        elapsed = (now_ns() - start) / (double)ops;
+        if(r == 0 || elapsed < best)
+        {
+            best = elapsed;
+        }
+    }
+
+    p101_error_reset(err);
+    return best;
+}
+
+static void usage(const char *program)
+{
+    fprintf(stderr, "Usage: %s [-b baseline] [-o output] [filter]\n", program);
+}
+
+int main(int argc, char *argv[])
+{
+    static struct bench_result baseline[BENCH_MAX_BASELINE];
+    const char                *filter;
+    const char                *output_path;
+    const char                *baseline_path;
+    FILE                      *output;
+    size_t                     baseline_count;
+    struct p101_error         *err;
+    struct p101_env           *env;
+    int                        opt;
+
+    output_path   = NULL;
+    baseline_path = NULL;
+    while((opt = getopt(argc, argv, "b:o:h")) != -1)
+    {
+        switch(opt)
+        {
+            case 'b':
+                baseline_path = optarg;
+                break;
+            case 'o':
+                output_path = optarg;
+                break;
+            default:
+                usage(argv[0]);
+                return opt == 'h' ? EXIT_SUCCESS : EXIT_FAILURE;
+        }
+    }
+    if(argc - optind > 1)
+    {
+        usage(argv[0]);
+        return EXIT_FAILURE;
+    }
+    filter = optind < argc ? argv[optind] : NULL;
+
+    baseline_count = 0;
+    if(baseline_path != NULL)
+    {
+        baseline_count = load_baseline(baseline_path, baseline, BENCH_MAX_BASELINE);
+        if(baseline_count == 0)
+        {
+            return EXIT_FAILURE;
+        }
+    }
+
+    output = NULL;
+    if(output_path != NULL)
+    {
+        output = fopen(output_path, "w");
+        if(output == NULL)
+        {
+            perror(output_path);
+            return EXIT_FAILURE;
+        }
+    }
+
+    err = p101_error_create(false);
+    if(err == NULL)
+    {
+        if(output != NULL)
+        {
+            fclose(output);
+        }
+        return EXIT_FAILURE;
+    }
+    env = p101_env_create(err, NULL);
+    if(env == NULL)
+    {
+        p101_error_destroy(err);
+        if(output != NULL)
+        {
+            fclose(output);
+        }
+        return EXIT_FAILURE;
+    }
+
+    measure_lengths();
+    printf("%-42s %-8s %10s %14s%s\n", "function", "inputs", "ns/op", "ops/sec", baseline_count > 0 ? "     change" : "");
+    for(size_t c = 0; c < sizeof(cases) / sizeof(cases[0]); c++)
+    {
+        if(filter != NULL && strstr(cases[c].function, filter) == NULL)
+        {
+            continue;
+        }
+
+        for(size_t d = 0; d < BENCH_MAX_DISTRIBUTED && cases[c].distributions[d] != NULL; d++)
+        {
+            const struct bench_inputs *inputs;
+            double                     ns_per_op;
+
+            inputs    = cases[c].distributions[d];
+            ns_per_op = run_case(env, err, &cases[c], inputs);
+            printf("%-42s %-8s %10.2f %14.0f", cases[c].function, inputs->name, ns_per_op, 1e9 / ns_per_op);
+            if(baseline_count > 0)
+            {
+                const struct bench_result *previous;
+
+                previous = find_baseline(baseline, baseline_count, cases[c].function, inputs->name);
+                if(previous != NULL)
+                {
+                    printf(" %+9.1f%%", ((ns_per_op - previous->ns_per_op) / previous->ns_per_op) * 100.0);
+                }
+                else
+                {
+                    printf(" %10s", "new");
+                }
+            }
+            printf("\n");
+            if(output != NULL)
+            {
+                fprintf(output, "%s %s %.2f %.0f\n", cases[c].function, inputs->name, ns_per_op, 1e9 / ns_per_op);
+            }
+        }
+    }
+
+    p101_env_destroy(env);
+    p101_error_destroy(err);
+    if(output != NULL)
+    {
+        fclose(output);
+    }
+    return EXIT_SUCCESS;
+}
@@ -0,0 +1,311 @@
+/*
+ * p101_parse_double() and p101_parse_float() against strtod() and strtof().
+ *
+ * Each distribution is BENCH_INPUTS strings generated up front from a fixed
+ * seed, parsed in order:
+ *
+ *   short      hand-written config values such as "0.25", "1500" or "2e-3"
+ *   roundtrip  random doubles printed with 17 significant digits, the way a
+ *              serializer that must round-trip writes them
+ *   float      random floats printed with 9 significant digits
+ *   long       40-digit decimals, past the 19 digits the fast paths hold
+ *
+ * The library is compiled with P101_CONVERT_RELEASE, so the figures compare
+ * the conversions themselves rather than the tracing hooks, and the C
+ * library's functions run in the "C" locale. Every loop is timed
+ * BENCH_REPETITIONS times and the best run is reported. Any result that
+ * differs from the C library's, or a range error where it has none, is
+ * counted and fails the run.
+ *
+ *   cmake --build build-bench --target run_bench_floating
+ */
+#include <errno.h>
+#include <math.h>
+#include <p101_convert/errors.h>
+#include <p101_convert/floating.h>
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+enum
+{
+    BENCH_INPUTS       = 1 << 12,
+    BENCH_ITERATIONS   = 1 << 21,
+    BENCH_REPETITIONS  = 5,
+    BENCH_SEED         = 101,
+    BENCH_TEXT_SIZE    = 48,
+    BENCH_LONG_DIGITS  = 40,
+    BENCH_DISTRIBUTION = 4
+};
+
+enum bench_parser
+{
+    PARSE_DOUBLE,
+    PARSE_STRTOD,
+    PARSE_FLOAT,
+    PARSE_STRTOF
+};
+
+static volatile uint64_t sink;
+
+static double now_ns(void)
+{
+    struct timespec ts;
+
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ((double)ts.tv_sec * 1e9) + (double)ts.tv_nsec;
+}
+
+/* xorshift64: fast, and the same sequence on every platform. */
+static uint64_t next_random(uint64_t *state)
+{
+    *state ^= *state << 13U;
+    *state ^= *state >> 7U;
+    *state ^= *state << 17U;
+    return *state;
+}
+
+static void make_short(uint64_t *state, char *text)
+{
+    unsigned int a;
+    unsigned int b;
+
+    a = (unsigned int)(next_random(state) % 10000U);
+    b = (unsigned int)(next_random(state) % 100U);
+    switch(next_random(state) % 6U)
+    {
+        case 0:
+            snprintf(text, BENCH_TEXT_SIZE, "%u", a);
+            break;
+        case 1:
+            snprintf(text, BENCH_TEXT_SIZE, "%u.%u", a, b);
+            break;
+        case 2:
+            snprintf(text, BENCH_TEXT_SIZE, "0.%u", a);
+            break;
+        case 3:
+            snprintf(text, BENCH_TEXT_SIZE, "%ue-%u", a % 10U, b % 10U);
+            break;
+        case 4:
+            snprintf(text, BENCH_TEXT_SIZE, "-%u.%u", a, b);
+            break;
+        default:
+            snprintf(text, BENCH_TEXT_SIZE, "%u.%ue%u", a % 10U, b, b % 20U);
+            break;
+    }
+}
+
+static void make_roundtrip(uint64_t *state, char *text)
+{
+    uint64_t bits;
+    double   value;
+
+    bits = next_random(state) & UINT64_C(0xFFEFFFFFFFFFFFFF);
+    memcpy(&value, &bits, sizeof(value));
+    snprintf(text, BENCH_TEXT_SIZE, "%.17g", value);
+}
+
+static void make_float(uint64_t *state, char *text)
+{
+    uint32_t bits;
+    float    value;
+
+    bits = (uint32_t)next_random(state) & UINT32_C(0xFF7FFFFF);
+    memcpy(&value, &bits, sizeof(value));
+    snprintf(text, BENCH_TEXT_SIZE, "%.9g", (double)value);
+}
+
+static void make_long(uint64_t *state, char *text)
+{
+    size_t length;
+
+    length = 0;
+    for(int i = 0; i < BENCH_LONG_DIGITS; i++)
+    {
+        text[length] = (char)('0' + (next_random(state) % 10U));
+        length++;
+        if(i == 0)
+        {
+            text[length] = '.';
+            length++;
+        }
+    }
+    snprintf(&text[length], BENCH_TEXT_SIZE - length, "e%d", (int)(next_random(state) % 80U) - 40);
+}
+
+static double time_parser(const struct p101_env *env, struct p101_error *err, enum bench_parser parser, char (*texts)[BENCH_TEXT_SIZE])
+{
+    double best;
+
+    best = 0;
+    for(int r = 0; r < BENCH_REPETITIONS; r++)
+    {
+        double start;
+        double elapsed;
+
+        start = now_ns();
+        for(long i = 0; i < BENCH_ITERATIONS; i++)
+        {
+            const char *text;
+            double      value;
+            float       narrow;
+            uint64_t    bits;
+            uint32_t    narrow_bits;
+
+            text = texts[i & (BENCH_INPUTS - 1)];
+            switch(parser)
+            {
+                case PARSE_DOUBLE:
+                    value = p101_parse_double(env, err, text, 0.0);
+                    memcpy(&bits, &value, sizeof(bits));
+                    sink += bits;
+                    break;
+                case PARSE_STRTOD:
+                    value = strtod(text, NULL);
+                    memcpy(&bits, &value, sizeof(bits));
+                    sink += bits;
+                    break;
+                case PARSE_FLOAT:
+                    narrow = p101_parse_float(env, err, text, 0.0F);
+                    memcpy(&narrow_bits, &narrow, sizeof(narrow_bits));
+                    sink += narrow_bits;
+                    break;
+                default:
+                    narrow = strtof(text, NULL);
+                    memcpy(&narrow_bits, &narrow, sizeof(narrow_bits));
+                    sink += narrow_bits;
+                    break;
+            }
+            if(p101_error_has_error(err))
+            {
+                p101_error_reset(err);
+            }
+        }
+        elapsed = (now_ns() - start) / BENCH_ITERATIONS;
+        if(r == 0 || elapsed < best)
+        {
+            best = elapsed;
+        }
+    }
+
+    return best;
+}
+
+/*
+ * Where the C library overflows, or underflows to zero, the parser has to
+ * raise a range error instead; anywhere else it has to match bit for bit.
+ */
+static bool agrees(struct p101_error *err, const void *value, const void *expected, size_t size, bool out_of_range)
+{
+    bool ok;
+
+    if(out_of_range)
+    {
+        ok = p101_error_is_error(err, P101_ERROR_USER, P101_CONVERT_ERROR_RANGE);
+    }
+    else
+    {
+        ok = p101_error_has_no_error(err) && memcmp(value, expected, size) == 0;
+    }
+    p101_error_reset(err);
+
+    return ok;
+}
+
+static long count_mismatches(const struct p101_env *env, struct p101_error *err, char (*texts)[BENCH_TEXT_SIZE])
+{
+    long mismatches;
+
+    mismatches = 0;
+    for(int i = 0; i < BENCH_INPUTS; i++)
+    {
+        double value;
+        double expected;
+        float  narrow;
+        float  expected_narrow;
+        bool   out_of_range;
+
+        value        = p101_parse_double(env, err, texts[i], 0.0);
+        errno        = 0;
+        expected     = strtod(texts[i], NULL);
+        out_of_range = errno == ERANGE && (isinf(expected) || expected == 0.0);
+        if(!agrees(err, &value, &expected, sizeof(value), out_of_range))
+        {
+            mismatches++;
+        }
+
+        narrow          = p101_parse_float(env, err, texts[i], 0.0F);
+        errno           = 0;
+        expected_narrow = strtof(texts[i], NULL);
+        out_of_range    = errno == ERANGE && (isinf(expected_narrow) || expected_narrow == 0.0F);
+        if(!agrees(err, &narrow, &expected_narrow, sizeof(narrow), out_of_range))
+        {
+            mismatches++;
+        }
+    }
+
+    return mismatches;
+}
+
+int main(void)
+{
+    static const char *const names[BENCH_DISTRIBUTION] = {"short", "roundtrip", "float", "long"};
+    static void (*const generators[BENCH_DISTRIBUTION])(uint64_t *, char *) = {make_short, make_roundtrip, make_float, make_long};
+    char (*texts)[BENCH_TEXT_SIZE];
+    struct p101_error *err;
+    struct p101_env   *env;
+    int                status;
+
+    err = p101_error_create(false);
+    if(err == NULL)
+    {
+        return EXIT_FAILURE;
+    }
+    env   = p101_env_create(err, NULL);
+    texts = malloc(sizeof(*texts) * BENCH_INPUTS);
+    if(env == NULL || texts == NULL)
+    {
+        free(texts);
+        p101_env_destroy(env);
+        p101_error_destroy(err);
+        return EXIT_FAILURE;
+    }
+
+    status = EXIT_SUCCESS;
+    printf("%-10s %12s %12s %8s %12s %12s %8s %10s\n", "inputs", "double ns", "strtod ns", "speedup", "float ns", "strtof ns", "speedup", "mismatch");
+    for(int d = 0; d < BENCH_DISTRIBUTION; d++)
+    {
+        uint64_t state;
+        double   parse_double;
+        double   parse_strtod;
+        double   parse_float;
+        double   parse_strtof;
+        long     mismatches;
+
+        state = BENCH_SEED;
+        for(int i = 0; i < BENCH_INPUTS; i++)
+        {
+            generators[d](&state, texts[i]);
+        }
+
+        mismatches   = count_mismatches(env, err, texts);
+        parse_double = time_parser(env, err, PARSE_DOUBLE, texts);
+        parse_strtod = time_parser(env, err, PARSE_STRTOD, texts);
+        parse_float  = time_parser(env, err, PARSE_FLOAT, texts);
+        parse_strtof = time_parser(env, err, PARSE_STRTOF, texts);
+        printf("%-10s %12.2f %12.2f %7.2fx %12.2f %12.2f %7.2fx %10ld\n", names[d], parse_double, parse_strtod, parse_strtod / parse_double, parse_float, parse_strtof, parse_strtof / parse_float, mismatches);
+        if(mismatches != 0)
+        {
+            status = EXIT_FAILURE;
+        }
+    }
+
+    free(texts);
+    p101_env_destroy(env);
+    p101_error_destroy(err);
+    return status;
+}
@@ -0,0 +1,322 @@
+/*
+ * Longest-prefix-match lookups per second at routing-table scale.
+ *
+ * For each family a table of 100k and of 1M random prefixes is built, with
+ * prefix lengths weighted the way real tables are (mostly /24 for IPv4, /48
+ * for IPv6 inside 2000::/3), and then 1M addresses are looked up in a random
+ * order: half inside a prefix of the table and half anywhere. At 1M prefixes
+ * the table is far larger than the cache, so the figures include the misses
+ * a real router or ACL check would take.
+ *
+ *   cmake --build build-bench --target run_bench_lpm
+ *
+ * Each lookup loop is timed BENCH_REPETITIONS times and the best run is
+ * reported, for compact addresses and for sockaddrs, together with the
+ * table size and the time the build took.
+ */
+#include <p101_convert/lpm.h>
+#include <p101_convert/networking.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+enum
+{
+    BENCH_LOOKUPS     = 1 << 20,
+    BENCH_REPETITIONS = 5,
+    BENCH_SEED        = 101
+};
+
+struct bench_addresses
+{
+    struct p101_compact_address *compact;
+    struct sockaddr_in          *sin;
+    struct sockaddr_in6         *sin6;
+};
+
+static volatile uint64_t sink;
+
+static double now_ns(void)
+{
+    struct timespec ts;
+
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ((double)ts.tv_sec * 1e9) + (double)ts.tv_nsec;
+}
+
+/* xorshift64: fast, and the same sequence on every platform. */
+static uint64_t next_random(uint64_t *state)
+{
+    *state ^= *state << 13U;
+    *state ^= *state >> 7U;
+    *state ^= *state << 17U;
+    return *state;
+}
+
+static unsigned int ipv4_length(uint64_t *state)
+{
+    unsigned int roll;
+
+    roll = (unsigned int)(next_random(state) % 100U);
+    if(roll < 60U)
+    {
+        return 24;
+    }
+    if(roll < 70U)
+    {
+        return 22U + (unsigned int)(next_random(state) % 2U);
+    }
+    if(roll < 85U)
+    {
+        return 16U + (unsigned int)(next_random(state) % 6U);
+    }
+    if(roll < 95U)
+    {
+        return 25U + (unsigned int)(next_random(state) % 8U);
+    }
+    return 8U + (unsigned int)(next_random(state) % 8U);
+}
+
+static unsigned int ipv6_length(uint64_t *state)
+{
+    unsigned int roll;
+
+    roll = (unsigned int)(next_random(state) % 100U);
+    if(roll < 50U)
+    {
+        return 48;
+    }
+    if(roll < 70U)
+    {
+        return 32U + (unsigned int)(next_random(state) % 16U);
+    }
+    if(roll < 85U)
+    {
+        return 49U + (unsigned int)(next_random(state) % 16U);
+    }
+    if(roll < 95U)
+    {
+        return 19U + (unsigned int)(next_random(state) % 13U);
+    }
+    return 128;
+}
+
+static void random_address(uint64_t *state, uint8_t family, struct p101_compact_address *address)
+{
+    uint64_t bits[2];
+
+    memset(address, 0, sizeof(*address));
+    address->family = family;
+    bits[0]         = next_random(state);
+    bits[1]         = next_random(state);
+    memcpy(address->address, bits, sizeof(address->address));
+    if(family == P101_COMPACT_ADDRESS_IPV4)
+    {
+        memset(&address->address[4], 0, sizeof(address->address) - 4U);
+    }
+    else
+    {
+        address->address[0] = (uint8_t)(0x20U | (address->address[0] & 0x1FU));
+    }
+}
+
+static void clear_host_bits(struct p101_cidr *prefix)
+{
+    for(unsigned int bit = prefix->prefix_length; bit < 128U; bit++)
+    {
+        prefix->network.address[bit / 8U] &= (uint8_t) ~(0x80U >> (bit % 8U));
+    }
+}
+
+static void make_prefixes(uint64_t *state, uint8_t family, struct p101_cidr *prefixes, size_t count)
+{
+    for(size_t i = 0; i < count; i++)
+    {
+        memset(&prefixes[i], 0, sizeof(prefixes[i]));
+        random_address(state, family, &prefixes[i].network);
+        prefixes[i].prefix_length = (uint8_t)(family == P101_COMPACT_ADDRESS_IPV4 ? ipv4_length(state) : ipv6_length(state));
+        clear_host_bits(&prefixes[i]);
+    }
+}
+
+/* Half the addresses fall inside a prefix of the table, half anywhere. */
+static void make_addresses(uint64_t *state, uint8_t family, const struct p101_cidr *prefixes, size_t count, const struct bench_addresses *addresses)
+{
+    for(size_t i = 0; i < BENCH_LOOKUPS; i++)
+    {
+        struct p101_compact_address *compact;
+
+        compact = &addresses->compact[i];
+        random_address(state, family, compact);
+        if(i % 2U == 0U)
+        {
+            const struct p101_cidr *prefix;
+
+            prefix = &prefixes[next_random(state) % count];
+            for(unsigned int bit = 0; bit < prefix->prefix_length; bit++)
+            {
+                uint8_t mask;
+
+                mask                               = (uint8_t)(0x80U >> (bit % 8U));
+                compact->address[bit / 8U] = (uint8_t)((compact->address[bit / 8U] & ~mask) | (prefix->network.address[bit / 8U] & mask));
+            }
+        }
+        if(family == P101_COMPACT_ADDRESS_IPV4)
+        {
+            memset(&addresses->sin[i], 0, sizeof(addresses->sin[i]));
+            addresses->sin[i].sin_family = AF_INET;
+            memcpy(&addresses->sin[i].sin_addr, compact->address, sizeof(addresses->sin[i].sin_addr));
+        }
+        else
+        {
+            memset(&addresses->sin6[i], 0, sizeof(addresses->sin6[i]));
+            addresses->sin6[i].sin6_family = AF_INET6;
+            memcpy(&addresses->sin6[i].sin6_addr, compact->address, sizeof(addresses->sin6[i].sin6_addr));
+        }
+    }
+}
+
+static double time_lookups(const struct p101_env *env, struct p101_error *err, const struct p101_lpm *lpm, uint8_t family, const struct bench_addresses *addresses, int compact)
+{
+    double best;
+
+    best = 0;
+    for(int r = 0; r < BENCH_REPETITIONS; r++)
+    {
+        double start;
+        double elapsed;
+
+        start = now_ns();
+        for(size_t i = 0; i < BENCH_LOOKUPS; i++)
+        {
+            if(compact)
+            {
+                sink += p101_lpm_lookup_compact(env, err, lpm, &addresses->compact[i]);
+            }
+            else if(family == P101_COMPACT_ADDRESS_IPV4)
+            {
+                sink += p101_lpm_lookup(env, err, lpm, (const struct sockaddr *)&addresses->sin[i]);
+            }
+            else
+            {
+                sink += p101_lpm_lookup(env, err, lpm, (const struct sockaddr *)&addresses->sin6[i]);
+            }
+        }
+        elapsed = (now_ns() - start) / BENCH_LOOKUPS;
+        if(r == 0 || elapsed < best)
+        {
+            best = elapsed;
+        }
+    }
+
+    return best;
+}
+
+static int run_table(const struct p101_env *env, struct p101_error *err, uint8_t family, size_t count, const struct bench_addresses *addresses)
+{
+    struct p101_cidr      *prefixes;
+    const struct p101_lpm *lpm;
+    void                  *memory;
+    size_t                 size;
+    uint64_t               state;
+    double                 start;
+    double                 build_ms;
+    const char            *name;
+
+    name     = family == P101_COMPACT_ADDRESS_IPV4 ? "ipv4" : "ipv6";
+    state    = BENCH_SEED;
+    memory   = NULL;
+    prefixes = malloc(count * sizeof(*prefixes));
+    if(prefixes == NULL)
+    {
+        return EXIT_FAILURE;
+    }
+
+    make_prefixes(&state, family, prefixes, count);
+    size = p101_lpm_size(env, err, prefixes, count);
+    if(size != 0)
+    {
+        memory = malloc(size);
+    }
+    if(memory == NULL)
+    {
+        free(prefixes);
+        return EXIT_FAILURE;
+    }
+
+    start    = now_ns();
+    lpm      = p101_lpm_build(env, err, prefixes, count, memory, size);
+    build_ms = (now_ns() - start) / 1e6;
+    if(lpm == NULL)
+    {
+        free(memory);
+        free(prefixes);
+        return EXIT_FAILURE;
+    }
+
+    make_addresses(&state, family, prefixes, count, addresses);
+    for(int compact = 1; compact >= 0; compact--)
+    {
+        double ns_per_lookup;
+
+        ns_per_lookup = time_lookups(env, err, lpm, family, addresses, compact);
+        printf("%-6s %-9s %9zu %10.1f %10.1f %10.2f %14.0f\n", name, compact ? "compact" : "sockaddr", count, (double)size / (1024.0 * 1024.0), build_ms, ns_per_lookup, 1e9 / ns_per_lookup);
+    }
+
+    free(memory);
+    free(prefixes);
+    return EXIT_SUCCESS;
+}
+
+int main(void)
+{
+    static const size_t    counts[] = {100000, 1000000};
+    static const uint8_t   families[] = {P101_COMPACT_ADDRESS_IPV4, P101_COMPACT_ADDRESS_IPV6};
+    struct bench_addresses addresses;
+    struct p101_error     *err;
+    struct p101_env       *env;
+    int                    status;
+
+    err = p101_error_create(false);
+    if(err == NULL)
+    {
+        return EXIT_FAILURE;
+    }
+    env = p101_env_create(err, NULL);
+    if(env == NULL)
+    {
+        p101_error_destroy(err);
+        return EXIT_FAILURE;
+    }
+
+    status            = EXIT_SUCCESS;
+    addresses.compact = malloc(BENCH_LOOKUPS * sizeof(*addresses.compact));
+    addresses.sin     = malloc(BENCH_LOOKUPS * sizeof(*addresses.sin));
+    addresses.sin6    = malloc(BENCH_LOOKUPS * sizeof(*addresses.sin6));
+    if(addresses.compact == NULL || addresses.sin == NULL || addresses.sin6 == NULL)
+    {
+        status = EXIT_FAILURE;
+    }
+
+    printf("%-6s %-9s %9s %10s %10s %10s %14s\n", "family", "lookup", "prefixes", "MiB", "build ms", "ns/lookup", "lookups/sec");
+    for(size_t f = 0; status == EXIT_SUCCESS && f < sizeof(families) / sizeof(families[0]); f++)
+    {
+        for(size_t c = 0; status == EXIT_SUCCESS && c < sizeof(counts) / sizeof(counts[0]); c++)
+        {
+            status = run_table(env, err, families[f], counts[c], &addresses);
+        }
+    }
+    if(status != EXIT_SUCCESS)
+    {
+        fprintf(stderr, "bench_lpm: %s\n", p101_error_has_error(err) ? p101_error_get_message(err) : "out of memory");
+    }
+
+    free(addresses.sin6);
+    free(addresses.sin);
+    free(addresses.compact);
+    p101_env_destroy(env);
+    p101_error_destroy(err);
+    return status;
+}
@@ -0,0 +1,142 @@
+/*
+ * Per-call cost of lib_convert's own instrumentation.
+ *
+ * This file is built twice (see CMakeLists.txt): once as the library is
+ * normally compiled, with P101_TRACE on entry and exit of every function and a
+ * fault-injection check in every public one, and once with
+ * P101_CONVERT_RELEASE, which compiles both out. Running the two binaries back
+ * to back shows what the release configuration saves on each call:
+ *
+ *   cmake --build build-bench --target run_bench_trace
+ *
+ * Each case is timed over BENCH_ITERATIONS calls and the best of
+ * BENCH_REPETITIONS runs is reported, which filters out most scheduler noise.
+ * The results are fed into a volatile sink so the calls cannot be optimised
+ * away.
+ */
+#include <p101_convert/integer.h>
+#include <p101_convert/networking.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <time.h>
+
+#ifdef P101_CONVERT_RELEASE
+    #define BENCH_BUILD "release"
+#else
+    #define BENCH_BUILD "instrumented"
+#endif
+
+enum
+{
+    BENCH_ITERATIONS  = 2000000,
+    BENCH_REPETITIONS = 7
+};
+
+struct bench_case
+{
+    const char *name;
+    void (*run)(const struct p101_env *env, struct p101_error *err);
+};
+
+static volatile uint64_t sink;
+
+static void run_parse_int32_t(const struct p101_env *env, struct p101_error *err)
+{
+    for(long i = 0; i < BENCH_ITERATIONS; i++)
+    {
+        sink += (uint64_t)p101_parse_int32_t(env, err, "12345", 0);
+    }
+}
+
+static void run_parse_uint64_t(const struct p101_env *env, struct p101_error *err)
+{
+    for(long i = 0; i < BENCH_ITERATIONS; i++)
+    {
+        sink += p101_parse_uint64_t(env, err, "18446744073709551615", 0);
+    }
+}
+
+static void run_parse_int32_t_rejected(const struct p101_env *env, struct p101_error *err)
+{
+    for(long i = 0; i < BENCH_ITERATIONS; i++)
+    {
+        sink += (uint64_t)p101_parse_int32_t(env, err, "12x", 0);
+        p101_error_reset(err);
+    }
+}
+
+static void run_parse_in_port_t(const struct p101_env *env, struct p101_error *err)
+{
+    for(long i = 0; i < BENCH_ITERATIONS; i++)
+    {
+        sink += p101_parse_in_port_t(env, err, "8080");
+    }
+}
+
+static void run_convert_address(const struct p101_env *env, struct p101_error *err)
+{
+    struct sockaddr_storage addr;
+
+    for(long i = 0; i < BENCH_ITERATIONS; i++)
+    {
+        sink += p101_convert_address(env, err, "192.168.1.1", &addr);
+    }
+}
+
+static double now_ns(void)
+{
+    struct timespec ts;
+
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ((double)ts.tv_sec * 1e9) + (double)ts.tv_nsec;
+}
+
+int main(void)
+{
+    static const struct bench_case cases[] = {
+        {"p101_parse_int32_t",          run_parse_int32_t         },
+        {"p101_parse_uint64_t",         run_parse_uint64_t        },
+        {"p101_parse_int32_t (reject)", run_parse_int32_t_rejected},
+        {"p101_parse_in_port_t",        run_parse_in_port_t       },
+        {"p101_convert_address",        run_convert_address       },
+    };
+    struct p101_error *err;
+    struct p101_env   *env;
+
+    err = p101_error_create(false);
+    if(err == NULL)
+    {
+        return 1;
+    }
+    env = p101_env_create(err, NULL);
+    if(env == NULL)
+    {
+        p101_error_destroy(err);
+        return 1;
+    }
+
+    for(size_t c = 0; c < sizeof(cases) / sizeof(cases[0]); c++)
+    {
+        double best;
+
+        best = 0;
+        for(int r = 0; r < BENCH_REPETITIONS; r++)
+        {
+            double start;
+            double elapsed;
+
+            start = now_ns();
+            cases[c].run(env, err);
+            elapsed = now_ns() - start;
+            if(r == 0 || elapsed < best)
+            {
+                best = elapsed;
+            }
+        }
+        printf("%-13s %-28s %8.2f ns/op\n", BENCH_BUILD, cases[c].name, best / BENCH_ITERATIONS);
+    }
+
+    p101_env_destroy(env);
+    p101_error_destroy(err);
+    return 0;
+}
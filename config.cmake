@@ -15,6 +15,15 @@ set(STANDARD_FLAGS
         -Werror
 )
 
+# Release configuration: compile this library's own P101_TRACE calls and
+# wrapper fault-injection hooks out of src/ (see src/instrumentation.h). The
+# unit and fault tests rely on both, so keep this OFF for development builds;
+# bench/ measures what it saves.
+option(P101_CONVERT_RELEASE "Strip tracing and fault-injection hooks from lib_convert" OFF)
+if (P101_CONVERT_RELEASE)
+    list(APPEND STANDARD_FLAGS -DP101_CONVERT_RELEASE)
+endif ()
+
 set(DARWIN_STANDARD_FLAGS
         -D_DARWIN_C_SOURCE
 )
@@ -30,14 +39,18 @@ set(LIBRARY_TARGETS p101_convert)
 
 # Source files for the library
 set(p101_convert_SOURCES
+        src/floating.c
         src/integer.c
+        src/lpm.c
         src/networking.c
 )
 
 # Header files for installation
 set(p101_convert_HEADERS
         include/p101_convert/errors.h
+        include/p101_convert/floating.h
         include/p101_convert/integer.h
+        include/p101_convert/lpm.h
         include/p101_convert/networking.h
 )
 
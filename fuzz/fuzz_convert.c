@@ -23,12 +23,58 @@
  *      blanket AF_UNSPEC that would pass a mere "is it a legal family" test.
  *   5. If p101_convert_address() reports AF_INET/AF_INET6, the address it stored must
  *      round-trip back through inet_ntop/inet_pton to the same bytes.
+ *   6. A length-bounded parse of the raw, unterminated bytes must agree with
+ *      the NUL-terminated parse of the same text, and must reject any input
+ *      that contains a NUL byte.
+ *   7. A list parse, split on "," or on blanks, must succeed exactly when
+ *      every token, parsed on its own, succeeds and the tokens fit the output
+ *      array, and it must then yield the same values in order.
+ *   8. A prefix parse must stop exactly where strtoimax stops, and succeed
+ *      exactly when strtoimax converts something without ERANGE.
+ *   9. The batch address converter must store exactly what
+ *      p101_convert_address() stores for the same text, with the same length.
+ *  10. A compact conversion must succeed exactly for the IPv4/IPv6 literals,
+ *      and expand back into the same sockaddr p101_convert_address() built.
+ *  11. An endpoint parse of the raw, unterminated bytes must succeed exactly
+ *      when the text is a strict IPv4 address or a bracketed inet_pton IPv6
+ *      address, then ':' and a decimal port of at most 65535, and must then
+ *      store that address and port.
+ *  12. A CIDR parse must succeed exactly when the text before the first '/' is
+ *      an inet_pton address and the rest a prefix length that fits it, and
+ *      must then store that address with every bit past the prefix cleared.
+ *  13. Formatting whatever p101_convert_address() or p101_convert_endpoint()
+ *      accepted must give text that converts back to the same sockaddr, and
+ *      an address must be written as inet_ntop() writes it (bar the
+ *      deprecated ::a.b.c.d form, which RFC 5952 leaves in hex).
+ *  14. An integer a parser accepted must format as snprintf() formats it and
+ *      parse back to the same value.
+ *  15. An explicit-base parse must agree with strtoimax/strtoumax in the same
+ *      base, and an automatic one with base 0, except for the 0o and 0b
+ *      prefixes strtoimax does not know and the '-' the unsigned forms refuse.
+ *  16. A 128-bit parse must accept whatever the 64-bit parse in the same
+ *      base accepts, with the same value in the low half, and must accept
+ *      nothing else that fits in 64 bits. A hex ID must decode exactly when
+ *      every character is a hex digit, to the bytes those digits spell.
+ *  17. A size parse must agree with the plain integer parse on text without
+ *      a unit, and a narrow size parse must succeed exactly when the 64-bit
+ *      one does with a value that fits.
+ *  18. An integer the int64_t parser accepts, followed by "ns", must parse as
+ *      that many nanoseconds, and followed by "s" as that many seconds when
+ *      it fits; any accepted duration must split into a normalised timespec
+ *      that adds back up to it.
+ *  19. A double or float parse must succeed exactly when strtod()/strtof() in
+ *      the "C" locale consume the whole text without hitting the type's range
+ *      (hex floats and nan(...) payloads aside), and must then give the same
+ *      bits.
  */
 #include <arpa/inet.h>
 #include <ctype.h>
+#include <errno.h>
 #include <inttypes.h>
 #include <limits.h>
+#include <math.h>
 #include <netinet/in.h>
+#include <p101_convert/floating.h>
 #include <p101_convert/integer.h>
 #include <p101_convert/networking.h>
 #include <stddef.h>
@@ -60,7 +106,10 @@ enum
     IPV4_MAX_OCTET    = 255U,
     ASCII_ZERO        = '0',
     ASCII_NINE        = '9',
-    ASCII_DOT         = '.'
+    ASCII_DOT         = '.',
+    LIST_CAPACITY     = 8U,
+    DURATION_CAPACITY = 64U,
+    HEX_ID_CAPACITY   = 32U
 };
 
 /* The first non-blank character the parsers will see. */
@@ -152,25 +201,52 @@ static int dotted_numeric_text(const char *s)
 
 static void check_signed(const struct p101_env *env, struct p101_error *err, const char *s)
 {
-    intmax_t reference;
-    intmax_t got;
-    char    *endptr;
-    int      ref_ok;
+    intmax_t    reference;
+    intmax_t    got;
+    char       *endptr;
+    const char *prefix_end;
+    int         ref_ok;
+    int         ref_some;
 
     /* Independent reference: plain strtoimax with the same "all of it, or
      * nothing" rule the library applies. */
     errno     = 0;
     reference = strtoimax(s, &endptr, 10);
     ref_ok    = (endptr != s && *endptr == '\0' && errno == 0);
+    ref_some  = (endptr != s && errno == 0);
 
     p101_error_reset(err);
     got = p101_parse_long_long(env, err, s, 0);
 
     if(!p101_error_has_error(err))
     {
+        char text[P101_INTEGER_TEXT_SIZE];
+        char expected[P101_INTEGER_TEXT_SIZE];
+
         /* Invariant 3: a clean parse must match the reference exactly. */
         FUZZ_CHECK(ref_ok, "p101_parse_long_long accepted a string strtoimax rejects", s);
         FUZZ_CHECK(got == reference, "p101_parse_long_long disagrees with strtoimax", s);
+
+        /* Invariant 14. */
+        snprintf(expected, sizeof(expected), "%jd", got);
+        FUZZ_CHECK(p101_format_long_long(env, err, (long long)got, text, sizeof(text)) == strlen(expected), "p101_format_long_long returned the wrong length", s);
+        FUZZ_CHECK(strcmp(text, expected) == 0, "p101_format_long_long disagrees with snprintf", s);
+        FUZZ_CHECK(p101_parse_long_long(env, err, text, 0) == got && p101_error_has_no_error(err), "p101_format_long_long text does not parse back", s);
+    }
+
+    /* Invariant 8: the prefix form is strtoimax with endptr, nothing more. */
+    p101_error_reset(err);
+    got = p101_parse_long_long_prefix(env, err, s, &prefix_end, 0);
+
+    if(p101_error_has_error(err))
+    {
+        FUZZ_CHECK(!ref_some, "p101_parse_long_long_prefix rejected a prefix strtoimax converts", s);
+        FUZZ_CHECK(prefix_end == s, "p101_parse_long_long_prefix moved end on failure", s);
+    }
+    else
+    {
+        FUZZ_CHECK(ref_some, "p101_parse_long_long_prefix accepted a prefix strtoimax rejects", s);
+        FUZZ_CHECK(got == reference && prefix_end == endptr, "p101_parse_long_long_prefix disagrees with strtoimax", s);
     }
 
     /* Invariant 2, at a narrow width: a clean parse must be in range. */
@@ -218,8 +294,16 @@ static void check_unsigned(const struct p101_env *env, struct p101_error *err, c
 
     if(!p101_error_has_error(err))
     {
+        char text[P101_INTEGER_TEXT_SIZE];
+        char expected[P101_INTEGER_TEXT_SIZE];
+
         FUZZ_CHECK(!minus, "p101_parse_unsigned_long_long accepted a negative string", s);
-        (void)wide;
+
+        /* Invariant 14. */
+        snprintf(expected, sizeof(expected), "%llu", wide);
+        FUZZ_CHECK(p101_format_unsigned_long_long(env, err, wide, text, sizeof(text)) == strlen(expected), "p101_format_unsigned_long_long returned the wrong length", s);
+        FUZZ_CHECK(strcmp(text, expected) == 0, "p101_format_unsigned_long_long disagrees with snprintf", s);
+        FUZZ_CHECK(p101_parse_unsigned_long_long(env, err, text, 0) == wide && p101_error_has_no_error(err), "p101_format_unsigned_long_long text does not parse back", s);
     }
 
     p101_error_reset(err);
@@ -241,6 +325,374 @@ static void check_unsigned(const struct p101_env *env, struct p101_error *err, c
     }
 }
 
+/* True when the text after the blanks and sign starts with 0o or 0b. */
+static int has_c23_radix_prefix(const char *s)
+{
+    while(isspace((unsigned char)*s))
+    {
+        s++;
+    }
+    if(*s == '+' || *s == '-')
+    {
+        s++;
+    }
+
+    return s[0] == '0' && (s[1] == 'o' || s[1] == 'O' || s[1] == 'b' || s[1] == 'B');
+}
+
+/* Invariant 15. */
+static void check_radix(const struct p101_env *env, struct p101_error *err, const char *s)
+{
+    static const unsigned int bases[] = {0, 16, 36};
+    int                       minus;
+
+    minus = leading_sign_is_minus(s);
+    for(size_t i = 0; i < sizeof(bases) / sizeof(bases[0]); i++)
+    {
+        char     *endptr;
+        intmax_t  reference;
+        uintmax_t unsigned_reference;
+        int64_t   got;
+        uint64_t  unsigned_got;
+        int       ref_ok;
+
+        if(bases[i] == 0 && has_c23_radix_prefix(s))
+        {
+            continue;
+        }
+
+        errno     = 0;
+        reference = strtoimax(s, &endptr, (int)bases[i]);
+        ref_ok    = (endptr != s && *endptr == '\0' && errno == 0);
+
+        p101_error_reset(err);
+        got = p101_parse_int64_t_base(env, err, s, bases[i], 0);
+        FUZZ_CHECK(p101_error_has_no_error(err) == (ref_ok != 0), "p101_parse_int64_t_base and strtoimax disagree on acceptance", s);
+        FUZZ_CHECK(!ref_ok || got == reference, "p101_parse_int64_t_base disagrees with strtoimax", s);
+
+        if(minus)
+        {
+            continue;
+        }
+
+        errno              = 0;
+        unsigned_reference = strtoumax(s, &endptr, (int)bases[i]);
+        ref_ok             = (endptr != s && *endptr == '\0' && errno == 0);
+
+        p101_error_reset(err);
+        unsigned_got = p101_parse_uint64_t_base(env, err, s, bases[i], 0);
+        FUZZ_CHECK(p101_error_has_no_error(err) == (ref_ok != 0), "p101_parse_uint64_t_base and strtoumax disagree on acceptance", s);
+        FUZZ_CHECK(!ref_ok || unsigned_got == unsigned_reference, "p101_parse_uint64_t_base disagrees with strtoumax", s);
+    }
+}
+
+/* Invariant 16. */
+static void check_wide(const struct p101_env *env, struct p101_error *err, const char *s)
+{
+    static const unsigned int        bases[] = {10, 16, 0};
+    static const struct p101_uint128 zero    = {0, 0};
+    uint8_t                          id[HEX_ID_CAPACITY];
+    size_t                           length;
+
+    for(size_t i = 0; i < sizeof(bases) / sizeof(bases[0]); i++)
+    {
+        struct p101_uint128 wide;
+        uint64_t            narrow;
+        bool                wide_ok;
+        bool                narrow_ok;
+
+        p101_error_reset(err);
+        narrow    = bases[i] == 10 ? p101_parse_uint64_t(env, err, s, 0) : p101_parse_uint64_t_base(env, err, s, bases[i], 0);
+        narrow_ok = p101_error_has_no_error(err);
+
+        p101_error_reset(err);
+        wide    = bases[i] == 10 ? p101_parse_uint128(env, err, s, zero) : p101_parse_uint128_base(env, err, s, bases[i], zero);
+        wide_ok = p101_error_has_no_error(err);
+
+        FUZZ_CHECK(!narrow_ok || (wide_ok && wide.high == 0 && wide.low == narrow), "p101_parse_uint128 disagrees with the 64-bit parser", s);
+        FUZZ_CHECK(!wide_ok || wide.high != 0 || narrow_ok, "p101_parse_uint128 accepted a 64-bit value the 64-bit parser rejects", s);
+    }
+
+    length = strlen(s);
+    if(length == 0 || length % 2U != 0U || length / 2U > sizeof(id))
+    {
+        return;
+    }
+
+    p101_error_reset(err);
+    if(p101_parse_hex_id(env, err, s, id, length / 2U))
+    {
+        for(size_t i = 0; i < length; i += 2U)
+        {
+            char pair[3];
+
+            FUZZ_CHECK(isxdigit((unsigned char)s[i]) && isxdigit((unsigned char)s[i + 1U]), "p101_parse_hex_id accepted a non-hex character", s);
+            pair[0] = s[i];
+            pair[1] = s[i + 1U];
+            pair[2] = '\0';
+            FUZZ_CHECK(id[i / 2U] == (uint8_t)strtoul(pair, NULL, 16), "p101_parse_hex_id decoded the wrong byte", s);
+        }
+    }
+    else
+    {
+        bool all_hex;
+
+        all_hex = true;
+        for(size_t i = 0; i < length; i++)
+        {
+            all_hex = all_hex && isxdigit((unsigned char)s[i]);
+        }
+        FUZZ_CHECK(!all_hex, "p101_parse_hex_id rejected a string of hex digits", s);
+        for(size_t i = 0; i < length / 2U; i++)
+        {
+            FUZZ_CHECK(id[i] == 0, "p101_parse_hex_id left bytes behind on failure", s);
+        }
+    }
+}
+
+/* Invariant 17. */
+static void check_size(const struct p101_env *env, struct p101_error *err, const char *s)
+{
+    uint64_t plain;
+    uint64_t wide;
+    uint32_t narrow;
+    bool     plain_ok;
+    bool     wide_ok;
+    bool     narrow_ok;
+
+    p101_error_reset(err);
+    plain    = p101_parse_uint64_t(env, err, s, 0);
+    plain_ok = p101_error_has_no_error(err);
+
+    p101_error_reset(err);
+    wide    = p101_parse_uint64_t_size(env, err, s, 0);
+    wide_ok = p101_error_has_no_error(err);
+
+    p101_error_reset(err);
+    narrow    = p101_parse_uint32_t_size(env, err, s, 0);
+    narrow_ok = p101_error_has_no_error(err);
+
+    FUZZ_CHECK(!plain_ok || (wide_ok && wide == plain), "p101_parse_uint64_t_size disagrees with p101_parse_uint64_t", s);
+    FUZZ_CHECK(narrow_ok == (wide_ok && wide <= UINT32_MAX), "p101_parse_uint32_t_size and p101_parse_uint64_t_size disagree on acceptance", s);
+    FUZZ_CHECK(!narrow_ok || narrow == wide, "p101_parse_uint32_t_size and p101_parse_uint64_t_size disagree on the value", s);
+}
+
+/* Invariant 18. */
+static void check_duration(const struct p101_env *env, struct p101_error *err, const char *s)
+{
+    static const struct timespec zero = {0, 0};
+    char                         text[DURATION_CAPACITY];
+    int64_t                      integer;
+    int64_t                      nanoseconds;
+    struct timespec              ts;
+
+    p101_error_reset(err);
+    nanoseconds = p101_parse_duration(env, err, s, 0);
+    if(p101_error_has_no_error(err))
+    {
+        ts = p101_parse_duration_timespec(env, err, s, zero);
+        FUZZ_CHECK(p101_error_has_no_error(err), "p101_parse_duration_timespec rejected a duration p101_parse_duration accepts", s);
+        FUZZ_CHECK(ts.tv_nsec >= 0 && ts.tv_nsec < 1000000000L, "p101_parse_duration_timespec did not normalise tv_nsec", s);
+        FUZZ_CHECK((int64_t)ts.tv_sec == (nanoseconds - ts.tv_nsec) / 1000000000 && (nanoseconds - ts.tv_nsec) % 1000000000 == 0, "p101_parse_duration_timespec disagrees with p101_parse_duration", s);
+    }
+
+    p101_error_reset(err);
+    integer = p101_parse_int64_t(env, err, s, 0);
+    if(p101_error_has_error(err) || strlen(s) + sizeof("ns") > sizeof(text))
+    {
+        return;
+    }
+
+    snprintf(text, sizeof(text), "%sns", s);
+    nanoseconds = p101_parse_duration(env, err, text, 0);
+    FUZZ_CHECK(p101_error_has_no_error(err) && nanoseconds == integer, "p101_parse_duration disagrees with p101_parse_int64_t on nanoseconds", s);
+
+    snprintf(text, sizeof(text), "%ss", s);
+    nanoseconds = p101_parse_duration(env, err, text, 0);
+    if(integer > INT64_MAX / 1000000000 || integer < INT64_MIN / 1000000000)
+    {
+        FUZZ_CHECK(p101_error_is_error(err, P101_ERROR_USER, P101_CONVERT_ERROR_RANGE), "p101_parse_duration accepted seconds past the int64_t range", s);
+    }
+    else
+    {
+        FUZZ_CHECK(p101_error_has_no_error(err) && nanoseconds == integer * 1000000000, "p101_parse_duration disagrees with p101_parse_int64_t on seconds", s);
+    }
+}
+
+/* Invariant 19. */
+static void check_real(const struct p101_env *env, struct p101_error *err, const char *s)
+{
+    char  *end;
+    double value;
+    double expected;
+    float  narrow;
+    float  expected_narrow;
+    bool   whole;
+    bool   out_of_range;
+
+    whole = strpbrk(s, "xX(") == NULL;
+
+    p101_error_reset(err);
+    value        = p101_parse_double(env, err, s, 0.0);
+    errno        = 0;
+    expected     = strtod(s, &end);
+    out_of_range = errno == ERANGE && (isinf(expected) || expected == 0.0);
+    FUZZ_CHECK(p101_error_has_no_error(err) == (whole && end != s && *end == '\0' && !out_of_range), "p101_parse_double and strtod disagree on acceptance", s);
+    FUZZ_CHECK(p101_error_has_error(err) || (isnan(value) && isnan(expected)) || memcmp(&value, &expected, sizeof(value)) == 0, "p101_parse_double disagrees with strtod", s);
+
+    p101_error_reset(err);
+    narrow          = p101_parse_float(env, err, s, 0.0F);
+    errno           = 0;
+    expected_narrow = strtof(s, &end);
+    out_of_range    = errno == ERANGE && (isinf(expected_narrow) || expected_narrow == 0.0F);
+    FUZZ_CHECK(p101_error_has_no_error(err) == (whole && end != s && *end == '\0' && !out_of_range), "p101_parse_float and strtof disagree on acceptance", s);
+    FUZZ_CHECK(p101_error_has_error(err) || (isnan(narrow) && isnan(expected_narrow)) || memcmp(&narrow, &expected_narrow, sizeof(narrow)) == 0, "p101_parse_float disagrees with strtof", s);
+}
+
+static void check_bounded(const struct p101_env *env, struct p101_error *err, const char *raw, size_t size, const char *s)
+{
+    long long bounded;
+    long long terminated;
+    int       bounded_ok;
+    int       terminated_ok;
+
+    /* raw is exactly size bytes with no terminator, so ASan flags any read of
+     * raw[size]: the _n family must stop at the length it was given. */
+    p101_error_reset(err);
+    bounded    = p101_parse_long_long_n(env, err, raw, size, 0);
+    bounded_ok = !p101_error_has_error(err);
+
+    p101_error_reset(err);
+    terminated    = p101_parse_long_long(env, err, s, 0);
+    terminated_ok = !p101_error_has_error(err);
+
+    /* Invariant 6. */
+    if(memchr(raw, '\0', size) != NULL)
+    {
+        FUZZ_CHECK(!bounded_ok, "p101_parse_long_long_n accepted an embedded NUL", s);
+    }
+    else
+    {
+        FUZZ_CHECK(bounded_ok == terminated_ok, "p101_parse_long_long_n and p101_parse_long_long disagree on success", s);
+        FUZZ_CHECK(!bounded_ok || bounded == terminated, "p101_parse_long_long_n and p101_parse_long_long disagree on the value", s);
+    }
+
+    p101_error_reset(err);
+    (void)p101_parse_uint64_t_n(env, err, raw, size, 0);
+    if(!p101_error_has_error(err))
+    {
+        FUZZ_CHECK(!leading_sign_is_minus(s), "p101_parse_uint64_t_n accepted a negative string", s);
+    }
+}
+
+static void check_list(const struct p101_env *env, struct p101_error *err, const char *s, const char *delimiters)
+{
+    int64_t     listed[LIST_CAPACITY];
+    size_t      count;
+    int         list_ok;
+    int         tokens_ok;
+    size_t      tokens;
+    const char *token;
+
+    p101_error_reset(err);
+    count   = p101_parse_int64_t_list(env, err, s, delimiters, listed, LIST_CAPACITY);
+    list_ok = !p101_error_has_error(err);
+
+    tokens_ok = 1;
+    tokens    = 0;
+    token     = s;
+    for(;;)
+    {
+        size_t  length;
+        char   *copy;
+        int64_t single;
+
+        length = strcspn(token, delimiters);
+        copy   = (char *)malloc(length + 1);
+        if(copy == NULL)
+        {
+            return;
+        }
+        memcpy(copy, token, length);
+        copy[length] = '\0';
+
+        p101_error_reset(err);
+        single = p101_parse_int64_t(env, err, copy, 0);
+        if(p101_error_has_error(err) || tokens >= LIST_CAPACITY)
+        {
+            tokens_ok = 0;
+        }
+        else if(list_ok)
+        {
+            FUZZ_CHECK(listed[tokens] == single, "p101_parse_int64_t_list and p101_parse_int64_t disagree on a token", s);
+        }
+        free(copy);
+        tokens++;
+
+        if(token[length] == '\0')
+        {
+            break;
+        }
+        token += length + 1;
+    }
+
+    /* Invariant 7. */
+    FUZZ_CHECK(list_ok == tokens_ok, "p101_parse_int64_t_list and per-token parsing disagree on success", s);
+    FUZZ_CHECK(!list_ok || count == tokens, "p101_parse_int64_t_list returned the wrong count", s);
+    p101_error_reset(err);
+}
+
+/* Invariant 13: the formatters are the exact inverse of the parsers. */
+static void check_format(const struct p101_env *env, struct p101_error *err, const struct sockaddr_storage *addr, socklen_t length, bool endpoint, const char *s)
+{
+    struct sockaddr_storage again;
+    char                    text[sizeof(((struct sockaddr_un *)0)->sun_path) + 1];
+    char                    expected[INET6_ADDRSTRLEN];
+    size_t                  text_length;
+
+    p101_error_reset(err);
+    if(endpoint)
+    {
+        text_length = p101_format_endpoint(env, err, (const struct sockaddr *)addr, text, sizeof(text));
+    }
+    else
+    {
+        text_length = p101_format_address(env, err, (const struct sockaddr *)addr, text, sizeof(text));
+    }
+    FUZZ_CHECK(p101_error_has_no_error(err) && text_length != 0U, "formatting a converted address failed", s);
+    FUZZ_CHECK(strlen(text) == text_length, "formatting returned the wrong length", s);
+
+    memset(&again, 0xA5, sizeof(again));
+    if(endpoint)
+    {
+        FUZZ_CHECK(p101_convert_endpoint(env, err, text, text_length, &again) == length, "a formatted endpoint converts back to a different length", s);
+    }
+    else
+    {
+        FUZZ_CHECK(p101_convert_address(env, err, text, &again) == length, "a formatted address converts back to a different length", s);
+    }
+    FUZZ_CHECK(memcmp(&again, addr, length) == 0, "formatted text converts back to a different sockaddr", s);
+
+    if(!endpoint && addr->ss_family == AF_INET)
+    {
+        const struct sockaddr_in *sin = (const struct sockaddr_in *)(const void *)addr;
+
+        FUZZ_CHECK(inet_ntop(AF_INET, &sin->sin_addr, expected, sizeof(expected)) != NULL && strcmp(expected, text) == 0, "p101_format_address disagrees with inet_ntop for IPv4", s);
+    }
+    else if(!endpoint && addr->ss_family == AF_INET6)
+    {
+        static const uint8_t       zeroes[12] = {0};
+        const struct sockaddr_in6 *sin6       = (const struct sockaddr_in6 *)(const void *)addr;
+        const uint8_t             *bytes      = sin6->sin6_addr.s6_addr;
+
+        if(memcmp(bytes, zeroes, sizeof(zeroes)) != 0 || (bytes[12] == 0 && bytes[13] == 0))
+        {
+            FUZZ_CHECK(inet_ntop(AF_INET6, bytes, expected, sizeof(expected)) != NULL && strcmp(expected, text) == 0, "p101_format_address disagrees with inet_ntop for IPv6", s);
+        }
+    }
+    p101_error_reset(err);
+}
+
 static void check_address(const struct p101_env *env, struct p101_error *err, const char *s)
 {
     struct sockaddr_storage addr;
@@ -326,11 +778,175 @@ static void check_address(const struct p101_env *env, struct p101_error *err, co
     {
         FUZZ_CHECK(got_length == 0U, "p101_convert_address returned a length for an invalid address", s);
     }
+    if(got_length != 0U)
+    {
+        check_format(env, err, &addr, got_length, false, s);
+    }
+
+    {
+        const char *const       batch_input[] = {s};
+        struct sockaddr_storage batch;
+        socklen_t               batch_length;
+        uint8_t                 batch_status;
+        size_t                  converted;
+
+        p101_error_reset(err);
+        memset(&batch, 0xA5, sizeof(batch));
+        converted = p101_convert_address_array(env, err, batch_input, 1, &batch, &batch_length, &batch_status);
+        FUZZ_CHECK(p101_error_has_no_error(err), "p101_convert_address_array raised for a single bad element", s);
+        FUZZ_CHECK(converted == (got_length != 0U ? 1U : 0U), "p101_convert_address_array returned the wrong count", s);
+        FUZZ_CHECK(batch_length == got_length, "p101_convert_address_array returned a different length", s);
+        FUZZ_CHECK(batch.ss_family == addr.ss_family, "p101_convert_address_array chose a different address family", s);
+        FUZZ_CHECK(memcmp(&batch, &addr, got_length) == 0, "p101_convert_address_array stored different bytes", s);
+        p101_error_reset(err);
+    }
+
+    {
+        struct p101_compact_address compact;
+        struct sockaddr_storage     expanded;
+        bool                        compact_ok;
+
+        compact_ok = p101_convert_compact_address(env, err, s, &compact);
+        FUZZ_CHECK(compact_ok == (expected == AF_INET || expected == AF_INET6), "p101_convert_compact_address disagrees with the address family", s);
+        FUZZ_CHECK(compact_ok != p101_error_has_error(err), "p101_convert_compact_address error state disagrees with its result", s);
+        p101_error_reset(err);
+        if(compact_ok)
+        {
+            memset(&expanded, 0xA5, sizeof(expanded));
+            FUZZ_CHECK(p101_compact_address_to_sockaddr(env, err, &compact, &expanded) == got_length, "p101_compact_address_to_sockaddr returned the wrong length", s);
+            FUZZ_CHECK(memcmp(&expanded, &addr, got_length) == 0, "p101_compact_address_to_sockaddr built a different sockaddr", s);
+            p101_error_reset(err);
+        }
+    }
+}
+
+static void check_endpoint(const struct p101_env *env, struct p101_error *err, const char *raw, size_t size, const char *s)
+{
+    struct sockaddr_storage addr;
+    char                    host[INET6_ADDRSTRLEN + 2];
+    struct in_addr          v4;
+    struct in6_addr         v6;
+    const char             *colon;
+    size_t                  host_length;
+    unsigned long           port;
+    sa_family_t             expected;
+    socklen_t               got_length;
+
+    /* The oracle: split at the last colon, then inet_pton on the host. */
+    expected = AF_UNSPEC;
+    port     = 0;
+    colon    = strrchr(s, ':');
+    if(memchr(raw, '\0', size) == NULL && colon != NULL && colon[1] != '\0' && strspn(colon + 1, "0123456789") == strlen(colon + 1))
+    {
+        port        = strtoul(colon + 1, NULL, 10);
+        host_length = (size_t)(colon - s);
+        if(port <= 65535UL && host_length < sizeof(host))
+        {
+            memcpy(host, s, host_length);
+            host[host_length] = '\0';
+            if(host_length >= 2 && host[0] == '[' && host[host_length - 1] == ']')
+            {
+                host[host_length - 1] = '\0';
+                if(inet_pton(AF_INET6, host + 1, &v6) == 1)
+                {
+                    expected = AF_INET6;
+                }
+            }
+            else if(strict_ipv4_literal(host) && inet_pton(AF_INET, host, &v4) == 1)
+            {
+                expected = AF_INET;
+            }
+        }
+    }
+
+    memset(&addr, 0xA5, sizeof(addr));
+    p101_error_reset(err);
+    got_length = p101_convert_endpoint(env, err, raw, size, &addr);
+    FUZZ_CHECK(addr.ss_family == expected, "p101_convert_endpoint chose the wrong address family", s);
+    FUZZ_CHECK((expected == AF_UNSPEC) == p101_error_has_error(err), "p101_convert_endpoint error state disagrees with its result", s);
+    if(expected == AF_INET)
+    {
+        const struct sockaddr_in *sin = (const struct sockaddr_in *)(const void *)&addr;
+
+        FUZZ_CHECK(got_length == sizeof(*sin), "p101_convert_endpoint returned the wrong IPv4 length", s);
+        FUZZ_CHECK(memcmp(&v4, &sin->sin_addr, sizeof(v4)) == 0, "p101_convert_endpoint stored the wrong IPv4 bytes", s);
+        FUZZ_CHECK(ntohs(sin->sin_port) == port, "p101_convert_endpoint stored the wrong IPv4 port", s);
+    }
+    else if(expected == AF_INET6)
+    {
+        const struct sockaddr_in6 *sin6 = (const struct sockaddr_in6 *)(const void *)&addr;
+
+        FUZZ_CHECK(got_length == sizeof(*sin6), "p101_convert_endpoint returned the wrong IPv6 length", s);
+        FUZZ_CHECK(memcmp(&v6, &sin6->sin6_addr, sizeof(v6)) == 0, "p101_convert_endpoint stored the wrong IPv6 bytes", s);
+        FUZZ_CHECK(ntohs(sin6->sin6_port) == port, "p101_convert_endpoint stored the wrong IPv6 port", s);
+    }
+    else
+    {
+        FUZZ_CHECK(got_length == 0U, "p101_convert_endpoint returned a length for an invalid endpoint", s);
+    }
+    if(got_length != 0U)
+    {
+        check_format(env, err, &addr, got_length, true, s);
+    }
+    p101_error_reset(err);
+}
+
+static void check_cidr(const struct p101_env *env, struct p101_error *err, const char *s)
+{
+    struct p101_cidr cidr;
+    char             host[INET6_ADDRSTRLEN];
+    unsigned char    expected[16];
+    const char      *slash;
+    const char      *prefix;
+    size_t           host_length;
+    unsigned long    prefix_length;
+    unsigned long    max_length;
+    int              family;
+    bool             valid;
+    bool             parsed;
+
+    /* The oracle: inet_pton on the host, strtoul on the prefix. */
+    valid  = false;
+    family = AF_UNSPEC;
+    memset(expected, 0, sizeof(expected));
+    prefix_length = 0;
+    slash         = strchr(s, '/');
+    if(slash != NULL && (size_t)(slash - s) < sizeof(host))
+    {
+        host_length = (size_t)(slash - s);
+        memcpy(host, s, host_length);
+        host[host_length] = '\0';
+        family            = memchr(host, ':', host_length) != NULL ? AF_INET6 : AF_INET;
+        max_length        = family == AF_INET6 ? 128UL : 32UL;
+        prefix            = slash + 1;
+        if((family == AF_INET6 || strict_ipv4_literal(host)) && inet_pton(family, host, expected) == 1 && prefix[0] != '\0' && strspn(prefix, "0123456789") == strlen(prefix) && (prefix[0] != '0' || prefix[1] == '\0') && strlen(prefix) <= 3)
+        {
+            prefix_length = strtoul(prefix, NULL, 10);
+            valid         = prefix_length <= max_length;
+        }
+    }
+
+    p101_error_reset(err);
+    parsed = p101_convert_cidr(env, err, s, false, &cidr);
+    FUZZ_CHECK(parsed == valid, "p101_convert_cidr disagrees with inet_pton about the CIDR", s);
+    FUZZ_CHECK(parsed != p101_error_has_error(err), "p101_convert_cidr error state disagrees with its result", s);
+    if(parsed)
+    {
+        for(size_t bit = prefix_length; bit < (family == AF_INET6 ? 128U : 32U); bit++)
+        {
+            expected[bit / 8U] &= (unsigned char)~(0x80U >> (bit % 8U));
+        }
+        FUZZ_CHECK(cidr.prefix_length == prefix_length, "p101_convert_cidr stored the wrong prefix length", s);
+        FUZZ_CHECK(cidr.network.family == (family == AF_INET6 ? P101_COMPACT_ADDRESS_IPV6 : P101_COMPACT_ADDRESS_IPV4), "p101_convert_cidr stored the wrong family", s);
+        FUZZ_CHECK(memcmp(cidr.network.address, expected, sizeof(expected)) == 0, "p101_convert_cidr stored the wrong network", s);
+    }
+    p101_error_reset(err);
 }
 
 int LLVMFuzzerTestOneInput(const uint8_t *data, size_t size)
 {
     char              *buf;
+    char              *raw;
     struct p101_error *err;
     struct p101_env   *env;
 
@@ -348,15 +964,38 @@ int LLVMFuzzerTestOneInput(const uint8_t *data, size_t size)
     memcpy(buf, data, size);
     buf[size] = '\0';
 
+    /* The same bytes again, but with no terminator at all, for the _n family.
+     * malloc(0) may legitimately return NULL, so ask for at least one byte. */
+    raw = (char *)malloc(size == 0 ? 1 : size);
+
+    if(raw == NULL)
+    {
+        free(buf);
+        return 0;
+    }
+
+    memcpy(raw, data, size);
+
     err = p101_error_create(false);
     env = p101_env_create(err, NULL);
 
     check_signed(env, err, buf);
     check_unsigned(env, err, buf);
+    check_radix(env, err, buf);
+    check_wide(env, err, buf);
+    check_size(env, err, buf);
+    check_duration(env, err, buf);
+    check_real(env, err, buf);
+    check_bounded(env, err, raw, size, buf);
+    check_list(env, err, buf, ",");
+    check_list(env, err, buf, " \t");
     check_address(env, err, buf);
+    check_endpoint(env, err, raw, size, buf);
+    check_cidr(env, err, buf);
 
     p101_env_destroy(env);
     p101_error_destroy(err);
+    free(raw);
     free(buf);
 
     return 0;
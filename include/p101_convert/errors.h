@@ -8,4 +8,15 @@ enum p101_convert_error
     P101_CONVERT_ERROR_ADDRESS
 };
 
+// Outcome of the env-free p101_try_parse_* functions and of each element of
+// the batch parsers and converters; the failure values match the error codes
+// above.
+enum p101_convert_status
+{
+    P101_CONVERT_STATUS_OK      = 0,
+    P101_CONVERT_STATUS_SYNTAX  = P101_CONVERT_ERROR_SYNTAX,
+    P101_CONVERT_STATUS_RANGE   = P101_CONVERT_ERROR_RANGE,
+    P101_CONVERT_STATUS_ADDRESS = P101_CONVERT_ERROR_ADDRESS
+};
+
 #endif    // LIBP101_CONVERT_ERRORS_H
@@ -0,0 +1,47 @@
+#ifndef LIBP101_CONVERT_P101_FLOATING_H
+#define LIBP101_CONVERT_P101_FLOATING_H
+
+/*
+ * Copyright 2024-2024 D'Arcy Smith.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <p101_convert/errors.h>
+#include <p101_env/env.h>
+#include <p101_error/error.h>
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+    /*
+     * Decimal floating-point numbers such as "0.25", "-1e-3" or "6.02E23",
+     * rounded to the nearest double or float (ties to even), as strtod() and
+     * strtof() do in the "C" locale. The decimal point is always '.', whatever
+     * the current locale says. Leading whitespace, an optional sign, trailing
+     * characters and default_value follow the integer parsers. "inf",
+     * "infinity" and "nan" are accepted in any case; hexadecimal floats and
+     * "nan(...)" payloads are not. A finite number too large for the type, or
+     * a non-zero one that rounds to zero, is a RANGE error; subnormal results
+     * are returned as they are.
+     */
+    double p101_parse_double(const struct p101_env *env, struct p101_error *err, const char *str, double default_value);
+    float  p101_parse_float(const struct p101_env *env, struct p101_error *err, const char *str, float default_value);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
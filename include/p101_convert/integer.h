@@ -17,9 +17,13 @@
  * limitations under the License.
  */
 
+#include <p101_convert/errors.h>
 #include <p101_env/env.h>
 #include <p101_error/error.h>
+#include <stdbool.h>
+#include <stddef.h>
 #include <stdint.h>
+#include <time.h>
 
 #ifdef __cplusplus
 extern "C"
@@ -70,6 +74,287 @@ extern "C"
     int32_t            p101_parse_positive_int32_t(const struct p101_env *env, struct p101_error *err, const char *str, int32_t default_value);
     int64_t            p101_parse_positive_int64_t(const struct p101_env *env, struct p101_error *err, const char *str, int64_t default_value);
 
+    /*
+     * Length-bounded forms of the parsers above. Exactly length bytes starting
+     * at str are parsed and nothing beyond str + length is ever read, so a
+     * field can be converted in place inside a larger receive buffer without
+     * being copied out and NUL-terminated first. Syntax, range, sign and error
+     * rules are identical to the NUL-terminated forms; a NUL byte inside the
+     * length is treated like any other trailing character.
+     */
+    char               p101_parse_char_n(const struct p101_env *env, struct p101_error *err, const char *str, size_t length, char default_value);
+    short              p101_parse_short_n(const struct p101_env *env, struct p101_error *err, const char *str, size_t length, short default_value);
+    int                p101_parse_int_n(const struct p101_env *env, struct p101_error *err, const char *str, size_t length, int default_value);
+    long               p101_parse_long_n(const struct p101_env *env, struct p101_error *err, const char *str, size_t length, long default_value);
+    long long          p101_parse_long_long_n(const struct p101_env *env, struct p101_error *err, const char *str, size_t length, long long default_value);
+    unsigned char      p101_parse_unsigned_char_n(const struct p101_env *env, struct p101_error *err, const char *str, size_t length, unsigned char default_value);
+    unsigned short     p101_parse_unsigned_short_n(const struct p101_env *env, struct p101_error *err, const char *str, size_t length, unsigned short default_value);
+    unsigned int       p101_parse_unsigned_int_n(const struct p101_env *env, struct p101_error *err, const char *str, size_t length, unsigned int default_value);
+    unsigned long      p101_parse_unsigned_long_n(const struct p101_env *env, struct p101_error *err, const char *str, size_t length, unsigned long default_value);
+    unsigned long long p101_parse_unsigned_long_long_n(const struct p101_env *env, struct p101_error *err, const char *str, size_t length, unsigned long long default_value);
+    signed char        p101_parse_negative_char_n(const struct p101_env *env, struct p101_error *err, const char *str, size_t length, signed char default_value);
+    short              p101_parse_negative_short_n(const struct p101_env *env, struct p101_error *err, const char *str, size_t length, short default_value);
+    int                p101_parse_negative_int_n(const struct p101_env *env, struct p101_error *err, const char *str, size_t length, int default_value);
+    long               p101_parse_negative_long_n(const struct p101_env *env, struct p101_error *err, const char *str, size_t length, long default_value);
+    long long          p101_parse_negative_long_long_n(const struct p101_env *env, struct p101_error *err, const char *str, size_t length, long long default_value);
+    char               p101_parse_positive_char_n(const struct p101_env *env, struct p101_error *err, const char *str, size_t length, char default_value);
+    short              p101_parse_positive_short_n(const struct p101_env *env, struct p101_error *err, const char *str, size_t length, short default_value);
+    int                p101_parse_positive_int_n(const struct p101_env *env, struct p101_error *err, const char *str, size_t length, int default_value);
+    long               p101_parse_positive_long_n(const struct p101_env *env, struct p101_error *err, const char *str, size_t length, long default_value);
+    long long          p101_parse_positive_long_long_n(const struct p101_env *env, struct p101_error *err, const char *str, size_t length, long long default_value);
+    int8_t             p101_parse_int8_t_n(const struct p101_env *env, struct p101_error *err, const char *str, size_t length, int8_t default_value);
+    int16_t            p101_parse_int16_t_n(const struct p101_env *env, struct p101_error *err, const char *str, size_t length, int16_t default_value);
+    int32_t            p101_parse_int32_t_n(const struct p101_env *env, struct p101_error *err, const char *str, size_t length, int32_t default_value);
+    int64_t            p101_parse_int64_t_n(const struct p101_env *env, struct p101_error *err, const char *str, size_t length, int64_t default_value);
+    uint8_t            p101_parse_uint8_t_n(const struct p101_env *env, struct p101_error *err, const char *str, size_t length, uint8_t default_value);
+    uint16_t           p101_parse_uint16_t_n(const struct p101_env *env, struct p101_error *err, const char *str, size_t length, uint16_t default_value);
+    uint32_t           p101_parse_uint32_t_n(const struct p101_env *env, struct p101_error *err, const char *str, size_t length, uint32_t default_value);
+    uint64_t           p101_parse_uint64_t_n(const struct p101_env *env, struct p101_error *err, const char *str, size_t length, uint64_t default_value);
+    int8_t             p101_parse_negative_int8_t_n(const struct p101_env *env, struct p101_error *err, const char *str, size_t length, int8_t default_value);
+    int16_t            p101_parse_negative_int16_t_n(const struct p101_env *env, struct p101_error *err, const char *str, size_t length, int16_t default_value);
+    int32_t            p101_parse_negative_int32_t_n(const struct p101_env *env, struct p101_error *err, const char *str, size_t length, int32_t default_value);
+    int64_t            p101_parse_negative_int64_t_n(const struct p101_env *env, struct p101_error *err, const char *str, size_t length, int64_t default_value);
+    int8_t             p101_parse_positive_int8_t_n(const struct p101_env *env, struct p101_error *err, const char *str, size_t length, int8_t default_value);
+    int16_t            p101_parse_positive_int16_t_n(const struct p101_env *env, struct p101_error *err, const char *str, size_t length, int16_t default_value);
+    int32_t            p101_parse_positive_int32_t_n(const struct p101_env *env, struct p101_error *err, const char *str, size_t length, int32_t default_value);
+    int64_t            p101_parse_positive_int64_t_n(const struct p101_env *env, struct p101_error *err, const char *str, size_t length, int64_t default_value);
+
+    /*
+     * Prefix forms of the parsers above, for building tokenizers: the longest
+     * valid integer at the start of str is converted (after the usual leading
+     * whitespace and sign) and *end is set to the first byte after it, so
+     * "123ms" yields 123 with *end pointing at "ms". Nothing after the integer
+     * is examined. At least one digit is still required and the range rules
+     * are unchanged; on any failure *end is set to str, an error is raised and
+     * default_value is returned. end must not be NULL.
+     */
+    char               p101_parse_char_prefix(const struct p101_env *env, struct p101_error *err, const char *str, const char **end, char default_value);
+    short              p101_parse_short_prefix(const struct p101_env *env, struct p101_error *err, const char *str, const char **end, short default_value);
+    int                p101_parse_int_prefix(const struct p101_env *env, struct p101_error *err, const char *str, const char **end, int default_value);
+    long               p101_parse_long_prefix(const struct p101_env *env, struct p101_error *err, const char *str, const char **end, long default_value);
+    long long          p101_parse_long_long_prefix(const struct p101_env *env, struct p101_error *err, const char *str, const char **end, long long default_value);
+    unsigned char      p101_parse_unsigned_char_prefix(const struct p101_env *env, struct p101_error *err, const char *str, const char **end, unsigned char default_value);
+    unsigned short     p101_parse_unsigned_short_prefix(const struct p101_env *env, struct p101_error *err, const char *str, const char **end, unsigned short default_value);
+    unsigned int       p101_parse_unsigned_int_prefix(const struct p101_env *env, struct p101_error *err, const char *str, const char **end, unsigned int default_value);
+    unsigned long      p101_parse_unsigned_long_prefix(const struct p101_env *env, struct p101_error *err, const char *str, const char **end, unsigned long default_value);
+    unsigned long long p101_parse_unsigned_long_long_prefix(const struct p101_env *env, struct p101_error *err, const char *str, const char **end, unsigned long long default_value);
+    signed char        p101_parse_negative_char_prefix(const struct p101_env *env, struct p101_error *err, const char *str, const char **end, signed char default_value);
+    short              p101_parse_negative_short_prefix(const struct p101_env *env, struct p101_error *err, const char *str, const char **end, short default_value);
+    int                p101_parse_negative_int_prefix(const struct p101_env *env, struct p101_error *err, const char *str, const char **end, int default_value);
+    long               p101_parse_negative_long_prefix(const struct p101_env *env, struct p101_error *err, const char *str, const char **end, long default_value);
+    long long          p101_parse_negative_long_long_prefix(const struct p101_env *env, struct p101_error *err, const char *str, const char **end, long long default_value);
+    char               p101_parse_positive_char_prefix(const struct p101_env *env, struct p101_error *err, const char *str, const char **end, char default_value);
+    short              p101_parse_positive_short_prefix(const struct p101_env *env, struct p101_error *err, const char *str, const char **end, short default_value);
+    int                p101_parse_positive_int_prefix(const struct p101_env *env, struct p101_error *err, const char *str, const char **end, int default_value);
+    long               p101_parse_positive_long_prefix(const struct p101_env *env, struct p101_error *err, const char *str, const char **end, long default_value);
+    long long          p101_parse_positive_long_long_prefix(const struct p101_env *env, struct p101_error *err, const char *str, const char **end, long long default_value);
+    int8_t             p101_parse_int8_t_prefix(const struct p101_env *env, struct p101_error *err, const char *str, const char **end, int8_t default_value);
+    int16_t            p101_parse_int16_t_prefix(const struct p101_env *env, struct p101_error *err, const char *str, const char **end, int16_t default_value);
+    int32_t            p101_parse_int32_t_prefix(const struct p101_env *env, struct p101_error *err, const char *str, const char **end, int32_t default_value);
+    int64_t            p101_parse_int64_t_prefix(const struct p101_env *env, struct p101_error *err, const char *str, const char **end, int64_t default_value);
+    uint8_t            p101_parse_uint8_t_prefix(const struct p101_env *env, struct p101_error *err, const char *str, const char **end, uint8_t default_value);
+    uint16_t           p101_parse_uint16_t_prefix(const struct p101_env *env, struct p101_error *err, const char *str, const char **end, uint16_t default_value);
+    uint32_t           p101_parse_uint32_t_prefix(const struct p101_env *env, struct p101_error *err, const char *str, const char **end, uint32_t default_value);
+    uint64_t           p101_parse_uint64_t_prefix(const struct p101_env *env, struct p101_error *err, const char *str, const char **end, uint64_t default_value);
+    int8_t             p101_parse_negative_int8_t_prefix(const struct p101_env *env, struct p101_error *err, const char *str, const char **end, int8_t default_value);
+    int16_t            p101_parse_negative_int16_t_prefix(const struct p101_env *env, struct p101_error *err, const char *str, const char **end, int16_t default_value);
+    int32_t            p101_parse_negative_int32_t_prefix(const struct p101_env *env, struct p101_error *err, const char *str, const char **end, int32_t default_value);
+    int64_t            p101_parse_negative_int64_t_prefix(const struct p101_env *env, struct p101_error *err, const char *str, const char **end, int64_t default_value);
+    int8_t             p101_parse_positive_int8_t_prefix(const struct p101_env *env, struct p101_error *err, const char *str, const char **end, int8_t default_value);
+    int16_t            p101_parse_positive_int16_t_prefix(const struct p101_env *env, struct p101_error *err, const char *str, const char **end, int16_t default_value);
+    int32_t            p101_parse_positive_int32_t_prefix(const struct p101_env *env, struct p101_error *err, const char *str, const char **end, int32_t default_value);
+    int64_t            p101_parse_positive_int64_t_prefix(const struct p101_env *env, struct p101_error *err, const char *str, const char **end, int64_t default_value);
+
+    /*
+     * Explicit-radix forms of the fixed-width parsers, for flags, file modes
+     * and masks. base is 2 to 36, with letters for digits past 9 in either
+     * case, and base 16, 8 or 2 also accepts a 0x, 0o or 0b prefix (any case)
+     * after the sign. Base 0 picks the radix from the prefix: 0x is hex, 0o
+     * or a plain leading zero octal (as in strtoimax()), 0b binary and
+     * anything else decimal, so "-0x80", "0755" and "0b1010" all parse.
+     * Whitespace, sign, trailing-character, range and default_value rules are
+     * those of the base-10 parsers; any other base is a failed API check.
+     */
+    int8_t             p101_parse_int8_t_base(const struct p101_env *env, struct p101_error *err, const char *str, unsigned int base, int8_t default_value);
+    int16_t            p101_parse_int16_t_base(const struct p101_env *env, struct p101_error *err, const char *str, unsigned int base, int16_t default_value);
+    int32_t            p101_parse_int32_t_base(const struct p101_env *env, struct p101_error *err, const char *str, unsigned int base, int32_t default_value);
+    int64_t            p101_parse_int64_t_base(const struct p101_env *env, struct p101_error *err, const char *str, unsigned int base, int64_t default_value);
+    uint8_t            p101_parse_uint8_t_base(const struct p101_env *env, struct p101_error *err, const char *str, unsigned int base, uint8_t default_value);
+    uint16_t           p101_parse_uint16_t_base(const struct p101_env *env, struct p101_error *err, const char *str, unsigned int base, uint16_t default_value);
+    uint32_t           p101_parse_uint32_t_base(const struct p101_env *env, struct p101_error *err, const char *str, unsigned int base, uint32_t default_value);
+    uint64_t           p101_parse_uint64_t_base(const struct p101_env *env, struct p101_error *err, const char *str, unsigned int base, uint64_t default_value);
+
+    /*
+     * Byte counts with a unit suffix, such as "64K", "512MB" or "1.5GiB". K,
+     * M, G, T, P and E (either case) are powers of 1000 and Ki, Mi, Gi, Ti, Pi
+     * and Ei powers of 1024; either may be followed by 'B', and a bare 'B' or
+     * no suffix means bytes. The number is unsigned decimal and may have a
+     * fraction, but it must scale to a whole number of bytes. Whitespace,
+     * sign and default_value rules are the integer parsers'; an unknown
+     * suffix, a blank before it or a fractional byte count is a SYNTAX error
+     * and a total past the target type ("10G" into uint32_t) a RANGE error.
+     */
+    uint8_t            p101_parse_uint8_t_size(const struct p101_env *env, struct p101_error *err, const char *str, uint8_t default_value);
+    uint16_t           p101_parse_uint16_t_size(const struct p101_env *env, struct p101_error *err, const char *str, uint16_t default_value);
+    uint32_t           p101_parse_uint32_t_size(const struct p101_env *env, struct p101_error *err, const char *str, uint32_t default_value);
+    uint64_t           p101_parse_uint64_t_size(const struct p101_env *env, struct p101_error *err, const char *str, uint64_t default_value);
+
+    /*
+     * Durations such as "250ms", "5s" or "1h30m", in the notation of Go's
+     * time.ParseDuration(): an optional sign, then one or more decimal
+     * numbers, each with an optional fraction and a unit of ns, us (or µs),
+     * ms, s, m or h. Either side of the '.' may be empty (".5s", "1.s"), but
+     * not both. A bare "0" needs no unit. The result is in nanoseconds,
+     * with fractions of a nanosecond dropped, and must fit in int64_t (about
+     * 292 years either way; a RANGE error otherwise). Leading whitespace and
+     * default_value follow the integer parsers; blanks between parts, a
+     * missing unit or an unknown unit are SYNTAX errors. The timespec form
+     * has tv_nsec in [0, 999999999], so "-1.5s" is { -2, 500000000 }.
+     */
+    int64_t         p101_parse_duration(const struct p101_env *env, struct p101_error *err, const char *str, int64_t default_value);
+    struct timespec p101_parse_duration_timespec(const struct p101_env *env, struct p101_error *err, const char *str, struct timespec default_value);
+
+    /*
+     * An unsigned 128-bit value as two 64-bit halves, for counters and IDs
+     * too wide for uintmax_t. Where the compiler has unsigned __int128 the
+     * value is ((unsigned __int128)high << 64) | low.
+     */
+    struct p101_uint128
+    {
+        uint64_t high;
+        uint64_t low;
+    };
+
+    /*
+     * p101_parse_uint64_t() and p101_parse_uint64_t_base() for a 128-bit
+     * target: the same whitespace, sign, prefix, trailing-character, range and
+     * default_value rules, with a range error only past 2^128 - 1. A 32-digit
+     * hex value costs two calls to the sixteen-digit hex kernel.
+     */
+    struct p101_uint128 p101_parse_uint128(const struct p101_env *env, struct p101_error *err, const char *str, struct p101_uint128 default_value);
+    struct p101_uint128 p101_parse_uint128_base(const struct p101_env *env, struct p101_error *err, const char *str, unsigned int base, struct p101_uint128 default_value);
+
+    /*
+     * Decode a fixed-width hex identifier, such as a W3C trace ID (size 16)
+     * or span ID (size 8), into id[0] .. id[size - 1], most significant byte
+     * first. str must be exactly 2 * size hex digits in either case, with no
+     * blanks, sign or prefix (a SYNTAX error otherwise). Returns true on
+     * success; on failure id is set to all zeros. A null argument or a zero
+     * size is a failed API check.
+     */
+    bool p101_parse_hex_id(const struct p101_env *env, struct p101_error *err, const char *str, uint8_t *id, size_t size);
+
+    /*
+     * Batch forms: strs[0] .. strs[count - 1] are each parsed with the rules of
+     * the single-string parser of the same type, paying for the entry checks
+     * once per call rather than once per string. A bad element does not stop
+     * the batch and raises nothing: status[i] holds an enum
+     * p101_convert_status, P101_CONVERT_STATUS_OK when strs[i] was converted
+     * into out[i], and otherwise the syntax or range code the single-string
+     * parser would have raised, with out[i] left untouched so it can be
+     * pre-filled with defaults. A NULL element is a syntax error. err is only raised for the
+     * call as a whole (NULL arrays with a non-zero count). Returns the number
+     * of elements converted.
+     */
+    size_t             p101_parse_int8_t_array(const struct p101_env *env, struct p101_error *err, const char *const *strs, size_t count, int8_t *out, uint8_t *status);
+    size_t             p101_parse_int16_t_array(const struct p101_env *env, struct p101_error *err, const char *const *strs, size_t count, int16_t *out, uint8_t *status);
+    size_t             p101_parse_int32_t_array(const struct p101_env *env, struct p101_error *err, const char *const *strs, size_t count, int32_t *out, uint8_t *status);
+    size_t             p101_parse_int64_t_array(const struct p101_env *env, struct p101_error *err, const char *const *strs, size_t count, int64_t *out, uint8_t *status);
+    size_t             p101_parse_uint8_t_array(const struct p101_env *env, struct p101_error *err, const char *const *strs, size_t count, uint8_t *out, uint8_t *status);
+    size_t             p101_parse_uint16_t_array(const struct p101_env *env, struct p101_error *err, const char *const *strs, size_t count, uint16_t *out, uint8_t *status);
+    size_t             p101_parse_uint32_t_array(const struct p101_env *env, struct p101_error *err, const char *const *strs, size_t count, uint32_t *out, uint8_t *status);
+    size_t             p101_parse_uint64_t_array(const struct p101_env *env, struct p101_error *err, const char *const *strs, size_t count, uint64_t *out, uint8_t *status);
+
+    /*
+     * Parse a list of integers separated by any one of the characters in
+     * delimiters (for example "80,443,8080" with ",", or "1 2 3" with " ") into
+     * out, splitting and converting in a single scan. Every token follows the
+     * single-string rules: leading whitespace that is not a delimiter and a
+     * sign are accepted, anything else before the next delimiter is a syntax
+     * error, and so is an empty token (an empty string, a leading or trailing
+     * delimiter, or two delimiters in a row, so "1  2" with " " fails). More
+     * tokens than capacity is a range error. Returns the number of integers
+     * stored; every failure raises an error and returns 0.
+     */
+    size_t             p101_parse_int64_t_list(const struct p101_env *env, struct p101_error *err, const char *str, const char *delimiters, int64_t *out, size_t capacity);
+    size_t             p101_parse_uint64_t_list(const struct p101_env *env, struct p101_error *err, const char *str, const char *delimiters, uint64_t *out, size_t capacity);
+
+    /*
+     * Lightweight forms for hot paths where rejected input is routine: the
+     * same whole-string rules, but with no p101_env or p101_error at all, so a
+     * failure costs no more than a success. The result is a status instead of
+     * a raised error; *value is written only on P101_CONVERT_STATUS_OK, and
+     * value may be NULL to validate without converting. A NULL str is a syntax
+     * failure. The functions above remain the diagnostic layer, with messages.
+     */
+    enum p101_convert_status p101_try_parse_char(const char *str, char *value);
+    enum p101_convert_status p101_try_parse_short(const char *str, short *value);
+    enum p101_convert_status p101_try_parse_int(const char *str, int *value);
+    enum p101_convert_status p101_try_parse_long(const char *str, long *value);
+    enum p101_convert_status p101_try_parse_long_long(const char *str, long long *value);
+    enum p101_convert_status p101_try_parse_unsigned_char(const char *str, unsigned char *value);
+    enum p101_convert_status p101_try_parse_unsigned_short(const char *str, unsigned short *value);
+    enum p101_convert_status p101_try_parse_unsigned_int(const char *str, unsigned int *value);
+    enum p101_convert_status p101_try_parse_unsigned_long(const char *str, unsigned long *value);
+    enum p101_convert_status p101_try_parse_unsigned_long_long(const char *str, unsigned long long *value);
+    enum p101_convert_status p101_try_parse_negative_char(const char *str, signed char *value);
+    enum p101_convert_status p101_try_parse_negative_short(const char *str, short *value);
+    enum p101_convert_status p101_try_parse_negative_int(const char *str, int *value);
+    enum p101_convert_status p101_try_parse_negative_long(const char *str, long *value);
+    enum p101_convert_status p101_try_parse_negative_long_long(const char *str, long long *value);
+    enum p101_convert_status p101_try_parse_positive_char(const char *str, char *value);
+    enum p101_convert_status p101_try_parse_positive_short(const char *str, short *value);
+    enum p101_convert_status p101_try_parse_positive_int(const char *str, int *value);
+    enum p101_convert_status p101_try_parse_positive_long(const char *str, long *value);
+    enum p101_convert_status p101_try_parse_positive_long_long(const char *str, long long *value);
+    enum p101_convert_status p101_try_parse_int8_t(const char *str, int8_t *value);
+    enum p101_convert_status p101_try_parse_int16_t(const char *str, int16_t *value);
+    enum p101_convert_status p101_try_parse_int32_t(const char *str, int32_t *value);
+    enum p101_convert_status p101_try_parse_int64_t(const char *str, int64_t *value);
+    enum p101_convert_status p101_try_parse_uint8_t(const char *str, uint8_t *value);
+    enum p101_convert_status p101_try_parse_uint16_t(const char *str, uint16_t *value);
+    enum p101_convert_status p101_try_parse_uint32_t(const char *str, uint32_t *value);
+    enum p101_convert_status p101_try_parse_uint64_t(const char *str, uint64_t *value);
+    enum p101_convert_status p101_try_parse_negative_int8_t(const char *str, int8_t *value);
+    enum p101_convert_status p101_try_parse_negative_int16_t(const char *str, int16_t *value);
+    enum p101_convert_status p101_try_parse_negative_int32_t(const char *str, int32_t *value);
+    enum p101_convert_status p101_try_parse_negative_int64_t(const char *str, int64_t *value);
+    enum p101_convert_status p101_try_parse_positive_int8_t(const char *str, int8_t *value);
+    enum p101_convert_status p101_try_parse_positive_int16_t(const char *str, int16_t *value);
+    enum p101_convert_status p101_try_parse_positive_int32_t(const char *str, int32_t *value);
+    enum p101_convert_status p101_try_parse_positive_int64_t(const char *str, int64_t *value);
+
+/* Enough for the text of any value below, "-9223372036854775808", and its NUL. */
+#define P101_INTEGER_TEXT_SIZE 21
+
+    /*
+     * The inverse of the parsers: write value in base 10 into buffer,
+     * NUL-terminated, with a '-' for a negative value and nothing else: no
+     * '+', padding or leading zeros, so the text parses back to the same
+     * value. Nothing is allocated. Text that does not fit in size bytes is a
+     * range error, with buffer set to "" when size allows. Returns the length
+     * of the text, or zero on error.
+     */
+    size_t             p101_format_char(const struct p101_env *env, struct p101_error *err, char value, char *buffer, size_t size);
+    size_t             p101_format_short(const struct p101_env *env, struct p101_error *err, short value, char *buffer, size_t size);
+    size_t             p101_format_int(const struct p101_env *env, struct p101_error *err, int value, char *buffer, size_t size);
+    size_t             p101_format_long(const struct p101_env *env, struct p101_error *err, long value, char *buffer, size_t size);
+    size_t             p101_format_long_long(const struct p101_env *env, struct p101_error *err, long long value, char *buffer, size_t size);
+    size_t             p101_format_signed_char(const struct p101_env *env, struct p101_error *err, signed char value, char *buffer, size_t size);
+    size_t             p101_format_unsigned_char(const struct p101_env *env, struct p101_error *err, unsigned char value, char *buffer, size_t size);
+    size_t             p101_format_unsigned_short(const struct p101_env *env, struct p101_error *err, unsigned short value, char *buffer, size_t size);
+    size_t             p101_format_unsigned_int(const struct p101_env *env, struct p101_error *err, unsigned int value, char *buffer, size_t size);
+    size_t             p101_format_unsigned_long(const struct p101_env *env, struct p101_error *err, unsigned long value, char *buffer, size_t size);
+    size_t             p101_format_unsigned_long_long(const struct p101_env *env, struct p101_error *err, unsigned long long value, char *buffer, size_t size);
+    size_t             p101_format_int8_t(const struct p101_env *env, struct p101_error *err, int8_t value, char *buffer, size_t size);
+    size_t             p101_format_int16_t(const struct p101_env *env, struct p101_error *err, int16_t value, char *buffer, size_t size);
+    size_t             p101_format_int32_t(const struct p101_env *env, struct p101_error *err, int32_t value, char *buffer, size_t size);
+    size_t             p101_format_int64_t(const struct p101_env *env, struct p101_error *err, int64_t value, char *buffer, size_t size);
+    size_t             p101_format_uint8_t(const struct p101_env *env, struct p101_error *err, uint8_t value, char *buffer, size_t size);
+    size_t             p101_format_uint16_t(const struct p101_env *env, struct p101_error *err, uint16_t value, char *buffer, size_t size);
+    size_t             p101_format_uint32_t(const struct p101_env *env, struct p101_error *err, uint32_t value, char *buffer, size_t size);
+    size_t             p101_format_uint64_t(const struct p101_env *env, struct p101_error *err, uint64_t value, char *buffer, size_t size);
+
 #ifdef __cplusplus
 }
 #endif
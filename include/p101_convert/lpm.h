@@ -0,0 +1,82 @@
+#ifndef LIBP101_CONVERT_P101_LPM_H
+#define LIBP101_CONVERT_P101_LPM_H
+
+/*
+ * Copyright 2024-2024 D'Arcy Smith.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <p101_convert/errors.h>
+#include <p101_convert/networking.h>
+#include <p101_env/env.h>
+#include <p101_error/error.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <sys/socket.h>
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+    /*
+     * An immutable longest-prefix-match table over IPv4 and IPv6 CIDR blocks.
+     * It lives entirely inside memory supplied by the caller: the library
+     * never allocates, so the table is built once into a buffer of
+     * p101_lpm_size() bytes and is valid for as long as that buffer is. Any
+     * number of threads may look up in it at once.
+     */
+    struct p101_lpm;
+
+/* Returned by the lookups when no prefix in the table covers the address. */
+#define P101_LPM_NO_MATCH SIZE_MAX
+
+    /*
+     * The number of bytes p101_lpm_build() needs for prefixes[0] ..
+     * prefixes[count - 1], including scratch space used only while building.
+     * Each prefix must be a network address as p101_convert_cidr() produces
+     * one: IPv4 or IPv6, a prefix length the family allows and no bits set
+     * past it (an ADDRESS error otherwise). Returns zero on error.
+     */
+    size_t p101_lpm_size(const struct p101_env *env, struct p101_error *err, const struct p101_cidr *prefixes, size_t count);
+
+    /*
+     * Build the table for prefixes[0] .. prefixes[count - 1] into memory,
+     * which must be at least p101_lpm_size() bytes (a RANGE error otherwise)
+     * and aligned as malloc() aligns. The prefixes are copied in and may be
+     * released afterwards. Returns the table, which starts at memory, or NULL
+     * on error.
+     */
+    const struct p101_lpm *p101_lpm_build(const struct p101_env *env, struct p101_error *err, const struct p101_cidr *prefixes, size_t count, void *memory, size_t size);
+
+    /*
+     * Find the longest prefix in the table that covers the address of a
+     * sockaddr_in or sockaddr_in6; the port and scope are ignored. Returns
+     * its index in the prefixes the table was built from (the first of any
+     * duplicates), or P101_LPM_NO_MATCH. Any other family is an ADDRESS
+     * error.
+     */
+    size_t p101_lpm_lookup(const struct p101_env *env, struct p101_error *err, const struct p101_lpm *lpm, const struct sockaddr *addr);
+
+    /*
+     * p101_lpm_lookup() for an address in compact form. A compact address
+     * holding no address is an ADDRESS error.
+     */
+    size_t p101_lpm_lookup_compact(const struct p101_env *env, struct p101_error *err, const struct p101_lpm *lpm, const struct p101_compact_address *address);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
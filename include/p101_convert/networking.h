@@ -19,8 +19,12 @@
 
 #include <arpa/inet.h>
 #include <netinet/in.h>
+#include <p101_convert/errors.h>
 #include <p101_env/env.h>
 #include <p101_error/error.h>
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
 #include <sys/socket.h>
 
 #ifdef __cplusplus
@@ -28,6 +32,41 @@ extern "C"
 {
 #endif
 
+    enum p101_compact_address_family
+    {
+        P101_COMPACT_ADDRESS_NONE = 0,
+        P101_COMPACT_ADDRESS_IPV4 = 4,
+        P101_COMPACT_ADDRESS_IPV6 = 6
+    };
+
+    /*
+     * An IPv4 or IPv6 address in 24 bytes rather than the 128 of a
+     * sockaddr_storage, for tables of peers that need to stay in cache.
+     * address is in network order, with an IPv4 address in its first four
+     * bytes and the rest zero; scope_id is the IPv6 zone index (zero for
+     * IPv4); port is in network order, as in sin_port; family is one of
+     * enum p101_compact_address_family. reserved is always zero, so two
+     * compact addresses can be compared with memcmp.
+     */
+    struct p101_compact_address
+    {
+        uint8_t   address[16];
+        uint32_t  scope_id;
+        in_port_t port;
+        uint8_t   family;
+        uint8_t   reserved;
+    };
+
+    /*
+     * A CIDR block: the network address in compact form (port and scope
+     * zero) and the number of leading bits that identify it.
+     */
+    struct p101_cidr
+    {
+        struct p101_compact_address network;
+        uint8_t                     prefix_length;
+    };
+
     in_port_t p101_parse_in_port_t(const struct p101_env *env, struct p101_error *err, const char *str);
 
     /*
@@ -37,6 +76,87 @@ extern "C"
      */
     socklen_t p101_convert_address(const struct p101_env *env, struct p101_error *err, const char *address, struct sockaddr_storage *addr);
 
+    /*
+     * Batch form for loading address lists: addresses[0] .. addresses[count - 1]
+     * are each converted with the rules of p101_convert_address() into out[i],
+     * with the populated length in lengths[i]. The entry checks are paid once
+     * per call, and each element zeroes only the sockaddr of the family it
+     * holds rather than the whole sockaddr_storage; bytes of out[i] past that
+     * sockaddr are left as they were. A bad or NULL element does not stop the
+     * batch and raises nothing: status[i] is P101_CONVERT_STATUS_ADDRESS,
+     * lengths[i] is zero and out[i].ss_family is AF_UNSPEC. err is only raised
+     * for the call as a whole (NULL arrays with a non-zero count). Returns the
+     * number of elements converted.
+     */
+    size_t p101_convert_address_array(const struct p101_env *env, struct p101_error *err, const char *const *addresses, size_t count, struct sockaddr_storage *out, socklen_t *lengths, uint8_t *status);
+
+
+    /*
+     * Parse an endpoint, "a.b.c.d:port" or "[v6]:port", from the length bytes
+     * at endpoint (which need not be NUL-terminated) into a sockaddr_in or
+     * sockaddr_in6 with sin_port / sin6_port set, without copying the text.
+     * The address follows the IPv4/IPv6 literal rules of
+     * p101_convert_address(); an IPv6 address must be bracketed. The port is
+     * one or more decimal digits up to 65535: anything else is a syntax error,
+     * and a larger number a range error. Returns the populated sockaddr
+     * length, or zero on error with the storage zeroed and AF_UNSPEC.
+     */
+    socklen_t p101_convert_endpoint(const struct p101_env *env, struct p101_error *err, const char *endpoint, size_t length, struct sockaddr_storage *addr);
+
+    /*
+     * Convert an IPv4 or IPv6 literal, with the rules of
+     * p101_convert_address(), into compact form with a zero port and scope.
+     * Unix paths have no compact form and are rejected like any other
+     * non-literal. On failure *compact is zeroed (P101_COMPACT_ADDRESS_NONE).
+     */
+    bool p101_convert_compact_address(const struct p101_env *env, struct p101_error *err, const char *address, struct p101_compact_address *compact);
+
+    /*
+     * Expand a compact address into the sockaddr_in or sockaddr_in6 that
+     * connect() or bind() expects, carrying the port and scope across. Only
+     * that sockaddr is written, not the whole storage. Returns its length, or
+     * zero with an error raised when compact holds no address.
+     */
+    socklen_t p101_compact_address_to_sockaddr(const struct p101_env *env, struct p101_error *err, const struct p101_compact_address *compact, struct sockaddr_storage *addr);
+
+    /*
+     * Parse a CIDR block such as "10.0.0.0/8" or "2001:db8::/32". This is
+     * separate from p101_convert_address() because a '/' there marks a Unix
+     * path. The network follows the IPv4/IPv6 literal rules of
+     * p101_convert_address() (an ADDRESS error otherwise) and the prefix
+     * length is decimal without a sign or leading zeros (SYNTAX), at most 32
+     * or 128 (RANGE). Bits set past the prefix length ("10.1.2.3/8") are an
+     * ADDRESS error when strict is true and are cleared otherwise, so
+     * out->network is always the network address. On failure *out is zeroed.
+     */
+    bool p101_convert_cidr(const struct p101_env *env, struct p101_error *err, const char *cidr, bool strict, struct p101_cidr *out);
+
+/*
+ * Enough for the text of any IPv4 or IPv6 endpoint, "[v6]:port", and its NUL.
+ * A Unix path needs up to sizeof(sun_path) + 1.
+ */
+#define P101_ENDPOINT_TEXT_SIZE (INET6_ADDRSTRLEN + 8)
+
+    /*
+     * The inverse of p101_convert_address(): write the text of a sockaddr_in,
+     * sockaddr_in6 or sockaddr_un into buffer, NUL-terminated, without
+     * allocating. IPv6 is written in the canonical form of RFC 5952 (lower
+     * case, longest zero run as "::"), with a dotted-quad tail only for an
+     * IPv4-mapped address; the scope is not written. A Unix address is its
+     * path; an unnamed or abstract one (sun_path starting with NUL) and any
+     * other family are ADDRESS errors, and text that does not fit in size
+     * bytes a RANGE error, with buffer set to "" when size allows.
+     * Returns the length of the text, or zero on error.
+     */
+    size_t p101_format_address(const struct p101_env *env, struct p101_error *err, const struct sockaddr *addr, char *buffer, size_t size);
+
+    /*
+     * p101_format_address() with the port, in the forms
+     * p101_convert_endpoint() parses: "a.b.c.d:port" or "[v6]:port". A Unix
+     * address has no port and is written as its path.
+     */
+    size_t p101_format_endpoint(const struct p101_env *env, struct p101_error *err, const struct sockaddr *addr, char *buffer, size_t size);
+
 #ifdef __cplusplus
 }
 #endif
@@ -0,0 +1,41 @@
+#ifndef LIBP101_CONVERT_INSTRUMENTATION_H
+#define LIBP101_CONVERT_INSTRUMENTATION_H
+
+/*
+ * Copyright 2024-2024 D'Arcy Smith.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <p101_env/env.h>
+#include <p101_env/wrapper.h>
+
+// Private to src/. A release build (the P101_CONVERT_RELEASE option in
+// config.cmake) compiles this library's own call tracing and wrapper fault
+// injection out of every function, leaving only the conversion itself. The
+// env argument is still evaluated so nothing becomes unused. The unit and
+// fault tests depend on both hooks, so the test tree never defines this.
+// Calls into other p101 libraries (p101_strlen(), p101_inet_pton(), ...)
+// keep whatever instrumentation those libraries were built with.
+#ifdef P101_CONVERT_RELEASE
+    #undef P101_TRACE
+    #undef P101_TRACE_EXIT
+    #undef P101_WRAPPER_FAULT_RETURN
+    #undef P101_WRAPPER_DONE
+    #define P101_TRACE(env) ((void)(env))
+    #define P101_TRACE_EXIT(env) ((void)(env))
+    #define P101_WRAPPER_FAULT_RETURN(env, err, ret, dflt) ((void)(env))
+    #define P101_WRAPPER_DONE(env) ((void)(env))
+#endif
+
+#endif    // LIBP101_CONVERT_INSTRUMENTATION_H
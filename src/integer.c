@@ -14,18 +14,134 @@
  * limitations under the License.
  */
 
+#include "instrumentation.h"
 #include "p101_convert/errors.h"
-#include <errno.h>
 #include <limits.h>
-#include <p101_c/p101_ctype.h>
-#include <p101_c/p101_inttypes.h>
+#include <p101_c/p101_string.h>
 #include <p101_convert/integer.h>
 #include <p101_env/wrapper.h>
 
-static intmax_t  parse_integer(const struct p101_env *env, struct p101_error *err, const char *str, intmax_t default_value, intmax_t min_value, intmax_t max_value);
-static uintmax_t parse_unsigned_integer(const struct p101_env *env, struct p101_error *err, const char *str, uintmax_t default_value, uintmax_t max_value);
+#if defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__))
+    #include <immintrin.h>
+    #define P101_CONVERT_SSE41_DIGITS
+#endif
+
+enum integer_scan_status
+{
+    INTEGER_SCAN_OK,
+    INTEGER_SCAN_NO_DIGITS,
+    INTEGER_SCAN_TRAILING_CHARACTERS,
+    INTEGER_SCAN_OUT_OF_RANGE,
+    INTEGER_SCAN_NEGATIVE_UNSIGNED
+};
+
+static bool                     is_ascii_space(char c);
+static bool                     has_trailing_characters(const char *cursor, const char *end);
+static bool                     load_eight_digits(const char *chunk, uint64_t *value);
+#ifdef P101_CONVERT_SSE41_DIGITS
+static bool                     have_sse41_digits(void);
+static size_t                   load_sixteen_digits(const char *chunk, uint64_t *value);
+#endif
+static enum integer_scan_status scan_decimal_digits(const char **cursor, const char *end, uintmax_t limit, uintmax_t *magnitude);
+static enum integer_scan_status scan_integer_prefix(const char **cursor, const char *end, intmax_t *value);
+static enum integer_scan_status scan_integer(const char *str, const char *end, intmax_t *value);
+static enum integer_scan_status scan_unsigned_integer_prefix(const char **cursor, const char *end, uintmax_t *value);
+static enum integer_scan_status scan_unsigned_integer(const char *str, const char *end, uintmax_t *value);
+static bool                     load_eight_hex_digits(const char *chunk, uint64_t *value);
+static bool                     load_sixteen_hex_digits(const char *chunk, uint64_t *value);
+#ifdef P101_CONVERT_SSE41_DIGITS
+static bool                     load_sixteen_hex_digits_sse41(const char *chunk, uint64_t *value);
+#endif
+static unsigned int             radix_digit_value(char c);
+static unsigned int             scan_radix_prefix(const char **cursor, const char *end, unsigned int base);
+static enum integer_scan_status scan_radix_digits(const char **cursor, const char *end, unsigned int base, uintmax_t limit, uintmax_t *magnitude);
+static enum integer_scan_status scan_radix_integer(const char *str, const char *end, unsigned int base, bool is_signed, bool *negative, uintmax_t *magnitude);
+static bool                     multiply_add_wide(struct p101_uint128 *value, uint64_t multiplier, uint64_t addend);
+static enum integer_scan_status scan_wide_digits(const char **cursor, const char *end, unsigned int base, struct p101_uint128 *magnitude);
+static enum integer_scan_status scan_wide_integer(const char *str, const char *end, unsigned int base, struct p101_uint128 *magnitude);
+static bool                     scan_size_unit(const char *text, unsigned int *power, bool *binary);
+static bool                     scale_size_fraction(uint64_t fraction, unsigned int fraction_digits, unsigned int power, bool binary, uint64_t *bytes);
+static uint64_t                 scan_duration_unit(const char **cursor);
+static uint64_t                 fraction_of_unit(const char *digits, const char *end, uint64_t unit);
+static void                     raise_scan_error(struct p101_error *err, enum integer_scan_status status);
+static enum p101_convert_status scan_error_code(enum integer_scan_status status);
+static enum p101_convert_status check_integer(const char *str, const char *end, intmax_t min_value, intmax_t max_value, intmax_t *value);
+static enum p101_convert_status check_unsigned_integer(const char *str, const char *end, uintmax_t max_value, uintmax_t *value);
+static intmax_t                 parse_integer(const struct p101_env *env, struct p101_error *err, const char *str, intmax_t default_value, intmax_t min_value, intmax_t max_value);
+static uintmax_t                parse_unsigned_integer(const struct p101_env *env, struct p101_error *err, const char *str, uintmax_t default_value, uintmax_t max_value);
+static intmax_t                 parse_integer_n(const struct p101_env *env, struct p101_error *err, const char *str, size_t length, intmax_t default_value, intmax_t min_value, intmax_t max_value);
+static uintmax_t                parse_unsigned_integer_n(const struct p101_env *env, struct p101_error *err, const char *str, size_t length, uintmax_t default_value, uintmax_t max_value);
+static intmax_t                 parse_integer_prefix(const struct p101_env *env, struct p101_error *err, const char *str, const char **end, intmax_t default_value, intmax_t min_value, intmax_t max_value);
+static uintmax_t                parse_unsigned_integer_prefix(const struct p101_env *env, struct p101_error *err, const char *str, const char **end, uintmax_t default_value, uintmax_t max_value);
+static intmax_t                 parse_integer_base(const struct p101_env *env, struct p101_error *err, const char *str, unsigned int base, intmax_t default_value, intmax_t min_value, intmax_t max_value);
+static uintmax_t                parse_unsigned_integer_base(const struct p101_env *env, struct p101_error *err, const char *str, unsigned int base, uintmax_t default_value, uintmax_t max_value);
+static struct p101_uint128      parse_wide_integer(const struct p101_env *env, struct p101_error *err, const char *str, unsigned int base, struct p101_uint128 default_value);
+static bool                     parse_hex_id(const struct p101_env *env, struct p101_error *err, const char *str, uint8_t *id, size_t size);
+static uint64_t                 parse_size(const struct p101_env *env, struct p101_error *err, const char *str, uint64_t default_value, uint64_t max_value);
+static bool                     parse_duration(const struct p101_env *env, struct p101_error *err, const char *str, int64_t *nanoseconds);
+static struct timespec          parse_duration_timespec(const struct p101_env *env, struct p101_error *err, const char *str, struct timespec default_value);
+static enum p101_convert_status parse_integer_element(const struct p101_env *env, const char *str, intmax_t min_value, intmax_t max_value, intmax_t *value);
+static enum p101_convert_status parse_unsigned_integer_element(const struct p101_env *env, const char *str, uintmax_t max_value, uintmax_t *value);
+static bool                     is_list_delimiter(char c, const char *delimiters);
+static size_t                   parse_integer_list(const struct p101_env *env, struct p101_error *err, const char *str, const char *delimiters, int64_t *out, size_t capacity, intmax_t min_value, intmax_t max_value);
+static size_t                   parse_unsigned_integer_list(const struct p101_env *env, struct p101_error *err, const char *str, const char *delimiters, uint64_t *out, size_t capacity, uintmax_t max_value);
+static size_t                   decimal_digit_count(uint64_t value);
+static void                     write_decimal_digits(uint64_t value, char *end);
+static size_t                   format_decimal(const struct p101_env *env, struct p101_error *err, bool negative, uint64_t magnitude, char *buffer, size_t size);
+static size_t                   format_integer(const struct p101_env *env, struct p101_error *err, intmax_t value, char *buffer, size_t size);
+static size_t                   format_unsigned_integer(const struct p101_env *env, struct p101_error *err, uintmax_t value, char *buffer, size_t size);
 
 #define BASE_TEN 10    // NOLINT(cppcoreguidelines-macro-to-enum,modernize-macro-to-enum)
+#define UNCHECKED_DECIMAL_DIGITS 18U    // NOLINT(cppcoreguidelines-macro-to-enum,modernize-macro-to-enum)
+#define SWAR_DIGITS 8U    // NOLINT(cppcoreguidelines-macro-to-enum,modernize-macro-to-enum)
+#define SWAR_SCALE UINT64_C(100000000)
+#define SWAR_ASCII_ZEROS UINT64_C(0x3030303030303030)
+#define SWAR_HIGH_NIBBLES UINT64_C(0xF0F0F0F0F0F0F0F0)
+#define SWAR_DIGIT_CARRY UINT64_C(0x0606060606060606)
+#define SWAR_LOW_BYTE_LANES UINT64_C(0x000000FF000000FF)
+#define SWAR_PAIR_WEIGHTS UINT64_C(0x000F424000000064)
+#define SWAR_QUAD_WEIGHTS UINT64_C(0x0000271000000001)
+#define SIMD_DIGITS 16U    // NOLINT(cppcoreguidelines-macro-to-enum,modernize-macro-to-enum)
+#define RADIX_MIN 2U    // NOLINT(cppcoreguidelines-macro-to-enum,modernize-macro-to-enum)
+#define RADIX_MAX 36U    // NOLINT(cppcoreguidelines-macro-to-enum,modernize-macro-to-enum)
+#define RADIX_AUTO 0U    // NOLINT(cppcoreguidelines-macro-to-enum,modernize-macro-to-enum)
+#define RADIX_BINARY 2U    // NOLINT(cppcoreguidelines-macro-to-enum,modernize-macro-to-enum)
+#define RADIX_OCTAL 8U    // NOLINT(cppcoreguidelines-macro-to-enum,modernize-macro-to-enum)
+#define RADIX_HEX 16U    // NOLINT(cppcoreguidelines-macro-to-enum,modernize-macro-to-enum)
+#define HEX_DIGIT_BITS 4U    // NOLINT(cppcoreguidelines-macro-to-enum,modernize-macro-to-enum)
+#define ASCII_LOWER_CASE 0x20U    // NOLINT(cppcoreguidelines-macro-to-enum,modernize-macro-to-enum)
+#define SWAR_LOWER_CASE UINT64_C(0x2020202020202020)
+#define SWAR_HIGH_BITS UINT64_C(0x8080808080808080)
+#define SWAR_LOW_NIBBLES UINT64_C(0x0F0F0F0F0F0F0F0F)
+#define SWAR_LOW_BITS UINT64_C(0x0101010101010101)
+#define SWAR_FROM_ZERO UINT64_C(0x5050505050505050)
+#define SWAR_PAST_NINE UINT64_C(0x4646464646464646)
+#define SWAR_FROM_LOWER_A UINT64_C(0x1F1F1F1F1F1F1F1F)
+#define SWAR_PAST_LOWER_F UINT64_C(0x1919191919191919)
+#define SWAR_LETTER_BIT 6U    // NOLINT(cppcoreguidelines-macro-to-enum,modernize-macro-to-enum)
+#define SWAR_HEX_LETTER_OFFSET 9U    // NOLINT(cppcoreguidelines-macro-to-enum,modernize-macro-to-enum)
+#define SWAR_BYTE_PAIRS UINT64_C(0x00FF00FF00FF00FF)
+#define SWAR_WORD_PAIRS UINT64_C(0x0000FFFF0000FFFF)
+#define SWAR_LOW_HALF UINT64_C(0x00000000FFFFFFFF)
+#define SIZE_SI_STEP 1000U    // NOLINT(cppcoreguidelines-macro-to-enum,modernize-macro-to-enum)
+#define SIZE_IEC_BITS 10U    // NOLINT(cppcoreguidelines-macro-to-enum,modernize-macro-to-enum)
+#define SIZE_SI_DIGITS 3U    // NOLINT(cppcoreguidelines-macro-to-enum,modernize-macro-to-enum)
+#define SIZE_FRACTION_DIGITS 19U    // NOLINT(cppcoreguidelines-macro-to-enum,modernize-macro-to-enum)
+#define NANOSECONDS_PER_MICROSECOND UINT64_C(1000)
+#define NANOSECONDS_PER_MILLISECOND UINT64_C(1000000)
+#define NANOSECONDS_PER_SECOND UINT64_C(1000000000)
+#define NANOSECONDS_PER_MINUTE UINT64_C(60000000000)
+#define NANOSECONDS_PER_HOUR UINT64_C(3600000000000)
+#define UTF8_MICRO_SIGN_LEAD 0xC2U    // NOLINT(cppcoreguidelines-macro-to-enum,modernize-macro-to-enum)
+#define UTF8_MICRO_SIGN_TRAIL 0xB5U    // NOLINT(cppcoreguidelines-macro-to-enum,modernize-macro-to-enum)
+#define UTF8_GREEK_MU_LEAD 0xCEU    // NOLINT(cppcoreguidelines-macro-to-enum,modernize-macro-to-enum)
+#define UTF8_GREEK_MU_TRAIL 0xBCU    // NOLINT(cppcoreguidelines-macro-to-enum,modernize-macro-to-enum)
+#define HALF_WORD_BITS 32U    // NOLINT(cppcoreguidelines-macro-to-enum,modernize-macro-to-enum)
+#define UINT64_DECIMAL_DIGITS 20U    // NOLINT(cppcoreguidelines-macro-to-enum,modernize-macro-to-enum)
+#define UINT64_BITS 64U    // NOLINT(cppcoreguidelines-macro-to-enum,modernize-macro-to-enum)
+#define LOG10_2_SCALED 1233U    // NOLINT(cppcoreguidelines-macro-to-enum,modernize-macro-to-enum)
+#define LOG10_2_SHIFT 12U    // NOLINT(cppcoreguidelines-macro-to-enum,modernize-macro-to-enum)
+#define DIGIT_PAIR_LIMIT 100U    // NOLINT(cppcoreguidelines-macro-to-enum,modernize-macro-to-enum)
 #define P101_PARSE_PROLOGUE_ARG3(env_arg, return_type, default_arg)                                                                                                                                                                                                \
     return_type parsed_result;                                                                                                                                                                                                                                     \
     P101_TRACE(env_arg);                                                                                                                                                                                                                                           \
@@ -35,455 +151,3441 @@ static uintmax_t parse_unsigned_integer(const struct p101_env *env, struct p101_
     P101_WRAPPER_DONE(env_arg);                                                                                                                                                                                                                                    \
     return parsed_result
 
-static intmax_t parse_integer(const struct p101_env *env, struct p101_error *err, const char *str, intmax_t default_value, intmax_t min_value, intmax_t max_value)
+// Single-pass replacements for strtoimax()/strtoumax(). end bounds the text
+// for the _n family and is never dereferenced, which is what lets a field be
+// parsed in place inside a larger, unterminated buffer; a NULL end means the
+// text is NUL-terminated. The rules are strtoimax()'s in the "C" locale:
+// leading whitespace, then an optional sign, then at least one digit. Every
+// digit is consumed even after the value has overflowed, so an over-wide
+// literal reports a range error rather than a syntax error, as strtoimax()'s
+// ERANGE always has. Overflow is caught before each multiply-add by comparing
+// against limit / 10 and limit % 10, so no wider arithmetic is needed.
+static bool is_ascii_space(char c)
 {
-    char    *endptr;
-    bool     has_error;
-    bool     is_range_error;
-    intmax_t parsed_value;
-    intmax_t ret_val;
+    return c == ' ' || (c >= '\t' && c <= '\r');
+}
 
-    P101_TRACE(env);
-    ret_val = default_value;
-    if(str == NULL)
+static bool has_trailing_characters(const char *cursor, const char *end)
+{
+    if(end == NULL)
     {
-        P101_ERROR_RAISE_CHECK(err);
-        goto done;
+        return *cursor != '\0';
     }
-    has_error = p101_error_has_error(err);
-    if(has_error)
+
+    return cursor != end;
+}
+
+// SWAR ("SIMD within a register") kernel: eight ASCII digits are read as one
+// 64-bit word, validated with two masks, and folded into their value with
+// three multiplies instead of a chain of eight dependent multiply-adds. The
+// word is assembled byte by byte so the first character always lands in the
+// low byte whatever the host byte order; compilers turn that into a single
+// load. Callers must guarantee all eight bytes are inside the text: this is
+// never used to peek past a NUL or past end, which would be an out-of-bounds
+// read (and a sanitizer failure) however unlikely it is to fault.
+static bool load_eight_digits(const char *chunk, uint64_t *value)
+{
+    const unsigned char *bytes;
+    uint64_t             word;
+
+    bytes = (const unsigned char *)chunk;
+    word  = (uint64_t)bytes[0] | ((uint64_t)bytes[1] << 8U) | ((uint64_t)bytes[2] << 16U) | ((uint64_t)bytes[3] << 24U) | ((uint64_t)bytes[4] << 32U) | ((uint64_t)bytes[5] << 40U) | ((uint64_t)bytes[6] << 48U) | ((uint64_t)bytes[7] << 56U);
+
+    // A byte is a digit when its high nibble is 3 and adding 6 leaves it 3.
+    // Adding 6 can only carry out of a byte whose high nibble is F, and that
+    // byte has already failed the first test.
+    if((((word & SWAR_HIGH_NIBBLES) ^ SWAR_ASCII_ZEROS) | (((word + SWAR_DIGIT_CARRY) & SWAR_HIGH_NIBBLES) ^ SWAR_ASCII_ZEROS)) != 0U)
     {
-        goto done;
+        return false;
     }
 
-    parsed_value = p101_strtoimax(env, err, str, &endptr, BASE_TEN);
+    word -= SWAR_ASCII_ZEROS;
+    word = (word * BASE_TEN) + (word >> CHAR_BIT);
+    word = (((word & SWAR_LOW_BYTE_LANES) * SWAR_PAIR_WEIGHTS) + (((word >> (2U * CHAR_BIT)) & SWAR_LOW_BYTE_LANES) * SWAR_QUAD_WEIGHTS)) >> (4U * CHAR_BIT);
 
-    has_error = p101_error_has_error(err);
-    if(has_error)
+    *value = word;
+    return true;
+}
+
+#ifdef P101_CONVERT_SSE41_DIGITS
+// SSE4.1 kernel: one unaligned 16-byte load is classified with two compares,
+// the first non-digit is found from the movemask, and the leading digits are
+// shuffled to the right of the register so that the same three horizontal
+// multiply-add steps (digit pairs, then quads, then eights) work for any
+// count. The library is built for the baseline ISA, so the kernel is compiled
+// with a per-function target attribute and only called after
+// have_sse41_digits() has said the host supports it; the CPU is probed once
+// by the compiler runtime's load-time constructor, so the check is a single
+// flag test. The same in-bounds rule as load_eight_digits() applies: all
+// sixteen bytes must be inside the text.
+static bool have_sse41_digits(void)
+{
+    #ifdef __SSE4_1__
+    return true;
+    #else
+    return __builtin_cpu_supports("sse4.1") != 0;
+    #endif
+}
+
+// Loading at offset count yields the pshufb control that moves the first
+// count lanes to the top of the register and zeroes the rest.
+static const unsigned char right_align_digits[2U * SIMD_DIGITS] = {0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15};
+
+__attribute__((target("sse4.1"))) static size_t load_sixteen_digits(const char *chunk, uint64_t *value)
+{
+    __m128i      lanes;
+    __m128i      invalid;
+    __m128i      pairs;
+    __m128i      quads;
+    __m128i      eights;
+    unsigned int mask;
+    size_t       count;
+
+    lanes   = _mm_sub_epi8(_mm_loadu_si128((const __m128i *)(const void *)chunk), _mm_set1_epi8('0'));
+    invalid = _mm_or_si128(_mm_cmplt_epi8(lanes, _mm_setzero_si128()), _mm_cmpgt_epi8(lanes, _mm_set1_epi8(9)));
+
+    // The extra bit stops the count at sixteen when every lane is a digit.
+    mask  = (unsigned int)_mm_movemask_epi8(invalid) | (1U << SIMD_DIGITS);
+    count = (size_t)__builtin_ctz(mask);
+
+    lanes  = _mm_shuffle_epi8(lanes, _mm_loadu_si128((const __m128i *)(const void *)&right_align_digits[count]));
+    pairs  = _mm_maddubs_epi16(lanes, _mm_setr_epi8(10, 1, 10, 1, 10, 1, 10, 1, 10, 1, 10, 1, 10, 1, 10, 1));
+    quads  = _mm_madd_epi16(pairs, _mm_setr_epi16(100, 1, 100, 1, 100, 1, 100, 1));
+    quads  = _mm_packus_epi32(quads, quads);
+    eights = _mm_madd_epi16(quads, _mm_setr_epi16(10000, 1, 10000, 1, 10000, 1, 10000, 1));
+
+    *value = ((uint64_t)(uint32_t)_mm_cvtsi128_si32(eights) * SWAR_SCALE) + (uint64_t)(uint32_t)_mm_extract_epi32(eights, 1);
+    return count;
+}
+#endif
+
+static enum integer_scan_status scan_decimal_digits(const char **cursor, const char *end, uintmax_t limit, uintmax_t *magnitude)
+{
+    const char              *digits;
+    size_t                   unchecked;
+    uintmax_t                cutoff;
+    uintmax_t                value;
+    unsigned int             cutoff_digit;
+    unsigned int             digit;
+    enum integer_scan_status status;
+
+    digits = *cursor;
+    value  = 0;
+    status = INTEGER_SCAN_OK;
+
+    // No run of UNCHECKED_DECIMAL_DIGITS digits can reach any limit, so the
+    // common short literal never pays for the overflow test at all.
+    unchecked = UNCHECKED_DECIMAL_DIGITS;
+    if(end != NULL && (size_t)(end - digits) < unchecked)
+    {
+        unchecked = (size_t)(end - digits);
+    }
+
+    // Only a bounded scan knows that eight more bytes exist; a NUL-terminated
+    // one could be looking at the last byte of the allocation.
+    if(end != NULL)
     {
-        is_range_error = p101_error_is_errno(err, ERANGE);
-        if(is_range_error)
+        uint64_t chunk;
+
+#ifdef P101_CONVERT_SSE41_DIGITS
+        if(unchecked >= SIMD_DIGITS && have_sse41_digits())
         {
-            p101_error_reset(err);
-            P101_ERROR_RAISE_USER(err, "The integer is outside the supported range.", P101_CONVERT_ERROR_RANGE);
+            size_t count;
+
+            count = load_sixteen_digits(digits, &chunk);
+            value = chunk;
+            digits += count;
+            unchecked -= count;
+            if(count < SIMD_DIGITS)
+            {
+                goto digits_done;
+            }
+        }
+#endif
+
+        while(unchecked >= SWAR_DIGITS && load_eight_digits(digits, &chunk))
+        {
+            value = (value * SWAR_SCALE) + chunk;
+            digits += SWAR_DIGITS;
+            unchecked -= SWAR_DIGITS;
         }
-        goto done;
     }
 
-    if(endptr == str)
+    while(unchecked > 0U)
     {
-        P101_ERROR_RAISE_USER(err, "The string does not contain an integer.", P101_CONVERT_ERROR_SYNTAX);
-        goto done;
+        digit = (unsigned int)(unsigned char)*digits - (unsigned int)'0';
+        if(digit > 9U)
+        {
+            goto digits_done;
+        }
+        value = (value * BASE_TEN) + digit;
+        digits++;
+        unchecked--;
     }
-    if(*endptr != '\0')
+
+    cutoff       = limit / BASE_TEN;
+    cutoff_digit = (unsigned int)(limit % BASE_TEN);
+    while(digits != end)
     {
-        P101_ERROR_RAISE_USER(err, "Unexpected characters follow the integer.", P101_CONVERT_ERROR_SYNTAX);
-        goto done;
+        digit = (unsigned int)(unsigned char)*digits - (unsigned int)'0';
+        if(digit > 9U)
+        {
+            break;
+        }
+        if(value > cutoff || (value == cutoff && digit > cutoff_digit))
+        {
+            status = INTEGER_SCAN_OUT_OF_RANGE;
+        }
+        else
+        {
+            value = (value * BASE_TEN) + digit;
+        }
+        digits++;
     }
-    if(parsed_value < min_value || parsed_value > max_value)
+
+digits_done:
+    if(digits == *cursor)
     {
-        P101_ERROR_RAISE_USER(err, "The integer is outside the target type's range.", P101_CONVERT_ERROR_RANGE);
-        goto done;
+        status = INTEGER_SCAN_NO_DIGITS;
     }
 
-    ret_val = parsed_value;
+    *cursor    = digits;
+    *magnitude = value;
+    return status;
+}
 
-done:
-    P101_TRACE_EXIT(env);
-    return ret_val;
+// The _prefix scanners stop at the first character that cannot continue the
+// integer and leave *cursor there; the whole-string scanners then insist
+// that nothing follows.
+static enum integer_scan_status scan_integer_prefix(const char **cursor, const char *end, intmax_t *value)
+{
+    const char              *text;
+    uintmax_t                limit;
+    uintmax_t                magnitude;
+    bool                     negative;
+    enum integer_scan_status status;
+
+    text = *cursor;
+    while(text != end && is_ascii_space(*text))
+    {
+        text++;
+    }
+
+    negative = false;
+    if(text != end && (*text == '+' || *text == '-'))
+    {
+        negative = *text == '-';
+        text++;
+    }
+
+    limit   = negative ? (uintmax_t)INTMAX_MAX + 1U : (uintmax_t)INTMAX_MAX;
+    status  = scan_decimal_digits(&text, end, limit, &magnitude);
+    *cursor = text;
+    if(status != INTEGER_SCAN_OK)
+    {
+        return status;
+    }
+
+    // Negate in the unsigned domain first: -(INTMAX_MIN) does not fit.
+    if(negative && magnitude != 0U)
+    {
+        *value = -(intmax_t)(magnitude - 1U) - 1;
+    }
+    else
+    {
+        *value = (intmax_t)magnitude;
+    }
+
+    return INTEGER_SCAN_OK;
 }
 
-static uintmax_t parse_unsigned_integer(const struct p101_env *env, struct p101_error *err, const char *str, uintmax_t default_value, uintmax_t max_value)
+static enum integer_scan_status scan_integer(const char *str, const char *end, intmax_t *value)
 {
-    char       *endptr;
-    const char *cursor;
-    bool        has_error;
-    bool        is_range_error;
-    int         is_space;
-    uintmax_t   parsed_value;
-    uintmax_t   ret_val;
+    const char              *cursor;
+    enum integer_scan_status status;
 
-    P101_TRACE(env);
-    ret_val = default_value;
-    if(str == NULL)
+    cursor = str;
+    status = scan_integer_prefix(&cursor, end, value);
+    if(status != INTEGER_SCAN_OK)
     {
-        P101_ERROR_RAISE_CHECK(err);
-        goto done;
+        return status;
     }
-    has_error = p101_error_has_error(err);
-    if(has_error)
+
+    if(has_trailing_characters(cursor, end))
     {
-        goto done;
+        return INTEGER_SCAN_TRAILING_CHARACTERS;
+    }
+
+    return INTEGER_SCAN_OK;
+}
+
+static enum integer_scan_status scan_unsigned_integer_prefix(const char **cursor, const char *end, uintmax_t *value)
+{
+    const char              *text;
+    enum integer_scan_status status;
+
+    text = *cursor;
+    while(text != end && is_ascii_space(*text))
+    {
+        text++;
+    }
+
+    // A leading '-' is refused outright, including "-0".
+    if(text != end && *text == '-')
+    {
+        *cursor = text;
+        return INTEGER_SCAN_NEGATIVE_UNSIGNED;
     }
 
-    // strtoumax() accepts a leading '-' and returns the value WRAPPED around
-    // (so "-1" comes back as UINTMAX_MAX) without setting errno. The range
-    // check further down cannot catch that for the widest types, because the
-    // wrapped value is already inside the type's range -- "-1" would silently
-    // become 18446744073709551615. Refuse the sign here instead. Whitespace is
-    // skipped the same way strtoumax() itself skips it, so " -1" is caught too.
+    if(text != end && *text == '+')
+    {
+        text++;
+    }
+
+    status  = scan_decimal_digits(&text, end, UINTMAX_MAX, value);
+    *cursor = text;
+
+    return status;
+}
+
+static enum integer_scan_status scan_unsigned_integer(const char *str, const char *end, uintmax_t *value)
+{
+    const char              *cursor;
+    enum integer_scan_status status;
+
     cursor = str;
+    status = scan_unsigned_integer_prefix(&cursor, end, value);
+    if(status != INTEGER_SCAN_OK)
+    {
+        return status;
+    }
 
-    is_space = p101_isspace(env, (unsigned char)*cursor);
-    while(is_space != 0)
+    if(has_trailing_characters(cursor, end))
     {
-        cursor++;
-        is_space = p101_isspace(env, (unsigned char)*cursor);
+        return INTEGER_SCAN_TRAILING_CHARACTERS;
     }
 
-    if(*cursor == '-')
+    return INTEGER_SCAN_OK;
+}
+
+// SWAR kernel for eight hex digits, in the style of load_eight_digits(). Each
+// byte is tested against a range by adding its distance to 0x80, which sets
+// the byte's high bit exactly when it is at or past the bound and cannot carry
+// into the next byte because no ASCII byte reaches 0x80. Digits are tested as
+// they are and letters with bit 5 forced on, which folds 'A'-'F' onto 'a'-'f'
+// (folding the digits as well would let control bytes pass as digits). A
+// letter has bit 6 set, so its value is its low nibble plus 9. The nibbles
+// are folded pairwise, with the first character ending up most significant.
+static bool load_eight_hex_digits(const char *chunk, uint64_t *value)
+{
+    const unsigned char *bytes;
+    uint64_t             word;
+    uint64_t             lower;
+    uint64_t             valid;
+
+    bytes = (const unsigned char *)chunk;
+    word  = (uint64_t)bytes[0] | ((uint64_t)bytes[1] << 8U) | ((uint64_t)bytes[2] << 16U) | ((uint64_t)bytes[3] << 24U) | ((uint64_t)bytes[4] << 32U) | ((uint64_t)bytes[5] << 40U) | ((uint64_t)bytes[6] << 48U) | ((uint64_t)bytes[7] << 56U);
+    if((word & SWAR_HIGH_BITS) != 0U)
     {
-        P101_ERROR_RAISE_USER(err, "A negative integer cannot be converted to an unsigned type.", P101_CONVERT_ERROR_RANGE);
-        goto done;
+        return false;
+    }
+
+    lower = word | SWAR_LOWER_CASE;
+    valid = ((word + SWAR_FROM_ZERO) & ~(word + SWAR_PAST_NINE)) | ((lower + SWAR_FROM_LOWER_A) & ~(lower + SWAR_PAST_LOWER_F));
+    if((valid & SWAR_HIGH_BITS) != SWAR_HIGH_BITS)
+    {
+        return false;
     }
 
-    parsed_value = p101_strtoumax(env, err, str, &endptr, BASE_TEN);
+    word = (lower & SWAR_LOW_NIBBLES) + (((lower >> SWAR_LETTER_BIT) & SWAR_LOW_BITS) * SWAR_HEX_LETTER_OFFSET);
+    word = ((word & SWAR_BYTE_PAIRS) << HEX_DIGIT_BITS) | ((word >> CHAR_BIT) & SWAR_BYTE_PAIRS);
+    word = ((word & SWAR_WORD_PAIRS) << CHAR_BIT) | ((word >> (2U * CHAR_BIT)) & SWAR_WORD_PAIRS);
+    word = ((word & SWAR_LOW_HALF) << (2U * CHAR_BIT)) | (word >> (4U * CHAR_BIT));
 
-    has_error = p101_error_has_error(err);
-    if(has_error)
+    *value = word;
+    return true;
+}
+
+#ifdef P101_CONVERT_SSE41_DIGITS
+// SSE4.1 kernel for a full 64-bit hex value such as a trace or span ID: the
+// sixteen bytes are classified with four compares, turned into nibbles with
+// one blend, paired into bytes by a single multiply-add and packed, which
+// leaves the value in big-endian order in the low half of the register. The
+// in-bounds and dispatch rules of load_sixteen_digits() apply.
+__attribute__((target("sse4.1"))) static bool load_sixteen_hex_digits_sse41(const char *chunk, uint64_t *value)
+{
+    __m128i  lanes;
+    __m128i  lower;
+    __m128i  digits;
+    __m128i  letters;
+    __m128i  nibbles;
+    __m128i  pairs;
+    uint64_t word;
+
+    lanes   = _mm_loadu_si128((const __m128i *)(const void *)chunk);
+    lower   = _mm_or_si128(lanes, _mm_set1_epi8((char)ASCII_LOWER_CASE));
+    digits  = _mm_and_si128(_mm_cmpgt_epi8(lanes, _mm_set1_epi8('0' - 1)), _mm_cmplt_epi8(lanes, _mm_set1_epi8('9' + 1)));
+    letters = _mm_and_si128(_mm_cmpgt_epi8(lower, _mm_set1_epi8('a' - 1)), _mm_cmplt_epi8(lower, _mm_set1_epi8('f' + 1)));
+    if(_mm_movemask_epi8(_mm_or_si128(digits, letters)) != (int)UINT16_MAX)
+    {
+        return false;
+    }
+
+    nibbles = _mm_blendv_epi8(_mm_sub_epi8(lower, _mm_set1_epi8('a' - BASE_TEN)), _mm_sub_epi8(lanes, _mm_set1_epi8('0')), digits);
+    pairs   = _mm_maddubs_epi16(nibbles, _mm_setr_epi8(16, 1, 16, 1, 16, 1, 16, 1, 16, 1, 16, 1, 16, 1, 16, 1));
+    _mm_storel_epi64((__m128i *)(void *)&word, _mm_packus_epi16(pairs, pairs));
+
+    *value = __builtin_bswap64(word);
+    return true;
+}
+#endif
+
+static bool load_sixteen_hex_digits(const char *chunk, uint64_t *value)
+{
+    uint64_t high;
+    uint64_t low;
+
+#ifdef P101_CONVERT_SSE41_DIGITS
+    if(have_sse41_digits())
+    {
+        return load_sixteen_hex_digits_sse41(chunk, value);
+    }
+#endif
+
+    if(!load_eight_hex_digits(chunk, &high) || !load_eight_hex_digits(chunk + SWAR_DIGITS, &low))
+    {
+        return false;
+    }
+
+    *value = (high << (SWAR_DIGITS * HEX_DIGIT_BITS)) | low;
+    return true;
+}
+
+// 0-9, then a-z or A-Z for 10-35; anything else is past every radix.
+static unsigned int radix_digit_value(char c)
+{
+    unsigned int digit;
+
+    digit = (unsigned int)(unsigned char)c - (unsigned int)'0';
+    if(digit < BASE_TEN)
+    {
+        return digit;
+    }
+
+    digit = ((unsigned int)(unsigned char)c | ASCII_LOWER_CASE) - (unsigned int)'a';
+    if(digit < RADIX_MAX - BASE_TEN)
+    {
+        return digit + BASE_TEN;
+    }
+
+    return RADIX_MAX;
+}
+
+// The radix prefix rules of strtoimax() with base 0 or 16, extended with the
+// 0o and 0b prefixes: base 0 reads "0x"/"0X" as hex, "0o"/"0O" as octal,
+// "0b"/"0B" as binary, any other leading zero as octal and anything else as
+// decimal, and base 16, 8 or 2 accepts its own prefix. The prefix is only
+// consumed here; at least one digit must still follow it.
+static unsigned int scan_radix_prefix(const char **cursor, const char *end, unsigned int base)
+{
+    const char  *text;
+    unsigned int marker;
+
+    text = *cursor;
+    if(text == end || *text != '0' || (end != NULL && end - text < 2))
+    {
+        return base == RADIX_AUTO ? BASE_TEN : base;
+    }
+
+    marker = (unsigned int)(unsigned char)text[1] | ASCII_LOWER_CASE;
+    if((base == RADIX_AUTO || base == RADIX_HEX) && marker == 'x')
+    {
+        *cursor = text + 2;
+        return RADIX_HEX;
+    }
+    if((base == RADIX_AUTO || base == RADIX_OCTAL) && marker == 'o')
+    {
+        *cursor = text + 2;
+        return RADIX_OCTAL;
+    }
+    if((base == RADIX_AUTO || base == RADIX_BINARY) && marker == 'b')
+    {
+        *cursor = text + 2;
+        return RADIX_BINARY;
+    }
+
+    return base == RADIX_AUTO ? RADIX_OCTAL : base;
+}
+
+// scan_decimal_digits() for any radix. Sixteen hex digits cannot overflow a
+// 64-bit magnitude, so a bounded scan takes them in one step when they are
+// all there; everything else goes through the checked loop, which keeps
+// consuming digits after an overflow so that it is reported as a range error.
+static enum integer_scan_status scan_radix_digits(const char **cursor, const char *end, unsigned int base, uintmax_t limit, uintmax_t *magnitude)
+{
+    const char              *digits;
+    uintmax_t                cutoff;
+    uintmax_t                value;
+    unsigned int             cutoff_digit;
+    unsigned int             digit;
+    enum integer_scan_status status;
+
+    digits = *cursor;
+    value  = 0;
+    status = INTEGER_SCAN_OK;
+
+    if(base == RADIX_HEX && end != NULL && (size_t)(end - digits) >= SIMD_DIGITS)
+    {
+        uint64_t chunk;
+
+        if(load_sixteen_hex_digits(digits, &chunk))
+        {
+            value = chunk;
+            digits += SIMD_DIGITS;
+            if(value > limit)
+            {
+                status = INTEGER_SCAN_OUT_OF_RANGE;
+            }
+        }
+    }
+
+    cutoff       = limit / base;
+    cutoff_digit = (unsigned int)(limit % base);
+    while(digits != end)
     {
-        is_range_error = p101_error_is_errno(err, ERANGE);
-        if(is_range_error)
+        digit = radix_digit_value(*digits);
+        if(digit >= base)
         {
-            p101_error_reset(err);
-            P101_ERROR_RAISE_USER(err, "The integer is outside the supported range.", P101_CONVERT_ERROR_RANGE);
+            break;
         }
-        goto done;
+        if(status == INTEGER_SCAN_OK)
+        {
+            if(value > cutoff || (value == cutoff && digit > cutoff_digit))
+            {
+                status = INTEGER_SCAN_OUT_OF_RANGE;
+            }
+            else
+            {
+                value = (value * base) + digit;
+            }
+        }
+        digits++;
     }
 
-    if(endptr == str)
+    if(digits == *cursor)
     {
-        P101_ERROR_RAISE_USER(err, "The string does not contain an integer.", P101_CONVERT_ERROR_SYNTAX);
-        goto done;
+        status = INTEGER_SCAN_NO_DIGITS;
     }
-    if(*endptr != '\0')
+
+    *cursor    = digits;
+    *magnitude = value;
+    return status;
+}
+
+// Whole-string scan for the _base parsers: whitespace, a sign (a '-' is
+// refused outright for an unsigned target, as in
+// scan_unsigned_integer_prefix()), the radix prefix, then digits to the end.
+static enum integer_scan_status scan_radix_integer(const char *str, const char *end, unsigned int base, bool is_signed, bool *negative, uintmax_t *magnitude)
+{
+    const char              *text;
+    uintmax_t                limit;
+    enum integer_scan_status status;
+
+    text = str;
+    while(text != end && is_ascii_space(*text))
     {
-        P101_ERROR_RAISE_USER(err, "Unexpected characters follow the integer.", P101_CONVERT_ERROR_SYNTAX);
-        goto done;
+        text++;
     }
-    if(parsed_value > max_value)
+
+    *negative = false;
+    if(text != end && (*text == '+' || *text == '-'))
     {
-        P101_ERROR_RAISE_USER(err, "The integer is outside the target type's range.", P101_CONVERT_ERROR_RANGE);
-        goto done;
+        if(*text == '-' && !is_signed)
+        {
+            return INTEGER_SCAN_NEGATIVE_UNSIGNED;
+        }
+        *negative = *text == '-';
+        text++;
     }
 
-    ret_val = parsed_value;
+    limit = UINTMAX_MAX;
+    if(is_signed)
+    {
+        limit = *negative ? (uintmax_t)INTMAX_MAX + 1U : (uintmax_t)INTMAX_MAX;
+    }
 
-done:
-    P101_TRACE_EXIT(env);
-    return ret_val;
+    base   = scan_radix_prefix(&text, end, base);
+    status = scan_radix_digits(&text, end, base, limit, magnitude);
+    if(status != INTEGER_SCAN_OK)
+    {
+        return status;
+    }
+
+    if(has_trailing_characters(text, end))
+    {
+        return INTEGER_SCAN_TRAILING_CHARACTERS;
+    }
+
+    return INTEGER_SCAN_OK;
 }
 
-#define DEFINE_SIGNED_PARSE_CONVERTER(function_name, result_type)                                                                                                                                                                                                  \
-    static result_type function_name(const struct p101_env *env, struct p101_error *err, const char *str, result_type default_value, intmax_t min_value, intmax_t max_value)                                                                                       \
-    {                                                                                                                                                                                                                                                              \
-        intmax_t    parsed_wide_result;                                                                                                                                                                                                                            \
-        result_type parsed_result;                                                                                                                                                                                                                                 \
-        parsed_wide_result = parse_integer(env, err, str, default_value, min_value, max_value);                                                                                                                                                                    \
-        parsed_result      = (result_type)parsed_wide_result;                                                                                                                                                                                                      \
-        return parsed_result;                                                                                                                                                                                                                                      \
+// value = value * multiplier + addend on two 64-bit halves, false on
+// overflow. multiplier is a radix or SWAR_SCALE, so it fits in 32 bits and
+// each half of the low word can be multiplied without losing anything; ISO C
+// has no 128-bit type to do it in one step.
+static bool multiply_add_wide(struct p101_uint128 *value, uint64_t multiplier, uint64_t addend)
+{
+    uint64_t lower;
+    uint64_t upper;
+    uint64_t low;
+    uint64_t carry;
+
+    if(value->high > UINT64_MAX / multiplier)
+    {
+        return false;
     }
 
-#define DEFINE_SIGNED_PARSE_SAME_CONVERTER(function_name, result_type)                                                                                                                                                                                             \
-    static result_type function_name(const struct p101_env *env, struct p101_error *err, const char *str, result_type default_value, intmax_t min_value, intmax_t max_value)                                                                                       \
-    {                                                                                                                                                                                                                                                              \
-        result_type parsed_result;                                                                                                                                                                                                                                 \
-        parsed_result = parse_integer(env, err, str, default_value, min_value, max_value);                                                                                                                                                                         \
-        return parsed_result;                                                                                                                                                                                                                                      \
+    lower = (value->low & SWAR_LOW_HALF) * multiplier;
+    upper = (value->low >> HALF_WORD_BITS) * multiplier;
+    low   = lower + (upper << HALF_WORD_BITS);
+    carry = (upper >> HALF_WORD_BITS) + (low < lower ? 1U : 0U);
+    low += addend;
+    carry += low < addend ? 1U : 0U;
+    if(value->high * multiplier > UINT64_MAX - carry)
+    {
+        return false;
     }
 
-#define DEFINE_UNSIGNED_PARSE_CONVERTER(function_name, result_type)                                                                                                                                                                                                \
-    static result_type function_name(const struct p101_env *env, struct p101_error *err, const char *str, result_type default_value, uintmax_t max_value)                                                                                                          \
-    {                                                                                                                                                                                                                                                              \
-        uintmax_t   parsed_wide_result;                                                                                                                                                                                                                            \
-        result_type parsed_result;                                                                                                                                                                                                                                 \
-        parsed_wide_result = parse_unsigned_integer(env, err, str, default_value, max_value);                                                                                                                                                                      \
-        parsed_result      = (result_type)parsed_wide_result;                                                                                                                                                                                                      \
-        return parsed_result;                                                                                                                                                                                                                                      \
+    value->high = (value->high * multiplier) + carry;
+    value->low  = low;
+    return true;
+}
+
+// scan_radix_digits() into 128 bits. The text is always bounded here, so hex
+// goes through the sixteen-digit kernel a whole 64-bit half at a time (two
+// calls for a W3C trace ID) and decimal eight digits per multiply-add through
+// load_eight_digits(); whatever is left, and every other radix, takes the
+// digit loop.
+static enum integer_scan_status scan_wide_digits(const char **cursor, const char *end, unsigned int base, struct p101_uint128 *magnitude)
+{
+    const char              *digits;
+    struct p101_uint128      value;
+    uint64_t                 chunk;
+    unsigned int             digit;
+    enum integer_scan_status status;
+
+    digits     = *cursor;
+    value.high = 0;
+    value.low  = 0;
+    status     = INTEGER_SCAN_OK;
+
+    if(base == RADIX_HEX)
+    {
+        while((size_t)(end - digits) >= SIMD_DIGITS && load_sixteen_hex_digits(digits, &chunk))
+        {
+            if(value.high != 0U)
+            {
+                status = INTEGER_SCAN_OUT_OF_RANGE;
+            }
+            value.high = value.low;
+            value.low  = chunk;
+            digits += SIMD_DIGITS;
+        }
+    }
+    else if(base == BASE_TEN)
+    {
+        while((size_t)(end - digits) >= SWAR_DIGITS && load_eight_digits(digits, &chunk))
+        {
+            if(status == INTEGER_SCAN_OK && !multiply_add_wide(&value, SWAR_SCALE, chunk))
+            {
+                status = INTEGER_SCAN_OUT_OF_RANGE;
+            }
+            digits += SWAR_DIGITS;
+        }
     }
 
-#define DEFINE_UNSIGNED_PARSE_SAME_CONVERTER(function_name, result_type)                                                                                                                                                                                           \
-    static result_type function_name(const struct p101_env *env, struct p101_error *err, const char *str, result_type default_value, uintmax_t max_value)                                                                                                          \
-    {                                                                                                                                                                                                                                                              \
-        result_type parsed_result;                                                                                                                                                                                                                                 \
-        parsed_result = parse_unsigned_integer(env, err, str, default_value, max_value);                                                                                                                                                                           \
-        return parsed_result;                                                                                                                                                                                                                                      \
+    while(digits != end)
+    {
+        digit = radix_digit_value(*digits);
+        if(digit >= base)
+        {
+            break;
+        }
+        if(status == INTEGER_SCAN_OK && !multiply_add_wide(&value, base, digit))
+        {
+            status = INTEGER_SCAN_OUT_OF_RANGE;
+        }
+        digits++;
     }
 
-DEFINE_SIGNED_PARSE_CONVERTER(convert_char, char)
-DEFINE_SIGNED_PARSE_CONVERTER(convert_short, short)
-DEFINE_SIGNED_PARSE_CONVERTER(convert_int, int)
-DEFINE_SIGNED_PARSE_SAME_CONVERTER(convert_long, long)
-DEFINE_SIGNED_PARSE_CONVERTER(convert_long_long, long long)
-DEFINE_SIGNED_PARSE_CONVERTER(convert_signed_char, signed char)
-DEFINE_SIGNED_PARSE_CONVERTER(convert_int8, int8_t)
-DEFINE_SIGNED_PARSE_CONVERTER(convert_int16, int16_t)
-DEFINE_SIGNED_PARSE_CONVERTER(convert_int32, int32_t)
-DEFINE_SIGNED_PARSE_SAME_CONVERTER(convert_int64, int64_t)
-DEFINE_UNSIGNED_PARSE_CONVERTER(convert_unsigned_char, unsigned char)
-DEFINE_UNSIGNED_PARSE_CONVERTER(convert_unsigned_short, unsigned short)
-DEFINE_UNSIGNED_PARSE_CONVERTER(convert_unsigned_int, unsigned int)
-DEFINE_UNSIGNED_PARSE_SAME_CONVERTER(convert_unsigned_long, unsigned long)
-DEFINE_UNSIGNED_PARSE_CONVERTER(convert_unsigned_long_long, unsigned long long)
+    if(digits == *cursor)
+    {
+        status = INTEGER_SCAN_NO_DIGITS;
+    }
+
+    *cursor    = digits;
+    *magnitude = value;
+    return status;
+}
+
+// scan_radix_integer() for the unsigned 128-bit target.
+static enum integer_scan_status scan_wide_integer(const char *str, const char *end, unsigned int base, struct p101_uint128 *magnitude)
+{
+    const char              *text;
+    enum integer_scan_status status;
+
+    text = str;
+    while(text != end && is_ascii_space(*text))
+    {
+        text++;
+    }
+
+    if(text != end && (*text == '+' || *text == '-'))
+    {
+        if(*text == '-')
+        {
+            return INTEGER_SCAN_NEGATIVE_UNSIGNED;
+        }
+        text++;
+    }
+
+    base   = scan_radix_prefix(&text, end, base);
+    status = scan_wide_digits(&text, end, base, magnitude);
+    if(status != INTEGER_SCAN_OK)
+    {
+        return status;
+    }
+
+    if(has_trailing_characters(text, end))
+    {
+        return INTEGER_SCAN_TRAILING_CHARACTERS;
+    }
+
+    return INTEGER_SCAN_OK;
+}
+
+// Unit suffixes for the _size parsers. K, M, G, T, P and E, in either case,
+// scale by a power of 1000 and the same letter followed by 'i' by a power of
+// 1024; either may end in 'B', and a bare 'B' or no suffix at all is bytes. E
+// is the last prefix a 64-bit count can reach. power is the exponent.
+static const char size_prefixes[] = "KMGTPE";
+
+static bool scan_size_unit(const char *text, unsigned int *power, bool *binary)
+{
+    *power  = 0;
+    *binary = false;
+    if(*text != '\0' && *text != 'B')
+    {
+        unsigned int letter;
+
+        letter = (unsigned int)(unsigned char)*text & ~ASCII_LOWER_CASE;
+        while(size_prefixes[*power] != '\0' && (unsigned char)size_prefixes[*power] != letter)
+        {
+            (*power)++;
+        }
+        if(size_prefixes[*power] == '\0')
+        {
+            return false;
+        }
+        (*power)++;
+        text++;
+        if(*text == 'i')
+        {
+            *binary = true;
+            text++;
+        }
+    }
+    if(*text == 'B')
+    {
+        text++;
+    }
+
+    return *text == '\0';
+}
+
+// The bytes in fraction / 10^fraction_digits of the unit, when that is a
+// whole number. fraction has no trailing zeros, so with a power of 1000 it is
+// whole exactly when there are no more digits than the unit has zeros; with a
+// power of 1024 the fraction must first divide by 5^fraction_digits, and what
+// is left is shifted by the difference between the unit's and the divisor's
+// powers of two. Everything stays below the unit itself, so nothing can
+// overflow.
+static bool scale_size_fraction(uint64_t fraction, unsigned int fraction_digits, unsigned int power, bool binary, uint64_t *bytes)
+{
+    uint64_t     divisor;
+    unsigned int bits;
+
+    if(!binary)
+    {
+        if(fraction_digits > power * SIZE_SI_DIGITS)
+        {
+            return false;
+        }
+        for(unsigned int digit = fraction_digits; digit < power * SIZE_SI_DIGITS; digit++)
+        {
+            fraction *= BASE_TEN;
+        }
+        *bytes = fraction;
+        return true;
+    }
+
+    divisor = 1;
+    for(unsigned int digit = 0; digit < fraction_digits; digit++)
+    {
+        divisor *= BASE_TEN / 2U;
+    }
+    if(fraction % divisor != 0U)
+    {
+        return false;
+    }
+    fraction /= divisor;
+
+    bits = power * SIZE_IEC_BITS;
+    if(fraction_digits > bits)
+    {
+        if((fraction & ((UINT64_C(1) << (fraction_digits - bits)) - 1U)) != 0U)
+        {
+            return false;
+        }
+        *bytes = fraction >> (fraction_digits - bits);
+        return true;
+    }
+
+    *bytes = fraction << (bits - fraction_digits);
+    return true;
+}
+
+// Duration units, as Go's time.ParseDuration() spells them: ns, us (or µs,
+// written with either the micro sign or the Greek mu), ms, s, m and h. Returns
+// the unit in nanoseconds and moves the cursor past it, or returns zero.
+static uint64_t scan_duration_unit(const char **cursor)
+{
+    const unsigned char *text;
+    uint64_t             unit;
+    size_t               length;
+
+    text   = (const unsigned char *)*cursor;
+    unit   = 0;
+    length = 0;
+    switch(text[0])
+    {
+        case 'n':
+            if(text[1] == 's')
+            {
+                unit   = 1;
+                length = 2;
+            }
+            break;
+        case 'u':
+            if(text[1] == 's')
+            {
+                unit   = NANOSECONDS_PER_MICROSECOND;
+                length = 2;
+            }
+            break;
+        case UTF8_MICRO_SIGN_LEAD:
+        case UTF8_GREEK_MU_LEAD:
+            if(((text[0] == UTF8_MICRO_SIGN_LEAD && text[1] == UTF8_MICRO_SIGN_TRAIL) || (text[0] == UTF8_GREEK_MU_LEAD && text[1] == UTF8_GREEK_MU_TRAIL)) && text[2] == 's')
+            {
+                unit   = NANOSECONDS_PER_MICROSECOND;
+                length = 3;
+            }
+            break;
+        case 'm':
+            unit   = text[1] == 's' ? NANOSECONDS_PER_MILLISECOND : NANOSECONDS_PER_MINUTE;
+            length = text[1] == 's' ? 2 : 1;
+            break;
+        case 's':
+            unit   = NANOSECONDS_PER_SECOND;
+            length = 1;
+            break;
+        case 'h':
+            unit   = NANOSECONDS_PER_HOUR;
+            length = 1;
+            break;
+        default:
+            break;
+    }
+
+    *cursor += length;
+    return unit;
+}
+
+// The whole nanoseconds in 0.<digits> of a unit, rounded down. Working from
+// the last digit back, floor((digit * unit + carried) / 10) loses nothing,
+// because flooring the carried part first never changes the outcome, and every
+// intermediate value stays below ten units. Any number of digits is exact.
+static uint64_t fraction_of_unit(const char *digits, const char *end, uint64_t unit)
+{
+    uint64_t nanoseconds;
+
+    nanoseconds = 0;
+    while(end != digits)
+    {
+        end--;
+        nanoseconds = (((uint64_t)(unsigned char)(*end - '0') * unit) + nanoseconds) / BASE_TEN;
+    }
+
+    return nanoseconds;
+}
+
+static void raise_scan_error(struct p101_error *err, enum integer_scan_status status)
+{
+    switch(status)
+    {
+        case INTEGER_SCAN_NO_DIGITS:
+        {
+            P101_ERROR_RAISE_USER(err, "The string does not contain an integer.", P101_CONVERT_ERROR_SYNTAX);
+            break;
+        }
+        case INTEGER_SCAN_TRAILING_CHARACTERS:
+        {
+            P101_ERROR_RAISE_USER(err, "Unexpected characters follow the integer.", P101_CONVERT_ERROR_SYNTAX);
+            break;
+        }
+        case INTEGER_SCAN_OUT_OF_RANGE:
+        {
+            P101_ERROR_RAISE_USER(err, "The integer is outside the supported range.", P101_CONVERT_ERROR_RANGE);
+            break;
+        }
+        case INTEGER_SCAN_NEGATIVE_UNSIGNED:
+        {
+            P101_ERROR_RAISE_USER(err, "A negative integer cannot be converted to an unsigned type.", P101_CONVERT_ERROR_RANGE);
+            break;
+        }
+        case INTEGER_SCAN_OK:
+        default:
+        {
+            break;
+        }
+    }
+}
+
+static enum p101_convert_status scan_error_code(enum integer_scan_status status)
+{
+    switch(status)
+    {
+        case INTEGER_SCAN_NO_DIGITS:
+        case INTEGER_SCAN_TRAILING_CHARACTERS:
+        {
+            return P101_CONVERT_STATUS_SYNTAX;
+        }
+        case INTEGER_SCAN_OUT_OF_RANGE:
+        case INTEGER_SCAN_NEGATIVE_UNSIGNED:
+        {
+            return P101_CONVERT_STATUS_RANGE;
+        }
+        case INTEGER_SCAN_OK:
+        default:
+        {
+            return P101_CONVERT_STATUS_OK;
+        }
+    }
+}
+
+// The whole-string rules of parse_integer() and parse_unsigned_integer()
+// without any p101_error or p101_env traffic: the outcome is only a status, so
+// a rejected string costs no more than an accepted one. The p101_try_parse_*
+// family is exactly this, and the batch elements add the length measurement.
+static enum p101_convert_status check_integer(const char *str, const char *end, intmax_t min_value, intmax_t max_value, intmax_t *value)
+{
+    enum integer_scan_status status;
+
+    status = scan_integer(str, end, value);
+    if(status != INTEGER_SCAN_OK)
+    {
+        return scan_error_code(status);
+    }
+    if(*value < min_value || *value > max_value)
+    {
+        return P101_CONVERT_STATUS_RANGE;
+    }
+
+    return P101_CONVERT_STATUS_OK;
+}
+
+static enum p101_convert_status check_unsigned_integer(const char *str, const char *end, uintmax_t max_value, uintmax_t *value)
+{
+    enum integer_scan_status status;
+
+    status = scan_unsigned_integer(str, end, value);
+    if(status != INTEGER_SCAN_OK)
+    {
+        return scan_error_code(status);
+    }
+    if(*value > max_value)
+    {
+        return P101_CONVERT_STATUS_RANGE;
+    }
+
+    return P101_CONVERT_STATUS_OK;
+}
+
+static intmax_t parse_integer(const struct p101_env *env, struct p101_error *err, const char *str, intmax_t default_value, intmax_t min_value, intmax_t max_value)
+{
+    const char              *end;
+    bool                     has_error;
+    intmax_t                 parsed_value;
+    intmax_t                 ret_val;
+    enum integer_scan_status status;
+
+    P101_TRACE(env);
+    ret_val = default_value;
+    if(str == NULL)
+    {
+        P101_ERROR_RAISE_CHECK(err);
+        goto done;
+    }
+    has_error = p101_error_has_error(err);
+    if(has_error)
+    {
+        goto done;
+    }
+
+    // Only the wide targets see literals long enough for the SWAR kernel to
+    // pay for measuring the string first; the narrow ones stay single-pass.
+    end = NULL;
+    if(min_value < INT32_MIN || max_value > INT32_MAX)
+    {
+        end = str + p101_strlen(env, str);
+    }
+
+    status = scan_integer(str, end, &parsed_value);
+    if(status != INTEGER_SCAN_OK)
+    {
+        raise_scan_error(err, status);
+        goto done;
+    }
+    if(parsed_value < min_value || parsed_value > max_value)
+    {
+        P101_ERROR_RAISE_USER(err, "The integer is outside the target type's range.", P101_CONVERT_ERROR_RANGE);
+        goto done;
+    }
+
+    ret_val = parsed_value;
+
+done:
+    P101_TRACE_EXIT(env);
+    return ret_val;
+}
+
+static uintmax_t parse_unsigned_integer(const struct p101_env *env, struct p101_error *err, const char *str, uintmax_t default_value, uintmax_t max_value)
+{
+    const char              *end;
+    bool                     has_error;
+    uintmax_t                parsed_value;
+    uintmax_t                ret_val;
+    enum integer_scan_status status;
+
+    P101_TRACE(env);
+    ret_val = default_value;
+    if(str == NULL)
+    {
+        P101_ERROR_RAISE_CHECK(err);
+        goto done;
+    }
+    has_error = p101_error_has_error(err);
+    if(has_error)
+    {
+        goto done;
+    }
+
+    end = NULL;
+    if(max_value > UINT32_MAX)
+    {
+        end = str + p101_strlen(env, str);
+    }
+
+    // A leading '-' is refused by the scanner rather than wrapped round the
+    // way strtoumax() does it (so "-1" never becomes UINTMAX_MAX); the range
+    // check below could not catch that for the widest types.
+    status = scan_unsigned_integer(str, end, &parsed_value);
+    if(status != INTEGER_SCAN_OK)
+    {
+        raise_scan_error(err, status);
+        goto done;
+    }
+    if(parsed_value > max_value)
+    {
+        P101_ERROR_RAISE_USER(err, "The integer is outside the target type's range.", P101_CONVERT_ERROR_RANGE);
+        goto done;
+    }
+
+    ret_val = parsed_value;
+
+done:
+    P101_TRACE_EXIT(env);
+    return ret_val;
+}
+
+static intmax_t parse_integer_n(const struct p101_env *env, struct p101_error *err, const char *str, size_t length, intmax_t default_value, intmax_t min_value, intmax_t max_value)
+{
+    bool                     has_error;
+    intmax_t                 parsed_value;
+    intmax_t                 ret_val;
+    enum integer_scan_status status;
+
+    P101_TRACE(env);
+    ret_val = default_value;
+    if(str == NULL)
+    {
+        P101_ERROR_RAISE_CHECK(err);
+        goto done;
+    }
+    has_error = p101_error_has_error(err);
+    if(has_error)
+    {
+        goto done;
+    }
+
+    status = scan_integer(str, str + length, &parsed_value);
+    if(status != INTEGER_SCAN_OK)
+    {
+        raise_scan_error(err, status);
+        goto done;
+    }
+    if(parsed_value < min_value || parsed_value > max_value)
+    {
+        P101_ERROR_RAISE_USER(err, "The integer is outside the target type's range.", P101_CONVERT_ERROR_RANGE);
+        goto done;
+    }
+
+    ret_val = parsed_value;
+
+done:
+    P101_TRACE_EXIT(env);
+    return ret_val;
+}
+
+static uintmax_t parse_unsigned_integer_n(const struct p101_env *env, struct p101_error *err, const char *str, size_t length, uintmax_t default_value, uintmax_t max_value)
+{
+    bool                     has_error;
+    uintmax_t                parsed_value;
+    uintmax_t                ret_val;
+    enum integer_scan_status status;
+
+    P101_TRACE(env);
+    ret_val = default_value;
+    if(str == NULL)
+    {
+        P101_ERROR_RAISE_CHECK(err);
+        goto done;
+    }
+    has_error = p101_error_has_error(err);
+    if(has_error)
+    {
+        goto done;
+    }
+
+    status = scan_unsigned_integer(str, str + length, &parsed_value);
+    if(status != INTEGER_SCAN_OK)
+    {
+        raise_scan_error(err, status);
+        goto done;
+    }
+    if(parsed_value > max_value)
+    {
+        P101_ERROR_RAISE_USER(err, "The integer is outside the target type's range.", P101_CONVERT_ERROR_RANGE);
+        goto done;
+    }
+
+    ret_val = parsed_value;
+
+done:
+    P101_TRACE_EXIT(env);
+    return ret_val;
+}
+
+
+// Prefix parsing stops at the first character that cannot continue the
+// integer instead of rejecting it, and reports where that is through *end.
+// The text after the integer may be arbitrarily long (the rest of a line or a
+// receive buffer), so it is never measured: these always use the
+// NUL-terminated scan. *end is set to str on every failure, the way strtol()
+// leaves endptr when nothing is converted.
+static intmax_t parse_integer_prefix(const struct p101_env *env, struct p101_error *err, const char *str, const char **end, intmax_t default_value, intmax_t min_value, intmax_t max_value)
+{
+    const char              *cursor;
+    bool                     has_error;
+    intmax_t                 parsed_value;
+    intmax_t                 ret_val;
+    enum integer_scan_status status;
+
+    P101_TRACE(env);
+    ret_val = default_value;
+    if(str == NULL || end == NULL)
+    {
+        P101_ERROR_RAISE_CHECK(err);
+        goto done;
+    }
+    *end      = str;
+    has_error = p101_error_has_error(err);
+    if(has_error)
+    {
+        goto done;
+    }
+
+    cursor = str;
+    status = scan_integer_prefix(&cursor, NULL, &parsed_value);
+    if(status != INTEGER_SCAN_OK)
+    {
+        raise_scan_error(err, status);
+        goto done;
+    }
+    if(parsed_value < min_value || parsed_value > max_value)
+    {
+        P101_ERROR_RAISE_USER(err, "The integer is outside the target type's range.", P101_CONVERT_ERROR_RANGE);
+        goto done;
+    }
+
+    *end    = cursor;
+    ret_val = parsed_value;
+
+done:
+    P101_TRACE_EXIT(env);
+    return ret_val;
+}
+
+static uintmax_t parse_unsigned_integer_prefix(const struct p101_env *env, struct p101_error *err, const char *str, const char **end, uintmax_t default_value, uintmax_t max_value)
+{
+    const char              *cursor;
+    bool                     has_error;
+    uintmax_t                parsed_value;
+    uintmax_t                ret_val;
+    enum integer_scan_status status;
+
+    P101_TRACE(env);
+    ret_val = default_value;
+    if(str == NULL || end == NULL)
+    {
+        P101_ERROR_RAISE_CHECK(err);
+        goto done;
+    }
+    *end      = str;
+    has_error = p101_error_has_error(err);
+    if(has_error)
+    {
+        goto done;
+    }
+
+    cursor = str;
+    status = scan_unsigned_integer_prefix(&cursor, NULL, &parsed_value);
+    if(status != INTEGER_SCAN_OK)
+    {
+        raise_scan_error(err, status);
+        goto done;
+    }
+    if(parsed_value > max_value)
+    {
+        P101_ERROR_RAISE_USER(err, "The integer is outside the target type's range.", P101_CONVERT_ERROR_RANGE);
+        goto done;
+    }
+
+    *end    = cursor;
+    ret_val = parsed_value;
+
+done:
+    P101_TRACE_EXIT(env);
+    return ret_val;
+}
+
+static intmax_t parse_integer_base(const struct p101_env *env, struct p101_error *err, const char *str, unsigned int base, intmax_t default_value, intmax_t min_value, intmax_t max_value)
+{
+    const char              *end;
+    bool                     has_error;
+    bool                     negative;
+    uintmax_t                magnitude;
+    intmax_t                 parsed_value;
+    intmax_t                 ret_val;
+    enum integer_scan_status status;
+
+    P101_TRACE(env);
+    ret_val = default_value;
+    if(str == NULL || base == 1U || base > RADIX_MAX)
+    {
+        P101_ERROR_RAISE_CHECK(err);
+        goto done;
+    }
+    has_error = p101_error_has_error(err);
+    if(has_error)
+    {
+        goto done;
+    }
+
+    // Only a 64-bit target can hold a sixteen-digit hex value, so only it
+    // pays for measuring the string for the hex kernels.
+    end = NULL;
+    if(min_value < INT32_MIN || max_value > INT32_MAX)
+    {
+        end = str + p101_strlen(env, str);
+    }
+
+    status = scan_radix_integer(str, end, base, true, &negative, &magnitude);
+    if(status != INTEGER_SCAN_OK)
+    {
+        raise_scan_error(err, status);
+        goto done;
+    }
+
+    parsed_value = (intmax_t)magnitude;
+    if(negative && magnitude != 0U)
+    {
+        parsed_value = -(intmax_t)(magnitude - 1U) - 1;
+    }
+    if(parsed_value < min_value || parsed_value > max_value)
+    {
+        P101_ERROR_RAISE_USER(err, "The integer is outside the target type's range.", P101_CONVERT_ERROR_RANGE);
+        goto done;
+    }
+
+    ret_val = parsed_value;
+
+done:
+    P101_TRACE_EXIT(env);
+    return ret_val;
+}
+
+static uintmax_t parse_unsigned_integer_base(const struct p101_env *env, struct p101_error *err, const char *str, unsigned int base, uintmax_t default_value, uintmax_t max_value)
+{
+    const char              *end;
+    bool                     has_error;
+    bool                     negative;
+    uintmax_t                parsed_value;
+    uintmax_t                ret_val;
+    enum integer_scan_status status;
+
+    P101_TRACE(env);
+    ret_val = default_value;
+    if(str == NULL || base == 1U || base > RADIX_MAX)
+    {
+        P101_ERROR_RAISE_CHECK(err);
+        goto done;
+    }
+    has_error = p101_error_has_error(err);
+    if(has_error)
+    {
+        goto done;
+    }
+
+    end = NULL;
+    if(max_value > UINT32_MAX)
+    {
+        end = str + p101_strlen(env, str);
+    }
+
+    status = scan_radix_integer(str, end, base, false, &negative, &parsed_value);
+    if(status != INTEGER_SCAN_OK)
+    {
+        raise_scan_error(err, status);
+        goto done;
+    }
+    if(parsed_value > max_value)
+    {
+        P101_ERROR_RAISE_USER(err, "The integer is outside the target type's range.", P101_CONVERT_ERROR_RANGE);
+        goto done;
+    }
+
+    ret_val = parsed_value;
+
+done:
+    P101_TRACE_EXIT(env);
+    return ret_val;
+}
+
+static struct p101_uint128 parse_wide_integer(const struct p101_env *env, struct p101_error *err, const char *str, unsigned int base, struct p101_uint128 default_value)
+{
+    bool                     has_error;
+    struct p101_uint128      parsed_value;
+    struct p101_uint128      ret_val;
+    enum integer_scan_status status;
+
+    P101_TRACE(env);
+    ret_val = default_value;
+    if(str == NULL || base == 1U || base > RADIX_MAX)
+    {
+        P101_ERROR_RAISE_CHECK(err);
+        goto done;
+    }
+    has_error = p101_error_has_error(err);
+    if(has_error)
+    {
+        goto done;
+    }
+
+    status = scan_wide_integer(str, str + p101_strlen(env, str), base, &parsed_value);
+    if(status != INTEGER_SCAN_OK)
+    {
+        raise_scan_error(err, status);
+        goto done;
+    }
+
+    ret_val = parsed_value;
+
+done:
+    P101_TRACE_EXIT(env);
+    return ret_val;
+}
+
+// Fixed-width identifiers have no sign, blanks or prefix, and their leading
+// zeros are significant, so this is not a number parse: every eight bytes are
+// one call to the sixteen-digit kernel, stored most significant byte first,
+// and any tail goes two digits at a time. The output is cleared on failure,
+// which for trace context also makes it the all-zero "invalid" ID.
+static bool parse_hex_id(const struct p101_env *env, struct p101_error *err, const char *str, uint8_t *id, size_t size)
+{
+    size_t length;
+    size_t offset;
+    bool   has_error;
+    bool   ret_val;
+
+    P101_TRACE(env);
+    ret_val = false;
+    if(str == NULL || id == NULL || size == 0)
+    {
+        P101_ERROR_RAISE_CHECK(err);
+        goto done;
+    }
+    has_error = p101_error_has_error(err);
+    if(has_error)
+    {
+        goto done;
+    }
+
+    length = p101_strlen(env, str);
+    if(length % 2U != 0U || length / 2U != size)
+    {
+        p101_memset(env, id, 0, size);
+        P101_ERROR_RAISE_USER(err, "The identifier must be exactly two hex digits per byte.", P101_CONVERT_ERROR_SYNTAX);
+        goto done;
+    }
+
+    for(offset = 0; size - offset >= SWAR_DIGITS; offset += SWAR_DIGITS)
+    {
+        uint64_t chunk;
+
+        if(!load_sixteen_hex_digits(str + (2U * offset), &chunk))
+        {
+            goto invalid;
+        }
+        for(size_t byte = 0; byte < SWAR_DIGITS; byte++)
+        {
+            id[offset + byte] = (uint8_t)(chunk >> ((SWAR_DIGITS - 1U - byte) * CHAR_BIT));
+        }
+    }
+
+    for(; offset < size; offset++)
+    {
+        unsigned int high;
+        unsigned int low;
+
+        high = radix_digit_value(str[2U * offset]);
+        low  = radix_digit_value(str[(2U * offset) + 1U]);
+        if(high >= RADIX_HEX || low >= RADIX_HEX)
+        {
+            goto invalid;
+        }
+        id[offset] = (uint8_t)((high << HEX_DIGIT_BITS) | low);
+    }
+
+    ret_val = true;
+    goto done;
+
+invalid:
+    p101_memset(env, id, 0, size);
+    P101_ERROR_RAISE_USER(err, "The identifier contains a character that is not a hex digit.", P101_CONVERT_ERROR_SYNTAX);
+
+done:
+    P101_TRACE_EXIT(env);
+    return ret_val;
+}
+
+// A size is an unsigned decimal with an optional fraction and a unit suffix.
+// The whole part goes through scan_decimal_digits() with a 64-bit limit; the
+// fraction is kept as an integer and its digit count, with trailing zeros
+// dropped, so "1.5GiB" is 1 GiB plus 5 / 10 of one and no floating point is
+// involved. The scaled total is checked against max_value with the same error
+// as the integer parsers.
+static uint64_t parse_size(const struct p101_env *env, struct p101_error *err, const char *str, uint64_t default_value, uint64_t max_value)
+{
+    const char              *text;
+    bool                     has_error;
+    bool                     binary;
+    bool                     precise;
+    uintmax_t                whole;
+    uint64_t                 fraction;
+    uint64_t                 fraction_bytes;
+    uint64_t                 scale;
+    uint64_t                 ret_val;
+    unsigned int             fraction_digits;
+    unsigned int             pending_zeros;
+    unsigned int             power;
+    enum integer_scan_status status;
+
+    P101_TRACE(env);
+    ret_val = default_value;
+    if(str == NULL)
+    {
+        P101_ERROR_RAISE_CHECK(err);
+        goto done;
+    }
+    has_error = p101_error_has_error(err);
+    if(has_error)
+    {
+        goto done;
+    }
+
+    text = str;
+    while(is_ascii_space(*text))
+    {
+        text++;
+    }
+    if(*text == '-')
+    {
+        raise_scan_error(err, INTEGER_SCAN_NEGATIVE_UNSIGNED);
+        goto done;
+    }
+    if(*text == '+')
+    {
+        text++;
+    }
+
+    status = scan_decimal_digits(&text, NULL, UINTMAX_MAX, &whole);
+    if(status != INTEGER_SCAN_OK)
+    {
+        raise_scan_error(err, status);
+        goto done;
+    }
+
+    fraction        = 0;
+    fraction_digits = 0;
+    precise         = true;
+    if(*text == '.')
+    {
+        const char *digits;
+
+        digits        = ++text;
+        pending_zeros = 0;
+        while(*text >= '0' && *text <= '9')
+        {
+            if(*text == '0')
+            {
+                pending_zeros++;
+            }
+            else if(fraction_digits + pending_zeros < SIZE_FRACTION_DIGITS)
+            {
+                for(; pending_zeros > 0; pending_zeros--)
+                {
+                    fraction *= BASE_TEN;
+                    fraction_digits++;
+                }
+                fraction = (fraction * BASE_TEN) + (uint64_t)(*text - '0');
+                fraction_digits++;
+            }
+            else
+            {
+                precise = false;
+            }
+            text++;
+        }
+        if(text == digits)
+        {
+            raise_scan_error(err, INTEGER_SCAN_TRAILING_CHARACTERS);
+            goto done;
+        }
+    }
+
+    if(!scan_size_unit(text, &power, &binary))
+    {
+        P101_ERROR_RAISE_USER(err, "The size has an unknown unit suffix.", P101_CONVERT_ERROR_SYNTAX);
+        goto done;
+    }
+    if(!precise || !scale_size_fraction(fraction, fraction_digits, power, binary, &fraction_bytes))
+    {
+        P101_ERROR_RAISE_USER(err, "The size is not a whole number of bytes.", P101_CONVERT_ERROR_SYNTAX);
+        goto done;
+    }
+
+    scale = 1;
+    for(unsigned int step = 0; step < power; step++)
+    {
+        scale = binary ? scale << SIZE_IEC_BITS : scale * SIZE_SI_STEP;
+    }
+    if(fraction_bytes > max_value || whole > (max_value - fraction_bytes) / scale)
+    {
+        P101_ERROR_RAISE_USER(err, "The integer is outside the target type's range.", P101_CONVERT_ERROR_RANGE);
+        goto done;
+    }
+
+    ret_val = ((uint64_t)whole * scale) + fraction_bytes;
+
+done:
+    P101_TRACE_EXIT(env);
+    return ret_val;
+}
+
+// A duration is an optional sign and then one or more decimal numbers, each
+// with an optional fraction and a unit, read in one pass with no copy: the
+// whole part of each goes through scan_decimal_digits() and the fraction
+// through fraction_of_unit(). As in Go, either side of the '.' may be empty
+// (".5s", "1.s") but not both. A bare "0" needs no unit. Each part and the
+// running total are checked against the int64_t range before they are added.
+static bool parse_duration(const struct p101_env *env, struct p101_error *err, const char *str, int64_t *nanoseconds)
+{
+    const char              *text;
+    bool                     has_error;
+    bool                     negative;
+    uint64_t                 limit;
+    uint64_t                 total;
+    bool                     ret_val;
+    enum integer_scan_status status;
+
+    P101_TRACE(env);
+    ret_val = false;
+    if(str == NULL)
+    {
+        P101_ERROR_RAISE_CHECK(err);
+        goto done;
+    }
+    has_error = p101_error_has_error(err);
+    if(has_error)
+    {
+        goto done;
+    }
+
+    text = str;
+    while(is_ascii_space(*text))
+    {
+        text++;
+    }
+
+    negative = false;
+    if(*text == '+' || *text == '-')
+    {
+        negative = *text == '-';
+        text++;
+    }
+
+    if(text[0] == '0' && text[1] == '\0')
+    {
+        *nanoseconds = 0;
+        ret_val      = true;
+        goto done;
+    }
+
+    limit = negative ? (uint64_t)INT64_MAX + 1U : (uint64_t)INT64_MAX;
+    total = 0;
+    do
+    {
+        const char *fraction;
+        const char *fraction_end;
+        uintmax_t   whole;
+        uint64_t    unit;
+        uint64_t    part;
+
+        status = scan_decimal_digits(&text, NULL, limit, &whole);
+        if(status == INTEGER_SCAN_NO_DIGITS && text[0] == '.' && text[1] >= '0' && text[1] <= '9')
+        {
+            status = INTEGER_SCAN_OK;
+        }
+        if(status != INTEGER_SCAN_OK)
+        {
+            raise_scan_error(err, status);
+            goto done;
+        }
+
+        fraction     = text;
+        fraction_end = text;
+        if(*text == '.')
+        {
+            fraction = ++text;
+            while(*text >= '0' && *text <= '9')
+            {
+                text++;
+            }
+            fraction_end = text;
+        }
+
+        unit = scan_duration_unit(&text);
+        if(unit == 0)
+        {
+            P101_ERROR_RAISE_USER(err, "The duration has a missing or unknown unit.", P101_CONVERT_ERROR_SYNTAX);
+            goto done;
+        }
+
+        part = fraction_of_unit(fraction, fraction_end, unit);
+        if(whole > (limit - part) / unit || (whole * unit) + part > limit - total)
+        {
+            P101_ERROR_RAISE_USER(err, "The duration does not fit in 64-bit nanoseconds.", P101_CONVERT_ERROR_RANGE);
+            goto done;
+        }
+        total += (whole * unit) + part;
+    } while(*text != '\0');
+
+    *nanoseconds = (int64_t)total;
+    if(negative && total != 0U)
+    {
+        *nanoseconds = -(int64_t)(total - 1U) - 1;
+    }
+    ret_val = true;
+
+done:
+    P101_TRACE_EXIT(env);
+    return ret_val;
+}
+
+// The timespec is normalised the POSIX way, with tv_nsec in [0, 1e9) and
+// tv_sec rounded down, so -1.5s is { -2, 500000000 }. Where time_t is 32 bits
+// a duration past 2038-style limits is a range error rather than a wrap.
+static struct timespec parse_duration_timespec(const struct p101_env *env, struct p101_error *err, const char *str, struct timespec default_value)
+{
+    int64_t         nanoseconds;
+    int64_t         seconds;
+    int64_t         remainder;
+    struct timespec ret_val;
+
+    P101_TRACE(env);
+    ret_val = default_value;
+    if(!parse_duration(env, err, str, &nanoseconds))
+    {
+        goto done;
+    }
+
+    seconds   = nanoseconds / (int64_t)NANOSECONDS_PER_SECOND;
+    remainder = nanoseconds % (int64_t)NANOSECONDS_PER_SECOND;
+    if(remainder < 0)
+    {
+        remainder += (int64_t)NANOSECONDS_PER_SECOND;
+        seconds--;
+    }
+    if((int64_t)(time_t)seconds != seconds)
+    {
+        P101_ERROR_RAISE_USER(err, "The duration does not fit in a timespec.", P101_CONVERT_ERROR_RANGE);
+        goto done;
+    }
+
+    ret_val.tv_sec  = (time_t)seconds;
+    ret_val.tv_nsec = (long)remainder;
+
+done:
+    P101_TRACE_EXIT(env);
+    return ret_val;
+}
+
+// Batch elements are check_integer() and check_unsigned_integer() with the
+// same length measurement as the single-string parsers, so a bad element
+// costs no p101_error traffic and does not end the batch.
+static enum p101_convert_status parse_integer_element(const struct p101_env *env, const char *str, intmax_t min_value, intmax_t max_value, intmax_t *value)
+{
+    const char *end;
+
+    if(str == NULL)
+    {
+        return P101_CONVERT_STATUS_SYNTAX;
+    }
+
+    end = NULL;
+    if(min_value < INT32_MIN || max_value > INT32_MAX)
+    {
+        end = str + p101_strlen(env, str);
+    }
+
+    return check_integer(str, end, min_value, max_value, value);
+}
+
+static enum p101_convert_status parse_unsigned_integer_element(const struct p101_env *env, const char *str, uintmax_t max_value, uintmax_t *value)
+{
+    const char *end;
+
+    if(str == NULL)
+    {
+        return P101_CONVERT_STATUS_SYNTAX;
+    }
+
+    end = NULL;
+    if(max_value > UINT32_MAX)
+    {
+        end = str + p101_strlen(env, str);
+    }
+
+    return check_unsigned_integer(str, end, max_value, value);
+}
+
+static bool is_list_delimiter(char c, const char *delimiters)
+{
+    const char *delimiter;
+
+    delimiter = delimiters;
+    while(*delimiter != '\0')
+    {
+        if(*delimiter == c)
+        {
+            return true;
+        }
+        delimiter++;
+    }
+
+    return false;
+}
+
+// Lists are split and converted in the same scan: each token is read with the
+// prefix scanner, which stops on the first character that cannot continue the
+// integer, and that character must then be a delimiter or the end of the
+// text. Each token therefore follows the single-string rules (leading
+// whitespace and a sign, no trailing characters) and an empty token is a
+// syntax error. A token may not start with a delimiter either, or "1  2" with
+// " " would read as two integers rather than three tokens with an empty one
+// between. The list is measured once so every token can use the bounded
+// digit kernels.
+static size_t parse_integer_list(const struct p101_env *env, struct p101_error *err, const char *str, const char *delimiters, int64_t *out, size_t capacity, intmax_t min_value, intmax_t max_value)
+{
+    const char              *cursor;
+    const char              *end;
+    bool                     has_error;
+    bool                     more;
+    intmax_t                 parsed_value;
+    size_t                   parsed_count;
+    size_t                   ret_val;
+    enum integer_scan_status status;
+
+    P101_TRACE(env);
+    ret_val = 0;
+    if(str == NULL || delimiters == NULL || (out == NULL && capacity != 0U))
+    {
+        P101_ERROR_RAISE_CHECK(err);
+        goto done;
+    }
+    has_error = p101_error_has_error(err);
+    if(has_error)
+    {
+        goto done;
+    }
+
+    cursor       = str;
+    end          = str + p101_strlen(env, str);
+    parsed_count = 0;
+    more         = true;
+    while(more)
+    {
+        // The scanner would skip a whitespace delimiter as leading blanks.
+        if(cursor == end || is_list_delimiter(*cursor, delimiters))
+        {
+            raise_scan_error(err, INTEGER_SCAN_NO_DIGITS);
+            goto done;
+        }
+
+        status = scan_integer_prefix(&cursor, end, &parsed_value);
+        if(status != INTEGER_SCAN_OK)
+        {
+            raise_scan_error(err, status);
+            goto done;
+        }
+        if(parsed_value < min_value || parsed_value > max_value)
+        {
+            P101_ERROR_RAISE_USER(err, "The integer is outside the target type's range.", P101_CONVERT_ERROR_RANGE);
+            goto done;
+        }
+        if(parsed_count == capacity)
+        {
+            P101_ERROR_RAISE_USER(err, "The list has more integers than the output array can hold.", P101_CONVERT_ERROR_RANGE);
+            goto done;
+        }
+        out[parsed_count] = (int64_t)parsed_value;
+        parsed_count++;
+
+        more = cursor != end;
+        if(more)
+        {
+            if(!is_list_delimiter(*cursor, delimiters))
+            {
+                raise_scan_error(err, INTEGER_SCAN_TRAILING_CHARACTERS);
+                goto done;
+            }
+            cursor++;
+        }
+    }
+
+    ret_val = parsed_count;
+
+done:
+    P101_TRACE_EXIT(env);
+    return ret_val;
+}
+
+static size_t parse_unsigned_integer_list(const struct p101_env *env, struct p101_error *err, const char *str, const char *delimiters, uint64_t *out, size_t capacity, uintmax_t max_value)
+{
+    const char              *cursor;
+    const char              *end;
+    bool                     has_error;
+    bool                     more;
+    uintmax_t                parsed_value;
+    size_t                   parsed_count;
+    size_t                   ret_val;
+    enum integer_scan_status status;
+
+    P101_TRACE(env);
+    ret_val = 0;
+    if(str == NULL || delimiters == NULL || (out == NULL && capacity != 0U))
+    {
+        P101_ERROR_RAISE_CHECK(err);
+        goto done;
+    }
+    has_error = p101_error_has_error(err);
+    if(has_error)
+    {
+        goto done;
+    }
+
+    cursor       = str;
+    end          = str + p101_strlen(env, str);
+    parsed_count = 0;
+    more         = true;
+    while(more)
+    {
+        // The scanner would skip a whitespace delimiter as leading blanks.
+        if(cursor == end || is_list_delimiter(*cursor, delimiters))
+        {
+            raise_scan_error(err, INTEGER_SCAN_NO_DIGITS);
+            goto done;
+        }
+
+        status = scan_unsigned_integer_prefix(&cursor, end, &parsed_value);
+        if(status != INTEGER_SCAN_OK)
+        {
+            raise_scan_error(err, status);
+            goto done;
+        }
+        if(parsed_value > max_value)
+        {
+            P101_ERROR_RAISE_USER(err, "The integer is outside the target type's range.", P101_CONVERT_ERROR_RANGE);
+            goto done;
+        }
+        if(parsed_count == capacity)
+        {
+            P101_ERROR_RAISE_USER(err, "The list has more integers than the output array can hold.", P101_CONVERT_ERROR_RANGE);
+            goto done;
+        }
+        out[parsed_count] = (uint64_t)parsed_value;
+        parsed_count++;
+
+        more = cursor != end;
+        if(more)
+        {
+            if(!is_list_delimiter(*cursor, delimiters))
+            {
+                raise_scan_error(err, INTEGER_SCAN_TRAILING_CHARACTERS);
+                goto done;
+            }
+            cursor++;
+        }
+    }
+
+    ret_val = parsed_count;
+
+done:
+    P101_TRACE_EXIT(env);
+    return ret_val;
+}
+
+// The inverse of the scanners above. The number of digits is known before
+// anything is written: the bit length of the value, times log10(2) as
+// 1233 / 4096, is the digit count or one more, and a single comparison with a
+// power of ten settles which. The digits are then written from the end two at
+// a time out of a 200-byte table, halving the divisions snprintf() would do,
+// and the caller's buffer is checked against the exact length up front.
+static const uint64_t powers_of_ten[UINT64_DECIMAL_DIGITS] = {
+    0U,    // zero has one digit, so no value compares below this entry
+    UINT64_C(10),
+    UINT64_C(100),
+    UINT64_C(1000),
+    UINT64_C(10000),
+    UINT64_C(100000),
+    UINT64_C(1000000),
+    UINT64_C(10000000),
+    UINT64_C(100000000),
+    UINT64_C(1000000000),
+    UINT64_C(10000000000),
+    UINT64_C(100000000000),
+    UINT64_C(1000000000000),
+    UINT64_C(10000000000000),
+    UINT64_C(100000000000000),
+    UINT64_C(1000000000000000),
+    UINT64_C(10000000000000000),
+    UINT64_C(100000000000000000),
+    UINT64_C(1000000000000000000),
+    UINT64_C(10000000000000000000),
+};
+
+static const char decimal_pairs[] =
+    "0001020304050607080910111213141516171819"
+    "2021222324252627282930313233343536373839"
+    "4041424344454647484950515253545556575859"
+    "6061626364656667686970717273747576777879"
+    "8081828384858687888990919293949596979899";
+
+static size_t decimal_digit_count(uint64_t value)
+{
+    unsigned int bits;
+    size_t       digits;
+
+#ifdef __GNUC__
+    bits = UINT64_BITS - (unsigned int)__builtin_clzll(value | 1U);
+#else
+    for(bits = 1; bits < UINT64_BITS && (value >> bits) != 0U; bits++)
+    {
+    }
+#endif
+    digits = ((bits * LOG10_2_SCALED) >> LOG10_2_SHIFT) + 1U;
+    if(value < powers_of_ten[digits - 1U])
+    {
+        digits--;
+    }
+
+    return digits;
+}
+
+// end is one past the last digit; decimal_digit_count() bytes before it are
+// written.
+static void write_decimal_digits(uint64_t value, char *end)
+{
+    while(value >= DIGIT_PAIR_LIMIT)
+    {
+        const char *pair;
+
+        pair = &decimal_pairs[2U * (value % DIGIT_PAIR_LIMIT)];
+        value /= DIGIT_PAIR_LIMIT;
+        *--end = pair[1];
+        *--end = pair[0];
+    }
+
+    if(value >= BASE_TEN)
+    {
+        *--end = decimal_pairs[(2U * value) + 1U];
+        *--end = decimal_pairs[2U * value];
+    }
+    else
+    {
+        *--end = (char)('0' + value);
+    }
+}
+
+static size_t format_decimal(const struct p101_env *env, struct p101_error *err, bool negative, uint64_t magnitude, char *buffer, size_t size)
+{
+    size_t length;
+    size_t ret_val;
+    bool   has_error;
+
+    P101_TRACE(env);
+    ret_val = 0;
+    if(buffer == NULL)
+    {
+        P101_ERROR_RAISE_CHECK(err);
+        goto done;
+    }
+    has_error = p101_error_has_error(err);
+    if(has_error)
+    {
+        goto done;
+    }
+
+    length = decimal_digit_count(magnitude) + (negative ? 1U : 0U);
+    if(length >= size)
+    {
+        if(size != 0U)
+        {
+            buffer[0] = '\0';
+        }
+        P101_ERROR_RAISE_USER(err, "The buffer is too small for the number.", P101_CONVERT_ERROR_RANGE);
+        goto done;
+    }
+
+    if(negative)
+    {
+        buffer[0] = '-';
+    }
+    write_decimal_digits(magnitude, &buffer[length]);
+    buffer[length] = '\0';
+    ret_val        = length;
+
+done:
+    P101_TRACE_EXIT(env);
+    return ret_val;
+}
+
+// The magnitude of a negative value is taken in unsigned arithmetic, so
+// INTMAX_MIN needs no special case.
+static size_t format_integer(const struct p101_env *env, struct p101_error *err, intmax_t value, char *buffer, size_t size)
+{
+    uint64_t magnitude;
+
+    magnitude = (uint64_t)value;
+    if(value < 0)
+    {
+        magnitude = 0U - magnitude;
+    }
+
+    return format_decimal(env, err, value < 0, magnitude, buffer, size);
+}
+
+static size_t format_unsigned_integer(const struct p101_env *env, struct p101_error *err, uintmax_t value, char *buffer, size_t size)
+{
+    return format_decimal(env, err, false, (uint64_t)value, buffer, size);
+}
+
+#define DEFINE_SIGNED_PARSE_CONVERTER(function_name, result_type)                                                                                                                                                                                                  \
+    static result_type function_name(const struct p101_env *env, struct p101_error *err, const char *str, result_type default_value, intmax_t min_value, intmax_t max_value)                                                                                       \
+    {                                                                                                                                                                                                                                                              \
+        intmax_t    parsed_wide_result;                                                                                                                                                                                                                            \
+        result_type parsed_result;                                                                                                                                                                                                                                 \
+        parsed_wide_result = parse_integer(env, err, str, default_value, min_value, max_value);                                                                                                                                                                    \
+        parsed_result      = (result_type)parsed_wide_result;                                                                                                                                                                                                      \
+        return parsed_result;                                                                                                                                                                                                                                      \
+    }                                                                                                                                                                                                                                                              \
+                                                                                                                                                                                                                                                                   \
+    static result_type function_name##_n(const struct p101_env *env, struct p101_error *err, const char *str, size_t length, result_type default_value, intmax_t min_value, intmax_t max_value)                                                                    \
+    {                                                                                                                                                                                                                                                              \
+        intmax_t    parsed_wide_result;                                                                                                                                                                                                                            \
+        result_type parsed_result;                                                                                                                                                                                                                                 \
+        parsed_wide_result = parse_integer_n(env, err, str, length, default_value, min_value, max_value);                                                                                                                                                          \
+        parsed_result      = (result_type)parsed_wide_result;                                                                                                                                                                                                      \
+        return parsed_result;                                                                                                                                                                                                                                      \
+    }                                                                                                                                                                                                                                                              \
+                                                                                                                                                                                                                                                                   \
+    static result_type function_name##_prefix(const struct p101_env *env, struct p101_error *err, const char *str, const char **end, result_type default_value, intmax_t min_value, intmax_t max_value)                                                            \
+    {                                                                                                                                                                                                                                                              \
+        intmax_t    parsed_wide_result;                                                                                                                                                                                                                            \
+        result_type parsed_result;                                                                                                                                                                                                                                 \
+        parsed_wide_result = parse_integer_prefix(env, err, str, end, default_value, min_value, max_value);                                                                                                                                                        \
+        parsed_result      = (result_type)parsed_wide_result;                                                                                                                                                                                                      \
+        return parsed_result;                                                                                                                                                                                                                                      \
+    }
+
+#define DEFINE_SIGNED_PARSE_SAME_CONVERTER(function_name, result_type)                                                                                                                                                                                             \
+    static result_type function_name(const struct p101_env *env, struct p101_error *err, const char *str, result_type default_value, intmax_t min_value, intmax_t max_value)                                                                                       \
+    {                                                                                                                                                                                                                                                              \
+        result_type parsed_result;                                                                                                                                                                                                                                 \
+        parsed_result = parse_integer(env, err, str, default_value, min_value, max_value);                                                                                                                                                                         \
+        return parsed_result;                                                                                                                                                                                                                                      \
+    }                                                                                                                                                                                                                                                              \
+                                                                                                                                                                                                                                                                   \
+    static result_type function_name##_n(const struct p101_env *env, struct p101_error *err, const char *str, size_t length, result_type default_value, intmax_t min_value, intmax_t max_value)                                                                    \
+    {                                                                                                                                                                                                                                                              \
+        result_type parsed_result;                                                                                                                                                                                                                                 \
+        parsed_result = parse_integer_n(env, err, str, length, default_value, min_value, max_value);                                                                                                                                                               \
+        return parsed_result;                                                                                                                                                                                                                                      \
+    }                                                                                                                                                                                                                                                              \
+                                                                                                                                                                                                                                                                   \
+    static result_type function_name##_prefix(const struct p101_env *env, struct p101_error *err, const char *str, const char **end, result_type default_value, intmax_t min_value, intmax_t max_value)                                                            \
+    {                                                                                                                                                                                                                                                              \
+        result_type parsed_result;                                                                                                                                                                                                                                 \
+        parsed_result = parse_integer_prefix(env, err, str, end, default_value, min_value, max_value);                                                                                                                                                             \
+        return parsed_result;                                                                                                                                                                                                                                      \
+    }
+
+#define DEFINE_UNSIGNED_PARSE_CONVERTER(function_name, result_type)                                                                                                                                                                                                \
+    static result_type function_name(const struct p101_env *env, struct p101_error *err, const char *str, result_type default_value, uintmax_t max_value)                                                                                                          \
+    {                                                                                                                                                                                                                                                              \
+        uintmax_t   parsed_wide_result;                                                                                                                                                                                                                            \
+        result_type parsed_result;                                                                                                                                                                                                                                 \
+        parsed_wide_result = parse_unsigned_integer(env, err, str, default_value, max_value);                                                                                                                                                                      \
+        parsed_result      = (result_type)parsed_wide_result;                                                                                                                                                                                                      \
+        return parsed_result;                                                                                                                                                                                                                                      \
+    }                                                                                                                                                                                                                                                              \
+                                                                                                                                                                                                                                                                   \
+    static result_type function_name##_n(const struct p101_env *env, struct p101_error *err, const char *str, size_t length, result_type default_value, uintmax_t max_value)                                                                                       \
+    {                                                                                                                                                                                                                                                              \
+        uintmax_t   parsed_wide_result;                                                                                                                                                                                                                            \
+        result_type parsed_result;                                                                                                                                                                                                                                 \
+        parsed_wide_result = parse_unsigned_integer_n(env, err, str, length, default_value, max_value);                                                                                                                                                            \
+        parsed_result      = (result_type)parsed_wide_result;                                                                                                                                                                                                      \
+        return parsed_result;                                                                                                                                                                                                                                      \
+    }                                                                                                                                                                                                                                                              \
+                                                                                                                                                                                                                                                                   \
+    static result_type function_name##_prefix(const struct p101_env *env, struct p101_error *err, const char *str, const char **end, result_type default_value, uintmax_t max_value)                                                                               \
+    {                                                                                                                                                                                                                                                              \
+        uintmax_t   parsed_wide_result;                                                                                                                                                                                                                            \
+        result_type parsed_result;                                                                                                                                                                                                                                 \
+        parsed_wide_result = parse_unsigned_integer_prefix(env, err, str, end, default_value, max_value);                                                                                                                                                          \
+        parsed_result      = (result_type)parsed_wide_result;                                                                                                                                                                                                      \
+        return parsed_result;                                                                                                                                                                                                                                      \
+    }
+
+#define DEFINE_UNSIGNED_PARSE_SAME_CONVERTER(function_name, result_type)                                                                                                                                                                                           \
+    static result_type function_name(const struct p101_env *env, struct p101_error *err, const char *str, result_type default_value, uintmax_t max_value)                                                                                                          \
+    {                                                                                                                                                                                                                                                              \
+        result_type parsed_result;                                                                                                                                                                                                                                 \
+        parsed_result = parse_unsigned_integer(env, err, str, default_value, max_value);                                                                                                                                                                           \
+        return parsed_result;                                                                                                                                                                                                                                      \
+    }                                                                                                                                                                                                                                                              \
+                                                                                                                                                                                                                                                                   \
+    static result_type function_name##_n(const struct p101_env *env, struct p101_error *err, const char *str, size_t length, result_type default_value, uintmax_t max_value)                                                                                       \
+    {                                                                                                                                                                                                                                                              \
+        result_type parsed_result;                                                                                                                                                                                                                                 \
+        parsed_result = parse_unsigned_integer_n(env, err, str, length, default_value, max_value);                                                                                                                                                                 \
+        return parsed_result;                                                                                                                                                                                                                                      \
+    }                                                                                                                                                                                                                                                              \
+                                                                                                                                                                                                                                                                   \
+    static result_type function_name##_prefix(const struct p101_env *env, struct p101_error *err, const char *str, const char **end, result_type default_value, uintmax_t max_value)                                                                               \
+    {                                                                                                                                                                                                                                                              \
+        result_type parsed_result;                                                                                                                                                                                                                                 \
+        parsed_result = parse_unsigned_integer_prefix(env, err, str, end, default_value, max_value);                                                                                                                                                               \
+        return parsed_result;                                                                                                                                                                                                                                      \
+    }
+
+DEFINE_SIGNED_PARSE_CONVERTER(convert_char, char)
+DEFINE_SIGNED_PARSE_CONVERTER(convert_short, short)
+DEFINE_SIGNED_PARSE_CONVERTER(convert_int, int)
+DEFINE_SIGNED_PARSE_SAME_CONVERTER(convert_long, long)
+DEFINE_SIGNED_PARSE_CONVERTER(convert_long_long, long long)
+DEFINE_SIGNED_PARSE_CONVERTER(convert_signed_char, signed char)
+DEFINE_SIGNED_PARSE_CONVERTER(convert_int8, int8_t)
+DEFINE_SIGNED_PARSE_CONVERTER(convert_int16, int16_t)
+DEFINE_SIGNED_PARSE_CONVERTER(convert_int32, int32_t)
+DEFINE_SIGNED_PARSE_SAME_CONVERTER(convert_int64, int64_t)
+DEFINE_UNSIGNED_PARSE_CONVERTER(convert_unsigned_char, unsigned char)
+DEFINE_UNSIGNED_PARSE_CONVERTER(convert_unsigned_short, unsigned short)
+DEFINE_UNSIGNED_PARSE_CONVERTER(convert_unsigned_int, unsigned int)
+DEFINE_UNSIGNED_PARSE_SAME_CONVERTER(convert_unsigned_long, unsigned long)
+DEFINE_UNSIGNED_PARSE_CONVERTER(convert_unsigned_long_long, unsigned long long)
 DEFINE_UNSIGNED_PARSE_CONVERTER(convert_uint8, uint8_t)
 DEFINE_UNSIGNED_PARSE_CONVERTER(convert_uint16, uint16_t)
 DEFINE_UNSIGNED_PARSE_CONVERTER(convert_uint32, uint32_t)
 DEFINE_UNSIGNED_PARSE_SAME_CONVERTER(convert_uint64, uint64_t)
 
-#undef DEFINE_UNSIGNED_PARSE_SAME_CONVERTER
-#undef DEFINE_UNSIGNED_PARSE_CONVERTER
-#undef DEFINE_SIGNED_PARSE_SAME_CONVERTER
-#undef DEFINE_SIGNED_PARSE_CONVERTER
+#undef DEFINE_UNSIGNED_PARSE_SAME_CONVERTER
+#undef DEFINE_UNSIGNED_PARSE_CONVERTER
+#undef DEFINE_SIGNED_PARSE_SAME_CONVERTER
+#undef DEFINE_SIGNED_PARSE_CONVERTER
+
+#define DEFINE_SIGNED_ARRAY_CONVERTER(function_name, result_type)                                                                                                                                                                                                  \
+    static size_t function_name(const struct p101_env *env, struct p101_error *err, const char *const *strs, size_t count, result_type *out, uint8_t *status, intmax_t min_value, intmax_t max_value)                                                              \
+    {                                                                                                                                                                                                                                                              \
+        bool     has_error;                                                                                                                                                                                                                                        \
+        intmax_t parsed_value;                                                                                                                                                                                                                                     \
+        size_t   index;                                                                                                                                                                                                                                            \
+        size_t   parsed_count;                                                                                                                                                                                                                                     \
+        P101_TRACE(env);                                                                                                                                                                                                                                           \
+        parsed_count = 0;                                                                                                                                                                                                                                          \
+        if(count != 0U && (strs == NULL || out == NULL || status == NULL))                                                                                                                                                                                         \
+        {                                                                                                                                                                                                                                                          \
+            P101_ERROR_RAISE_CHECK(err);                                                                                                                                                                                                                           \
+            goto done;                                                                                                                                                                                                                                             \
+        }                                                                                                                                                                                                                                                          \
+        has_error = p101_error_has_error(err);                                                                                                                                                                                                                     \
+        if(has_error)                                                                                                                                                                                                                                              \
+        {                                                                                                                                                                                                                                                          \
+            goto done;                                                                                                                                                                                                                                             \
+        }                                                                                                                                                                                                                                                          \
+        for(index = 0; index < count; index++)                                                                                                                                                                                                                     \
+        {                                                                                                                                                                                                                                                          \
+            status[index] = (uint8_t)parse_integer_element(env, strs[index], min_value, max_value, &parsed_value);                                                                                                                                                 \
+            if(status[index] == P101_CONVERT_STATUS_OK)                                                                                                                                                                                                            \
+            {                                                                                                                                                                                                                                                      \
+                out[index] = (result_type)parsed_value;                                                                                                                                                                                                            \
+                parsed_count++;                                                                                                                                                                                                                                    \
+            }                                                                                                                                                                                                                                                      \
+        }                                                                                                                                                                                                                                                          \
+    done:                                                                                                                                                                                                                                                          \
+        P101_TRACE_EXIT(env);                                                                                                                                                                                                                                      \
+        return parsed_count;                                                                                                                                                                                                                                       \
+    }
+
+#define DEFINE_UNSIGNED_ARRAY_CONVERTER(function_name, result_type)                                                                                                                                                                                                \
+    static size_t function_name(const struct p101_env *env, struct p101_error *err, const char *const *strs, size_t count, result_type *out, uint8_t *status, uintmax_t max_value)                                                                                 \
+    {                                                                                                                                                                                                                                                              \
+        bool      has_error;                                                                                                                                                                                                                                       \
+        uintmax_t parsed_value;                                                                                                                                                                                                                                    \
+        size_t    index;                                                                                                                                                                                                                                           \
+        size_t    parsed_count;                                                                                                                                                                                                                                    \
+        P101_TRACE(env);                                                                                                                                                                                                                                           \
+        parsed_count = 0;                                                                                                                                                                                                                                          \
+        if(count != 0U && (strs == NULL || out == NULL || status == NULL))                                                                                                                                                                                         \
+        {                                                                                                                                                                                                                                                          \
+            P101_ERROR_RAISE_CHECK(err);                                                                                                                                                                                                                           \
+            goto done;                                                                                                                                                                                                                                             \
+        }                                                                                                                                                                                                                                                          \
+        has_error = p101_error_has_error(err);                                                                                                                                                                                                                     \
+        if(has_error)                                                                                                                                                                                                                                              \
+        {                                                                                                                                                                                                                                                          \
+            goto done;                                                                                                                                                                                                                                             \
+        }                                                                                                                                                                                                                                                          \
+        for(index = 0; index < count; index++)                                                                                                                                                                                                                     \
+        {                                                                                                                                                                                                                                                          \
+            status[index] = (uint8_t)parse_unsigned_integer_element(env, strs[index], max_value, &parsed_value);                                                                                                                                                   \
+            if(status[index] == P101_CONVERT_STATUS_OK)                                                                                                                                                                                                            \
+            {                                                                                                                                                                                                                                                      \
+                out[index] = (result_type)parsed_value;                                                                                                                                                                                                            \
+                parsed_count++;                                                                                                                                                                                                                                    \
+            }                                                                                                                                                                                                                                                      \
+        }                                                                                                                                                                                                                                                          \
+    done:                                                                                                                                                                                                                                                          \
+        P101_TRACE_EXIT(env);                                                                                                                                                                                                                                      \
+        return parsed_count;                                                                                                                                                                                                                                       \
+    }
+
+DEFINE_SIGNED_ARRAY_CONVERTER(convert_int8_array, int8_t)
+DEFINE_SIGNED_ARRAY_CONVERTER(convert_int16_array, int16_t)
+DEFINE_SIGNED_ARRAY_CONVERTER(convert_int32_array, int32_t)
+DEFINE_SIGNED_ARRAY_CONVERTER(convert_int64_array, int64_t)
+DEFINE_UNSIGNED_ARRAY_CONVERTER(convert_uint8_array, uint8_t)
+DEFINE_UNSIGNED_ARRAY_CONVERTER(convert_uint16_array, uint16_t)
+DEFINE_UNSIGNED_ARRAY_CONVERTER(convert_uint32_array, uint32_t)
+DEFINE_UNSIGNED_ARRAY_CONVERTER(convert_uint64_array, uint64_t)
+
+#undef DEFINE_UNSIGNED_ARRAY_CONVERTER
+#undef DEFINE_SIGNED_ARRAY_CONVERTER
+
+char p101_parse_char(const struct p101_env *env, struct p101_error *err, const char *str, char default_value)
+{
+    P101_PARSE_PROLOGUE_ARG3(env, char, default_value);
+    parsed_result = convert_char(env, err, str, default_value, CHAR_MIN, CHAR_MAX);
+    P101_PARSE_EPILOGUE(env);
+}
+
+short p101_parse_short(const struct p101_env *env, struct p101_error *err, const char *str, short default_value)
+{
+    P101_PARSE_PROLOGUE_ARG3(env, short, default_value);
+    parsed_result = convert_short(env, err, str, default_value, SHRT_MIN, SHRT_MAX);
+    P101_PARSE_EPILOGUE(env);
+}
+
+int p101_parse_int(const struct p101_env *env, struct p101_error *err, const char *str, int default_value)
+{
+    P101_PARSE_PROLOGUE_ARG3(env, int, default_value);
+    parsed_result = convert_int(env, err, str, default_value, INT_MIN, INT_MAX);
+    P101_PARSE_EPILOGUE(env);
+}
+
+long p101_parse_long(const struct p101_env *env, struct p101_error *err, const char *str, long default_value)
+{
+    P101_PARSE_PROLOGUE_ARG3(env, long, default_value);
+    parsed_result = convert_long(env, err, str, default_value, LONG_MIN, LONG_MAX);
+    P101_PARSE_EPILOGUE(env);
+}
+
+long long p101_parse_long_long(const struct p101_env *env, struct p101_error *err, const char *str, long long default_value)
+{
+    P101_PARSE_PROLOGUE_ARG3(env, long long, default_value);
+    parsed_result = convert_long_long(env, err, str, default_value, LLONG_MIN, LLONG_MAX);
+    P101_PARSE_EPILOGUE(env);
+}
+
+unsigned char p101_parse_unsigned_char(const struct p101_env *env, struct p101_error *err, const char *str, unsigned char default_value)
+{
+    P101_PARSE_PROLOGUE_ARG3(env, unsigned char, default_value);
+    parsed_result = convert_unsigned_char(env, err, str, default_value, UCHAR_MAX);
+    P101_PARSE_EPILOGUE(env);
+}
+
+unsigned short p101_parse_unsigned_short(const struct p101_env *env, struct p101_error *err, const char *str, unsigned short default_value)
+{
+    P101_PARSE_PROLOGUE_ARG3(env, unsigned short, default_value);
+    parsed_result = convert_unsigned_short(env, err, str, default_value, USHRT_MAX);
+    P101_PARSE_EPILOGUE(env);
+}
+
+unsigned int p101_parse_unsigned_int(const struct p101_env *env, struct p101_error *err, const char *str, unsigned int default_value)
+{
+    P101_PARSE_PROLOGUE_ARG3(env, unsigned int, default_value);
+    parsed_result = convert_unsigned_int(env, err, str, default_value, UINT_MAX);
+    P101_PARSE_EPILOGUE(env);
+}
+
+unsigned long p101_parse_unsigned_long(const struct p101_env *env, struct p101_error *err, const char *str, unsigned long default_value)
+{
+    P101_PARSE_PROLOGUE_ARG3(env, unsigned long, default_value);
+    parsed_result = convert_unsigned_long(env, err, str, default_value, ULONG_MAX);
+    P101_PARSE_EPILOGUE(env);
+}
+
+unsigned long long p101_parse_unsigned_long_long(const struct p101_env *env, struct p101_error *err, const char *str, unsigned long long default_value)
+{
+    P101_PARSE_PROLOGUE_ARG3(env, unsigned long long, default_value);
+    parsed_result = convert_unsigned_long_long(env, err, str, default_value, ULLONG_MAX);
+    P101_PARSE_EPILOGUE(env);
+}
+
+signed char p101_parse_negative_char(const struct p101_env *env, struct p101_error *err, const char *str, signed char default_value)
+{
+    P101_PARSE_PROLOGUE_ARG3(env, signed char, default_value);
+    parsed_result = convert_signed_char(env, err, str, default_value, SCHAR_MIN, -1);
+    P101_PARSE_EPILOGUE(env);
+}
+
+short p101_parse_negative_short(const struct p101_env *env, struct p101_error *err, const char *str, short default_value)
+{
+    P101_PARSE_PROLOGUE_ARG3(env, short, default_value);
+    parsed_result = convert_short(env, err, str, default_value, SHRT_MIN, -1);
+    P101_PARSE_EPILOGUE(env);
+}
+
+int p101_parse_negative_int(const struct p101_env *env, struct p101_error *err, const char *str, int default_value)
+{
+    P101_PARSE_PROLOGUE_ARG3(env, int, default_value);
+    parsed_result = convert_int(env, err, str, default_value, INT_MIN, -1);
+    P101_PARSE_EPILOGUE(env);
+}
+
+long p101_parse_negative_long(const struct p101_env *env, struct p101_error *err, const char *str, long default_value)
+{
+    P101_PARSE_PROLOGUE_ARG3(env, long, default_value);
+    parsed_result = convert_long(env, err, str, default_value, LONG_MIN, -1L);
+    P101_PARSE_EPILOGUE(env);
+}
+
+long long p101_parse_negative_long_long(const struct p101_env *env, struct p101_error *err, const char *str, long long default_value)
+{
+    P101_PARSE_PROLOGUE_ARG3(env, long long, default_value);
+    parsed_result = convert_long_long(env, err, str, default_value, LLONG_MIN, -1LL);
+    P101_PARSE_EPILOGUE(env);
+}
+
+char p101_parse_positive_char(const struct p101_env *env, struct p101_error *err, const char *str, char default_value)
+{
+    P101_PARSE_PROLOGUE_ARG3(env, char, default_value);
+    parsed_result = convert_char(env, err, str, default_value, 1, CHAR_MAX);
+    P101_PARSE_EPILOGUE(env);
+}
+
+short p101_parse_positive_short(const struct p101_env *env, struct p101_error *err, const char *str, short default_value)
+{
+    P101_PARSE_PROLOGUE_ARG3(env, short, default_value);
+    parsed_result = convert_short(env, err, str, default_value, 1, SHRT_MAX);
+    P101_PARSE_EPILOGUE(env);
+}
+
+int p101_parse_positive_int(const struct p101_env *env, struct p101_error *err, const char *str, int default_value)
+{
+    P101_PARSE_PROLOGUE_ARG3(env, int, default_value);
+    parsed_result = convert_int(env, err, str, default_value, 1, INT_MAX);
+    P101_PARSE_EPILOGUE(env);
+}
+
+long p101_parse_positive_long(const struct p101_env *env, struct p101_error *err, const char *str, long default_value)
+{
+    P101_PARSE_PROLOGUE_ARG3(env, long, default_value);
+    parsed_result = convert_long(env, err, str, default_value, 1, LONG_MAX);
+    P101_PARSE_EPILOGUE(env);
+}
+
+long long p101_parse_positive_long_long(const struct p101_env *env, struct p101_error *err, const char *str, long long default_value)
+{
+    P101_PARSE_PROLOGUE_ARG3(env, long long, default_value);
+    parsed_result = convert_long_long(env, err, str, default_value, 1, LLONG_MAX);
+    P101_PARSE_EPILOGUE(env);
+}
+
+int8_t p101_parse_int8_t(const struct p101_env *env, struct p101_error *err, const char *str, int8_t default_value)
+{
+    P101_PARSE_PROLOGUE_ARG3(env, int8_t, default_value);
+    parsed_result = convert_int8(env, err, str, default_value, INT8_MIN, INT8_MAX);
+    P101_PARSE_EPILOGUE(env);
+}
+
+int16_t p101_parse_int16_t(const struct p101_env *env, struct p101_error *err, const char *str, int16_t default_value)
+{
+    P101_PARSE_PROLOGUE_ARG3(env, int16_t, default_value);
+    parsed_result = convert_int16(env, err, str, default_value, INT16_MIN, INT16_MAX);
+    P101_PARSE_EPILOGUE(env);
+}
+
+int32_t p101_parse_int32_t(const struct p101_env *env, struct p101_error *err, const char *str, int32_t default_value)
+{
+    P101_PARSE_PROLOGUE_ARG3(env, int32_t, default_value);
+    parsed_result = convert_int32(env, err, str, default_value, INT32_MIN, INT32_MAX);
+    P101_PARSE_EPILOGUE(env);
+}
+
+int64_t p101_parse_int64_t(const struct p101_env *env, struct p101_error *err, const char *str, int64_t default_value)
+{
+    P101_PARSE_PROLOGUE_ARG3(env, int64_t, default_value);
+    parsed_result = convert_int64(env, err, str, default_value, INT64_MIN, INT64_MAX);
+    P101_PARSE_EPILOGUE(env);
+}
+
+uint8_t p101_parse_uint8_t(const struct p101_env *env, struct p101_error *err, const char *str, uint8_t default_value)
+{
+    P101_PARSE_PROLOGUE_ARG3(env, uint8_t, default_value);
+    parsed_result = convert_uint8(env, err, str, default_value, UINT8_MAX);
+    P101_PARSE_EPILOGUE(env);
+}
+
+uint16_t p101_parse_uint16_t(const struct p101_env *env, struct p101_error *err, const char *str, uint16_t default_value)
+{
+    P101_PARSE_PROLOGUE_ARG3(env, uint16_t, default_value);
+    parsed_result = convert_uint16(env, err, str, default_value, UINT16_MAX);
+    P101_PARSE_EPILOGUE(env);
+}
+
+uint32_t p101_parse_uint32_t(const struct p101_env *env, struct p101_error *err, const char *str, uint32_t default_value)
+{
+    P101_PARSE_PROLOGUE_ARG3(env, uint32_t, default_value);
+    parsed_result = convert_uint32(env, err, str, default_value, UINT32_MAX);
+    P101_PARSE_EPILOGUE(env);
+}
+
+uint64_t p101_parse_uint64_t(const struct p101_env *env, struct p101_error *err, const char *str, uint64_t default_value)
+{
+    P101_PARSE_PROLOGUE_ARG3(env, uint64_t, default_value);
+    parsed_result = convert_uint64(env, err, str, default_value, UINT64_MAX);
+    P101_PARSE_EPILOGUE(env);
+}
+
+int8_t p101_parse_negative_int8_t(const struct p101_env *env, struct p101_error *err, const char *str, int8_t default_value)
+{
+    P101_PARSE_PROLOGUE_ARG3(env, int8_t, default_value);
+    parsed_result = convert_int8(env, err, str, default_value, INT8_MIN, -1);
+    P101_PARSE_EPILOGUE(env);
+}
+
+int16_t p101_parse_negative_int16_t(const struct p101_env *env, struct p101_error *err, const char *str, int16_t default_value)
+{
+    P101_PARSE_PROLOGUE_ARG3(env, int16_t, default_value);
+    parsed_result = convert_int16(env, err, str, default_value, INT16_MIN, -1);
+    P101_PARSE_EPILOGUE(env);
+}
+
+int32_t p101_parse_negative_int32_t(const struct p101_env *env, struct p101_error *err, const char *str, int32_t default_value)
+{
+    P101_PARSE_PROLOGUE_ARG3(env, int32_t, default_value);
+    parsed_result = convert_int32(env, err, str, default_value, INT32_MIN, -1);
+    P101_PARSE_EPILOGUE(env);
+}
+
+int64_t p101_parse_negative_int64_t(const struct p101_env *env, struct p101_error *err, const char *str, int64_t default_value)
+{
+    P101_PARSE_PROLOGUE_ARG3(env, int64_t, default_value);
+    parsed_result = convert_int64(env, err, str, default_value, INT64_MIN, -1);
+    P101_PARSE_EPILOGUE(env);
+}
+
+int8_t p101_parse_positive_int8_t(const struct p101_env *env, struct p101_error *err, const char *str, int8_t default_value)
+{
+    P101_PARSE_PROLOGUE_ARG3(env, int8_t, default_value);
+    parsed_result = convert_int8(env, err, str, default_value, 1, INT8_MAX);
+    P101_PARSE_EPILOGUE(env);
+}
+
+int16_t p101_parse_positive_int16_t(const struct p101_env *env, struct p101_error *err, const char *str, int16_t default_value)
+{
+    P101_PARSE_PROLOGUE_ARG3(env, int16_t, default_value);
+    parsed_result = convert_int16(env, err, str, default_value, 1, INT16_MAX);
+    P101_PARSE_EPILOGUE(env);
+}
+
+int32_t p101_parse_positive_int32_t(const struct p101_env *env, struct p101_error *err, const char *str, int32_t default_value)
+{
+    P101_PARSE_PROLOGUE_ARG3(env, int32_t, default_value);
+    parsed_result = convert_int32(env, err, str, default_value, 1, INT32_MAX);
+    P101_PARSE_EPILOGUE(env);
+}
+
+int64_t p101_parse_positive_int64_t(const struct p101_env *env, struct p101_error *err, const char *str, int64_t default_value)
+{
+    P101_PARSE_PROLOGUE_ARG3(env, int64_t, default_value);
+    parsed_result = convert_int64(env, err, str, default_value, 1, INT64_MAX);
+    P101_PARSE_EPILOGUE(env);
+}
+
+char p101_parse_char_n(const struct p101_env *env, struct p101_error *err, const char *str, size_t length, char default_value)
+{
+    P101_PARSE_PROLOGUE_ARG3(env, char, default_value);
+    parsed_result = convert_char_n(env, err, str, length, default_value, CHAR_MIN, CHAR_MAX);
+    P101_PARSE_EPILOGUE(env);
+}
+
+short p101_parse_short_n(const struct p101_env *env, struct p101_error *err, const char *str, size_t length, short default_value)
+{
+    P101_PARSE_PROLOGUE_ARG3(env, short, default_value);
+    parsed_result = convert_short_n(env, err, str, length, default_value, SHRT_MIN, SHRT_MAX);
+    P101_PARSE_EPILOGUE(env);
+}
+
+int p101_parse_int_n(const struct p101_env *env, struct p101_error *err, const char *str, size_t length, int default_value)
+{
+    P101_PARSE_PROLOGUE_ARG3(env, int, default_value);
+    parsed_result = convert_int_n(env, err, str, length, default_value, INT_MIN, INT_MAX);
+    P101_PARSE_EPILOGUE(env);
+}
+
+long p101_parse_long_n(const struct p101_env *env, struct p101_error *err, const char *str, size_t length, long default_value)
+{
+    P101_PARSE_PROLOGUE_ARG3(env, long, default_value);
+    parsed_result = convert_long_n(env, err, str, length, default_value, LONG_MIN, LONG_MAX);
+    P101_PARSE_EPILOGUE(env);
+}
+
+long long p101_parse_long_long_n(const struct p101_env *env, struct p101_error *err, const char *str, size_t length, long long default_value)
+{
+    P101_PARSE_PROLOGUE_ARG3(env, long long, default_value);
+    parsed_result = convert_long_long_n(env, err, str, length, default_value, LLONG_MIN, LLONG_MAX);
+    P101_PARSE_EPILOGUE(env);
+}
+
+unsigned char p101_parse_unsigned_char_n(const struct p101_env *env, struct p101_error *err, const char *str, size_t length, unsigned char default_value)
+{
+    P101_PARSE_PROLOGUE_ARG3(env, unsigned char, default_value);
+    parsed_result = convert_unsigned_char_n(env, err, str, length, default_value, UCHAR_MAX);
+    P101_PARSE_EPILOGUE(env);
+}
+
+unsigned short p101_parse_unsigned_short_n(const struct p101_env *env, struct p101_error *err, const char *str, size_t length, unsigned short default_value)
+{
+    P101_PARSE_PROLOGUE_ARG3(env, unsigned short, default_value);
+    parsed_result = convert_unsigned_short_n(env, err, str, length, default_value, USHRT_MAX);
+    P101_PARSE_EPILOGUE(env);
+}
+
+unsigned int p101_parse_unsigned_int_n(const struct p101_env *env, struct p101_error *err, const char *str, size_t length, unsigned int default_value)
+{
+    P101_PARSE_PROLOGUE_ARG3(env, unsigned int, default_value);
+    parsed_result = convert_unsigned_int_n(env, err, str, length, default_value, UINT_MAX);
+    P101_PARSE_EPILOGUE(env);
+}
+
+unsigned long p101_parse_unsigned_long_n(const struct p101_env *env, struct p101_error *err, const char *str, size_t length, unsigned long default_value)
+{
+    P101_PARSE_PROLOGUE_ARG3(env, unsigned long, default_value);
+    parsed_result = convert_unsigned_long_n(env, err, str, length, default_value, ULONG_MAX);
+    P101_PARSE_EPILOGUE(env);
+}
+
+unsigned long long p101_parse_unsigned_long_long_n(const struct p101_env *env, struct p101_error *err, const char *str, size_t length, unsigned long long default_value)
+{
+    P101_PARSE_PROLOGUE_ARG3(env, unsigned long long, default_value);
+    parsed_result = convert_unsigned_long_long_n(env, err, str, length, default_value, ULLONG_MAX);
+    P101_PARSE_EPILOGUE(env);
+}
+
+signed char p101_parse_negative_char_n(const struct p101_env *env, struct p101_error *err, const char *str, size_t length, signed char default_value)
+{
+    P101_PARSE_PROLOGUE_ARG3(env, signed char, default_value);
+    parsed_result = convert_signed_char_n(env, err, str, length, default_value, SCHAR_MIN, -1);
+    P101_PARSE_EPILOGUE(env);
+}
+
+short p101_parse_negative_short_n(const struct p101_env *env, struct p101_error *err, const char *str, size_t length, short default_value)
+{
+    P101_PARSE_PROLOGUE_ARG3(env, short, default_value);
+    parsed_result = convert_short_n(env, err, str, length, default_value, SHRT_MIN, -1);
+    P101_PARSE_EPILOGUE(env);
+}
+
+int p101_parse_negative_int_n(const struct p101_env *env, struct p101_error *err, const char *str, size_t length, int default_value)
+{
+    P101_PARSE_PROLOGUE_ARG3(env, int, default_value);
+    parsed_result = convert_int_n(env, err, str, length, default_value, INT_MIN, -1);
+    P101_PARSE_EPILOGUE(env);
+}
+
+long p101_parse_negative_long_n(const struct p101_env *env, struct p101_error *err, const char *str, size_t length, long default_value)
+{
+    P101_PARSE_PROLOGUE_ARG3(env, long, default_value);
+    parsed_result = convert_long_n(env, err, str, length, default_value, LONG_MIN, -1L);
+    P101_PARSE_EPILOGUE(env);
+}
+
+long long p101_parse_negative_long_long_n(const struct p101_env *env, struct p101_error *err, const char *str, size_t length, long long default_value)
+{
+    P101_PARSE_PROLOGUE_ARG3(env, long long, default_value);
+    parsed_result = convert_long_long_n(env, err, str, length, default_value, LLONG_MIN, -1LL);
+    P101_PARSE_EPILOGUE(env);
+}
+
+char p101_parse_positive_char_n(const struct p101_env *env, struct p101_error *err, const char *str, size_t length, char default_value)
+{
+    P101_PARSE_PROLOGUE_ARG3(env, char, default_value);
+    parsed_result = convert_char_n(env, err, str, length, default_value, 1, CHAR_MAX);
+    P101_PARSE_EPILOGUE(env);
+}
+
+short p101_parse_positive_short_n(const struct p101_env *env, struct p101_error *err, const char *str, size_t length, short default_value)
+{
+    P101_PARSE_PROLOGUE_ARG3(env, short, default_value);
+    parsed_result = convert_short_n(env, err, str, length, default_value, 1, SHRT_MAX);
+    P101_PARSE_EPILOGUE(env);
+}
+
+int p101_parse_positive_int_n(const struct p101_env *env, struct p101_error *err, const char *str, size_t length, int default_value)
+{
+    P101_PARSE_PROLOGUE_ARG3(env, int, default_value);
+    parsed_result = convert_int_n(env, err, str, length, default_value, 1, INT_MAX);
+    P101_PARSE_EPILOGUE(env);
+}
+
+long p101_parse_positive_long_n(const struct p101_env *env, struct p101_error *err, const char *str, size_t length, long default_value)
+{
+    P101_PARSE_PROLOGUE_ARG3(env, long, default_value);
+    parsed_result = convert_long_n(env, err, str, length, default_value, 1, LONG_MAX);
+    P101_PARSE_EPILOGUE(env);
+}
+
+long long p101_parse_positive_long_long_n(const struct p101_env *env, struct p101_error *err, const char *str, size_t length, long long default_value)
+{
+    P101_PARSE_PROLOGUE_ARG3(env, long long, default_value);
+    parsed_result = convert_long_long_n(env, err, str, length, default_value, 1, LLONG_MAX);
+    P101_PARSE_EPILOGUE(env);
+}
+
+int8_t p101_parse_int8_t_n(const struct p101_env *env, struct p101_error *err, const char *str, size_t length, int8_t default_value)
+{
+    P101_PARSE_PROLOGUE_ARG3(env, int8_t, default_value);
+    parsed_result = convert_int8_n(env, err, str, length, default_value, INT8_MIN, INT8_MAX);
+    P101_PARSE_EPILOGUE(env);
+}
+
+int16_t p101_parse_int16_t_n(const struct p101_env *env, struct p101_error *err, const char *str, size_t length, int16_t default_value)
+{
+    P101_PARSE_PROLOGUE_ARG3(env, int16_t, default_value);
+    parsed_result = convert_int16_n(env, err, str, length, default_value, INT16_MIN, INT16_MAX);
+    P101_PARSE_EPILOGUE(env);
+}
+
+int32_t p101_parse_int32_t_n(const struct p101_env *env, struct p101_error *err, const char *str, size_t length, int32_t default_value)
+{
+    P101_PARSE_PROLOGUE_ARG3(env, int32_t, default_value);
+    parsed_result = convert_int32_n(env, err, str, length, default_value, INT32_MIN, INT32_MAX);
+    P101_PARSE_EPILOGUE(env);
+}
+
+int64_t p101_parse_int64_t_n(const struct p101_env *env, struct p101_error *err, const char *str, size_t length, int64_t default_value)
+{
+    P101_PARSE_PROLOGUE_ARG3(env, int64_t, default_value);
+    parsed_result = convert_int64_n(env, err, str, length, default_value, INT64_MIN, INT64_MAX);
+    P101_PARSE_EPILOGUE(env);
+}
+
+uint8_t p101_parse_uint8_t_n(const struct p101_env *env, struct p101_error *err, const char *str, size_t length, uint8_t default_value)
+{
+    P101_PARSE_PROLOGUE_ARG3(env, uint8_t, default_value);
+    parsed_result = convert_uint8_n(env, err, str, length, default_value, UINT8_MAX);
+    P101_PARSE_EPILOGUE(env);
+}
+
+uint16_t p101_parse_uint16_t_n(const struct p101_env *env, struct p101_error *err, const char *str, size_t length, uint16_t default_value)
+{
+    P101_PARSE_PROLOGUE_ARG3(env, uint16_t, default_value);
+    parsed_result = convert_uint16_n(env, err, str, length, default_value, UINT16_MAX);
+    P101_PARSE_EPILOGUE(env);
+}
+
+uint32_t p101_parse_uint32_t_n(const struct p101_env *env, struct p101_error *err, const char *str, size_t length, uint32_t default_value)
+{
+    P101_PARSE_PROLOGUE_ARG3(env, uint32_t, default_value);
+    parsed_result = convert_uint32_n(env, err, str, length, default_value, UINT32_MAX);
+    P101_PARSE_EPILOGUE(env);
+}
+
+uint64_t p101_parse_uint64_t_n(const struct p101_env *env, struct p101_error *err, const char *str, size_t length, uint64_t default_value)
+{
+    P101_PARSE_PROLOGUE_ARG3(env, uint64_t, default_value);
+    parsed_result = convert_uint64_n(env, err, str, length, default_value, UINT64_MAX);
+    P101_PARSE_EPILOGUE(env);
+}
+
+int8_t p101_parse_negative_int8_t_n(const struct p101_env *env, struct p101_error *err, const char *str, size_t length, int8_t default_value)
+{
+    P101_PARSE_PROLOGUE_ARG3(env, int8_t, default_value);
+    parsed_result = convert_int8_n(env, err, str, length, default_value, INT8_MIN, -1);
+    P101_PARSE_EPILOGUE(env);
+}
+
+int16_t p101_parse_negative_int16_t_n(const struct p101_env *env, struct p101_error *err, const char *str, size_t length, int16_t default_value)
+{
+    P101_PARSE_PROLOGUE_ARG3(env, int16_t, default_value);
+    parsed_result = convert_int16_n(env, err, str, length, default_value, INT16_MIN, -1);
+    P101_PARSE_EPILOGUE(env);
+}
+
+int32_t p101_parse_negative_int32_t_n(const struct p101_env *env, struct p101_error *err, const char *str, size_t length, int32_t default_value)
+{
+    P101_PARSE_PROLOGUE_ARG3(env, int32_t, default_value);
+    parsed_result = convert_int32_n(env, err, str, length, default_value, INT32_MIN, -1);
+    P101_PARSE_EPILOGUE(env);
+}
+
+int64_t p101_parse_negative_int64_t_n(const struct p101_env *env, struct p101_error *err, const char *str, size_t length, int64_t default_value)
+{
+    P101_PARSE_PROLOGUE_ARG3(env, int64_t, default_value);
+    parsed_result = convert_int64_n(env, err, str, length, default_value, INT64_MIN, -1);
+    P101_PARSE_EPILOGUE(env);
+}
+
+int8_t p101_parse_positive_int8_t_n(const struct p101_env *env, struct p101_error *err, const char *str, size_t length, int8_t default_value)
+{
+    P101_PARSE_PROLOGUE_ARG3(env, int8_t, default_value);
+    parsed_result = convert_int8_n(env, err, str, length, default_value, 1, INT8_MAX);
+    P101_PARSE_EPILOGUE(env);
+}
+
+int16_t p101_parse_positive_int16_t_n(const struct p101_env *env, struct p101_error *err, const char *str, size_t length, int16_t default_value)
+{
+    P101_PARSE_PROLOGUE_ARG3(env, int16_t, default_value);
+    parsed_result = convert_int16_n(env, err, str, length, default_value, 1, INT16_MAX);
+    P101_PARSE_EPILOGUE(env);
+}
+
+int32_t p101_parse_positive_int32_t_n(const struct p101_env *env, struct p101_error *err, const char *str, size_t length, int32_t default_value)
+{
+    P101_PARSE_PROLOGUE_ARG3(env, int32_t, default_value);
+    parsed_result = convert_int32_n(env, err, str, length, default_value, 1, INT32_MAX);
+    P101_PARSE_EPILOGUE(env);
+}
+
+int64_t p101_parse_positive_int64_t_n(const struct p101_env *env, struct p101_error *err, const char *str, size_t length, int64_t default_value)
+{
+    P101_PARSE_PROLOGUE_ARG3(env, int64_t, default_value);
+    parsed_result = convert_int64_n(env, err, str, length, default_value, 1, INT64_MAX);
+    P101_PARSE_EPILOGUE(env);
+}
+
+char p101_parse_char_prefix(const struct p101_env *env, struct p101_error *err, const char *str, const char **end, char default_value)
+{
+    P101_PARSE_PROLOGUE_ARG3(env, char, default_value);
+    parsed_result = convert_char_prefix(env, err, str, end, default_value, CHAR_MIN, CHAR_MAX);
+    P101_PARSE_EPILOGUE(env);
+}
+
+short p101_parse_short_prefix(const struct p101_env *env, struct p101_error *err, const char *str, const char **end, short default_value)
+{
+    P101_PARSE_PROLOGUE_ARG3(env, short, default_value);
+    parsed_result = convert_short_prefix(env, err, str, end, default_value, SHRT_MIN, SHRT_MAX);
+    P101_PARSE_EPILOGUE(env);
+}
+
+int p101_parse_int_prefix(const struct p101_env *env, struct p101_error *err, const char *str, const char **end, int default_value)
+{
+    P101_PARSE_PROLOGUE_ARG3(env, int, default_value);
+    parsed_result = convert_int_prefix(env, err, str, end, default_value, INT_MIN, INT_MAX);
+    P101_PARSE_EPILOGUE(env);
+}
+
+long p101_parse_long_prefix(const struct p101_env *env, struct p101_error *err, const char *str, const char **end, long default_value)
+{
+    P101_PARSE_PROLOGUE_ARG3(env, long, default_value);
+    parsed_result = convert_long_prefix(env, err, str, end, default_value, LONG_MIN, LONG_MAX);
+    P101_PARSE_EPILOGUE(env);
+}
+
+long long p101_parse_long_long_prefix(const struct p101_env *env, struct p101_error *err, const char *str, const char **end, long long default_value)
+{
+    P101_PARSE_PROLOGUE_ARG3(env, long long, default_value);
+    parsed_result = convert_long_long_prefix(env, err, str, end, default_value, LLONG_MIN, LLONG_MAX);
+    P101_PARSE_EPILOGUE(env);
+}
+
+unsigned char p101_parse_unsigned_char_prefix(const struct p101_env *env, struct p101_error *err, const char *str, const char **end, unsigned char default_value)
+{
+    P101_PARSE_PROLOGUE_ARG3(env, unsigned char, default_value);
+    parsed_result = convert_unsigned_char_prefix(env, err, str, end, default_value, UCHAR_MAX);
+    P101_PARSE_EPILOGUE(env);
+}
+
+unsigned short p101_parse_unsigned_short_prefix(const struct p101_env *env, struct p101_error *err, const char *str, const char **end, unsigned short default_value)
+{
+    P101_PARSE_PROLOGUE_ARG3(env, unsigned short, default_value);
+    parsed_result = convert_unsigned_short_prefix(env, err, str, end, default_value, USHRT_MAX);
+    P101_PARSE_EPILOGUE(env);
+}
+
+unsigned int p101_parse_unsigned_int_prefix(const struct p101_env *env, struct p101_error *err, const char *str, const char **end, unsigned int default_value)
+{
+    P101_PARSE_PROLOGUE_ARG3(env, unsigned int, default_value);
+    parsed_result = convert_unsigned_int_prefix(env, err, str, end, default_value, UINT_MAX);
+    P101_PARSE_EPILOGUE(env);
+}
+
+unsigned long p101_parse_unsigned_long_prefix(const struct p101_env *env, struct p101_error *err, const char *str, const char **end, unsigned long default_value)
+{
+    P101_PARSE_PROLOGUE_ARG3(env, unsigned long, default_value);
+    parsed_result = convert_unsigned_long_prefix(env, err, str, end, default_value, ULONG_MAX);
+    P101_PARSE_EPILOGUE(env);
+}
+
+unsigned long long p101_parse_unsigned_long_long_prefix(const struct p101_env *env, struct p101_error *err, const char *str, const char **end, unsigned long long default_value)
+{
+    P101_PARSE_PROLOGUE_ARG3(env, unsigned long long, default_value);
+    parsed_result = convert_unsigned_long_long_prefix(env, err, str, end, default_value, ULLONG_MAX);
+    P101_PARSE_EPILOGUE(env);
+}
+
+signed char p101_parse_negative_char_prefix(const struct p101_env *env, struct p101_error *err, const char *str, const char **end, signed char default_value)
+{
+    P101_PARSE_PROLOGUE_ARG3(env, signed char, default_value);
+    parsed_result = convert_signed_char_prefix(env, err, str, end, default_value, SCHAR_MIN, -1);
+    P101_PARSE_EPILOGUE(env);
+}
+
+short p101_parse_negative_short_prefix(const struct p101_env *env, struct p101_error *err, const char *str, const char **end, short default_value)
+{
+    P101_PARSE_PROLOGUE_ARG3(env, short, default_value);
+    parsed_result = convert_short_prefix(env, err, str, end, default_value, SHRT_MIN, -1);
+    P101_PARSE_EPILOGUE(env);
+}
+
+int p101_parse_negative_int_prefix(const struct p101_env *env, struct p101_error *err, const char *str, const char **end, int default_value)
+{
+    P101_PARSE_PROLOGUE_ARG3(env, int, default_value);
+    parsed_result = convert_int_prefix(env, err, str, end, default_value, INT_MIN, -1);
+    P101_PARSE_EPILOGUE(env);
+}
+
+long p101_parse_negative_long_prefix(const struct p101_env *env, struct p101_error *err, const char *str, const char **end, long default_value)
+{
+    P101_PARSE_PROLOGUE_ARG3(env, long, default_value);
+    parsed_result = convert_long_prefix(env, err, str, end, default_value, LONG_MIN, -1L);
+    P101_PARSE_EPILOGUE(env);
+}
+
+long long p101_parse_negative_long_long_prefix(const struct p101_env *env, struct p101_error *err, const char *str, const char **end, long long default_value)
+{
+    P101_PARSE_PROLOGUE_ARG3(env, long long, default_value);
+    parsed_result = convert_long_long_prefix(env, err, str, end, default_value, LLONG_MIN, -1LL);
+    P101_PARSE_EPILOGUE(env);
+}
 
-char p101_parse_char(const struct p101_env *env, struct p101_error *err, const char *str, char default_value)
+char p101_parse_positive_char_prefix(const struct p101_env *env, struct p101_error *err, const char *str, const char **end, char default_value)
 {
     P101_PARSE_PROLOGUE_ARG3(env, char, default_value);
-    parsed_result = convert_char(env, err, str, default_value, CHAR_MIN, CHAR_MAX);
+    parsed_result = convert_char_prefix(env, err, str, end, default_value, 1, CHAR_MAX);
     P101_PARSE_EPILOGUE(env);
 }
 
-short p101_parse_short(const struct p101_env *env, struct p101_error *err, const char *str, short default_value)
+short p101_parse_positive_short_prefix(const struct p101_env *env, struct p101_error *err, const char *str, const char **end, short default_value)
 {
     P101_PARSE_PROLOGUE_ARG3(env, short, default_value);
-    parsed_result = convert_short(env, err, str, default_value, SHRT_MIN, SHRT_MAX);
+    parsed_result = convert_short_prefix(env, err, str, end, default_value, 1, SHRT_MAX);
     P101_PARSE_EPILOGUE(env);
 }
 
-int p101_parse_int(const struct p101_env *env, struct p101_error *err, const char *str, int default_value)
+int p101_parse_positive_int_prefix(const struct p101_env *env, struct p101_error *err, const char *str, const char **end, int default_value)
 {
     P101_PARSE_PROLOGUE_ARG3(env, int, default_value);
-    parsed_result = convert_int(env, err, str, default_value, INT_MIN, INT_MAX);
+    parsed_result = convert_int_prefix(env, err, str, end, default_value, 1, INT_MAX);
     P101_PARSE_EPILOGUE(env);
 }
 
-long p101_parse_long(const struct p101_env *env, struct p101_error *err, const char *str, long default_value)
+long p101_parse_positive_long_prefix(const struct p101_env *env, struct p101_error *err, const char *str, const char **end, long default_value)
 {
     P101_PARSE_PROLOGUE_ARG3(env, long, default_value);
-    parsed_result = convert_long(env, err, str, default_value, LONG_MIN, LONG_MAX);
+    parsed_result = convert_long_prefix(env, err, str, end, default_value, 1, LONG_MAX);
     P101_PARSE_EPILOGUE(env);
 }
 
-long long p101_parse_long_long(const struct p101_env *env, struct p101_error *err, const char *str, long long default_value)
+long long p101_parse_positive_long_long_prefix(const struct p101_env *env, struct p101_error *err, const char *str, const char **end, long long default_value)
 {
     P101_PARSE_PROLOGUE_ARG3(env, long long, default_value);
-    parsed_result = convert_long_long(env, err, str, default_value, LLONG_MIN, LLONG_MAX);
+    parsed_result = convert_long_long_prefix(env, err, str, end, default_value, 1, LLONG_MAX);
     P101_PARSE_EPILOGUE(env);
 }
 
-unsigned char p101_parse_unsigned_char(const struct p101_env *env, struct p101_error *err, const char *str, unsigned char default_value)
+int8_t p101_parse_int8_t_prefix(const struct p101_env *env, struct p101_error *err, const char *str, const char **end, int8_t default_value)
 {
-    P101_PARSE_PROLOGUE_ARG3(env, unsigned char, default_value);
-    parsed_result = convert_unsigned_char(env, err, str, default_value, UCHAR_MAX);
+    P101_PARSE_PROLOGUE_ARG3(env, int8_t, default_value);
+    parsed_result = convert_int8_prefix(env, err, str, end, default_value, INT8_MIN, INT8_MAX);
     P101_PARSE_EPILOGUE(env);
 }
 
-unsigned short p101_parse_unsigned_short(const struct p101_env *env, struct p101_error *err, const char *str, unsigned short default_value)
+int16_t p101_parse_int16_t_prefix(const struct p101_env *env, struct p101_error *err, const char *str, const char **end, int16_t default_value)
 {
-    P101_PARSE_PROLOGUE_ARG3(env, unsigned short, default_value);
-    parsed_result = convert_unsigned_short(env, err, str, default_value, USHRT_MAX);
+    P101_PARSE_PROLOGUE_ARG3(env, int16_t, default_value);
+    parsed_result = convert_int16_prefix(env, err, str, end, default_value, INT16_MIN, INT16_MAX);
     P101_PARSE_EPILOGUE(env);
 }
 
-unsigned int p101_parse_unsigned_int(const struct p101_env *env, struct p101_error *err, const char *str, unsigned int default_value)
+int32_t p101_parse_int32_t_prefix(const struct p101_env *env, struct p101_error *err, const char *str, const char **end, int32_t default_value)
 {
-    P101_PARSE_PROLOGUE_ARG3(env, unsigned int, default_value);
-    parsed_result = convert_unsigned_int(env, err, str, default_value, UINT_MAX);
+    P101_PARSE_PROLOGUE_ARG3(env, int32_t, default_value);
+    parsed_result = convert_int32_prefix(env, err, str, end, default_value, INT32_MIN, INT32_MAX);
     P101_PARSE_EPILOGUE(env);
 }
 
-unsigned long p101_parse_unsigned_long(const struct p101_env *env, struct p101_error *err, const char *str, unsigned long default_value)
+int64_t p101_parse_int64_t_prefix(const struct p101_env *env, struct p101_error *err, const char *str, const char **end, int64_t default_value)
 {
-    P101_PARSE_PROLOGUE_ARG3(env, unsigned long, default_value);
-    parsed_result = convert_unsigned_long(env, err, str, default_value, ULONG_MAX);
+    P101_PARSE_PROLOGUE_ARG3(env, int64_t, default_value);
+    parsed_result = convert_int64_prefix(env, err, str, end, default_value, INT64_MIN, INT64_MAX);
     P101_PARSE_EPILOGUE(env);
 }
 
-unsigned long long p101_parse_unsigned_long_long(const struct p101_env *env, struct p101_error *err, const char *str, unsigned long long default_value)
+uint8_t p101_parse_uint8_t_prefix(const struct p101_env *env, struct p101_error *err, const char *str, const char **end, uint8_t default_value)
 {
-    P101_PARSE_PROLOGUE_ARG3(env, unsigned long long, default_value);
-    parsed_result = convert_unsigned_long_long(env, err, str, default_value, ULLONG_MAX);
+    P101_PARSE_PROLOGUE_ARG3(env, uint8_t, default_value);
+    parsed_result = convert_uint8_prefix(env, err, str, end, default_value, UINT8_MAX);
     P101_PARSE_EPILOGUE(env);
 }
 
-signed char p101_parse_negative_char(const struct p101_env *env, struct p101_error *err, const char *str, signed char default_value)
+uint16_t p101_parse_uint16_t_prefix(const struct p101_env *env, struct p101_error *err, const char *str, const char **end, uint16_t default_value)
 {
-    P101_PARSE_PROLOGUE_ARG3(env, signed char, default_value);
-    parsed_result = convert_signed_char(env, err, str, default_value, SCHAR_MIN, -1);
+    P101_PARSE_PROLOGUE_ARG3(env, uint16_t, default_value);
+    parsed_result = convert_uint16_prefix(env, err, str, end, default_value, UINT16_MAX);
     P101_PARSE_EPILOGUE(env);
 }
 
-short p101_parse_negative_short(const struct p101_env *env, struct p101_error *err, const char *str, short default_value)
+uint32_t p101_parse_uint32_t_prefix(const struct p101_env *env, struct p101_error *err, const char *str, const char **end, uint32_t default_value)
 {
-    P101_PARSE_PROLOGUE_ARG3(env, short, default_value);
-    parsed_result = convert_short(env, err, str, default_value, SHRT_MIN, -1);
+    P101_PARSE_PROLOGUE_ARG3(env, uint32_t, default_value);
+    parsed_result = convert_uint32_prefix(env, err, str, end, default_value, UINT32_MAX);
     P101_PARSE_EPILOGUE(env);
 }
 
-int p101_parse_negative_int(const struct p101_env *env, struct p101_error *err, const char *str, int default_value)
+uint64_t p101_parse_uint64_t_prefix(const struct p101_env *env, struct p101_error *err, const char *str, const char **end, uint64_t default_value)
 {
-    P101_PARSE_PROLOGUE_ARG3(env, int, default_value);
-    parsed_result = convert_int(env, err, str, default_value, INT_MIN, -1);
+    P101_PARSE_PROLOGUE_ARG3(env, uint64_t, default_value);
+    parsed_result = convert_uint64_prefix(env, err, str, end, default_value, UINT64_MAX);
     P101_PARSE_EPILOGUE(env);
 }
 
-long p101_parse_negative_long(const struct p101_env *env, struct p101_error *err, const char *str, long default_value)
+int8_t p101_parse_negative_int8_t_prefix(const struct p101_env *env, struct p101_error *err, const char *str, const char **end, int8_t default_value)
 {
-    P101_PARSE_PROLOGUE_ARG3(env, long, default_value);
-    parsed_result = convert_long(env, err, str, default_value, LONG_MIN, -1L);
+    P101_PARSE_PROLOGUE_ARG3(env, int8_t, default_value);
+    parsed_result = convert_int8_prefix(env, err, str, end, default_value, INT8_MIN, -1);
     P101_PARSE_EPILOGUE(env);
 }
 
-long long p101_parse_negative_long_long(const struct p101_env *env, struct p101_error *err, const char *str, long long default_value)
+int16_t p101_parse_negative_int16_t_prefix(const struct p101_env *env, struct p101_error *err, const char *str, const char **end, int16_t default_value)
 {
-    P101_PARSE_PROLOGUE_ARG3(env, long long, default_value);
-    parsed_result = convert_long_long(env, err, str, default_value, LLONG_MIN, -1LL);
+    P101_PARSE_PROLOGUE_ARG3(env, int16_t, default_value);
+    parsed_result = convert_int16_prefix(env, err, str, end, default_value, INT16_MIN, -1);
     P101_PARSE_EPILOGUE(env);
 }
 
-char p101_parse_positive_char(const struct p101_env *env, struct p101_error *err, const char *str, char default_value)
+int32_t p101_parse_negative_int32_t_prefix(const struct p101_env *env, struct p101_error *err, const char *str, const char **end, int32_t default_value)
 {
-    P101_PARSE_PROLOGUE_ARG3(env, char, default_value);
-    parsed_result = convert_char(env, err, str, default_value, 1, CHAR_MAX);
+    P101_PARSE_PROLOGUE_ARG3(env, int32_t, default_value);
+    parsed_result = convert_int32_prefix(env, err, str, end, default_value, INT32_MIN, -1);
     P101_PARSE_EPILOGUE(env);
 }
 
-short p101_parse_positive_short(const struct p101_env *env, struct p101_error *err, const char *str, short default_value)
+int64_t p101_parse_negative_int64_t_prefix(const struct p101_env *env, struct p101_error *err, const char *str, const char **end, int64_t default_value)
 {
-    P101_PARSE_PROLOGUE_ARG3(env, short, default_value);
-    parsed_result = convert_short(env, err, str, default_value, 1, SHRT_MAX);
+    P101_PARSE_PROLOGUE_ARG3(env, int64_t, default_value);
+    parsed_result = convert_int64_prefix(env, err, str, end, default_value, INT64_MIN, -1);
     P101_PARSE_EPILOGUE(env);
 }
 
-int p101_parse_positive_int(const struct p101_env *env, struct p101_error *err, const char *str, int default_value)
+int8_t p101_parse_positive_int8_t_prefix(const struct p101_env *env, struct p101_error *err, const char *str, const char **end, int8_t default_value)
 {
-    P101_PARSE_PROLOGUE_ARG3(env, int, default_value);
-    parsed_result = convert_int(env, err, str, default_value, 1, INT_MAX);
+    P101_PARSE_PROLOGUE_ARG3(env, int8_t, default_value);
+    parsed_result = convert_int8_prefix(env, err, str, end, default_value, 1, INT8_MAX);
     P101_PARSE_EPILOGUE(env);
 }
 
-long p101_parse_positive_long(const struct p101_env *env, struct p101_error *err, const char *str, long default_value)
+int16_t p101_parse_positive_int16_t_prefix(const struct p101_env *env, struct p101_error *err, const char *str, const char **end, int16_t default_value)
 {
-    P101_PARSE_PROLOGUE_ARG3(env, long, default_value);
-    parsed_result = convert_long(env, err, str, default_value, 1, LONG_MAX);
+    P101_PARSE_PROLOGUE_ARG3(env, int16_t, default_value);
+    parsed_result = convert_int16_prefix(env, err, str, end, default_value, 1, INT16_MAX);
     P101_PARSE_EPILOGUE(env);
 }
 
-long long p101_parse_positive_long_long(const struct p101_env *env, struct p101_error *err, const char *str, long long default_value)
+int32_t p101_parse_positive_int32_t_prefix(const struct p101_env *env, struct p101_error *err, const char *str, const char **end, int32_t default_value)
 {
-    P101_PARSE_PROLOGUE_ARG3(env, long long, default_value);
-    parsed_result = convert_long_long(env, err, str, default_value, 1, LLONG_MAX);
+    P101_PARSE_PROLOGUE_ARG3(env, int32_t, default_value);
+    parsed_result = convert_int32_prefix(env, err, str, end, default_value, 1, INT32_MAX);
     P101_PARSE_EPILOGUE(env);
 }
 
-int8_t p101_parse_int8_t(const struct p101_env *env, struct p101_error *err, const char *str, int8_t default_value)
+int64_t p101_parse_positive_int64_t_prefix(const struct p101_env *env, struct p101_error *err, const char *str, const char **end, int64_t default_value)
+{
+    P101_PARSE_PROLOGUE_ARG3(env, int64_t, default_value);
+    parsed_result = convert_int64_prefix(env, err, str, end, default_value, 1, INT64_MAX);
+    P101_PARSE_EPILOGUE(env);
+}
+
+int8_t p101_parse_int8_t_base(const struct p101_env *env, struct p101_error *err, const char *str, unsigned int base, int8_t default_value)
 {
     P101_PARSE_PROLOGUE_ARG3(env, int8_t, default_value);
-    parsed_result = convert_int8(env, err, str, default_value, INT8_MIN, INT8_MAX);
+    parsed_result = (int8_t)parse_integer_base(env, err, str, base, default_value, INT8_MIN, INT8_MAX);
     P101_PARSE_EPILOGUE(env);
 }
 
-int16_t p101_parse_int16_t(const struct p101_env *env, struct p101_error *err, const char *str, int16_t default_value)
+int16_t p101_parse_int16_t_base(const struct p101_env *env, struct p101_error *err, const char *str, unsigned int base, int16_t default_value)
 {
     P101_PARSE_PROLOGUE_ARG3(env, int16_t, default_value);
-    parsed_result = convert_int16(env, err, str, default_value, INT16_MIN, INT16_MAX);
+    parsed_result = (int16_t)parse_integer_base(env, err, str, base, default_value, INT16_MIN, INT16_MAX);
     P101_PARSE_EPILOGUE(env);
 }
 
-int32_t p101_parse_int32_t(const struct p101_env *env, struct p101_error *err, const char *str, int32_t default_value)
+int32_t p101_parse_int32_t_base(const struct p101_env *env, struct p101_error *err, const char *str, unsigned int base, int32_t default_value)
 {
     P101_PARSE_PROLOGUE_ARG3(env, int32_t, default_value);
-    parsed_result = convert_int32(env, err, str, default_value, INT32_MIN, INT32_MAX);
+    parsed_result = (int32_t)parse_integer_base(env, err, str, base, default_value, INT32_MIN, INT32_MAX);
     P101_PARSE_EPILOGUE(env);
 }
 
-int64_t p101_parse_int64_t(const struct p101_env *env, struct p101_error *err, const char *str, int64_t default_value)
+int64_t p101_parse_int64_t_base(const struct p101_env *env, struct p101_error *err, const char *str, unsigned int base, int64_t default_value)
 {
     P101_PARSE_PROLOGUE_ARG3(env, int64_t, default_value);
-    parsed_result = convert_int64(env, err, str, default_value, INT64_MIN, INT64_MAX);
+    parsed_result = (int64_t)parse_integer_base(env, err, str, base, default_value, INT64_MIN, INT64_MAX);
     P101_PARSE_EPILOGUE(env);
 }
 
-uint8_t p101_parse_uint8_t(const struct p101_env *env, struct p101_error *err, const char *str, uint8_t default_value)
+uint8_t p101_parse_uint8_t_base(const struct p101_env *env, struct p101_error *err, const char *str, unsigned int base, uint8_t default_value)
 {
     P101_PARSE_PROLOGUE_ARG3(env, uint8_t, default_value);
-    parsed_result = convert_uint8(env, err, str, default_value, UINT8_MAX);
+    parsed_result = (uint8_t)parse_unsigned_integer_base(env, err, str, base, default_value, UINT8_MAX);
     P101_PARSE_EPILOGUE(env);
 }
 
-uint16_t p101_parse_uint16_t(const struct p101_env *env, struct p101_error *err, const char *str, uint16_t default_value)
+uint16_t p101_parse_uint16_t_base(const struct p101_env *env, struct p101_error *err, const char *str, unsigned int base, uint16_t default_value)
 {
     P101_PARSE_PROLOGUE_ARG3(env, uint16_t, default_value);
-    parsed_result = convert_uint16(env, err, str, default_value, UINT16_MAX);
+    parsed_result = (uint16_t)parse_unsigned_integer_base(env, err, str, base, default_value, UINT16_MAX);
     P101_PARSE_EPILOGUE(env);
 }
 
-uint32_t p101_parse_uint32_t(const struct p101_env *env, struct p101_error *err, const char *str, uint32_t default_value)
+uint32_t p101_parse_uint32_t_base(const struct p101_env *env, struct p101_error *err, const char *str, unsigned int base, uint32_t default_value)
 {
     P101_PARSE_PROLOGUE_ARG3(env, uint32_t, default_value);
-    parsed_result = convert_uint32(env, err, str, default_value, UINT32_MAX);
+    parsed_result = (uint32_t)parse_unsigned_integer_base(env, err, str, base, default_value, UINT32_MAX);
     P101_PARSE_EPILOGUE(env);
 }
 
-uint64_t p101_parse_uint64_t(const struct p101_env *env, struct p101_error *err, const char *str, uint64_t default_value)
+uint64_t p101_parse_uint64_t_base(const struct p101_env *env, struct p101_error *err, const char *str, unsigned int base, uint64_t default_value)
 {
     P101_PARSE_PROLOGUE_ARG3(env, uint64_t, default_value);
-    parsed_result = convert_uint64(env, err, str, default_value, UINT64_MAX);
+    parsed_result = (uint64_t)parse_unsigned_integer_base(env, err, str, base, default_value, UINT64_MAX);
     P101_PARSE_EPILOGUE(env);
 }
 
-int8_t p101_parse_negative_int8_t(const struct p101_env *env, struct p101_error *err, const char *str, int8_t default_value)
+struct p101_uint128 p101_parse_uint128(const struct p101_env *env, struct p101_error *err, const char *str, struct p101_uint128 default_value)
 {
-    P101_PARSE_PROLOGUE_ARG3(env, int8_t, default_value);
-    parsed_result = convert_int8(env, err, str, default_value, INT8_MIN, -1);
+    P101_PARSE_PROLOGUE_ARG3(env, struct p101_uint128, default_value);
+    parsed_result = parse_wide_integer(env, err, str, BASE_TEN, default_value);
     P101_PARSE_EPILOGUE(env);
 }
 
-int16_t p101_parse_negative_int16_t(const struct p101_env *env, struct p101_error *err, const char *str, int16_t default_value)
+struct p101_uint128 p101_parse_uint128_base(const struct p101_env *env, struct p101_error *err, const char *str, unsigned int base, struct p101_uint128 default_value)
 {
-    P101_PARSE_PROLOGUE_ARG3(env, int16_t, default_value);
-    parsed_result = convert_int16(env, err, str, default_value, INT16_MIN, -1);
+    P101_PARSE_PROLOGUE_ARG3(env, struct p101_uint128, default_value);
+    parsed_result = parse_wide_integer(env, err, str, base, default_value);
     P101_PARSE_EPILOGUE(env);
 }
 
-int32_t p101_parse_negative_int32_t(const struct p101_env *env, struct p101_error *err, const char *str, int32_t default_value)
+bool p101_parse_hex_id(const struct p101_env *env, struct p101_error *err, const char *str, uint8_t *id, size_t size)
 {
-    P101_PARSE_PROLOGUE_ARG3(env, int32_t, default_value);
-    parsed_result = convert_int32(env, err, str, default_value, INT32_MIN, -1);
+    P101_PARSE_PROLOGUE_ARG3(env, bool, false);
+    parsed_result = parse_hex_id(env, err, str, id, size);
     P101_PARSE_EPILOGUE(env);
 }
 
-int64_t p101_parse_negative_int64_t(const struct p101_env *env, struct p101_error *err, const char *str, int64_t default_value)
+uint8_t p101_parse_uint8_t_size(const struct p101_env *env, struct p101_error *err, const char *str, uint8_t default_value)
 {
-    P101_PARSE_PROLOGUE_ARG3(env, int64_t, default_value);
-    parsed_result = convert_int64(env, err, str, default_value, INT64_MIN, -1);
+    P101_PARSE_PROLOGUE_ARG3(env, uint8_t, default_value);
+    parsed_result = (uint8_t)parse_size(env, err, str, default_value, UINT8_MAX);
     P101_PARSE_EPILOGUE(env);
 }
 
-int8_t p101_parse_positive_int8_t(const struct p101_env *env, struct p101_error *err, const char *str, int8_t default_value)
+uint16_t p101_parse_uint16_t_size(const struct p101_env *env, struct p101_error *err, const char *str, uint16_t default_value)
 {
-    P101_PARSE_PROLOGUE_ARG3(env, int8_t, default_value);
-    parsed_result = convert_int8(env, err, str, default_value, 1, INT8_MAX);
+    P101_PARSE_PROLOGUE_ARG3(env, uint16_t, default_value);
+    parsed_result = (uint16_t)parse_size(env, err, str, default_value, UINT16_MAX);
     P101_PARSE_EPILOGUE(env);
 }
 
-int16_t p101_parse_positive_int16_t(const struct p101_env *env, struct p101_error *err, const char *str, int16_t default_value)
+uint32_t p101_parse_uint32_t_size(const struct p101_env *env, struct p101_error *err, const char *str, uint32_t default_value)
 {
-    P101_PARSE_PROLOGUE_ARG3(env, int16_t, default_value);
-    parsed_result = convert_int16(env, err, str, default_value, 1, INT16_MAX);
+    P101_PARSE_PROLOGUE_ARG3(env, uint32_t, default_value);
+    parsed_result = (uint32_t)parse_size(env, err, str, default_value, UINT32_MAX);
     P101_PARSE_EPILOGUE(env);
 }
 
-int32_t p101_parse_positive_int32_t(const struct p101_env *env, struct p101_error *err, const char *str, int32_t default_value)
+uint64_t p101_parse_uint64_t_size(const struct p101_env *env, struct p101_error *err, const char *str, uint64_t default_value)
 {
-    P101_PARSE_PROLOGUE_ARG3(env, int32_t, default_value);
-    parsed_result = convert_int32(env, err, str, default_value, 1, INT32_MAX);
+    P101_PARSE_PROLOGUE_ARG3(env, uint64_t, default_value);
+    parsed_result = (uint64_t)parse_size(env, err, str, default_value, UINT64_MAX);
     P101_PARSE_EPILOGUE(env);
 }
 
-int64_t p101_parse_positive_int64_t(const struct p101_env *env, struct p101_error *err, const char *str, int64_t default_value)
+int64_t p101_parse_duration(const struct p101_env *env, struct p101_error *err, const char *str, int64_t default_value)
 {
     P101_PARSE_PROLOGUE_ARG3(env, int64_t, default_value);
-    parsed_result = convert_int64(env, err, str, default_value, 1, INT64_MAX);
+    if(!parse_duration(env, err, str, &parsed_result))
+    {
+        parsed_result = default_value;
+    }
+    P101_PARSE_EPILOGUE(env);
+}
+
+struct timespec p101_parse_duration_timespec(const struct p101_env *env, struct p101_error *err, const char *str, struct timespec default_value)
+{
+    P101_PARSE_PROLOGUE_ARG3(env, struct timespec, default_value);
+    parsed_result = parse_duration_timespec(env, err, str, default_value);
+    P101_PARSE_EPILOGUE(env);
+}
+
+size_t p101_parse_int8_t_array(const struct p101_env *env, struct p101_error *err, const char *const *strs, size_t count, int8_t *out, uint8_t *status)
+{
+    P101_PARSE_PROLOGUE_ARG3(env, size_t, 0);
+    parsed_result = convert_int8_array(env, err, strs, count, out, status, INT8_MIN, INT8_MAX);
+    P101_PARSE_EPILOGUE(env);
+}
+
+size_t p101_parse_int16_t_array(const struct p101_env *env, struct p101_error *err, const char *const *strs, size_t count, int16_t *out, uint8_t *status)
+{
+    P101_PARSE_PROLOGUE_ARG3(env, size_t, 0);
+    parsed_result = convert_int16_array(env, err, strs, count, out, status, INT16_MIN, INT16_MAX);
+    P101_PARSE_EPILOGUE(env);
+}
+
+size_t p101_parse_int32_t_array(const struct p101_env *env, struct p101_error *err, const char *const *strs, size_t count, int32_t *out, uint8_t *status)
+{
+    P101_PARSE_PROLOGUE_ARG3(env, size_t, 0);
+    parsed_result = convert_int32_array(env, err, strs, count, out, status, INT32_MIN, INT32_MAX);
+    P101_PARSE_EPILOGUE(env);
+}
+
+size_t p101_parse_int64_t_array(const struct p101_env *env, struct p101_error *err, const char *const *strs, size_t count, int64_t *out, uint8_t *status)
+{
+    P101_PARSE_PROLOGUE_ARG3(env, size_t, 0);
+    parsed_result = convert_int64_array(env, err, strs, count, out, status, INT64_MIN, INT64_MAX);
+    P101_PARSE_EPILOGUE(env);
+}
+
+size_t p101_parse_uint8_t_array(const struct p101_env *env, struct p101_error *err, const char *const *strs, size_t count, uint8_t *out, uint8_t *status)
+{
+    P101_PARSE_PROLOGUE_ARG3(env, size_t, 0);
+    parsed_result = convert_uint8_array(env, err, strs, count, out, status, UINT8_MAX);
+    P101_PARSE_EPILOGUE(env);
+}
+
+size_t p101_parse_uint16_t_array(const struct p101_env *env, struct p101_error *err, const char *const *strs, size_t count, uint16_t *out, uint8_t *status)
+{
+    P101_PARSE_PROLOGUE_ARG3(env, size_t, 0);
+    parsed_result = convert_uint16_array(env, err, strs, count, out, status, UINT16_MAX);
+    P101_PARSE_EPILOGUE(env);
+}
+
+size_t p101_parse_uint32_t_array(const struct p101_env *env, struct p101_error *err, const char *const *strs, size_t count, uint32_t *out, uint8_t *status)
+{
+    P101_PARSE_PROLOGUE_ARG3(env, size_t, 0);
+    parsed_result = convert_uint32_array(env, err, strs, count, out, status, UINT32_MAX);
+    P101_PARSE_EPILOGUE(env);
+}
+
+size_t p101_parse_uint64_t_array(const struct p101_env *env, struct p101_error *err, const char *const *strs, size_t count, uint64_t *out, uint8_t *status)
+{
+    P101_PARSE_PROLOGUE_ARG3(env, size_t, 0);
+    parsed_result = convert_uint64_array(env, err, strs, count, out, status, UINT64_MAX);
+    P101_PARSE_EPILOGUE(env);
+}
+
+size_t p101_parse_int64_t_list(const struct p101_env *env, struct p101_error *err, const char *str, const char *delimiters, int64_t *out, size_t capacity)
+{
+    P101_PARSE_PROLOGUE_ARG3(env, size_t, 0);
+    parsed_result = parse_integer_list(env, err, str, delimiters, out, capacity, INT64_MIN, INT64_MAX);
+    P101_PARSE_EPILOGUE(env);
+}
+
+size_t p101_parse_uint64_t_list(const struct p101_env *env, struct p101_error *err, const char *str, const char *delimiters, uint64_t *out, size_t capacity)
+{
+    P101_PARSE_PROLOGUE_ARG3(env, size_t, 0);
+    parsed_result = parse_unsigned_integer_list(env, err, str, delimiters, out, capacity, UINT64_MAX);
+    P101_PARSE_EPILOGUE(env);
+}
+
+#define DEFINE_SIGNED_TRY_CONVERTER(function_name, result_type, min_value, max_value)                                                                                                                                                                              \
+    enum p101_convert_status function_name(const char *str, result_type *value)                                                                                                                                                                                    \
+    {                                                                                                                                                                                                                                                              \
+        intmax_t                 parsed_value;                                                                                                                                                                                                                     \
+        enum p101_convert_status status;                                                                                                                                                                                                                           \
+        if(str == NULL)                                                                                                                                                                                                                                            \
+        {                                                                                                                                                                                                                                                          \
+            return P101_CONVERT_STATUS_SYNTAX;                                                                                                                                                                                                                     \
+        }                                                                                                                                                                                                                                                          \
+        status = check_integer(str, NULL, min_value, max_value, &parsed_value);                                                                                                                                                                                    \
+        if(status == P101_CONVERT_STATUS_OK && value != NULL)                                                                                                                                                                                                      \
+        {                                                                                                                                                                                                                                                          \
+            *value = (result_type)parsed_value;                                                                                                                                                                                                                    \
+        }                                                                                                                                                                                                                                                          \
+        return status;                                                                                                                                                                                                                                             \
+    }
+
+#define DEFINE_UNSIGNED_TRY_CONVERTER(function_name, result_type, max_value)                                                                                                                                                                                       \
+    enum p101_convert_status function_name(const char *str, result_type *value)                                                                                                                                                                                    \
+    {                                                                                                                                                                                                                                                              \
+        uintmax_t                parsed_value;                                                                                                                                                                                                                     \
+        enum p101_convert_status status;                                                                                                                                                                                                                           \
+        if(str == NULL)                                                                                                                                                                                                                                            \
+        {                                                                                                                                                                                                                                                          \
+            return P101_CONVERT_STATUS_SYNTAX;                                                                                                                                                                                                                     \
+        }                                                                                                                                                                                                                                                          \
+        status = check_unsigned_integer(str, NULL, max_value, &parsed_value);                                                                                                                                                                                      \
+        if(status == P101_CONVERT_STATUS_OK && value != NULL)                                                                                                                                                                                                      \
+        {                                                                                                                                                                                                                                                          \
+            *value = (result_type)parsed_value;                                                                                                                                                                                                                    \
+        }                                                                                                                                                                                                                                                          \
+        return status;                                                                                                                                                                                                                                             \
+    }
+
+DEFINE_SIGNED_TRY_CONVERTER(p101_try_parse_char, char, CHAR_MIN, CHAR_MAX)
+DEFINE_SIGNED_TRY_CONVERTER(p101_try_parse_short, short, SHRT_MIN, SHRT_MAX)
+DEFINE_SIGNED_TRY_CONVERTER(p101_try_parse_int, int, INT_MIN, INT_MAX)
+DEFINE_SIGNED_TRY_CONVERTER(p101_try_parse_long, long, LONG_MIN, LONG_MAX)
+DEFINE_SIGNED_TRY_CONVERTER(p101_try_parse_long_long, long long, LLONG_MIN, LLONG_MAX)
+DEFINE_UNSIGNED_TRY_CONVERTER(p101_try_parse_unsigned_char, unsigned char, UCHAR_MAX)
+DEFINE_UNSIGNED_TRY_CONVERTER(p101_try_parse_unsigned_short, unsigned short, USHRT_MAX)
+DEFINE_UNSIGNED_TRY_CONVERTER(p101_try_parse_unsigned_int, unsigned int, UINT_MAX)
+DEFINE_UNSIGNED_TRY_CONVERTER(p101_try_parse_unsigned_long, unsigned long, ULONG_MAX)
+DEFINE_UNSIGNED_TRY_CONVERTER(p101_try_parse_unsigned_long_long, unsigned long long, ULLONG_MAX)
+DEFINE_SIGNED_TRY_CONVERTER(p101_try_parse_negative_char, signed char, SCHAR_MIN, -1)
+DEFINE_SIGNED_TRY_CONVERTER(p101_try_parse_negative_short, short, SHRT_MIN, -1)
+DEFINE_SIGNED_TRY_CONVERTER(p101_try_parse_negative_int, int, INT_MIN, -1)
+DEFINE_SIGNED_TRY_CONVERTER(p101_try_parse_negative_long, long, LONG_MIN, -1L)
+DEFINE_SIGNED_TRY_CONVERTER(p101_try_parse_negative_long_long, long long, LLONG_MIN, -1LL)
+DEFINE_SIGNED_TRY_CONVERTER(p101_try_parse_positive_char, char, 1, CHAR_MAX)
+DEFINE_SIGNED_TRY_CONVERTER(p101_try_parse_positive_short, short, 1, SHRT_MAX)
+DEFINE_SIGNED_TRY_CONVERTER(p101_try_parse_positive_int, int, 1, INT_MAX)
+DEFINE_SIGNED_TRY_CONVERTER(p101_try_parse_positive_long, long, 1, LONG_MAX)
+DEFINE_SIGNED_TRY_CONVERTER(p101_try_parse_positive_long_long, long long, 1, LLONG_MAX)
+DEFINE_SIGNED_TRY_CONVERTER(p101_try_parse_int8_t, int8_t, INT8_MIN, INT8_MAX)
+DEFINE_SIGNED_TRY_CONVERTER(p101_try_parse_int16_t, int16_t, INT16_MIN, INT16_MAX)
+DEFINE_SIGNED_TRY_CONVERTER(p101_try_parse_int32_t, int32_t, INT32_MIN, INT32_MAX)
+DEFINE_SIGNED_TRY_CONVERTER(p101_try_parse_int64_t, int64_t, INT64_MIN, INT64_MAX)
+DEFINE_UNSIGNED_TRY_CONVERTER(p101_try_parse_uint8_t, uint8_t, UINT8_MAX)
+DEFINE_UNSIGNED_TRY_CONVERTER(p101_try_parse_uint16_t, uint16_t, UINT16_MAX)
+DEFINE_UNSIGNED_TRY_CONVERTER(p101_try_parse_uint32_t, uint32_t, UINT32_MAX)
+DEFINE_UNSIGNED_TRY_CONVERTER(p101_try_parse_uint64_t, uint64_t, UINT64_MAX)
+DEFINE_SIGNED_TRY_CONVERTER(p101_try_parse_negative_int8_t, int8_t, INT8_MIN, -1)
+DEFINE_SIGNED_TRY_CONVERTER(p101_try_parse_negative_int16_t, int16_t, INT16_MIN, -1)
+DEFINE_SIGNED_TRY_CONVERTER(p101_try_parse_negative_int32_t, int32_t, INT32_MIN, -1)
+DEFINE_SIGNED_TRY_CONVERTER(p101_try_parse_negative_int64_t, int64_t, INT64_MIN, -1)
+DEFINE_SIGNED_TRY_CONVERTER(p101_try_parse_positive_int8_t, int8_t, 1, INT8_MAX)
+DEFINE_SIGNED_TRY_CONVERTER(p101_try_parse_positive_int16_t, int16_t, 1, INT16_MAX)
+DEFINE_SIGNED_TRY_CONVERTER(p101_try_parse_positive_int32_t, int32_t, 1, INT32_MAX)
+DEFINE_SIGNED_TRY_CONVERTER(p101_try_parse_positive_int64_t, int64_t, 1, INT64_MAX)
+
+#undef DEFINE_UNSIGNED_TRY_CONVERTER
+#undef DEFINE_SIGNED_TRY_CONVERTER
+
+size_t p101_format_char(const struct p101_env *env, struct p101_error *err, char value, char *buffer, size_t size)
+{
+    P101_PARSE_PROLOGUE_ARG3(env, size_t, 0);
+    parsed_result = format_integer(env, err, value, buffer, size);
+    P101_PARSE_EPILOGUE(env);
+}
+
+size_t p101_format_short(const struct p101_env *env, struct p101_error *err, short value, char *buffer, size_t size)
+{
+    P101_PARSE_PROLOGUE_ARG3(env, size_t, 0);
+    parsed_result = format_integer(env, err, value, buffer, size);
+    P101_PARSE_EPILOGUE(env);
+}
+
+size_t p101_format_int(const struct p101_env *env, struct p101_error *err, int value, char *buffer, size_t size)
+{
+    P101_PARSE_PROLOGUE_ARG3(env, size_t, 0);
+    parsed_result = format_integer(env, err, value, buffer, size);
+    P101_PARSE_EPILOGUE(env);
+}
+
+size_t p101_format_long(const struct p101_env *env, struct p101_error *err, long value, char *buffer, size_t size)
+{
+    P101_PARSE_PROLOGUE_ARG3(env, size_t, 0);
+    parsed_result = format_integer(env, err, value, buffer, size);
+    P101_PARSE_EPILOGUE(env);
+}
+
+size_t p101_format_long_long(const struct p101_env *env, struct p101_error *err, long long value, char *buffer, size_t size)
+{
+    P101_PARSE_PROLOGUE_ARG3(env, size_t, 0);
+    parsed_result = format_integer(env, err, value, buffer, size);
+    P101_PARSE_EPILOGUE(env);
+}
+
+size_t p101_format_signed_char(const struct p101_env *env, struct p101_error *err, signed char value, char *buffer, size_t size)
+{
+    P101_PARSE_PROLOGUE_ARG3(env, size_t, 0);
+    parsed_result = format_integer(env, err, value, buffer, size);
+    P101_PARSE_EPILOGUE(env);
+}
+
+size_t p101_format_unsigned_char(const struct p101_env *env, struct p101_error *err, unsigned char value, char *buffer, size_t size)
+{
+    P101_PARSE_PROLOGUE_ARG3(env, size_t, 0);
+    parsed_result = format_unsigned_integer(env, err, value, buffer, size);
+    P101_PARSE_EPILOGUE(env);
+}
+
+size_t p101_format_unsigned_short(const struct p101_env *env, struct p101_error *err, unsigned short value, char *buffer, size_t size)
+{
+    P101_PARSE_PROLOGUE_ARG3(env, size_t, 0);
+    parsed_result = format_unsigned_integer(env, err, value, buffer, size);
+    P101_PARSE_EPILOGUE(env);
+}
+
+size_t p101_format_unsigned_int(const struct p101_env *env, struct p101_error *err, unsigned int value, char *buffer, size_t size)
+{
+    P101_PARSE_PROLOGUE_ARG3(env, size_t, 0);
+    parsed_result = format_unsigned_integer(env, err, value, buffer, size);
+    P101_PARSE_EPILOGUE(env);
+}
+
+size_t p101_format_unsigned_long(const struct p101_env *env, struct p101_error *err, unsigned long value, char *buffer, size_t size)
+{
+    P101_PARSE_PROLOGUE_ARG3(env, size_t, 0);
+    parsed_result = format_unsigned_integer(env, err, value, buffer, size);
+    P101_PARSE_EPILOGUE(env);
+}
+
+size_t p101_format_unsigned_long_long(const struct p101_env *env, struct p101_error *err, unsigned long long value, char *buffer, size_t size)
+{
+    P101_PARSE_PROLOGUE_ARG3(env, size_t, 0);
+    parsed_result = format_unsigned_integer(env, err, value, buffer, size);
+    P101_PARSE_EPILOGUE(env);
+}
+
+size_t p101_format_int8_t(const struct p101_env *env, struct p101_error *err, int8_t value, char *buffer, size_t size)
+{
+    P101_PARSE_PROLOGUE_ARG3(env, size_t, 0);
+    parsed_result = format_integer(env, err, value, buffer, size);
+    P101_PARSE_EPILOGUE(env);
+}
+
+size_t p101_format_int16_t(const struct p101_env *env, struct p101_error *err, int16_t value, char *buffer, size_t size)
+{
+    P101_PARSE_PROLOGUE_ARG3(env, size_t, 0);
+    parsed_result = format_integer(env, err, value, buffer, size);
+    P101_PARSE_EPILOGUE(env);
+}
+
+size_t p101_format_int32_t(const struct p101_env *env, struct p101_error *err, int32_t value, char *buffer, size_t size)
+{
+    P101_PARSE_PROLOGUE_ARG3(env, size_t, 0);
+    parsed_result = format_integer(env, err, value, buffer, size);
+    P101_PARSE_EPILOGUE(env);
+}
+
+size_t p101_format_int64_t(const struct p101_env *env, struct p101_error *err, int64_t value, char *buffer, size_t size)
+{
+    P101_PARSE_PROLOGUE_ARG3(env, size_t, 0);
+    parsed_result = format_integer(env, err, value, buffer, size);
+    P101_PARSE_EPILOGUE(env);
+}
+
+size_t p101_format_uint8_t(const struct p101_env *env, struct p101_error *err, uint8_t value, char *buffer, size_t size)
+{
+    P101_PARSE_PROLOGUE_ARG3(env, size_t, 0);
+    parsed_result = format_unsigned_integer(env, err, value, buffer, size);
+    P101_PARSE_EPILOGUE(env);
+}
+
+size_t p101_format_uint16_t(const struct p101_env *env, struct p101_error *err, uint16_t value, char *buffer, size_t size)
+{
+    P101_PARSE_PROLOGUE_ARG3(env, size_t, 0);
+    parsed_result = format_unsigned_integer(env, err, value, buffer, size);
+    P101_PARSE_EPILOGUE(env);
+}
+
+size_t p101_format_uint32_t(const struct p101_env *env, struct p101_error *err, uint32_t value, char *buffer, size_t size)
+{
+    P101_PARSE_PROLOGUE_ARG3(env, size_t, 0);
+    parsed_result = format_unsigned_integer(env, err, value, buffer, size);
+    P101_PARSE_EPILOGUE(env);
+}
+
+size_t p101_format_uint64_t(const struct p101_env *env, struct p101_error *err, uint64_t value, char *buffer, size_t size)
+{
+    P101_PARSE_PROLOGUE_ARG3(env, size_t, 0);
+    parsed_result = format_unsigned_integer(env, err, value, buffer, size);
     P101_PARSE_EPILOGUE(env);
 }
 
@@ -0,0 +1,871 @@
+/*
+ * Copyright 2024-2024 D'Arcy Smith.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "instrumentation.h"
+#include "p101_convert/errors.h"
+#include <netinet/in.h>
+#include <p101_c/p101_string.h>
+#include <p101_convert/lpm.h>
+#include <p101_convert/networking.h>
+#include <p101_env/wrapper.h>
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <sys/socket.h>
+
+#if defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__))
+    #define P101_CONVERT_POPCNT_LOOKUP
+#endif
+
+#ifdef __GNUC__
+    #define LPM_ALWAYS_INLINE __attribute__((always_inline)) inline
+#else
+    #define LPM_ALWAYS_INLINE inline
+#endif
+
+enum
+{
+    LPM_DIRECT_BITS   = 16U,
+    LPM_DIRECT_SLOTS  = 1U << LPM_DIRECT_BITS,
+    LPM_STRIDE        = 6U,
+    LPM_NODE_SLOTS    = 1U << LPM_STRIDE,
+    LPM_SLOT_MASK     = LPM_NODE_SLOTS - 1U,
+    LPM_WORD_BITS     = 64U,
+    LPM_SLOT_SHIFT    = LPM_WORD_BITS - LPM_STRIDE,
+    LPM_INDEX_BITS    = 31U,
+    IPV4_ADDRESS_SIZE = 4U,
+    IPV6_ADDRESS_SIZE = 16U,
+    IPV4_PREFIX_MAX   = 32U,
+    IPV6_PREFIX_MAX   = 128U,
+    BITS_PER_BYTE     = 8U,
+    BYTES_PER_WORD    = 8U
+};
+
+// Direct-table entries with this bit set are leaves; the rest index a node.
+// Leaf values are a prefix index plus one, with zero for no match, so both
+// they and node indices must stay below it.
+#define LPM_LEAF UINT32_C(0x80000000)
+#define LPM_MAX_PREFIXES (LPM_LEAF - 2U)
+
+/*
+ * The table is a poptrie (Asai and Ohara, SIGCOMM 2015). The first 16 bits
+ * of an address index a direct table; each node below that consumes six more
+ * bits, one of 64 slots. vector marks the slots that continue into a child
+ * node and leafvec the slots that start a new run of equal leaves, so a node
+ * stores its children and its distinct leaves densely and a popcount of the
+ * bits up to the slot finds either one. A lookup is one direct-table load
+ * plus one 24-byte node per six bits that the longest prefix under the
+ * address needs: two for a /24 or /32.
+ */
+struct lpm_node
+{
+    uint64_t vector;
+    uint64_t leafvec;
+    uint32_t base0;
+    uint32_t base1;
+};
+
+struct p101_lpm
+{
+    const uint32_t        *ipv4;
+    const uint32_t        *ipv6;
+    const struct lpm_node *nodes;
+    const uint32_t        *leaves;
+};
+
+// What p101_lpm_size() works out once and p101_lpm_build() carves up.
+struct lpm_layout
+{
+    size_t ipv4_count;
+    size_t node_bound;
+    size_t leaf_bound;
+    size_t size;
+};
+
+struct lpm_builder
+{
+    const struct p101_cidr *prefixes;
+    const uint32_t         *order;
+    struct lpm_node        *nodes;
+    uint32_t               *leaves;
+    uint32_t                node_count;
+    uint32_t                leaf_count;
+};
+
+static LPM_ALWAYS_INLINE unsigned int count_bits(uint64_t word);
+static unsigned int                   address_size(const struct p101_cidr *prefix);
+static void                           load_bits(const uint8_t *bytes, size_t size, uint64_t *high, uint64_t *low);
+static LPM_ALWAYS_INLINE unsigned int slot_at(uint64_t high, uint64_t low, unsigned int depth);
+static bool                           has_host_bits(const struct p101_cidr *prefix);
+static bool                           add_bytes(size_t *size, size_t count, size_t each);
+static size_t                         node_bound(const size_t *lengths, unsigned int max_length);
+static bool                           plan_layout(const struct p101_env *env, struct p101_error *err, const struct p101_cidr *prefixes, size_t count, struct lpm_layout *layout);
+static int                            compare_prefixes(const struct p101_cidr *prefixes, uint32_t left, uint32_t right);
+static uint32_t                      *sort_prefixes(const struct p101_cidr *prefixes, size_t count, uint32_t *order, uint32_t *scratch);
+static void                           fill_node(const struct p101_env *env, struct lpm_builder *builder, uint32_t node, size_t first, size_t last, unsigned int depth, uint32_t inherited);
+static void                           fill_direct(const struct p101_env *env, struct lpm_builder *builder, uint32_t *direct, size_t first, size_t last);
+static const struct p101_lpm         *build_table(const struct p101_env *env, struct p101_error *err, const struct p101_cidr *prefixes, size_t count, void *memory, size_t size);
+static LPM_ALWAYS_INLINE uint32_t     walk_table(const struct p101_lpm *lpm, const uint32_t *direct, uint64_t high, uint64_t low);
+#ifdef P101_CONVERT_POPCNT_LOOKUP
+static bool                           have_popcnt(void);
+static uint32_t                       walk_table_popcnt(const struct p101_lpm *lpm, const uint32_t *direct, uint64_t high, uint64_t low);
+#endif
+static size_t                         lookup_bits(const struct p101_lpm *lpm, const uint32_t *direct, uint64_t high, uint64_t low);
+static size_t                         lookup_address(const struct p101_env *env, struct p101_error *err, const struct p101_lpm *lpm, const struct sockaddr *addr);
+static size_t                         lookup_compact(const struct p101_env *env, struct p101_error *err, const struct p101_lpm *lpm, const struct p101_compact_address *address);
+
+static LPM_ALWAYS_INLINE unsigned int count_bits(uint64_t word)
+{
+#ifdef __GNUC__
+    return (unsigned int)__builtin_popcountll(word);
+#else
+    unsigned int bits;
+
+    for(bits = 0; word != 0U; bits++)
+    {
+        word &= word - 1U;
+    }
+
+    return bits;
+#endif
+}
+
+static unsigned int address_size(const struct p101_cidr *prefix)
+{
+    return prefix->network.family == P101_COMPACT_ADDRESS_IPV4 ? IPV4_ADDRESS_SIZE : IPV6_ADDRESS_SIZE;
+}
+
+// An address as a 128-bit big-endian number split into two words, IPv4 in
+// the top 32 bits. Every bit past the address reads as zero.
+static void load_bits(const uint8_t *bytes, size_t size, uint64_t *high, uint64_t *low)
+{
+    uint64_t words[2];
+
+    words[0] = 0;
+    words[1] = 0;
+    for(size_t i = 0; i < size; i++)
+    {
+        words[i / BYTES_PER_WORD] |= (uint64_t)bytes[i] << (LPM_WORD_BITS - BITS_PER_BYTE - ((i % BYTES_PER_WORD) * BITS_PER_BYTE));
+    }
+
+    *high = words[0];
+    *low  = words[1];
+}
+
+// The six bits at depth. Node depths are 16 + 6k, so a stride never straddles
+// the two words; the last IPv4 and IPv6 strides run two bits past the
+// address and read them as zero.
+static LPM_ALWAYS_INLINE unsigned int slot_at(uint64_t high, uint64_t low, unsigned int depth)
+{
+    if(depth < LPM_WORD_BITS)
+    {
+        return (unsigned int)(high >> (LPM_SLOT_SHIFT - depth)) & LPM_SLOT_MASK;
+    }
+
+    depth -= LPM_WORD_BITS;
+    if(depth <= LPM_SLOT_SHIFT)
+    {
+        return (unsigned int)(low >> (LPM_SLOT_SHIFT - depth)) & LPM_SLOT_MASK;
+    }
+
+    return (unsigned int)(low << (depth - LPM_SLOT_SHIFT)) & LPM_SLOT_MASK;
+}
+
+static bool has_host_bits(const struct p101_cidr *prefix)
+{
+    const uint8_t *bytes;
+    unsigned int   size;
+    unsigned int   length;
+    uint8_t        set;
+
+    bytes  = prefix->network.address;
+    size   = address_size(prefix);
+    length = prefix->prefix_length;
+    set    = 0;
+    for(unsigned int i = length / BITS_PER_BYTE; i < size; i++)
+    {
+        set |= bytes[i];
+        if(i == length / BITS_PER_BYTE)
+        {
+            set = (uint8_t)(set & (UINT8_MAX >> (length % BITS_PER_BYTE)));
+        }
+    }
+
+    return set != 0U;
+}
+
+static bool add_bytes(size_t *size, size_t count, size_t each)
+{
+    if(count != 0U && each > (SIZE_MAX - *size) / count)
+    {
+        return false;
+    }
+
+    *size += count * each;
+    return true;
+}
+
+// A node at depth d exists for each distinct d-bit network with a longer
+// prefix under it, so there are no more than 2^d of them and no more than
+// there are prefixes longer than d.
+static size_t node_bound(const size_t *lengths, unsigned int max_length)
+{
+    size_t bound;
+
+    bound = 0;
+    for(unsigned int depth = LPM_DIRECT_BITS; depth < max_length; depth += LPM_STRIDE)
+    {
+        size_t longer;
+
+        longer = 0;
+        for(unsigned int length = depth + 1U; length <= max_length; length++)
+        {
+            longer += lengths[length];
+        }
+        if(depth < LPM_INDEX_BITS && longer > ((size_t)1 << depth))
+        {
+            longer = (size_t)1 << depth;
+        }
+        bound += longer;
+    }
+
+    return bound;
+}
+
+/*
+ * Validate the prefixes and size the buffer: a header, a direct table for
+ * each family present, the bounds on nodes and leaves, and two index arrays
+ * for sorting. A node paints at most k prefixes of its own over the value it
+ * inherits, which leaves at most 2k + 1 runs, so there are at most two leaves
+ * per prefix plus one per node.
+ */
+static bool plan_layout(const struct p101_env *env, struct p101_error *err, const struct p101_cidr *prefixes, size_t count, struct lpm_layout *layout)
+{
+    size_t ipv4_lengths[IPV4_PREFIX_MAX + 1U];
+    size_t ipv6_lengths[IPV6_PREFIX_MAX + 1U];
+    size_t directs;
+    size_t size;
+    bool   ret_val;
+    bool   has_error;
+
+    P101_TRACE(env);
+    ret_val = false;
+    if(prefixes == NULL && count != 0U)
+    {
+        P101_ERROR_RAISE_CHECK(err);
+        goto done;
+    }
+    has_error = p101_error_has_error(err);
+    if(has_error)
+    {
+        goto done;
+    }
+
+    if(count > LPM_MAX_PREFIXES)
+    {
+        P101_ERROR_RAISE_USER(err, "There are too many prefixes for one table.", P101_CONVERT_ERROR_RANGE);
+        goto done;
+    }
+
+    p101_memset(env, ipv4_lengths, 0, sizeof(ipv4_lengths));
+    p101_memset(env, ipv6_lengths, 0, sizeof(ipv6_lengths));
+    layout->ipv4_count = 0;
+    for(size_t i = 0; i < count; i++)
+    {
+        const struct p101_cidr *prefix;
+
+        prefix = &prefixes[i];
+        if(prefix->network.family == P101_COMPACT_ADDRESS_IPV4 && prefix->prefix_length <= IPV4_PREFIX_MAX)
+        {
+            ipv4_lengths[prefix->prefix_length]++;
+            layout->ipv4_count++;
+        }
+        else if(prefix->network.family == P101_COMPACT_ADDRESS_IPV6 && prefix->prefix_length <= IPV6_PREFIX_MAX)
+        {
+            ipv6_lengths[prefix->prefix_length]++;
+        }
+        else
+        {
+            P101_ERROR_RAISE_USER(err, "The prefix is not an IPv4 or IPv6 network with a valid length.", P101_CONVERT_ERROR_ADDRESS);
+            goto done;
+        }
+
+        if(has_host_bits(prefix))
+        {
+            P101_ERROR_RAISE_USER(err, "The prefix has bits set past its length.", P101_CONVERT_ERROR_ADDRESS);
+            goto done;
+        }
+    }
+
+    layout->node_bound = node_bound(ipv4_lengths, IPV4_PREFIX_MAX) + node_bound(ipv6_lengths, IPV6_PREFIX_MAX);
+    layout->leaf_bound = (2U * count) + layout->node_bound;
+    directs            = (size_t)(layout->ipv4_count != 0U) + (size_t)(layout->ipv4_count != count);
+    size               = ((sizeof(struct p101_lpm) + sizeof(uint64_t) - 1U) / sizeof(uint64_t)) * sizeof(uint64_t);
+    if(layout->node_bound >= LPM_LEAF || layout->leaf_bound > UINT32_MAX || !add_bytes(&size, directs, LPM_DIRECT_SLOTS * sizeof(uint32_t)) ||
+       !add_bytes(&size, layout->node_bound, sizeof(struct lpm_node)) || !add_bytes(&size, layout->leaf_bound, sizeof(uint32_t)) || !add_bytes(&size, 2U * count, sizeof(uint32_t)))
+    {
+        P101_ERROR_RAISE_USER(err, "There are too many prefixes for one table.", P101_CONVERT_ERROR_RANGE);
+        goto done;
+    }
+
+    layout->size = size;
+    ret_val      = true;
+
+done:
+    P101_TRACE_EXIT(env);
+    return ret_val;
+}
+
+// Family, then address, then shorter first, so every prefix comes after the
+// ones that contain it. Among duplicates the first is sorted behind the
+// rest, so it is painted on top and wins.
+static int compare_prefixes(const struct p101_cidr *prefixes, uint32_t left, uint32_t right)
+{
+    const struct p101_cidr *a;
+    const struct p101_cidr *b;
+
+    a = &prefixes[left];
+    b = &prefixes[right];
+    if(a->network.family != b->network.family)
+    {
+        return a->network.family < b->network.family ? -1 : 1;
+    }
+
+    for(unsigned int i = 0; i < address_size(a); i++)
+    {
+        if(a->network.address[i] != b->network.address[i])
+        {
+            return a->network.address[i] < b->network.address[i] ? -1 : 1;
+        }
+    }
+
+    if(a->prefix_length != b->prefix_length)
+    {
+        return a->prefix_length < b->prefix_length ? -1 : 1;
+    }
+
+    return left < right ? 1 : -1;
+}
+
+// Bottom-up merge sort of prefix indices, ping-ponging between order and
+// scratch; returns whichever holds the result.
+static uint32_t *sort_prefixes(const struct p101_cidr *prefixes, size_t count, uint32_t *order, uint32_t *scratch)
+{
+    for(size_t i = 0; i < count; i++)
+    {
+        order[i] = (uint32_t)i;
+    }
+
+    for(size_t width = 1; width < count; width *= 2U)
+    {
+        uint32_t *swap;
+
+        for(size_t first = 0; first < count; first += 2U * width)
+        {
+            size_t middle;
+            size_t last;
+            size_t left;
+            size_t right;
+            size_t out;
+
+            middle = first + width < count ? first + width : count;
+            last   = middle + width < count ? middle + width : count;
+            left   = first;
+            right  = middle;
+            for(out = first; out < last; out++)
+            {
+                if(left < middle && (right >= last || compare_prefixes(prefixes, order[left], order[right]) <= 0))
+                {
+                    scratch[out] = order[left++];
+                }
+                else
+                {
+                    scratch[out] = order[right++];
+                }
+            }
+        }
+
+        swap    = order;
+        order   = scratch;
+        scratch = swap;
+    }
+
+    return order;
+}
+
+/*
+ * Fill node from the sorted prefixes [first, last), which all fall under it.
+ * Those no longer than depth are already part of inherited. The ones that end
+ * within this stride are painted over their slots in sorted order, so a more
+ * specific prefix always lands on top of the one containing it; the longer
+ * ones turn their slot into a child. Children are allocated as one block
+ * before any of them is filled, which is what lets the parent find them by
+ * rank.
+ */
+static void fill_node(const struct p101_env *env, struct lpm_builder *builder, uint32_t node, size_t first, size_t last, unsigned int depth, uint32_t inherited)
+{
+    uint32_t values[LPM_NODE_SLOTS];
+    uint64_t vector;
+    uint64_t leafvec;
+    uint32_t base0;
+    uint32_t base1;
+    uint32_t child;
+    size_t   cursor;
+
+    P101_TRACE(env);
+    vector = 0;
+    for(unsigned int slot = 0; slot < LPM_NODE_SLOTS; slot++)
+    {
+        values[slot] = inherited;
+    }
+
+    for(size_t i = first; i < last; i++)
+    {
+        const struct p101_cidr *prefix;
+        uint64_t                high;
+        uint64_t                low;
+        unsigned int            slot;
+
+        prefix = &builder->prefixes[builder->order[i]];
+        if(prefix->prefix_length <= depth)
+        {
+            continue;
+        }
+
+        load_bits(prefix->network.address, address_size(prefix), &high, &low);
+        slot = slot_at(high, low, depth);
+        if(prefix->prefix_length > depth + LPM_STRIDE)
+        {
+            vector |= UINT64_C(1) << slot;
+            continue;
+        }
+
+        for(unsigned int span = 1U << (depth + LPM_STRIDE - prefix->prefix_length); span > 0U; span--)
+        {
+            values[slot++] = builder->order[i] + 1U;
+        }
+    }
+
+    base1 = builder->node_count;
+    builder->node_count += count_bits(vector);
+    base0   = builder->leaf_count;
+    leafvec = 0;
+    for(unsigned int slot = 0; slot < LPM_NODE_SLOTS; slot++)
+    {
+        if((vector & (UINT64_C(1) << slot)) != 0U)
+        {
+            continue;
+        }
+
+        if(builder->leaf_count == base0 || values[slot] != builder->leaves[builder->leaf_count - 1U])
+        {
+            leafvec |= UINT64_C(1) << slot;
+            builder->leaves[builder->leaf_count++] = values[slot];
+        }
+    }
+
+    builder->nodes[node].vector  = vector;
+    builder->nodes[node].leafvec = leafvec;
+    builder->nodes[node].base0   = base0;
+    builder->nodes[node].base1   = base1;
+
+    child  = base1;
+    cursor = first;
+    while(cursor < last)
+    {
+        const struct p101_cidr *prefix;
+        uint64_t                high;
+        uint64_t                low;
+        unsigned int            slot;
+        size_t                  end;
+
+        prefix = &builder->prefixes[builder->order[cursor]];
+        if(prefix->prefix_length <= depth + LPM_STRIDE)
+        {
+            cursor++;
+            continue;
+        }
+
+        load_bits(prefix->network.address, address_size(prefix), &high, &low);
+        slot = slot_at(high, low, depth);
+        for(end = cursor + 1U; end < last; end++)
+        {
+            prefix = &builder->prefixes[builder->order[end]];
+            load_bits(prefix->network.address, address_size(prefix), &high, &low);
+            if(slot_at(high, low, depth) != slot)
+            {
+                break;
+            }
+        }
+
+        fill_node(env, builder, child++, cursor, end, depth + LPM_STRIDE, values[slot]);
+        cursor = end;
+    }
+
+    P101_TRACE_EXIT(env);
+}
+
+// The direct table is a 2^16-slot node without compression: prefixes up to
+// /16 are painted straight into it and each slot under a longer one gets a
+// node of its own.
+static void fill_direct(const struct p101_env *env, struct lpm_builder *builder, uint32_t *direct, size_t first, size_t last)
+{
+    size_t   cursor;
+    uint32_t node;
+
+    P101_TRACE(env);
+    for(unsigned int slot = 0; slot < LPM_DIRECT_SLOTS; slot++)
+    {
+        direct[slot] = LPM_LEAF;
+    }
+
+    for(size_t i = first; i < last; i++)
+    {
+        const struct p101_cidr *prefix;
+        uint64_t                high;
+        uint64_t                low;
+        uint32_t                slot;
+
+        prefix = &builder->prefixes[builder->order[i]];
+        if(prefix->prefix_length > LPM_DIRECT_BITS)
+        {
+            continue;
+        }
+
+        load_bits(prefix->network.address, address_size(prefix), &high, &low);
+        slot = (uint32_t)(high >> (LPM_WORD_BITS - LPM_DIRECT_BITS));
+        for(uint32_t span = UINT32_C(1) << (LPM_DIRECT_BITS - prefix->prefix_length); span > 0U; span--)
+        {
+            direct[slot++] = LPM_LEAF | (builder->order[i] + 1U);
+        }
+    }
+
+    cursor = first;
+    while(cursor < last)
+    {
+        const struct p101_cidr *prefix;
+        uint64_t                high;
+        uint64_t                low;
+        uint32_t                slot;
+        size_t                  end;
+
+        prefix = &builder->prefixes[builder->order[cursor]];
+        if(prefix->prefix_length <= LPM_DIRECT_BITS)
+        {
+            cursor++;
+            continue;
+        }
+
+        load_bits(prefix->network.address, address_size(prefix), &high, &low);
+        slot = (uint32_t)(high >> (LPM_WORD_BITS - LPM_DIRECT_BITS));
+        for(end = cursor + 1U; end < last; end++)
+        {
+            prefix = &builder->prefixes[builder->order[end]];
+            load_bits(prefix->network.address, address_size(prefix), &high, &low);
+            if((uint32_t)(high >> (LPM_WORD_BITS - LPM_DIRECT_BITS)) != slot)
+            {
+                break;
+            }
+        }
+
+        node = builder->node_count++;
+        fill_node(env, builder, node, cursor, end, LPM_DIRECT_BITS, direct[slot] & ~LPM_LEAF);
+        direct[slot] = node;
+        cursor       = end;
+    }
+
+    P101_TRACE_EXIT(env);
+}
+
+static const struct p101_lpm *build_table(const struct p101_env *env, struct p101_error *err, const struct p101_cidr *prefixes, size_t count, void *memory, size_t size)
+{
+    struct lpm_layout  layout;
+    struct lpm_builder builder;
+    struct p101_lpm   *lpm;
+    unsigned char     *cursor;
+    uint32_t          *ipv4;
+    uint32_t          *ipv6;
+    uint32_t          *order;
+    uint32_t          *scratch;
+    bool               has_error;
+
+    P101_TRACE(env);
+    lpm = NULL;
+    if(memory == NULL || (uintptr_t)memory % _Alignof(struct lpm_node) != 0U)
+    {
+        P101_ERROR_RAISE_CHECK(err);
+        goto done;
+    }
+    has_error = p101_error_has_error(err);
+    if(has_error)
+    {
+        goto done;
+    }
+
+    if(!plan_layout(env, err, prefixes, count, &layout))
+    {
+        goto done;
+    }
+
+    if(size < layout.size)
+    {
+        P101_ERROR_RAISE_USER(err, "The memory is smaller than p101_lpm_size() reports.", P101_CONVERT_ERROR_RANGE);
+        goto done;
+    }
+
+    cursor = (unsigned char *)memory + (((sizeof(struct p101_lpm) + sizeof(uint64_t) - 1U) / sizeof(uint64_t)) * sizeof(uint64_t));
+    ipv4   = NULL;
+    ipv6   = NULL;
+    if(layout.ipv4_count != 0U)
+    {
+        ipv4 = (uint32_t *)(void *)cursor;
+        cursor += LPM_DIRECT_SLOTS * sizeof(uint32_t);
+    }
+    if(layout.ipv4_count != count)
+    {
+        ipv6 = (uint32_t *)(void *)cursor;
+        cursor += LPM_DIRECT_SLOTS * sizeof(uint32_t);
+    }
+    builder.nodes = (struct lpm_node *)(void *)cursor;
+    cursor += layout.node_bound * sizeof(struct lpm_node);
+    builder.leaves = (uint32_t *)(void *)cursor;
+    cursor += layout.leaf_bound * sizeof(uint32_t);
+    order   = (uint32_t *)(void *)cursor;
+    scratch = order + count;
+
+    builder.prefixes   = prefixes;
+    builder.order      = sort_prefixes(prefixes, count, order, scratch);
+    builder.node_count = 0;
+    builder.leaf_count = 0;
+    if(ipv4 != NULL)
+    {
+        fill_direct(env, &builder, ipv4, 0, layout.ipv4_count);
+    }
+    if(ipv6 != NULL)
+    {
+        fill_direct(env, &builder, ipv6, layout.ipv4_count, count);
+    }
+
+    lpm         = (struct p101_lpm *)memory;
+    lpm->ipv4   = ipv4;
+    lpm->ipv6   = ipv6;
+    lpm->nodes  = builder.nodes;
+    lpm->leaves = builder.leaves;
+
+done:
+    P101_TRACE_EXIT(env);
+    return lpm;
+}
+
+// The lookup proper, without tracing: one branch per level and two popcounts
+// at most.
+static LPM_ALWAYS_INLINE uint32_t walk_table(const struct p101_lpm *lpm, const uint32_t *direct, uint64_t high, uint64_t low)
+{
+    const struct lpm_node *node;
+    uint32_t               entry;
+    unsigned int           depth;
+
+    entry = direct[high >> (LPM_WORD_BITS - LPM_DIRECT_BITS)];
+    depth = LPM_DIRECT_BITS;
+    while((entry & LPM_LEAF) == 0U)
+    {
+        uint64_t bit;
+        uint64_t below;
+
+        node  = &lpm->nodes[entry];
+        bit   = UINT64_C(1) << slot_at(high, low, depth);
+        below = bit | (bit - 1U);
+        if((node->vector & bit) == 0U)
+        {
+            return lpm->leaves[node->base0 + count_bits(node->leafvec & below) - 1U];
+        }
+
+        entry = node->base1 + count_bits(node->vector & below) - 1U;
+        depth += LPM_STRIDE;
+    }
+
+    return entry & ~LPM_LEAF;
+}
+
+#ifdef P101_CONVERT_POPCNT_LOOKUP
+// The library is built for the baseline ISA, where a popcount is a libgcc
+// call. The same walk is compiled again with the POPCNT instruction enabled
+// and chosen at run time, the way the SSE4.1 digit kernel in integer.c is.
+static bool have_popcnt(void)
+{
+    #ifdef __POPCNT__
+    return true;
+    #else
+    return __builtin_cpu_supports("popcnt") != 0;
+    #endif
+}
+
+__attribute__((target("popcnt"))) static uint32_t walk_table_popcnt(const struct p101_lpm *lpm, const uint32_t *direct, uint64_t high, uint64_t low)
+{
+    return walk_table(lpm, direct, high, low);
+}
+#endif
+
+static size_t lookup_bits(const struct p101_lpm *lpm, const uint32_t *direct, uint64_t high, uint64_t low)
+{
+    uint32_t value;
+
+    if(direct == NULL)
+    {
+        return P101_LPM_NO_MATCH;
+    }
+
+#ifdef P101_CONVERT_POPCNT_LOOKUP
+    if(have_popcnt())
+    {
+        value = walk_table_popcnt(lpm, direct, high, low);
+    }
+    else
+#endif
+    {
+        value = walk_table(lpm, direct, high, low);
+    }
+    return value == 0U ? P101_LPM_NO_MATCH : (size_t)value - 1U;
+}
+
+static size_t lookup_address(const struct p101_env *env, struct p101_error *err, const struct p101_lpm *lpm, const struct sockaddr *addr)
+{
+    const struct sockaddr_in  *sin;
+    const struct sockaddr_in6 *sin6;
+    uint64_t                   high;
+    uint64_t                   low;
+    size_t                     ret_val;
+    bool                       has_error;
+
+    P101_TRACE(env);
+    ret_val = P101_LPM_NO_MATCH;
+    if(lpm == NULL || addr == NULL)
+    {
+        P101_ERROR_RAISE_CHECK(err);
+        goto done;
+    }
+    has_error = p101_error_has_error(err);
+    if(has_error)
+    {
+        goto done;
+    }
+
+    if(addr->sa_family == AF_INET)
+    {
+        sin = (const struct sockaddr_in *)(const void *)addr;
+        load_bits((const uint8_t *)&sin->sin_addr, IPV4_ADDRESS_SIZE, &high, &low);
+        ret_val = lookup_bits(lpm, lpm->ipv4, high, low);
+    }
+    else if(addr->sa_family == AF_INET6)
+    {
+        sin6 = (const struct sockaddr_in6 *)(const void *)addr;
+        load_bits(sin6->sin6_addr.s6_addr, IPV6_ADDRESS_SIZE, &high, &low);
+        ret_val = lookup_bits(lpm, lpm->ipv6, high, low);
+    }
+    else
+    {
+        P101_ERROR_RAISE_USER(err, "The address is not IPv4 or IPv6.", P101_CONVERT_ERROR_ADDRESS);
+    }
+
+done:
+    P101_TRACE_EXIT(env);
+    return ret_val;
+}
+
+static size_t lookup_compact(const struct p101_env *env, struct p101_error *err, const struct p101_lpm *lpm, const struct p101_compact_address *address)
+{
+    uint64_t high;
+    uint64_t low;
+    size_t   ret_val;
+    bool     has_error;
+
+    P101_TRACE(env);
+    ret_val = P101_LPM_NO_MATCH;
+    if(lpm == NULL || address == NULL)
+    {
+        P101_ERROR_RAISE_CHECK(err);
+        goto done;
+    }
+    has_error = p101_error_has_error(err);
+    if(has_error)
+    {
+        goto done;
+    }
+
+    if(address->family == P101_COMPACT_ADDRESS_IPV4)
+    {
+        load_bits(address->address, IPV4_ADDRESS_SIZE, &high, &low);
+        ret_val = lookup_bits(lpm, lpm->ipv4, high, low);
+    }
+    else if(address->family == P101_COMPACT_ADDRESS_IPV6)
+    {
+        load_bits(address->address, IPV6_ADDRESS_SIZE, &high, &low);
+        ret_val = lookup_bits(lpm, lpm->ipv6, high, low);
+    }
+    else
+    {
+        P101_ERROR_RAISE_USER(err, "The compact address holds no IPv4 or IPv6 address.", P101_CONVERT_ERROR_ADDRESS);
+    }
+
+done:
+    P101_TRACE_EXIT(env);
+    return ret_val;
+}
+
+size_t p101_lpm_size(const struct p101_env *env, struct p101_error *err, const struct p101_cidr *prefixes, size_t count)
+{
+    struct lpm_layout layout;
+    size_t            ret_val;
+
+    P101_TRACE(env);
+    P101_WRAPPER_FAULT_RETURN(env, err, ret_val, 0);
+    ret_val = plan_layout(env, err, prefixes, count, &layout) ? layout.size : 0U;
+    P101_WRAPPER_DONE(env);
+    return ret_val;
+}
+
+const struct p101_lpm *p101_lpm_build(const struct p101_env *env, struct p101_error *err, const struct p101_cidr *prefixes, size_t count, void *memory, size_t size)
+{
+    const struct p101_lpm *ret_val;
+
+    P101_TRACE(env);
+    P101_WRAPPER_FAULT_RETURN(env, err, ret_val, NULL);
+    ret_val = build_table(env, err, prefixes, count, memory, size);
+    P101_WRAPPER_DONE(env);
+    return ret_val;
+}
+
+size_t p101_lpm_lookup(const struct p101_env *env, struct p101_error *err, const struct p101_lpm *lpm, const struct sockaddr *addr)
+{
+    size_t ret_val;
+
+    P101_TRACE(env);
+    P101_WRAPPER_FAULT_RETURN(env, err, ret_val, P101_LPM_NO_MATCH);
+    ret_val = lookup_address(env, err, lpm, addr);
+    P101_WRAPPER_DONE(env);
+    return ret_val;
+}
+
+size_t p101_lpm_lookup_compact(const struct p101_env *env, struct p101_error *err, const struct p101_lpm *lpm, const struct p101_compact_address *address)
+{
+    size_t ret_val;
+
+    P101_TRACE(env);
+    P101_WRAPPER_FAULT_RETURN(env, err, ret_val, P101_LPM_NO_MATCH);
+    ret_val = lookup_compact(env, err, lpm, address);
+    P101_WRAPPER_DONE(env);
+    return ret_val;
+}
@@ -14,8 +14,9 @@
  * limitations under the License.
  */
 
+#include "instrumentation.h"
 #include "p101_convert/errors.h"
-#include <errno.h>
+#include <limits.h>
 #include <netinet/in.h>
 #include <p101_c/p101_string.h>
 #include <p101_convert/integer.h>
@@ -40,34 +41,150 @@ enum
     IPV4_DOT_COUNT    = IPV4_OCTET_COUNT - 1U,
     IPV4_MAX_DIGITS   = 3U,
     IPV4_MAX_OCTET    = 255U,
+    IPV6_ADDRESS_SIZE = 16U,
+    IPV6_GROUP_SIZE   = 2U,
+    IPV6_HEX_BASE     = 16U,
+    IPV6_MAX_DIGITS   = 4U,
+    BITS_PER_BYTE     = 8U,
+    HEX_LETTER_OFFSET = 10U,
     ASCII_ZERO        = '0',
     ASCII_NINE        = '9',
-    ASCII_DOT         = '.'
+    ASCII_LOWER_A     = 'a',
+    ASCII_LOWER_F     = 'f',
+    ASCII_UPPER_A     = 'A',
+    ASCII_UPPER_F     = 'F',
+    PORT_DECIMAL_BASE = 10U,
+    PORT_MAX          = 65535U,
+    IPV4_PREFIX_MAX   = 32U,
+    IPV6_PREFIX_MAX   = 128U,
+    BYTE_MASK         = 0xFFU,
+    ASCII_DOT         = '.',
+    ASCII_COLON       = ':',
+    ASCII_OPEN_BRACE  = '[',
+    ASCII_CLOSE_BRACE = ']',
+    ASCII_SLASH       = '/',
+    IPV6_GROUP_COUNT  = 8U,
+    IPV6_MAPPED_GROUP = 5U,
+    HEX_NIBBLE_BITS   = 4U,
+    HEX_NIBBLE_MASK   = 0x0FU,
+    OCTET_TEXT_LENGTH = 3U,
+    PORT_MAX_DIGITS   = 5U
 };
 
-static bool is_strict_ipv4_literal(const struct p101_env *env, const char *address);
-static bool is_dotted_numeric_text(const struct p101_env *env, const char *address);
-static bool is_unix_path(const struct p101_env *env, const char *address);
+enum address_class
+{
+    ADDRESS_CLASS_NONE,
+    ADDRESS_CLASS_IPV4,
+    ADDRESS_CLASS_IPV6,
+    ADDRESS_CLASS_UNIX
+};
+
+enum
+{
+    ADDRESS_CHARACTER_DIGIT      = 0x01U,
+    ADDRESS_CHARACTER_HEX_LETTER = 0x02U,
+    ADDRESS_CHARACTER_DOT        = 0x04U,
+    ADDRESS_CHARACTER_COLON      = 0x08U,
+    ADDRESS_CHARACTER_SLASH      = 0x10U
+};
+
+/* What each byte can belong to in an address literal; zero for anything else. */
+static const uint8_t address_characters[UCHAR_MAX + 1] = {
+    ['0'] = ADDRESS_CHARACTER_DIGIT,      ['1'] = ADDRESS_CHARACTER_DIGIT,      ['2'] = ADDRESS_CHARACTER_DIGIT,      ['3'] = ADDRESS_CHARACTER_DIGIT,      ['4'] = ADDRESS_CHARACTER_DIGIT,
+    ['5'] = ADDRESS_CHARACTER_DIGIT,      ['6'] = ADDRESS_CHARACTER_DIGIT,      ['7'] = ADDRESS_CHARACTER_DIGIT,      ['8'] = ADDRESS_CHARACTER_DIGIT,      ['9'] = ADDRESS_CHARACTER_DIGIT,
+    ['a'] = ADDRESS_CHARACTER_HEX_LETTER, ['b'] = ADDRESS_CHARACTER_HEX_LETTER, ['c'] = ADDRESS_CHARACTER_HEX_LETTER, ['d'] = ADDRESS_CHARACTER_HEX_LETTER, ['e'] = ADDRESS_CHARACTER_HEX_LETTER,
+    ['f'] = ADDRESS_CHARACTER_HEX_LETTER, ['A'] = ADDRESS_CHARACTER_HEX_LETTER, ['B'] = ADDRESS_CHARACTER_HEX_LETTER, ['C'] = ADDRESS_CHARACTER_HEX_LETTER, ['D'] = ADDRESS_CHARACTER_HEX_LETTER,
+    ['E'] = ADDRESS_CHARACTER_HEX_LETTER, ['F'] = ADDRESS_CHARACTER_HEX_LETTER, ['.'] = ADDRESS_CHARACTER_DOT,        [':'] = ADDRESS_CHARACTER_COLON,      ['/'] = ADDRESS_CHARACTER_SLASH,
+};
 
-static bool is_strict_ipv4_literal(const struct p101_env *env, const char *address)
+/*
+ * The decimal text of every octet, with its length in the last byte. All
+ * three digit bytes are stored and the cursor advances by the length, so an
+ * octet costs no division and no branch on its value.
+ */
+static const char octet_text[UCHAR_MAX + 1][OCTET_TEXT_LENGTH + 1U] = {
+    {'0', 0, 0, 1},     {'1', 0, 0, 1},     {'2', 0, 0, 1},     {'3', 0, 0, 1},     {'4', 0, 0, 1},     {'5', 0, 0, 1},     {'6', 0, 0, 1},     {'7', 0, 0, 1},
+    {'8', 0, 0, 1},     {'9', 0, 0, 1},     {'1', '0', 0, 2},   {'1', '1', 0, 2},   {'1', '2', 0, 2},   {'1', '3', 0, 2},   {'1', '4', 0, 2},   {'1', '5', 0, 2},
+    {'1', '6', 0, 2},   {'1', '7', 0, 2},   {'1', '8', 0, 2},   {'1', '9', 0, 2},   {'2', '0', 0, 2},   {'2', '1', 0, 2},   {'2', '2', 0, 2},   {'2', '3', 0, 2},
+    {'2', '4', 0, 2},   {'2', '5', 0, 2},   {'2', '6', 0, 2},   {'2', '7', 0, 2},   {'2', '8', 0, 2},   {'2', '9', 0, 2},   {'3', '0', 0, 2},   {'3', '1', 0, 2},
+    {'3', '2', 0, 2},   {'3', '3', 0, 2},   {'3', '4', 0, 2},   {'3', '5', 0, 2},   {'3', '6', 0, 2},   {'3', '7', 0, 2},   {'3', '8', 0, 2},   {'3', '9', 0, 2},
+    {'4', '0', 0, 2},   {'4', '1', 0, 2},   {'4', '2', 0, 2},   {'4', '3', 0, 2},   {'4', '4', 0, 2},   {'4', '5', 0, 2},   {'4', '6', 0, 2},   {'4', '7', 0, 2},
+    {'4', '8', 0, 2},   {'4', '9', 0, 2},   {'5', '0', 0, 2},   {'5', '1', 0, 2},   {'5', '2', 0, 2},   {'5', '3', 0, 2},   {'5', '4', 0, 2},   {'5', '5', 0, 2},
+    {'5', '6', 0, 2},   {'5', '7', 0, 2},   {'5', '8', 0, 2},   {'5', '9', 0, 2},   {'6', '0', 0, 2},   {'6', '1', 0, 2},   {'6', '2', 0, 2},   {'6', '3', 0, 2},
+    {'6', '4', 0, 2},   {'6', '5', 0, 2},   {'6', '6', 0, 2},   {'6', '7', 0, 2},   {'6', '8', 0, 2},   {'6', '9', 0, 2},   {'7', '0', 0, 2},   {'7', '1', 0, 2},
+    {'7', '2', 0, 2},   {'7', '3', 0, 2},   {'7', '4', 0, 2},   {'7', '5', 0, 2},   {'7', '6', 0, 2},   {'7', '7', 0, 2},   {'7', '8', 0, 2},   {'7', '9', 0, 2},
+    {'8', '0', 0, 2},   {'8', '1', 0, 2},   {'8', '2', 0, 2},   {'8', '3', 0, 2},   {'8', '4', 0, 2},   {'8', '5', 0, 2},   {'8', '6', 0, 2},   {'8', '7', 0, 2},
+    {'8', '8', 0, 2},   {'8', '9', 0, 2},   {'9', '0', 0, 2},   {'9', '1', 0, 2},   {'9', '2', 0, 2},   {'9', '3', 0, 2},   {'9', '4', 0, 2},   {'9', '5', 0, 2},
+    {'9', '6', 0, 2},   {'9', '7', 0, 2},   {'9', '8', 0, 2},   {'9', '9', 0, 2},   {'1', '0', '0', 3}, {'1', '0', '1', 3}, {'1', '0', '2', 3}, {'1', '0', '3', 3},
+    {'1', '0', '4', 3}, {'1', '0', '5', 3}, {'1', '0', '6', 3}, {'1', '0', '7', 3}, {'1', '0', '8', 3}, {'1', '0', '9', 3}, {'1', '1', '0', 3}, {'1', '1', '1', 3},
+    {'1', '1', '2', 3}, {'1', '1', '3', 3}, {'1', '1', '4', 3}, {'1', '1', '5', 3}, {'1', '1', '6', 3}, {'1', '1', '7', 3}, {'1', '1', '8', 3}, {'1', '1', '9', 3},
+    {'1', '2', '0', 3}, {'1', '2', '1', 3}, {'1', '2', '2', 3}, {'1', '2', '3', 3}, {'1', '2', '4', 3}, {'1', '2', '5', 3}, {'1', '2', '6', 3}, {'1', '2', '7', 3},
+    {'1', '2', '8', 3}, {'1', '2', '9', 3}, {'1', '3', '0', 3}, {'1', '3', '1', 3}, {'1', '3', '2', 3}, {'1', '3', '3', 3}, {'1', '3', '4', 3}, {'1', '3', '5', 3},
+    {'1', '3', '6', 3}, {'1', '3', '7', 3}, {'1', '3', '8', 3}, {'1', '3', '9', 3}, {'1', '4', '0', 3}, {'1', '4', '1', 3}, {'1', '4', '2', 3}, {'1', '4', '3', 3},
+    {'1', '4', '4', 3}, {'1', '4', '5', 3}, {'1', '4', '6', 3}, {'1', '4', '7', 3}, {'1', '4', '8', 3}, {'1', '4', '9', 3}, {'1', '5', '0', 3}, {'1', '5', '1', 3},
+    {'1', '5', '2', 3}, {'1', '5', '3', 3}, {'1', '5', '4', 3}, {'1', '5', '5', 3}, {'1', '5', '6', 3}, {'1', '5', '7', 3}, {'1', '5', '8', 3}, {'1', '5', '9', 3},
+    {'1', '6', '0', 3}, {'1', '6', '1', 3}, {'1', '6', '2', 3}, {'1', '6', '3', 3}, {'1', '6', '4', 3}, {'1', '6', '5', 3}, {'1', '6', '6', 3}, {'1', '6', '7', 3},
+    {'1', '6', '8', 3}, {'1', '6', '9', 3}, {'1', '7', '0', 3}, {'1', '7', '1', 3}, {'1', '7', '2', 3}, {'1', '7', '3', 3}, {'1', '7', '4', 3}, {'1', '7', '5', 3},
+    {'1', '7', '6', 3}, {'1', '7', '7', 3}, {'1', '7', '8', 3}, {'1', '7', '9', 3}, {'1', '8', '0', 3}, {'1', '8', '1', 3}, {'1', '8', '2', 3}, {'1', '8', '3', 3},
+    {'1', '8', '4', 3}, {'1', '8', '5', 3}, {'1', '8', '6', 3}, {'1', '8', '7', 3}, {'1', '8', '8', 3}, {'1', '8', '9', 3}, {'1', '9', '0', 3}, {'1', '9', '1', 3},
+    {'1', '9', '2', 3}, {'1', '9', '3', 3}, {'1', '9', '4', 3}, {'1', '9', '5', 3}, {'1', '9', '6', 3}, {'1', '9', '7', 3}, {'1', '9', '8', 3}, {'1', '9', '9', 3},
+    {'2', '0', '0', 3}, {'2', '0', '1', 3}, {'2', '0', '2', 3}, {'2', '0', '3', 3}, {'2', '0', '4', 3}, {'2', '0', '5', 3}, {'2', '0', '6', 3}, {'2', '0', '7', 3},
+    {'2', '0', '8', 3}, {'2', '0', '9', 3}, {'2', '1', '0', 3}, {'2', '1', '1', 3}, {'2', '1', '2', 3}, {'2', '1', '3', 3}, {'2', '1', '4', 3}, {'2', '1', '5', 3},
+    {'2', '1', '6', 3}, {'2', '1', '7', 3}, {'2', '1', '8', 3}, {'2', '1', '9', 3}, {'2', '2', '0', 3}, {'2', '2', '1', 3}, {'2', '2', '2', 3}, {'2', '2', '3', 3},
+    {'2', '2', '4', 3}, {'2', '2', '5', 3}, {'2', '2', '6', 3}, {'2', '2', '7', 3}, {'2', '2', '8', 3}, {'2', '2', '9', 3}, {'2', '3', '0', 3}, {'2', '3', '1', 3},
+    {'2', '3', '2', 3}, {'2', '3', '3', 3}, {'2', '3', '4', 3}, {'2', '3', '5', 3}, {'2', '3', '6', 3}, {'2', '3', '7', 3}, {'2', '3', '8', 3}, {'2', '3', '9', 3},
+    {'2', '4', '0', 3}, {'2', '4', '1', 3}, {'2', '4', '2', 3}, {'2', '4', '3', 3}, {'2', '4', '4', 3}, {'2', '4', '5', 3}, {'2', '4', '6', 3}, {'2', '4', '7', 3},
+    {'2', '4', '8', 3}, {'2', '4', '9', 3}, {'2', '5', '0', 3}, {'2', '5', '1', 3}, {'2', '5', '2', 3}, {'2', '5', '3', 3}, {'2', '5', '4', 3}, {'2', '5', '5', 3},
+};
+
+static const char hex_digits[IPV6_HEX_BASE] = {'0', '1', '2', '3', '4', '5', '6', '7', '8', '9', 'a', 'b', 'c', 'd', 'e', 'f'};
+
+static bool                     parse_strict_ipv4_literal(const struct p101_env *env, const char *address, const char *end, struct in_addr *in);
+static bool                     parse_ipv6_literal(const struct p101_env *env, const char *address, const char *end, struct in6_addr *in6);
+static enum address_class       classify_address(const struct p101_env *env, const char *address, size_t *length);
+static socklen_t                convert_address_element(const struct p101_env *env, const char *address, struct sockaddr_storage *addr);
+static size_t                   convert_address_array(const struct p101_env *env, struct p101_error *err, const char *const *addresses, size_t count, struct sockaddr_storage *out, socklen_t *lengths, uint8_t *status);
+static enum p101_convert_status parse_endpoint_port(const struct p101_env *env, const char *port, const char *end, in_port_t *value);
+static socklen_t                convert_endpoint(const struct p101_env *env, struct p101_error *err, const char *endpoint, size_t length, struct sockaddr_storage *addr);
+static enum p101_convert_status parse_prefix_length(const struct p101_env *env, const char *prefix, const char *end, unsigned int max_length, uint8_t *value);
+static bool                     clear_host_bits(const struct p101_env *env, uint8_t *bytes, size_t size, unsigned int prefix_length);
+static bool                     convert_cidr(const struct p101_env *env, struct p101_error *err, const char *cidr, bool strict, struct p101_cidr *out);
+static bool                     convert_compact_address(const struct p101_env *env, struct p101_error *err, const char *address, struct p101_compact_address *compact);
+static socklen_t                compact_address_to_sockaddr(const struct p101_env *env, struct p101_error *err, const struct p101_compact_address *compact, struct sockaddr_storage *addr);
+static char                    *format_ipv4(const uint8_t *bytes, char *out);
+static char                    *format_ipv6(const uint8_t *bytes, char *out);
+static char                    *format_port(in_port_t port, char *out);
+static size_t                   format_address(const struct p101_env *env, struct p101_error *err, const struct sockaddr *addr, bool with_port, char *buffer, size_t size);
+
+/*
+ * Validate and convert the dotted-quad IPv4 literal in [address, end) in one
+ * scan: exactly four decimal octets, each at most 255 and without leading
+ * zeros. The octets are stored in network order as they complete, so a valid
+ * literal needs no second pass through inet_pton. The text does not need to
+ * be NUL-terminated, which lets an endpoint be parsed in place. *in is only
+ * meaningful when true is returned.
+ */
+static bool parse_strict_ipv4_literal(const struct p101_env *env, const char *address, const char *end, struct in_addr *in)
 {
+    uint8_t     *bytes;
     unsigned int octet;
     unsigned int octets;
     unsigned int digits;
     bool         valid;
 
     P101_TRACE(env);
+    bytes  = (uint8_t *)&in->s_addr;
     octet  = 0;
     octets = 0;
     digits = 0;
     valid  = false;
 
-    if(address == NULL || *address == '\0')
+    if(address == NULL || address == end)
     {
         goto done;
     }
 
-    while(*address != '\0')
+    while(address < end)
     {
         if(*address >= ASCII_ZERO && *address <= ASCII_NINE)
         {
@@ -88,6 +205,7 @@ static bool is_strict_ipv4_literal(const struct p101_env *env, const char *addre
             {
                 goto done;
             }
+            bytes[octets] = (uint8_t)octet;
             octets++;
             octet  = 0;
             digits = 0;
@@ -102,7 +220,8 @@ static bool is_strict_ipv4_literal(const struct p101_env *env, const char *addre
 
     if(octets == IPV4_DOT_COUNT && digits > 0U)
     {
-        valid = true;
+        bytes[octets] = (uint8_t)octet;
+        valid         = true;
     }
 
 done:
@@ -110,84 +229,391 @@ done:
     return valid;
 }
 
-static bool is_dotted_numeric_text(const struct p101_env *env, const char *address)
+/*
+ * Validate and convert the IPv6 literal (RFC 4291 section 2.2) in
+ * [address, end) in one scan, accepting exactly what inet_pton(AF_INET6)
+ * accepts: up to eight groups of
+ * one to four hex digits, at most one "::", and an optional dotted-quad tail
+ * in the last 32 bits, which follows the strict IPv4 rules above. Groups are
+ * stored as they complete and anything after a "::" is moved to the end of
+ * the address once the length is known. The scan stops at the first byte
+ * that cannot continue a literal, so paths and other text are rejected after
+ * one or two characters. *in6 is only meaningful when true is returned.
+ */
+static bool parse_ipv6_literal(const struct p101_env *env, const char *address, const char *end, struct in6_addr *in6)
 {
-    bool saw_dot;
+    struct in_addr tail;
+    uint8_t       *bytes;
+    const char    *token;
+    size_t         length;
+    size_t         gap;
+    size_t         moved;
+    unsigned int   group;
+    unsigned int   digits;
+    unsigned int   digit;
+    bool           has_gap;
+    bool           valid;
 
     P101_TRACE(env);
-    saw_dot = false;
-    if(address == NULL || *address == '\0')
+    bytes   = in6->s6_addr;
+    length  = 0;
+    gap     = 0;
+    group   = 0;
+    digits  = 0;
+    has_gap = false;
+    valid   = false;
+    p101_memset(env, bytes, 0, IPV6_ADDRESS_SIZE);
+
+    if(address == end)
     {
         goto done;
     }
 
-    while(*address != '\0')
+    /* A leading colon is only valid as the first half of "::". */
+    if(*address == ASCII_COLON)
+    {
+        address++;
+        if(address == end || *address != ASCII_COLON)
+        {
+            goto done;
+        }
+    }
+
+    token = address;
+    while(address < end)
+    {
+        char c;
+
+        c = *address++;
+        if(c >= ASCII_ZERO && c <= ASCII_NINE)
+        {
+            digit = (unsigned int)(c - ASCII_ZERO);
+        }
+        else if(c >= ASCII_LOWER_A && c <= ASCII_LOWER_F)
+        {
+            digit = (unsigned int)(c - ASCII_LOWER_A) + HEX_LETTER_OFFSET;
+        }
+        else if(c >= ASCII_UPPER_A && c <= ASCII_UPPER_F)
+        {
+            digit = (unsigned int)(c - ASCII_UPPER_A) + HEX_LETTER_OFFSET;
+        }
+        else if(c == ASCII_COLON)
+        {
+            token = address;
+            if(digits == 0U)
+            {
+                if(has_gap)
+                {
+                    goto done;
+                }
+                has_gap = true;
+                gap     = length;
+                continue;
+            }
+            if(address == end || length + IPV6_GROUP_SIZE > IPV6_ADDRESS_SIZE)
+            {
+                goto done;
+            }
+            bytes[length++] = (uint8_t)(group >> BITS_PER_BYTE);
+            bytes[length++] = (uint8_t)group;
+            group           = 0;
+            digits          = 0;
+            continue;
+        }
+        else if(c == ASCII_DOT && length + IPV4_OCTET_COUNT <= IPV6_ADDRESS_SIZE && parse_strict_ipv4_literal(env, token, end, &tail))
+        {
+            p101_memcpy(env, &bytes[length], &tail, IPV4_OCTET_COUNT);
+            length += IPV4_OCTET_COUNT;
+            digits = 0;
+            break;
+        }
+        else
+        {
+            goto done;
+        }
+
+        if(digits == IPV6_MAX_DIGITS)
+        {
+            goto done;
+        }
+        group = (group * IPV6_HEX_BASE) + digit;
+        digits++;
+    }
+
+    if(digits > 0U)
     {
-        if(*address == ASCII_DOT)
+        if(length + IPV6_GROUP_SIZE > IPV6_ADDRESS_SIZE)
         {
-            saw_dot = true;
+            goto done;
         }
-        else if(*address < ASCII_ZERO || *address > ASCII_NINE)
+        bytes[length++] = (uint8_t)(group >> BITS_PER_BYTE);
+        bytes[length++] = (uint8_t)group;
+    }
+
+    if(has_gap)
+    {
+        /* "::" must stand for at least one zero group. */
+        if(length == IPV6_ADDRESS_SIZE)
         {
-            saw_dot = false;
             goto done;
         }
-        address++;
+        moved = length - gap;
+        for(size_t i = 1; i <= moved; i++)
+        {
+            bytes[IPV6_ADDRESS_SIZE - i] = bytes[length - i];
+            bytes[length - i]            = 0;
+        }
+        length = IPV6_ADDRESS_SIZE;
     }
 
+    valid = (length == IPV6_ADDRESS_SIZE);
+
 done:
     P101_TRACE_EXIT(env);
-    return saw_dot;
+    return valid;
 }
 
-static bool is_unix_path(const struct p101_env *env, const char *address)
+/*
+ * Decide, in one scan, which parser can possibly accept the text: decimal
+ * digits with at least one dot can only be IPv4, hex digits and dots with at
+ * least one colon can only be IPv6, and anything containing a '/' can only be
+ * a Unix path. Dotted decimal text that fails the strict IPv4 rules is
+ * therefore never reinterpreted as a path. The scan also measures the text,
+ * which the Unix path case needs.
+ */
+static enum address_class classify_address(const struct p101_env *env, const char *address, size_t *length)
 {
-    bool ret_val;
+    const char        *cursor;
+    enum address_class ret_val;
+    unsigned int       seen;
+    unsigned int       character_class;
+    bool               other;
 
     P101_TRACE(env);
-    ret_val = false;
-    if(address != NULL && address[0] != '\0')
+    seen  = 0;
+    other = false;
+
+    for(cursor = address; *cursor != '\0'; cursor++)
+    {
+        character_class = address_characters[(unsigned char)*cursor];
+        seen |= character_class;
+        other = other || character_class == 0U;
+    }
+
+    *length = (size_t)(cursor - address);
+    if((seen & ADDRESS_CHARACTER_SLASH) != 0U)
+    {
+        ret_val = ADDRESS_CLASS_UNIX;
+    }
+    else if(other)
+    {
+        ret_val = ADDRESS_CLASS_NONE;
+    }
+    else if((seen & ADDRESS_CHARACTER_COLON) != 0U)
+    {
+        ret_val = ADDRESS_CLASS_IPV6;
+    }
+    else if((seen & (ADDRESS_CHARACTER_HEX_LETTER | ADDRESS_CHARACTER_DOT)) == ADDRESS_CHARACTER_DOT)
+    {
+        ret_val = ADDRESS_CLASS_IPV4;
+    }
+    else
     {
-        const char *slash = p101_strchr(env, address, '/');
+        ret_val = ADDRESS_CLASS_NONE;
+    }
 
-        if(slash != NULL)
+    P101_TRACE_EXIT(env);
+    return ret_val;
+}
+
+/*
+ * Convert one address straight into addr, with no temporary sockaddr and no
+ * full-storage memset: only the sockaddr of the family found is zeroed and
+ * filled in. Returns its length, or zero with addr->ss_family set to
+ * AF_UNSPEC and nothing raised when the text is not an address.
+ */
+static socklen_t convert_address_element(const struct p101_env *env, const char *address, struct sockaddr_storage *addr)
+{
+    struct sockaddr_un  *sun;
+    struct sockaddr_in  *sin;
+    struct sockaddr_in6 *sin6;
+    enum address_class   address_class;
+    size_t               length;
+    socklen_t            ret_val;
+    bool                 is_ipv4;
+    bool                 is_ipv6;
+
+    P101_TRACE(env);
+    ret_val       = 0;
+    address_class = classify_address(env, address, &length);
+    if(address_class == ADDRESS_CLASS_IPV4)
+    {
+        sin = (struct sockaddr_in *)(void *)addr;
+        p101_memset(env, sin, 0, sizeof(*sin));
+        is_ipv4 = parse_strict_ipv4_literal(env, address, address + length, &sin->sin_addr);
+        if(is_ipv4)
+        {
+            sin->sin_family = AF_INET;
+#if defined(__APPLE__) || defined(__FreeBSD__)
+            sin->sin_len = (uint8_t)sizeof(*sin);
+#endif
+            ret_val = (socklen_t)sizeof(*sin);
+            goto done;
+        }
+        p101_memset(env, sin, 0, sizeof(*sin));
+    }
+    else if(address_class == ADDRESS_CLASS_IPV6)
+    {
+        sin6 = (struct sockaddr_in6 *)(void *)addr;
+        p101_memset(env, sin6, 0, sizeof(*sin6));
+        is_ipv6 = parse_ipv6_literal(env, address, address + length, &sin6->sin6_addr);
+        if(is_ipv6)
         {
-            ret_val = true;
+            sin6->sin6_family = AF_INET6;
+#if defined(__APPLE__) || defined(__FreeBSD__)
+            sin6->sin6_len = (uint8_t)sizeof(*sin6);
+#endif
+            ret_val = (socklen_t)sizeof(*sin6);
+            goto done;
         }
+        p101_memset(env, sin6, 0, sizeof(*sin6));
+    }
+    else if(address_class == ADDRESS_CLASS_UNIX && length <= sizeof(sun->sun_path) - 1U)
+    {
+        sun = (struct sockaddr_un *)(void *)addr;
+        p101_memset(env, sun, 0, sizeof(*sun));
+        p101_memcpy(env, sun->sun_path, address, length);
+        sun->sun_family = AF_UNIX;
+        ret_val         = (socklen_t)(offsetof(struct sockaddr_un, sun_path) + length + 1U);
+#if defined(__APPLE__) || defined(__FreeBSD__)
+        sun->sun_len = (uint8_t)ret_val;
+#endif
+        goto done;
     }
+
+    addr->ss_family = AF_UNSPEC;
+
+done:
     P101_TRACE_EXIT(env);
     return ret_val;
 }
 
-in_port_t p101_parse_in_port_t(const struct p101_env *env, struct p101_error *err, const char *str)
+static size_t convert_address_array(const struct p101_env *env, struct p101_error *err, const char *const *addresses, size_t count, struct sockaddr_storage *out, socklen_t *lengths, uint8_t *status)
 {
-    in_port_t ret_val;
+    bool   has_error;
+    size_t index;
+    size_t converted_count;
 
     P101_TRACE(env);
-    P101_WRAPPER_FAULT_RETURN(env, err, ret_val, 0);
-    ret_val = p101_parse_uint16_t(env, err, str, 0);
-    P101_WRAPPER_DONE(env);
+    converted_count = 0;
+    if(count != 0U && (addresses == NULL || out == NULL || lengths == NULL || status == NULL))
+    {
+        P101_ERROR_RAISE_CHECK(err);
+        goto done;
+    }
+    has_error = p101_error_has_error(err);
+    if(has_error)
+    {
+        goto done;
+    }
+
+    for(index = 0; index < count; index++)
+    {
+        if(addresses[index] == NULL)
+        {
+            out[index].ss_family = AF_UNSPEC;
+            lengths[index]       = 0;
+        }
+        else
+        {
+            lengths[index] = convert_address_element(env, addresses[index], &out[index]);
+        }
+
+        if(lengths[index] == 0U)
+        {
+            status[index] = (uint8_t)P101_CONVERT_STATUS_ADDRESS;
+        }
+        else
+        {
+            status[index] = (uint8_t)P101_CONVERT_STATUS_OK;
+            converted_count++;
+        }
+    }
+
+done:
+    P101_TRACE_EXIT(env);
+    return converted_count;
+}
+
+/*
+ * The port of an endpoint: one or more decimal digits and nothing else, at
+ * most 65535. *value is in host order and only written on success.
+ */
+static enum p101_convert_status parse_endpoint_port(const struct p101_env *env, const char *port, const char *end, in_port_t *value)
+{
+    enum p101_convert_status ret_val;
+    unsigned int             number;
+
+    P101_TRACE(env);
+    ret_val = P101_CONVERT_STATUS_SYNTAX;
+    number  = 0;
+    if(port == end)
+    {
+        goto done;
+    }
+
+    for(; port < end; port++)
+    {
+        if(*port < ASCII_ZERO || *port > ASCII_NINE)
+        {
+            goto done;
+        }
+        /* Stop accumulating once out of range; the digits still have to be
+         * checked, since a later non-digit makes it a syntax error. */
+        if(number <= PORT_MAX)
+        {
+            number = (number * PORT_DECIMAL_BASE) + (unsigned int)(*port - ASCII_ZERO);
+        }
+    }
+
+    if(number > PORT_MAX)
+    {
+        ret_val = P101_CONVERT_STATUS_RANGE;
+        goto done;
+    }
+
+    *value  = (in_port_t)number;
+    ret_val = P101_CONVERT_STATUS_OK;
+
+done:
+    P101_TRACE_EXIT(env);
     return ret_val;
 }
 
-socklen_t p101_convert_address(const struct p101_env *env, struct p101_error *err, const char *address, struct sockaddr_storage *addr)
+/*
+ * Parse "a.b.c.d:port" or "[v6]:port" from the length bytes at endpoint
+ * straight into addr, port included. The port is found by scanning back from
+ * the end to the last colon, which for a valid endpoint is at most six
+ * bytes, and the address is then parsed in place between the start (or the
+ * brackets) and that colon, so nothing is copied and the text need not be
+ * NUL-terminated. An IPv6 address without brackets is rejected rather than
+ * having its last group misread as a port.
+ */
+static socklen_t convert_endpoint(const struct p101_env *env, struct p101_error *err, const char *endpoint, size_t length, struct sockaddr_storage *addr)
 {
-    struct sockaddr_un  sun;
-    struct sockaddr_in  sin;
-    struct sockaddr_in6 sin6;
-    size_t              path_length;
-    socklen_t           ret_val;
-    bool                has_error;
-    bool                is_dotted;
-    bool                is_invalid_argument;
-    bool                is_ipv4;
-    bool                unix_path;
-    int                 parse_result;
+    struct sockaddr_in      *sin;
+    struct sockaddr_in6     *sin6;
+    const char              *end;
+    const char              *port;
+    const char              *host_end;
+    enum p101_convert_status port_status;
+    in_port_t                port_value;
+    socklen_t                ret_val;
+    bool                     has_error;
+    bool                     parsed;
 
     P101_TRACE(env);
-    P101_WRAPPER_FAULT_RETURN(env, err, ret_val, 0);
     ret_val = 0;
-
     if(addr == NULL)
     {
         P101_ERROR_RAISE_CHECK(err);
@@ -196,7 +622,7 @@ socklen_t p101_convert_address(const struct p101_env *env, struct p101_error *er
 
     p101_memset(env, addr, 0, sizeof(*addr));
     addr->ss_family = AF_UNSPEC;
-    if(address == NULL)
+    if(endpoint == NULL)
     {
         P101_ERROR_RAISE_CHECK(err);
         goto done;
@@ -207,88 +633,731 @@ socklen_t p101_convert_address(const struct p101_env *env, struct p101_error *er
         goto done;
     }
 
-    p101_memset(env, &sin, 0, sizeof(sin));
-    is_ipv4 = is_strict_ipv4_literal(env, address);
-    if(is_ipv4)
+    end  = endpoint + length;
+    port = end;
+    while(port > endpoint && port[-1] != ASCII_COLON)
+    {
+        port--;
+    }
+    if(port == endpoint)
+    {
+        P101_ERROR_RAISE_USER(err, "The endpoint has no :port.", P101_CONVERT_ERROR_SYNTAX);
+        goto done;
+    }
+
+    port_value  = 0;
+    port_status = parse_endpoint_port(env, port, end, &port_value);
+    if(port_status == P101_CONVERT_STATUS_SYNTAX)
+    {
+        P101_ERROR_RAISE_USER(err, "The endpoint port is not a decimal number.", P101_CONVERT_ERROR_SYNTAX);
+        goto done;
+    }
+    if(port_status == P101_CONVERT_STATUS_RANGE)
+    {
+        P101_ERROR_RAISE_USER(err, "The endpoint port is out of range.", P101_CONVERT_ERROR_RANGE);
+        goto done;
+    }
+
+    host_end = port - 1;
+    if(*endpoint == ASCII_OPEN_BRACE)
     {
-        parse_result = p101_inet_pton(env, err, AF_INET, address, &sin.sin_addr);
-        if(parse_result == 1)
+        sin6   = (struct sockaddr_in6 *)(void *)addr;
+        parsed = host_end - endpoint >= 2 && host_end[-1] == ASCII_CLOSE_BRACE && parse_ipv6_literal(env, endpoint + 1, host_end - 1, &sin6->sin6_addr);
+        if(parsed)
         {
-            sin.sin_family = AF_INET;
+            sin6->sin6_family = AF_INET6;
+            sin6->sin6_port   = htons(port_value);
 #if defined(__APPLE__) || defined(__FreeBSD__)
-            sin.sin_len = (uint8_t)sizeof(sin);
+            sin6->sin6_len = (uint8_t)sizeof(*sin6);
 #endif
-            p101_memcpy(env, addr, &sin, sizeof(sin));
-            ret_val = (socklen_t)sizeof(sin);
+            ret_val = (socklen_t)sizeof(*sin6);
             goto done;
         }
-        has_error = p101_error_has_error(err);
-        if(has_error)
+        p101_memset(env, sin6, 0, sizeof(*sin6));
+    }
+    else
+    {
+        sin    = (struct sockaddr_in *)(void *)addr;
+        parsed = parse_strict_ipv4_literal(env, endpoint, host_end, &sin->sin_addr);
+        if(parsed)
         {
-            is_invalid_argument = p101_error_is_errno(err, EINVAL);
-            if(is_invalid_argument)
-            {
-                p101_error_reset(err);
-            }
-            else
-            {
-                goto done;
-            }
+            sin->sin_family = AF_INET;
+            sin->sin_port   = htons(port_value);
+#if defined(__APPLE__) || defined(__FreeBSD__)
+            sin->sin_len = (uint8_t)sizeof(*sin);
+#endif
+            ret_val = (socklen_t)sizeof(*sin);
+            goto done;
         }
+        p101_memset(env, sin, 0, sizeof(*sin));
     }
 
-    p101_memset(env, &sin6, 0, sizeof(sin6));
-    parse_result = p101_inet_pton(env, err, AF_INET6, address, &sin6.sin6_addr);
-    if(parse_result == 1)
+    addr->ss_family = AF_UNSPEC;
+    P101_ERROR_RAISE_USER(err, "The endpoint is not an IPv4 address or a bracketed IPv6 address followed by :port.", P101_CONVERT_ERROR_ADDRESS);
+
+done:
+    P101_TRACE_EXIT(env);
+    return ret_val;
+}
+
+/*
+ * A CIDR prefix length: decimal digits without a sign or leading zeros, at
+ * most max_length. *value is only written on success.
+ */
+static enum p101_convert_status parse_prefix_length(const struct p101_env *env, const char *prefix, const char *end, unsigned int max_length, uint8_t *value)
+{
+    enum p101_convert_status ret_val;
+    unsigned int             number;
+
+    P101_TRACE(env);
+    ret_val = P101_CONVERT_STATUS_SYNTAX;
+    number  = 0;
+    if(prefix == end || (*prefix == ASCII_ZERO && end - prefix > 1))
     {
-        sin6.sin6_family = AF_INET6;
-#if defined(__APPLE__) || defined(__FreeBSD__)
-        sin6.sin6_len = (uint8_t)sizeof(sin6);
-#endif
-        p101_memcpy(env, addr, &sin6, sizeof(sin6));
-        ret_val = (socklen_t)sizeof(sin6);
         goto done;
     }
-    has_error = p101_error_has_error(err);
-    if(has_error)
+
+    for(; prefix < end; prefix++)
     {
-        is_invalid_argument = p101_error_is_errno(err, EINVAL);
-        if(is_invalid_argument)
+        if(*prefix < ASCII_ZERO || *prefix > ASCII_NINE)
         {
-            p101_error_reset(err);
+            goto done;
         }
-        else
+        if(number <= max_length)
         {
-            goto done;
+            number = (number * IPV4_DECIMAL_BASE) + (unsigned int)(*prefix - ASCII_ZERO);
         }
     }
 
-    is_dotted = is_dotted_numeric_text(env, address);
-    unix_path = false;
-    if(!is_dotted)
+    if(number > max_length)
+    {
+        ret_val = P101_CONVERT_STATUS_RANGE;
+        goto done;
+    }
+
+    *value  = (uint8_t)number;
+    ret_val = P101_CONVERT_STATUS_OK;
+
+done:
+    P101_TRACE_EXIT(env);
+    return ret_val;
+}
+
+/*
+ * Zero every bit of the size-byte address past prefix_length, reporting
+ * whether any of them was set.
+ */
+static bool clear_host_bits(const struct p101_env *env, uint8_t *bytes, size_t size, unsigned int prefix_length)
+{
+    size_t index;
+    bool   had_host_bits;
+
+    P101_TRACE(env);
+    had_host_bits = false;
+    index         = prefix_length / BITS_PER_BYTE;
+    if(index < size && prefix_length % BITS_PER_BYTE != 0U)
     {
-        unix_path = is_unix_path(env, address);
+        uint8_t keep;
+
+        keep          = (uint8_t)(BYTE_MASK << (BITS_PER_BYTE - (prefix_length % BITS_PER_BYTE)));
+        had_host_bits = (bytes[index] & (uint8_t)~keep) != 0U;
+        bytes[index] &= keep;
+        index++;
     }
-    if(!is_dotted && unix_path)
+    for(; index < size; index++)
     {
-        path_length = p101_strlen(env, address);
-        if(path_length <= sizeof(sun.sun_path) - 1U)
-        {
-            p101_memset(env, &sun, 0, sizeof(sun));
-            p101_strncpy(env, sun.sun_path, address, sizeof(sun.sun_path) - 1U);
-            sun.sun_family = AF_UNIX;
-            ret_val        = (socklen_t)(offsetof(struct sockaddr_un, sun_path) + path_length + 1U);
-#if defined(__APPLE__) || defined(__FreeBSD__)
-            sun.sun_len = (uint8_t)ret_val;
-#endif
-            p101_memcpy(env, addr, &sun, sizeof(sun));
-            goto done;
-        }
+        had_host_bits = had_host_bits || bytes[index] != 0U;
+        bytes[index]  = 0;
     }
 
-    P101_ERROR_RAISE_USER(err, "The address is not an IPv4/IPv6 literal or an explicit Unix pathname.", P101_CONVERT_ERROR_ADDRESS);
+    P101_TRACE_EXIT(env);
+    return had_host_bits;
+}
 
-done:
+/*
+ * Parse "network/length" with the IPv4 and IPv6 literal rules of
+ * p101_convert_address(). One scan finds the slash and whether the address
+ * has a colon, which picks the parser; both halves are then parsed in
+ * place. A '/' here always means a prefix, never a Unix path.
+ */
+static bool convert_cidr(const struct p101_env *env, struct p101_error *err, const char *cidr, bool strict, struct p101_cidr *out)
+{
+    struct in_addr           in;
+    struct in6_addr          in6;
+    const char              *cursor;
+    const char              *slash;
+    enum p101_convert_status prefix_status;
+    bool                     saw_colon;
+    bool                     parsed;
+    bool                     had_host_bits;
+    bool                     has_error;
+    bool                     ret_val;
+
+    P101_TRACE(env);
+    ret_val = false;
+    if(out == NULL)
+    {
+        P101_ERROR_RAISE_CHECK(err);
+        goto done;
+    }
+
+    p101_memset(env, out, 0, sizeof(*out));
+    if(cidr == NULL)
+    {
+        P101_ERROR_RAISE_CHECK(err);
+        goto done;
+    }
+    has_error = p101_error_has_error(err);
+    if(has_error)
+    {
+        goto done;
+    }
+
+    slash     = NULL;
+    saw_colon = false;
+    for(cursor = cidr; *cursor != '\0'; cursor++)
+    {
+        if(*cursor == ASCII_SLASH && slash == NULL)
+        {
+            slash = cursor;
+        }
+        else if(*cursor == ASCII_COLON && slash == NULL)
+        {
+            saw_colon = true;
+        }
+    }
+
+    if(slash == NULL)
+    {
+        P101_ERROR_RAISE_USER(err, "The CIDR has no /prefix-length.", P101_CONVERT_ERROR_SYNTAX);
+        goto done;
+    }
+
+    if(saw_colon)
+    {
+        parsed = parse_ipv6_literal(env, cidr, slash, &in6);
+        if(parsed)
+        {
+            p101_memcpy(env, out->network.address, &in6, sizeof(in6));
+            out->network.family = P101_COMPACT_ADDRESS_IPV6;
+        }
+    }
+    else
+    {
+        parsed = parse_strict_ipv4_literal(env, cidr, slash, &in);
+        if(parsed)
+        {
+            p101_memcpy(env, out->network.address, &in, sizeof(in));
+            out->network.family = P101_COMPACT_ADDRESS_IPV4;
+        }
+    }
+    if(!parsed)
+    {
+        P101_ERROR_RAISE_USER(err, "The CIDR network is not an IPv4/IPv6 literal.", P101_CONVERT_ERROR_ADDRESS);
+        goto failed;
+    }
+
+    prefix_status = parse_prefix_length(env, slash + 1, cursor, saw_colon ? IPV6_PREFIX_MAX : IPV4_PREFIX_MAX, &out->prefix_length);
+    if(prefix_status == P101_CONVERT_STATUS_SYNTAX)
+    {
+        P101_ERROR_RAISE_USER(err, "The CIDR prefix length is not a decimal number.", P101_CONVERT_ERROR_SYNTAX);
+        goto failed;
+    }
+    if(prefix_status == P101_CONVERT_STATUS_RANGE)
+    {
+        P101_ERROR_RAISE_USER(err, "The CIDR prefix length is longer than the address.", P101_CONVERT_ERROR_RANGE);
+        goto failed;
+    }
+
+    had_host_bits = clear_host_bits(env, out->network.address, saw_colon ? sizeof(in6) : sizeof(in), out->prefix_length);
+    if(strict && had_host_bits)
+    {
+        P101_ERROR_RAISE_USER(err, "The CIDR network has bits set past its prefix length.", P101_CONVERT_ERROR_ADDRESS);
+        goto failed;
+    }
+
+    ret_val = true;
+    goto done;
+
+failed:
+    p101_memset(env, out, 0, sizeof(*out));
+
+done:
+    P101_TRACE_EXIT(env);
+    return ret_val;
+}
+
+static bool convert_compact_address(const struct p101_env *env, struct p101_error *err, const char *address, struct p101_compact_address *compact)
+{
+    struct in_addr     in;
+    struct in6_addr    in6;
+    enum address_class address_class;
+    size_t             length;
+    bool               has_error;
+    bool               ret_val;
+
+    P101_TRACE(env);
+    ret_val = false;
+    if(compact == NULL)
+    {
+        P101_ERROR_RAISE_CHECK(err);
+        goto done;
+    }
+
+    p101_memset(env, compact, 0, sizeof(*compact));
+    if(address == NULL)
+    {
+        P101_ERROR_RAISE_CHECK(err);
+        goto done;
+    }
+    has_error = p101_error_has_error(err);
+    if(has_error)
+    {
+        goto done;
+    }
+
+    address_class = classify_address(env, address, &length);
+    if(address_class == ADDRESS_CLASS_IPV4 && parse_strict_ipv4_literal(env, address, address + length, &in))
+    {
+        p101_memcpy(env, compact->address, &in, sizeof(in));
+        compact->family = P101_COMPACT_ADDRESS_IPV4;
+        ret_val         = true;
+        goto done;
+    }
+    if(address_class == ADDRESS_CLASS_IPV6 && parse_ipv6_literal(env, address, address + length, &in6))
+    {
+        p101_memcpy(env, compact->address, &in6, sizeof(in6));
+        compact->family = P101_COMPACT_ADDRESS_IPV6;
+        ret_val         = true;
+        goto done;
+    }
+
+    p101_memset(env, compact->address, 0, sizeof(compact->address));
+    P101_ERROR_RAISE_USER(err, "The address is not an IPv4/IPv6 literal.", P101_CONVERT_ERROR_ADDRESS);
+
+done:
+    P101_TRACE_EXIT(env);
+    return ret_val;
+}
+
+static socklen_t compact_address_to_sockaddr(const struct p101_env *env, struct p101_error *err, const struct p101_compact_address *compact, struct sockaddr_storage *addr)
+{
+    struct sockaddr_in  *sin;
+    struct sockaddr_in6 *sin6;
+    socklen_t            ret_val;
+    bool                 has_error;
+
+    P101_TRACE(env);
+    ret_val = 0;
+    if(compact == NULL || addr == NULL)
+    {
+        P101_ERROR_RAISE_CHECK(err);
+        goto done;
+    }
+    has_error = p101_error_has_error(err);
+    if(has_error)
+    {
+        goto done;
+    }
+
+    if(compact->family == P101_COMPACT_ADDRESS_IPV4)
+    {
+        sin = (struct sockaddr_in *)(void *)addr;
+        p101_memset(env, sin, 0, sizeof(*sin));
+        sin->sin_family = AF_INET;
+        sin->sin_port   = compact->port;
+        p101_memcpy(env, &sin->sin_addr, compact->address, sizeof(sin->sin_addr));
+#if defined(__APPLE__) || defined(__FreeBSD__)
+        sin->sin_len = (uint8_t)sizeof(*sin);
+#endif
+        ret_val = (socklen_t)sizeof(*sin);
+    }
+    else if(compact->family == P101_COMPACT_ADDRESS_IPV6)
+    {
+        sin6 = (struct sockaddr_in6 *)(void *)addr;
+        p101_memset(env, sin6, 0, sizeof(*sin6));
+        sin6->sin6_family   = AF_INET6;
+        sin6->sin6_port     = compact->port;
+        sin6->sin6_scope_id = compact->scope_id;
+        p101_memcpy(env, &sin6->sin6_addr, compact->address, sizeof(sin6->sin6_addr));
+#if defined(__APPLE__) || defined(__FreeBSD__)
+        sin6->sin6_len = (uint8_t)sizeof(*sin6);
+#endif
+        ret_val = (socklen_t)sizeof(*sin6);
+    }
+    else
+    {
+        addr->ss_family = AF_UNSPEC;
+        P101_ERROR_RAISE_USER(err, "The compact address holds no IPv4 or IPv6 address.", P101_CONVERT_ERROR_ADDRESS);
+    }
+
+done:
+    P101_TRACE_EXIT(env);
+    return ret_val;
+}
+
+// Callers must leave two bytes of slack past the longest text: each octet
+// stores all three digit bytes of its table entry.
+static char *format_ipv4(const uint8_t *bytes, char *out)
+{
+    for(unsigned int i = 0; i < IPV4_OCTET_COUNT; i++)
+    {
+        const char *text;
+
+        if(i != 0U)
+        {
+            *out++ = ASCII_DOT;
+        }
+        text   = octet_text[bytes[i]];
+        out[0] = text[0];
+        out[1] = text[1];
+        out[2] = text[2];
+        out += text[OCTET_TEXT_LENGTH];
+    }
+
+    return out;
+}
+
+/*
+ * RFC 5952 canonical text: lower-case hex without leading zeros, and "::" for
+ * the longest run of two or more zero groups, the first one on a tie. An
+ * IPv4-mapped address (::ffff:0:0/96) keeps its dotted-quad tail, as section
+ * 5 recommends and inet_ntop() writes.
+ */
+static char *format_ipv6(const uint8_t *bytes, char *out)
+{
+    unsigned int groups[IPV6_GROUP_COUNT];
+    unsigned int run_start;
+    unsigned int run_length;
+    unsigned int best_start;
+    unsigned int best_length;
+
+    run_start   = 0;
+    run_length  = 0;
+    best_start  = IPV6_GROUP_COUNT;
+    best_length = 1;
+    for(unsigned int i = 0; i < IPV6_GROUP_COUNT; i++)
+    {
+        groups[i] = ((unsigned int)bytes[i * IPV6_GROUP_SIZE] << BITS_PER_BYTE) | bytes[(i * IPV6_GROUP_SIZE) + 1U];
+        if(groups[i] != 0U)
+        {
+            run_length = 0;
+            continue;
+        }
+
+        if(run_length == 0U)
+        {
+            run_start = i;
+        }
+        run_length++;
+        if(run_length > best_length)
+        {
+            best_start  = run_start;
+            best_length = run_length;
+        }
+    }
+
+    if(best_start == 0U && best_length == IPV6_MAPPED_GROUP && groups[IPV6_MAPPED_GROUP] == UINT16_MAX)
+    {
+        for(const char *prefix = "::ffff:"; *prefix != '\0'; prefix++)
+        {
+            *out++ = *prefix;
+        }
+
+        return format_ipv4(&bytes[IPV6_ADDRESS_SIZE - IPV4_OCTET_COUNT], out);
+    }
+
+    for(unsigned int i = 0; i < IPV6_GROUP_COUNT; i++)
+    {
+        unsigned int shift;
+
+        if(i == best_start)
+        {
+            *out++ = ASCII_COLON;
+            i += best_length - 1U;
+            continue;
+        }
+
+        if(i != 0U)
+        {
+            *out++ = ASCII_COLON;
+        }
+        for(shift = (IPV6_MAX_DIGITS - 1U) * HEX_NIBBLE_BITS; shift > 0U && (groups[i] >> shift) == 0U; shift -= HEX_NIBBLE_BITS)
+        {
+        }
+        for(;; shift -= HEX_NIBBLE_BITS)
+        {
+            *out++ = hex_digits[(groups[i] >> shift) & HEX_NIBBLE_MASK];
+            if(shift == 0U)
+            {
+                break;
+            }
+        }
+    }
+
+    if(best_start + best_length == IPV6_GROUP_COUNT)
+    {
+        *out++ = ASCII_COLON;
+    }
+
+    return out;
+}
+
+static char *format_port(in_port_t port, char *out)
+{
+    char         digits[PORT_MAX_DIGITS];
+    unsigned int value;
+    unsigned int count;
+
+    value = ntohs(port);
+    count = 0;
+    do
+    {
+        digits[count++] = (char)(ASCII_ZERO + (value % PORT_DECIMAL_BASE));
+        value /= PORT_DECIMAL_BASE;
+    } while(value != 0U);
+
+    *out++ = ASCII_COLON;
+    while(count > 0U)
+    {
+        *out++ = digits[--count];
+    }
+
+    return out;
+}
+
+/*
+ * The inverse of p101_convert_address() and, with with_port,
+ * p101_convert_endpoint(). IP text is built in a local buffer sized for the
+ * longest endpoint, so the caller's buffer is written once, and only if the
+ * whole text fits.
+ */
+static size_t format_address(const struct p101_env *env, struct p101_error *err, const struct sockaddr *addr, bool with_port, char *buffer, size_t size)
+{
+    char                       text[P101_ENDPOINT_TEXT_SIZE + OCTET_TEXT_LENGTH];
+    const struct sockaddr_in  *sin;
+    const struct sockaddr_in6 *sin6;
+    const struct sockaddr_un  *sun;
+    const char                *source;
+    char                      *cursor;
+    size_t                     length;
+    size_t                     ret_val;
+    bool                       has_error;
+
+    P101_TRACE(env);
+    ret_val = 0;
+    if(addr == NULL || buffer == NULL)
+    {
+        P101_ERROR_RAISE_CHECK(err);
+        goto done;
+    }
+    has_error = p101_error_has_error(err);
+    if(has_error)
+    {
+        goto done;
+    }
+
+    source = text;
+    cursor = text;
+    if(addr->sa_family == AF_INET)
+    {
+        sin    = (const struct sockaddr_in *)(const void *)addr;
+        cursor = format_ipv4((const uint8_t *)&sin->sin_addr, cursor);
+        if(with_port)
+        {
+            cursor = format_port(sin->sin_port, cursor);
+        }
+        length = (size_t)(cursor - text);
+    }
+    else if(addr->sa_family == AF_INET6)
+    {
+        sin6 = (const struct sockaddr_in6 *)(const void *)addr;
+        if(with_port)
+        {
+            *cursor++ = ASCII_OPEN_BRACE;
+        }
+        cursor = format_ipv6(sin6->sin6_addr.s6_addr, cursor);
+        if(with_port)
+        {
+            *cursor++ = ASCII_CLOSE_BRACE;
+            cursor    = format_port(sin6->sin6_port, cursor);
+        }
+        length = (size_t)(cursor - text);
+    }
+    else if(addr->sa_family == AF_UNIX)
+    {
+        sun    = (const struct sockaddr_un *)(const void *)addr;
+        source = sun->sun_path;
+        for(length = 0; length < sizeof(sun->sun_path) && source[length] != '\0'; length++)
+        {
+        }
+
+        // An unnamed socket, or a Linux abstract one whose path starts with
+        // NUL, has no text that p101_convert_address() could read back.
+        if(length == 0U)
+        {
+            if(size != 0U)
+            {
+                buffer[0] = '\0';
+            }
+            P101_ERROR_RAISE_USER(err, "The Unix address has no path.", P101_CONVERT_ERROR_ADDRESS);
+            goto done;
+        }
+    }
+    else
+    {
+        if(size != 0U)
+        {
+            buffer[0] = '\0';
+        }
+        P101_ERROR_RAISE_USER(err, "The address is not IPv4, IPv6 or a Unix path.", P101_CONVERT_ERROR_ADDRESS);
+        goto done;
+    }
+
+    if(length >= size)
+    {
+        if(size != 0U)
+        {
+            buffer[0] = '\0';
+        }
+        P101_ERROR_RAISE_USER(err, "The buffer is too small for the address text.", P101_CONVERT_ERROR_RANGE);
+        goto done;
+    }
+
+    p101_memcpy(env, buffer, source, length);
+    buffer[length] = '\0';
+    ret_val        = length;
+
+done:
+    P101_TRACE_EXIT(env);
+    return ret_val;
+}
+
+in_port_t p101_parse_in_port_t(const struct p101_env *env, struct p101_error *err, const char *str)
+{
+    in_port_t ret_val;
+
+    P101_TRACE(env);
+    P101_WRAPPER_FAULT_RETURN(env, err, ret_val, 0);
+    ret_val = p101_parse_uint16_t(env, err, str, 0);
+    P101_WRAPPER_DONE(env);
+    return ret_val;
+}
+
+socklen_t p101_convert_address(const struct p101_env *env, struct p101_error *err, const char *address, struct sockaddr_storage *addr)
+{
+    socklen_t ret_val;
+    bool      has_error;
+
+    P101_TRACE(env);
+    P101_WRAPPER_FAULT_RETURN(env, err, ret_val, 0);
+    ret_val = 0;
+
+    if(addr == NULL)
+    {
+        P101_ERROR_RAISE_CHECK(err);
+        goto done;
+    }
+
+    p101_memset(env, addr, 0, sizeof(*addr));
+    addr->ss_family = AF_UNSPEC;
+    if(address == NULL)
+    {
+        P101_ERROR_RAISE_CHECK(err);
+        goto done;
+    }
+    has_error = p101_error_has_error(err);
+    if(has_error)
+    {
+        goto done;
+    }
+
+    ret_val = convert_address_element(env, address, addr);
+    if(ret_val != 0U)
+    {
+        goto done;
+    }
+
+    P101_ERROR_RAISE_USER(err, "The address is not an IPv4/IPv6 literal or an explicit Unix pathname.", P101_CONVERT_ERROR_ADDRESS);
+
+done:
+    P101_WRAPPER_DONE(env);
+    return ret_val;
+}
+
+size_t p101_convert_address_array(const struct p101_env *env, struct p101_error *err, const char *const *addresses, size_t count, struct sockaddr_storage *out, socklen_t *lengths, uint8_t *status)
+{
+    size_t ret_val;
+
+    P101_TRACE(env);
+    P101_WRAPPER_FAULT_RETURN(env, err, ret_val, 0);
+    ret_val = convert_address_array(env, err, addresses, count, out, lengths, status);
+    P101_WRAPPER_DONE(env);
+    return ret_val;
+}
+
+bool p101_convert_compact_address(const struct p101_env *env, struct p101_error *err, const char *address, struct p101_compact_address *compact)
+{
+    bool ret_val;
+
+    P101_TRACE(env);
+    P101_WRAPPER_FAULT_RETURN(env, err, ret_val, false);
+    ret_val = convert_compact_address(env, err, address, compact);
+    P101_WRAPPER_DONE(env);
+    return ret_val;
+}
+
+socklen_t p101_compact_address_to_sockaddr(const struct p101_env *env, struct p101_error *err, const struct p101_compact_address *compact, struct sockaddr_storage *addr)
+{
+    socklen_t ret_val;
+
+    P101_TRACE(env);
+    P101_WRAPPER_FAULT_RETURN(env, err, ret_val, 0);
+    ret_val = compact_address_to_sockaddr(env, err, compact, addr);
+    P101_WRAPPER_DONE(env);
+    return ret_val;
+}
+
+socklen_t p101_convert_endpoint(const struct p101_env *env, struct p101_error *err, const char *endpoint, size_t length, struct sockaddr_storage *addr)
+{
+    socklen_t ret_val;
+
+    P101_TRACE(env);
+    P101_WRAPPER_FAULT_RETURN(env, err, ret_val, 0);
+    ret_val = convert_endpoint(env, err, endpoint, length, addr);
+    P101_WRAPPER_DONE(env);
+    return ret_val;
+}
+
+bool p101_convert_cidr(const struct p101_env *env, struct p101_error *err, const char *cidr, bool strict, struct p101_cidr *out)
+{
+    bool ret_val;
+
+    P101_TRACE(env);
+    P101_WRAPPER_FAULT_RETURN(env, err, ret_val, false);
+    ret_val = convert_cidr(env, err, cidr, strict, out);
+    P101_WRAPPER_DONE(env);
+    return ret_val;
+}
+
+size_t p101_format_address(const struct p101_env *env, struct p101_error *err, const struct sockaddr *addr, char *buffer, size_t size)
+{
+    size_t ret_val;
+
+    P101_TRACE(env);
+    P101_WRAPPER_FAULT_RETURN(env, err, ret_val, 0);
+    ret_val = format_address(env, err, addr, false, buffer, size);
+    P101_WRAPPER_DONE(env);
+    return ret_val;
+}
+
+size_t p101_format_endpoint(const struct p101_env *env, struct p101_error *err, const struct sockaddr *addr, char *buffer, size_t size)
+{
+    size_t ret_val;
+
+    P101_TRACE(env);
+    P101_WRAPPER_FAULT_RETURN(env, err, ret_val, 0);
+    ret_val = format_address(env, err, addr, true, buffer, size);
     P101_WRAPPER_DONE(env);
     return ret_val;
 }
@@ -1,5 +1,7 @@
 # Generated by generate-wrapper-unit-tests.py; do not edit.
 set(P101_FAULT_SHARD_TESTS
+    test_fault_wrappers_floating
     test_fault_wrappers_integer
+    test_fault_wrappers_lpm
     test_fault_wrappers_networking
 )
@@ -1,4 +1,6 @@
+#include <p101_convert/floating.h>
 #include <p101_convert/integer.h>
+#include <p101_convert/lpm.h>
 #include <p101_convert/networking.h>
 
 int main()
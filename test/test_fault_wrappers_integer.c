@@ -9,7 +9,9 @@
 #include <math.h>
 #include <netinet/in.h>
 #include <p101_convert/errors.h>
+#include <p101_convert/floating.h>
 #include <p101_convert/integer.h>
+#include <p101_convert/lpm.h>
 #include <p101_convert/networking.h>
 #include <p101_env/env.h>
 #include <p101_error/error.h>
@@ -192,8 +194,8 @@ static void count_resource_event(const struct p101_env *env, p101_env_resource_k
     fault_resource_events++;
 }
 
-/* P101_TEST_CASE(p101_parse_char) */
-static void test_p101_parse_char(struct p101_env *env, struct p101_error *err)
+/* P101_TEST_CASE(p101_format_char) */
+static void test_p101_format_char(struct p101_env *env, struct p101_error *err)
 {
 #ifdef __linux__
     static const int         errors[]      = {EIO};
@@ -219,14 +221,14 @@ static void test_p101_parse_char(struct p101_env *env, struct p101_error *err)
         fault_resource_events = 0U;
         errno                 = P101_TEST_ERRNO_SENTINEL;
         p101_env_set_fault_injector(env, fail_next_call, &state);
-        char result = p101_parse_char(env, err, NULL, 0);
+        size_t result = p101_format_char(env, err, 0, NULL, 0);
         (void)result;
         EXPECT(state.checks == 1);
         EXPECT(p101_error_is_errno(err, state.code));
         EXPECT(errno == P101_TEST_ERRNO_SENTINEL);
         EXPECT(result == (0));
         EXPECT(fault_resource_events == 0U);
-        write_outcome("p101_parse_char", "errno", error_names[index], state.code, failures == failures_before);
+        write_outcome("p101_format_char", "errno", error_names[index], state.code, failures == failures_before);
         p101_error_reset(err);
     }
     p101_env_set_fault_injector(env, NULL, NULL);
@@ -270,7 +272,8 @@ static void test_p101_parse_char(struct p101_env *env, struct p101_error *err)
                 native_child_status = 77;
                 goto native_child_done_;
             }
-            char native_result = p101_parse_char(native_env, native_err, "1", 0);
+            char   native_argument_4[P101_INTEGER_TEXT_SIZE] = {0};
+            size_t native_result                             = p101_format_char(native_env, native_err, 42, native_argument_4, sizeof(native_argument_4));
             (void)native_result;
             if(p101_error_has_error(native_err))
             {
@@ -285,7 +288,7 @@ static void test_p101_parse_char(struct p101_env *env, struct p101_error *err)
                 }
                 if(!native_error_declared)
                 {
-                    fprintf(stderr, "native smoke produced an undeclared platform failure: p101_parse_char: %s\n", p101_error_get_message(native_err));
+                    fprintf(stderr, "native smoke produced an undeclared platform failure: p101_format_char: %s\n", p101_error_get_message(native_err));
                     native_passed = false;
                 }
                 p101_error_reset(native_err);
@@ -300,18 +303,18 @@ static void test_p101_parse_char(struct p101_env *env, struct p101_error *err)
             EXPECT(native_waitpid_nointr(native_pid, &native_status) == native_pid);
             if(WIFSIGNALED(native_status))
             {
-                fprintf(stderr, "native smoke terminated by signal: p101_parse_char: %d\n", WTERMSIG(native_status));
+                fprintf(stderr, "native smoke terminated by signal: p101_format_char: %d\n", WTERMSIG(native_status));
             }
             EXPECT(WIFEXITED(native_status));
             if(WIFEXITED(native_status) && WEXITSTATUS(native_status) == 77)
             {
-                fprintf(stderr, "native smoke fixture unavailable: p101_parse_char\n");
+                fprintf(stderr, "native smoke fixture unavailable: p101_format_char\n");
             }
             else if(WIFEXITED(native_status))
             {
                 if(WEXITSTATUS(native_status) != EXIT_SUCCESS)
                 {
-                    fprintf(stderr, "native smoke exited unsuccessfully: p101_parse_char: %d\n", WEXITSTATUS(native_status));
+                    fprintf(stderr, "native smoke exited unsuccessfully: p101_format_char: %d\n", WEXITSTATUS(native_status));
                 }
                 EXPECT(WEXITSTATUS(native_status) == EXIT_SUCCESS);
             }
@@ -320,8 +323,8 @@ static void test_p101_parse_char(struct p101_env *env, struct p101_error *err)
     }
 }
 
-/* P101_TEST_CASE(p101_parse_int) */
-static void test_p101_parse_int(struct p101_env *env, struct p101_error *err)
+/* P101_TEST_CASE(p101_format_int) */
+static void test_p101_format_int(struct p101_env *env, struct p101_error *err)
 {
 #ifdef __linux__
     static const int         errors[]      = {EIO};
@@ -347,14 +350,14 @@ static void test_p101_parse_int(struct p101_env *env, struct p101_error *err)
         fault_resource_events = 0U;
         errno                 = P101_TEST_ERRNO_SENTINEL;
         p101_env_set_fault_injector(env, fail_next_call, &state);
-        int result = p101_parse_int(env, err, NULL, 0);
+        size_t result = p101_format_int(env, err, 0, NULL, 0);
         (void)result;
         EXPECT(state.checks == 1);
         EXPECT(p101_error_is_errno(err, state.code));
         EXPECT(errno == P101_TEST_ERRNO_SENTINEL);
         EXPECT(result == (0));
         EXPECT(fault_resource_events == 0U);
-        write_outcome("p101_parse_int", "errno", error_names[index], state.code, failures == failures_before);
+        write_outcome("p101_format_int", "errno", error_names[index], state.code, failures == failures_before);
         p101_error_reset(err);
     }
     p101_env_set_fault_injector(env, NULL, NULL);
@@ -398,7 +401,8 @@ static void test_p101_parse_int(struct p101_env *env, struct p101_error *err)
                 native_child_status = 77;
                 goto native_child_done_;
             }
-            int native_result = p101_parse_int(native_env, native_err, "1", 0);
+            char   native_argument_4[P101_INTEGER_TEXT_SIZE] = {0};
+            size_t native_result                             = p101_format_int(native_env, native_err, 42, native_argument_4, sizeof(native_argument_4));
             (void)native_result;
             if(p101_error_has_error(native_err))
             {
@@ -413,7 +417,7 @@ static void test_p101_parse_int(struct p101_env *env, struct p101_error *err)
                 }
                 if(!native_error_declared)
                 {
-                    fprintf(stderr, "native smoke produced an undeclared platform failure: p101_parse_int: %s\n", p101_error_get_message(native_err));
+                    fprintf(stderr, "native smoke produced an undeclared platform failure: p101_format_int: %s\n", p101_error_get_message(native_err));
                     native_passed = false;
                 }
                 p101_error_reset(native_err);
@@ -428,18 +432,18 @@ static void test_p101_parse_int(struct p101_env *env, struct p101_error *err)
             EXPECT(native_waitpid_nointr(native_pid, &native_status) == native_pid);
             if(WIFSIGNALED(native_status))
             {
-                fprintf(stderr, "native smoke terminated by signal: p101_parse_int: %d\n", WTERMSIG(native_status));
+                fprintf(stderr, "native smoke terminated by signal: p101_format_int: %d\n", WTERMSIG(native_status));
             }
             EXPECT(WIFEXITED(native_status));
             if(WIFEXITED(native_status) && WEXITSTATUS(native_status) == 77)
             {
-                fprintf(stderr, "native smoke fixture unavailable: p101_parse_int\n");
+                fprintf(stderr, "native smoke fixture unavailable: p101_format_int\n");
             }
             else if(WIFEXITED(native_status))
             {
                 if(WEXITSTATUS(native_status) != EXIT_SUCCESS)
                 {
-                    fprintf(stderr, "native smoke exited unsuccessfully: p101_parse_int: %d\n", WEXITSTATUS(native_status));
+                    fprintf(stderr, "native smoke exited unsuccessfully: p101_format_int: %d\n", WEXITSTATUS(native_status));
                 }
                 EXPECT(WEXITSTATUS(native_status) == EXIT_SUCCESS);
             }
@@ -448,8 +452,8 @@ static void test_p101_parse_int(struct p101_env *env, struct p101_error *err)
     }
 }
 
-/* P101_TEST_CASE(p101_parse_int16_t) */
-static void test_p101_parse_int16_t(struct p101_env *env, struct p101_error *err)
+/* P101_TEST_CASE(p101_format_int16_t) */
+static void test_p101_format_int16_t(struct p101_env *env, struct p101_error *err)
 {
 #ifdef __linux__
     static const int         errors[]      = {EIO};
@@ -475,14 +479,14 @@ static void test_p101_parse_int16_t(struct p101_env *env, struct p101_error *err
         fault_resource_events = 0U;
         errno                 = P101_TEST_ERRNO_SENTINEL;
         p101_env_set_fault_injector(env, fail_next_call, &state);
-        int16_t result = p101_parse_int16_t(env, err, NULL, 0);
+        size_t result = p101_format_int16_t(env, err, 0, NULL, 0);
         (void)result;
         EXPECT(state.checks == 1);
         EXPECT(p101_error_is_errno(err, state.code));
         EXPECT(errno == P101_TEST_ERRNO_SENTINEL);
         EXPECT(result == (0));
         EXPECT(fault_resource_events == 0U);
-        write_outcome("p101_parse_int16_t", "errno", error_names[index], state.code, failures == failures_before);
+        write_outcome("p101_format_int16_t", "errno", error_names[index], state.code, failures == failures_before);
         p101_error_reset(err);
     }
     p101_env_set_fault_injector(env, NULL, NULL);
@@ -526,7 +530,8 @@ static void test_p101_parse_int16_t(struct p101_env *env, struct p101_error *err
                 native_child_status = 77;
                 goto native_child_done_;
             }
-            int16_t native_result = p101_parse_int16_t(native_env, native_err, "1", 0);
+            char   native_argument_4[P101_INTEGER_TEXT_SIZE] = {0};
+            size_t native_result                             = p101_format_int16_t(native_env, native_err, 42, native_argument_4, sizeof(native_argument_4));
             (void)native_result;
             if(p101_error_has_error(native_err))
             {
@@ -541,7 +546,7 @@ static void test_p101_parse_int16_t(struct p101_env *env, struct p101_error *err
                 }
                 if(!native_error_declared)
                 {
-                    fprintf(stderr, "native smoke produced an undeclared platform failure: p101_parse_int16_t: %s\n", p101_error_get_message(native_err));
+                    fprintf(stderr, "native smoke produced an undeclared platform failure: p101_format_int16_t: %s\n", p101_error_get_message(native_err));
                     native_passed = false;
                 }
                 p101_error_reset(native_err);
@@ -556,18 +561,18 @@ static void test_p101_parse_int16_t(struct p101_env *env, struct p101_error *err
             EXPECT(native_waitpid_nointr(native_pid, &native_status) == native_pid);
             if(WIFSIGNALED(native_status))
             {
-                fprintf(stderr, "native smoke terminated by signal: p101_parse_int16_t: %d\n", WTERMSIG(native_status));
+                fprintf(stderr, "native smoke terminated by signal: p101_format_int16_t: %d\n", WTERMSIG(native_status));
             }
             EXPECT(WIFEXITED(native_status));
             if(WIFEXITED(native_status) && WEXITSTATUS(native_status) == 77)
             {
-                fprintf(stderr, "native smoke fixture unavailable: p101_parse_int16_t\n");
+                fprintf(stderr, "native smoke fixture unavailable: p101_format_int16_t\n");
             }
             else if(WIFEXITED(native_status))
             {
                 if(WEXITSTATUS(native_status) != EXIT_SUCCESS)
                 {
-                    fprintf(stderr, "native smoke exited unsuccessfully: p101_parse_int16_t: %d\n", WEXITSTATUS(native_status));
+                    fprintf(stderr, "native smoke exited unsuccessfully: p101_format_int16_t: %d\n", WEXITSTATUS(native_status));
                 }
                 EXPECT(WEXITSTATUS(native_status) == EXIT_SUCCESS);
             }
@@ -576,8 +581,8 @@ static void test_p101_parse_int16_t(struct p101_env *env, struct p101_error *err
     }
 }
 
-/* P101_TEST_CASE(p101_parse_int32_t) */
-static void test_p101_parse_int32_t(struct p101_env *env, struct p101_error *err)
+/* P101_TEST_CASE(p101_format_int32_t) */
+static void test_p101_format_int32_t(struct p101_env *env, struct p101_error *err)
 {
 #ifdef __linux__
     static const int         errors[]      = {EIO};
@@ -603,14 +608,14 @@ static void test_p101_parse_int32_t(struct p101_env *env, struct p101_error *err
         fault_resource_events = 0U;
         errno                 = P101_TEST_ERRNO_SENTINEL;
         p101_env_set_fault_injector(env, fail_next_call, &state);
-        int32_t result = p101_parse_int32_t(env, err, NULL, 0);
+        size_t result = p101_format_int32_t(env, err, 0, NULL, 0);
         (void)result;
         EXPECT(state.checks == 1);
         EXPECT(p101_error_is_errno(err, state.code));
         EXPECT(errno == P101_TEST_ERRNO_SENTINEL);
         EXPECT(result == (0));
         EXPECT(fault_resource_events == 0U);
-        write_outcome("p101_parse_int32_t", "errno", error_names[index], state.code, failures == failures_before);
+        write_outcome("p101_format_int32_t", "errno", error_names[index], state.code, failures == failures_before);
         p101_error_reset(err);
     }
     p101_env_set_fault_injector(env, NULL, NULL);
@@ -654,7 +659,8 @@ static void test_p101_parse_int32_t(struct p101_env *env, struct p101_error *err
                 native_child_status = 77;
                 goto native_child_done_;
             }
-            int32_t native_result = p101_parse_int32_t(native_env, native_err, "1", 0);
+            char   native_argument_4[P101_INTEGER_TEXT_SIZE] = {0};
+            size_t native_result                             = p101_format_int32_t(native_env, native_err, 42, native_argument_4, sizeof(native_argument_4));
             (void)native_result;
             if(p101_error_has_error(native_err))
             {
@@ -669,7 +675,7 @@ static void test_p101_parse_int32_t(struct p101_env *env, struct p101_error *err
                 }
                 if(!native_error_declared)
                 {
-                    fprintf(stderr, "native smoke produced an undeclared platform failure: p101_parse_int32_t: %s\n", p101_error_get_message(native_err));
+                    fprintf(stderr, "native smoke produced an undeclared platform failure: p101_format_int32_t: %s\n", p101_error_get_message(native_err));
                     native_passed = false;
                 }
                 p101_error_reset(native_err);
@@ -684,18 +690,18 @@ static void test_p101_parse_int32_t(struct p101_env *env, struct p101_error *err
             EXPECT(native_waitpid_nointr(native_pid, &native_status) == native_pid);
             if(WIFSIGNALED(native_status))
             {
-                fprintf(stderr, "native smoke terminated by signal: p101_parse_int32_t: %d\n", WTERMSIG(native_status));
+                fprintf(stderr, "native smoke terminated by signal: p101_format_int32_t: %d\n", WTERMSIG(native_status));
             }
             EXPECT(WIFEXITED(native_status));
             if(WIFEXITED(native_status) && WEXITSTATUS(native_status) == 77)
             {
-                fprintf(stderr, "native smoke fixture unavailable: p101_parse_int32_t\n");
+                fprintf(stderr, "native smoke fixture unavailable: p101_format_int32_t\n");
             }
             else if(WIFEXITED(native_status))
             {
                 if(WEXITSTATUS(native_status) != EXIT_SUCCESS)
                 {
-                    fprintf(stderr, "native smoke exited unsuccessfully: p101_parse_int32_t: %d\n", WEXITSTATUS(native_status));
+                    fprintf(stderr, "native smoke exited unsuccessfully: p101_format_int32_t: %d\n", WEXITSTATUS(native_status));
                 }
                 EXPECT(WEXITSTATUS(native_status) == EXIT_SUCCESS);
             }
@@ -704,8 +710,8 @@ static void test_p101_parse_int32_t(struct p101_env *env, struct p101_error *err
     }
 }
 
-/* P101_TEST_CASE(p101_parse_int64_t) */
-static void test_p101_parse_int64_t(struct p101_env *env, struct p101_error *err)
+/* P101_TEST_CASE(p101_format_int64_t) */
+static void test_p101_format_int64_t(struct p101_env *env, struct p101_error *err)
 {
 #ifdef __linux__
     static const int         errors[]      = {EIO};
@@ -731,14 +737,14 @@ static void test_p101_parse_int64_t(struct p101_env *env, struct p101_error *err
         fault_resource_events = 0U;
         errno                 = P101_TEST_ERRNO_SENTINEL;
         p101_env_set_fault_injector(env, fail_next_call, &state);
-        int64_t result = p101_parse_int64_t(env, err, NULL, 0);
+        size_t result = p101_format_int64_t(env, err, 0, NULL, 0);
         (void)result;
         EXPECT(state.checks == 1);
         EXPECT(p101_error_is_errno(err, state.code));
         EXPECT(errno == P101_TEST_ERRNO_SENTINEL);
         EXPECT(result == (0));
         EXPECT(fault_resource_events == 0U);
-        write_outcome("p101_parse_int64_t", "errno", error_names[index], state.code, failures == failures_before);
+        write_outcome("p101_format_int64_t", "errno", error_names[index], state.code, failures == failures_before);
         p101_error_reset(err);
     }
     p101_env_set_fault_injector(env, NULL, NULL);
@@ -782,7 +788,8 @@ static void test_p101_parse_int64_t(struct p101_env *env, struct p101_error *err
                 native_child_status = 77;
                 goto native_child_done_;
             }
-            int64_t native_result = p101_parse_int64_t(native_env, native_err, "1", 0);
+            char   native_argument_4[P101_INTEGER_TEXT_SIZE] = {0};
+            size_t native_result                             = p101_format_int64_t(native_env, native_err, 42, native_argument_4, sizeof(native_argument_4));
             (void)native_result;
             if(p101_error_has_error(native_err))
             {
@@ -797,7 +804,7 @@ static void test_p101_parse_int64_t(struct p101_env *env, struct p101_error *err
                 }
                 if(!native_error_declared)
                 {
-                    fprintf(stderr, "native smoke produced an undeclared platform failure: p101_parse_int64_t: %s\n", p101_error_get_message(native_err));
+                    fprintf(stderr, "native smoke produced an undeclared platform failure: p101_format_int64_t: %s\n", p101_error_get_message(native_err));
                     native_passed = false;
                 }
                 p101_error_reset(native_err);
@@ -812,18 +819,18 @@ static void test_p101_parse_int64_t(struct p101_env *env, struct p101_error *err
             EXPECT(native_waitpid_nointr(native_pid, &native_status) == native_pid);
             if(WIFSIGNALED(native_status))
             {
-                fprintf(stderr, "native smoke terminated by signal: p101_parse_int64_t: %d\n", WTERMSIG(native_status));
+                fprintf(stderr, "native smoke terminated by signal: p101_format_int64_t: %d\n", WTERMSIG(native_status));
             }
             EXPECT(WIFEXITED(native_status));
             if(WIFEXITED(native_status) && WEXITSTATUS(native_status) == 77)
             {
-                fprintf(stderr, "native smoke fixture unavailable: p101_parse_int64_t\n");
+                fprintf(stderr, "native smoke fixture unavailable: p101_format_int64_t\n");
             }
             else if(WIFEXITED(native_status))
             {
                 if(WEXITSTATUS(native_status) != EXIT_SUCCESS)
                 {
-                    fprintf(stderr, "native smoke exited unsuccessfully: p101_parse_int64_t: %d\n", WEXITSTATUS(native_status));
+                    fprintf(stderr, "native smoke exited unsuccessfully: p101_format_int64_t: %d\n", WEXITSTATUS(native_status));
                 }
                 EXPECT(WEXITSTATUS(native_status) == EXIT_SUCCESS);
             }
@@ -832,8 +839,8 @@ static void test_p101_parse_int64_t(struct p101_env *env, struct p101_error *err
     }
 }
 
-/* P101_TEST_CASE(p101_parse_int8_t) */
-static void test_p101_parse_int8_t(struct p101_env *env, struct p101_error *err)
+/* P101_TEST_CASE(p101_format_int8_t) */
+static void test_p101_format_int8_t(struct p101_env *env, struct p101_error *err)
 {
 #ifdef __linux__
     static const int         errors[]      = {EIO};
@@ -859,14 +866,14 @@ static void test_p101_parse_int8_t(struct p101_env *env, struct p101_error *err)
         fault_resource_events = 0U;
         errno                 = P101_TEST_ERRNO_SENTINEL;
         p101_env_set_fault_injector(env, fail_next_call, &state);
-        int8_t result = p101_parse_int8_t(env, err, NULL, 0);
+        size_t result = p101_format_int8_t(env, err, 0, NULL, 0);
         (void)result;
         EXPECT(state.checks == 1);
         EXPECT(p101_error_is_errno(err, state.code));
         EXPECT(errno == P101_TEST_ERRNO_SENTINEL);
         EXPECT(result == (0));
         EXPECT(fault_resource_events == 0U);
-        write_outcome("p101_parse_int8_t", "errno", error_names[index], state.code, failures == failures_before);
+        write_outcome("p101_format_int8_t", "errno", error_names[index], state.code, failures == failures_before);
         p101_error_reset(err);
     }
     p101_env_set_fault_injector(env, NULL, NULL);
@@ -910,7 +917,8 @@ static void test_p101_parse_int8_t(struct p101_env *env, struct p101_error *err)
                 native_child_status = 77;
                 goto native_child_done_;
             }
-            int8_t native_result = p101_parse_int8_t(native_env, native_err, "1", 0);
+            char   native_argument_4[P101_INTEGER_TEXT_SIZE] = {0};
+            size_t native_result                             = p101_format_int8_t(native_env, native_err, 42, native_argument_4, sizeof(native_argument_4));
             (void)native_result;
             if(p101_error_has_error(native_err))
             {
@@ -925,7 +933,7 @@ static void test_p101_parse_int8_t(struct p101_env *env, struct p101_error *err)
                 }
                 if(!native_error_declared)
                 {
-                    fprintf(stderr, "native smoke produced an undeclared platform failure: p101_parse_int8_t: %s\n", p101_error_get_message(native_err));
+                    fprintf(stderr, "native smoke produced an undeclared platform failure: p101_format_int8_t: %s\n", p101_error_get_message(native_err));
                     native_passed = false;
                 }
                 p101_error_reset(native_err);
@@ -940,18 +948,18 @@ static void test_p101_parse_int8_t(struct p101_env *env, struct p101_error *err)
             EXPECT(native_waitpid_nointr(native_pid, &native_status) == native_pid);
             if(WIFSIGNALED(native_status))
             {
-                fprintf(stderr, "native smoke terminated by signal: p101_parse_int8_t: %d\n", WTERMSIG(native_status));
+                fprintf(stderr, "native smoke terminated by signal: p101_format_int8_t: %d\n", WTERMSIG(native_status));
             }
             EXPECT(WIFEXITED(native_status));
             if(WIFEXITED(native_status) && WEXITSTATUS(native_status) == 77)
             {
-                fprintf(stderr, "native smoke fixture unavailable: p101_parse_int8_t\n");
+                fprintf(stderr, "native smoke fixture unavailable: p101_format_int8_t\n");
             }
             else if(WIFEXITED(native_status))
             {
                 if(WEXITSTATUS(native_status) != EXIT_SUCCESS)
                 {
-                    fprintf(stderr, "native smoke exited unsuccessfully: p101_parse_int8_t: %d\n", WEXITSTATUS(native_status));
+                    fprintf(stderr, "native smoke exited unsuccessfully: p101_format_int8_t: %d\n", WEXITSTATUS(native_status));
                 }
                 EXPECT(WEXITSTATUS(native_status) == EXIT_SUCCESS);
             }
@@ -960,8 +968,8 @@ static void test_p101_parse_int8_t(struct p101_env *env, struct p101_error *err)
     }
 }
 
-/* P101_TEST_CASE(p101_parse_long) */
-static void test_p101_parse_long(struct p101_env *env, struct p101_error *err)
+/* P101_TEST_CASE(p101_format_long) */
+static void test_p101_format_long(struct p101_env *env, struct p101_error *err)
 {
 #ifdef __linux__
     static const int         errors[]      = {EIO};
@@ -987,14 +995,14 @@ static void test_p101_parse_long(struct p101_env *env, struct p101_error *err)
         fault_resource_events = 0U;
         errno                 = P101_TEST_ERRNO_SENTINEL;
         p101_env_set_fault_injector(env, fail_next_call, &state);
-        long result = p101_parse_long(env, err, NULL, 0);
+        size_t result = p101_format_long(env, err, 0, NULL, 0);
         (void)result;
         EXPECT(state.checks == 1);
         EXPECT(p101_error_is_errno(err, state.code));
         EXPECT(errno == P101_TEST_ERRNO_SENTINEL);
         EXPECT(result == (0));
         EXPECT(fault_resource_events == 0U);
-        write_outcome("p101_parse_long", "errno", error_names[index], state.code, failures == failures_before);
+        write_outcome("p101_format_long", "errno", error_names[index], state.code, failures == failures_before);
         p101_error_reset(err);
     }
     p101_env_set_fault_injector(env, NULL, NULL);
@@ -1038,7 +1046,8 @@ static void test_p101_parse_long(struct p101_env *env, struct p101_error *err)
                 native_child_status = 77;
                 goto native_child_done_;
             }
-            long native_result = p101_parse_long(native_env, native_err, "1", 0);
+            char   native_argument_4[P101_INTEGER_TEXT_SIZE] = {0};
+            size_t native_result                             = p101_format_long(native_env, native_err, 42, native_argument_4, sizeof(native_argument_4));
             (void)native_result;
             if(p101_error_has_error(native_err))
             {
@@ -1053,7 +1062,7 @@ static void test_p101_parse_long(struct p101_env *env, struct p101_error *err)
                 }
                 if(!native_error_declared)
                 {
-                    fprintf(stderr, "native smoke produced an undeclared platform failure: p101_parse_long: %s\n", p101_error_get_message(native_err));
+                    fprintf(stderr, "native smoke produced an undeclared platform failure: p101_format_long: %s\n", p101_error_get_message(native_err));
                     native_passed = false;
                 }
                 p101_error_reset(native_err);
@@ -1068,18 +1077,18 @@ static void test_p101_parse_long(struct p101_env *env, struct p101_error *err)
             EXPECT(native_waitpid_nointr(native_pid, &native_status) == native_pid);
             if(WIFSIGNALED(native_status))
             {
-                fprintf(stderr, "native smoke terminated by signal: p101_parse_long: %d\n", WTERMSIG(native_status));
+                fprintf(stderr, "native smoke terminated by signal: p101_format_long: %d\n", WTERMSIG(native_status));
             }
             EXPECT(WIFEXITED(native_status));
             if(WIFEXITED(native_status) && WEXITSTATUS(native_status) == 77)
             {
-                fprintf(stderr, "native smoke fixture unavailable: p101_parse_long\n");
+                fprintf(stderr, "native smoke fixture unavailable: p101_format_long\n");
             }
             else if(WIFEXITED(native_status))
             {
                 if(WEXITSTATUS(native_status) != EXIT_SUCCESS)
                 {
-                    fprintf(stderr, "native smoke exited unsuccessfully: p101_parse_long: %d\n", WEXITSTATUS(native_status));
+                    fprintf(stderr, "native smoke exited unsuccessfully: p101_format_long: %d\n", WEXITSTATUS(native_status));
                 }
                 EXPECT(WEXITSTATUS(native_status) == EXIT_SUCCESS);
             }
@@ -1088,8 +1097,8 @@ static void test_p101_parse_long(struct p101_env *env, struct p101_error *err)
     }
 }
 
-/* P101_TEST_CASE(p101_parse_long_long) */
-static void test_p101_parse_long_long(struct p101_env *env, struct p101_error *err)
+/* P101_TEST_CASE(p101_format_long_long) */
+static void test_p101_format_long_long(struct p101_env *env, struct p101_error *err)
 {
 #ifdef __linux__
     static const int         errors[]      = {EIO};
@@ -1115,14 +1124,14 @@ static void test_p101_parse_long_long(struct p101_env *env, struct p101_error *e
         fault_resource_events = 0U;
         errno                 = P101_TEST_ERRNO_SENTINEL;
         p101_env_set_fault_injector(env, fail_next_call, &state);
-        long long result = p101_parse_long_long(env, err, NULL, 0);
+        size_t result = p101_format_long_long(env, err, 0, NULL, 0);
         (void)result;
         EXPECT(state.checks == 1);
         EXPECT(p101_error_is_errno(err, state.code));
         EXPECT(errno == P101_TEST_ERRNO_SENTINEL);
         EXPECT(result == (0));
         EXPECT(fault_resource_events == 0U);
-        write_outcome("p101_parse_long_long", "errno", error_names[index], state.code, failures == failures_before);
+        write_outcome("p101_format_long_long", "errno", error_names[index], state.code, failures == failures_before);
         p101_error_reset(err);
     }
     p101_env_set_fault_injector(env, NULL, NULL);
@@ -1166,7 +1175,8 @@ static void test_p101_parse_long_long(struct p101_env *env, struct p101_error *e
                 native_child_status = 77;
                 goto native_child_done_;
             }
-            long long native_result = p101_parse_long_long(native_env, native_err, "1", 0);
+            char   native_argument_4[P101_INTEGER_TEXT_SIZE] = {0};
+            size_t native_result                             = p101_format_long_long(native_env, native_err, 42, native_argument_4, sizeof(native_argument_4));
             (void)native_result;
             if(p101_error_has_error(native_err))
             {
@@ -1181,7 +1191,7 @@ static void test_p101_parse_long_long(struct p101_env *env, struct p101_error *e
                 }
                 if(!native_error_declared)
                 {
-                    fprintf(stderr, "native smoke produced an undeclared platform failure: p101_parse_long_long: %s\n", p101_error_get_message(native_err));
+                    fprintf(stderr, "native smoke produced an undeclared platform failure: p101_format_long_long: %s\n", p101_error_get_message(native_err));
                     native_passed = false;
                 }
                 p101_error_reset(native_err);
@@ -1196,18 +1206,18 @@ static void test_p101_parse_long_long(struct p101_env *env, struct p101_error *e
             EXPECT(native_waitpid_nointr(native_pid, &native_status) == native_pid);
             if(WIFSIGNALED(native_status))
             {
-                fprintf(stderr, "native smoke terminated by signal: p101_parse_long_long: %d\n", WTERMSIG(native_status));
+                fprintf(stderr, "native smoke terminated by signal: p101_format_long_long: %d\n", WTERMSIG(native_status));
             }
             EXPECT(WIFEXITED(native_status));
             if(WIFEXITED(native_status) && WEXITSTATUS(native_status) == 77)
             {
-                fprintf(stderr, "native smoke fixture unavailable: p101_parse_long_long\n");
+                fprintf(stderr, "native smoke fixture unavailable: p101_format_long_long\n");
             }
             else if(WIFEXITED(native_status))
             {
                 if(WEXITSTATUS(native_status) != EXIT_SUCCESS)
                 {
-                    fprintf(stderr, "native smoke exited unsuccessfully: p101_parse_long_long: %d\n", WEXITSTATUS(native_status));
+                    fprintf(stderr, "native smoke exited unsuccessfully: p101_format_long_long: %d\n", WEXITSTATUS(native_status));
                 }
                 EXPECT(WEXITSTATUS(native_status) == EXIT_SUCCESS);
             }
@@ -1216,8 +1226,8 @@ static void test_p101_parse_long_long(struct p101_env *env, struct p101_error *e
     }
 }
 
-/* P101_TEST_CASE(p101_parse_negative_char) */
-static void test_p101_parse_negative_char(struct p101_env *env, struct p101_error *err)
+/* P101_TEST_CASE(p101_format_short) */
+static void test_p101_format_short(struct p101_env *env, struct p101_error *err)
 {
 #ifdef __linux__
     static const int         errors[]      = {EIO};
@@ -1243,14 +1253,14 @@ static void test_p101_parse_negative_char(struct p101_env *env, struct p101_erro
         fault_resource_events = 0U;
         errno                 = P101_TEST_ERRNO_SENTINEL;
         p101_env_set_fault_injector(env, fail_next_call, &state);
-        signed char result = p101_parse_negative_char(env, err, NULL, 0);
+        size_t result = p101_format_short(env, err, 0, NULL, 0);
         (void)result;
         EXPECT(state.checks == 1);
         EXPECT(p101_error_is_errno(err, state.code));
         EXPECT(errno == P101_TEST_ERRNO_SENTINEL);
         EXPECT(result == (0));
         EXPECT(fault_resource_events == 0U);
-        write_outcome("p101_parse_negative_char", "errno", error_names[index], state.code, failures == failures_before);
+        write_outcome("p101_format_short", "errno", error_names[index], state.code, failures == failures_before);
         p101_error_reset(err);
     }
     p101_env_set_fault_injector(env, NULL, NULL);
@@ -1294,7 +1304,8 @@ static void test_p101_parse_negative_char(struct p101_env *env, struct p101_erro
                 native_child_status = 77;
                 goto native_child_done_;
             }
-            signed char native_result = p101_parse_negative_char(native_env, native_err, "-1", 0);
+            char   native_argument_4[P101_INTEGER_TEXT_SIZE] = {0};
+            size_t native_result                             = p101_format_short(native_env, native_err, 42, native_argument_4, sizeof(native_argument_4));
             (void)native_result;
             if(p101_error_has_error(native_err))
             {
@@ -1309,7 +1320,7 @@ static void test_p101_parse_negative_char(struct p101_env *env, struct p101_erro
                 }
                 if(!native_error_declared)
                 {
-                    fprintf(stderr, "native smoke produced an undeclared platform failure: p101_parse_negative_char: %s\n", p101_error_get_message(native_err));
+                    fprintf(stderr, "native smoke produced an undeclared platform failure: p101_format_short: %s\n", p101_error_get_message(native_err));
                     native_passed = false;
                 }
                 p101_error_reset(native_err);
@@ -1324,18 +1335,18 @@ static void test_p101_parse_negative_char(struct p101_env *env, struct p101_erro
             EXPECT(native_waitpid_nointr(native_pid, &native_status) == native_pid);
             if(WIFSIGNALED(native_status))
             {
-                fprintf(stderr, "native smoke terminated by signal: p101_parse_negative_char: %d\n", WTERMSIG(native_status));
+                fprintf(stderr, "native smoke terminated by signal: p101_format_short: %d\n", WTERMSIG(native_status));
             }
             EXPECT(WIFEXITED(native_status));
             if(WIFEXITED(native_status) && WEXITSTATUS(native_status) == 77)
             {
-                fprintf(stderr, "native smoke fixture unavailable: p101_parse_negative_char\n");
+                fprintf(stderr, "native smoke fixture unavailable: p101_format_short\n");
             }
             else if(WIFEXITED(native_status))
             {
                 if(WEXITSTATUS(native_status) != EXIT_SUCCESS)
                 {
-                    fprintf(stderr, "native smoke exited unsuccessfully: p101_parse_negative_char: %d\n", WEXITSTATUS(native_status));
+                    fprintf(stderr, "native smoke exited unsuccessfully: p101_format_short: %d\n", WEXITSTATUS(native_status));
                 }
                 EXPECT(WEXITSTATUS(native_status) == EXIT_SUCCESS);
             }
@@ -1344,8 +1355,8 @@ static void test_p101_parse_negative_char(struct p101_env *env, struct p101_erro
     }
 }
 
-/* P101_TEST_CASE(p101_parse_negative_int) */
-static void test_p101_parse_negative_int(struct p101_env *env, struct p101_error *err)
+/* P101_TEST_CASE(p101_format_signed_char) */
+static void test_p101_format_signed_char(struct p101_env *env, struct p101_error *err)
 {
 #ifdef __linux__
     static const int         errors[]      = {EIO};
@@ -1371,14 +1382,14 @@ static void test_p101_parse_negative_int(struct p101_env *env, struct p101_error
         fault_resource_events = 0U;
         errno                 = P101_TEST_ERRNO_SENTINEL;
         p101_env_set_fault_injector(env, fail_next_call, &state);
-        int result = p101_parse_negative_int(env, err, NULL, 0);
+        size_t result = p101_format_signed_char(env, err, 0, NULL, 0);
         (void)result;
         EXPECT(state.checks == 1);
         EXPECT(p101_error_is_errno(err, state.code));
         EXPECT(errno == P101_TEST_ERRNO_SENTINEL);
         EXPECT(result == (0));
         EXPECT(fault_resource_events == 0U);
-        write_outcome("p101_parse_negative_int", "errno", error_names[index], state.code, failures == failures_before);
+        write_outcome("p101_format_signed_char", "errno", error_names[index], state.code, failures == failures_before);
         p101_error_reset(err);
     }
     p101_env_set_fault_injector(env, NULL, NULL);
@@ -1422,7 +1433,8 @@ static void test_p101_parse_negative_int(struct p101_env *env, struct p101_error
                 native_child_status = 77;
                 goto native_child_done_;
             }
-            int native_result = p101_parse_negative_int(native_env, native_err, "-1", 0);
+            char   native_argument_4[P101_INTEGER_TEXT_SIZE] = {0};
+            size_t native_result                             = p101_format_signed_char(native_env, native_err, 42, native_argument_4, sizeof(native_argument_4));
             (void)native_result;
             if(p101_error_has_error(native_err))
             {
@@ -1437,7 +1449,7 @@ static void test_p101_parse_negative_int(struct p101_env *env, struct p101_error
                 }
                 if(!native_error_declared)
                 {
-                    fprintf(stderr, "native smoke produced an undeclared platform failure: p101_parse_negative_int: %s\n", p101_error_get_message(native_err));
+                    fprintf(stderr, "native smoke produced an undeclared platform failure: p101_format_signed_char: %s\n", p101_error_get_message(native_err));
                     native_passed = false;
                 }
                 p101_error_reset(native_err);
@@ -1452,18 +1464,18 @@ static void test_p101_parse_negative_int(struct p101_env *env, struct p101_error
             EXPECT(native_waitpid_nointr(native_pid, &native_status) == native_pid);
             if(WIFSIGNALED(native_status))
             {
-                fprintf(stderr, "native smoke terminated by signal: p101_parse_negative_int: %d\n", WTERMSIG(native_status));
+                fprintf(stderr, "native smoke terminated by signal: p101_format_signed_char: %d\n", WTERMSIG(native_status));
             }
             EXPECT(WIFEXITED(native_status));
             if(WIFEXITED(native_status) && WEXITSTATUS(native_status) == 77)
             {
-                fprintf(stderr, "native smoke fixture unavailable: p101_parse_negative_int\n");
+                fprintf(stderr, "native smoke fixture unavailable: p101_format_signed_char\n");
             }
             else if(WIFEXITED(native_status))
             {
                 if(WEXITSTATUS(native_status) != EXIT_SUCCESS)
                 {
-                    fprintf(stderr, "native smoke exited unsuccessfully: p101_parse_negative_int: %d\n", WEXITSTATUS(native_status));
+                    fprintf(stderr, "native smoke exited unsuccessfully: p101_format_signed_char: %d\n", WEXITSTATUS(native_status));
                 }
                 EXPECT(WEXITSTATUS(native_status) == EXIT_SUCCESS);
             }
@@ -1472,8 +1484,8 @@ static void test_p101_parse_negative_int(struct p101_env *env, struct p101_error
     }
 }
 
-/* P101_TEST_CASE(p101_parse_negative_int16_t) */
-static void test_p101_parse_negative_int16_t(struct p101_env *env, struct p101_error *err)
+/* P101_TEST_CASE(p101_format_uint16_t) */
+static void test_p101_format_uint16_t(struct p101_env *env, struct p101_error *err)
 {
 #ifdef __linux__
     static const int         errors[]      = {EIO};
@@ -1499,14 +1511,14 @@ static void test_p101_parse_negative_int16_t(struct p101_env *env, struct p101_e
         fault_resource_events = 0U;
         errno                 = P101_TEST_ERRNO_SENTINEL;
         p101_env_set_fault_injector(env, fail_next_call, &state);
-        int16_t result = p101_parse_negative_int16_t(env, err, NULL, 0);
+        size_t result = p101_format_uint16_t(env, err, 0, NULL, 0);
         (void)result;
         EXPECT(state.checks == 1);
         EXPECT(p101_error_is_errno(err, state.code));
         EXPECT(errno == P101_TEST_ERRNO_SENTINEL);
         EXPECT(result == (0));
         EXPECT(fault_resource_events == 0U);
-        write_outcome("p101_parse_negative_int16_t", "errno", error_names[index], state.code, failures == failures_before);
+        write_outcome("p101_format_uint16_t", "errno", error_names[index], state.code, failures == failures_before);
         p101_error_reset(err);
     }
     p101_env_set_fault_injector(env, NULL, NULL);
@@ -1550,7 +1562,8 @@ static void test_p101_parse_negative_int16_t(struct p101_env *env, struct p101_e
                 native_child_status = 77;
                 goto native_child_done_;
             }
-            int16_t native_result = p101_parse_negative_int16_t(native_env, native_err, "-1", 0);
+            char   native_argument_4[P101_INTEGER_TEXT_SIZE] = {0};
+            size_t native_result                             = p101_format_uint16_t(native_env, native_err, 42, native_argument_4, sizeof(native_argument_4));
             (void)native_result;
             if(p101_error_has_error(native_err))
             {
@@ -1565,7 +1578,7 @@ static void test_p101_parse_negative_int16_t(struct p101_env *env, struct p101_e
                 }
                 if(!native_error_declared)
                 {
-                    fprintf(stderr, "native smoke produced an undeclared platform failure: p101_parse_negative_int16_t: %s\n", p101_error_get_message(native_err));
+                    fprintf(stderr, "native smoke produced an undeclared platform failure: p101_format_uint16_t: %s\n", p101_error_get_message(native_err));
                     native_passed = false;
                 }
                 p101_error_reset(native_err);
@@ -1580,18 +1593,18 @@ static void test_p101_parse_negative_int16_t(struct p101_env *env, struct p101_e
             EXPECT(native_waitpid_nointr(native_pid, &native_status) == native_pid);
             if(WIFSIGNALED(native_status))
             {
-                fprintf(stderr, "native smoke terminated by signal: p101_parse_negative_int16_t: %d\n", WTERMSIG(native_status));
+                fprintf(stderr, "native smoke terminated by signal: p101_format_uint16_t: %d\n", WTERMSIG(native_status));
             }
             EXPECT(WIFEXITED(native_status));
             if(WIFEXITED(native_status) && WEXITSTATUS(native_status) == 77)
             {
-                fprintf(stderr, "native smoke fixture unavailable: p101_parse_negative_int16_t\n");
+                fprintf(stderr, "native smoke fixture unavailable: p101_format_uint16_t\n");
             }
             else if(WIFEXITED(native_status))
             {
                 if(WEXITSTATUS(native_status) != EXIT_SUCCESS)
                 {
-                    fprintf(stderr, "native smoke exited unsuccessfully: p101_parse_negative_int16_t: %d\n", WEXITSTATUS(native_status));
+                    fprintf(stderr, "native smoke exited unsuccessfully: p101_format_uint16_t: %d\n", WEXITSTATUS(native_status));
                 }
                 EXPECT(WEXITSTATUS(native_status) == EXIT_SUCCESS);
             }
@@ -1600,8 +1613,8 @@ static void test_p101_parse_negative_int16_t(struct p101_env *env, struct p101_e
     }
 }
 
-/* P101_TEST_CASE(p101_parse_negative_int32_t) */
-static void test_p101_parse_negative_int32_t(struct p101_env *env, struct p101_error *err)
+/* P101_TEST_CASE(p101_format_uint32_t) */
+static void test_p101_format_uint32_t(struct p101_env *env, struct p101_error *err)
 {
 #ifdef __linux__
     static const int         errors[]      = {EIO};
@@ -1627,14 +1640,14 @@ static void test_p101_parse_negative_int32_t(struct p101_env *env, struct p101_e
         fault_resource_events = 0U;
         errno                 = P101_TEST_ERRNO_SENTINEL;
         p101_env_set_fault_injector(env, fail_next_call, &state);
-        int32_t result = p101_parse_negative_int32_t(env, err, NULL, 0);
+        size_t result = p101_format_uint32_t(env, err, 0, NULL, 0);
         (void)result;
         EXPECT(state.checks == 1);
         EXPECT(p101_error_is_errno(err, state.code));
         EXPECT(errno == P101_TEST_ERRNO_SENTINEL);
         EXPECT(result == (0));
         EXPECT(fault_resource_events == 0U);
-        write_outcome("p101_parse_negative_int32_t", "errno", error_names[index], state.code, failures == failures_before);
+        write_outcome("p101_format_uint32_t", "errno", error_names[index], state.code, failures == failures_before);
         p101_error_reset(err);
     }
     p101_env_set_fault_injector(env, NULL, NULL);
@@ -1678,7 +1691,8 @@ static void test_p101_parse_negative_int32_t(struct p101_env *env, struct p101_e
                 native_child_status = 77;
                 goto native_child_done_;
             }
-            int32_t native_result = p101_parse_negative_int32_t(native_env, native_err, "-1", 0);
+            char   native_argument_4[P101_INTEGER_TEXT_SIZE] = {0};
+            size_t native_result                             = p101_format_uint32_t(native_env, native_err, 42, native_argument_4, sizeof(native_argument_4));
             (void)native_result;
             if(p101_error_has_error(native_err))
             {
@@ -1693,7 +1707,7 @@ static void test_p101_parse_negative_int32_t(struct p101_env *env, struct p101_e
                 }
                 if(!native_error_declared)
                 {
-                    fprintf(stderr, "native smoke produced an undeclared platform failure: p101_parse_negative_int32_t: %s\n", p101_error_get_message(native_err));
+                    fprintf(stderr, "native smoke produced an undeclared platform failure: p101_format_uint32_t: %s\n", p101_error_get_message(native_err));
                     native_passed = false;
                 }
                 p101_error_reset(native_err);
@@ -1708,18 +1722,18 @@ static void test_p101_parse_negative_int32_t(struct p101_env *env, struct p101_e
             EXPECT(native_waitpid_nointr(native_pid, &native_status) == native_pid);
             if(WIFSIGNALED(native_status))
             {
-                fprintf(stderr, "native smoke terminated by signal: p101_parse_negative_int32_t: %d\n", WTERMSIG(native_status));
+                fprintf(stderr, "native smoke terminated by signal: p101_format_uint32_t: %d\n", WTERMSIG(native_status));
             }
             EXPECT(WIFEXITED(native_status));
             if(WIFEXITED(native_status) && WEXITSTATUS(native_status) == 77)
             {
-                fprintf(stderr, "native smoke fixture unavailable: p101_parse_negative_int32_t\n");
+                fprintf(stderr, "native smoke fixture unavailable: p101_format_uint32_t\n");
             }
             else if(WIFEXITED(native_status))
             {
                 if(WEXITSTATUS(native_status) != EXIT_SUCCESS)
                 {
-                    fprintf(stderr, "native smoke exited unsuccessfully: p101_parse_negative_int32_t: %d\n", WEXITSTATUS(native_status));
+                    fprintf(stderr, "native smoke exited unsuccessfully: p101_format_uint32_t: %d\n", WEXITSTATUS(native_status));
                 }
                 EXPECT(WEXITSTATUS(native_status) == EXIT_SUCCESS);
             }
@@ -1728,8 +1742,8 @@ static void test_p101_parse_negative_int32_t(struct p101_env *env, struct p101_e
     }
 }
 
-/* P101_TEST_CASE(p101_parse_negative_int64_t) */
-static void test_p101_parse_negative_int64_t(struct p101_env *env, struct p101_error *err)
+/* P101_TEST_CASE(p101_format_uint64_t) */
+static void test_p101_format_uint64_t(struct p101_env *env, struct p101_error *err)
 {
 #ifdef __linux__
     static const int         errors[]      = {EIO};
@@ -1755,14 +1769,14 @@ static void test_p101_parse_negative_int64_t(struct p101_env *env, struct p101_e
         fault_resource_events = 0U;
         errno                 = P101_TEST_ERRNO_SENTINEL;
         p101_env_set_fault_injector(env, fail_next_call, &state);
-        int64_t result = p101_parse_negative_int64_t(env, err, NULL, 0);
+        size_t result = p101_format_uint64_t(env, err, 0, NULL, 0);
         (void)result;
         EXPECT(state.checks == 1);
         EXPECT(p101_error_is_errno(err, state.code));
         EXPECT(errno == P101_TEST_ERRNO_SENTINEL);
         EXPECT(result == (0));
         EXPECT(fault_resource_events == 0U);
-        write_outcome("p101_parse_negative_int64_t", "errno", error_names[index], state.code, failures == failures_before);
+        write_outcome("p101_format_uint64_t", "errno", error_names[index], state.code, failures == failures_before);
         p101_error_reset(err);
     }
     p101_env_set_fault_injector(env, NULL, NULL);
@@ -1806,7 +1820,8 @@ static void test_p101_parse_negative_int64_t(struct p101_env *env, struct p101_e
                 native_child_status = 77;
                 goto native_child_done_;
             }
-            int64_t native_result = p101_parse_negative_int64_t(native_env, native_err, "-1", 0);
+            char   native_argument_4[P101_INTEGER_TEXT_SIZE] = {0};
+            size_t native_result                             = p101_format_uint64_t(native_env, native_err, 42, native_argument_4, sizeof(native_argument_4));
             (void)native_result;
             if(p101_error_has_error(native_err))
             {
@@ -1821,7 +1836,7 @@ static void test_p101_parse_negative_int64_t(struct p101_env *env, struct p101_e
                 }
                 if(!native_error_declared)
                 {
-                    fprintf(stderr, "native smoke produced an undeclared platform failure: p101_parse_negative_int64_t: %s\n", p101_error_get_message(native_err));
+                    fprintf(stderr, "native smoke produced an undeclared platform failure: p101_format_uint64_t: %s\n", p101_error_get_message(native_err));
                     native_passed = false;
                 }
                 p101_error_reset(native_err);
@@ -1836,18 +1851,18 @@ static void test_p101_parse_negative_int64_t(struct p101_env *env, struct p101_e
             EXPECT(native_waitpid_nointr(native_pid, &native_status) == native_pid);
             if(WIFSIGNALED(native_status))
             {
-                fprintf(stderr, "native smoke terminated by signal: p101_parse_negative_int64_t: %d\n", WTERMSIG(native_status));
+                fprintf(stderr, "native smoke terminated by signal: p101_format_uint64_t: %d\n", WTERMSIG(native_status));
             }
             EXPECT(WIFEXITED(native_status));
             if(WIFEXITED(native_status) && WEXITSTATUS(native_status) == 77)
             {
-                fprintf(stderr, "native smoke fixture unavailable: p101_parse_negative_int64_t\n");
+                fprintf(stderr, "native smoke fixture unavailable: p101_format_uint64_t\n");
             }
             else if(WIFEXITED(native_status))
             {
                 if(WEXITSTATUS(native_status) != EXIT_SUCCESS)
                 {
-                    fprintf(stderr, "native smoke exited unsuccessfully: p101_parse_negative_int64_t: %d\n", WEXITSTATUS(native_status));
+                    fprintf(stderr, "native smoke exited unsuccessfully: p101_format_uint64_t: %d\n", WEXITSTATUS(native_status));
                 }
                 EXPECT(WEXITSTATUS(native_status) == EXIT_SUCCESS);
             }
@@ -1856,8 +1871,8 @@ static void test_p101_parse_negative_int64_t(struct p101_env *env, struct p101_e
     }
 }
 
-/* P101_TEST_CASE(p101_parse_negative_int8_t) */
-static void test_p101_parse_negative_int8_t(struct p101_env *env, struct p101_error *err)
+/* P101_TEST_CASE(p101_format_uint8_t) */
+static void test_p101_format_uint8_t(struct p101_env *env, struct p101_error *err)
 {
 #ifdef __linux__
     static const int         errors[]      = {EIO};
@@ -1883,14 +1898,14 @@ static void test_p101_parse_negative_int8_t(struct p101_env *env, struct p101_er
         fault_resource_events = 0U;
         errno                 = P101_TEST_ERRNO_SENTINEL;
         p101_env_set_fault_injector(env, fail_next_call, &state);
-        int8_t result = p101_parse_negative_int8_t(env, err, NULL, 0);
+        size_t result = p101_format_uint8_t(env, err, 0, NULL, 0);
         (void)result;
         EXPECT(state.checks == 1);
         EXPECT(p101_error_is_errno(err, state.code));
         EXPECT(errno == P101_TEST_ERRNO_SENTINEL);
         EXPECT(result == (0));
         EXPECT(fault_resource_events == 0U);
-        write_outcome("p101_parse_negative_int8_t", "errno", error_names[index], state.code, failures == failures_before);
+        write_outcome("p101_format_uint8_t", "errno", error_names[index], state.code, failures == failures_before);
         p101_error_reset(err);
     }
     p101_env_set_fault_injector(env, NULL, NULL);
@@ -1934,7 +1949,8 @@ static void test_p101_parse_negative_int8_t(struct p101_env *env, struct p101_er
                 native_child_status = 77;
                 goto native_child_done_;
             }
-            int8_t native_result = p101_parse_negative_int8_t(native_env, native_err, "-1", 0);
+            char   native_argument_4[P101_INTEGER_TEXT_SIZE] = {0};
+            size_t native_result                             = p101_format_uint8_t(native_env, native_err, 42, native_argument_4, sizeof(native_argument_4));
             (void)native_result;
             if(p101_error_has_error(native_err))
             {
@@ -1949,7 +1965,7 @@ static void test_p101_parse_negative_int8_t(struct p101_env *env, struct p101_er
                 }
                 if(!native_error_declared)
                 {
-                    fprintf(stderr, "native smoke produced an undeclared platform failure: p101_parse_negative_int8_t: %s\n", p101_error_get_message(native_err));
+                    fprintf(stderr, "native smoke produced an undeclared platform failure: p101_format_uint8_t: %s\n", p101_error_get_message(native_err));
                     native_passed = false;
                 }
                 p101_error_reset(native_err);
@@ -1964,18 +1980,18 @@ static void test_p101_parse_negative_int8_t(struct p101_env *env, struct p101_er
             EXPECT(native_waitpid_nointr(native_pid, &native_status) == native_pid);
             if(WIFSIGNALED(native_status))
             {
-                fprintf(stderr, "native smoke terminated by signal: p101_parse_negative_int8_t: %d\n", WTERMSIG(native_status));
+                fprintf(stderr, "native smoke terminated by signal: p101_format_uint8_t: %d\n", WTERMSIG(native_status));
             }
             EXPECT(WIFEXITED(native_status));
             if(WIFEXITED(native_status) && WEXITSTATUS(native_status) == 77)
             {
-                fprintf(stderr, "native smoke fixture unavailable: p101_parse_negative_int8_t\n");
+                fprintf(stderr, "native smoke fixture unavailable: p101_format_uint8_t\n");
             }
             else if(WIFEXITED(native_status))
             {
                 if(WEXITSTATUS(native_status) != EXIT_SUCCESS)
                 {
-                    fprintf(stderr, "native smoke exited unsuccessfully: p101_parse_negative_int8_t: %d\n", WEXITSTATUS(native_status));
+                    fprintf(stderr, "native smoke exited unsuccessfully: p101_format_uint8_t: %d\n", WEXITSTATUS(native_status));
                 }
                 EXPECT(WEXITSTATUS(native_status) == EXIT_SUCCESS);
             }
@@ -1984,8 +2000,8 @@ static void test_p101_parse_negative_int8_t(struct p101_env *env, struct p101_er
     }
 }
 
-/* P101_TEST_CASE(p101_parse_negative_long) */
-static void test_p101_parse_negative_long(struct p101_env *env, struct p101_error *err)
+/* P101_TEST_CASE(p101_format_unsigned_char) */
+static void test_p101_format_unsigned_char(struct p101_env *env, struct p101_error *err)
 {
 #ifdef __linux__
     static const int         errors[]      = {EIO};
@@ -2011,14 +2027,14 @@ static void test_p101_parse_negative_long(struct p101_env *env, struct p101_erro
         fault_resource_events = 0U;
         errno                 = P101_TEST_ERRNO_SENTINEL;
         p101_env_set_fault_injector(env, fail_next_call, &state);
-        long result = p101_parse_negative_long(env, err, NULL, 0);
+        size_t result = p101_format_unsigned_char(env, err, 0, NULL, 0);
         (void)result;
         EXPECT(state.checks == 1);
         EXPECT(p101_error_is_errno(err, state.code));
         EXPECT(errno == P101_TEST_ERRNO_SENTINEL);
         EXPECT(result == (0));
         EXPECT(fault_resource_events == 0U);
-        write_outcome("p101_parse_negative_long", "errno", error_names[index], state.code, failures == failures_before);
+        write_outcome("p101_format_unsigned_char", "errno", error_names[index], state.code, failures == failures_before);
         p101_error_reset(err);
     }
     p101_env_set_fault_injector(env, NULL, NULL);
@@ -2062,7 +2078,8 @@ static void test_p101_parse_negative_long(struct p101_env *env, struct p101_erro
                 native_child_status = 77;
                 goto native_child_done_;
             }
-            long native_result = p101_parse_negative_long(native_env, native_err, "-1", 0);
+            char   native_argument_4[P101_INTEGER_TEXT_SIZE] = {0};
+            size_t native_result                             = p101_format_unsigned_char(native_env, native_err, 42, native_argument_4, sizeof(native_argument_4));
             (void)native_result;
             if(p101_error_has_error(native_err))
             {
@@ -2077,7 +2094,7 @@ static void test_p101_parse_negative_long(struct p101_env *env, struct p101_erro
                 }
                 if(!native_error_declared)
                 {
-                    fprintf(stderr, "native smoke produced an undeclared platform failure: p101_parse_negative_long: %s\n", p101_error_get_message(native_err));
+                    fprintf(stderr, "native smoke produced an undeclared platform failure: p101_format_unsigned_char: %s\n", p101_error_get_message(native_err));
                     native_passed = false;
                 }
                 p101_error_reset(native_err);
@@ -2092,18 +2109,18 @@ static void test_p101_parse_negative_long(struct p101_env *env, struct p101_erro
             EXPECT(native_waitpid_nointr(native_pid, &native_status) == native_pid);
             if(WIFSIGNALED(native_status))
             {
-                fprintf(stderr, "native smoke terminated by signal: p101_parse_negative_long: %d\n", WTERMSIG(native_status));
+                fprintf(stderr, "native smoke terminated by signal: p101_format_unsigned_char: %d\n", WTERMSIG(native_status));
             }
             EXPECT(WIFEXITED(native_status));
             if(WIFEXITED(native_status) && WEXITSTATUS(native_status) == 77)
             {
-                fprintf(stderr, "native smoke fixture unavailable: p101_parse_negative_long\n");
+                fprintf(stderr, "native smoke fixture unavailable: p101_format_unsigned_char\n");
             }
             else if(WIFEXITED(native_status))
             {
                 if(WEXITSTATUS(native_status) != EXIT_SUCCESS)
                 {
-                    fprintf(stderr, "native smoke exited unsuccessfully: p101_parse_negative_long: %d\n", WEXITSTATUS(native_status));
+                    fprintf(stderr, "native smoke exited unsuccessfully: p101_format_unsigned_char: %d\n", WEXITSTATUS(native_status));
                 }
                 EXPECT(WEXITSTATUS(native_status) == EXIT_SUCCESS);
             }
@@ -2112,8 +2129,8 @@ static void test_p101_parse_negative_long(struct p101_env *env, struct p101_erro
     }
 }
 
-/* P101_TEST_CASE(p101_parse_negative_long_long) */
-static void test_p101_parse_negative_long_long(struct p101_env *env, struct p101_error *err)
+/* P101_TEST_CASE(p101_format_unsigned_int) */
+static void test_p101_format_unsigned_int(struct p101_env *env, struct p101_error *err)
 {
 #ifdef __linux__
     static const int         errors[]      = {EIO};
@@ -2139,14 +2156,14 @@ static void test_p101_parse_negative_long_long(struct p101_env *env, struct p101
         fault_resource_events = 0U;
         errno                 = P101_TEST_ERRNO_SENTINEL;
         p101_env_set_fault_injector(env, fail_next_call, &state);
-        long long result = p101_parse_negative_long_long(env, err, NULL, 0);
+        size_t result = p101_format_unsigned_int(env, err, 0, NULL, 0);
         (void)result;
         EXPECT(state.checks == 1);
         EXPECT(p101_error_is_errno(err, state.code));
         EXPECT(errno == P101_TEST_ERRNO_SENTINEL);
         EXPECT(result == (0));
         EXPECT(fault_resource_events == 0U);
-        write_outcome("p101_parse_negative_long_long", "errno", error_names[index], state.code, failures == failures_before);
+        write_outcome("p101_format_unsigned_int", "errno", error_names[index], state.code, failures == failures_before);
         p101_error_reset(err);
     }
     p101_env_set_fault_injector(env, NULL, NULL);
@@ -2190,7 +2207,8 @@ static void test_p101_parse_negative_long_long(struct p101_env *env, struct p101
                 native_child_status = 77;
                 goto native_child_done_;
             }
-            long long native_result = p101_parse_negative_long_long(native_env, native_err, "-1", 0);
+            char   native_argument_4[P101_INTEGER_TEXT_SIZE] = {0};
+            size_t native_result                             = p101_format_unsigned_int(native_env, native_err, 42, native_argument_4, sizeof(native_argument_4));
             (void)native_result;
             if(p101_error_has_error(native_err))
             {
@@ -2205,7 +2223,7 @@ static void test_p101_parse_negative_long_long(struct p101_env *env, struct p101
                 }
                 if(!native_error_declared)
                 {
-                    fprintf(stderr, "native smoke produced an undeclared platform failure: p101_parse_negative_long_long: %s\n", p101_error_get_message(native_err));
+                    fprintf(stderr, "native smoke produced an undeclared platform failure: p101_format_unsigned_int: %s\n", p101_error_get_message(native_err));
                     native_passed = false;
                 }
                 p101_error_reset(native_err);
@@ -2220,18 +2238,18 @@ static void test_p101_parse_negative_long_long(struct p101_env *env, struct p101
             EXPECT(native_waitpid_nointr(native_pid, &native_status) == native_pid);
             if(WIFSIGNALED(native_status))
             {
-                fprintf(stderr, "native smoke terminated by signal: p101_parse_negative_long_long: %d\n", WTERMSIG(native_status));
+                fprintf(stderr, "native smoke terminated by signal: p101_format_unsigned_int: %d\n", WTERMSIG(native_status));
             }
             EXPECT(WIFEXITED(native_status));
             if(WIFEXITED(native_status) && WEXITSTATUS(native_status) == 77)
             {
-                fprintf(stderr, "native smoke fixture unavailable: p101_parse_negative_long_long\n");
+                fprintf(stderr, "native smoke fixture unavailable: p101_format_unsigned_int\n");
             }
             else if(WIFEXITED(native_status))
             {
                 if(WEXITSTATUS(native_status) != EXIT_SUCCESS)
                 {
-                    fprintf(stderr, "native smoke exited unsuccessfully: p101_parse_negative_long_long: %d\n", WEXITSTATUS(native_status));
+                    fprintf(stderr, "native smoke exited unsuccessfully: p101_format_unsigned_int: %d\n", WEXITSTATUS(native_status));
                 }
                 EXPECT(WEXITSTATUS(native_status) == EXIT_SUCCESS);
             }
@@ -2240,8 +2258,8 @@ static void test_p101_parse_negative_long_long(struct p101_env *env, struct p101
     }
 }
 
-/* P101_TEST_CASE(p101_parse_negative_short) */
-static void test_p101_parse_negative_short(struct p101_env *env, struct p101_error *err)
+/* P101_TEST_CASE(p101_format_unsigned_long) */
+static void test_p101_format_unsigned_long(struct p101_env *env, struct p101_error *err)
 {
 #ifdef __linux__
     static const int         errors[]      = {EIO};
@@ -2267,14 +2285,14 @@ static void test_p101_parse_negative_short(struct p101_env *env, struct p101_err
         fault_resource_events = 0U;
         errno                 = P101_TEST_ERRNO_SENTINEL;
         p101_env_set_fault_injector(env, fail_next_call, &state);
-        short result = p101_parse_negative_short(env, err, NULL, 0);
+        size_t result = p101_format_unsigned_long(env, err, 0, NULL, 0);
         (void)result;
         EXPECT(state.checks == 1);
         EXPECT(p101_error_is_errno(err, state.code));
         EXPECT(errno == P101_TEST_ERRNO_SENTINEL);
         EXPECT(result == (0));
         EXPECT(fault_resource_events == 0U);
-        write_outcome("p101_parse_negative_short", "errno", error_names[index], state.code, failures == failures_before);
+        write_outcome("p101_format_unsigned_long", "errno", error_names[index], state.code, failures == failures_before);
         p101_error_reset(err);
     }
     p101_env_set_fault_injector(env, NULL, NULL);
@@ -2318,7 +2336,8 @@ static void test_p101_parse_negative_short(struct p101_env *env, struct p101_err
                 native_child_status = 77;
                 goto native_child_done_;
             }
-            short native_result = p101_parse_negative_short(native_env, native_err, "-1", 0);
+            char   native_argument_4[P101_INTEGER_TEXT_SIZE] = {0};
+            size_t native_result                             = p101_format_unsigned_long(native_env, native_err, 42, native_argument_4, sizeof(native_argument_4));
             (void)native_result;
             if(p101_error_has_error(native_err))
             {
@@ -2333,7 +2352,7 @@ static void test_p101_parse_negative_short(struct p101_env *env, struct p101_err
                 }
                 if(!native_error_declared)
                 {
-                    fprintf(stderr, "native smoke produced an undeclared platform failure: p101_parse_negative_short: %s\n", p101_error_get_message(native_err));
+                    fprintf(stderr, "native smoke produced an undeclared platform failure: p101_format_unsigned_long: %s\n", p101_error_get_message(native_err));
                     native_passed = false;
                 }
                 p101_error_reset(native_err);
@@ -2348,18 +2367,18 @@ static void test_p101_parse_negative_short(struct p101_env *env, struct p101_err
             EXPECT(native_waitpid_nointr(native_pid, &native_status) == native_pid);
             if(WIFSIGNALED(native_status))
             {
-                fprintf(stderr, "native smoke terminated by signal: p101_parse_negative_short: %d\n", WTERMSIG(native_status));
+                fprintf(stderr, "native smoke terminated by signal: p101_format_unsigned_long: %d\n", WTERMSIG(native_status));
             }
             EXPECT(WIFEXITED(native_status));
             if(WIFEXITED(native_status) && WEXITSTATUS(native_status) == 77)
             {
-                fprintf(stderr, "native smoke fixture unavailable: p101_parse_negative_short\n");
+                fprintf(stderr, "native smoke fixture unavailable: p101_format_unsigned_long\n");
             }
             else if(WIFEXITED(native_status))
             {
                 if(WEXITSTATUS(native_status) != EXIT_SUCCESS)
                 {
-                    fprintf(stderr, "native smoke exited unsuccessfully: p101_parse_negative_short: %d\n", WEXITSTATUS(native_status));
+                    fprintf(stderr, "native smoke exited unsuccessfully: p101_format_unsigned_long: %d\n", WEXITSTATUS(native_status));
                 }
                 EXPECT(WEXITSTATUS(native_status) == EXIT_SUCCESS);
             }
@@ -2368,8 +2387,8 @@ static void test_p101_parse_negative_short(struct p101_env *env, struct p101_err
     }
 }
 
-/* P101_TEST_CASE(p101_parse_positive_char) */
-static void test_p101_parse_positive_char(struct p101_env *env, struct p101_error *err)
+/* P101_TEST_CASE(p101_format_unsigned_long_long) */
+static void test_p101_format_unsigned_long_long(struct p101_env *env, struct p101_error *err)
 {
 #ifdef __linux__
     static const int         errors[]      = {EIO};
@@ -2395,14 +2414,14 @@ static void test_p101_parse_positive_char(struct p101_env *env, struct p101_erro
         fault_resource_events = 0U;
         errno                 = P101_TEST_ERRNO_SENTINEL;
         p101_env_set_fault_injector(env, fail_next_call, &state);
-        char result = p101_parse_positive_char(env, err, NULL, 0);
+        size_t result = p101_format_unsigned_long_long(env, err, 0, NULL, 0);
         (void)result;
         EXPECT(state.checks == 1);
         EXPECT(p101_error_is_errno(err, state.code));
         EXPECT(errno == P101_TEST_ERRNO_SENTINEL);
         EXPECT(result == (0));
         EXPECT(fault_resource_events == 0U);
-        write_outcome("p101_parse_positive_char", "errno", error_names[index], state.code, failures == failures_before);
+        write_outcome("p101_format_unsigned_long_long", "errno", error_names[index], state.code, failures == failures_before);
         p101_error_reset(err);
     }
     p101_env_set_fault_injector(env, NULL, NULL);
@@ -2446,7 +2465,8 @@ static void test_p101_parse_positive_char(struct p101_env *env, struct p101_erro
                 native_child_status = 77;
                 goto native_child_done_;
             }
-            char native_result = p101_parse_positive_char(native_env, native_err, "1", 0);
+            char   native_argument_4[P101_INTEGER_TEXT_SIZE] = {0};
+            size_t native_result                             = p101_format_unsigned_long_long(native_env, native_err, 42, native_argument_4, sizeof(native_argument_4));
             (void)native_result;
             if(p101_error_has_error(native_err))
             {
@@ -2461,7 +2481,7 @@ static void test_p101_parse_positive_char(struct p101_env *env, struct p101_erro
                 }
                 if(!native_error_declared)
                 {
-                    fprintf(stderr, "native smoke produced an undeclared platform failure: p101_parse_positive_char: %s\n", p101_error_get_message(native_err));
+                    fprintf(stderr, "native smoke produced an undeclared platform failure: p101_format_unsigned_long_long: %s\n", p101_error_get_message(native_err));
                     native_passed = false;
                 }
                 p101_error_reset(native_err);
@@ -2476,18 +2496,18 @@ static void test_p101_parse_positive_char(struct p101_env *env, struct p101_erro
             EXPECT(native_waitpid_nointr(native_pid, &native_status) == native_pid);
             if(WIFSIGNALED(native_status))
             {
-                fprintf(stderr, "native smoke terminated by signal: p101_parse_positive_char: %d\n", WTERMSIG(native_status));
+                fprintf(stderr, "native smoke terminated by signal: p101_format_unsigned_long_long: %d\n", WTERMSIG(native_status));
             }
             EXPECT(WIFEXITED(native_status));
             if(WIFEXITED(native_status) && WEXITSTATUS(native_status) == 77)
             {
-                fprintf(stderr, "native smoke fixture unavailable: p101_parse_positive_char\n");
+                fprintf(stderr, "native smoke fixture unavailable: p101_format_unsigned_long_long\n");
             }
             else if(WIFEXITED(native_status))
             {
                 if(WEXITSTATUS(native_status) != EXIT_SUCCESS)
                 {
-                    fprintf(stderr, "native smoke exited unsuccessfully: p101_parse_positive_char: %d\n", WEXITSTATUS(native_status));
+                    fprintf(stderr, "native smoke exited unsuccessfully: p101_format_unsigned_long_long: %d\n", WEXITSTATUS(native_status));
                 }
                 EXPECT(WEXITSTATUS(native_status) == EXIT_SUCCESS);
             }
@@ -2496,8 +2516,8 @@ static void test_p101_parse_positive_char(struct p101_env *env, struct p101_erro
     }
 }
 
-/* P101_TEST_CASE(p101_parse_positive_int) */
-static void test_p101_parse_positive_int(struct p101_env *env, struct p101_error *err)
+/* P101_TEST_CASE(p101_format_unsigned_short) */
+static void test_p101_format_unsigned_short(struct p101_env *env, struct p101_error *err)
 {
 #ifdef __linux__
     static const int         errors[]      = {EIO};
@@ -2523,14 +2543,14 @@ static void test_p101_parse_positive_int(struct p101_env *env, struct p101_error
         fault_resource_events = 0U;
         errno                 = P101_TEST_ERRNO_SENTINEL;
         p101_env_set_fault_injector(env, fail_next_call, &state);
-        int result = p101_parse_positive_int(env, err, NULL, 0);
+        size_t result = p101_format_unsigned_short(env, err, 0, NULL, 0);
         (void)result;
         EXPECT(state.checks == 1);
         EXPECT(p101_error_is_errno(err, state.code));
         EXPECT(errno == P101_TEST_ERRNO_SENTINEL);
         EXPECT(result == (0));
         EXPECT(fault_resource_events == 0U);
-        write_outcome("p101_parse_positive_int", "errno", error_names[index], state.code, failures == failures_before);
+        write_outcome("p101_format_unsigned_short", "errno", error_names[index], state.code, failures == failures_before);
         p101_error_reset(err);
     }
     p101_env_set_fault_injector(env, NULL, NULL);
@@ -2574,7 +2594,8 @@ static void test_p101_parse_positive_int(struct p101_env *env, struct p101_error
                 native_child_status = 77;
                 goto native_child_done_;
             }
-            int native_result = p101_parse_positive_int(native_env, native_err, "1", 0);
+            char   native_argument_4[P101_INTEGER_TEXT_SIZE] = {0};
+            size_t native_result                             = p101_format_unsigned_short(native_env, native_err, 42, native_argument_4, sizeof(native_argument_4));
             (void)native_result;
             if(p101_error_has_error(native_err))
             {
@@ -2589,7 +2610,7 @@ static void test_p101_parse_positive_int(struct p101_env *env, struct p101_error
                 }
                 if(!native_error_declared)
                 {
-                    fprintf(stderr, "native smoke produced an undeclared platform failure: p101_parse_positive_int: %s\n", p101_error_get_message(native_err));
+                    fprintf(stderr, "native smoke produced an undeclared platform failure: p101_format_unsigned_short: %s\n", p101_error_get_message(native_err));
                     native_passed = false;
                 }
                 p101_error_reset(native_err);
@@ -2604,18 +2625,18 @@ static void test_p101_parse_positive_int(struct p101_env *env, struct p101_error
             EXPECT(native_waitpid_nointr(native_pid, &native_status) == native_pid);
             if(WIFSIGNALED(native_status))
             {
-                fprintf(stderr, "native smoke terminated by signal: p101_parse_positive_int: %d\n", WTERMSIG(native_status));
+                fprintf(stderr, "native smoke terminated by signal: p101_format_unsigned_short: %d\n", WTERMSIG(native_status));
             }
             EXPECT(WIFEXITED(native_status));
             if(WIFEXITED(native_status) && WEXITSTATUS(native_status) == 77)
             {
-                fprintf(stderr, "native smoke fixture unavailable: p101_parse_positive_int\n");
+                fprintf(stderr, "native smoke fixture unavailable: p101_format_unsigned_short\n");
             }
             else if(WIFEXITED(native_status))
             {
                 if(WEXITSTATUS(native_status) != EXIT_SUCCESS)
                 {
-                    fprintf(stderr, "native smoke exited unsuccessfully: p101_parse_positive_int: %d\n", WEXITSTATUS(native_status));
+                    fprintf(stderr, "native smoke exited unsuccessfully: p101_format_unsigned_short: %d\n", WEXITSTATUS(native_status));
                 }
                 EXPECT(WEXITSTATUS(native_status) == EXIT_SUCCESS);
             }
@@ -2624,8 +2645,8 @@ static void test_p101_parse_positive_int(struct p101_env *env, struct p101_error
     }
 }
 
-/* P101_TEST_CASE(p101_parse_positive_int16_t) */
-static void test_p101_parse_positive_int16_t(struct p101_env *env, struct p101_error *err)
+/* P101_TEST_CASE(p101_parse_char) */
+static void test_p101_parse_char(struct p101_env *env, struct p101_error *err)
 {
 #ifdef __linux__
     static const int         errors[]      = {EIO};
@@ -2651,14 +2672,14 @@ static void test_p101_parse_positive_int16_t(struct p101_env *env, struct p101_e
         fault_resource_events = 0U;
         errno                 = P101_TEST_ERRNO_SENTINEL;
         p101_env_set_fault_injector(env, fail_next_call, &state);
-        int16_t result = p101_parse_positive_int16_t(env, err, NULL, 0);
+        char result = p101_parse_char(env, err, NULL, 0);
         (void)result;
         EXPECT(state.checks == 1);
         EXPECT(p101_error_is_errno(err, state.code));
         EXPECT(errno == P101_TEST_ERRNO_SENTINEL);
         EXPECT(result == (0));
         EXPECT(fault_resource_events == 0U);
-        write_outcome("p101_parse_positive_int16_t", "errno", error_names[index], state.code, failures == failures_before);
+        write_outcome("p101_parse_char", "errno", error_names[index], state.code, failures == failures_before);
         p101_error_reset(err);
     }
     p101_env_set_fault_injector(env, NULL, NULL);
@@ -2702,7 +2723,7 @@ static void test_p101_parse_positive_int16_t(struct p101_env *env, struct p101_e
                 native_child_status = 77;
                 goto native_child_done_;
             }
-            int16_t native_result = p101_parse_positive_int16_t(native_env, native_err, "1", 0);
+            char native_result = p101_parse_char(native_env, native_err, "1", 0);
             (void)native_result;
             if(p101_error_has_error(native_err))
             {
@@ -2717,7 +2738,7 @@ static void test_p101_parse_positive_int16_t(struct p101_env *env, struct p101_e
                 }
                 if(!native_error_declared)
                 {
-                    fprintf(stderr, "native smoke produced an undeclared platform failure: p101_parse_positive_int16_t: %s\n", p101_error_get_message(native_err));
+                    fprintf(stderr, "native smoke produced an undeclared platform failure: p101_parse_char: %s\n", p101_error_get_message(native_err));
                     native_passed = false;
                 }
                 p101_error_reset(native_err);
@@ -2732,18 +2753,18 @@ static void test_p101_parse_positive_int16_t(struct p101_env *env, struct p101_e
             EXPECT(native_waitpid_nointr(native_pid, &native_status) == native_pid);
             if(WIFSIGNALED(native_status))
             {
-                fprintf(stderr, "native smoke terminated by signal: p101_parse_positive_int16_t: %d\n", WTERMSIG(native_status));
+                fprintf(stderr, "native smoke terminated by signal: p101_parse_char: %d\n", WTERMSIG(native_status));
             }
             EXPECT(WIFEXITED(native_status));
             if(WIFEXITED(native_status) && WEXITSTATUS(native_status) == 77)
             {
-                fprintf(stderr, "native smoke fixture unavailable: p101_parse_positive_int16_t\n");
+                fprintf(stderr, "native smoke fixture unavailable: p101_parse_char\n");
             }
             else if(WIFEXITED(native_status))
             {
                 if(WEXITSTATUS(native_status) != EXIT_SUCCESS)
                 {
-                    fprintf(stderr, "native smoke exited unsuccessfully: p101_parse_positive_int16_t: %d\n", WEXITSTATUS(native_status));
+                    fprintf(stderr, "native smoke exited unsuccessfully: p101_parse_char: %d\n", WEXITSTATUS(native_status));
                 }
                 EXPECT(WEXITSTATUS(native_status) == EXIT_SUCCESS);
             }
@@ -2752,8 +2773,8 @@ static void test_p101_parse_positive_int16_t(struct p101_env *env, struct p101_e
     }
 }
 
-/* P101_TEST_CASE(p101_parse_positive_int32_t) */
-static void test_p101_parse_positive_int32_t(struct p101_env *env, struct p101_error *err)
+/* P101_TEST_CASE(p101_parse_char_n) */
+static void test_p101_parse_char_n(struct p101_env *env, struct p101_error *err)
 {
 #ifdef __linux__
     static const int         errors[]      = {EIO};
@@ -2779,14 +2800,14 @@ static void test_p101_parse_positive_int32_t(struct p101_env *env, struct p101_e
         fault_resource_events = 0U;
         errno                 = P101_TEST_ERRNO_SENTINEL;
         p101_env_set_fault_injector(env, fail_next_call, &state);
-        int32_t result = p101_parse_positive_int32_t(env, err, NULL, 0);
+        char result = p101_parse_char_n(env, err, NULL, 0, 0);
         (void)result;
         EXPECT(state.checks == 1);
         EXPECT(p101_error_is_errno(err, state.code));
         EXPECT(errno == P101_TEST_ERRNO_SENTINEL);
         EXPECT(result == (0));
         EXPECT(fault_resource_events == 0U);
-        write_outcome("p101_parse_positive_int32_t", "errno", error_names[index], state.code, failures == failures_before);
+        write_outcome("p101_parse_char_n", "errno", error_names[index], state.code, failures == failures_before);
         p101_error_reset(err);
     }
     p101_env_set_fault_injector(env, NULL, NULL);
@@ -2830,7 +2851,7 @@ static void test_p101_parse_positive_int32_t(struct p101_env *env, struct p101_e
                 native_child_status = 77;
                 goto native_child_done_;
             }
-            int32_t native_result = p101_parse_positive_int32_t(native_env, native_err, "1", 0);
+            char native_result = p101_parse_char_n(native_env, native_err, "1", 1, 0);
             (void)native_result;
             if(p101_error_has_error(native_err))
             {
@@ -2845,7 +2866,7 @@ static void test_p101_parse_positive_int32_t(struct p101_env *env, struct p101_e
                 }
                 if(!native_error_declared)
                 {
-                    fprintf(stderr, "native smoke produced an undeclared platform failure: p101_parse_positive_int32_t: %s\n", p101_error_get_message(native_err));
+                    fprintf(stderr, "native smoke produced an undeclared platform failure: p101_parse_char_n: %s\n", p101_error_get_message(native_err));
                     native_passed = false;
                 }
                 p101_error_reset(native_err);
@@ -2860,18 +2881,18 @@ static void test_p101_parse_positive_int32_t(struct p101_env *env, struct p101_e
             EXPECT(native_waitpid_nointr(native_pid, &native_status) == native_pid);
             if(WIFSIGNALED(native_status))
             {
-                fprintf(stderr, "native smoke terminated by signal: p101_parse_positive_int32_t: %d\n", WTERMSIG(native_status));
+                fprintf(stderr, "native smoke terminated by signal: p101_parse_char_n: %d\n", WTERMSIG(native_status));
             }
             EXPECT(WIFEXITED(native_status));
             if(WIFEXITED(native_status) && WEXITSTATUS(native_status) == 77)
             {
-                fprintf(stderr, "native smoke fixture unavailable: p101_parse_positive_int32_t\n");
+                fprintf(stderr, "native smoke fixture unavailable: p101_parse_char_n\n");
             }
             else if(WIFEXITED(native_status))
             {
                 if(WEXITSTATUS(native_status) != EXIT_SUCCESS)
                 {
-                    fprintf(stderr, "native smoke exited unsuccessfully: p101_parse_positive_int32_t: %d\n", WEXITSTATUS(native_status));
+                    fprintf(stderr, "native smoke exited unsuccessfully: p101_parse_char_n: %d\n", WEXITSTATUS(native_status));
                 }
                 EXPECT(WEXITSTATUS(native_status) == EXIT_SUCCESS);
             }
@@ -2880,8 +2901,8 @@ static void test_p101_parse_positive_int32_t(struct p101_env *env, struct p101_e
     }
 }
 
-/* P101_TEST_CASE(p101_parse_positive_int64_t) */
-static void test_p101_parse_positive_int64_t(struct p101_env *env, struct p101_error *err)
+/* P101_TEST_CASE(p101_parse_char_prefix) */
+static void test_p101_parse_char_prefix(struct p101_env *env, struct p101_error *err)
 {
 #ifdef __linux__
     static const int         errors[]      = {EIO};
@@ -2907,14 +2928,14 @@ static void test_p101_parse_positive_int64_t(struct p101_env *env, struct p101_e
         fault_resource_events = 0U;
         errno                 = P101_TEST_ERRNO_SENTINEL;
         p101_env_set_fault_injector(env, fail_next_call, &state);
-        int64_t result = p101_parse_positive_int64_t(env, err, NULL, 0);
+        char result = p101_parse_char_prefix(env, err, NULL, NULL, 0);
         (void)result;
         EXPECT(state.checks == 1);
         EXPECT(p101_error_is_errno(err, state.code));
         EXPECT(errno == P101_TEST_ERRNO_SENTINEL);
         EXPECT(result == (0));
         EXPECT(fault_resource_events == 0U);
-        write_outcome("p101_parse_positive_int64_t", "errno", error_names[index], state.code, failures == failures_before);
+        write_outcome("p101_parse_char_prefix", "errno", error_names[index], state.code, failures == failures_before);
         p101_error_reset(err);
     }
     p101_env_set_fault_injector(env, NULL, NULL);
@@ -2958,7 +2979,8 @@ static void test_p101_parse_positive_int64_t(struct p101_env *env, struct p101_e
                 native_child_status = 77;
                 goto native_child_done_;
             }
-            int64_t native_result = p101_parse_positive_int64_t(native_env, native_err, "1", 0);
+            const char *native_argument_3 = NULL;
+            char        native_result     = p101_parse_char_prefix(native_env, native_err, "1", &native_argument_3, 0);
             (void)native_result;
             if(p101_error_has_error(native_err))
             {
@@ -2973,7 +2995,7 @@ static void test_p101_parse_positive_int64_t(struct p101_env *env, struct p101_e
                 }
                 if(!native_error_declared)
                 {
-                    fprintf(stderr, "native smoke produced an undeclared platform failure: p101_parse_positive_int64_t: %s\n", p101_error_get_message(native_err));
+                    fprintf(stderr, "native smoke produced an undeclared platform failure: p101_parse_char_prefix: %s\n", p101_error_get_message(native_err));
                     native_passed = false;
                 }
                 p101_error_reset(native_err);
@@ -2988,18 +3010,18 @@ static void test_p101_parse_positive_int64_t(struct p101_env *env, struct p101_e
             EXPECT(native_waitpid_nointr(native_pid, &native_status) == native_pid);
             if(WIFSIGNALED(native_status))
             {
-                fprintf(stderr, "native smoke terminated by signal: p101_parse_positive_int64_t: %d\n", WTERMSIG(native_status));
+                fprintf(stderr, "native smoke terminated by signal: p101_parse_char_prefix: %d\n", WTERMSIG(native_status));
             }
             EXPECT(WIFEXITED(native_status));
             if(WIFEXITED(native_status) && WEXITSTATUS(native_status) == 77)
             {
-                fprintf(stderr, "native smoke fixture unavailable: p101_parse_positive_int64_t\n");
+                fprintf(stderr, "native smoke fixture unavailable: p101_parse_char_prefix\n");
             }
             else if(WIFEXITED(native_status))
             {
                 if(WEXITSTATUS(native_status) != EXIT_SUCCESS)
                 {
-                    fprintf(stderr, "native smoke exited unsuccessfully: p101_parse_positive_int64_t: %d\n", WEXITSTATUS(native_status));
+                    fprintf(stderr, "native smoke exited unsuccessfully: p101_parse_char_prefix: %d\n", WEXITSTATUS(native_status));
                 }
                 EXPECT(WEXITSTATUS(native_status) == EXIT_SUCCESS);
             }
@@ -3008,8 +3030,8 @@ static void test_p101_parse_positive_int64_t(struct p101_env *env, struct p101_e
     }
 }
 
-/* P101_TEST_CASE(p101_parse_positive_int8_t) */
-static void test_p101_parse_positive_int8_t(struct p101_env *env, struct p101_error *err)
+/* P101_TEST_CASE(p101_parse_duration) */
+static void test_p101_parse_duration(struct p101_env *env, struct p101_error *err)
 {
 #ifdef __linux__
     static const int         errors[]      = {EIO};
@@ -3035,14 +3057,14 @@ static void test_p101_parse_positive_int8_t(struct p101_env *env, struct p101_er
         fault_resource_events = 0U;
         errno                 = P101_TEST_ERRNO_SENTINEL;
         p101_env_set_fault_injector(env, fail_next_call, &state);
-        int8_t result = p101_parse_positive_int8_t(env, err, NULL, 0);
+        int64_t result = p101_parse_duration(env, err, NULL, 0);
         (void)result;
         EXPECT(state.checks == 1);
         EXPECT(p101_error_is_errno(err, state.code));
         EXPECT(errno == P101_TEST_ERRNO_SENTINEL);
         EXPECT(result == (0));
         EXPECT(fault_resource_events == 0U);
-        write_outcome("p101_parse_positive_int8_t", "errno", error_names[index], state.code, failures == failures_before);
+        write_outcome("p101_parse_duration", "errno", error_names[index], state.code, failures == failures_before);
         p101_error_reset(err);
     }
     p101_env_set_fault_injector(env, NULL, NULL);
@@ -3086,7 +3108,7 @@ static void test_p101_parse_positive_int8_t(struct p101_env *env, struct p101_er
                 native_child_status = 77;
                 goto native_child_done_;
             }
-            int8_t native_result = p101_parse_positive_int8_t(native_env, native_err, "1", 0);
+            int64_t native_result = p101_parse_duration(native_env, native_err, "5s", 0);
             (void)native_result;
             if(p101_error_has_error(native_err))
             {
@@ -3101,7 +3123,7 @@ static void test_p101_parse_positive_int8_t(struct p101_env *env, struct p101_er
                 }
                 if(!native_error_declared)
                 {
-                    fprintf(stderr, "native smoke produced an undeclared platform failure: p101_parse_positive_int8_t: %s\n", p101_error_get_message(native_err));
+                    fprintf(stderr, "native smoke produced an undeclared platform failure: p101_parse_duration: %s\n", p101_error_get_message(native_err));
                     native_passed = false;
                 }
                 p101_error_reset(native_err);
@@ -3116,18 +3138,18 @@ static void test_p101_parse_positive_int8_t(struct p101_env *env, struct p101_er
             EXPECT(native_waitpid_nointr(native_pid, &native_status) == native_pid);
             if(WIFSIGNALED(native_status))
             {
-                fprintf(stderr, "native smoke terminated by signal: p101_parse_positive_int8_t: %d\n", WTERMSIG(native_status));
+                fprintf(stderr, "native smoke terminated by signal: p101_parse_duration: %d\n", WTERMSIG(native_status));
             }
             EXPECT(WIFEXITED(native_status));
             if(WIFEXITED(native_status) && WEXITSTATUS(native_status) == 77)
             {
-                fprintf(stderr, "native smoke fixture unavailable: p101_parse_positive_int8_t\n");
+                fprintf(stderr, "native smoke fixture unavailable: p101_parse_duration\n");
             }
             else if(WIFEXITED(native_status))
             {
                 if(WEXITSTATUS(native_status) != EXIT_SUCCESS)
                 {
-                    fprintf(stderr, "native smoke exited unsuccessfully: p101_parse_positive_int8_t: %d\n", WEXITSTATUS(native_status));
+                    fprintf(stderr, "native smoke exited unsuccessfully: p101_parse_duration: %d\n", WEXITSTATUS(native_status));
                 }
                 EXPECT(WEXITSTATUS(native_status) == EXIT_SUCCESS);
             }
@@ -3136,8 +3158,8 @@ static void test_p101_parse_positive_int8_t(struct p101_env *env, struct p101_er
     }
 }
 
-/* P101_TEST_CASE(p101_parse_positive_long) */
-static void test_p101_parse_positive_long(struct p101_env *env, struct p101_error *err)
+/* P101_TEST_CASE(p101_parse_duration_timespec) */
+static void test_p101_parse_duration_timespec(struct p101_env *env, struct p101_error *err)
 {
 #ifdef __linux__
     static const int         errors[]      = {EIO};
@@ -3163,14 +3185,14 @@ static void test_p101_parse_positive_long(struct p101_env *env, struct p101_erro
         fault_resource_events = 0U;
         errno                 = P101_TEST_ERRNO_SENTINEL;
         p101_env_set_fault_injector(env, fail_next_call, &state);
-        long result = p101_parse_positive_long(env, err, NULL, 0);
+        struct timespec result = p101_parse_duration_timespec(env, err, NULL, (struct timespec){0, 0});
         (void)result;
         EXPECT(state.checks == 1);
         EXPECT(p101_error_is_errno(err, state.code));
         EXPECT(errno == P101_TEST_ERRNO_SENTINEL);
-        EXPECT(result == (0));
+        EXPECT(result.tv_sec == 0 && result.tv_nsec == 0);
         EXPECT(fault_resource_events == 0U);
-        write_outcome("p101_parse_positive_long", "errno", error_names[index], state.code, failures == failures_before);
+        write_outcome("p101_parse_duration_timespec", "errno", error_names[index], state.code, failures == failures_before);
         p101_error_reset(err);
     }
     p101_env_set_fault_injector(env, NULL, NULL);
@@ -3214,7 +3236,7 @@ static void test_p101_parse_positive_long(struct p101_env *env, struct p101_erro
                 native_child_status = 77;
                 goto native_child_done_;
             }
-            long native_result = p101_parse_positive_long(native_env, native_err, "1", 0);
+            struct timespec native_result = p101_parse_duration_timespec(native_env, native_err, "5s", (struct timespec){0, 0});
             (void)native_result;
             if(p101_error_has_error(native_err))
             {
@@ -3229,7 +3251,7 @@ static void test_p101_parse_positive_long(struct p101_env *env, struct p101_erro
                 }
                 if(!native_error_declared)
                 {
-                    fprintf(stderr, "native smoke produced an undeclared platform failure: p101_parse_positive_long: %s\n", p101_error_get_message(native_err));
+                    fprintf(stderr, "native smoke produced an undeclared platform failure: p101_parse_duration_timespec: %s\n", p101_error_get_message(native_err));
                     native_passed = false;
                 }
                 p101_error_reset(native_err);
@@ -3244,18 +3266,18 @@ static void test_p101_parse_positive_long(struct p101_env *env, struct p101_erro
             EXPECT(native_waitpid_nointr(native_pid, &native_status) == native_pid);
             if(WIFSIGNALED(native_status))
             {
-                fprintf(stderr, "native smoke terminated by signal: p101_parse_positive_long: %d\n", WTERMSIG(native_status));
+                fprintf(stderr, "native smoke terminated by signal: p101_parse_duration_timespec: %d\n", WTERMSIG(native_status));
             }
             EXPECT(WIFEXITED(native_status));
             if(WIFEXITED(native_status) && WEXITSTATUS(native_status) == 77)
             {
-                fprintf(stderr, "native smoke fixture unavailable: p101_parse_positive_long\n");
+                fprintf(stderr, "native smoke fixture unavailable: p101_parse_duration_timespec\n");
             }
             else if(WIFEXITED(native_status))
             {
                 if(WEXITSTATUS(native_status) != EXIT_SUCCESS)
                 {
-                    fprintf(stderr, "native smoke exited unsuccessfully: p101_parse_positive_long: %d\n", WEXITSTATUS(native_status));
+                    fprintf(stderr, "native smoke exited unsuccessfully: p101_parse_duration_timespec: %d\n", WEXITSTATUS(native_status));
                 }
                 EXPECT(WEXITSTATUS(native_status) == EXIT_SUCCESS);
             }
@@ -3264,8 +3286,8 @@ static void test_p101_parse_positive_long(struct p101_env *env, struct p101_erro
     }
 }
 
-/* P101_TEST_CASE(p101_parse_positive_long_long) */
-static void test_p101_parse_positive_long_long(struct p101_env *env, struct p101_error *err)
+/* P101_TEST_CASE(p101_parse_hex_id) */
+static void test_p101_parse_hex_id(struct p101_env *env, struct p101_error *err)
 {
 #ifdef __linux__
     static const int         errors[]      = {EIO};
@@ -3291,14 +3313,14 @@ static void test_p101_parse_positive_long_long(struct p101_env *env, struct p101
         fault_resource_events = 0U;
         errno                 = P101_TEST_ERRNO_SENTINEL;
         p101_env_set_fault_injector(env, fail_next_call, &state);
-        long long result = p101_parse_positive_long_long(env, err, NULL, 0);
+        bool result = p101_parse_hex_id(env, err, NULL, NULL, 0);
         (void)result;
         EXPECT(state.checks == 1);
         EXPECT(p101_error_is_errno(err, state.code));
         EXPECT(errno == P101_TEST_ERRNO_SENTINEL);
         EXPECT(result == (0));
         EXPECT(fault_resource_events == 0U);
-        write_outcome("p101_parse_positive_long_long", "errno", error_names[index], state.code, failures == failures_before);
+        write_outcome("p101_parse_hex_id", "errno", error_names[index], state.code, failures == failures_before);
         p101_error_reset(err);
     }
     p101_env_set_fault_injector(env, NULL, NULL);
@@ -3342,7 +3364,8 @@ static void test_p101_parse_positive_long_long(struct p101_env *env, struct p101
                 native_child_status = 77;
                 goto native_child_done_;
             }
-            long long native_result = p101_parse_positive_long_long(native_env, native_err, "1", 0);
+            uint8_t native_argument_4[1] = {0};
+            bool    native_result        = p101_parse_hex_id(native_env, native_err, "00", native_argument_4, sizeof(native_argument_4));
             (void)native_result;
             if(p101_error_has_error(native_err))
             {
@@ -3357,7 +3380,7 @@ static void test_p101_parse_positive_long_long(struct p101_env *env, struct p101
                 }
                 if(!native_error_declared)
                 {
-                    fprintf(stderr, "native smoke produced an undeclared platform failure: p101_parse_positive_long_long: %s\n", p101_error_get_message(native_err));
+                    fprintf(stderr, "native smoke produced an undeclared platform failure: p101_parse_hex_id: %s\n", p101_error_get_message(native_err));
                     native_passed = false;
                 }
                 p101_error_reset(native_err);
@@ -3372,18 +3395,18 @@ static void test_p101_parse_positive_long_long(struct p101_env *env, struct p101
             EXPECT(native_waitpid_nointr(native_pid, &native_status) == native_pid);
             if(WIFSIGNALED(native_status))
             {
-                fprintf(stderr, "native smoke terminated by signal: p101_parse_positive_long_long: %d\n", WTERMSIG(native_status));
+                fprintf(stderr, "native smoke terminated by signal: p101_parse_hex_id: %d\n", WTERMSIG(native_status));
             }
             EXPECT(WIFEXITED(native_status));
             if(WIFEXITED(native_status) && WEXITSTATUS(native_status) == 77)
             {
-                fprintf(stderr, "native smoke fixture unavailable: p101_parse_positive_long_long\n");
+                fprintf(stderr, "native smoke fixture unavailable: p101_parse_hex_id\n");
             }
             else if(WIFEXITED(native_status))
             {
                 if(WEXITSTATUS(native_status) != EXIT_SUCCESS)
                 {
-                    fprintf(stderr, "native smoke exited unsuccessfully: p101_parse_positive_long_long: %d\n", WEXITSTATUS(native_status));
+                    fprintf(stderr, "native smoke exited unsuccessfully: p101_parse_hex_id: %d\n", WEXITSTATUS(native_status));
                 }
                 EXPECT(WEXITSTATUS(native_status) == EXIT_SUCCESS);
             }
@@ -3392,8 +3415,8 @@ static void test_p101_parse_positive_long_long(struct p101_env *env, struct p101
     }
 }
 
-/* P101_TEST_CASE(p101_parse_positive_short) */
-static void test_p101_parse_positive_short(struct p101_env *env, struct p101_error *err)
+/* P101_TEST_CASE(p101_parse_int) */
+static void test_p101_parse_int(struct p101_env *env, struct p101_error *err)
 {
 #ifdef __linux__
     static const int         errors[]      = {EIO};
@@ -3419,14 +3442,14 @@ static void test_p101_parse_positive_short(struct p101_env *env, struct p101_err
         fault_resource_events = 0U;
         errno                 = P101_TEST_ERRNO_SENTINEL;
         p101_env_set_fault_injector(env, fail_next_call, &state);
-        short result = p101_parse_positive_short(env, err, NULL, 0);
+        int result = p101_parse_int(env, err, NULL, 0);
         (void)result;
         EXPECT(state.checks == 1);
         EXPECT(p101_error_is_errno(err, state.code));
         EXPECT(errno == P101_TEST_ERRNO_SENTINEL);
         EXPECT(result == (0));
         EXPECT(fault_resource_events == 0U);
-        write_outcome("p101_parse_positive_short", "errno", error_names[index], state.code, failures == failures_before);
+        write_outcome("p101_parse_int", "errno", error_names[index], state.code, failures == failures_before);
         p101_error_reset(err);
     }
     p101_env_set_fault_injector(env, NULL, NULL);
@@ -3470,7 +3493,7 @@ static void test_p101_parse_positive_short(struct p101_env *env, struct p101_err
                 native_child_status = 77;
                 goto native_child_done_;
             }
-            short native_result = p101_parse_positive_short(native_env, native_err, "1", 0);
+            int native_result = p101_parse_int(native_env, native_err, "1", 0);
             (void)native_result;
             if(p101_error_has_error(native_err))
             {
@@ -3485,7 +3508,7 @@ static void test_p101_parse_positive_short(struct p101_env *env, struct p101_err
                 }
                 if(!native_error_declared)
                 {
-                    fprintf(stderr, "native smoke produced an undeclared platform failure: p101_parse_positive_short: %s\n", p101_error_get_message(native_err));
+                    fprintf(stderr, "native smoke produced an undeclared platform failure: p101_parse_int: %s\n", p101_error_get_message(native_err));
                     native_passed = false;
                 }
                 p101_error_reset(native_err);
@@ -3500,18 +3523,18 @@ static void test_p101_parse_positive_short(struct p101_env *env, struct p101_err
             EXPECT(native_waitpid_nointr(native_pid, &native_status) == native_pid);
             if(WIFSIGNALED(native_status))
             {
-                fprintf(stderr, "native smoke terminated by signal: p101_parse_positive_short: %d\n", WTERMSIG(native_status));
+                fprintf(stderr, "native smoke terminated by signal: p101_parse_int: %d\n", WTERMSIG(native_status));
             }
             EXPECT(WIFEXITED(native_status));
             if(WIFEXITED(native_status) && WEXITSTATUS(native_status) == 77)
             {
-                fprintf(stderr, "native smoke fixture unavailable: p101_parse_positive_short\n");
+                fprintf(stderr, "native smoke fixture unavailable: p101_parse_int\n");
             }
             else if(WIFEXITED(native_status))
             {
                 if(WEXITSTATUS(native_status) != EXIT_SUCCESS)
                 {
-                    fprintf(stderr, "native smoke exited unsuccessfully: p101_parse_positive_short: %d\n", WEXITSTATUS(native_status));
+                    fprintf(stderr, "native smoke exited unsuccessfully: p101_parse_int: %d\n", WEXITSTATUS(native_status));
                 }
                 EXPECT(WEXITSTATUS(native_status) == EXIT_SUCCESS);
             }
@@ -3520,9 +3543,9 @@ static void test_p101_parse_positive_short(struct p101_env *env, struct p101_err
     }
 }
 
-/* P101_TEST_CASE(p101_parse_short) */
-static void test_p101_parse_short(struct p101_env *env, struct p101_error *err)
-{
+/* P101_TEST_CASE(p101_parse_int16_t) */
+static void test_p101_parse_int16_t(struct p101_env *env, struct p101_error *err)
+{
 #ifdef __linux__
     static const int         errors[]      = {EIO};
     static const char *const error_names[] = {"EIO"};
@@ -3547,14 +3570,14 @@ static void test_p101_parse_short(struct p101_env *env, struct p101_error *err)
         fault_resource_events = 0U;
         errno                 = P101_TEST_ERRNO_SENTINEL;
         p101_env_set_fault_injector(env, fail_next_call, &state);
-        short result = p101_parse_short(env, err, NULL, 0);
+        int16_t result = p101_parse_int16_t(env, err, NULL, 0);
         (void)result;
         EXPECT(state.checks == 1);
         EXPECT(p101_error_is_errno(err, state.code));
         EXPECT(errno == P101_TEST_ERRNO_SENTINEL);
         EXPECT(result == (0));
         EXPECT(fault_resource_events == 0U);
-        write_outcome("p101_parse_short", "errno", error_names[index], state.code, failures == failures_before);
+        write_outcome("p101_parse_int16_t", "errno", error_names[index], state.code, failures == failures_before);
         p101_error_reset(err);
     }
     p101_env_set_fault_injector(env, NULL, NULL);
@@ -3598,7 +3621,7 @@ static void test_p101_parse_short(struct p101_env *env, struct p101_error *err)
                 native_child_status = 77;
                 goto native_child_done_;
             }
-            short native_result = p101_parse_short(native_env, native_err, "1", 0);
+            int16_t native_result = p101_parse_int16_t(native_env, native_err, "1", 0);
             (void)native_result;
             if(p101_error_has_error(native_err))
             {
@@ -3613,7 +3636,7 @@ static void test_p101_parse_short(struct p101_env *env, struct p101_error *err)
                 }
                 if(!native_error_declared)
                 {
-                    fprintf(stderr, "native smoke produced an undeclared platform failure: p101_parse_short: %s\n", p101_error_get_message(native_err));
+                    fprintf(stderr, "native smoke produced an undeclared platform failure: p101_parse_int16_t: %s\n", p101_error_get_message(native_err));
                     native_passed = false;
                 }
                 p101_error_reset(native_err);
@@ -3628,18 +3651,18 @@ static void test_p101_parse_short(struct p101_env *env, struct p101_error *err)
             EXPECT(native_waitpid_nointr(native_pid, &native_status) == native_pid);
             if(WIFSIGNALED(native_status))
             {
-                fprintf(stderr, "native smoke terminated by signal: p101_parse_short: %d\n", WTERMSIG(native_status));
+                fprintf(stderr, "native smoke terminated by signal: p101_parse_int16_t: %d\n", WTERMSIG(native_status));
             }
             EXPECT(WIFEXITED(native_status));
             if(WIFEXITED(native_status) && WEXITSTATUS(native_status) == 77)
             {
-                fprintf(stderr, "native smoke fixture unavailable: p101_parse_short\n");
+                fprintf(stderr, "native smoke fixture unavailable: p101_parse_int16_t\n");
             }
             else if(WIFEXITED(native_status))
             {
                 if(WEXITSTATUS(native_status) != EXIT_SUCCESS)
                 {
-                    fprintf(stderr, "native smoke exited unsuccessfully: p101_parse_short: %d\n", WEXITSTATUS(native_status));
+                    fprintf(stderr, "native smoke exited unsuccessfully: p101_parse_int16_t: %d\n", WEXITSTATUS(native_status));
                 }
                 EXPECT(WEXITSTATUS(native_status) == EXIT_SUCCESS);
             }
@@ -3648,8 +3671,8 @@ static void test_p101_parse_short(struct p101_env *env, struct p101_error *err)
     }
 }
 
-/* P101_TEST_CASE(p101_parse_uint16_t) */
-static void test_p101_parse_uint16_t(struct p101_env *env, struct p101_error *err)
+/* P101_TEST_CASE(p101_parse_int16_t_array) */
+static void test_p101_parse_int16_t_array(struct p101_env *env, struct p101_error *err)
 {
 #ifdef __linux__
     static const int         errors[]      = {EIO};
@@ -3675,14 +3698,14 @@ static void test_p101_parse_uint16_t(struct p101_env *env, struct p101_error *er
         fault_resource_events = 0U;
         errno                 = P101_TEST_ERRNO_SENTINEL;
         p101_env_set_fault_injector(env, fail_next_call, &state);
-        uint16_t result = p101_parse_uint16_t(env, err, NULL, 0);
+        size_t result = p101_parse_int16_t_array(env, err, NULL, 0, NULL, NULL);
         (void)result;
         EXPECT(state.checks == 1);
         EXPECT(p101_error_is_errno(err, state.code));
         EXPECT(errno == P101_TEST_ERRNO_SENTINEL);
         EXPECT(result == (0));
         EXPECT(fault_resource_events == 0U);
-        write_outcome("p101_parse_uint16_t", "errno", error_names[index], state.code, failures == failures_before);
+        write_outcome("p101_parse_int16_t_array", "errno", error_names[index], state.code, failures == failures_before);
         p101_error_reset(err);
     }
     p101_env_set_fault_injector(env, NULL, NULL);
@@ -3726,7 +3749,10 @@ static void test_p101_parse_uint16_t(struct p101_env *env, struct p101_error *er
                 native_child_status = 77;
                 goto native_child_done_;
             }
-            uint16_t native_result = p101_parse_uint16_t(native_env, native_err, "1", 0);
+            const char *const native_argument_2[]  = {"1"};
+            int16_t           native_argument_4[1] = {0};
+            uint8_t           native_argument_5[1] = {0};
+            size_t            native_result        = p101_parse_int16_t_array(native_env, native_err, native_argument_2, 1, native_argument_4, native_argument_5);
             (void)native_result;
             if(p101_error_has_error(native_err))
             {
@@ -3741,7 +3767,7 @@ static void test_p101_parse_uint16_t(struct p101_env *env, struct p101_error *er
                 }
                 if(!native_error_declared)
                 {
-                    fprintf(stderr, "native smoke produced an undeclared platform failure: p101_parse_uint16_t: %s\n", p101_error_get_message(native_err));
+                    fprintf(stderr, "native smoke produced an undeclared platform failure: p101_parse_int16_t_array: %s\n", p101_error_get_message(native_err));
                     native_passed = false;
                 }
                 p101_error_reset(native_err);
@@ -3756,18 +3782,18 @@ static void test_p101_parse_uint16_t(struct p101_env *env, struct p101_error *er
             EXPECT(native_waitpid_nointr(native_pid, &native_status) == native_pid);
             if(WIFSIGNALED(native_status))
             {
-                fprintf(stderr, "native smoke terminated by signal: p101_parse_uint16_t: %d\n", WTERMSIG(native_status));
+                fprintf(stderr, "native smoke terminated by signal: p101_parse_int16_t_array: %d\n", WTERMSIG(native_status));
             }
             EXPECT(WIFEXITED(native_status));
             if(WIFEXITED(native_status) && WEXITSTATUS(native_status) == 77)
             {
-                fprintf(stderr, "native smoke fixture unavailable: p101_parse_uint16_t\n");
+                fprintf(stderr, "native smoke fixture unavailable: p101_parse_int16_t_array\n");
             }
             else if(WIFEXITED(native_status))
             {
                 if(WEXITSTATUS(native_status) != EXIT_SUCCESS)
                 {
-                    fprintf(stderr, "native smoke exited unsuccessfully: p101_parse_uint16_t: %d\n", WEXITSTATUS(native_status));
+                    fprintf(stderr, "native smoke exited unsuccessfully: p101_parse_int16_t_array: %d\n", WEXITSTATUS(native_status));
                 }
                 EXPECT(WEXITSTATUS(native_status) == EXIT_SUCCESS);
             }
@@ -3776,8 +3802,8 @@ static void test_p101_parse_uint16_t(struct p101_env *env, struct p101_error *er
     }
 }
 
-/* P101_TEST_CASE(p101_parse_uint32_t) */
-static void test_p101_parse_uint32_t(struct p101_env *env, struct p101_error *err)
+/* P101_TEST_CASE(p101_parse_int16_t_base) */
+static void test_p101_parse_int16_t_base(struct p101_env *env, struct p101_error *err)
 {
 #ifdef __linux__
     static const int         errors[]      = {EIO};
@@ -3803,14 +3829,14 @@ static void test_p101_parse_uint32_t(struct p101_env *env, struct p101_error *er
         fault_resource_events = 0U;
         errno                 = P101_TEST_ERRNO_SENTINEL;
         p101_env_set_fault_injector(env, fail_next_call, &state);
-        uint32_t result = p101_parse_uint32_t(env, err, NULL, 0);
+        int16_t result = p101_parse_int16_t_base(env, err, NULL, 0, 0);
         (void)result;
         EXPECT(state.checks == 1);
         EXPECT(p101_error_is_errno(err, state.code));
         EXPECT(errno == P101_TEST_ERRNO_SENTINEL);
         EXPECT(result == (0));
         EXPECT(fault_resource_events == 0U);
-        write_outcome("p101_parse_uint32_t", "errno", error_names[index], state.code, failures == failures_before);
+        write_outcome("p101_parse_int16_t_base", "errno", error_names[index], state.code, failures == failures_before);
         p101_error_reset(err);
     }
     p101_env_set_fault_injector(env, NULL, NULL);
@@ -3854,7 +3880,7 @@ static void test_p101_parse_uint32_t(struct p101_env *env, struct p101_error *er
                 native_child_status = 77;
                 goto native_child_done_;
             }
-            uint32_t native_result = p101_parse_uint32_t(native_env, native_err, "1", 0);
+            int16_t native_result = p101_parse_int16_t_base(native_env, native_err, "0x1", 0, 0);
             (void)native_result;
             if(p101_error_has_error(native_err))
             {
@@ -3869,7 +3895,7 @@ static void test_p101_parse_uint32_t(struct p101_env *env, struct p101_error *er
                 }
                 if(!native_error_declared)
                 {
-                    fprintf(stderr, "native smoke produced an undeclared platform failure: p101_parse_uint32_t: %s\n", p101_error_get_message(native_err));
+                    fprintf(stderr, "native smoke produced an undeclared platform failure: p101_parse_int16_t_base: %s\n", p101_error_get_message(native_err));
                     native_passed = false;
                 }
                 p101_error_reset(native_err);
@@ -3884,18 +3910,18 @@ static void test_p101_parse_uint32_t(struct p101_env *env, struct p101_error *er
             EXPECT(native_waitpid_nointr(native_pid, &native_status) == native_pid);
             if(WIFSIGNALED(native_status))
             {
-                fprintf(stderr, "native smoke terminated by signal: p101_parse_uint32_t: %d\n", WTERMSIG(native_status));
+                fprintf(stderr, "native smoke terminated by signal: p101_parse_int16_t_base: %d\n", WTERMSIG(native_status));
             }
             EXPECT(WIFEXITED(native_status));
             if(WIFEXITED(native_status) && WEXITSTATUS(native_status) == 77)
             {
-                fprintf(stderr, "native smoke fixture unavailable: p101_parse_uint32_t\n");
+                fprintf(stderr, "native smoke fixture unavailable: p101_parse_int16_t_base\n");
             }
             else if(WIFEXITED(native_status))
             {
                 if(WEXITSTATUS(native_status) != EXIT_SUCCESS)
                 {
-                    fprintf(stderr, "native smoke exited unsuccessfully: p101_parse_uint32_t: %d\n", WEXITSTATUS(native_status));
+                    fprintf(stderr, "native smoke exited unsuccessfully: p101_parse_int16_t_base: %d\n", WEXITSTATUS(native_status));
                 }
                 EXPECT(WEXITSTATUS(native_status) == EXIT_SUCCESS);
             }
@@ -3904,8 +3930,8 @@ static void test_p101_parse_uint32_t(struct p101_env *env, struct p101_error *er
     }
 }
 
-/* P101_TEST_CASE(p101_parse_uint64_t) */
-static void test_p101_parse_uint64_t(struct p101_env *env, struct p101_error *err)
+/* P101_TEST_CASE(p101_parse_int16_t_n) */
+static void test_p101_parse_int16_t_n(struct p101_env *env, struct p101_error *err)
 {
 #ifdef __linux__
     static const int         errors[]      = {EIO};
@@ -3931,14 +3957,14 @@ static void test_p101_parse_uint64_t(struct p101_env *env, struct p101_error *er
         fault_resource_events = 0U;
         errno                 = P101_TEST_ERRNO_SENTINEL;
         p101_env_set_fault_injector(env, fail_next_call, &state);
-        uint64_t result = p101_parse_uint64_t(env, err, NULL, 0);
+        int16_t result = p101_parse_int16_t_n(env, err, NULL, 0, 0);
         (void)result;
         EXPECT(state.checks == 1);
         EXPECT(p101_error_is_errno(err, state.code));
         EXPECT(errno == P101_TEST_ERRNO_SENTINEL);
         EXPECT(result == (0));
         EXPECT(fault_resource_events == 0U);
-        write_outcome("p101_parse_uint64_t", "errno", error_names[index], state.code, failures == failures_before);
+        write_outcome("p101_parse_int16_t_n", "errno", error_names[index], state.code, failures == failures_before);
         p101_error_reset(err);
     }
     p101_env_set_fault_injector(env, NULL, NULL);
@@ -3982,7 +4008,7 @@ static void test_p101_parse_uint64_t(struct p101_env *env, struct p101_error *er
                 native_child_status = 77;
                 goto native_child_done_;
             }
-            uint64_t native_result = p101_parse_uint64_t(native_env, native_err, "1", 0);
+            int16_t native_result = p101_parse_int16_t_n(native_env, native_err, "1", 1, 0);
             (void)native_result;
             if(p101_error_has_error(native_err))
             {
@@ -3997,7 +4023,7 @@ static void test_p101_parse_uint64_t(struct p101_env *env, struct p101_error *er
                 }
                 if(!native_error_declared)
                 {
-                    fprintf(stderr, "native smoke produced an undeclared platform failure: p101_parse_uint64_t: %s\n", p101_error_get_message(native_err));
+                    fprintf(stderr, "native smoke produced an undeclared platform failure: p101_parse_int16_t_n: %s\n", p101_error_get_message(native_err));
                     native_passed = false;
                 }
                 p101_error_reset(native_err);
@@ -4012,18 +4038,18 @@ static void test_p101_parse_uint64_t(struct p101_env *env, struct p101_error *er
             EXPECT(native_waitpid_nointr(native_pid, &native_status) == native_pid);
             if(WIFSIGNALED(native_status))
             {
-                fprintf(stderr, "native smoke terminated by signal: p101_parse_uint64_t: %d\n", WTERMSIG(native_status));
+                fprintf(stderr, "native smoke terminated by signal: p101_parse_int16_t_n: %d\n", WTERMSIG(native_status));
             }
             EXPECT(WIFEXITED(native_status));
             if(WIFEXITED(native_status) && WEXITSTATUS(native_status) == 77)
             {
-                fprintf(stderr, "native smoke fixture unavailable: p101_parse_uint64_t\n");
+                fprintf(stderr, "native smoke fixture unavailable: p101_parse_int16_t_n\n");
             }
             else if(WIFEXITED(native_status))
             {
                 if(WEXITSTATUS(native_status) != EXIT_SUCCESS)
                 {
-                    fprintf(stderr, "native smoke exited unsuccessfully: p101_parse_uint64_t: %d\n", WEXITSTATUS(native_status));
+                    fprintf(stderr, "native smoke exited unsuccessfully: p101_parse_int16_t_n: %d\n", WEXITSTATUS(native_status));
                 }
                 EXPECT(WEXITSTATUS(native_status) == EXIT_SUCCESS);
             }
@@ -4032,8 +4058,8 @@ static void test_p101_parse_uint64_t(struct p101_env *env, struct p101_error *er
     }
 }
 
-/* P101_TEST_CASE(p101_parse_uint8_t) */
-static void test_p101_parse_uint8_t(struct p101_env *env, struct p101_error *err)
+/* P101_TEST_CASE(p101_parse_int16_t_prefix) */
+static void test_p101_parse_int16_t_prefix(struct p101_env *env, struct p101_error *err)
 {
 #ifdef __linux__
     static const int         errors[]      = {EIO};
@@ -4059,14 +4085,14 @@ static void test_p101_parse_uint8_t(struct p101_env *env, struct p101_error *err
         fault_resource_events = 0U;
         errno                 = P101_TEST_ERRNO_SENTINEL;
         p101_env_set_fault_injector(env, fail_next_call, &state);
-        uint8_t result = p101_parse_uint8_t(env, err, NULL, 0);
+        int16_t result = p101_parse_int16_t_prefix(env, err, NULL, NULL, 0);
         (void)result;
         EXPECT(state.checks == 1);
         EXPECT(p101_error_is_errno(err, state.code));
         EXPECT(errno == P101_TEST_ERRNO_SENTINEL);
         EXPECT(result == (0));
         EXPECT(fault_resource_events == 0U);
-        write_outcome("p101_parse_uint8_t", "errno", error_names[index], state.code, failures == failures_before);
+        write_outcome("p101_parse_int16_t_prefix", "errno", error_names[index], state.code, failures == failures_before);
         p101_error_reset(err);
     }
     p101_env_set_fault_injector(env, NULL, NULL);
@@ -4110,7 +4136,8 @@ static void test_p101_parse_uint8_t(struct p101_env *env, struct p101_error *err
                 native_child_status = 77;
                 goto native_child_done_;
             }
-            uint8_t native_result = p101_parse_uint8_t(native_env, native_err, "1", 0);
+            const char *native_argument_3 = NULL;
+            int16_t     native_result     = p101_parse_int16_t_prefix(native_env, native_err, "1", &native_argument_3, 0);
             (void)native_result;
             if(p101_error_has_error(native_err))
             {
@@ -4125,7 +4152,7 @@ static void test_p101_parse_uint8_t(struct p101_env *env, struct p101_error *err
                 }
                 if(!native_error_declared)
                 {
-                    fprintf(stderr, "native smoke produced an undeclared platform failure: p101_parse_uint8_t: %s\n", p101_error_get_message(native_err));
+                    fprintf(stderr, "native smoke produced an undeclared platform failure: p101_parse_int16_t_prefix: %s\n", p101_error_get_message(native_err));
                     native_passed = false;
                 }
                 p101_error_reset(native_err);
@@ -4140,18 +4167,18 @@ static void test_p101_parse_uint8_t(struct p101_env *env, struct p101_error *err
             EXPECT(native_waitpid_nointr(native_pid, &native_status) == native_pid);
             if(WIFSIGNALED(native_status))
             {
-                fprintf(stderr, "native smoke terminated by signal: p101_parse_uint8_t: %d\n", WTERMSIG(native_status));
+                fprintf(stderr, "native smoke terminated by signal: p101_parse_int16_t_prefix: %d\n", WTERMSIG(native_status));
             }
             EXPECT(WIFEXITED(native_status));
             if(WIFEXITED(native_status) && WEXITSTATUS(native_status) == 77)
             {
-                fprintf(stderr, "native smoke fixture unavailable: p101_parse_uint8_t\n");
+                fprintf(stderr, "native smoke fixture unavailable: p101_parse_int16_t_prefix\n");
             }
             else if(WIFEXITED(native_status))
             {
                 if(WEXITSTATUS(native_status) != EXIT_SUCCESS)
                 {
-                    fprintf(stderr, "native smoke exited unsuccessfully: p101_parse_uint8_t: %d\n", WEXITSTATUS(native_status));
+                    fprintf(stderr, "native smoke exited unsuccessfully: p101_parse_int16_t_prefix: %d\n", WEXITSTATUS(native_status));
                 }
                 EXPECT(WEXITSTATUS(native_status) == EXIT_SUCCESS);
             }
@@ -4160,8 +4187,8 @@ static void test_p101_parse_uint8_t(struct p101_env *env, struct p101_error *err
     }
 }
 
-/* P101_TEST_CASE(p101_parse_unsigned_char) */
-static void test_p101_parse_unsigned_char(struct p101_env *env, struct p101_error *err)
+/* P101_TEST_CASE(p101_parse_int32_t) */
+static void test_p101_parse_int32_t(struct p101_env *env, struct p101_error *err)
 {
 #ifdef __linux__
     static const int         errors[]      = {EIO};
@@ -4187,14 +4214,14 @@ static void test_p101_parse_unsigned_char(struct p101_env *env, struct p101_erro
         fault_resource_events = 0U;
         errno                 = P101_TEST_ERRNO_SENTINEL;
         p101_env_set_fault_injector(env, fail_next_call, &state);
-        unsigned char result = p101_parse_unsigned_char(env, err, NULL, 0);
+        int32_t result = p101_parse_int32_t(env, err, NULL, 0);
         (void)result;
         EXPECT(state.checks == 1);
         EXPECT(p101_error_is_errno(err, state.code));
         EXPECT(errno == P101_TEST_ERRNO_SENTINEL);
         EXPECT(result == (0));
         EXPECT(fault_resource_events == 0U);
-        write_outcome("p101_parse_unsigned_char", "errno", error_names[index], state.code, failures == failures_before);
+        write_outcome("p101_parse_int32_t", "errno", error_names[index], state.code, failures == failures_before);
         p101_error_reset(err);
     }
     p101_env_set_fault_injector(env, NULL, NULL);
@@ -4238,7 +4265,7 @@ static void test_p101_parse_unsigned_char(struct p101_env *env, struct p101_erro
                 native_child_status = 77;
                 goto native_child_done_;
             }
-            unsigned char native_result = p101_parse_unsigned_char(native_env, native_err, "1", 0);
+            int32_t native_result = p101_parse_int32_t(native_env, native_err, "1", 0);
             (void)native_result;
             if(p101_error_has_error(native_err))
             {
@@ -4253,7 +4280,7 @@ static void test_p101_parse_unsigned_char(struct p101_env *env, struct p101_erro
                 }
                 if(!native_error_declared)
                 {
-                    fprintf(stderr, "native smoke produced an undeclared platform failure: p101_parse_unsigned_char: %s\n", p101_error_get_message(native_err));
+                    fprintf(stderr, "native smoke produced an undeclared platform failure: p101_parse_int32_t: %s\n", p101_error_get_message(native_err));
                     native_passed = false;
                 }
                 p101_error_reset(native_err);
@@ -4268,18 +4295,18 @@ static void test_p101_parse_unsigned_char(struct p101_env *env, struct p101_erro
             EXPECT(native_waitpid_nointr(native_pid, &native_status) == native_pid);
             if(WIFSIGNALED(native_status))
             {
-                fprintf(stderr, "native smoke terminated by signal: p101_parse_unsigned_char: %d\n", WTERMSIG(native_status));
+                fprintf(stderr, "native smoke terminated by signal: p101_parse_int32_t: %d\n", WTERMSIG(native_status));
             }
             EXPECT(WIFEXITED(native_status));
             if(WIFEXITED(native_status) && WEXITSTATUS(native_status) == 77)
             {
-                fprintf(stderr, "native smoke fixture unavailable: p101_parse_unsigned_char\n");
+                fprintf(stderr, "native smoke fixture unavailable: p101_parse_int32_t\n");
             }
             else if(WIFEXITED(native_status))
             {
                 if(WEXITSTATUS(native_status) != EXIT_SUCCESS)
                 {
-                    fprintf(stderr, "native smoke exited unsuccessfully: p101_parse_unsigned_char: %d\n", WEXITSTATUS(native_status));
+                    fprintf(stderr, "native smoke exited unsuccessfully: p101_parse_int32_t: %d\n", WEXITSTATUS(native_status));
                 }
                 EXPECT(WEXITSTATUS(native_status) == EXIT_SUCCESS);
             }
@@ -4288,8 +4315,8 @@ static void test_p101_parse_unsigned_char(struct p101_env *env, struct p101_erro
     }
 }
 
-/* P101_TEST_CASE(p101_parse_unsigned_int) */
-static void test_p101_parse_unsigned_int(struct p101_env *env, struct p101_error *err)
+/* P101_TEST_CASE(p101_parse_int32_t_array) */
+static void test_p101_parse_int32_t_array(struct p101_env *env, struct p101_error *err)
 {
 #ifdef __linux__
     static const int         errors[]      = {EIO};
@@ -4315,14 +4342,14 @@ static void test_p101_parse_unsigned_int(struct p101_env *env, struct p101_error
         fault_resource_events = 0U;
         errno                 = P101_TEST_ERRNO_SENTINEL;
         p101_env_set_fault_injector(env, fail_next_call, &state);
-        unsigned int result = p101_parse_unsigned_int(env, err, NULL, 0);
+        size_t result = p101_parse_int32_t_array(env, err, NULL, 0, NULL, NULL);
         (void)result;
         EXPECT(state.checks == 1);
         EXPECT(p101_error_is_errno(err, state.code));
         EXPECT(errno == P101_TEST_ERRNO_SENTINEL);
         EXPECT(result == (0));
         EXPECT(fault_resource_events == 0U);
-        write_outcome("p101_parse_unsigned_int", "errno", error_names[index], state.code, failures == failures_before);
+        write_outcome("p101_parse_int32_t_array", "errno", error_names[index], state.code, failures == failures_before);
         p101_error_reset(err);
     }
     p101_env_set_fault_injector(env, NULL, NULL);
@@ -4366,7 +4393,10 @@ static void test_p101_parse_unsigned_int(struct p101_env *env, struct p101_error
                 native_child_status = 77;
                 goto native_child_done_;
             }
-            unsigned int native_result = p101_parse_unsigned_int(native_env, native_err, "1", 0);
+            const char *const native_argument_2[]  = {"1"};
+            int32_t           native_argument_4[1] = {0};
+            uint8_t           native_argument_5[1] = {0};
+            size_t            native_result        = p101_parse_int32_t_array(native_env, native_err, native_argument_2, 1, native_argument_4, native_argument_5);
             (void)native_result;
             if(p101_error_has_error(native_err))
             {
@@ -4381,7 +4411,7 @@ static void test_p101_parse_unsigned_int(struct p101_env *env, struct p101_error
                 }
                 if(!native_error_declared)
                 {
-                    fprintf(stderr, "native smoke produced an undeclared platform failure: p101_parse_unsigned_int: %s\n", p101_error_get_message(native_err));
+                    fprintf(stderr, "native smoke produced an undeclared platform failure: p101_parse_int32_t_array: %s\n", p101_error_get_message(native_err));
                     native_passed = false;
                 }
                 p101_error_reset(native_err);
@@ -4396,18 +4426,18 @@ static void test_p101_parse_unsigned_int(struct p101_env *env, struct p101_error
             EXPECT(native_waitpid_nointr(native_pid, &native_status) == native_pid);
             if(WIFSIGNALED(native_status))
             {
-                fprintf(stderr, "native smoke terminated by signal: p101_parse_unsigned_int: %d\n", WTERMSIG(native_status));
+                fprintf(stderr, "native smoke terminated by signal: p101_parse_int32_t_array: %d\n", WTERMSIG(native_status));
             }
             EXPECT(WIFEXITED(native_status));
             if(WIFEXITED(native_status) && WEXITSTATUS(native_status) == 77)
             {
-                fprintf(stderr, "native smoke fixture unavailable: p101_parse_unsigned_int\n");
+                fprintf(stderr, "native smoke fixture unavailable: p101_parse_int32_t_array\n");
             }
             else if(WIFEXITED(native_status))
             {
                 if(WEXITSTATUS(native_status) != EXIT_SUCCESS)
                 {
-                    fprintf(stderr, "native smoke exited unsuccessfully: p101_parse_unsigned_int: %d\n", WEXITSTATUS(native_status));
+                    fprintf(stderr, "native smoke exited unsuccessfully: p101_parse_int32_t_array: %d\n", WEXITSTATUS(native_status));
                 }
                 EXPECT(WEXITSTATUS(native_status) == EXIT_SUCCESS);
             }
@@ -4416,8 +4446,8 @@ static void test_p101_parse_unsigned_int(struct p101_env *env, struct p101_error
     }
 }
 
-/* P101_TEST_CASE(p101_parse_unsigned_long) */
-static void test_p101_parse_unsigned_long(struct p101_env *env, struct p101_error *err)
+/* P101_TEST_CASE(p101_parse_int32_t_base) */
+static void test_p101_parse_int32_t_base(struct p101_env *env, struct p101_error *err)
 {
 #ifdef __linux__
     static const int         errors[]      = {EIO};
@@ -4443,14 +4473,14 @@ static void test_p101_parse_unsigned_long(struct p101_env *env, struct p101_erro
         fault_resource_events = 0U;
         errno                 = P101_TEST_ERRNO_SENTINEL;
         p101_env_set_fault_injector(env, fail_next_call, &state);
-        unsigned long result = p101_parse_unsigned_long(env, err, NULL, 0);
+        int32_t result = p101_parse_int32_t_base(env, err, NULL, 0, 0);
         (void)result;
         EXPECT(state.checks == 1);
         EXPECT(p101_error_is_errno(err, state.code));
         EXPECT(errno == P101_TEST_ERRNO_SENTINEL);
         EXPECT(result == (0));
         EXPECT(fault_resource_events == 0U);
-        write_outcome("p101_parse_unsigned_long", "errno", error_names[index], state.code, failures == failures_before);
+        write_outcome("p101_parse_int32_t_base", "errno", error_names[index], state.code, failures == failures_before);
         p101_error_reset(err);
     }
     p101_env_set_fault_injector(env, NULL, NULL);
@@ -4494,7 +4524,7 @@ static void test_p101_parse_unsigned_long(struct p101_env *env, struct p101_erro
                 native_child_status = 77;
                 goto native_child_done_;
             }
-            unsigned long native_result = p101_parse_unsigned_long(native_env, native_err, "1", 0);
+            int32_t native_result = p101_parse_int32_t_base(native_env, native_err, "0x1", 0, 0);
             (void)native_result;
             if(p101_error_has_error(native_err))
             {
@@ -4509,7 +4539,7 @@ static void test_p101_parse_unsigned_long(struct p101_env *env, struct p101_erro
                 }
                 if(!native_error_declared)
                 {
-                    fprintf(stderr, "native smoke produced an undeclared platform failure: p101_parse_unsigned_long: %s\n", p101_error_get_message(native_err));
+                    fprintf(stderr, "native smoke produced an undeclared platform failure: p101_parse_int32_t_base: %s\n", p101_error_get_message(native_err));
                     native_passed = false;
                 }
                 p101_error_reset(native_err);
@@ -4524,18 +4554,18 @@ static void test_p101_parse_unsigned_long(struct p101_env *env, struct p101_erro
             EXPECT(native_waitpid_nointr(native_pid, &native_status) == native_pid);
             if(WIFSIGNALED(native_status))
             {
-                fprintf(stderr, "native smoke terminated by signal: p101_parse_unsigned_long: %d\n", WTERMSIG(native_status));
+                fprintf(stderr, "native smoke terminated by signal: p101_parse_int32_t_base: %d\n", WTERMSIG(native_status));
             }
             EXPECT(WIFEXITED(native_status));
             if(WIFEXITED(native_status) && WEXITSTATUS(native_status) == 77)
             {
-                fprintf(stderr, "native smoke fixture unavailable: p101_parse_unsigned_long\n");
+                fprintf(stderr, "native smoke fixture unavailable: p101_parse_int32_t_base\n");
             }
             else if(WIFEXITED(native_status))
             {
                 if(WEXITSTATUS(native_status) != EXIT_SUCCESS)
                 {
-                    fprintf(stderr, "native smoke exited unsuccessfully: p101_parse_unsigned_long: %d\n", WEXITSTATUS(native_status));
+                    fprintf(stderr, "native smoke exited unsuccessfully: p101_parse_int32_t_base: %d\n", WEXITSTATUS(native_status));
                 }
                 EXPECT(WEXITSTATUS(native_status) == EXIT_SUCCESS);
             }
@@ -4544,8 +4574,8 @@ static void test_p101_parse_unsigned_long(struct p101_env *env, struct p101_erro
     }
 }
 
-/* P101_TEST_CASE(p101_parse_unsigned_long_long) */
-static void test_p101_parse_unsigned_long_long(struct p101_env *env, struct p101_error *err)
+/* P101_TEST_CASE(p101_parse_int32_t_n) */
+static void test_p101_parse_int32_t_n(struct p101_env *env, struct p101_error *err)
 {
 #ifdef __linux__
     static const int         errors[]      = {EIO};
@@ -4571,14 +4601,14 @@ static void test_p101_parse_unsigned_long_long(struct p101_env *env, struct p101
         fault_resource_events = 0U;
         errno                 = P101_TEST_ERRNO_SENTINEL;
         p101_env_set_fault_injector(env, fail_next_call, &state);
-        unsigned long long result = p101_parse_unsigned_long_long(env, err, NULL, 0);
+        int32_t result = p101_parse_int32_t_n(env, err, NULL, 0, 0);
         (void)result;
         EXPECT(state.checks == 1);
         EXPECT(p101_error_is_errno(err, state.code));
         EXPECT(errno == P101_TEST_ERRNO_SENTINEL);
         EXPECT(result == (0));
         EXPECT(fault_resource_events == 0U);
-        write_outcome("p101_parse_unsigned_long_long", "errno", error_names[index], state.code, failures == failures_before);
+        write_outcome("p101_parse_int32_t_n", "errno", error_names[index], state.code, failures == failures_before);
         p101_error_reset(err);
     }
     p101_env_set_fault_injector(env, NULL, NULL);
@@ -4622,7 +4652,7 @@ static void test_p101_parse_unsigned_long_long(struct p101_env *env, struct p101
                 native_child_status = 77;
                 goto native_child_done_;
             }
-            unsigned long long native_result = p101_parse_unsigned_long_long(native_env, native_err, "1", 0);
+            int32_t native_result = p101_parse_int32_t_n(native_env, native_err, "1", 1, 0);
             (void)native_result;
             if(p101_error_has_error(native_err))
             {
@@ -4637,7 +4667,7 @@ static void test_p101_parse_unsigned_long_long(struct p101_env *env, struct p101
                 }
                 if(!native_error_declared)
                 {
-                    fprintf(stderr, "native smoke produced an undeclared platform failure: p101_parse_unsigned_long_long: %s\n", p101_error_get_message(native_err));
+                    fprintf(stderr, "native smoke produced an undeclared platform failure: p101_parse_int32_t_n: %s\n", p101_error_get_message(native_err));
                     native_passed = false;
                 }
                 p101_error_reset(native_err);
@@ -4652,18 +4682,18 @@ static void test_p101_parse_unsigned_long_long(struct p101_env *env, struct p101
             EXPECT(native_waitpid_nointr(native_pid, &native_status) == native_pid);
             if(WIFSIGNALED(native_status))
             {
-                fprintf(stderr, "native smoke terminated by signal: p101_parse_unsigned_long_long: %d\n", WTERMSIG(native_status));
+                fprintf(stderr, "native smoke terminated by signal: p101_parse_int32_t_n: %d\n", WTERMSIG(native_status));
             }
             EXPECT(WIFEXITED(native_status));
             if(WIFEXITED(native_status) && WEXITSTATUS(native_status) == 77)
             {
-                fprintf(stderr, "native smoke fixture unavailable: p101_parse_unsigned_long_long\n");
+                fprintf(stderr, "native smoke fixture unavailable: p101_parse_int32_t_n\n");
             }
             else if(WIFEXITED(native_status))
             {
                 if(WEXITSTATUS(native_status) != EXIT_SUCCESS)
                 {
-                    fprintf(stderr, "native smoke exited unsuccessfully: p101_parse_unsigned_long_long: %d\n", WEXITSTATUS(native_status));
+                    fprintf(stderr, "native smoke exited unsuccessfully: p101_parse_int32_t_n: %d\n", WEXITSTATUS(native_status));
                 }
                 EXPECT(WEXITSTATUS(native_status) == EXIT_SUCCESS);
             }
@@ -4672,8 +4702,8 @@ static void test_p101_parse_unsigned_long_long(struct p101_env *env, struct p101
     }
 }
 
-/* P101_TEST_CASE(p101_parse_unsigned_short) */
-static void test_p101_parse_unsigned_short(struct p101_env *env, struct p101_error *err)
+/* P101_TEST_CASE(p101_parse_int32_t_prefix) */
+static void test_p101_parse_int32_t_prefix(struct p101_env *env, struct p101_error *err)
 {
 #ifdef __linux__
     static const int         errors[]      = {EIO};
@@ -4699,14 +4729,14 @@ static void test_p101_parse_unsigned_short(struct p101_env *env, struct p101_err
         fault_resource_events = 0U;
         errno                 = P101_TEST_ERRNO_SENTINEL;
         p101_env_set_fault_injector(env, fail_next_call, &state);
-        unsigned short result = p101_parse_unsigned_short(env, err, NULL, 0);
+        int32_t result = p101_parse_int32_t_prefix(env, err, NULL, NULL, 0);
         (void)result;
         EXPECT(state.checks == 1);
         EXPECT(p101_error_is_errno(err, state.code));
         EXPECT(errno == P101_TEST_ERRNO_SENTINEL);
         EXPECT(result == (0));
         EXPECT(fault_resource_events == 0U);
-        write_outcome("p101_parse_unsigned_short", "errno", error_names[index], state.code, failures == failures_before);
+        write_outcome("p101_parse_int32_t_prefix", "errno", error_names[index], state.code, failures == failures_before);
         p101_error_reset(err);
     }
     p101_env_set_fault_injector(env, NULL, NULL);
@@ -4750,7 +4780,8 @@ static void test_p101_parse_unsigned_short(struct p101_env *env, struct p101_err
                 native_child_status = 77;
                 goto native_child_done_;
             }
-            unsigned short native_result = p101_parse_unsigned_short(native_env, native_err, "1", 0);
+            const char *native_argument_3 = NULL;
+            int32_t     native_result     = p101_parse_int32_t_prefix(native_env, native_err, "1", &native_argument_3, 0);
             (void)native_result;
             if(p101_error_has_error(native_err))
             {
@@ -4765,7 +4796,7 @@ static void test_p101_parse_unsigned_short(struct p101_env *env, struct p101_err
                 }
                 if(!native_error_declared)
                 {
-                    fprintf(stderr, "native smoke produced an undeclared platform failure: p101_parse_unsigned_short: %s\n", p101_error_get_message(native_err));
+                    fprintf(stderr, "native smoke produced an undeclared platform failure: p101_parse_int32_t_prefix: %s\n", p101_error_get_message(native_err));
                     native_passed = false;
                 }
                 p101_error_reset(native_err);
@@ -4780,18 +4811,18 @@ static void test_p101_parse_unsigned_short(struct p101_env *env, struct p101_err
             EXPECT(native_waitpid_nointr(native_pid, &native_status) == native_pid);
             if(WIFSIGNALED(native_status))
             {
-                fprintf(stderr, "native smoke terminated by signal: p101_parse_unsigned_short: %d\n", WTERMSIG(native_status));
+                fprintf(stderr, "native smoke terminated by signal: p101_parse_int32_t_prefix: %d\n", WTERMSIG(native_status));
             }
             EXPECT(WIFEXITED(native_status));
             if(WIFEXITED(native_status) && WEXITSTATUS(native_status) == 77)
             {
-                fprintf(stderr, "native smoke fixture unavailable: p101_parse_unsigned_short\n");
+                fprintf(stderr, "native smoke fixture unavailable: p101_parse_int32_t_prefix\n");
             }
             else if(WIFEXITED(native_status))
             {
                 if(WEXITSTATUS(native_status) != EXIT_SUCCESS)
                 {
-                    fprintf(stderr, "native smoke exited unsuccessfully: p101_parse_unsigned_short: %d\n", WEXITSTATUS(native_status));
+                    fprintf(stderr, "native smoke exited unsuccessfully: p101_parse_int32_t_prefix: %d\n", WEXITSTATUS(native_status));
                 }
                 EXPECT(WEXITSTATUS(native_status) == EXIT_SUCCESS);
             }
@@ -4800,65 +4831,15394 @@ static void test_p101_parse_unsigned_short(struct p101_env *env, struct p101_err
     }
 }
 
-int main(void)
+/* P101_TEST_CASE(p101_parse_int64_t) */
+static void test_p101_parse_int64_t(struct p101_env *env, struct p101_error *err)
 {
-    const char        *outcome_path;
-    struct p101_error *err = NULL;
-    struct p101_env   *env = NULL;
-    int                status;
+#ifdef __linux__
+    static const int         errors[]      = {EIO};
+    static const char *const error_names[] = {"EIO"};
+#elif defined(__APPLE__)
+    static const int         errors[]      = {EIO};
+    static const char *const error_names[] = {"EIO"};
+#elif defined(__FreeBSD__)
+    static const int         errors[]      = {EIO};
+    static const char *const error_names[] = {"EIO"};
+#else
+    static const int         errors[]      = {EIO};
+    static const char *const error_names[] = {"EIO"};
+#endif
 
-    outcome_path = getenv("P101_WRAPPER_OUTCOME_LOG");
-    if(outcome_path != NULL && outcome_path[0] != '\0')
-    {
-        outcome_stream = fopen(outcome_path, "a");
-        if(outcome_stream == NULL)
-        {
-            fprintf(stderr, "FAIL: cannot open wrapper outcome receipt\n");
-            failures++;
-        }
-    }
-    if(failures == 0)
-    {
-        err = p101_error_create(false);
-    }
-    if(err != NULL)
-    {
-        env = p101_env_create(err, NULL);
-    }
-    if(env == NULL)
+    for(size_t index = 0U; index < sizeof(errors) / sizeof(errors[0]); index++)
     {
-        failures++;
+        struct fault_state state = {0, errors[index]};
+        int                failures_before;
+
+        failures_before = failures;
+        EXPECT(p101_error_has_no_error(err));
+        fault_resource_events = 0U;
+        errno                 = P101_TEST_ERRNO_SENTINEL;
+        p101_env_set_fault_injector(env, fail_next_call, &state);
+        int64_t result = p101_parse_int64_t(env, err, NULL, 0);
+        (void)result;
+        EXPECT(state.checks == 1);
+        EXPECT(p101_error_is_errno(err, state.code));
+        EXPECT(errno == P101_TEST_ERRNO_SENTINEL);
+        EXPECT(result == (0));
+        EXPECT(fault_resource_events == 0U);
+        write_outcome("p101_parse_int64_t", "errno", error_names[index], state.code, failures == failures_before);
+        p101_error_reset(err);
     }
-    else
+    p101_env_set_fault_injector(env, NULL, NULL);
     {
-        p101_env_set_fd_observer(env, count_fd_event, NULL);
-        p101_env_set_alloc_observer(env, count_alloc_event, NULL);
-        p101_env_set_resource_observer(env, count_resource_event, NULL);
-        if(!native_child_process)
+        int   native_status = 0;
+        pid_t native_pid    = fork();
+
+        EXPECT(native_pid >= 0);
+        if(native_pid == 0)
         {
-            test_p101_parse_char(env, err);
+            bool               native_passed = true;
+            struct p101_error *native_err    = NULL;
+            struct p101_env   *native_env    = NULL;
+            FILE              *native_stdin_result;
+
+            native_child_process = true;
+            failures             = 0;
+            (void)alarm(2U);
+            if(unsetenv("P101_CALL_LOG") != 0 || unsetenv("P101_RESOURCE_LOG") != 0)
+            {
+                fprintf(stderr, "native setup failed: cannot clear p101 logging environment\n");
+                native_child_status = 77;
+                goto native_child_done_;
+            }
+            native_stdin_result = freopen("/dev/null", "r", stdin);
+            if(native_stdin_result == NULL)
+            {
+                fprintf(stderr, "native setup failed: cannot make standard input deterministic\n");
+                native_child_status = 77;
+                goto native_child_done_;
+            }
+            native_err = p101_error_create(false);
+            if(native_err == NULL)
+            {
+                native_child_status = 77;
+                goto native_child_done_;
+            }
+            native_env = p101_env_create(native_err, NULL);
+            if(native_env == NULL)
+            {
+                native_child_status = 77;
+                goto native_child_done_;
+            }
+            int64_t native_result = p101_parse_int64_t(native_env, native_err, "1", 0);
+            (void)native_result;
+            if(p101_error_has_error(native_err))
+            {
+                bool native_error_declared = false;
+
+                for(size_t native_error_index = 0U; native_error_index < sizeof(errors) / sizeof(errors[0]); native_error_index++)
+                {
+                    if(p101_error_is_errno(native_err, errors[native_error_index]))
+                    {
+                        native_error_declared = true;
+                    }
+                }
+                if(!native_error_declared)
+                {
+                    fprintf(stderr, "native smoke produced an undeclared platform failure: p101_parse_int64_t: %s\n", p101_error_get_message(native_err));
+                    native_passed = false;
+                }
+                p101_error_reset(native_err);
+            }
+            native_child_status = native_passed ? EXIT_SUCCESS : EXIT_FAILURE;
+        native_child_done_:
+            p101_env_destroy(native_env);
+            p101_error_destroy(native_err);
         }
-        if(!native_child_process)
+        if(native_pid > 0)
         {
-            test_p101_parse_int(env, err);
+            EXPECT(native_waitpid_nointr(native_pid, &native_status) == native_pid);
+            if(WIFSIGNALED(native_status))
+            {
+                fprintf(stderr, "native smoke terminated by signal: p101_parse_int64_t: %d\n", WTERMSIG(native_status));
+            }
+            EXPECT(WIFEXITED(native_status));
+            if(WIFEXITED(native_status) && WEXITSTATUS(native_status) == 77)
+            {
+                fprintf(stderr, "native smoke fixture unavailable: p101_parse_int64_t\n");
+            }
+            else if(WIFEXITED(native_status))
+            {
+                if(WEXITSTATUS(native_status) != EXIT_SUCCESS)
+                {
+                    fprintf(stderr, "native smoke exited unsuccessfully: p101_parse_int64_t: %d\n", WEXITSTATUS(native_status));
+                }
+                EXPECT(WEXITSTATUS(native_status) == EXIT_SUCCESS);
+            }
         }
-        if(!native_child_process)
+        p101_error_reset(err);
+    }
+}
+
+/* P101_TEST_CASE(p101_parse_int64_t_array) */
+static void test_p101_parse_int64_t_array(struct p101_env *env, struct p101_error *err)
+{
+#ifdef __linux__
+    static const int         errors[]      = {EIO};
+    static const char *const error_names[] = {"EIO"};
+#elif defined(__APPLE__)
+    static const int         errors[]      = {EIO};
+    static const char *const error_names[] = {"EIO"};
+#elif defined(__FreeBSD__)
+    static const int         errors[]      = {EIO};
+    static const char *const error_names[] = {"EIO"};
+#else
+    static const int         errors[]      = {EIO};
+    static const char *const error_names[] = {"EIO"};
+#endif
+
+    for(size_t index = 0U; index < sizeof(errors) / sizeof(errors[0]); index++)
+    {
+        struct fault_state state = {0, errors[index]};
+        int                failures_before;
+
+        failures_before = failures;
+        EXPECT(p101_error_has_no_error(err));
+        fault_resource_events = 0U;
+        errno                 = P101_TEST_ERRNO_SENTINEL;
+        p101_env_set_fault_injector(env, fail_next_call, &state);
+        size_t result = p101_parse_int64_t_array(env, err, NULL, 0, NULL, NULL);
+        (void)result;
+        EXPECT(state.checks == 1);
+        EXPECT(p101_error_is_errno(err, state.code));
+        EXPECT(errno == P101_TEST_ERRNO_SENTINEL);
+        EXPECT(result == (0));
+        EXPECT(fault_resource_events == 0U);
+        write_outcome("p101_parse_int64_t_array", "errno", error_names[index], state.code, failures == failures_before);
+        p101_error_reset(err);
+    }
+    p101_env_set_fault_injector(env, NULL, NULL);
+    {
+        int   native_status = 0;
+        pid_t native_pid    = fork();
+
+        EXPECT(native_pid >= 0);
+        if(native_pid == 0)
+        {
+            bool               native_passed = true;
+            struct p101_error *native_err    = NULL;
+            struct p101_env   *native_env    = NULL;
+            FILE              *native_stdin_result;
+
+            native_child_process = true;
+            failures             = 0;
+            (void)alarm(2U);
+            if(unsetenv("P101_CALL_LOG") != 0 || unsetenv("P101_RESOURCE_LOG") != 0)
+            {
+                fprintf(stderr, "native setup failed: cannot clear p101 logging environment\n");
+                native_child_status = 77;
+                goto native_child_done_;
+            }
+            native_stdin_result = freopen("/dev/null", "r", stdin);
+            if(native_stdin_result == NULL)
+            {
+                fprintf(stderr, "native setup failed: cannot make standard input deterministic\n");
+                native_child_status = 77;
+                goto native_child_done_;
+            }
+            native_err = p101_error_create(false);
+            if(native_err == NULL)
+            {
+                native_child_status = 77;
+                goto native_child_done_;
+            }
+            native_env = p101_env_create(native_err, NULL);
+            if(native_env == NULL)
+            {
+                native_child_status = 77;
+                goto native_child_done_;
+            }
+            const char *const native_argument_2[]  = {"1"};
+            int64_t           native_argument_4[1] = {0};
+            uint8_t           native_argument_5[1] = {0};
+            size_t            native_result        = p101_parse_int64_t_array(native_env, native_err, native_argument_2, 1, native_argument_4, native_argument_5);
+            (void)native_result;
+            if(p101_error_has_error(native_err))
+            {
+                bool native_error_declared = false;
+
+                for(size_t native_error_index = 0U; native_error_index < sizeof(errors) / sizeof(errors[0]); native_error_index++)
+                {
+                    if(p101_error_is_errno(native_err, errors[native_error_index]))
+                    {
+                        native_error_declared = true;
+                    }
+                }
+                if(!native_error_declared)
+                {
+                    fprintf(stderr, "native smoke produced an undeclared platform failure: p101_parse_int64_t_array: %s\n", p101_error_get_message(native_err));
+                    native_passed = false;
+                }
+                p101_error_reset(native_err);
+            }
+            native_child_status = native_passed ? EXIT_SUCCESS : EXIT_FAILURE;
+        native_child_done_:
+            p101_env_destroy(native_env);
+            p101_error_destroy(native_err);
+        }
+        if(native_pid > 0)
+        {
+            EXPECT(native_waitpid_nointr(native_pid, &native_status) == native_pid);
+            if(WIFSIGNALED(native_status))
+            {
+                fprintf(stderr, "native smoke terminated by signal: p101_parse_int64_t_array: %d\n", WTERMSIG(native_status));
+            }
+            EXPECT(WIFEXITED(native_status));
+            if(WIFEXITED(native_status) && WEXITSTATUS(native_status) == 77)
+            {
+                fprintf(stderr, "native smoke fixture unavailable: p101_parse_int64_t_array\n");
+            }
+            else if(WIFEXITED(native_status))
+            {
+                if(WEXITSTATUS(native_status) != EXIT_SUCCESS)
+                {
+                    fprintf(stderr, "native smoke exited unsuccessfully: p101_parse_int64_t_array: %d\n", WEXITSTATUS(native_status));
+                }
+                EXPECT(WEXITSTATUS(native_status) == EXIT_SUCCESS);
+            }
+        }
+        p101_error_reset(err);
+    }
+}
+
+/* P101_TEST_CASE(p101_parse_int64_t_base) */
+static void test_p101_parse_int64_t_base(struct p101_env *env, struct p101_error *err)
+{
+#ifdef __linux__
+    static const int         errors[]      = {EIO};
+    static const char *const error_names[] = {"EIO"};
+#elif defined(__APPLE__)
+    static const int         errors[]      = {EIO};
+    static const char *const error_names[] = {"EIO"};
+#elif defined(__FreeBSD__)
+    static const int         errors[]      = {EIO};
+    static const char *const error_names[] = {"EIO"};
+#else
+    static const int         errors[]      = {EIO};
+    static const char *const error_names[] = {"EIO"};
+#endif
+
+    for(size_t index = 0U; index < sizeof(errors) / sizeof(errors[0]); index++)
+    {
+        struct fault_state state = {0, errors[index]};
+        int                failures_before;
+
+        failures_before = failures;
+        EXPECT(p101_error_has_no_error(err));
+        fault_resource_events = 0U;
+        errno                 = P101_TEST_ERRNO_SENTINEL;
+        p101_env_set_fault_injector(env, fail_next_call, &state);
+        int64_t result = p101_parse_int64_t_base(env, err, NULL, 0, 0);
+        (void)result;
+        EXPECT(state.checks == 1);
+        EXPECT(p101_error_is_errno(err, state.code));
+        EXPECT(errno == P101_TEST_ERRNO_SENTINEL);
+        EXPECT(result == (0));
+        EXPECT(fault_resource_events == 0U);
+        write_outcome("p101_parse_int64_t_base", "errno", error_names[index], state.code, failures == failures_before);
+        p101_error_reset(err);
+    }
+    p101_env_set_fault_injector(env, NULL, NULL);
+    {
+        int   native_status = 0;
+        pid_t native_pid    = fork();
+
+        EXPECT(native_pid >= 0);
+        if(native_pid == 0)
+        {
+            bool               native_passed = true;
+            struct p101_error *native_err    = NULL;
+            struct p101_env   *native_env    = NULL;
+            FILE              *native_stdin_result;
+
+            native_child_process = true;
+            failures             = 0;
+            (void)alarm(2U);
+            if(unsetenv("P101_CALL_LOG") != 0 || unsetenv("P101_RESOURCE_LOG") != 0)
+            {
+                fprintf(stderr, "native setup failed: cannot clear p101 logging environment\n");
+                native_child_status = 77;
+                goto native_child_done_;
+            }
+            native_stdin_result = freopen("/dev/null", "r", stdin);
+            if(native_stdin_result == NULL)
+            {
+                fprintf(stderr, "native setup failed: cannot make standard input deterministic\n");
+                native_child_status = 77;
+                goto native_child_done_;
+            }
+            native_err = p101_error_create(false);
+            if(native_err == NULL)
+            {
+                native_child_status = 77;
+                goto native_child_done_;
+            }
+            native_env = p101_env_create(native_err, NULL);
+            if(native_env == NULL)
+            {
+                native_child_status = 77;
+                goto native_child_done_;
+            }
+            int64_t native_result = p101_parse_int64_t_base(native_env, native_err, "0x1", 0, 0);
+            (void)native_result;
+            if(p101_error_has_error(native_err))
+            {
+                bool native_error_declared = false;
+
+                for(size_t native_error_index = 0U; native_error_index < sizeof(errors) / sizeof(errors[0]); native_error_index++)
+                {
+                    if(p101_error_is_errno(native_err, errors[native_error_index]))
+                    {
+                        native_error_declared = true;
+                    }
+                }
+                if(!native_error_declared)
+                {
+                    fprintf(stderr, "native smoke produced an undeclared platform failure: p101_parse_int64_t_base: %s\n", p101_error_get_message(native_err));
+                    native_passed = false;
+                }
+                p101_error_reset(native_err);
+            }
+            native_child_status = native_passed ? EXIT_SUCCESS : EXIT_FAILURE;
+        native_child_done_:
+            p101_env_destroy(native_env);
+            p101_error_destroy(native_err);
+        }
+        if(native_pid > 0)
+        {
+            EXPECT(native_waitpid_nointr(native_pid, &native_status) == native_pid);
+            if(WIFSIGNALED(native_status))
+            {
+                fprintf(stderr, "native smoke terminated by signal: p101_parse_int64_t_base: %d\n", WTERMSIG(native_status));
+            }
+            EXPECT(WIFEXITED(native_status));
+            if(WIFEXITED(native_status) && WEXITSTATUS(native_status) == 77)
+            {
+                fprintf(stderr, "native smoke fixture unavailable: p101_parse_int64_t_base\n");
+            }
+            else if(WIFEXITED(native_status))
+            {
+                if(WEXITSTATUS(native_status) != EXIT_SUCCESS)
+                {
+                    fprintf(stderr, "native smoke exited unsuccessfully: p101_parse_int64_t_base: %d\n", WEXITSTATUS(native_status));
+                }
+                EXPECT(WEXITSTATUS(native_status) == EXIT_SUCCESS);
+            }
+        }
+        p101_error_reset(err);
+    }
+}
+
+/* P101_TEST_CASE(p101_parse_int64_t_list) */
+static void test_p101_parse_int64_t_list(struct p101_env *env, struct p101_error *err)
+{
+#ifdef __linux__
+    static const int         errors[]      = {EIO};
+    static const char *const error_names[] = {"EIO"};
+#elif defined(__APPLE__)
+    static const int         errors[]      = {EIO};
+    static const char *const error_names[] = {"EIO"};
+#elif defined(__FreeBSD__)
+    static const int         errors[]      = {EIO};
+    static const char *const error_names[] = {"EIO"};
+#else
+    static const int         errors[]      = {EIO};
+    static const char *const error_names[] = {"EIO"};
+#endif
+
+    for(size_t index = 0U; index < sizeof(errors) / sizeof(errors[0]); index++)
+    {
+        struct fault_state state = {0, errors[index]};
+        int                failures_before;
+
+        failures_before = failures;
+        EXPECT(p101_error_has_no_error(err));
+        fault_resource_events = 0U;
+        errno                 = P101_TEST_ERRNO_SENTINEL;
+        p101_env_set_fault_injector(env, fail_next_call, &state);
+        size_t result = p101_parse_int64_t_list(env, err, NULL, NULL, NULL, 0);
+        (void)result;
+        EXPECT(state.checks == 1);
+        EXPECT(p101_error_is_errno(err, state.code));
+        EXPECT(errno == P101_TEST_ERRNO_SENTINEL);
+        EXPECT(result == (0));
+        EXPECT(fault_resource_events == 0U);
+        write_outcome("p101_parse_int64_t_list", "errno", error_names[index], state.code, failures == failures_before);
+        p101_error_reset(err);
+    }
+    p101_env_set_fault_injector(env, NULL, NULL);
+    {
+        int   native_status = 0;
+        pid_t native_pid    = fork();
+
+        EXPECT(native_pid >= 0);
+        if(native_pid == 0)
+        {
+            bool               native_passed = true;
+            struct p101_error *native_err    = NULL;
+            struct p101_env   *native_env    = NULL;
+            FILE              *native_stdin_result;
+
+            native_child_process = true;
+            failures             = 0;
+            (void)alarm(2U);
+            if(unsetenv("P101_CALL_LOG") != 0 || unsetenv("P101_RESOURCE_LOG") != 0)
+            {
+                fprintf(stderr, "native setup failed: cannot clear p101 logging environment\n");
+                native_child_status = 77;
+                goto native_child_done_;
+            }
+            native_stdin_result = freopen("/dev/null", "r", stdin);
+            if(native_stdin_result == NULL)
+            {
+                fprintf(stderr, "native setup failed: cannot make standard input deterministic\n");
+                native_child_status = 77;
+                goto native_child_done_;
+            }
+            native_err = p101_error_create(false);
+            if(native_err == NULL)
+            {
+                native_child_status = 77;
+                goto native_child_done_;
+            }
+            native_env = p101_env_create(native_err, NULL);
+            if(native_env == NULL)
+            {
+                native_child_status = 77;
+                goto native_child_done_;
+            }
+            int64_t native_argument_4[1] = {0};
+            size_t  native_result        = p101_parse_int64_t_list(native_env, native_err, "1", ",", native_argument_4, 1);
+            (void)native_result;
+            if(p101_error_has_error(native_err))
+            {
+                bool native_error_declared = false;
+
+                for(size_t native_error_index = 0U; native_error_index < sizeof(errors) / sizeof(errors[0]); native_error_index++)
+                {
+                    if(p101_error_is_errno(native_err, errors[native_error_index]))
+                    {
+                        native_error_declared = true;
+                    }
+                }
+                if(!native_error_declared)
+                {
+                    fprintf(stderr, "native smoke produced an undeclared platform failure: p101_parse_int64_t_list: %s\n", p101_error_get_message(native_err));
+                    native_passed = false;
+                }
+                p101_error_reset(native_err);
+            }
+            native_child_status = native_passed ? EXIT_SUCCESS : EXIT_FAILURE;
+        native_child_done_:
+            p101_env_destroy(native_env);
+            p101_error_destroy(native_err);
+        }
+        if(native_pid > 0)
+        {
+            EXPECT(native_waitpid_nointr(native_pid, &native_status) == native_pid);
+            if(WIFSIGNALED(native_status))
+            {
+                fprintf(stderr, "native smoke terminated by signal: p101_parse_int64_t_list: %d\n", WTERMSIG(native_status));
+            }
+            EXPECT(WIFEXITED(native_status));
+            if(WIFEXITED(native_status) && WEXITSTATUS(native_status) == 77)
+            {
+                fprintf(stderr, "native smoke fixture unavailable: p101_parse_int64_t_list\n");
+            }
+            else if(WIFEXITED(native_status))
+            {
+                if(WEXITSTATUS(native_status) != EXIT_SUCCESS)
+                {
+                    fprintf(stderr, "native smoke exited unsuccessfully: p101_parse_int64_t_list: %d\n", WEXITSTATUS(native_status));
+                }
+                EXPECT(WEXITSTATUS(native_status) == EXIT_SUCCESS);
+            }
+        }
+        p101_error_reset(err);
+    }
+}
+
+/* P101_TEST_CASE(p101_parse_int64_t_n) */
+static void test_p101_parse_int64_t_n(struct p101_env *env, struct p101_error *err)
+{
+#ifdef __linux__
+    static const int         errors[]      = {EIO};
+    static const char *const error_names[] = {"EIO"};
+#elif defined(__APPLE__)
+    static const int         errors[]      = {EIO};
+    static const char *const error_names[] = {"EIO"};
+#elif defined(__FreeBSD__)
+    static const int         errors[]      = {EIO};
+    static const char *const error_names[] = {"EIO"};
+#else
+    static const int         errors[]      = {EIO};
+    static const char *const error_names[] = {"EIO"};
+#endif
+
+    for(size_t index = 0U; index < sizeof(errors) / sizeof(errors[0]); index++)
+    {
+        struct fault_state state = {0, errors[index]};
+        int                failures_before;
+
+        failures_before = failures;
+        EXPECT(p101_error_has_no_error(err));
+        fault_resource_events = 0U;
+        errno                 = P101_TEST_ERRNO_SENTINEL;
+        p101_env_set_fault_injector(env, fail_next_call, &state);
+        int64_t result = p101_parse_int64_t_n(env, err, NULL, 0, 0);
+        (void)result;
+        EXPECT(state.checks == 1);
+        EXPECT(p101_error_is_errno(err, state.code));
+        EXPECT(errno == P101_TEST_ERRNO_SENTINEL);
+        EXPECT(result == (0));
+        EXPECT(fault_resource_events == 0U);
+        write_outcome("p101_parse_int64_t_n", "errno", error_names[index], state.code, failures == failures_before);
+        p101_error_reset(err);
+    }
+    p101_env_set_fault_injector(env, NULL, NULL);
+    {
+        int   native_status = 0;
+        pid_t native_pid    = fork();
+
+        EXPECT(native_pid >= 0);
+        if(native_pid == 0)
+        {
+            bool               native_passed = true;
+            struct p101_error *native_err    = NULL;
+            struct p101_env   *native_env    = NULL;
+            FILE              *native_stdin_result;
+
+            native_child_process = true;
+            failures             = 0;
+            (void)alarm(2U);
+            if(unsetenv("P101_CALL_LOG") != 0 || unsetenv("P101_RESOURCE_LOG") != 0)
+            {
+                fprintf(stderr, "native setup failed: cannot clear p101 logging environment\n");
+                native_child_status = 77;
+                goto native_child_done_;
+            }
+            native_stdin_result = freopen("/dev/null", "r", stdin);
+            if(native_stdin_result == NULL)
+            {
+                fprintf(stderr, "native setup failed: cannot make standard input deterministic\n");
+                native_child_status = 77;
+                goto native_child_done_;
+            }
+            native_err = p101_error_create(false);
+            if(native_err == NULL)
+            {
+                native_child_status = 77;
+                goto native_child_done_;
+            }
+            native_env = p101_env_create(native_err, NULL);
+            if(native_env == NULL)
+            {
+                native_child_status = 77;
+                goto native_child_done_;
+            }
+            int64_t native_result = p101_parse_int64_t_n(native_env, native_err, "1", 1, 0);
+            (void)native_result;
+            if(p101_error_has_error(native_err))
+            {
+                bool native_error_declared = false;
+
+                for(size_t native_error_index = 0U; native_error_index < sizeof(errors) / sizeof(errors[0]); native_error_index++)
+                {
+                    if(p101_error_is_errno(native_err, errors[native_error_index]))
+                    {
+                        native_error_declared = true;
+                    }
+                }
+                if(!native_error_declared)
+                {
+                    fprintf(stderr, "native smoke produced an undeclared platform failure: p101_parse_int64_t_n: %s\n", p101_error_get_message(native_err));
+                    native_passed = false;
+                }
+                p101_error_reset(native_err);
+            }
+            native_child_status = native_passed ? EXIT_SUCCESS : EXIT_FAILURE;
+        native_child_done_:
+            p101_env_destroy(native_env);
+            p101_error_destroy(native_err);
+        }
+        if(native_pid > 0)
+        {
+            EXPECT(native_waitpid_nointr(native_pid, &native_status) == native_pid);
+            if(WIFSIGNALED(native_status))
+            {
+                fprintf(stderr, "native smoke terminated by signal: p101_parse_int64_t_n: %d\n", WTERMSIG(native_status));
+            }
+            EXPECT(WIFEXITED(native_status));
+            if(WIFEXITED(native_status) && WEXITSTATUS(native_status) == 77)
+            {
+                fprintf(stderr, "native smoke fixture unavailable: p101_parse_int64_t_n\n");
+            }
+            else if(WIFEXITED(native_status))
+            {
+                if(WEXITSTATUS(native_status) != EXIT_SUCCESS)
+                {
+                    fprintf(stderr, "native smoke exited unsuccessfully: p101_parse_int64_t_n: %d\n", WEXITSTATUS(native_status));
+                }
+                EXPECT(WEXITSTATUS(native_status) == EXIT_SUCCESS);
+            }
+        }
+        p101_error_reset(err);
+    }
+}
+
+/* P101_TEST_CASE(p101_parse_int64_t_prefix) */
+static void test_p101_parse_int64_t_prefix(struct p101_env *env, struct p101_error *err)
+{
+#ifdef __linux__
+    static const int         errors[]      = {EIO};
+    static const char *const error_names[] = {"EIO"};
+#elif defined(__APPLE__)
+    static const int         errors[]      = {EIO};
+    static const char *const error_names[] = {"EIO"};
+#elif defined(__FreeBSD__)
+    static const int         errors[]      = {EIO};
+    static const char *const error_names[] = {"EIO"};
+#else
+    static const int         errors[]      = {EIO};
+    static const char *const error_names[] = {"EIO"};
+#endif
+
+    for(size_t index = 0U; index < sizeof(errors) / sizeof(errors[0]); index++)
+    {
+        struct fault_state state = {0, errors[index]};
+        int                failures_before;
+
+        failures_before = failures;
+        EXPECT(p101_error_has_no_error(err));
+        fault_resource_events = 0U;
+        errno                 = P101_TEST_ERRNO_SENTINEL;
+        p101_env_set_fault_injector(env, fail_next_call, &state);
+        int64_t result = p101_parse_int64_t_prefix(env, err, NULL, NULL, 0);
+        (void)result;
+        EXPECT(state.checks == 1);
+        EXPECT(p101_error_is_errno(err, state.code));
+        EXPECT(errno == P101_TEST_ERRNO_SENTINEL);
+        EXPECT(result == (0));
+        EXPECT(fault_resource_events == 0U);
+        write_outcome("p101_parse_int64_t_prefix", "errno", error_names[index], state.code, failures == failures_before);
+        p101_error_reset(err);
+    }
+    p101_env_set_fault_injector(env, NULL, NULL);
+    {
+        int   native_status = 0;
+        pid_t native_pid    = fork();
+
+        EXPECT(native_pid >= 0);
+        if(native_pid == 0)
+        {
+            bool               native_passed = true;
+            struct p101_error *native_err    = NULL;
+            struct p101_env   *native_env    = NULL;
+            FILE              *native_stdin_result;
+
+            native_child_process = true;
+            failures             = 0;
+            (void)alarm(2U);
+            if(unsetenv("P101_CALL_LOG") != 0 || unsetenv("P101_RESOURCE_LOG") != 0)
+            {
+                fprintf(stderr, "native setup failed: cannot clear p101 logging environment\n");
+                native_child_status = 77;
+                goto native_child_done_;
+            }
+            native_stdin_result = freopen("/dev/null", "r", stdin);
+            if(native_stdin_result == NULL)
+            {
+                fprintf(stderr, "native setup failed: cannot make standard input deterministic\n");
+                native_child_status = 77;
+                goto native_child_done_;
+            }
+            native_err = p101_error_create(false);
+            if(native_err == NULL)
+            {
+                native_child_status = 77;
+                goto native_child_done_;
+            }
+            native_env = p101_env_create(native_err, NULL);
+            if(native_env == NULL)
+            {
+                native_child_status = 77;
+                goto native_child_done_;
+            }
+            const char *native_argument_3 = NULL;
+            int64_t     native_result     = p101_parse_int64_t_prefix(native_env, native_err, "1", &native_argument_3, 0);
+            (void)native_result;
+            if(p101_error_has_error(native_err))
+            {
+                bool native_error_declared = false;
+
+                for(size_t native_error_index = 0U; native_error_index < sizeof(errors) / sizeof(errors[0]); native_error_index++)
+                {
+                    if(p101_error_is_errno(native_err, errors[native_error_index]))
+                    {
+                        native_error_declared = true;
+                    }
+                }
+                if(!native_error_declared)
+                {
+                    fprintf(stderr, "native smoke produced an undeclared platform failure: p101_parse_int64_t_prefix: %s\n", p101_error_get_message(native_err));
+                    native_passed = false;
+                }
+                p101_error_reset(native_err);
+            }
+            native_child_status = native_passed ? EXIT_SUCCESS : EXIT_FAILURE;
+        native_child_done_:
+            p101_env_destroy(native_env);
+            p101_error_destroy(native_err);
+        }
+        if(native_pid > 0)
+        {
+            EXPECT(native_waitpid_nointr(native_pid, &native_status) == native_pid);
+            if(WIFSIGNALED(native_status))
+            {
+                fprintf(stderr, "native smoke terminated by signal: p101_parse_int64_t_prefix: %d\n", WTERMSIG(native_status));
+            }
+            EXPECT(WIFEXITED(native_status));
+            if(WIFEXITED(native_status) && WEXITSTATUS(native_status) == 77)
+            {
+                fprintf(stderr, "native smoke fixture unavailable: p101_parse_int64_t_prefix\n");
+            }
+            else if(WIFEXITED(native_status))
+            {
+                if(WEXITSTATUS(native_status) != EXIT_SUCCESS)
+                {
+                    fprintf(stderr, "native smoke exited unsuccessfully: p101_parse_int64_t_prefix: %d\n", WEXITSTATUS(native_status));
+                }
+                EXPECT(WEXITSTATUS(native_status) == EXIT_SUCCESS);
+            }
+        }
+        p101_error_reset(err);
+    }
+}
+
+/* P101_TEST_CASE(p101_parse_int8_t) */
+static void test_p101_parse_int8_t(struct p101_env *env, struct p101_error *err)
+{
+#ifdef __linux__
+    static const int         errors[]      = {EIO};
+    static const char *const error_names[] = {"EIO"};
+#elif defined(__APPLE__)
+    static const int         errors[]      = {EIO};
+    static const char *const error_names[] = {"EIO"};
+#elif defined(__FreeBSD__)
+    static const int         errors[]      = {EIO};
+    static const char *const error_names[] = {"EIO"};
+#else
+    static const int         errors[]      = {EIO};
+    static const char *const error_names[] = {"EIO"};
+#endif
+
+    for(size_t index = 0U; index < sizeof(errors) / sizeof(errors[0]); index++)
+    {
+        struct fault_state state = {0, errors[index]};
+        int                failures_before;
+
+        failures_before = failures;
+        EXPECT(p101_error_has_no_error(err));
+        fault_resource_events = 0U;
+        errno                 = P101_TEST_ERRNO_SENTINEL;
+        p101_env_set_fault_injector(env, fail_next_call, &state);
+        int8_t result = p101_parse_int8_t(env, err, NULL, 0);
+        (void)result;
+        EXPECT(state.checks == 1);
+        EXPECT(p101_error_is_errno(err, state.code));
+        EXPECT(errno == P101_TEST_ERRNO_SENTINEL);
+        EXPECT(result == (0));
+        EXPECT(fault_resource_events == 0U);
+        write_outcome("p101_parse_int8_t", "errno", error_names[index], state.code, failures == failures_before);
+        p101_error_reset(err);
+    }
+    p101_env_set_fault_injector(env, NULL, NULL);
+    {
+        int   native_status = 0;
+        pid_t native_pid    = fork();
+
+        EXPECT(native_pid >= 0);
+        if(native_pid == 0)
+        {
+            bool               native_passed = true;
+            struct p101_error *native_err    = NULL;
+            struct p101_env   *native_env    = NULL;
+            FILE              *native_stdin_result;
+
+            native_child_process = true;
+            failures             = 0;
+            (void)alarm(2U);
+            if(unsetenv("P101_CALL_LOG") != 0 || unsetenv("P101_RESOURCE_LOG") != 0)
+            {
+                fprintf(stderr, "native setup failed: cannot clear p101 logging environment\n");
+                native_child_status = 77;
+                goto native_child_done_;
+            }
+            native_stdin_result = freopen("/dev/null", "r", stdin);
+            if(native_stdin_result == NULL)
+            {
+                fprintf(stderr, "native setup failed: cannot make standard input deterministic\n");
+                native_child_status = 77;
+                goto native_child_done_;
+            }
+            native_err = p101_error_create(false);
+            if(native_err == NULL)
+            {
+                native_child_status = 77;
+                goto native_child_done_;
+            }
+            native_env = p101_env_create(native_err, NULL);
+            if(native_env == NULL)
+            {
+                native_child_status = 77;
+                goto native_child_done_;
+            }
+            int8_t native_result = p101_parse_int8_t(native_env, native_err, "1", 0);
+            (void)native_result;
+            if(p101_error_has_error(native_err))
+            {
+                bool native_error_declared = false;
+
+                for(size_t native_error_index = 0U; native_error_index < sizeof(errors) / sizeof(errors[0]); native_error_index++)
+                {
+                    if(p101_error_is_errno(native_err, errors[native_error_index]))
+                    {
+                        native_error_declared = true;
+                    }
+                }
+                if(!native_error_declared)
+                {
+                    fprintf(stderr, "native smoke produced an undeclared platform failure: p101_parse_int8_t: %s\n", p101_error_get_message(native_err));
+                    native_passed = false;
+                }
+                p101_error_reset(native_err);
+            }
+            native_child_status = native_passed ? EXIT_SUCCESS : EXIT_FAILURE;
+        native_child_done_:
+            p101_env_destroy(native_env);
+            p101_error_destroy(native_err);
+        }
+        if(native_pid > 0)
+        {
+            EXPECT(native_waitpid_nointr(native_pid, &native_status) == native_pid);
+            if(WIFSIGNALED(native_status))
+            {
+                fprintf(stderr, "native smoke terminated by signal: p101_parse_int8_t: %d\n", WTERMSIG(native_status));
+            }
+            EXPECT(WIFEXITED(native_status));
+            if(WIFEXITED(native_status) && WEXITSTATUS(native_status) == 77)
+            {
+                fprintf(stderr, "native smoke fixture unavailable: p101_parse_int8_t\n");
+            }
+            else if(WIFEXITED(native_status))
+            {
+                if(WEXITSTATUS(native_status) != EXIT_SUCCESS)
+                {
+                    fprintf(stderr, "native smoke exited unsuccessfully: p101_parse_int8_t: %d\n", WEXITSTATUS(native_status));
+                }
+                EXPECT(WEXITSTATUS(native_status) == EXIT_SUCCESS);
+            }
+        }
+        p101_error_reset(err);
+    }
+}
+
+/* P101_TEST_CASE(p101_parse_int8_t_array) */
+static void test_p101_parse_int8_t_array(struct p101_env *env, struct p101_error *err)
+{
+#ifdef __linux__
+    static const int         errors[]      = {EIO};
+    static const char *const error_names[] = {"EIO"};
+#elif defined(__APPLE__)
+    static const int         errors[]      = {EIO};
+    static const char *const error_names[] = {"EIO"};
+#elif defined(__FreeBSD__)
+    static const int         errors[]      = {EIO};
+    static const char *const error_names[] = {"EIO"};
+#else
+    static const int         errors[]      = {EIO};
+    static const char *const error_names[] = {"EIO"};
+#endif
+
+    for(size_t index = 0U; index < sizeof(errors) / sizeof(errors[0]); index++)
+    {
+        struct fault_state state = {0, errors[index]};
+        int                failures_before;
+
+        failures_before = failures;
+        EXPECT(p101_error_has_no_error(err));
+        fault_resource_events = 0U;
+        errno                 = P101_TEST_ERRNO_SENTINEL;
+        p101_env_set_fault_injector(env, fail_next_call, &state);
+        size_t result = p101_parse_int8_t_array(env, err, NULL, 0, NULL, NULL);
+        (void)result;
+        EXPECT(state.checks == 1);
+        EXPECT(p101_error_is_errno(err, state.code));
+        EXPECT(errno == P101_TEST_ERRNO_SENTINEL);
+        EXPECT(result == (0));
+        EXPECT(fault_resource_events == 0U);
+        write_outcome("p101_parse_int8_t_array", "errno", error_names[index], state.code, failures == failures_before);
+        p101_error_reset(err);
+    }
+    p101_env_set_fault_injector(env, NULL, NULL);
+    {
+        int   native_status = 0;
+        pid_t native_pid    = fork();
+
+        EXPECT(native_pid >= 0);
+        if(native_pid == 0)
+        {
+            bool               native_passed = true;
+            struct p101_error *native_err    = NULL;
+            struct p101_env   *native_env    = NULL;
+            FILE              *native_stdin_result;
+
+            native_child_process = true;
+            failures             = 0;
+            (void)alarm(2U);
+            if(unsetenv("P101_CALL_LOG") != 0 || unsetenv("P101_RESOURCE_LOG") != 0)
+            {
+                fprintf(stderr, "native setup failed: cannot clear p101 logging environment\n");
+                native_child_status = 77;
+                goto native_child_done_;
+            }
+            native_stdin_result = freopen("/dev/null", "r", stdin);
+            if(native_stdin_result == NULL)
+            {
+                fprintf(stderr, "native setup failed: cannot make standard input deterministic\n");
+                native_child_status = 77;
+                goto native_child_done_;
+            }
+            native_err = p101_error_create(false);
+            if(native_err == NULL)
+            {
+                native_child_status = 77;
+                goto native_child_done_;
+            }
+            native_env = p101_env_create(native_err, NULL);
+            if(native_env == NULL)
+            {
+                native_child_status = 77;
+                goto native_child_done_;
+            }
+            const char *const native_argument_2[]  = {"1"};
+            int8_t            native_argument_4[1] = {0};
+            uint8_t           native_argument_5[1] = {0};
+            size_t            native_result        = p101_parse_int8_t_array(native_env, native_err, native_argument_2, 1, native_argument_4, native_argument_5);
+            (void)native_result;
+            if(p101_error_has_error(native_err))
+            {
+                bool native_error_declared = false;
+
+                for(size_t native_error_index = 0U; native_error_index < sizeof(errors) / sizeof(errors[0]); native_error_index++)
+                {
+                    if(p101_error_is_errno(native_err, errors[native_error_index]))
+                    {
+                        native_error_declared = true;
+                    }
+                }
+                if(!native_error_declared)
+                {
+                    fprintf(stderr, "native smoke produced an undeclared platform failure: p101_parse_int8_t_array: %s\n", p101_error_get_message(native_err));
+                    native_passed = false;
+                }
+                p101_error_reset(native_err);
+            }
+            native_child_status = native_passed ? EXIT_SUCCESS : EXIT_FAILURE;
+        native_child_done_:
+            p101_env_destroy(native_env);
+            p101_error_destroy(native_err);
+        }
+        if(native_pid > 0)
+        {
+            EXPECT(native_waitpid_nointr(native_pid, &native_status) == native_pid);
+            if(WIFSIGNALED(native_status))
+            {
+                fprintf(stderr, "native smoke terminated by signal: p101_parse_int8_t_array: %d\n", WTERMSIG(native_status));
+            }
+            EXPECT(WIFEXITED(native_status));
+            if(WIFEXITED(native_status) && WEXITSTATUS(native_status) == 77)
+            {
+                fprintf(stderr, "native smoke fixture unavailable: p101_parse_int8_t_array\n");
+            }
+            else if(WIFEXITED(native_status))
+            {
+                if(WEXITSTATUS(native_status) != EXIT_SUCCESS)
+                {
+                    fprintf(stderr, "native smoke exited unsuccessfully: p101_parse_int8_t_array: %d\n", WEXITSTATUS(native_status));
+                }
+                EXPECT(WEXITSTATUS(native_status) == EXIT_SUCCESS);
+            }
+        }
+        p101_error_reset(err);
+    }
+}
+
+/* P101_TEST_CASE(p101_parse_int8_t_base) */
+static void test_p101_parse_int8_t_base(struct p101_env *env, struct p101_error *err)
+{
+#ifdef __linux__
+    static const int         errors[]      = {EIO};
+    static const char *const error_names[] = {"EIO"};
+#elif defined(__APPLE__)
+    static const int         errors[]      = {EIO};
+    static const char *const error_names[] = {"EIO"};
+#elif defined(__FreeBSD__)
+    static const int         errors[]      = {EIO};
+    static const char *const error_names[] = {"EIO"};
+#else
+    static const int         errors[]      = {EIO};
+    static const char *const error_names[] = {"EIO"};
+#endif
+
+    for(size_t index = 0U; index < sizeof(errors) / sizeof(errors[0]); index++)
+    {
+        struct fault_state state = {0, errors[index]};
+        int                failures_before;
+
+        failures_before = failures;
+        EXPECT(p101_error_has_no_error(err));
+        fault_resource_events = 0U;
+        errno                 = P101_TEST_ERRNO_SENTINEL;
+        p101_env_set_fault_injector(env, fail_next_call, &state);
+        int8_t result = p101_parse_int8_t_base(env, err, NULL, 0, 0);
+        (void)result;
+        EXPECT(state.checks == 1);
+        EXPECT(p101_error_is_errno(err, state.code));
+        EXPECT(errno == P101_TEST_ERRNO_SENTINEL);
+        EXPECT(result == (0));
+        EXPECT(fault_resource_events == 0U);
+        write_outcome("p101_parse_int8_t_base", "errno", error_names[index], state.code, failures == failures_before);
+        p101_error_reset(err);
+    }
+    p101_env_set_fault_injector(env, NULL, NULL);
+    {
+        int   native_status = 0;
+        pid_t native_pid    = fork();
+
+        EXPECT(native_pid >= 0);
+        if(native_pid == 0)
+        {
+            bool               native_passed = true;
+            struct p101_error *native_err    = NULL;
+            struct p101_env   *native_env    = NULL;
+            FILE              *native_stdin_result;
+
+            native_child_process = true;
+            failures             = 0;
+            (void)alarm(2U);
+            if(unsetenv("P101_CALL_LOG") != 0 || unsetenv("P101_RESOURCE_LOG") != 0)
+            {
+                fprintf(stderr, "native setup failed: cannot clear p101 logging environment\n");
+                native_child_status = 77;
+                goto native_child_done_;
+            }
+            native_stdin_result = freopen("/dev/null", "r", stdin);
+            if(native_stdin_result == NULL)
+            {
+                fprintf(stderr, "native setup failed: cannot make standard input deterministic\n");
+                native_child_status = 77;
+                goto native_child_done_;
+            }
+            native_err = p101_error_create(false);
+            if(native_err == NULL)
+            {
+                native_child_status = 77;
+                goto native_child_done_;
+            }
+            native_env = p101_env_create(native_err, NULL);
+            if(native_env == NULL)
+            {
+                native_child_status = 77;
+                goto native_child_done_;
+            }
+            int8_t native_result = p101_parse_int8_t_base(native_env, native_err, "0x1", 0, 0);
+            (void)native_result;
+            if(p101_error_has_error(native_err))
+            {
+                bool native_error_declared = false;
+
+                for(size_t native_error_index = 0U; native_error_index < sizeof(errors) / sizeof(errors[0]); native_error_index++)
+                {
+                    if(p101_error_is_errno(native_err, errors[native_error_index]))
+                    {
+                        native_error_declared = true;
+                    }
+                }
+                if(!native_error_declared)
+                {
+                    fprintf(stderr, "native smoke produced an undeclared platform failure: p101_parse_int8_t_base: %s\n", p101_error_get_message(native_err));
+                    native_passed = false;
+                }
+                p101_error_reset(native_err);
+            }
+            native_child_status = native_passed ? EXIT_SUCCESS : EXIT_FAILURE;
+        native_child_done_:
+            p101_env_destroy(native_env);
+            p101_error_destroy(native_err);
+        }
+        if(native_pid > 0)
+        {
+            EXPECT(native_waitpid_nointr(native_pid, &native_status) == native_pid);
+            if(WIFSIGNALED(native_status))
+            {
+                fprintf(stderr, "native smoke terminated by signal: p101_parse_int8_t_base: %d\n", WTERMSIG(native_status));
+            }
+            EXPECT(WIFEXITED(native_status));
+            if(WIFEXITED(native_status) && WEXITSTATUS(native_status) == 77)
+            {
+                fprintf(stderr, "native smoke fixture unavailable: p101_parse_int8_t_base\n");
+            }
+            else if(WIFEXITED(native_status))
+            {
+                if(WEXITSTATUS(native_status) != EXIT_SUCCESS)
+                {
+                    fprintf(stderr, "native smoke exited unsuccessfully: p101_parse_int8_t_base: %d\n", WEXITSTATUS(native_status));
+                }
+                EXPECT(WEXITSTATUS(native_status) == EXIT_SUCCESS);
+            }
+        }
+        p101_error_reset(err);
+    }
+}
+
+/* P101_TEST_CASE(p101_parse_int8_t_n) */
+static void test_p101_parse_int8_t_n(struct p101_env *env, struct p101_error *err)
+{
+#ifdef __linux__
+    static const int         errors[]      = {EIO};
+    static const char *const error_names[] = {"EIO"};
+#elif defined(__APPLE__)
+    static const int         errors[]      = {EIO};
+    static const char *const error_names[] = {"EIO"};
+#elif defined(__FreeBSD__)
+    static const int         errors[]      = {EIO};
+    static const char *const error_names[] = {"EIO"};
+#else
+    static const int         errors[]      = {EIO};
+    static const char *const error_names[] = {"EIO"};
+#endif
+
+    for(size_t index = 0U; index < sizeof(errors) / sizeof(errors[0]); index++)
+    {
+        struct fault_state state = {0, errors[index]};
+        int                failures_before;
+
+        failures_before = failures;
+        EXPECT(p101_error_has_no_error(err));
+        fault_resource_events = 0U;
+        errno                 = P101_TEST_ERRNO_SENTINEL;
+        p101_env_set_fault_injector(env, fail_next_call, &state);
+        int8_t result = p101_parse_int8_t_n(env, err, NULL, 0, 0);
+        (void)result;
+        EXPECT(state.checks == 1);
+        EXPECT(p101_error_is_errno(err, state.code));
+        EXPECT(errno == P101_TEST_ERRNO_SENTINEL);
+        EXPECT(result == (0));
+        EXPECT(fault_resource_events == 0U);
+        write_outcome("p101_parse_int8_t_n", "errno", error_names[index], state.code, failures == failures_before);
+        p101_error_reset(err);
+    }
+    p101_env_set_fault_injector(env, NULL, NULL);
+    {
+        int   native_status = 0;
+        pid_t native_pid    = fork();
+
+        EXPECT(native_pid >= 0);
+        if(native_pid == 0)
+        {
+            bool               native_passed = true;
+            struct p101_error *native_err    = NULL;
+            struct p101_env   *native_env    = NULL;
+            FILE              *native_stdin_result;
+
+            native_child_process = true;
+            failures             = 0;
+            (void)alarm(2U);
+            if(unsetenv("P101_CALL_LOG") != 0 || unsetenv("P101_RESOURCE_LOG") != 0)
+            {
+                fprintf(stderr, "native setup failed: cannot clear p101 logging environment\n");
+                native_child_status = 77;
+                goto native_child_done_;
+            }
+            native_stdin_result = freopen("/dev/null", "r", stdin);
+            if(native_stdin_result == NULL)
+            {
+                fprintf(stderr, "native setup failed: cannot make standard input deterministic\n");
+                native_child_status = 77;
+                goto native_child_done_;
+            }
+            native_err = p101_error_create(false);
+            if(native_err == NULL)
+            {
+                native_child_status = 77;
+                goto native_child_done_;
+            }
+            native_env = p101_env_create(native_err, NULL);
+            if(native_env == NULL)
+            {
+                native_child_status = 77;
+                goto native_child_done_;
+            }
+            int8_t native_result = p101_parse_int8_t_n(native_env, native_err, "1", 1, 0);
+            (void)native_result;
+            if(p101_error_has_error(native_err))
+            {
+                bool native_error_declared = false;
+
+                for(size_t native_error_index = 0U; native_error_index < sizeof(errors) / sizeof(errors[0]); native_error_index++)
+                {
+                    if(p101_error_is_errno(native_err, errors[native_error_index]))
+                    {
+                        native_error_declared = true;
+                    }
+                }
+                if(!native_error_declared)
+                {
+                    fprintf(stderr, "native smoke produced an undeclared platform failure: p101_parse_int8_t_n: %s\n", p101_error_get_message(native_err));
+                    native_passed = false;
+                }
+                p101_error_reset(native_err);
+            }
+            native_child_status = native_passed ? EXIT_SUCCESS : EXIT_FAILURE;
+        native_child_done_:
+            p101_env_destroy(native_env);
+            p101_error_destroy(native_err);
+        }
+        if(native_pid > 0)
+        {
+            EXPECT(native_waitpid_nointr(native_pid, &native_status) == native_pid);
+            if(WIFSIGNALED(native_status))
+            {
+                fprintf(stderr, "native smoke terminated by signal: p101_parse_int8_t_n: %d\n", WTERMSIG(native_status));
+            }
+            EXPECT(WIFEXITED(native_status));
+            if(WIFEXITED(native_status) && WEXITSTATUS(native_status) == 77)
+            {
+                fprintf(stderr, "native smoke fixture unavailable: p101_parse_int8_t_n\n");
+            }
+            else if(WIFEXITED(native_status))
+            {
+                if(WEXITSTATUS(native_status) != EXIT_SUCCESS)
+                {
+                    fprintf(stderr, "native smoke exited unsuccessfully: p101_parse_int8_t_n: %d\n", WEXITSTATUS(native_status));
+                }
+                EXPECT(WEXITSTATUS(native_status) == EXIT_SUCCESS);
+            }
+        }
+        p101_error_reset(err);
+    }
+}
+
+/* P101_TEST_CASE(p101_parse_int8_t_prefix) */
+static void test_p101_parse_int8_t_prefix(struct p101_env *env, struct p101_error *err)
+{
+#ifdef __linux__
+    static const int         errors[]      = {EIO};
+    static const char *const error_names[] = {"EIO"};
+#elif defined(__APPLE__)
+    static const int         errors[]      = {EIO};
+    static const char *const error_names[] = {"EIO"};
+#elif defined(__FreeBSD__)
+    static const int         errors[]      = {EIO};
+    static const char *const error_names[] = {"EIO"};
+#else
+    static const int         errors[]      = {EIO};
+    static const char *const error_names[] = {"EIO"};
+#endif
+
+    for(size_t index = 0U; index < sizeof(errors) / sizeof(errors[0]); index++)
+    {
+        struct fault_state state = {0, errors[index]};
+        int                failures_before;
+
+        failures_before = failures;
+        EXPECT(p101_error_has_no_error(err));
+        fault_resource_events = 0U;
+        errno                 = P101_TEST_ERRNO_SENTINEL;
+        p101_env_set_fault_injector(env, fail_next_call, &state);
+        int8_t result = p101_parse_int8_t_prefix(env, err, NULL, NULL, 0);
+        (void)result;
+        EXPECT(state.checks == 1);
+        EXPECT(p101_error_is_errno(err, state.code));
+        EXPECT(errno == P101_TEST_ERRNO_SENTINEL);
+        EXPECT(result == (0));
+        EXPECT(fault_resource_events == 0U);
+        write_outcome("p101_parse_int8_t_prefix", "errno", error_names[index], state.code, failures == failures_before);
+        p101_error_reset(err);
+    }
+    p101_env_set_fault_injector(env, NULL, NULL);
+    {
+        int   native_status = 0;
+        pid_t native_pid    = fork();
+
+        EXPECT(native_pid >= 0);
+        if(native_pid == 0)
+        {
+            bool               native_passed = true;
+            struct p101_error *native_err    = NULL;
+            struct p101_env   *native_env    = NULL;
+            FILE              *native_stdin_result;
+
+            native_child_process = true;
+            failures             = 0;
+            (void)alarm(2U);
+            if(unsetenv("P101_CALL_LOG") != 0 || unsetenv("P101_RESOURCE_LOG") != 0)
+            {
+                fprintf(stderr, "native setup failed: cannot clear p101 logging environment\n");
+                native_child_status = 77;
+                goto native_child_done_;
+            }
+            native_stdin_result = freopen("/dev/null", "r", stdin);
+            if(native_stdin_result == NULL)
+            {
+                fprintf(stderr, "native setup failed: cannot make standard input deterministic\n");
+                native_child_status = 77;
+                goto native_child_done_;
+            }
+            native_err = p101_error_create(false);
+            if(native_err == NULL)
+            {
+                native_child_status = 77;
+                goto native_child_done_;
+            }
+            native_env = p101_env_create(native_err, NULL);
+            if(native_env == NULL)
+            {
+                native_child_status = 77;
+                goto native_child_done_;
+            }
+            const char *native_argument_3 = NULL;
+            int8_t      native_result     = p101_parse_int8_t_prefix(native_env, native_err, "1", &native_argument_3, 0);
+            (void)native_result;
+            if(p101_error_has_error(native_err))
+            {
+                bool native_error_declared = false;
+
+                for(size_t native_error_index = 0U; native_error_index < sizeof(errors) / sizeof(errors[0]); native_error_index++)
+                {
+                    if(p101_error_is_errno(native_err, errors[native_error_index]))
+                    {
+                        native_error_declared = true;
+                    }
+                }
+                if(!native_error_declared)
+                {
+                    fprintf(stderr, "native smoke produced an undeclared platform failure: p101_parse_int8_t_prefix: %s\n", p101_error_get_message(native_err));
+                    native_passed = false;
+                }
+                p101_error_reset(native_err);
+            }
+            native_child_status = native_passed ? EXIT_SUCCESS : EXIT_FAILURE;
+        native_child_done_:
+            p101_env_destroy(native_env);
+            p101_error_destroy(native_err);
+        }
+        if(native_pid > 0)
+        {
+            EXPECT(native_waitpid_nointr(native_pid, &native_status) == native_pid);
+            if(WIFSIGNALED(native_status))
+            {
+                fprintf(stderr, "native smoke terminated by signal: p101_parse_int8_t_prefix: %d\n", WTERMSIG(native_status));
+            }
+            EXPECT(WIFEXITED(native_status));
+            if(WIFEXITED(native_status) && WEXITSTATUS(native_status) == 77)
+            {
+                fprintf(stderr, "native smoke fixture unavailable: p101_parse_int8_t_prefix\n");
+            }
+            else if(WIFEXITED(native_status))
+            {
+                if(WEXITSTATUS(native_status) != EXIT_SUCCESS)
+                {
+                    fprintf(stderr, "native smoke exited unsuccessfully: p101_parse_int8_t_prefix: %d\n", WEXITSTATUS(native_status));
+                }
+                EXPECT(WEXITSTATUS(native_status) == EXIT_SUCCESS);
+            }
+        }
+        p101_error_reset(err);
+    }
+}
+
+/* P101_TEST_CASE(p101_parse_int_n) */
+static void test_p101_parse_int_n(struct p101_env *env, struct p101_error *err)
+{
+#ifdef __linux__
+    static const int         errors[]      = {EIO};
+    static const char *const error_names[] = {"EIO"};
+#elif defined(__APPLE__)
+    static const int         errors[]      = {EIO};
+    static const char *const error_names[] = {"EIO"};
+#elif defined(__FreeBSD__)
+    static const int         errors[]      = {EIO};
+    static const char *const error_names[] = {"EIO"};
+#else
+    static const int         errors[]      = {EIO};
+    static const char *const error_names[] = {"EIO"};
+#endif
+
+    for(size_t index = 0U; index < sizeof(errors) / sizeof(errors[0]); index++)
+    {
+        struct fault_state state = {0, errors[index]};
+        int                failures_before;
+
+        failures_before = failures;
+        EXPECT(p101_error_has_no_error(err));
+        fault_resource_events = 0U;
+        errno                 = P101_TEST_ERRNO_SENTINEL;
+        p101_env_set_fault_injector(env, fail_next_call, &state);
+        int result = p101_parse_int_n(env, err, NULL, 0, 0);
+        (void)result;
+        EXPECT(state.checks == 1);
+        EXPECT(p101_error_is_errno(err, state.code));
+        EXPECT(errno == P101_TEST_ERRNO_SENTINEL);
+        EXPECT(result == (0));
+        EXPECT(fault_resource_events == 0U);
+        write_outcome("p101_parse_int_n", "errno", error_names[index], state.code, failures == failures_before);
+        p101_error_reset(err);
+    }
+    p101_env_set_fault_injector(env, NULL, NULL);
+    {
+        int   native_status = 0;
+        pid_t native_pid    = fork();
+
+        EXPECT(native_pid >= 0);
+        if(native_pid == 0)
+        {
+            bool               native_passed = true;
+            struct p101_error *native_err    = NULL;
+            struct p101_env   *native_env    = NULL;
+            FILE              *native_stdin_result;
+
+            native_child_process = true;
+            failures             = 0;
+            (void)alarm(2U);
+            if(unsetenv("P101_CALL_LOG") != 0 || unsetenv("P101_RESOURCE_LOG") != 0)
+            {
+                fprintf(stderr, "native setup failed: cannot clear p101 logging environment\n");
+                native_child_status = 77;
+                goto native_child_done_;
+            }
+            native_stdin_result = freopen("/dev/null", "r", stdin);
+            if(native_stdin_result == NULL)
+            {
+                fprintf(stderr, "native setup failed: cannot make standard input deterministic\n");
+                native_child_status = 77;
+                goto native_child_done_;
+            }
+            native_err = p101_error_create(false);
+            if(native_err == NULL)
+            {
+                native_child_status = 77;
+                goto native_child_done_;
+            }
+            native_env = p101_env_create(native_err, NULL);
+            if(native_env == NULL)
+            {
+                native_child_status = 77;
+                goto native_child_done_;
+            }
+            int native_result = p101_parse_int_n(native_env, native_err, "1", 1, 0);
+            (void)native_result;
+            if(p101_error_has_error(native_err))
+            {
+                bool native_error_declared = false;
+
+                for(size_t native_error_index = 0U; native_error_index < sizeof(errors) / sizeof(errors[0]); native_error_index++)
+                {
+                    if(p101_error_is_errno(native_err, errors[native_error_index]))
+                    {
+                        native_error_declared = true;
+                    }
+                }
+                if(!native_error_declared)
+                {
+                    fprintf(stderr, "native smoke produced an undeclared platform failure: p101_parse_int_n: %s\n", p101_error_get_message(native_err));
+                    native_passed = false;
+                }
+                p101_error_reset(native_err);
+            }
+            native_child_status = native_passed ? EXIT_SUCCESS : EXIT_FAILURE;
+        native_child_done_:
+            p101_env_destroy(native_env);
+            p101_error_destroy(native_err);
+        }
+        if(native_pid > 0)
+        {
+            EXPECT(native_waitpid_nointr(native_pid, &native_status) == native_pid);
+            if(WIFSIGNALED(native_status))
+            {
+                fprintf(stderr, "native smoke terminated by signal: p101_parse_int_n: %d\n", WTERMSIG(native_status));
+            }
+            EXPECT(WIFEXITED(native_status));
+            if(WIFEXITED(native_status) && WEXITSTATUS(native_status) == 77)
+            {
+                fprintf(stderr, "native smoke fixture unavailable: p101_parse_int_n\n");
+            }
+            else if(WIFEXITED(native_status))
+            {
+                if(WEXITSTATUS(native_status) != EXIT_SUCCESS)
+                {
+                    fprintf(stderr, "native smoke exited unsuccessfully: p101_parse_int_n: %d\n", WEXITSTATUS(native_status));
+                }
+                EXPECT(WEXITSTATUS(native_status) == EXIT_SUCCESS);
+            }
+        }
+        p101_error_reset(err);
+    }
+}
+
+/* P101_TEST_CASE(p101_parse_int_prefix) */
+static void test_p101_parse_int_prefix(struct p101_env *env, struct p101_error *err)
+{
+#ifdef __linux__
+    static const int         errors[]      = {EIO};
+    static const char *const error_names[] = {"EIO"};
+#elif defined(__APPLE__)
+    static const int         errors[]      = {EIO};
+    static const char *const error_names[] = {"EIO"};
+#elif defined(__FreeBSD__)
+    static const int         errors[]      = {EIO};
+    static const char *const error_names[] = {"EIO"};
+#else
+    static const int         errors[]      = {EIO};
+    static const char *const error_names[] = {"EIO"};
+#endif
+
+    for(size_t index = 0U; index < sizeof(errors) / sizeof(errors[0]); index++)
+    {
+        struct fault_state state = {0, errors[index]};
+        int                failures_before;
+
+        failures_before = failures;
+        EXPECT(p101_error_has_no_error(err));
+        fault_resource_events = 0U;
+        errno                 = P101_TEST_ERRNO_SENTINEL;
+        p101_env_set_fault_injector(env, fail_next_call, &state);
+        int result = p101_parse_int_prefix(env, err, NULL, NULL, 0);
+        (void)result;
+        EXPECT(state.checks == 1);
+        EXPECT(p101_error_is_errno(err, state.code));
+        EXPECT(errno == P101_TEST_ERRNO_SENTINEL);
+        EXPECT(result == (0));
+        EXPECT(fault_resource_events == 0U);
+        write_outcome("p101_parse_int_prefix", "errno", error_names[index], state.code, failures == failures_before);
+        p101_error_reset(err);
+    }
+    p101_env_set_fault_injector(env, NULL, NULL);
+    {
+        int   native_status = 0;
+        pid_t native_pid    = fork();
+
+        EXPECT(native_pid >= 0);
+        if(native_pid == 0)
+        {
+            bool               native_passed = true;
+            struct p101_error *native_err    = NULL;
+            struct p101_env   *native_env    = NULL;
+            FILE              *native_stdin_result;
+
+            native_child_process = true;
+            failures             = 0;
+            (void)alarm(2U);
+            if(unsetenv("P101_CALL_LOG") != 0 || unsetenv("P101_RESOURCE_LOG") != 0)
+            {
+                fprintf(stderr, "native setup failed: cannot clear p101 logging environment\n");
+                native_child_status = 77;
+                goto native_child_done_;
+            }
+            native_stdin_result = freopen("/dev/null", "r", stdin);
+            if(native_stdin_result == NULL)
+            {
+                fprintf(stderr, "native setup failed: cannot make standard input deterministic\n");
+                native_child_status = 77;
+                goto native_child_done_;
+            }
+            native_err = p101_error_create(false);
+            if(native_err == NULL)
+            {
+                native_child_status = 77;
+                goto native_child_done_;
+            }
+            native_env = p101_env_create(native_err, NULL);
+            if(native_env == NULL)
+            {
+                native_child_status = 77;
+                goto native_child_done_;
+            }
+            const char *native_argument_3 = NULL;
+            int         native_result     = p101_parse_int_prefix(native_env, native_err, "1", &native_argument_3, 0);
+            (void)native_result;
+            if(p101_error_has_error(native_err))
+            {
+                bool native_error_declared = false;
+
+                for(size_t native_error_index = 0U; native_error_index < sizeof(errors) / sizeof(errors[0]); native_error_index++)
+                {
+                    if(p101_error_is_errno(native_err, errors[native_error_index]))
+                    {
+                        native_error_declared = true;
+                    }
+                }
+                if(!native_error_declared)
+                {
+                    fprintf(stderr, "native smoke produced an undeclared platform failure: p101_parse_int_prefix: %s\n", p101_error_get_message(native_err));
+                    native_passed = false;
+                }
+                p101_error_reset(native_err);
+            }
+            native_child_status = native_passed ? EXIT_SUCCESS : EXIT_FAILURE;
+        native_child_done_:
+            p101_env_destroy(native_env);
+            p101_error_destroy(native_err);
+        }
+        if(native_pid > 0)
+        {
+            EXPECT(native_waitpid_nointr(native_pid, &native_status) == native_pid);
+            if(WIFSIGNALED(native_status))
+            {
+                fprintf(stderr, "native smoke terminated by signal: p101_parse_int_prefix: %d\n", WTERMSIG(native_status));
+            }
+            EXPECT(WIFEXITED(native_status));
+            if(WIFEXITED(native_status) && WEXITSTATUS(native_status) == 77)
+            {
+                fprintf(stderr, "native smoke fixture unavailable: p101_parse_int_prefix\n");
+            }
+            else if(WIFEXITED(native_status))
+            {
+                if(WEXITSTATUS(native_status) != EXIT_SUCCESS)
+                {
+                    fprintf(stderr, "native smoke exited unsuccessfully: p101_parse_int_prefix: %d\n", WEXITSTATUS(native_status));
+                }
+                EXPECT(WEXITSTATUS(native_status) == EXIT_SUCCESS);
+            }
+        }
+        p101_error_reset(err);
+    }
+}
+
+/* P101_TEST_CASE(p101_parse_long) */
+static void test_p101_parse_long(struct p101_env *env, struct p101_error *err)
+{
+#ifdef __linux__
+    static const int         errors[]      = {EIO};
+    static const char *const error_names[] = {"EIO"};
+#elif defined(__APPLE__)
+    static const int         errors[]      = {EIO};
+    static const char *const error_names[] = {"EIO"};
+#elif defined(__FreeBSD__)
+    static const int         errors[]      = {EIO};
+    static const char *const error_names[] = {"EIO"};
+#else
+    static const int         errors[]      = {EIO};
+    static const char *const error_names[] = {"EIO"};
+#endif
+
+    for(size_t index = 0U; index < sizeof(errors) / sizeof(errors[0]); index++)
+    {
+        struct fault_state state = {0, errors[index]};
+        int                failures_before;
+
+        failures_before = failures;
+        EXPECT(p101_error_has_no_error(err));
+        fault_resource_events = 0U;
+        errno                 = P101_TEST_ERRNO_SENTINEL;
+        p101_env_set_fault_injector(env, fail_next_call, &state);
+        long result = p101_parse_long(env, err, NULL, 0);
+        (void)result;
+        EXPECT(state.checks == 1);
+        EXPECT(p101_error_is_errno(err, state.code));
+        EXPECT(errno == P101_TEST_ERRNO_SENTINEL);
+        EXPECT(result == (0));
+        EXPECT(fault_resource_events == 0U);
+        write_outcome("p101_parse_long", "errno", error_names[index], state.code, failures == failures_before);
+        p101_error_reset(err);
+    }
+    p101_env_set_fault_injector(env, NULL, NULL);
+    {
+        int   native_status = 0;
+        pid_t native_pid    = fork();
+
+        EXPECT(native_pid >= 0);
+        if(native_pid == 0)
+        {
+            bool               native_passed = true;
+            struct p101_error *native_err    = NULL;
+            struct p101_env   *native_env    = NULL;
+            FILE              *native_stdin_result;
+
+            native_child_process = true;
+            failures             = 0;
+            (void)alarm(2U);
+            if(unsetenv("P101_CALL_LOG") != 0 || unsetenv("P101_RESOURCE_LOG") != 0)
+            {
+                fprintf(stderr, "native setup failed: cannot clear p101 logging environment\n");
+                native_child_status = 77;
+                goto native_child_done_;
+            }
+            native_stdin_result = freopen("/dev/null", "r", stdin);
+            if(native_stdin_result == NULL)
+            {
+                fprintf(stderr, "native setup failed: cannot make standard input deterministic\n");
+                native_child_status = 77;
+                goto native_child_done_;
+            }
+            native_err = p101_error_create(false);
+            if(native_err == NULL)
+            {
+                native_child_status = 77;
+                goto native_child_done_;
+            }
+            native_env = p101_env_create(native_err, NULL);
+            if(native_env == NULL)
+            {
+                native_child_status = 77;
+                goto native_child_done_;
+            }
+            long native_result = p101_parse_long(native_env, native_err, "1", 0);
+            (void)native_result;
+            if(p101_error_has_error(native_err))
+            {
+                bool native_error_declared = false;
+
+                for(size_t native_error_index = 0U; native_error_index < sizeof(errors) / sizeof(errors[0]); native_error_index++)
+                {
+                    if(p101_error_is_errno(native_err, errors[native_error_index]))
+                    {
+                        native_error_declared = true;
+                    }
+                }
+                if(!native_error_declared)
+                {
+                    fprintf(stderr, "native smoke produced an undeclared platform failure: p101_parse_long: %s\n", p101_error_get_message(native_err));
+                    native_passed = false;
+                }
+                p101_error_reset(native_err);
+            }
+            native_child_status = native_passed ? EXIT_SUCCESS : EXIT_FAILURE;
+        native_child_done_:
+            p101_env_destroy(native_env);
+            p101_error_destroy(native_err);
+        }
+        if(native_pid > 0)
+        {
+            EXPECT(native_waitpid_nointr(native_pid, &native_status) == native_pid);
+            if(WIFSIGNALED(native_status))
+            {
+                fprintf(stderr, "native smoke terminated by signal: p101_parse_long: %d\n", WTERMSIG(native_status));
+            }
+            EXPECT(WIFEXITED(native_status));
+            if(WIFEXITED(native_status) && WEXITSTATUS(native_status) == 77)
+            {
+                fprintf(stderr, "native smoke fixture unavailable: p101_parse_long\n");
+            }
+            else if(WIFEXITED(native_status))
+            {
+                if(WEXITSTATUS(native_status) != EXIT_SUCCESS)
+                {
+                    fprintf(stderr, "native smoke exited unsuccessfully: p101_parse_long: %d\n", WEXITSTATUS(native_status));
+                }
+                EXPECT(WEXITSTATUS(native_status) == EXIT_SUCCESS);
+            }
+        }
+        p101_error_reset(err);
+    }
+}
+
+/* P101_TEST_CASE(p101_parse_long_long) */
+static void test_p101_parse_long_long(struct p101_env *env, struct p101_error *err)
+{
+#ifdef __linux__
+    static const int         errors[]      = {EIO};
+    static const char *const error_names[] = {"EIO"};
+#elif defined(__APPLE__)
+    static const int         errors[]      = {EIO};
+    static const char *const error_names[] = {"EIO"};
+#elif defined(__FreeBSD__)
+    static const int         errors[]      = {EIO};
+    static const char *const error_names[] = {"EIO"};
+#else
+    static const int         errors[]      = {EIO};
+    static const char *const error_names[] = {"EIO"};
+#endif
+
+    for(size_t index = 0U; index < sizeof(errors) / sizeof(errors[0]); index++)
+    {
+        struct fault_state state = {0, errors[index]};
+        int                failures_before;
+
+        failures_before = failures;
+        EXPECT(p101_error_has_no_error(err));
+        fault_resource_events = 0U;
+        errno                 = P101_TEST_ERRNO_SENTINEL;
+        p101_env_set_fault_injector(env, fail_next_call, &state);
+        long long result = p101_parse_long_long(env, err, NULL, 0);
+        (void)result;
+        EXPECT(state.checks == 1);
+        EXPECT(p101_error_is_errno(err, state.code));
+        EXPECT(errno == P101_TEST_ERRNO_SENTINEL);
+        EXPECT(result == (0));
+        EXPECT(fault_resource_events == 0U);
+        write_outcome("p101_parse_long_long", "errno", error_names[index], state.code, failures == failures_before);
+        p101_error_reset(err);
+    }
+    p101_env_set_fault_injector(env, NULL, NULL);
+    {
+        int   native_status = 0;
+        pid_t native_pid    = fork();
+
+        EXPECT(native_pid >= 0);
+        if(native_pid == 0)
+        {
+            bool               native_passed = true;
+            struct p101_error *native_err    = NULL;
+            struct p101_env   *native_env    = NULL;
+            FILE              *native_stdin_result;
+
+            native_child_process = true;
+            failures             = 0;
+            (void)alarm(2U);
+            if(unsetenv("P101_CALL_LOG") != 0 || unsetenv("P101_RESOURCE_LOG") != 0)
+            {
+                fprintf(stderr, "native setup failed: cannot clear p101 logging environment\n");
+                native_child_status = 77;
+                goto native_child_done_;
+            }
+            native_stdin_result = freopen("/dev/null", "r", stdin);
+            if(native_stdin_result == NULL)
+            {
+                fprintf(stderr, "native setup failed: cannot make standard input deterministic\n");
+                native_child_status = 77;
+                goto native_child_done_;
+            }
+            native_err = p101_error_create(false);
+            if(native_err == NULL)
+            {
+                native_child_status = 77;
+                goto native_child_done_;
+            }
+            native_env = p101_env_create(native_err, NULL);
+            if(native_env == NULL)
+            {
+                native_child_status = 77;
+                goto native_child_done_;
+            }
+            long long native_result = p101_parse_long_long(native_env, native_err, "1", 0);
+            (void)native_result;
+            if(p101_error_has_error(native_err))
+            {
+                bool native_error_declared = false;
+
+                for(size_t native_error_index = 0U; native_error_index < sizeof(errors) / sizeof(errors[0]); native_error_index++)
+                {
+                    if(p101_error_is_errno(native_err, errors[native_error_index]))
+                    {
+                        native_error_declared = true;
+                    }
+                }
+                if(!native_error_declared)
+                {
+                    fprintf(stderr, "native smoke produced an undeclared platform failure: p101_parse_long_long: %s\n", p101_error_get_message(native_err));
+                    native_passed = false;
+                }
+                p101_error_reset(native_err);
+            }
+            native_child_status = native_passed ? EXIT_SUCCESS : EXIT_FAILURE;
+        native_child_done_:
+            p101_env_destroy(native_env);
+            p101_error_destroy(native_err);
+        }
+        if(native_pid > 0)
+        {
+            EXPECT(native_waitpid_nointr(native_pid, &native_status) == native_pid);
+            if(WIFSIGNALED(native_status))
+            {
+                fprintf(stderr, "native smoke terminated by signal: p101_parse_long_long: %d\n", WTERMSIG(native_status));
+            }
+            EXPECT(WIFEXITED(native_status));
+            if(WIFEXITED(native_status) && WEXITSTATUS(native_status) == 77)
+            {
+                fprintf(stderr, "native smoke fixture unavailable: p101_parse_long_long\n");
+            }
+            else if(WIFEXITED(native_status))
+            {
+                if(WEXITSTATUS(native_status) != EXIT_SUCCESS)
+                {
+                    fprintf(stderr, "native smoke exited unsuccessfully: p101_parse_long_long: %d\n", WEXITSTATUS(native_status));
+                }
+                EXPECT(WEXITSTATUS(native_status) == EXIT_SUCCESS);
+            }
+        }
+        p101_error_reset(err);
+    }
+}
+
+/* P101_TEST_CASE(p101_parse_long_long_n) */
+static void test_p101_parse_long_long_n(struct p101_env *env, struct p101_error *err)
+{
+#ifdef __linux__
+    static const int         errors[]      = {EIO};
+    static const char *const error_names[] = {"EIO"};
+#elif defined(__APPLE__)
+    static const int         errors[]      = {EIO};
+    static const char *const error_names[] = {"EIO"};
+#elif defined(__FreeBSD__)
+    static const int         errors[]      = {EIO};
+    static const char *const error_names[] = {"EIO"};
+#else
+    static const int         errors[]      = {EIO};
+    static const char *const error_names[] = {"EIO"};
+#endif
+
+    for(size_t index = 0U; index < sizeof(errors) / sizeof(errors[0]); index++)
+    {
+        struct fault_state state = {0, errors[index]};
+        int                failures_before;
+
+        failures_before = failures;
+        EXPECT(p101_error_has_no_error(err));
+        fault_resource_events = 0U;
+        errno                 = P101_TEST_ERRNO_SENTINEL;
+        p101_env_set_fault_injector(env, fail_next_call, &state);
+        long long result = p101_parse_long_long_n(env, err, NULL, 0, 0);
+        (void)result;
+        EXPECT(state.checks == 1);
+        EXPECT(p101_error_is_errno(err, state.code));
+        EXPECT(errno == P101_TEST_ERRNO_SENTINEL);
+        EXPECT(result == (0));
+        EXPECT(fault_resource_events == 0U);
+        write_outcome("p101_parse_long_long_n", "errno", error_names[index], state.code, failures == failures_before);
+        p101_error_reset(err);
+    }
+    p101_env_set_fault_injector(env, NULL, NULL);
+    {
+        int   native_status = 0;
+        pid_t native_pid    = fork();
+
+        EXPECT(native_pid >= 0);
+        if(native_pid == 0)
+        {
+            bool               native_passed = true;
+            struct p101_error *native_err    = NULL;
+            struct p101_env   *native_env    = NULL;
+            FILE              *native_stdin_result;
+
+            native_child_process = true;
+            failures             = 0;
+            (void)alarm(2U);
+            if(unsetenv("P101_CALL_LOG") != 0 || unsetenv("P101_RESOURCE_LOG") != 0)
+            {
+                fprintf(stderr, "native setup failed: cannot clear p101 logging environment\n");
+                native_child_status = 77;
+                goto native_child_done_;
+            }
+            native_stdin_result = freopen("/dev/null", "r", stdin);
+            if(native_stdin_result == NULL)
+            {
+                fprintf(stderr, "native setup failed: cannot make standard input deterministic\n");
+                native_child_status = 77;
+                goto native_child_done_;
+            }
+            native_err = p101_error_create(false);
+            if(native_err == NULL)
+            {
+                native_child_status = 77;
+                goto native_child_done_;
+            }
+            native_env = p101_env_create(native_err, NULL);
+            if(native_env == NULL)
+            {
+                native_child_status = 77;
+                goto native_child_done_;
+            }
+            long long native_result = p101_parse_long_long_n(native_env, native_err, "1", 1, 0);
+            (void)native_result;
+            if(p101_error_has_error(native_err))
+            {
+                bool native_error_declared = false;
+
+                for(size_t native_error_index = 0U; native_error_index < sizeof(errors) / sizeof(errors[0]); native_error_index++)
+                {
+                    if(p101_error_is_errno(native_err, errors[native_error_index]))
+                    {
+                        native_error_declared = true;
+                    }
+                }
+                if(!native_error_declared)
+                {
+                    fprintf(stderr, "native smoke produced an undeclared platform failure: p101_parse_long_long_n: %s\n", p101_error_get_message(native_err));
+                    native_passed = false;
+                }
+                p101_error_reset(native_err);
+            }
+            native_child_status = native_passed ? EXIT_SUCCESS : EXIT_FAILURE;
+        native_child_done_:
+            p101_env_destroy(native_env);
+            p101_error_destroy(native_err);
+        }
+        if(native_pid > 0)
+        {
+            EXPECT(native_waitpid_nointr(native_pid, &native_status) == native_pid);
+            if(WIFSIGNALED(native_status))
+            {
+                fprintf(stderr, "native smoke terminated by signal: p101_parse_long_long_n: %d\n", WTERMSIG(native_status));
+            }
+            EXPECT(WIFEXITED(native_status));
+            if(WIFEXITED(native_status) && WEXITSTATUS(native_status) == 77)
+            {
+                fprintf(stderr, "native smoke fixture unavailable: p101_parse_long_long_n\n");
+            }
+            else if(WIFEXITED(native_status))
+            {
+                if(WEXITSTATUS(native_status) != EXIT_SUCCESS)
+                {
+                    fprintf(stderr, "native smoke exited unsuccessfully: p101_parse_long_long_n: %d\n", WEXITSTATUS(native_status));
+                }
+                EXPECT(WEXITSTATUS(native_status) == EXIT_SUCCESS);
+            }
+        }
+        p101_error_reset(err);
+    }
+}
+
+/* P101_TEST_CASE(p101_parse_long_long_prefix) */
+static void test_p101_parse_long_long_prefix(struct p101_env *env, struct p101_error *err)
+{
+#ifdef __linux__
+    static const int         errors[]      = {EIO};
+    static const char *const error_names[] = {"EIO"};
+#elif defined(__APPLE__)
+    static const int         errors[]      = {EIO};
+    static const char *const error_names[] = {"EIO"};
+#elif defined(__FreeBSD__)
+    static const int         errors[]      = {EIO};
+    static const char *const error_names[] = {"EIO"};
+#else
+    static const int         errors[]      = {EIO};
+    static const char *const error_names[] = {"EIO"};
+#endif
+
+    for(size_t index = 0U; index < sizeof(errors) / sizeof(errors[0]); index++)
+    {
+        struct fault_state state = {0, errors[index]};
+        int                failures_before;
+
+        failures_before = failures;
+        EXPECT(p101_error_has_no_error(err));
+        fault_resource_events = 0U;
+        errno                 = P101_TEST_ERRNO_SENTINEL;
+        p101_env_set_fault_injector(env, fail_next_call, &state);
+        long long result = p101_parse_long_long_prefix(env, err, NULL, NULL, 0);
+        (void)result;
+        EXPECT(state.checks == 1);
+        EXPECT(p101_error_is_errno(err, state.code));
+        EXPECT(errno == P101_TEST_ERRNO_SENTINEL);
+        EXPECT(result == (0));
+        EXPECT(fault_resource_events == 0U);
+        write_outcome("p101_parse_long_long_prefix", "errno", error_names[index], state.code, failures == failures_before);
+        p101_error_reset(err);
+    }
+    p101_env_set_fault_injector(env, NULL, NULL);
+    {
+        int   native_status = 0;
+        pid_t native_pid    = fork();
+
+        EXPECT(native_pid >= 0);
+        if(native_pid == 0)
+        {
+            bool               native_passed = true;
+            struct p101_error *native_err    = NULL;
+            struct p101_env   *native_env    = NULL;
+            FILE              *native_stdin_result;
+
+            native_child_process = true;
+            failures             = 0;
+            (void)alarm(2U);
+            if(unsetenv("P101_CALL_LOG") != 0 || unsetenv("P101_RESOURCE_LOG") != 0)
+            {
+                fprintf(stderr, "native setup failed: cannot clear p101 logging environment\n");
+                native_child_status = 77;
+                goto native_child_done_;
+            }
+            native_stdin_result = freopen("/dev/null", "r", stdin);
+            if(native_stdin_result == NULL)
+            {
+                fprintf(stderr, "native setup failed: cannot make standard input deterministic\n");
+                native_child_status = 77;
+                goto native_child_done_;
+            }
+            native_err = p101_error_create(false);
+            if(native_err == NULL)
+            {
+                native_child_status = 77;
+                goto native_child_done_;
+            }
+            native_env = p101_env_create(native_err, NULL);
+            if(native_env == NULL)
+            {
+                native_child_status = 77;
+                goto native_child_done_;
+            }
+            const char *native_argument_3 = NULL;
+            long long   native_result     = p101_parse_long_long_prefix(native_env, native_err, "1", &native_argument_3, 0);
+            (void)native_result;
+            if(p101_error_has_error(native_err))
+            {
+                bool native_error_declared = false;
+
+                for(size_t native_error_index = 0U; native_error_index < sizeof(errors) / sizeof(errors[0]); native_error_index++)
+                {
+                    if(p101_error_is_errno(native_err, errors[native_error_index]))
+                    {
+                        native_error_declared = true;
+                    }
+                }
+                if(!native_error_declared)
+                {
+                    fprintf(stderr, "native smoke produced an undeclared platform failure: p101_parse_long_long_prefix: %s\n", p101_error_get_message(native_err));
+                    native_passed = false;
+                }
+                p101_error_reset(native_err);
+            }
+            native_child_status = native_passed ? EXIT_SUCCESS : EXIT_FAILURE;
+        native_child_done_:
+            p101_env_destroy(native_env);
+            p101_error_destroy(native_err);
+        }
+        if(native_pid > 0)
+        {
+            EXPECT(native_waitpid_nointr(native_pid, &native_status) == native_pid);
+            if(WIFSIGNALED(native_status))
+            {
+                fprintf(stderr, "native smoke terminated by signal: p101_parse_long_long_prefix: %d\n", WTERMSIG(native_status));
+            }
+            EXPECT(WIFEXITED(native_status));
+            if(WIFEXITED(native_status) && WEXITSTATUS(native_status) == 77)
+            {
+                fprintf(stderr, "native smoke fixture unavailable: p101_parse_long_long_prefix\n");
+            }
+            else if(WIFEXITED(native_status))
+            {
+                if(WEXITSTATUS(native_status) != EXIT_SUCCESS)
+                {
+                    fprintf(stderr, "native smoke exited unsuccessfully: p101_parse_long_long_prefix: %d\n", WEXITSTATUS(native_status));
+                }
+                EXPECT(WEXITSTATUS(native_status) == EXIT_SUCCESS);
+            }
+        }
+        p101_error_reset(err);
+    }
+}
+
+/* P101_TEST_CASE(p101_parse_long_n) */
+static void test_p101_parse_long_n(struct p101_env *env, struct p101_error *err)
+{
+#ifdef __linux__
+    static const int         errors[]      = {EIO};
+    static const char *const error_names[] = {"EIO"};
+#elif defined(__APPLE__)
+    static const int         errors[]      = {EIO};
+    static const char *const error_names[] = {"EIO"};
+#elif defined(__FreeBSD__)
+    static const int         errors[]      = {EIO};
+    static const char *const error_names[] = {"EIO"};
+#else
+    static const int         errors[]      = {EIO};
+    static const char *const error_names[] = {"EIO"};
+#endif
+
+    for(size_t index = 0U; index < sizeof(errors) / sizeof(errors[0]); index++)
+    {
+        struct fault_state state = {0, errors[index]};
+        int                failures_before;
+
+        failures_before = failures;
+        EXPECT(p101_error_has_no_error(err));
+        fault_resource_events = 0U;
+        errno                 = P101_TEST_ERRNO_SENTINEL;
+        p101_env_set_fault_injector(env, fail_next_call, &state);
+        long result = p101_parse_long_n(env, err, NULL, 0, 0);
+        (void)result;
+        EXPECT(state.checks == 1);
+        EXPECT(p101_error_is_errno(err, state.code));
+        EXPECT(errno == P101_TEST_ERRNO_SENTINEL);
+        EXPECT(result == (0));
+        EXPECT(fault_resource_events == 0U);
+        write_outcome("p101_parse_long_n", "errno", error_names[index], state.code, failures == failures_before);
+        p101_error_reset(err);
+    }
+    p101_env_set_fault_injector(env, NULL, NULL);
+    {
+        int   native_status = 0;
+        pid_t native_pid    = fork();
+
+        EXPECT(native_pid >= 0);
+        if(native_pid == 0)
+        {
+            bool               native_passed = true;
+            struct p101_error *native_err    = NULL;
+            struct p101_env   *native_env    = NULL;
+            FILE              *native_stdin_result;
+
+            native_child_process = true;
+            failures             = 0;
+            (void)alarm(2U);
+            if(unsetenv("P101_CALL_LOG") != 0 || unsetenv("P101_RESOURCE_LOG") != 0)
+            {
+                fprintf(stderr, "native setup failed: cannot clear p101 logging environment\n");
+                native_child_status = 77;
+                goto native_child_done_;
+            }
+            native_stdin_result = freopen("/dev/null", "r", stdin);
+            if(native_stdin_result == NULL)
+            {
+                fprintf(stderr, "native setup failed: cannot make standard input deterministic\n");
+                native_child_status = 77;
+                goto native_child_done_;
+            }
+            native_err = p101_error_create(false);
+            if(native_err == NULL)
+            {
+                native_child_status = 77;
+                goto native_child_done_;
+            }
+            native_env = p101_env_create(native_err, NULL);
+            if(native_env == NULL)
+            {
+                native_child_status = 77;
+                goto native_child_done_;
+            }
+            long native_result = p101_parse_long_n(native_env, native_err, "1", 1, 0);
+            (void)native_result;
+            if(p101_error_has_error(native_err))
+            {
+                bool native_error_declared = false;
+
+                for(size_t native_error_index = 0U; native_error_index < sizeof(errors) / sizeof(errors[0]); native_error_index++)
+                {
+                    if(p101_error_is_errno(native_err, errors[native_error_index]))
+                    {
+                        native_error_declared = true;
+                    }
+                }
+                if(!native_error_declared)
+                {
+                    fprintf(stderr, "native smoke produced an undeclared platform failure: p101_parse_long_n: %s\n", p101_error_get_message(native_err));
+                    native_passed = false;
+                }
+                p101_error_reset(native_err);
+            }
+            native_child_status = native_passed ? EXIT_SUCCESS : EXIT_FAILURE;
+        native_child_done_:
+            p101_env_destroy(native_env);
+            p101_error_destroy(native_err);
+        }
+        if(native_pid > 0)
+        {
+            EXPECT(native_waitpid_nointr(native_pid, &native_status) == native_pid);
+            if(WIFSIGNALED(native_status))
+            {
+                fprintf(stderr, "native smoke terminated by signal: p101_parse_long_n: %d\n", WTERMSIG(native_status));
+            }
+            EXPECT(WIFEXITED(native_status));
+            if(WIFEXITED(native_status) && WEXITSTATUS(native_status) == 77)
+            {
+                fprintf(stderr, "native smoke fixture unavailable: p101_parse_long_n\n");
+            }
+            else if(WIFEXITED(native_status))
+            {
+                if(WEXITSTATUS(native_status) != EXIT_SUCCESS)
+                {
+                    fprintf(stderr, "native smoke exited unsuccessfully: p101_parse_long_n: %d\n", WEXITSTATUS(native_status));
+                }
+                EXPECT(WEXITSTATUS(native_status) == EXIT_SUCCESS);
+            }
+        }
+        p101_error_reset(err);
+    }
+}
+
+/* P101_TEST_CASE(p101_parse_long_prefix) */
+static void test_p101_parse_long_prefix(struct p101_env *env, struct p101_error *err)
+{
+#ifdef __linux__
+    static const int         errors[]      = {EIO};
+    static const char *const error_names[] = {"EIO"};
+#elif defined(__APPLE__)
+    static const int         errors[]      = {EIO};
+    static const char *const error_names[] = {"EIO"};
+#elif defined(__FreeBSD__)
+    static const int         errors[]      = {EIO};
+    static const char *const error_names[] = {"EIO"};
+#else
+    static const int         errors[]      = {EIO};
+    static const char *const error_names[] = {"EIO"};
+#endif
+
+    for(size_t index = 0U; index < sizeof(errors) / sizeof(errors[0]); index++)
+    {
+        struct fault_state state = {0, errors[index]};
+        int                failures_before;
+
+        failures_before = failures;
+        EXPECT(p101_error_has_no_error(err));
+        fault_resource_events = 0U;
+        errno                 = P101_TEST_ERRNO_SENTINEL;
+        p101_env_set_fault_injector(env, fail_next_call, &state);
+        long result = p101_parse_long_prefix(env, err, NULL, NULL, 0);
+        (void)result;
+        EXPECT(state.checks == 1);
+        EXPECT(p101_error_is_errno(err, state.code));
+        EXPECT(errno == P101_TEST_ERRNO_SENTINEL);
+        EXPECT(result == (0));
+        EXPECT(fault_resource_events == 0U);
+        write_outcome("p101_parse_long_prefix", "errno", error_names[index], state.code, failures == failures_before);
+        p101_error_reset(err);
+    }
+    p101_env_set_fault_injector(env, NULL, NULL);
+    {
+        int   native_status = 0;
+        pid_t native_pid    = fork();
+
+        EXPECT(native_pid >= 0);
+        if(native_pid == 0)
+        {
+            bool               native_passed = true;
+            struct p101_error *native_err    = NULL;
+            struct p101_env   *native_env    = NULL;
+            FILE              *native_stdin_result;
+
+            native_child_process = true;
+            failures             = 0;
+            (void)alarm(2U);
+            if(unsetenv("P101_CALL_LOG") != 0 || unsetenv("P101_RESOURCE_LOG") != 0)
+            {
+                fprintf(stderr, "native setup failed: cannot clear p101 logging environment\n");
+                native_child_status = 77;
+                goto native_child_done_;
+            }
+            native_stdin_result = freopen("/dev/null", "r", stdin);
+            if(native_stdin_result == NULL)
+            {
+                fprintf(stderr, "native setup failed: cannot make standard input deterministic\n");
+                native_child_status = 77;
+                goto native_child_done_;
+            }
+            native_err = p101_error_create(false);
+            if(native_err == NULL)
+            {
+                native_child_status = 77;
+                goto native_child_done_;
+            }
+            native_env = p101_env_create(native_err, NULL);
+            if(native_env == NULL)
+            {
+                native_child_status = 77;
+                goto native_child_done_;
+            }
+            const char *native_argument_3 = NULL;
+            long        native_result     = p101_parse_long_prefix(native_env, native_err, "1", &native_argument_3, 0);
+            (void)native_result;
+            if(p101_error_has_error(native_err))
+            {
+                bool native_error_declared = false;
+
+                for(size_t native_error_index = 0U; native_error_index < sizeof(errors) / sizeof(errors[0]); native_error_index++)
+                {
+                    if(p101_error_is_errno(native_err, errors[native_error_index]))
+                    {
+                        native_error_declared = true;
+                    }
+                }
+                if(!native_error_declared)
+                {
+                    fprintf(stderr, "native smoke produced an undeclared platform failure: p101_parse_long_prefix: %s\n", p101_error_get_message(native_err));
+                    native_passed = false;
+                }
+                p101_error_reset(native_err);
+            }
+            native_child_status = native_passed ? EXIT_SUCCESS : EXIT_FAILURE;
+        native_child_done_:
+            p101_env_destroy(native_env);
+            p101_error_destroy(native_err);
+        }
+        if(native_pid > 0)
+        {
+            EXPECT(native_waitpid_nointr(native_pid, &native_status) == native_pid);
+            if(WIFSIGNALED(native_status))
+            {
+                fprintf(stderr, "native smoke terminated by signal: p101_parse_long_prefix: %d\n", WTERMSIG(native_status));
+            }
+            EXPECT(WIFEXITED(native_status));
+            if(WIFEXITED(native_status) && WEXITSTATUS(native_status) == 77)
+            {
+                fprintf(stderr, "native smoke fixture unavailable: p101_parse_long_prefix\n");
+            }
+            else if(WIFEXITED(native_status))
+            {
+                if(WEXITSTATUS(native_status) != EXIT_SUCCESS)
+                {
+                    fprintf(stderr, "native smoke exited unsuccessfully: p101_parse_long_prefix: %d\n", WEXITSTATUS(native_status));
+                }
+                EXPECT(WEXITSTATUS(native_status) == EXIT_SUCCESS);
+            }
+        }
+        p101_error_reset(err);
+    }
+}
+
+/* P101_TEST_CASE(p101_parse_negative_char) */
+static void test_p101_parse_negative_char(struct p101_env *env, struct p101_error *err)
+{
+#ifdef __linux__
+    static const int         errors[]      = {EIO};
+    static const char *const error_names[] = {"EIO"};
+#elif defined(__APPLE__)
+    static const int         errors[]      = {EIO};
+    static const char *const error_names[] = {"EIO"};
+#elif defined(__FreeBSD__)
+    static const int         errors[]      = {EIO};
+    static const char *const error_names[] = {"EIO"};
+#else
+    static const int         errors[]      = {EIO};
+    static const char *const error_names[] = {"EIO"};
+#endif
+
+    for(size_t index = 0U; index < sizeof(errors) / sizeof(errors[0]); index++)
+    {
+        struct fault_state state = {0, errors[index]};
+        int                failures_before;
+
+        failures_before = failures;
+        EXPECT(p101_error_has_no_error(err));
+        fault_resource_events = 0U;
+        errno                 = P101_TEST_ERRNO_SENTINEL;
+        p101_env_set_fault_injector(env, fail_next_call, &state);
+        signed char result = p101_parse_negative_char(env, err, NULL, 0);
+        (void)result;
+        EXPECT(state.checks == 1);
+        EXPECT(p101_error_is_errno(err, state.code));
+        EXPECT(errno == P101_TEST_ERRNO_SENTINEL);
+        EXPECT(result == (0));
+        EXPECT(fault_resource_events == 0U);
+        write_outcome("p101_parse_negative_char", "errno", error_names[index], state.code, failures == failures_before);
+        p101_error_reset(err);
+    }
+    p101_env_set_fault_injector(env, NULL, NULL);
+    {
+        int   native_status = 0;
+        pid_t native_pid    = fork();
+
+        EXPECT(native_pid >= 0);
+        if(native_pid == 0)
+        {
+            bool               native_passed = true;
+            struct p101_error *native_err    = NULL;
+            struct p101_env   *native_env    = NULL;
+            FILE              *native_stdin_result;
+
+            native_child_process = true;
+            failures             = 0;
+            (void)alarm(2U);
+            if(unsetenv("P101_CALL_LOG") != 0 || unsetenv("P101_RESOURCE_LOG") != 0)
+            {
+                fprintf(stderr, "native setup failed: cannot clear p101 logging environment\n");
+                native_child_status = 77;
+                goto native_child_done_;
+            }
+            native_stdin_result = freopen("/dev/null", "r", stdin);
+            if(native_stdin_result == NULL)
+            {
+                fprintf(stderr, "native setup failed: cannot make standard input deterministic\n");
+                native_child_status = 77;
+                goto native_child_done_;
+            }
+            native_err = p101_error_create(false);
+            if(native_err == NULL)
+            {
+                native_child_status = 77;
+                goto native_child_done_;
+            }
+            native_env = p101_env_create(native_err, NULL);
+            if(native_env == NULL)
+            {
+                native_child_status = 77;
+                goto native_child_done_;
+            }
+            signed char native_result = p101_parse_negative_char(native_env, native_err, "-1", 0);
+            (void)native_result;
+            if(p101_error_has_error(native_err))
+            {
+                bool native_error_declared = false;
+
+                for(size_t native_error_index = 0U; native_error_index < sizeof(errors) / sizeof(errors[0]); native_error_index++)
+                {
+                    if(p101_error_is_errno(native_err, errors[native_error_index]))
+                    {
+                        native_error_declared = true;
+                    }
+                }
+                if(!native_error_declared)
+                {
+                    fprintf(stderr, "native smoke produced an undeclared platform failure: p101_parse_negative_char: %s\n", p101_error_get_message(native_err));
+                    native_passed = false;
+                }
+                p101_error_reset(native_err);
+            }
+            native_child_status = native_passed ? EXIT_SUCCESS : EXIT_FAILURE;
+        native_child_done_:
+            p101_env_destroy(native_env);
+            p101_error_destroy(native_err);
+        }
+        if(native_pid > 0)
+        {
+            EXPECT(native_waitpid_nointr(native_pid, &native_status) == native_pid);
+            if(WIFSIGNALED(native_status))
+            {
+                fprintf(stderr, "native smoke terminated by signal: p101_parse_negative_char: %d\n", WTERMSIG(native_status));
+            }
+            EXPECT(WIFEXITED(native_status));
+            if(WIFEXITED(native_status) && WEXITSTATUS(native_status) == 77)
+            {
+                fprintf(stderr, "native smoke fixture unavailable: p101_parse_negative_char\n");
+            }
+            else if(WIFEXITED(native_status))
+            {
+                if(WEXITSTATUS(native_status) != EXIT_SUCCESS)
+                {
+                    fprintf(stderr, "native smoke exited unsuccessfully: p101_parse_negative_char: %d\n", WEXITSTATUS(native_status));
+                }
+                EXPECT(WEXITSTATUS(native_status) == EXIT_SUCCESS);
+            }
+        }
+        p101_error_reset(err);
+    }
+}
+
+/* P101_TEST_CASE(p101_parse_negative_char_n) */
+static void test_p101_parse_negative_char_n(struct p101_env *env, struct p101_error *err)
+{
+#ifdef __linux__
+    static const int         errors[]      = {EIO};
+    static const char *const error_names[] = {"EIO"};
+#elif defined(__APPLE__)
+    static const int         errors[]      = {EIO};
+    static const char *const error_names[] = {"EIO"};
+#elif defined(__FreeBSD__)
+    static const int         errors[]      = {EIO};
+    static const char *const error_names[] = {"EIO"};
+#else
+    static const int         errors[]      = {EIO};
+    static const char *const error_names[] = {"EIO"};
+#endif
+
+    for(size_t index = 0U; index < sizeof(errors) / sizeof(errors[0]); index++)
+    {
+        struct fault_state state = {0, errors[index]};
+        int                failures_before;
+
+        failures_before = failures;
+        EXPECT(p101_error_has_no_error(err));
+        fault_resource_events = 0U;
+        errno                 = P101_TEST_ERRNO_SENTINEL;
+        p101_env_set_fault_injector(env, fail_next_call, &state);
+        signed char result = p101_parse_negative_char_n(env, err, NULL, 0, 0);
+        (void)result;
+        EXPECT(state.checks == 1);
+        EXPECT(p101_error_is_errno(err, state.code));
+        EXPECT(errno == P101_TEST_ERRNO_SENTINEL);
+        EXPECT(result == (0));
+        EXPECT(fault_resource_events == 0U);
+        write_outcome("p101_parse_negative_char_n", "errno", error_names[index], state.code, failures == failures_before);
+        p101_error_reset(err);
+    }
+    p101_env_set_fault_injector(env, NULL, NULL);
+    {
+        int   native_status = 0;
+        pid_t native_pid    = fork();
+
+        EXPECT(native_pid >= 0);
+        if(native_pid == 0)
+        {
+            bool               native_passed = true;
+            struct p101_error *native_err    = NULL;
+            struct p101_env   *native_env    = NULL;
+            FILE              *native_stdin_result;
+
+            native_child_process = true;
+            failures             = 0;
+            (void)alarm(2U);
+            if(unsetenv("P101_CALL_LOG") != 0 || unsetenv("P101_RESOURCE_LOG") != 0)
+            {
+                fprintf(stderr, "native setup failed: cannot clear p101 logging environment\n");
+                native_child_status = 77;
+                goto native_child_done_;
+            }
+            native_stdin_result = freopen("/dev/null", "r", stdin);
+            if(native_stdin_result == NULL)
+            {
+                fprintf(stderr, "native setup failed: cannot make standard input deterministic\n");
+                native_child_status = 77;
+                goto native_child_done_;
+            }
+            native_err = p101_error_create(false);
+            if(native_err == NULL)
+            {
+                native_child_status = 77;
+                goto native_child_done_;
+            }
+            native_env = p101_env_create(native_err, NULL);
+            if(native_env == NULL)
+            {
+                native_child_status = 77;
+                goto native_child_done_;
+            }
+            signed char native_result = p101_parse_negative_char_n(native_env, native_err, "-1", 2, 0);
+            (void)native_result;
+            if(p101_error_has_error(native_err))
+            {
+                bool native_error_declared = false;
+
+                for(size_t native_error_index = 0U; native_error_index < sizeof(errors) / sizeof(errors[0]); native_error_index++)
+                {
+                    if(p101_error_is_errno(native_err, errors[native_error_index]))
+                    {
+                        native_error_declared = true;
+                    }
+                }
+                if(!native_error_declared)
+                {
+                    fprintf(stderr, "native smoke produced an undeclared platform failure: p101_parse_negative_char_n: %s\n", p101_error_get_message(native_err));
+                    native_passed = false;
+                }
+                p101_error_reset(native_err);
+            }
+            native_child_status = native_passed ? EXIT_SUCCESS : EXIT_FAILURE;
+        native_child_done_:
+            p101_env_destroy(native_env);
+            p101_error_destroy(native_err);
+        }
+        if(native_pid > 0)
+        {
+            EXPECT(native_waitpid_nointr(native_pid, &native_status) == native_pid);
+            if(WIFSIGNALED(native_status))
+            {
+                fprintf(stderr, "native smoke terminated by signal: p101_parse_negative_char_n: %d\n", WTERMSIG(native_status));
+            }
+            EXPECT(WIFEXITED(native_status));
+            if(WIFEXITED(native_status) && WEXITSTATUS(native_status) == 77)
+            {
+                fprintf(stderr, "native smoke fixture unavailable: p101_parse_negative_char_n\n");
+            }
+            else if(WIFEXITED(native_status))
+            {
+                if(WEXITSTATUS(native_status) != EXIT_SUCCESS)
+                {
+                    fprintf(stderr, "native smoke exited unsuccessfully: p101_parse_negative_char_n: %d\n", WEXITSTATUS(native_status));
+                }
+                EXPECT(WEXITSTATUS(native_status) == EXIT_SUCCESS);
+            }
+        }
+        p101_error_reset(err);
+    }
+}
+
+/* P101_TEST_CASE(p101_parse_negative_char_prefix) */
+static void test_p101_parse_negative_char_prefix(struct p101_env *env, struct p101_error *err)
+{
+#ifdef __linux__
+    static const int         errors[]      = {EIO};
+    static const char *const error_names[] = {"EIO"};
+#elif defined(__APPLE__)
+    static const int         errors[]      = {EIO};
+    static const char *const error_names[] = {"EIO"};
+#elif defined(__FreeBSD__)
+    static const int         errors[]      = {EIO};
+    static const char *const error_names[] = {"EIO"};
+#else
+    static const int         errors[]      = {EIO};
+    static const char *const error_names[] = {"EIO"};
+#endif
+
+    for(size_t index = 0U; index < sizeof(errors) / sizeof(errors[0]); index++)
+    {
+        struct fault_state state = {0, errors[index]};
+        int                failures_before;
+
+        failures_before = failures;
+        EXPECT(p101_error_has_no_error(err));
+        fault_resource_events = 0U;
+        errno                 = P101_TEST_ERRNO_SENTINEL;
+        p101_env_set_fault_injector(env, fail_next_call, &state);
+        signed char result = p101_parse_negative_char_prefix(env, err, NULL, NULL, 0);
+        (void)result;
+        EXPECT(state.checks == 1);
+        EXPECT(p101_error_is_errno(err, state.code));
+        EXPECT(errno == P101_TEST_ERRNO_SENTINEL);
+        EXPECT(result == (0));
+        EXPECT(fault_resource_events == 0U);
+        write_outcome("p101_parse_negative_char_prefix", "errno", error_names[index], state.code, failures == failures_before);
+        p101_error_reset(err);
+    }
+    p101_env_set_fault_injector(env, NULL, NULL);
+    {
+        int   native_status = 0;
+        pid_t native_pid    = fork();
+
+        EXPECT(native_pid >= 0);
+        if(native_pid == 0)
+        {
+            bool               native_passed = true;
+            struct p101_error *native_err    = NULL;
+            struct p101_env   *native_env    = NULL;
+            FILE              *native_stdin_result;
+
+            native_child_process = true;
+            failures             = 0;
+            (void)alarm(2U);
+            if(unsetenv("P101_CALL_LOG") != 0 || unsetenv("P101_RESOURCE_LOG") != 0)
+            {
+                fprintf(stderr, "native setup failed: cannot clear p101 logging environment\n");
+                native_child_status = 77;
+                goto native_child_done_;
+            }
+            native_stdin_result = freopen("/dev/null", "r", stdin);
+            if(native_stdin_result == NULL)
+            {
+                fprintf(stderr, "native setup failed: cannot make standard input deterministic\n");
+                native_child_status = 77;
+                goto native_child_done_;
+            }
+            native_err = p101_error_create(false);
+            if(native_err == NULL)
+            {
+                native_child_status = 77;
+                goto native_child_done_;
+            }
+            native_env = p101_env_create(native_err, NULL);
+            if(native_env == NULL)
+            {
+                native_child_status = 77;
+                goto native_child_done_;
+            }
+            const char *native_argument_3 = NULL;
+            signed char native_result     = p101_parse_negative_char_prefix(native_env, native_err, "-1", &native_argument_3, 0);
+            (void)native_result;
+            if(p101_error_has_error(native_err))
+            {
+                bool native_error_declared = false;
+
+                for(size_t native_error_index = 0U; native_error_index < sizeof(errors) / sizeof(errors[0]); native_error_index++)
+                {
+                    if(p101_error_is_errno(native_err, errors[native_error_index]))
+                    {
+                        native_error_declared = true;
+                    }
+                }
+                if(!native_error_declared)
+                {
+                    fprintf(stderr, "native smoke produced an undeclared platform failure: p101_parse_negative_char_prefix: %s\n", p101_error_get_message(native_err));
+                    native_passed = false;
+                }
+                p101_error_reset(native_err);
+            }
+            native_child_status = native_passed ? EXIT_SUCCESS : EXIT_FAILURE;
+        native_child_done_:
+            p101_env_destroy(native_env);
+            p101_error_destroy(native_err);
+        }
+        if(native_pid > 0)
+        {
+            EXPECT(native_waitpid_nointr(native_pid, &native_status) == native_pid);
+            if(WIFSIGNALED(native_status))
+            {
+                fprintf(stderr, "native smoke terminated by signal: p101_parse_negative_char_prefix: %d\n", WTERMSIG(native_status));
+            }
+            EXPECT(WIFEXITED(native_status));
+            if(WIFEXITED(native_status) && WEXITSTATUS(native_status) == 77)
+            {
+                fprintf(stderr, "native smoke fixture unavailable: p101_parse_negative_char_prefix\n");
+            }
+            else if(WIFEXITED(native_status))
+            {
+                if(WEXITSTATUS(native_status) != EXIT_SUCCESS)
+                {
+                    fprintf(stderr, "native smoke exited unsuccessfully: p101_parse_negative_char_prefix: %d\n", WEXITSTATUS(native_status));
+                }
+                EXPECT(WEXITSTATUS(native_status) == EXIT_SUCCESS);
+            }
+        }
+        p101_error_reset(err);
+    }
+}
+
+/* P101_TEST_CASE(p101_parse_negative_int) */
+static void test_p101_parse_negative_int(struct p101_env *env, struct p101_error *err)
+{
+#ifdef __linux__
+    static const int         errors[]      = {EIO};
+    static const char *const error_names[] = {"EIO"};
+#elif defined(__APPLE__)
+    static const int         errors[]      = {EIO};
+    static const char *const error_names[] = {"EIO"};
+#elif defined(__FreeBSD__)
+    static const int         errors[]      = {EIO};
+    static const char *const error_names[] = {"EIO"};
+#else
+    static const int         errors[]      = {EIO};
+    static const char *const error_names[] = {"EIO"};
+#endif
+
+    for(size_t index = 0U; index < sizeof(errors) / sizeof(errors[0]); index++)
+    {
+        struct fault_state state = {0, errors[index]};
+        int                failures_before;
+
+        failures_before = failures;
+        EXPECT(p101_error_has_no_error(err));
+        fault_resource_events = 0U;
+        errno                 = P101_TEST_ERRNO_SENTINEL;
+        p101_env_set_fault_injector(env, fail_next_call, &state);
+        int result = p101_parse_negative_int(env, err, NULL, 0);
+        (void)result;
+        EXPECT(state.checks == 1);
+        EXPECT(p101_error_is_errno(err, state.code));
+        EXPECT(errno == P101_TEST_ERRNO_SENTINEL);
+        EXPECT(result == (0));
+        EXPECT(fault_resource_events == 0U);
+        write_outcome("p101_parse_negative_int", "errno", error_names[index], state.code, failures == failures_before);
+        p101_error_reset(err);
+    }
+    p101_env_set_fault_injector(env, NULL, NULL);
+    {
+        int   native_status = 0;
+        pid_t native_pid    = fork();
+
+        EXPECT(native_pid >= 0);
+        if(native_pid == 0)
+        {
+            bool               native_passed = true;
+            struct p101_error *native_err    = NULL;
+            struct p101_env   *native_env    = NULL;
+            FILE              *native_stdin_result;
+
+            native_child_process = true;
+            failures             = 0;
+            (void)alarm(2U);
+            if(unsetenv("P101_CALL_LOG") != 0 || unsetenv("P101_RESOURCE_LOG") != 0)
+            {
+                fprintf(stderr, "native setup failed: cannot clear p101 logging environment\n");
+                native_child_status = 77;
+                goto native_child_done_;
+            }
+            native_stdin_result = freopen("/dev/null", "r", stdin);
+            if(native_stdin_result == NULL)
+            {
+                fprintf(stderr, "native setup failed: cannot make standard input deterministic\n");
+                native_child_status = 77;
+                goto native_child_done_;
+            }
+            native_err = p101_error_create(false);
+            if(native_err == NULL)
+            {
+                native_child_status = 77;
+                goto native_child_done_;
+            }
+            native_env = p101_env_create(native_err, NULL);
+            if(native_env == NULL)
+            {
+                native_child_status = 77;
+                goto native_child_done_;
+            }
+            int native_result = p101_parse_negative_int(native_env, native_err, "-1", 0);
+            (void)native_result;
+            if(p101_error_has_error(native_err))
+            {
+                bool native_error_declared = false;
+
+                for(size_t native_error_index = 0U; native_error_index < sizeof(errors) / sizeof(errors[0]); native_error_index++)
+                {
+                    if(p101_error_is_errno(native_err, errors[native_error_index]))
+                    {
+                        native_error_declared = true;
+                    }
+                }
+                if(!native_error_declared)
+                {
+                    fprintf(stderr, "native smoke produced an undeclared platform failure: p101_parse_negative_int: %s\n", p101_error_get_message(native_err));
+                    native_passed = false;
+                }
+                p101_error_reset(native_err);
+            }
+            native_child_status = native_passed ? EXIT_SUCCESS : EXIT_FAILURE;
+        native_child_done_:
+            p101_env_destroy(native_env);
+            p101_error_destroy(native_err);
+        }
+        if(native_pid > 0)
+        {
+            EXPECT(native_waitpid_nointr(native_pid, &native_status) == native_pid);
+            if(WIFSIGNALED(native_status))
+            {
+                fprintf(stderr, "native smoke terminated by signal: p101_parse_negative_int: %d\n", WTERMSIG(native_status));
+            }
+            EXPECT(WIFEXITED(native_status));
+            if(WIFEXITED(native_status) && WEXITSTATUS(native_status) == 77)
+            {
+                fprintf(stderr, "native smoke fixture unavailable: p101_parse_negative_int\n");
+            }
+            else if(WIFEXITED(native_status))
+            {
+                if(WEXITSTATUS(native_status) != EXIT_SUCCESS)
+                {
+                    fprintf(stderr, "native smoke exited unsuccessfully: p101_parse_negative_int: %d\n", WEXITSTATUS(native_status));
+                }
+                EXPECT(WEXITSTATUS(native_status) == EXIT_SUCCESS);
+            }
+        }
+        p101_error_reset(err);
+    }
+}
+
+/* P101_TEST_CASE(p101_parse_negative_int16_t) */
+static void test_p101_parse_negative_int16_t(struct p101_env *env, struct p101_error *err)
+{
+#ifdef __linux__
+    static const int         errors[]      = {EIO};
+    static const char *const error_names[] = {"EIO"};
+#elif defined(__APPLE__)
+    static const int         errors[]      = {EIO};
+    static const char *const error_names[] = {"EIO"};
+#elif defined(__FreeBSD__)
+    static const int         errors[]      = {EIO};
+    static const char *const error_names[] = {"EIO"};
+#else
+    static const int         errors[]      = {EIO};
+    static const char *const error_names[] = {"EIO"};
+#endif
+
+    for(size_t index = 0U; index < sizeof(errors) / sizeof(errors[0]); index++)
+    {
+        struct fault_state state = {0, errors[index]};
+        int                failures_before;
+
+        failures_before = failures;
+        EXPECT(p101_error_has_no_error(err));
+        fault_resource_events = 0U;
+        errno                 = P101_TEST_ERRNO_SENTINEL;
+        p101_env_set_fault_injector(env, fail_next_call, &state);
+        int16_t result = p101_parse_negative_int16_t(env, err, NULL, 0);
+        (void)result;
+        EXPECT(state.checks == 1);
+        EXPECT(p101_error_is_errno(err, state.code));
+        EXPECT(errno == P101_TEST_ERRNO_SENTINEL);
+        EXPECT(result == (0));
+        EXPECT(fault_resource_events == 0U);
+        write_outcome("p101_parse_negative_int16_t", "errno", error_names[index], state.code, failures == failures_before);
+        p101_error_reset(err);
+    }
+    p101_env_set_fault_injector(env, NULL, NULL);
+    {
+        int   native_status = 0;
+        pid_t native_pid    = fork();
+
+        EXPECT(native_pid >= 0);
+        if(native_pid == 0)
+        {
+            bool               native_passed = true;
+            struct p101_error *native_err    = NULL;
+            struct p101_env   *native_env    = NULL;
+            FILE              *native_stdin_result;
+
+            native_child_process = true;
+            failures             = 0;
+            (void)alarm(2U);
+            if(unsetenv("P101_CALL_LOG") != 0 || unsetenv("P101_RESOURCE_LOG") != 0)
+            {
+                fprintf(stderr, "native setup failed: cannot clear p101 logging environment\n");
+                native_child_status = 77;
+                goto native_child_done_;
+            }
+            native_stdin_result = freopen("/dev/null", "r", stdin);
+            if(native_stdin_result == NULL)
+            {
+                fprintf(stderr, "native setup failed: cannot make standard input deterministic\n");
+                native_child_status = 77;
+                goto native_child_done_;
+            }
+            native_err = p101_error_create(false);
+            if(native_err == NULL)
+            {
+                native_child_status = 77;
+                goto native_child_done_;
+            }
+            native_env = p101_env_create(native_err, NULL);
+            if(native_env == NULL)
+            {
+                native_child_status = 77;
+                goto native_child_done_;
+            }
+            int16_t native_result = p101_parse_negative_int16_t(native_env, native_err, "-1", 0);
+            (void)native_result;
+            if(p101_error_has_error(native_err))
+            {
+                bool native_error_declared = false;
+
+                for(size_t native_error_index = 0U; native_error_index < sizeof(errors) / sizeof(errors[0]); native_error_index++)
+                {
+                    if(p101_error_is_errno(native_err, errors[native_error_index]))
+                    {
+                        native_error_declared = true;
+                    }
+                }
+                if(!native_error_declared)
+                {
+                    fprintf(stderr, "native smoke produced an undeclared platform failure: p101_parse_negative_int16_t: %s\n", p101_error_get_message(native_err));
+                    native_passed = false;
+                }
+                p101_error_reset(native_err);
+            }
+            native_child_status = native_passed ? EXIT_SUCCESS : EXIT_FAILURE;
+        native_child_done_:
+            p101_env_destroy(native_env);
+            p101_error_destroy(native_err);
+        }
+        if(native_pid > 0)
+        {
+            EXPECT(native_waitpid_nointr(native_pid, &native_status) == native_pid);
+            if(WIFSIGNALED(native_status))
+            {
+                fprintf(stderr, "native smoke terminated by signal: p101_parse_negative_int16_t: %d\n", WTERMSIG(native_status));
+            }
+            EXPECT(WIFEXITED(native_status));
+            if(WIFEXITED(native_status) && WEXITSTATUS(native_status) == 77)
+            {
+                fprintf(stderr, "native smoke fixture unavailable: p101_parse_negative_int16_t\n");
+            }
+            else if(WIFEXITED(native_status))
+            {
+                if(WEXITSTATUS(native_status) != EXIT_SUCCESS)
+                {
+                    fprintf(stderr, "native smoke exited unsuccessfully: p101_parse_negative_int16_t: %d\n", WEXITSTATUS(native_status));
+                }
+                EXPECT(WEXITSTATUS(native_status) == EXIT_SUCCESS);
+            }
+        }
+        p101_error_reset(err);
+    }
+}
+
+/* P101_TEST_CASE(p101_parse_negative_int16_t_n) */
+static void test_p101_parse_negative_int16_t_n(struct p101_env *env, struct p101_error *err)
+{
+#ifdef __linux__
+    static const int         errors[]      = {EIO};
+    static const char *const error_names[] = {"EIO"};
+#elif defined(__APPLE__)
+    static const int         errors[]      = {EIO};
+    static const char *const error_names[] = {"EIO"};
+#elif defined(__FreeBSD__)
+    static const int         errors[]      = {EIO};
+    static const char *const error_names[] = {"EIO"};
+#else
+    static const int         errors[]      = {EIO};
+    static const char *const error_names[] = {"EIO"};
+#endif
+
+    for(size_t index = 0U; index < sizeof(errors) / sizeof(errors[0]); index++)
+    {
+        struct fault_state state = {0, errors[index]};
+        int                failures_before;
+
+        failures_before = failures;
+        EXPECT(p101_error_has_no_error(err));
+        fault_resource_events = 0U;
+        errno                 = P101_TEST_ERRNO_SENTINEL;
+        p101_env_set_fault_injector(env, fail_next_call, &state);
+        int16_t result = p101_parse_negative_int16_t_n(env, err, NULL, 0, 0);
+        (void)result;
+        EXPECT(state.checks == 1);
+        EXPECT(p101_error_is_errno(err, state.code));
+        EXPECT(errno == P101_TEST_ERRNO_SENTINEL);
+        EXPECT(result == (0));
+        EXPECT(fault_resource_events == 0U);
+        write_outcome("p101_parse_negative_int16_t_n", "errno", error_names[index], state.code, failures == failures_before);
+        p101_error_reset(err);
+    }
+    p101_env_set_fault_injector(env, NULL, NULL);
+    {
+        int   native_status = 0;
+        pid_t native_pid    = fork();
+
+        EXPECT(native_pid >= 0);
+        if(native_pid == 0)
+        {
+            bool               native_passed = true;
+            struct p101_error *native_err    = NULL;
+            struct p101_env   *native_env    = NULL;
+            FILE              *native_stdin_result;
+
+            native_child_process = true;
+            failures             = 0;
+            (void)alarm(2U);
+            if(unsetenv("P101_CALL_LOG") != 0 || unsetenv("P101_RESOURCE_LOG") != 0)
+            {
+                fprintf(stderr, "native setup failed: cannot clear p101 logging environment\n");
+                native_child_status = 77;
+                goto native_child_done_;
+            }
+            native_stdin_result = freopen("/dev/null", "r", stdin);
+            if(native_stdin_result == NULL)
+            {
+                fprintf(stderr, "native setup failed: cannot make standard input deterministic\n");
+                native_child_status = 77;
+                goto native_child_done_;
+            }
+            native_err = p101_error_create(false);
+            if(native_err == NULL)
+            {
+                native_child_status = 77;
+                goto native_child_done_;
+            }
+            native_env = p101_env_create(native_err, NULL);
+            if(native_env == NULL)
+            {
+                native_child_status = 77;
+                goto native_child_done_;
+            }
+            int16_t native_result = p101_parse_negative_int16_t_n(native_env, native_err, "-1", 2, 0);
+            (void)native_result;
+            if(p101_error_has_error(native_err))
+            {
+                bool native_error_declared = false;
+
+                for(size_t native_error_index = 0U; native_error_index < sizeof(errors) / sizeof(errors[0]); native_error_index++)
+                {
+                    if(p101_error_is_errno(native_err, errors[native_error_index]))
+                    {
+                        native_error_declared = true;
+                    }
+                }
+                if(!native_error_declared)
+                {
+                    fprintf(stderr, "native smoke produced an undeclared platform failure: p101_parse_negative_int16_t_n: %s\n", p101_error_get_message(native_err));
+                    native_passed = false;
+                }
+                p101_error_reset(native_err);
+            }
+            native_child_status = native_passed ? EXIT_SUCCESS : EXIT_FAILURE;
+        native_child_done_:
+            p101_env_destroy(native_env);
+            p101_error_destroy(native_err);
+        }
+        if(native_pid > 0)
+        {
+            EXPECT(native_waitpid_nointr(native_pid, &native_status) == native_pid);
+            if(WIFSIGNALED(native_status))
+            {
+                fprintf(stderr, "native smoke terminated by signal: p101_parse_negative_int16_t_n: %d\n", WTERMSIG(native_status));
+            }
+            EXPECT(WIFEXITED(native_status));
+            if(WIFEXITED(native_status) && WEXITSTATUS(native_status) == 77)
+            {
+                fprintf(stderr, "native smoke fixture unavailable: p101_parse_negative_int16_t_n\n");
+            }
+            else if(WIFEXITED(native_status))
+            {
+                if(WEXITSTATUS(native_status) != EXIT_SUCCESS)
+                {
+                    fprintf(stderr, "native smoke exited unsuccessfully: p101_parse_negative_int16_t_n: %d\n", WEXITSTATUS(native_status));
+                }
+                EXPECT(WEXITSTATUS(native_status) == EXIT_SUCCESS);
+            }
+        }
+        p101_error_reset(err);
+    }
+}
+
+/* P101_TEST_CASE(p101_parse_negative_int16_t_prefix) */
+static void test_p101_parse_negative_int16_t_prefix(struct p101_env *env, struct p101_error *err)
+{
+#ifdef __linux__
+    static const int         errors[]      = {EIO};
+    static const char *const error_names[] = {"EIO"};
+#elif defined(__APPLE__)
+    static const int         errors[]      = {EIO};
+    static const char *const error_names[] = {"EIO"};
+#elif defined(__FreeBSD__)
+    static const int         errors[]      = {EIO};
+    static const char *const error_names[] = {"EIO"};
+#else
+    static const int         errors[]      = {EIO};
+    static const char *const error_names[] = {"EIO"};
+#endif
+
+    for(size_t index = 0U; index < sizeof(errors) / sizeof(errors[0]); index++)
+    {
+        struct fault_state state = {0, errors[index]};
+        int                failures_before;
+
+        failures_before = failures;
+        EXPECT(p101_error_has_no_error(err));
+        fault_resource_events = 0U;
+        errno                 = P101_TEST_ERRNO_SENTINEL;
+        p101_env_set_fault_injector(env, fail_next_call, &state);
+        int16_t result = p101_parse_negative_int16_t_prefix(env, err, NULL, NULL, 0);
+        (void)result;
+        EXPECT(state.checks == 1);
+        EXPECT(p101_error_is_errno(err, state.code));
+        EXPECT(errno == P101_TEST_ERRNO_SENTINEL);
+        EXPECT(result == (0));
+        EXPECT(fault_resource_events == 0U);
+        write_outcome("p101_parse_negative_int16_t_prefix", "errno", error_names[index], state.code, failures == failures_before);
+        p101_error_reset(err);
+    }
+    p101_env_set_fault_injector(env, NULL, NULL);
+    {
+        int   native_status = 0;
+        pid_t native_pid    = fork();
+
+        EXPECT(native_pid >= 0);
+        if(native_pid == 0)
+        {
+            bool               native_passed = true;
+            struct p101_error *native_err    = NULL;
+            struct p101_env   *native_env    = NULL;
+            FILE              *native_stdin_result;
+
+            native_child_process = true;
+            failures             = 0;
+            (void)alarm(2U);
+            if(unsetenv("P101_CALL_LOG") != 0 || unsetenv("P101_RESOURCE_LOG") != 0)
+            {
+                fprintf(stderr, "native setup failed: cannot clear p101 logging environment\n");
+                native_child_status = 77;
+                goto native_child_done_;
+            }
+            native_stdin_result = freopen("/dev/null", "r", stdin);
+            if(native_stdin_result == NULL)
+            {
+                fprintf(stderr, "native setup failed: cannot make standard input deterministic\n");
+                native_child_status = 77;
+                goto native_child_done_;
+            }
+            native_err = p101_error_create(false);
+            if(native_err == NULL)
+            {
+                native_child_status = 77;
+                goto native_child_done_;
+            }
+            native_env = p101_env_create(native_err, NULL);
+            if(native_env == NULL)
+            {
+                native_child_status = 77;
+                goto native_child_done_;
+            }
+            const char *native_argument_3 = NULL;
+            int16_t     native_result     = p101_parse_negative_int16_t_prefix(native_env, native_err, "-1", &native_argument_3, 0);
+            (void)native_result;
+            if(p101_error_has_error(native_err))
+            {
+                bool native_error_declared = false;
+
+                for(size_t native_error_index = 0U; native_error_index < sizeof(errors) / sizeof(errors[0]); native_error_index++)
+                {
+                    if(p101_error_is_errno(native_err, errors[native_error_index]))
+                    {
+                        native_error_declared = true;
+                    }
+                }
+                if(!native_error_declared)
+                {
+                    fprintf(stderr, "native smoke produced an undeclared platform failure: p101_parse_negative_int16_t_prefix: %s\n", p101_error_get_message(native_err));
+                    native_passed = false;
+                }
+                p101_error_reset(native_err);
+            }
+            native_child_status = native_passed ? EXIT_SUCCESS : EXIT_FAILURE;
+        native_child_done_:
+            p101_env_destroy(native_env);
+            p101_error_destroy(native_err);
+        }
+        if(native_pid > 0)
+        {
+            EXPECT(native_waitpid_nointr(native_pid, &native_status) == native_pid);
+            if(WIFSIGNALED(native_status))
+            {
+                fprintf(stderr, "native smoke terminated by signal: p101_parse_negative_int16_t_prefix: %d\n", WTERMSIG(native_status));
+            }
+            EXPECT(WIFEXITED(native_status));
+            if(WIFEXITED(native_status) && WEXITSTATUS(native_status) == 77)
+            {
+                fprintf(stderr, "native smoke fixture unavailable: p101_parse_negative_int16_t_prefix\n");
+            }
+            else if(WIFEXITED(native_status))
+            {
+                if(WEXITSTATUS(native_status) != EXIT_SUCCESS)
+                {
+                    fprintf(stderr, "native smoke exited unsuccessfully: p101_parse_negative_int16_t_prefix: %d\n", WEXITSTATUS(native_status));
+                }
+                EXPECT(WEXITSTATUS(native_status) == EXIT_SUCCESS);
+            }
+        }
+        p101_error_reset(err);
+    }
+}
+
+/* P101_TEST_CASE(p101_parse_negative_int32_t) */
+static void test_p101_parse_negative_int32_t(struct p101_env *env, struct p101_error *err)
+{
+#ifdef __linux__
+    static const int         errors[]      = {EIO};
+    static const char *const error_names[] = {"EIO"};
+#elif defined(__APPLE__)
+    static const int         errors[]      = {EIO};
+    static const char *const error_names[] = {"EIO"};
+#elif defined(__FreeBSD__)
+    static const int         errors[]      = {EIO};
+    static const char *const error_names[] = {"EIO"};
+#else
+    static const int         errors[]      = {EIO};
+    static const char *const error_names[] = {"EIO"};
+#endif
+
+    for(size_t index = 0U; index < sizeof(errors) / sizeof(errors[0]); index++)
+    {
+        struct fault_state state = {0, errors[index]};
+        int                failures_before;
+
+        failures_before = failures;
+        EXPECT(p101_error_has_no_error(err));
+        fault_resource_events = 0U;
+        errno                 = P101_TEST_ERRNO_SENTINEL;
+        p101_env_set_fault_injector(env, fail_next_call, &state);
+        int32_t result = p101_parse_negative_int32_t(env, err, NULL, 0);
+        (void)result;
+        EXPECT(state.checks == 1);
+        EXPECT(p101_error_is_errno(err, state.code));
+        EXPECT(errno == P101_TEST_ERRNO_SENTINEL);
+        EXPECT(result == (0));
+        EXPECT(fault_resource_events == 0U);
+        write_outcome("p101_parse_negative_int32_t", "errno", error_names[index], state.code, failures == failures_before);
+        p101_error_reset(err);
+    }
+    p101_env_set_fault_injector(env, NULL, NULL);
+    {
+        int   native_status = 0;
+        pid_t native_pid    = fork();
+
+        EXPECT(native_pid >= 0);
+        if(native_pid == 0)
+        {
+            bool               native_passed = true;
+            struct p101_error *native_err    = NULL;
+            struct p101_env   *native_env    = NULL;
+            FILE              *native_stdin_result;
+
+            native_child_process = true;
+            failures             = 0;
+            (void)alarm(2U);
+            if(unsetenv("P101_CALL_LOG") != 0 || unsetenv("P101_RESOURCE_LOG") != 0)
+            {
+                fprintf(stderr, "native setup failed: cannot clear p101 logging environment\n");
+                native_child_status = 77;
+                goto native_child_done_;
+            }
+            native_stdin_result = freopen("/dev/null", "r", stdin);
+            if(native_stdin_result == NULL)
+            {
+                fprintf(stderr, "native setup failed: cannot make standard input deterministic\n");
+                native_child_status = 77;
+                goto native_child_done_;
+            }
+            native_err = p101_error_create(false);
+            if(native_err == NULL)
+            {
+                native_child_status = 77;
+                goto native_child_done_;
+            }
+            native_env = p101_env_create(native_err, NULL);
+            if(native_env == NULL)
+            {
+                native_child_status = 77;
+                goto native_child_done_;
+            }
+            int32_t native_result = p101_parse_negative_int32_t(native_env, native_err, "-1", 0);
+            (void)native_result;
+            if(p101_error_has_error(native_err))
+            {
+                bool native_error_declared = false;
+
+                for(size_t native_error_index = 0U; native_error_index < sizeof(errors) / sizeof(errors[0]); native_error_index++)
+                {
+                    if(p101_error_is_errno(native_err, errors[native_error_index]))
+                    {
+                        native_error_declared = true;
+                    }
+                }
+                if(!native_error_declared)
+                {
+                    fprintf(stderr, "native smoke produced an undeclared platform failure: p101_parse_negative_int32_t: %s\n", p101_error_get_message(native_err));
+                    native_passed = false;
+                }
+                p101_error_reset(native_err);
+            }
+            native_child_status = native_passed ? EXIT_SUCCESS : EXIT_FAILURE;
+        native_child_done_:
+            p101_env_destroy(native_env);
+            p101_error_destroy(native_err);
+        }
+        if(native_pid > 0)
+        {
+            EXPECT(native_waitpid_nointr(native_pid, &native_status) == native_pid);
+            if(WIFSIGNALED(native_status))
+            {
+                fprintf(stderr, "native smoke terminated by signal: p101_parse_negative_int32_t: %d\n", WTERMSIG(native_status));
+            }
+            EXPECT(WIFEXITED(native_status));
+            if(WIFEXITED(native_status) && WEXITSTATUS(native_status) == 77)
+            {
+                fprintf(stderr, "native smoke fixture unavailable: p101_parse_negative_int32_t\n");
+            }
+            else if(WIFEXITED(native_status))
+            {
+                if(WEXITSTATUS(native_status) != EXIT_SUCCESS)
+                {
+                    fprintf(stderr, "native smoke exited unsuccessfully: p101_parse_negative_int32_t: %d\n", WEXITSTATUS(native_status));
+                }
+                EXPECT(WEXITSTATUS(native_status) == EXIT_SUCCESS);
+            }
+        }
+        p101_error_reset(err);
+    }
+}
+
+/* P101_TEST_CASE(p101_parse_negative_int32_t_n) */
+static void test_p101_parse_negative_int32_t_n(struct p101_env *env, struct p101_error *err)
+{
+#ifdef __linux__
+    static const int         errors[]      = {EIO};
+    static const char *const error_names[] = {"EIO"};
+#elif defined(__APPLE__)
+    static const int         errors[]      = {EIO};
+    static const char *const error_names[] = {"EIO"};
+#elif defined(__FreeBSD__)
+    static const int         errors[]      = {EIO};
+    static const char *const error_names[] = {"EIO"};
+#else
+    static const int         errors[]      = {EIO};
+    static const char *const error_names[] = {"EIO"};
+#endif
+
+    for(size_t index = 0U; index < sizeof(errors) / sizeof(errors[0]); index++)
+    {
+        struct fault_state state = {0, errors[index]};
+        int                failures_before;
+
+        failures_before = failures;
+        EXPECT(p101_error_has_no_error(err));
+        fault_resource_events = 0U;
+        errno                 = P101_TEST_ERRNO_SENTINEL;
+        p101_env_set_fault_injector(env, fail_next_call, &state);
+        int32_t result = p101_parse_negative_int32_t_n(env, err, NULL, 0, 0);
+        (void)result;
+        EXPECT(state.checks == 1);
+        EXPECT(p101_error_is_errno(err, state.code));
+        EXPECT(errno == P101_TEST_ERRNO_SENTINEL);
+        EXPECT(result == (0));
+        EXPECT(fault_resource_events == 0U);
+        write_outcome("p101_parse_negative_int32_t_n", "errno", error_names[index], state.code, failures == failures_before);
+        p101_error_reset(err);
+    }
+    p101_env_set_fault_injector(env, NULL, NULL);
+    {
+        int   native_status = 0;
+        pid_t native_pid    = fork();
+
+        EXPECT(native_pid >= 0);
+        if(native_pid == 0)
+        {
+            bool               native_passed = true;
+            struct p101_error *native_err    = NULL;
+            struct p101_env   *native_env    = NULL;
+            FILE              *native_stdin_result;
+
+            native_child_process = true;
+            failures             = 0;
+            (void)alarm(2U);
+            if(unsetenv("P101_CALL_LOG") != 0 || unsetenv("P101_RESOURCE_LOG") != 0)
+            {
+                fprintf(stderr, "native setup failed: cannot clear p101 logging environment\n");
+                native_child_status = 77;
+                goto native_child_done_;
+            }
+            native_stdin_result = freopen("/dev/null", "r", stdin);
+            if(native_stdin_result == NULL)
+            {
+                fprintf(stderr, "native setup failed: cannot make standard input deterministic\n");
+                native_child_status = 77;
+                goto native_child_done_;
+            }
+            native_err = p101_error_create(false);
+            if(native_err == NULL)
+            {
+                native_child_status = 77;
+                goto native_child_done_;
+            }
+            native_env = p101_env_create(native_err, NULL);
+            if(native_env == NULL)
+            {
+                native_child_status = 77;
+                goto native_child_done_;
+            }
+            int32_t native_result = p101_parse_negative_int32_t_n(native_env, native_err, "-1", 2, 0);
+            (void)native_result;
+            if(p101_error_has_error(native_err))
+            {
+                bool native_error_declared = false;
+
+                for(size_t native_error_index = 0U; native_error_index < sizeof(errors) / sizeof(errors[0]); native_error_index++)
+                {
+                    if(p101_error_is_errno(native_err, errors[native_error_index]))
+                    {
+                        native_error_declared = true;
+                    }
+                }
+                if(!native_error_declared)
+                {
+                    fprintf(stderr, "native smoke produced an undeclared platform failure: p101_parse_negative_int32_t_n: %s\n", p101_error_get_message(native_err));
+                    native_passed = false;
+                }
+                p101_error_reset(native_err);
+            }
+            native_child_status = native_passed ? EXIT_SUCCESS : EXIT_FAILURE;
+        native_child_done_:
+            p101_env_destroy(native_env);
+            p101_error_destroy(native_err);
+        }
+        if(native_pid > 0)
+        {
+            EXPECT(native_waitpid_nointr(native_pid, &native_status) == native_pid);
+            if(WIFSIGNALED(native_status))
+            {
+                fprintf(stderr, "native smoke terminated by signal: p101_parse_negative_int32_t_n: %d\n", WTERMSIG(native_status));
+            }
+            EXPECT(WIFEXITED(native_status));
+            if(WIFEXITED(native_status) && WEXITSTATUS(native_status) == 77)
+            {
+                fprintf(stderr, "native smoke fixture unavailable: p101_parse_negative_int32_t_n\n");
+            }
+            else if(WIFEXITED(native_status))
+            {
+                if(WEXITSTATUS(native_status) != EXIT_SUCCESS)
+                {
+                    fprintf(stderr, "native smoke exited unsuccessfully: p101_parse_negative_int32_t_n: %d\n", WEXITSTATUS(native_status));
+                }
+                EXPECT(WEXITSTATUS(native_status) == EXIT_SUCCESS);
+            }
+        }
+        p101_error_reset(err);
+    }
+}
+
+/* P101_TEST_CASE(p101_parse_negative_int32_t_prefix) */
+static void test_p101_parse_negative_int32_t_prefix(struct p101_env *env, struct p101_error *err)
+{
+#ifdef __linux__
+    static const int         errors[]      = {EIO};
+    static const char *const error_names[] = {"EIO"};
+#elif defined(__APPLE__)
+    static const int         errors[]      = {EIO};
+    static const char *const error_names[] = {"EIO"};
+#elif defined(__FreeBSD__)
+    static const int         errors[]      = {EIO};
+    static const char *const error_names[] = {"EIO"};
+#else
+    static const int         errors[]      = {EIO};
+    static const char *const error_names[] = {"EIO"};
+#endif
+
+    for(size_t index = 0U; index < sizeof(errors) / sizeof(errors[0]); index++)
+    {
+        struct fault_state state = {0, errors[index]};
+        int                failures_before;
+
+        failures_before = failures;
+        EXPECT(p101_error_has_no_error(err));
+        fault_resource_events = 0U;
+        errno                 = P101_TEST_ERRNO_SENTINEL;
+        p101_env_set_fault_injector(env, fail_next_call, &state);
+        int32_t result = p101_parse_negative_int32_t_prefix(env, err, NULL, NULL, 0);
+        (void)result;
+        EXPECT(state.checks == 1);
+        EXPECT(p101_error_is_errno(err, state.code));
+        EXPECT(errno == P101_TEST_ERRNO_SENTINEL);
+        EXPECT(result == (0));
+        EXPECT(fault_resource_events == 0U);
+        write_outcome("p101_parse_negative_int32_t_prefix", "errno", error_names[index], state.code, failures == failures_before);
+        p101_error_reset(err);
+    }
+    p101_env_set_fault_injector(env, NULL, NULL);
+    {
+        int   native_status = 0;
+        pid_t native_pid    = fork();
+
+        EXPECT(native_pid >= 0);
+        if(native_pid == 0)
+        {
+            bool               native_passed = true;
+            struct p101_error *native_err    = NULL;
+            struct p101_env   *native_env    = NULL;
+            FILE              *native_stdin_result;
+
+            native_child_process = true;
+            failures             = 0;
+            (void)alarm(2U);
+            if(unsetenv("P101_CALL_LOG") != 0 || unsetenv("P101_RESOURCE_LOG") != 0)
+            {
+                fprintf(stderr, "native setup failed: cannot clear p101 logging environment\n");
+                native_child_status = 77;
+                goto native_child_done_;
+            }
+            native_stdin_result = freopen("/dev/null", "r", stdin);
+            if(native_stdin_result == NULL)
+            {
+                fprintf(stderr, "native setup failed: cannot make standard input deterministic\n");
+                native_child_status = 77;
+                goto native_child_done_;
+            }
+            native_err = p101_error_create(false);
+            if(native_err == NULL)
+            {
+                native_child_status = 77;
+                goto native_child_done_;
+            }
+            native_env = p101_env_create(native_err, NULL);
+            if(native_env == NULL)
+            {
+                native_child_status = 77;
+                goto native_child_done_;
+            }
+            const char *native_argument_3 = NULL;
+            int32_t     native_result     = p101_parse_negative_int32_t_prefix(native_env, native_err, "-1", &native_argument_3, 0);
+            (void)native_result;
+            if(p101_error_has_error(native_err))
+            {
+                bool native_error_declared = false;
+
+                for(size_t native_error_index = 0U; native_error_index < sizeof(errors) / sizeof(errors[0]); native_error_index++)
+                {
+                    if(p101_error_is_errno(native_err, errors[native_error_index]))
+                    {
+                        native_error_declared = true;
+                    }
+                }
+                if(!native_error_declared)
+                {
+                    fprintf(stderr, "native smoke produced an undeclared platform failure: p101_parse_negative_int32_t_prefix: %s\n", p101_error_get_message(native_err));
+                    native_passed = false;
+                }
+                p101_error_reset(native_err);
+            }
+            native_child_status = native_passed ? EXIT_SUCCESS : EXIT_FAILURE;
+        native_child_done_:
+            p101_env_destroy(native_env);
+            p101_error_destroy(native_err);
+        }
+        if(native_pid > 0)
+        {
+            EXPECT(native_waitpid_nointr(native_pid, &native_status) == native_pid);
+            if(WIFSIGNALED(native_status))
+            {
+                fprintf(stderr, "native smoke terminated by signal: p101_parse_negative_int32_t_prefix: %d\n", WTERMSIG(native_status));
+            }
+            EXPECT(WIFEXITED(native_status));
+            if(WIFEXITED(native_status) && WEXITSTATUS(native_status) == 77)
+            {
+                fprintf(stderr, "native smoke fixture unavailable: p101_parse_negative_int32_t_prefix\n");
+            }
+            else if(WIFEXITED(native_status))
+            {
+                if(WEXITSTATUS(native_status) != EXIT_SUCCESS)
+                {
+                    fprintf(stderr, "native smoke exited unsuccessfully: p101_parse_negative_int32_t_prefix: %d\n", WEXITSTATUS(native_status));
+                }
+                EXPECT(WEXITSTATUS(native_status) == EXIT_SUCCESS);
+            }
+        }
+        p101_error_reset(err);
+    }
+}
+
+/* P101_TEST_CASE(p101_parse_negative_int64_t) */
+static void test_p101_parse_negative_int64_t(struct p101_env *env, struct p101_error *err)
+{
+#ifdef __linux__
+    static const int         errors[]      = {EIO};
+    static const char *const error_names[] = {"EIO"};
+#elif defined(__APPLE__)
+    static const int         errors[]      = {EIO};
+    static const char *const error_names[] = {"EIO"};
+#elif defined(__FreeBSD__)
+    static const int         errors[]      = {EIO};
+    static const char *const error_names[] = {"EIO"};
+#else
+    static const int         errors[]      = {EIO};
+    static const char *const error_names[] = {"EIO"};
+#endif
+
+    for(size_t index = 0U; index < sizeof(errors) / sizeof(errors[0]); index++)
+    {
+        struct fault_state state = {0, errors[index]};
+        int                failures_before;
+
+        failures_before = failures;
+        EXPECT(p101_error_has_no_error(err));
+        fault_resource_events = 0U;
+        errno                 = P101_TEST_ERRNO_SENTINEL;
+        p101_env_set_fault_injector(env, fail_next_call, &state);
+        int64_t result = p101_parse_negative_int64_t(env, err, NULL, 0);
+        (void)result;
+        EXPECT(state.checks == 1);
+        EXPECT(p101_error_is_errno(err, state.code));
+        EXPECT(errno == P101_TEST_ERRNO_SENTINEL);
+        EXPECT(result == (0));
+        EXPECT(fault_resource_events == 0U);
+        write_outcome("p101_parse_negative_int64_t", "errno", error_names[index], state.code, failures == failures_before);
+        p101_error_reset(err);
+    }
+    p101_env_set_fault_injector(env, NULL, NULL);
+    {
+        int   native_status = 0;
+        pid_t native_pid    = fork();
+
+        EXPECT(native_pid >= 0);
+        if(native_pid == 0)
+        {
+            bool               native_passed = true;
+            struct p101_error *native_err    = NULL;
+            struct p101_env   *native_env    = NULL;
+            FILE              *native_stdin_result;
+
+            native_child_process = true;
+            failures             = 0;
+            (void)alarm(2U);
+            if(unsetenv("P101_CALL_LOG") != 0 || unsetenv("P101_RESOURCE_LOG") != 0)
+            {
+                fprintf(stderr, "native setup failed: cannot clear p101 logging environment\n");
+                native_child_status = 77;
+                goto native_child_done_;
+            }
+            native_stdin_result = freopen("/dev/null", "r", stdin);
+            if(native_stdin_result == NULL)
+            {
+                fprintf(stderr, "native setup failed: cannot make standard input deterministic\n");
+                native_child_status = 77;
+                goto native_child_done_;
+            }
+            native_err = p101_error_create(false);
+            if(native_err == NULL)
+            {
+                native_child_status = 77;
+                goto native_child_done_;
+            }
+            native_env = p101_env_create(native_err, NULL);
+            if(native_env == NULL)
+            {
+                native_child_status = 77;
+                goto native_child_done_;
+            }
+            int64_t native_result = p101_parse_negative_int64_t(native_env, native_err, "-1", 0);
+            (void)native_result;
+            if(p101_error_has_error(native_err))
+            {
+                bool native_error_declared = false;
+
+                for(size_t native_error_index = 0U; native_error_index < sizeof(errors) / sizeof(errors[0]); native_error_index++)
+                {
+                    if(p101_error_is_errno(native_err, errors[native_error_index]))
+                    {
+                        native_error_declared = true;
+                    }
+                }
+                if(!native_error_declared)
+                {
+                    fprintf(stderr, "native smoke produced an undeclared platform failure: p101_parse_negative_int64_t: %s\n", p101_error_get_message(native_err));
+                    native_passed = false;
+                }
+                p101_error_reset(native_err);
+            }
+            native_child_status = native_passed ? EXIT_SUCCESS : EXIT_FAILURE;
+        native_child_done_:
+            p101_env_destroy(native_env);
+            p101_error_destroy(native_err);
+        }
+        if(native_pid > 0)
+        {
+            EXPECT(native_waitpid_nointr(native_pid, &native_status) == native_pid);
+            if(WIFSIGNALED(native_status))
+            {
+                fprintf(stderr, "native smoke terminated by signal: p101_parse_negative_int64_t: %d\n", WTERMSIG(native_status));
+            }
+            EXPECT(WIFEXITED(native_status));
+            if(WIFEXITED(native_status) && WEXITSTATUS(native_status) == 77)
+            {
+                fprintf(stderr, "native smoke fixture unavailable: p101_parse_negative_int64_t\n");
+            }
+            else if(WIFEXITED(native_status))
+            {
+                if(WEXITSTATUS(native_status) != EXIT_SUCCESS)
+                {
+                    fprintf(stderr, "native smoke exited unsuccessfully: p101_parse_negative_int64_t: %d\n", WEXITSTATUS(native_status));
+                }
+                EXPECT(WEXITSTATUS(native_status) == EXIT_SUCCESS);
+            }
+        }
+        p101_error_reset(err);
+    }
+}
+
+/* P101_TEST_CASE(p101_parse_negative_int64_t_n) */
+static void test_p101_parse_negative_int64_t_n(struct p101_env *env, struct p101_error *err)
+{
+#ifdef __linux__
+    static const int         errors[]      = {EIO};
+    static const char *const error_names[] = {"EIO"};
+#elif defined(__APPLE__)
+    static const int         errors[]      = {EIO};
+    static const char *const error_names[] = {"EIO"};
+#elif defined(__FreeBSD__)
+    static const int         errors[]      = {EIO};
+    static const char *const error_names[] = {"EIO"};
+#else
+    static const int         errors[]      = {EIO};
+    static const char *const error_names[] = {"EIO"};
+#endif
+
+    for(size_t index = 0U; index < sizeof(errors) / sizeof(errors[0]); index++)
+    {
+        struct fault_state state = {0, errors[index]};
+        int                failures_before;
+
+        failures_before = failures;
+        EXPECT(p101_error_has_no_error(err));
+        fault_resource_events = 0U;
+        errno                 = P101_TEST_ERRNO_SENTINEL;
+        p101_env_set_fault_injector(env, fail_next_call, &state);
+        int64_t result = p101_parse_negative_int64_t_n(env, err, NULL, 0, 0);
+        (void)result;
+        EXPECT(state.checks == 1);
+        EXPECT(p101_error_is_errno(err, state.code));
+        EXPECT(errno == P101_TEST_ERRNO_SENTINEL);
+        EXPECT(result == (0));
+        EXPECT(fault_resource_events == 0U);
+        write_outcome("p101_parse_negative_int64_t_n", "errno", error_names[index], state.code, failures == failures_before);
+        p101_error_reset(err);
+    }
+    p101_env_set_fault_injector(env, NULL, NULL);
+    {
+        int   native_status = 0;
+        pid_t native_pid    = fork();
+
+        EXPECT(native_pid >= 0);
+        if(native_pid == 0)
+        {
+            bool               native_passed = true;
+            struct p101_error *native_err    = NULL;
+            struct p101_env   *native_env    = NULL;
+            FILE              *native_stdin_result;
+
+            native_child_process = true;
+            failures             = 0;
+            (void)alarm(2U);
+            if(unsetenv("P101_CALL_LOG") != 0 || unsetenv("P101_RESOURCE_LOG") != 0)
+            {
+                fprintf(stderr, "native setup failed: cannot clear p101 logging environment\n");
+                native_child_status = 77;
+                goto native_child_done_;
+            }
+            native_stdin_result = freopen("/dev/null", "r", stdin);
+            if(native_stdin_result == NULL)
+            {
+                fprintf(stderr, "native setup failed: cannot make standard input deterministic\n");
+                native_child_status = 77;
+                goto native_child_done_;
+            }
+            native_err = p101_error_create(false);
+            if(native_err == NULL)
+            {
+                native_child_status = 77;
+                goto native_child_done_;
+            }
+            native_env = p101_env_create(native_err, NULL);
+            if(native_env == NULL)
+            {
+                native_child_status = 77;
+                goto native_child_done_;
+            }
+            int64_t native_result = p101_parse_negative_int64_t_n(native_env, native_err, "-1", 2, 0);
+            (void)native_result;
+            if(p101_error_has_error(native_err))
+            {
+                bool native_error_declared = false;
+
+                for(size_t native_error_index = 0U; native_error_index < sizeof(errors) / sizeof(errors[0]); native_error_index++)
+                {
+                    if(p101_error_is_errno(native_err, errors[native_error_index]))
+                    {
+                        native_error_declared = true;
+                    }
+                }
+                if(!native_error_declared)
+                {
+                    fprintf(stderr, "native smoke produced an undeclared platform failure: p101_parse_negative_int64_t_n: %s\n", p101_error_get_message(native_err));
+                    native_passed = false;
+                }
+                p101_error_reset(native_err);
+            }
+            native_child_status = native_passed ? EXIT_SUCCESS : EXIT_FAILURE;
+        native_child_done_:
+            p101_env_destroy(native_env);
+            p101_error_destroy(native_err);
+        }
+        if(native_pid > 0)
+        {
+            EXPECT(native_waitpid_nointr(native_pid, &native_status) == native_pid);
+            if(WIFSIGNALED(native_status))
+            {
+                fprintf(stderr, "native smoke terminated by signal: p101_parse_negative_int64_t_n: %d\n", WTERMSIG(native_status));
+            }
+            EXPECT(WIFEXITED(native_status));
+            if(WIFEXITED(native_status) && WEXITSTATUS(native_status) == 77)
+            {
+                fprintf(stderr, "native smoke fixture unavailable: p101_parse_negative_int64_t_n\n");
+            }
+            else if(WIFEXITED(native_status))
+            {
+                if(WEXITSTATUS(native_status) != EXIT_SUCCESS)
+                {
+                    fprintf(stderr, "native smoke exited unsuccessfully: p101_parse_negative_int64_t_n: %d\n", WEXITSTATUS(native_status));
+                }
+                EXPECT(WEXITSTATUS(native_status) == EXIT_SUCCESS);
+            }
+        }
+        p101_error_reset(err);
+    }
+}
+
+/* P101_TEST_CASE(p101_parse_negative_int64_t_prefix) */
+static void test_p101_parse_negative_int64_t_prefix(struct p101_env *env, struct p101_error *err)
+{
+#ifdef __linux__
+    static const int         errors[]      = {EIO};
+    static const char *const error_names[] = {"EIO"};
+#elif defined(__APPLE__)
+    static const int         errors[]      = {EIO};
+    static const char *const error_names[] = {"EIO"};
+#elif defined(__FreeBSD__)
+    static const int         errors[]      = {EIO};
+    static const char *const error_names[] = {"EIO"};
+#else
+    static const int         errors[]      = {EIO};
+    static const char *const error_names[] = {"EIO"};
+#endif
+
+    for(size_t index = 0U; index < sizeof(errors) / sizeof(errors[0]); index++)
+    {
+        struct fault_state state = {0, errors[index]};
+        int                failures_before;
+
+        failures_before = failures;
+        EXPECT(p101_error_has_no_error(err));
+        fault_resource_events = 0U;
+        errno                 = P101_TEST_ERRNO_SENTINEL;
+        p101_env_set_fault_injector(env, fail_next_call, &state);
+        int64_t result = p101_parse_negative_int64_t_prefix(env, err, NULL, NULL, 0);
+        (void)result;
+        EXPECT(state.checks == 1);
+        EXPECT(p101_error_is_errno(err, state.code));
+        EXPECT(errno == P101_TEST_ERRNO_SENTINEL);
+        EXPECT(result == (0));
+        EXPECT(fault_resource_events == 0U);
+        write_outcome("p101_parse_negative_int64_t_prefix", "errno", error_names[index], state.code, failures == failures_before);
+        p101_error_reset(err);
+    }
+    p101_env_set_fault_injector(env, NULL, NULL);
+    {
+        int   native_status = 0;
+        pid_t native_pid    = fork();
+
+        EXPECT(native_pid >= 0);
+        if(native_pid == 0)
+        {
+            bool               native_passed = true;
+            struct p101_error *native_err    = NULL;
+            struct p101_env   *native_env    = NULL;
+            FILE              *native_stdin_result;
+
+            native_child_process = true;
+            failures             = 0;
+            (void)alarm(2U);
+            if(unsetenv("P101_CALL_LOG") != 0 || unsetenv("P101_RESOURCE_LOG") != 0)
+            {
+                fprintf(stderr, "native setup failed: cannot clear p101 logging environment\n");
+                native_child_status = 77;
+                goto native_child_done_;
+            }
+            native_stdin_result = freopen("/dev/null", "r", stdin);
+            if(native_stdin_result == NULL)
+            {
+                fprintf(stderr, "native setup failed: cannot make standard input deterministic\n");
+                native_child_status = 77;
+                goto native_child_done_;
+            }
+            native_err = p101_error_create(false);
+            if(native_err == NULL)
+            {
+                native_child_status = 77;
+                goto native_child_done_;
+            }
+            native_env = p101_env_create(native_err, NULL);
+            if(native_env == NULL)
+            {
+                native_child_status = 77;
+                goto native_child_done_;
+            }
+            const char *native_argument_3 = NULL;
+            int64_t     native_result     = p101_parse_negative_int64_t_prefix(native_env, native_err, "-1", &native_argument_3, 0);
+            (void)native_result;
+            if(p101_error_has_error(native_err))
+            {
+                bool native_error_declared = false;
+
+                for(size_t native_error_index = 0U; native_error_index < sizeof(errors) / sizeof(errors[0]); native_error_index++)
+                {
+                    if(p101_error_is_errno(native_err, errors[native_error_index]))
+                    {
+                        native_error_declared = true;
+                    }
+                }
+                if(!native_error_declared)
+                {
+                    fprintf(stderr, "native smoke produced an undeclared platform failure: p101_parse_negative_int64_t_prefix: %s\n", p101_error_get_message(native_err));
+                    native_passed = false;
+                }
+                p101_error_reset(native_err);
+            }
+            native_child_status = native_passed ? EXIT_SUCCESS : EXIT_FAILURE;
+        native_child_done_:
+            p101_env_destroy(native_env);
+            p101_error_destroy(native_err);
+        }
+        if(native_pid > 0)
+        {
+            EXPECT(native_waitpid_nointr(native_pid, &native_status) == native_pid);
+            if(WIFSIGNALED(native_status))
+            {
+                fprintf(stderr, "native smoke terminated by signal: p101_parse_negative_int64_t_prefix: %d\n", WTERMSIG(native_status));
+            }
+            EXPECT(WIFEXITED(native_status));
+            if(WIFEXITED(native_status) && WEXITSTATUS(native_status) == 77)
+            {
+                fprintf(stderr, "native smoke fixture unavailable: p101_parse_negative_int64_t_prefix\n");
+            }
+            else if(WIFEXITED(native_status))
+            {
+                if(WEXITSTATUS(native_status) != EXIT_SUCCESS)
+                {
+                    fprintf(stderr, "native smoke exited unsuccessfully: p101_parse_negative_int64_t_prefix: %d\n", WEXITSTATUS(native_status));
+                }
+                EXPECT(WEXITSTATUS(native_status) == EXIT_SUCCESS);
+            }
+        }
+        p101_error_reset(err);
+    }
+}
+
+/* P101_TEST_CASE(p101_parse_negative_int8_t) */
+static void test_p101_parse_negative_int8_t(struct p101_env *env, struct p101_error *err)
+{
+#ifdef __linux__
+    static const int         errors[]      = {EIO};
+    static const char *const error_names[] = {"EIO"};
+#elif defined(__APPLE__)
+    static const int         errors[]      = {EIO};
+    static const char *const error_names[] = {"EIO"};
+#elif defined(__FreeBSD__)
+    static const int         errors[]      = {EIO};
+    static const char *const error_names[] = {"EIO"};
+#else
+    static const int         errors[]      = {EIO};
+    static const char *const error_names[] = {"EIO"};
+#endif
+
+    for(size_t index = 0U; index < sizeof(errors) / sizeof(errors[0]); index++)
+    {
+        struct fault_state state = {0, errors[index]};
+        int                failures_before;
+
+        failures_before = failures;
+        EXPECT(p101_error_has_no_error(err));
+        fault_resource_events = 0U;
+        errno                 = P101_TEST_ERRNO_SENTINEL;
+        p101_env_set_fault_injector(env, fail_next_call, &state);
+        int8_t result = p101_parse_negative_int8_t(env, err, NULL, 0);
+        (void)result;
+        EXPECT(state.checks == 1);
+        EXPECT(p101_error_is_errno(err, state.code));
+        EXPECT(errno == P101_TEST_ERRNO_SENTINEL);
+        EXPECT(result == (0));
+        EXPECT(fault_resource_events == 0U);
+        write_outcome("p101_parse_negative_int8_t", "errno", error_names[index], state.code, failures == failures_before);
+        p101_error_reset(err);
+    }
+    p101_env_set_fault_injector(env, NULL, NULL);
+    {
+        int   native_status = 0;
+        pid_t native_pid    = fork();
+
+        EXPECT(native_pid >= 0);
+        if(native_pid == 0)
+        {
+            bool               native_passed = true;
+            struct p101_error *native_err    = NULL;
+            struct p101_env   *native_env    = NULL;
+            FILE              *native_stdin_result;
+
+            native_child_process = true;
+            failures             = 0;
+            (void)alarm(2U);
+            if(unsetenv("P101_CALL_LOG") != 0 || unsetenv("P101_RESOURCE_LOG") != 0)
+            {
+                fprintf(stderr, "native setup failed: cannot clear p101 logging environment\n");
+                native_child_status = 77;
+                goto native_child_done_;
+            }
+            native_stdin_result = freopen("/dev/null", "r", stdin);
+            if(native_stdin_result == NULL)
+            {
+                fprintf(stderr, "native setup failed: cannot make standard input deterministic\n");
+                native_child_status = 77;
+                goto native_child_done_;
+            }
+            native_err = p101_error_create(false);
+            if(native_err == NULL)
+            {
+                native_child_status = 77;
+                goto native_child_done_;
+            }
+            native_env = p101_env_create(native_err, NULL);
+            if(native_env == NULL)
+            {
+                native_child_status = 77;
+                goto native_child_done_;
+            }
+            int8_t native_result = p101_parse_negative_int8_t(native_env, native_err, "-1", 0);
+            (void)native_result;
+            if(p101_error_has_error(native_err))
+            {
+                bool native_error_declared = false;
+
+                for(size_t native_error_index = 0U; native_error_index < sizeof(errors) / sizeof(errors[0]); native_error_index++)
+                {
+                    if(p101_error_is_errno(native_err, errors[native_error_index]))
+                    {
+                        native_error_declared = true;
+                    }
+                }
+                if(!native_error_declared)
+                {
+                    fprintf(stderr, "native smoke produced an undeclared platform failure: p101_parse_negative_int8_t: %s\n", p101_error_get_message(native_err));
+                    native_passed = false;
+                }
+                p101_error_reset(native_err);
+            }
+            native_child_status = native_passed ? EXIT_SUCCESS : EXIT_FAILURE;
+        native_child_done_:
+            p101_env_destroy(native_env);
+            p101_error_destroy(native_err);
+        }
+        if(native_pid > 0)
+        {
+            EXPECT(native_waitpid_nointr(native_pid, &native_status) == native_pid);
+            if(WIFSIGNALED(native_status))
+            {
+                fprintf(stderr, "native smoke terminated by signal: p101_parse_negative_int8_t: %d\n", WTERMSIG(native_status));
+            }
+            EXPECT(WIFEXITED(native_status));
+            if(WIFEXITED(native_status) && WEXITSTATUS(native_status) == 77)
+            {
+                fprintf(stderr, "native smoke fixture unavailable: p101_parse_negative_int8_t\n");
+            }
+            else if(WIFEXITED(native_status))
+            {
+                if(WEXITSTATUS(native_status) != EXIT_SUCCESS)
+                {
+                    fprintf(stderr, "native smoke exited unsuccessfully: p101_parse_negative_int8_t: %d\n", WEXITSTATUS(native_status));
+                }
+                EXPECT(WEXITSTATUS(native_status) == EXIT_SUCCESS);
+            }
+        }
+        p101_error_reset(err);
+    }
+}
+
+/* P101_TEST_CASE(p101_parse_negative_int8_t_n) */
+static void test_p101_parse_negative_int8_t_n(struct p101_env *env, struct p101_error *err)
+{
+#ifdef __linux__
+    static const int         errors[]      = {EIO};
+    static const char *const error_names[] = {"EIO"};
+#elif defined(__APPLE__)
+    static const int         errors[]      = {EIO};
+    static const char *const error_names[] = {"EIO"};
+#elif defined(__FreeBSD__)
+    static const int         errors[]      = {EIO};
+    static const char *const error_names[] = {"EIO"};
+#else
+    static const int         errors[]      = {EIO};
+    static const char *const error_names[] = {"EIO"};
+#endif
+
+    for(size_t index = 0U; index < sizeof(errors) / sizeof(errors[0]); index++)
+    {
+        struct fault_state state = {0, errors[index]};
+        int                failures_before;
+
+        failures_before = failures;
+        EXPECT(p101_error_has_no_error(err));
+        fault_resource_events = 0U;
+        errno                 = P101_TEST_ERRNO_SENTINEL;
+        p101_env_set_fault_injector(env, fail_next_call, &state);
+        int8_t result = p101_parse_negative_int8_t_n(env, err, NULL, 0, 0);
+        (void)result;
+        EXPECT(state.checks == 1);
+        EXPECT(p101_error_is_errno(err, state.code));
+        EXPECT(errno == P101_TEST_ERRNO_SENTINEL);
+        EXPECT(result == (0));
+        EXPECT(fault_resource_events == 0U);
+        write_outcome("p101_parse_negative_int8_t_n", "errno", error_names[index], state.code, failures == failures_before);
+        p101_error_reset(err);
+    }
+    p101_env_set_fault_injector(env, NULL, NULL);
+    {
+        int   native_status = 0;
+        pid_t native_pid    = fork();
+
+        EXPECT(native_pid >= 0);
+        if(native_pid == 0)
+        {
+            bool               native_passed = true;
+            struct p101_error *native_err    = NULL;
+            struct p101_env   *native_env    = NULL;
+            FILE              *native_stdin_result;
+
+            native_child_process = true;
+            failures             = 0;
+            (void)alarm(2U);
+            if(unsetenv("P101_CALL_LOG") != 0 || unsetenv("P101_RESOURCE_LOG") != 0)
+            {
+                fprintf(stderr, "native setup failed: cannot clear p101 logging environment\n");
+                native_child_status = 77;
+                goto native_child_done_;
+            }
+            native_stdin_result = freopen("/dev/null", "r", stdin);
+            if(native_stdin_result == NULL)
+            {
+                fprintf(stderr, "native setup failed: cannot make standard input deterministic\n");
+                native_child_status = 77;
+                goto native_child_done_;
+            }
+            native_err = p101_error_create(false);
+            if(native_err == NULL)
+            {
+                native_child_status = 77;
+                goto native_child_done_;
+            }
+            native_env = p101_env_create(native_err, NULL);
+            if(native_env == NULL)
+            {
+                native_child_status = 77;
+                goto native_child_done_;
+            }
+            int8_t native_result = p101_parse_negative_int8_t_n(native_env, native_err, "-1", 2, 0);
+            (void)native_result;
+            if(p101_error_has_error(native_err))
+            {
+                bool native_error_declared = false;
+
+                for(size_t native_error_index = 0U; native_error_index < sizeof(errors) / sizeof(errors[0]); native_error_index++)
+                {
+                    if(p101_error_is_errno(native_err, errors[native_error_index]))
+                    {
+                        native_error_declared = true;
+                    }
+                }
+                if(!native_error_declared)
+                {
+                    fprintf(stderr, "native smoke produced an undeclared platform failure: p101_parse_negative_int8_t_n: %s\n", p101_error_get_message(native_err));
+                    native_passed = false;
+                }
+                p101_error_reset(native_err);
+            }
+            native_child_status = native_passed ? EXIT_SUCCESS : EXIT_FAILURE;
+        native_child_done_:
+            p101_env_destroy(native_env);
+            p101_error_destroy(native_err);
+        }
+        if(native_pid > 0)
+        {
+            EXPECT(native_waitpid_nointr(native_pid, &native_status) == native_pid);
+            if(WIFSIGNALED(native_status))
+            {
+                fprintf(stderr, "native smoke terminated by signal: p101_parse_negative_int8_t_n: %d\n", WTERMSIG(native_status));
+            }
+            EXPECT(WIFEXITED(native_status));
+            if(WIFEXITED(native_status) && WEXITSTATUS(native_status) == 77)
+            {
+                fprintf(stderr, "native smoke fixture unavailable: p101_parse_negative_int8_t_n\n");
+            }
+            else if(WIFEXITED(native_status))
+            {
+                if(WEXITSTATUS(native_status) != EXIT_SUCCESS)
+                {
+                    fprintf(stderr, "native smoke exited unsuccessfully: p101_parse_negative_int8_t_n: %d\n", WEXITSTATUS(native_status));
+                }
+                EXPECT(WEXITSTATUS(native_status) == EXIT_SUCCESS);
+            }
+        }
+        p101_error_reset(err);
+    }
+}
+
+/* P101_TEST_CASE(p101_parse_negative_int8_t_prefix) */
+static void test_p101_parse_negative_int8_t_prefix(struct p101_env *env, struct p101_error *err)
+{
+#ifdef __linux__
+    static const int         errors[]      = {EIO};
+    static const char *const error_names[] = {"EIO"};
+#elif defined(__APPLE__)
+    static const int         errors[]      = {EIO};
+    static const char *const error_names[] = {"EIO"};
+#elif defined(__FreeBSD__)
+    static const int         errors[]      = {EIO};
+    static const char *const error_names[] = {"EIO"};
+#else
+    static const int         errors[]      = {EIO};
+    static const char *const error_names[] = {"EIO"};
+#endif
+
+    for(size_t index = 0U; index < sizeof(errors) / sizeof(errors[0]); index++)
+    {
+        struct fault_state state = {0, errors[index]};
+        int                failures_before;
+
+        failures_before = failures;
+        EXPECT(p101_error_has_no_error(err));
+        fault_resource_events = 0U;
+        errno                 = P101_TEST_ERRNO_SENTINEL;
+        p101_env_set_fault_injector(env, fail_next_call, &state);
+        int8_t result = p101_parse_negative_int8_t_prefix(env, err, NULL, NULL, 0);
+        (void)result;
+        EXPECT(state.checks == 1);
+        EXPECT(p101_error_is_errno(err, state.code));
+        EXPECT(errno == P101_TEST_ERRNO_SENTINEL);
+        EXPECT(result == (0));
+        EXPECT(fault_resource_events == 0U);
+        write_outcome("p101_parse_negative_int8_t_prefix", "errno", error_names[index], state.code, failures == failures_before);
+        p101_error_reset(err);
+    }
+    p101_env_set_fault_injector(env, NULL, NULL);
+    {
+        int   native_status = 0;
+        pid_t native_pid    = fork();
+
+        EXPECT(native_pid >= 0);
+        if(native_pid == 0)
+        {
+            bool               native_passed = true;
+            struct p101_error *native_err    = NULL;
+            struct p101_env   *native_env    = NULL;
+            FILE              *native_stdin_result;
+
+            native_child_process = true;
+            failures             = 0;
+            (void)alarm(2U);
+            if(unsetenv("P101_CALL_LOG") != 0 || unsetenv("P101_RESOURCE_LOG") != 0)
+            {
+                fprintf(stderr, "native setup failed: cannot clear p101 logging environment\n");
+                native_child_status = 77;
+                goto native_child_done_;
+            }
+            native_stdin_result = freopen("/dev/null", "r", stdin);
+            if(native_stdin_result == NULL)
+            {
+                fprintf(stderr, "native setup failed: cannot make standard input deterministic\n");
+                native_child_status = 77;
+                goto native_child_done_;
+            }
+            native_err = p101_error_create(false);
+            if(native_err == NULL)
+            {
+                native_child_status = 77;
+                goto native_child_done_;
+            }
+            native_env = p101_env_create(native_err, NULL);
+            if(native_env == NULL)
+            {
+                native_child_status = 77;
+                goto native_child_done_;
+            }
+            const char *native_argument_3 = NULL;
+            int8_t      native_result     = p101_parse_negative_int8_t_prefix(native_env, native_err, "-1", &native_argument_3, 0);
+            (void)native_result;
+            if(p101_error_has_error(native_err))
+            {
+                bool native_error_declared = false;
+
+                for(size_t native_error_index = 0U; native_error_index < sizeof(errors) / sizeof(errors[0]); native_error_index++)
+                {
+                    if(p101_error_is_errno(native_err, errors[native_error_index]))
+                    {
+                        native_error_declared = true;
+                    }
+                }
+                if(!native_error_declared)
+                {
+                    fprintf(stderr, "native smoke produced an undeclared platform failure: p101_parse_negative_int8_t_prefix: %s\n", p101_error_get_message(native_err));
+                    native_passed = false;
+                }
+                p101_error_reset(native_err);
+            }
+            native_child_status = native_passed ? EXIT_SUCCESS : EXIT_FAILURE;
+        native_child_done_:
+            p101_env_destroy(native_env);
+            p101_error_destroy(native_err);
+        }
+        if(native_pid > 0)
+        {
+            EXPECT(native_waitpid_nointr(native_pid, &native_status) == native_pid);
+            if(WIFSIGNALED(native_status))
+            {
+                fprintf(stderr, "native smoke terminated by signal: p101_parse_negative_int8_t_prefix: %d\n", WTERMSIG(native_status));
+            }
+            EXPECT(WIFEXITED(native_status));
+            if(WIFEXITED(native_status) && WEXITSTATUS(native_status) == 77)
+            {
+                fprintf(stderr, "native smoke fixture unavailable: p101_parse_negative_int8_t_prefix\n");
+            }
+            else if(WIFEXITED(native_status))
+            {
+                if(WEXITSTATUS(native_status) != EXIT_SUCCESS)
+                {
+                    fprintf(stderr, "native smoke exited unsuccessfully: p101_parse_negative_int8_t_prefix: %d\n", WEXITSTATUS(native_status));
+                }
+                EXPECT(WEXITSTATUS(native_status) == EXIT_SUCCESS);
+            }
+        }
+        p101_error_reset(err);
+    }
+}
+
+/* P101_TEST_CASE(p101_parse_negative_int_n) */
+static void test_p101_parse_negative_int_n(struct p101_env *env, struct p101_error *err)
+{
+#ifdef __linux__
+    static const int         errors[]      = {EIO};
+    static const char *const error_names[] = {"EIO"};
+#elif defined(__APPLE__)
+    static const int         errors[]      = {EIO};
+    static const char *const error_names[] = {"EIO"};
+#elif defined(__FreeBSD__)
+    static const int         errors[]      = {EIO};
+    static const char *const error_names[] = {"EIO"};
+#else
+    static const int         errors[]      = {EIO};
+    static const char *const error_names[] = {"EIO"};
+#endif
+
+    for(size_t index = 0U; index < sizeof(errors) / sizeof(errors[0]); index++)
+    {
+        struct fault_state state = {0, errors[index]};
+        int                failures_before;
+
+        failures_before = failures;
+        EXPECT(p101_error_has_no_error(err));
+        fault_resource_events = 0U;
+        errno                 = P101_TEST_ERRNO_SENTINEL;
+        p101_env_set_fault_injector(env, fail_next_call, &state);
+        int result = p101_parse_negative_int_n(env, err, NULL, 0, 0);
+        (void)result;
+        EXPECT(state.checks == 1);
+        EXPECT(p101_error_is_errno(err, state.code));
+        EXPECT(errno == P101_TEST_ERRNO_SENTINEL);
+        EXPECT(result == (0));
+        EXPECT(fault_resource_events == 0U);
+        write_outcome("p101_parse_negative_int_n", "errno", error_names[index], state.code, failures == failures_before);
+        p101_error_reset(err);
+    }
+    p101_env_set_fault_injector(env, NULL, NULL);
+    {
+        int   native_status = 0;
+        pid_t native_pid    = fork();
+
+        EXPECT(native_pid >= 0);
+        if(native_pid == 0)
+        {
+            bool               native_passed = true;
+            struct p101_error *native_err    = NULL;
+            struct p101_env   *native_env    = NULL;
+            FILE              *native_stdin_result;
+
+            native_child_process = true;
+            failures             = 0;
+            (void)alarm(2U);
+            if(unsetenv("P101_CALL_LOG") != 0 || unsetenv("P101_RESOURCE_LOG") != 0)
+            {
+                fprintf(stderr, "native setup failed: cannot clear p101 logging environment\n");
+                native_child_status = 77;
+                goto native_child_done_;
+            }
+            native_stdin_result = freopen("/dev/null", "r", stdin);
+            if(native_stdin_result == NULL)
+            {
+                fprintf(stderr, "native setup failed: cannot make standard input deterministic\n");
+                native_child_status = 77;
+                goto native_child_done_;
+            }
+            native_err = p101_error_create(false);
+            if(native_err == NULL)
+            {
+                native_child_status = 77;
+                goto native_child_done_;
+            }
+            native_env = p101_env_create(native_err, NULL);
+            if(native_env == NULL)
+            {
+                native_child_status = 77;
+                goto native_child_done_;
+            }
+            int native_result = p101_parse_negative_int_n(native_env, native_err, "-1", 2, 0);
+            (void)native_result;
+            if(p101_error_has_error(native_err))
+            {
+                bool native_error_declared = false;
+
+                for(size_t native_error_index = 0U; native_error_index < sizeof(errors) / sizeof(errors[0]); native_error_index++)
+                {
+                    if(p101_error_is_errno(native_err, errors[native_error_index]))
+                    {
+                        native_error_declared = true;
+                    }
+                }
+                if(!native_error_declared)
+                {
+                    fprintf(stderr, "native smoke produced an undeclared platform failure: p101_parse_negative_int_n: %s\n", p101_error_get_message(native_err));
+                    native_passed = false;
+                }
+                p101_error_reset(native_err);
+            }
+            native_child_status = native_passed ? EXIT_SUCCESS : EXIT_FAILURE;
+        native_child_done_:
+            p101_env_destroy(native_env);
+            p101_error_destroy(native_err);
+        }
+        if(native_pid > 0)
+        {
+            EXPECT(native_waitpid_nointr(native_pid, &native_status) == native_pid);
+            if(WIFSIGNALED(native_status))
+            {
+                fprintf(stderr, "native smoke terminated by signal: p101_parse_negative_int_n: %d\n", WTERMSIG(native_status));
+            }
+            EXPECT(WIFEXITED(native_status));
+            if(WIFEXITED(native_status) && WEXITSTATUS(native_status) == 77)
+            {
+                fprintf(stderr, "native smoke fixture unavailable: p101_parse_negative_int_n\n");
+            }
+            else if(WIFEXITED(native_status))
+            {
+                if(WEXITSTATUS(native_status) != EXIT_SUCCESS)
+                {
+                    fprintf(stderr, "native smoke exited unsuccessfully: p101_parse_negative_int_n: %d\n", WEXITSTATUS(native_status));
+                }
+                EXPECT(WEXITSTATUS(native_status) == EXIT_SUCCESS);
+            }
+        }
+        p101_error_reset(err);
+    }
+}
+
+/* P101_TEST_CASE(p101_parse_negative_int_prefix) */
+static void test_p101_parse_negative_int_prefix(struct p101_env *env, struct p101_error *err)
+{
+#ifdef __linux__
+    static const int         errors[]      = {EIO};
+    static const char *const error_names[] = {"EIO"};
+#elif defined(__APPLE__)
+    static const int         errors[]      = {EIO};
+    static const char *const error_names[] = {"EIO"};
+#elif defined(__FreeBSD__)
+    static const int         errors[]      = {EIO};
+    static const char *const error_names[] = {"EIO"};
+#else
+    static const int         errors[]      = {EIO};
+    static const char *const error_names[] = {"EIO"};
+#endif
+
+    for(size_t index = 0U; index < sizeof(errors) / sizeof(errors[0]); index++)
+    {
+        struct fault_state state = {0, errors[index]};
+        int                failures_before;
+
+        failures_before = failures;
+        EXPECT(p101_error_has_no_error(err));
+        fault_resource_events = 0U;
+        errno                 = P101_TEST_ERRNO_SENTINEL;
+        p101_env_set_fault_injector(env, fail_next_call, &state);
+        int result = p101_parse_negative_int_prefix(env, err, NULL, NULL, 0);
+        (void)result;
+        EXPECT(state.checks == 1);
+        EXPECT(p101_error_is_errno(err, state.code));
+        EXPECT(errno == P101_TEST_ERRNO_SENTINEL);
+        EXPECT(result == (0));
+        EXPECT(fault_resource_events == 0U);
+        write_outcome("p101_parse_negative_int_prefix", "errno", error_names[index], state.code, failures == failures_before);
+        p101_error_reset(err);
+    }
+    p101_env_set_fault_injector(env, NULL, NULL);
+    {
+        int   native_status = 0;
+        pid_t native_pid    = fork();
+
+        EXPECT(native_pid >= 0);
+        if(native_pid == 0)
+        {
+            bool               native_passed = true;
+            struct p101_error *native_err    = NULL;
+            struct p101_env   *native_env    = NULL;
+            FILE              *native_stdin_result;
+
+            native_child_process = true;
+            failures             = 0;
+            (void)alarm(2U);
+            if(unsetenv("P101_CALL_LOG") != 0 || unsetenv("P101_RESOURCE_LOG") != 0)
+            {
+                fprintf(stderr, "native setup failed: cannot clear p101 logging environment\n");
+                native_child_status = 77;
+                goto native_child_done_;
+            }
+            native_stdin_result = freopen("/dev/null", "r", stdin);
+            if(native_stdin_result == NULL)
+            {
+                fprintf(stderr, "native setup failed: cannot make standard input deterministic\n");
+                native_child_status = 77;
+                goto native_child_done_;
+            }
+            native_err = p101_error_create(false);
+            if(native_err == NULL)
+            {
+                native_child_status = 77;
+                goto native_child_done_;
+            }
+            native_env = p101_env_create(native_err, NULL);
+            if(native_env == NULL)
+            {
+                native_child_status = 77;
+                goto native_child_done_;
+            }
+            const char *native_argument_3 = NULL;
+            int         native_result     = p101_parse_negative_int_prefix(native_env, native_err, "-1", &native_argument_3, 0);
+            (void)native_result;
+            if(p101_error_has_error(native_err))
+            {
+                bool native_error_declared = false;
+
+                for(size_t native_error_index = 0U; native_error_index < sizeof(errors) / sizeof(errors[0]); native_error_index++)
+                {
+                    if(p101_error_is_errno(native_err, errors[native_error_index]))
+                    {
+                        native_error_declared = true;
+                    }
+                }
+                if(!native_error_declared)
+                {
+                    fprintf(stderr, "native smoke produced an undeclared platform failure: p101_parse_negative_int_prefix: %s\n", p101_error_get_message(native_err));
+                    native_passed = false;
+                }
+                p101_error_reset(native_err);
+            }
+            native_child_status = native_passed ? EXIT_SUCCESS : EXIT_FAILURE;
+        native_child_done_:
+            p101_env_destroy(native_env);
+            p101_error_destroy(native_err);
+        }
+        if(native_pid > 0)
+        {
+            EXPECT(native_waitpid_nointr(native_pid, &native_status) == native_pid);
+            if(WIFSIGNALED(native_status))
+            {
+                fprintf(stderr, "native smoke terminated by signal: p101_parse_negative_int_prefix: %d\n", WTERMSIG(native_status));
+            }
+            EXPECT(WIFEXITED(native_status));
+            if(WIFEXITED(native_status) && WEXITSTATUS(native_status) == 77)
+            {
+                fprintf(stderr, "native smoke fixture unavailable: p101_parse_negative_int_prefix\n");
+            }
+            else if(WIFEXITED(native_status))
+            {
+                if(WEXITSTATUS(native_status) != EXIT_SUCCESS)
+                {
+                    fprintf(stderr, "native smoke exited unsuccessfully: p101_parse_negative_int_prefix: %d\n", WEXITSTATUS(native_status));
+                }
+                EXPECT(WEXITSTATUS(native_status) == EXIT_SUCCESS);
+            }
+        }
+        p101_error_reset(err);
+    }
+}
+
+/* P101_TEST_CASE(p101_parse_negative_long) */
+static void test_p101_parse_negative_long(struct p101_env *env, struct p101_error *err)
+{
+#ifdef __linux__
+    static const int         errors[]      = {EIO};
+    static const char *const error_names[] = {"EIO"};
+#elif defined(__APPLE__)
+    static const int         errors[]      = {EIO};
+    static const char *const error_names[] = {"EIO"};
+#elif defined(__FreeBSD__)
+    static const int         errors[]      = {EIO};
+    static const char *const error_names[] = {"EIO"};
+#else
+    static const int         errors[]      = {EIO};
+    static const char *const error_names[] = {"EIO"};
+#endif
+
+    for(size_t index = 0U; index < sizeof(errors) / sizeof(errors[0]); index++)
+    {
+        struct fault_state state = {0, errors[index]};
+        int                failures_before;
+
+        failures_before = failures;
+        EXPECT(p101_error_has_no_error(err));
+        fault_resource_events = 0U;
+        errno                 = P101_TEST_ERRNO_SENTINEL;
+        p101_env_set_fault_injector(env, fail_next_call, &state);
+        long result = p101_parse_negative_long(env, err, NULL, 0);
+        (void)result;
+        EXPECT(state.checks == 1);
+        EXPECT(p101_error_is_errno(err, state.code));
+        EXPECT(errno == P101_TEST_ERRNO_SENTINEL);
+        EXPECT(result == (0));
+        EXPECT(fault_resource_events == 0U);
+        write_outcome("p101_parse_negative_long", "errno", error_names[index], state.code, failures == failures_before);
+        p101_error_reset(err);
+    }
+    p101_env_set_fault_injector(env, NULL, NULL);
+    {
+        int   native_status = 0;
+        pid_t native_pid    = fork();
+
+        EXPECT(native_pid >= 0);
+        if(native_pid == 0)
+        {
+            bool               native_passed = true;
+            struct p101_error *native_err    = NULL;
+            struct p101_env   *native_env    = NULL;
+            FILE              *native_stdin_result;
+
+            native_child_process = true;
+            failures             = 0;
+            (void)alarm(2U);
+            if(unsetenv("P101_CALL_LOG") != 0 || unsetenv("P101_RESOURCE_LOG") != 0)
+            {
+                fprintf(stderr, "native setup failed: cannot clear p101 logging environment\n");
+                native_child_status = 77;
+                goto native_child_done_;
+            }
+            native_stdin_result = freopen("/dev/null", "r", stdin);
+            if(native_stdin_result == NULL)
+            {
+                fprintf(stderr, "native setup failed: cannot make standard input deterministic\n");
+                native_child_status = 77;
+                goto native_child_done_;
+            }
+            native_err = p101_error_create(false);
+            if(native_err == NULL)
+            {
+                native_child_status = 77;
+                goto native_child_done_;
+            }
+            native_env = p101_env_create(native_err, NULL);
+            if(native_env == NULL)
+            {
+                native_child_status = 77;
+                goto native_child_done_;
+            }
+            long native_result = p101_parse_negative_long(native_env, native_err, "-1", 0);
+            (void)native_result;
+            if(p101_error_has_error(native_err))
+            {
+                bool native_error_declared = false;
+
+                for(size_t native_error_index = 0U; native_error_index < sizeof(errors) / sizeof(errors[0]); native_error_index++)
+                {
+                    if(p101_error_is_errno(native_err, errors[native_error_index]))
+                    {
+                        native_error_declared = true;
+                    }
+                }
+                if(!native_error_declared)
+                {
+                    fprintf(stderr, "native smoke produced an undeclared platform failure: p101_parse_negative_long: %s\n", p101_error_get_message(native_err));
+                    native_passed = false;
+                }
+                p101_error_reset(native_err);
+            }
+            native_child_status = native_passed ? EXIT_SUCCESS : EXIT_FAILURE;
+        native_child_done_:
+            p101_env_destroy(native_env);
+            p101_error_destroy(native_err);
+        }
+        if(native_pid > 0)
+        {
+            EXPECT(native_waitpid_nointr(native_pid, &native_status) == native_pid);
+            if(WIFSIGNALED(native_status))
+            {
+                fprintf(stderr, "native smoke terminated by signal: p101_parse_negative_long: %d\n", WTERMSIG(native_status));
+            }
+            EXPECT(WIFEXITED(native_status));
+            if(WIFEXITED(native_status) && WEXITSTATUS(native_status) == 77)
+            {
+                fprintf(stderr, "native smoke fixture unavailable: p101_parse_negative_long\n");
+            }
+            else if(WIFEXITED(native_status))
+            {
+                if(WEXITSTATUS(native_status) != EXIT_SUCCESS)
+                {
+                    fprintf(stderr, "native smoke exited unsuccessfully: p101_parse_negative_long: %d\n", WEXITSTATUS(native_status));
+                }
+                EXPECT(WEXITSTATUS(native_status) == EXIT_SUCCESS);
+            }
+        }
+        p101_error_reset(err);
+    }
+}
+
+/* P101_TEST_CASE(p101_parse_negative_long_long) */
+static void test_p101_parse_negative_long_long(struct p101_env *env, struct p101_error *err)
+{
+#ifdef __linux__
+    static const int         errors[]      = {EIO};
+    static const char *const error_names[] = {"EIO"};
+#elif defined(__APPLE__)
+    static const int         errors[]      = {EIO};
+    static const char *const error_names[] = {"EIO"};
+#elif defined(__FreeBSD__)
+    static const int         errors[]      = {EIO};
+    static const char *const error_names[] = {"EIO"};
+#else
+    static const int         errors[]      = {EIO};
+    static const char *const error_names[] = {"EIO"};
+#endif
+
+    for(size_t index = 0U; index < sizeof(errors) / sizeof(errors[0]); index++)
+    {
+        struct fault_state state = {0, errors[index]};
+        int                failures_before;
+
+        failures_before = failures;
+        EXPECT(p101_error_has_no_error(err));
+        fault_resource_events = 0U;
+        errno                 = P101_TEST_ERRNO_SENTINEL;
+        p101_env_set_fault_injector(env, fail_next_call, &state);
+        long long result = p101_parse_negative_long_long(env, err, NULL, 0);
+        (void)result;
+        EXPECT(state.checks == 1);
+        EXPECT(p101_error_is_errno(err, state.code));
+        EXPECT(errno == P101_TEST_ERRNO_SENTINEL);
+        EXPECT(result == (0));
+        EXPECT(fault_resource_events == 0U);
+        write_outcome("p101_parse_negative_long_long", "errno", error_names[index], state.code, failures == failures_before);
+        p101_error_reset(err);
+    }
+    p101_env_set_fault_injector(env, NULL, NULL);
+    {
+        int   native_status = 0;
+        pid_t native_pid    = fork();
+
+        EXPECT(native_pid >= 0);
+        if(native_pid == 0)
+        {
+            bool               native_passed = true;
+            struct p101_error *native_err    = NULL;
+            struct p101_env   *native_env    = NULL;
+            FILE              *native_stdin_result;
+
+            native_child_process = true;
+            failures             = 0;
+            (void)alarm(2U);
+            if(unsetenv("P101_CALL_LOG") != 0 || unsetenv("P101_RESOURCE_LOG") != 0)
+            {
+                fprintf(stderr, "native setup failed: cannot clear p101 logging environment\n");
+                native_child_status = 77;
+                goto native_child_done_;
+            }
+            native_stdin_result = freopen("/dev/null", "r", stdin);
+            if(native_stdin_result == NULL)
+            {
+                fprintf(stderr, "native setup failed: cannot make standard input deterministic\n");
+                native_child_status = 77;
+                goto native_child_done_;
+            }
+            native_err = p101_error_create(false);
+            if(native_err == NULL)
+            {
+                native_child_status = 77;
+                goto native_child_done_;
+            }
+            native_env = p101_env_create(native_err, NULL);
+            if(native_env == NULL)
+            {
+                native_child_status = 77;
+                goto native_child_done_;
+            }
+            long long native_result = p101_parse_negative_long_long(native_env, native_err, "-1", 0);
+            (void)native_result;
+            if(p101_error_has_error(native_err))
+            {
+                bool native_error_declared = false;
+
+                for(size_t native_error_index = 0U; native_error_index < sizeof(errors) / sizeof(errors[0]); native_error_index++)
+                {
+                    if(p101_error_is_errno(native_err, errors[native_error_index]))
+                    {
+                        native_error_declared = true;
+                    }
+                }
+                if(!native_error_declared)
+                {
+                    fprintf(stderr, "native smoke produced an undeclared platform failure: p101_parse_negative_long_long: %s\n", p101_error_get_message(native_err));
+                    native_passed = false;
+                }
+                p101_error_reset(native_err);
+            }
+            native_child_status = native_passed ? EXIT_SUCCESS : EXIT_FAILURE;
+        native_child_done_:
+            p101_env_destroy(native_env);
+            p101_error_destroy(native_err);
+        }
+        if(native_pid > 0)
+        {
+            EXPECT(native_waitpid_nointr(native_pid, &native_status) == native_pid);
+            if(WIFSIGNALED(native_status))
+            {
+                fprintf(stderr, "native smoke terminated by signal: p101_parse_negative_long_long: %d\n", WTERMSIG(native_status));
+            }
+            EXPECT(WIFEXITED(native_status));
+            if(WIFEXITED(native_status) && WEXITSTATUS(native_status) == 77)
+            {
+                fprintf(stderr, "native smoke fixture unavailable: p101_parse_negative_long_long\n");
+            }
+            else if(WIFEXITED(native_status))
+            {
+                if(WEXITSTATUS(native_status) != EXIT_SUCCESS)
+                {
+                    fprintf(stderr, "native smoke exited unsuccessfully: p101_parse_negative_long_long: %d\n", WEXITSTATUS(native_status));
+                }
+                EXPECT(WEXITSTATUS(native_status) == EXIT_SUCCESS);
+            }
+        }
+        p101_error_reset(err);
+    }
+}
+
+/* P101_TEST_CASE(p101_parse_negative_long_long_n) */
+static void test_p101_parse_negative_long_long_n(struct p101_env *env, struct p101_error *err)
+{
+#ifdef __linux__
+    static const int         errors[]      = {EIO};
+    static const char *const error_names[] = {"EIO"};
+#elif defined(__APPLE__)
+    static const int         errors[]      = {EIO};
+    static const char *const error_names[] = {"EIO"};
+#elif defined(__FreeBSD__)
+    static const int         errors[]      = {EIO};
+    static const char *const error_names[] = {"EIO"};
+#else
+    static const int         errors[]      = {EIO};
+    static const char *const error_names[] = {"EIO"};
+#endif
+
+    for(size_t index = 0U; index < sizeof(errors) / sizeof(errors[0]); index++)
+    {
+        struct fault_state state = {0, errors[index]};
+        int                failures_before;
+
+        failures_before = failures;
+        EXPECT(p101_error_has_no_error(err));
+        fault_resource_events = 0U;
+        errno                 = P101_TEST_ERRNO_SENTINEL;
+        p101_env_set_fault_injector(env, fail_next_call, &state);
+        long long result = p101_parse_negative_long_long_n(env, err, NULL, 0, 0);
+        (void)result;
+        EXPECT(state.checks == 1);
+        EXPECT(p101_error_is_errno(err, state.code));
+        EXPECT(errno == P101_TEST_ERRNO_SENTINEL);
+        EXPECT(result == (0));
+        EXPECT(fault_resource_events == 0U);
+        write_outcome("p101_parse_negative_long_long_n", "errno", error_names[index], state.code, failures == failures_before);
+        p101_error_reset(err);
+    }
+    p101_env_set_fault_injector(env, NULL, NULL);
+    {
+        int   native_status = 0;
+        pid_t native_pid    = fork();
+
+        EXPECT(native_pid >= 0);
+        if(native_pid == 0)
+        {
+            bool               native_passed = true;
+            struct p101_error *native_err    = NULL;
+            struct p101_env   *native_env    = NULL;
+            FILE              *native_stdin_result;
+
+            native_child_process = true;
+            failures             = 0;
+            (void)alarm(2U);
+            if(unsetenv("P101_CALL_LOG") != 0 || unsetenv("P101_RESOURCE_LOG") != 0)
+            {
+                fprintf(stderr, "native setup failed: cannot clear p101 logging environment\n");
+                native_child_status = 77;
+                goto native_child_done_;
+            }
+            native_stdin_result = freopen("/dev/null", "r", stdin);
+            if(native_stdin_result == NULL)
+            {
+                fprintf(stderr, "native setup failed: cannot make standard input deterministic\n");
+                native_child_status = 77;
+                goto native_child_done_;
+            }
+            native_err = p101_error_create(false);
+            if(native_err == NULL)
+            {
+                native_child_status = 77;
+                goto native_child_done_;
+            }
+            native_env = p101_env_create(native_err, NULL);
+            if(native_env == NULL)
+            {
+                native_child_status = 77;
+                goto native_child_done_;
+            }
+            long long native_result = p101_parse_negative_long_long_n(native_env, native_err, "-1", 2, 0);
+            (void)native_result;
+            if(p101_error_has_error(native_err))
+            {
+                bool native_error_declared = false;
+
+                for(size_t native_error_index = 0U; native_error_index < sizeof(errors) / sizeof(errors[0]); native_error_index++)
+                {
+                    if(p101_error_is_errno(native_err, errors[native_error_index]))
+                    {
+                        native_error_declared = true;
+                    }
+                }
+                if(!native_error_declared)
+                {
+                    fprintf(stderr, "native smoke produced an undeclared platform failure: p101_parse_negative_long_long_n: %s\n", p101_error_get_message(native_err));
+                    native_passed = false;
+                }
+                p101_error_reset(native_err);
+            }
+            native_child_status = native_passed ? EXIT_SUCCESS : EXIT_FAILURE;
+        native_child_done_:
+            p101_env_destroy(native_env);
+            p101_error_destroy(native_err);
+        }
+        if(native_pid > 0)
+        {
+            EXPECT(native_waitpid_nointr(native_pid, &native_status) == native_pid);
+            if(WIFSIGNALED(native_status))
+            {
+                fprintf(stderr, "native smoke terminated by signal: p101_parse_negative_long_long_n: %d\n", WTERMSIG(native_status));
+            }
+            EXPECT(WIFEXITED(native_status));
+            if(WIFEXITED(native_status) && WEXITSTATUS(native_status) == 77)
+            {
+                fprintf(stderr, "native smoke fixture unavailable: p101_parse_negative_long_long_n\n");
+            }
+            else if(WIFEXITED(native_status))
+            {
+                if(WEXITSTATUS(native_status) != EXIT_SUCCESS)
+                {
+                    fprintf(stderr, "native smoke exited unsuccessfully: p101_parse_negative_long_long_n: %d\n", WEXITSTATUS(native_status));
+                }
+                EXPECT(WEXITSTATUS(native_status) == EXIT_SUCCESS);
+            }
+        }
+        p101_error_reset(err);
+    }
+}
+
+/* P101_TEST_CASE(p101_parse_negative_long_long_prefix) */
+static void test_p101_parse_negative_long_long_prefix(struct p101_env *env, struct p101_error *err)
+{
+#ifdef __linux__
+    static const int         errors[]      = {EIO};
+    static const char *const error_names[] = {"EIO"};
+#elif defined(__APPLE__)
+    static const int         errors[]      = {EIO};
+    static const char *const error_names[] = {"EIO"};
+#elif defined(__FreeBSD__)
+    static const int         errors[]      = {EIO};
+    static const char *const error_names[] = {"EIO"};
+#else
+    static const int         errors[]      = {EIO};
+    static const char *const error_names[] = {"EIO"};
+#endif
+
+    for(size_t index = 0U; index < sizeof(errors) / sizeof(errors[0]); index++)
+    {
+        struct fault_state state = {0, errors[index]};
+        int                failures_before;
+
+        failures_before = failures;
+        EXPECT(p101_error_has_no_error(err));
+        fault_resource_events = 0U;
+        errno                 = P101_TEST_ERRNO_SENTINEL;
+        p101_env_set_fault_injector(env, fail_next_call, &state);
+        long long result = p101_parse_negative_long_long_prefix(env, err, NULL, NULL, 0);
+        (void)result;
+        EXPECT(state.checks == 1);
+        EXPECT(p101_error_is_errno(err, state.code));
+        EXPECT(errno == P101_TEST_ERRNO_SENTINEL);
+        EXPECT(result == (0));
+        EXPECT(fault_resource_events == 0U);
+        write_outcome("p101_parse_negative_long_long_prefix", "errno", error_names[index], state.code, failures == failures_before);
+        p101_error_reset(err);
+    }
+    p101_env_set_fault_injector(env, NULL, NULL);
+    {
+        int   native_status = 0;
+        pid_t native_pid    = fork();
+
+        EXPECT(native_pid >= 0);
+        if(native_pid == 0)
+        {
+            bool               native_passed = true;
+            struct p101_error *native_err    = NULL;
+            struct p101_env   *native_env    = NULL;
+            FILE              *native_stdin_result;
+
+            native_child_process = true;
+            failures             = 0;
+            (void)alarm(2U);
+            if(unsetenv("P101_CALL_LOG") != 0 || unsetenv("P101_RESOURCE_LOG") != 0)
+            {
+                fprintf(stderr, "native setup failed: cannot clear p101 logging environment\n");
+                native_child_status = 77;
+                goto native_child_done_;
+            }
+            native_stdin_result = freopen("/dev/null", "r", stdin);
+            if(native_stdin_result == NULL)
+            {
+                fprintf(stderr, "native setup failed: cannot make standard input deterministic\n");
+                native_child_status = 77;
+                goto native_child_done_;
+            }
+            native_err = p101_error_create(false);
+            if(native_err == NULL)
+            {
+                native_child_status = 77;
+                goto native_child_done_;
+            }
+            native_env = p101_env_create(native_err, NULL);
+            if(native_env == NULL)
+            {
+                native_child_status = 77;
+                goto native_child_done_;
+            }
+            const char *native_argument_3 = NULL;
+            long long   native_result     = p101_parse_negative_long_long_prefix(native_env, native_err, "-1", &native_argument_3, 0);
+            (void)native_result;
+            if(p101_error_has_error(native_err))
+            {
+                bool native_error_declared = false;
+
+                for(size_t native_error_index = 0U; native_error_index < sizeof(errors) / sizeof(errors[0]); native_error_index++)
+                {
+                    if(p101_error_is_errno(native_err, errors[native_error_index]))
+                    {
+                        native_error_declared = true;
+                    }
+                }
+                if(!native_error_declared)
+                {
+                    fprintf(stderr, "native smoke produced an undeclared platform failure: p101_parse_negative_long_long_prefix: %s\n", p101_error_get_message(native_err));
+                    native_passed = false;
+                }
+                p101_error_reset(native_err);
+            }
+            native_child_status = native_passed ? EXIT_SUCCESS : EXIT_FAILURE;
+        native_child_done_:
+            p101_env_destroy(native_env);
+            p101_error_destroy(native_err);
+        }
+        if(native_pid > 0)
+        {
+            EXPECT(native_waitpid_nointr(native_pid, &native_status) == native_pid);
+            if(WIFSIGNALED(native_status))
+            {
+                fprintf(stderr, "native smoke terminated by signal: p101_parse_negative_long_long_prefix: %d\n", WTERMSIG(native_status));
+            }
+            EXPECT(WIFEXITED(native_status));
+            if(WIFEXITED(native_status) && WEXITSTATUS(native_status) == 77)
+            {
+                fprintf(stderr, "native smoke fixture unavailable: p101_parse_negative_long_long_prefix\n");
+            }
+            else if(WIFEXITED(native_status))
+            {
+                if(WEXITSTATUS(native_status) != EXIT_SUCCESS)
+                {
+                    fprintf(stderr, "native smoke exited unsuccessfully: p101_parse_negative_long_long_prefix: %d\n", WEXITSTATUS(native_status));
+                }
+                EXPECT(WEXITSTATUS(native_status) == EXIT_SUCCESS);
+            }
+        }
+        p101_error_reset(err);
+    }
+}
+
+/* P101_TEST_CASE(p101_parse_negative_long_n) */
+static void test_p101_parse_negative_long_n(struct p101_env *env, struct p101_error *err)
+{
+#ifdef __linux__
+    static const int         errors[]      = {EIO};
+    static const char *const error_names[] = {"EIO"};
+#elif defined(__APPLE__)
+    static const int         errors[]      = {EIO};
+    static const char *const error_names[] = {"EIO"};
+#elif defined(__FreeBSD__)
+    static const int         errors[]      = {EIO};
+    static const char *const error_names[] = {"EIO"};
+#else
+    static const int         errors[]      = {EIO};
+    static const char *const error_names[] = {"EIO"};
+#endif
+
+    for(size_t index = 0U; index < sizeof(errors) / sizeof(errors[0]); index++)
+    {
+        struct fault_state state = {0, errors[index]};
+        int                failures_before;
+
+        failures_before = failures;
+        EXPECT(p101_error_has_no_error(err));
+        fault_resource_events = 0U;
+        errno                 = P101_TEST_ERRNO_SENTINEL;
+        p101_env_set_fault_injector(env, fail_next_call, &state);
+        long result = p101_parse_negative_long_n(env, err, NULL, 0, 0);
+        (void)result;
+        EXPECT(state.checks == 1);
+        EXPECT(p101_error_is_errno(err, state.code));
+        EXPECT(errno == P101_TEST_ERRNO_SENTINEL);
+        EXPECT(result == (0));
+        EXPECT(fault_resource_events == 0U);
+        write_outcome("p101_parse_negative_long_n", "errno", error_names[index], state.code, failures == failures_before);
+        p101_error_reset(err);
+    }
+    p101_env_set_fault_injector(env, NULL, NULL);
+    {
+        int   native_status = 0;
+        pid_t native_pid    = fork();
+
+        EXPECT(native_pid >= 0);
+        if(native_pid == 0)
+        {
+            bool               native_passed = true;
+            struct p101_error *native_err    = NULL;
+            struct p101_env   *native_env    = NULL;
+            FILE              *native_stdin_result;
+
+            native_child_process = true;
+            failures             = 0;
+            (void)alarm(2U);
+            if(unsetenv("P101_CALL_LOG") != 0 || unsetenv("P101_RESOURCE_LOG") != 0)
+            {
+                fprintf(stderr, "native setup failed: cannot clear p101 logging environment\n");
+                native_child_status = 77;
+                goto native_child_done_;
+            }
+            native_stdin_result = freopen("/dev/null", "r", stdin);
+            if(native_stdin_result == NULL)
+            {
+                fprintf(stderr, "native setup failed: cannot make standard input deterministic\n");
+                native_child_status = 77;
+                goto native_child_done_;
+            }
+            native_err = p101_error_create(false);
+            if(native_err == NULL)
+            {
+                native_child_status = 77;
+                goto native_child_done_;
+            }
+            native_env = p101_env_create(native_err, NULL);
+            if(native_env == NULL)
+            {
+                native_child_status = 77;
+                goto native_child_done_;
+            }
+            long native_result = p101_parse_negative_long_n(native_env, native_err, "-1", 2, 0);
+            (void)native_result;
+            if(p101_error_has_error(native_err))
+            {
+                bool native_error_declared = false;
+
+                for(size_t native_error_index = 0U; native_error_index < sizeof(errors) / sizeof(errors[0]); native_error_index++)
+                {
+                    if(p101_error_is_errno(native_err, errors[native_error_index]))
+                    {
+                        native_error_declared = true;
+                    }
+                }
+                if(!native_error_declared)
+                {
+                    fprintf(stderr, "native smoke produced an undeclared platform failure: p101_parse_negative_long_n: %s\n", p101_error_get_message(native_err));
+                    native_passed = false;
+                }
+                p101_error_reset(native_err);
+            }
+            native_child_status = native_passed ? EXIT_SUCCESS : EXIT_FAILURE;
+        native_child_done_:
+            p101_env_destroy(native_env);
+            p101_error_destroy(native_err);
+        }
+        if(native_pid > 0)
+        {
+            EXPECT(native_waitpid_nointr(native_pid, &native_status) == native_pid);
+            if(WIFSIGNALED(native_status))
+            {
+                fprintf(stderr, "native smoke terminated by signal: p101_parse_negative_long_n: %d\n", WTERMSIG(native_status));
+            }
+            EXPECT(WIFEXITED(native_status));
+            if(WIFEXITED(native_status) && WEXITSTATUS(native_status) == 77)
+            {
+                fprintf(stderr, "native smoke fixture unavailable: p101_parse_negative_long_n\n");
+            }
+            else if(WIFEXITED(native_status))
+            {
+                if(WEXITSTATUS(native_status) != EXIT_SUCCESS)
+                {
+                    fprintf(stderr, "native smoke exited unsuccessfully: p101_parse_negative_long_n: %d\n", WEXITSTATUS(native_status));
+                }
+                EXPECT(WEXITSTATUS(native_status) == EXIT_SUCCESS);
+            }
+        }
+        p101_error_reset(err);
+    }
+}
+
+/* P101_TEST_CASE(p101_parse_negative_long_prefix) */
+static void test_p101_parse_negative_long_prefix(struct p101_env *env, struct p101_error *err)
+{
+#ifdef __linux__
+    static const int         errors[]      = {EIO};
+    static const char *const error_names[] = {"EIO"};
+#elif defined(__APPLE__)
+    static const int         errors[]      = {EIO};
+    static const char *const error_names[] = {"EIO"};
+#elif defined(__FreeBSD__)
+    static const int         errors[]      = {EIO};
+    static const char *const error_names[] = {"EIO"};
+#else
+    static const int         errors[]      = {EIO};
+    static const char *const error_names[] = {"EIO"};
+#endif
+
+    for(size_t index = 0U; index < sizeof(errors) / sizeof(errors[0]); index++)
+    {
+        struct fault_state state = {0, errors[index]};
+        int                failures_before;
+
+        failures_before = failures;
+        EXPECT(p101_error_has_no_error(err));
+        fault_resource_events = 0U;
+        errno                 = P101_TEST_ERRNO_SENTINEL;
+        p101_env_set_fault_injector(env, fail_next_call, &state);
+        long result = p101_parse_negative_long_prefix(env, err, NULL, NULL, 0);
+        (void)result;
+        EXPECT(state.checks == 1);
+        EXPECT(p101_error_is_errno(err, state.code));
+        EXPECT(errno == P101_TEST_ERRNO_SENTINEL);
+        EXPECT(result == (0));
+        EXPECT(fault_resource_events == 0U);
+        write_outcome("p101_parse_negative_long_prefix", "errno", error_names[index], state.code, failures == failures_before);
+        p101_error_reset(err);
+    }
+    p101_env_set_fault_injector(env, NULL, NULL);
+    {
+        int   native_status = 0;
+        pid_t native_pid    = fork();
+
+        EXPECT(native_pid >= 0);
+        if(native_pid == 0)
+        {
+            bool               native_passed = true;
+            struct p101_error *native_err    = NULL;
+            struct p101_env   *native_env    = NULL;
+            FILE              *native_stdin_result;
+
+            native_child_process = true;
+            failures             = 0;
+            (void)alarm(2U);
+            if(unsetenv("P101_CALL_LOG") != 0 || unsetenv("P101_RESOURCE_LOG") != 0)
+            {
+                fprintf(stderr, "native setup failed: cannot clear p101 logging environment\n");
+                native_child_status = 77;
+                goto native_child_done_;
+            }
+            native_stdin_result = freopen("/dev/null", "r", stdin);
+            if(native_stdin_result == NULL)
+            {
+                fprintf(stderr, "native setup failed: cannot make standard input deterministic\n");
+                native_child_status = 77;
+                goto native_child_done_;
+            }
+            native_err = p101_error_create(false);
+            if(native_err == NULL)
+            {
+                native_child_status = 77;
+                goto native_child_done_;
+            }
+            native_env = p101_env_create(native_err, NULL);
+            if(native_env == NULL)
+            {
+                native_child_status = 77;
+                goto native_child_done_;
+            }
+            const char *native_argument_3 = NULL;
+            long        native_result     = p101_parse_negative_long_prefix(native_env, native_err, "-1", &native_argument_3, 0);
+            (void)native_result;
+            if(p101_error_has_error(native_err))
+            {
+                bool native_error_declared = false;
+
+                for(size_t native_error_index = 0U; native_error_index < sizeof(errors) / sizeof(errors[0]); native_error_index++)
+                {
+                    if(p101_error_is_errno(native_err, errors[native_error_index]))
+                    {
+                        native_error_declared = true;
+                    }
+                }
+                if(!native_error_declared)
+                {
+                    fprintf(stderr, "native smoke produced an undeclared platform failure: p101_parse_negative_long_prefix: %s\n", p101_error_get_message(native_err));
+                    native_passed = false;
+                }
+                p101_error_reset(native_err);
+            }
+            native_child_status = native_passed ? EXIT_SUCCESS : EXIT_FAILURE;
+        native_child_done_:
+            p101_env_destroy(native_env);
+            p101_error_destroy(native_err);
+        }
+        if(native_pid > 0)
+        {
+            EXPECT(native_waitpid_nointr(native_pid, &native_status) == native_pid);
+            if(WIFSIGNALED(native_status))
+            {
+                fprintf(stderr, "native smoke terminated by signal: p101_parse_negative_long_prefix: %d\n", WTERMSIG(native_status));
+            }
+            EXPECT(WIFEXITED(native_status));
+            if(WIFEXITED(native_status) && WEXITSTATUS(native_status) == 77)
+            {
+                fprintf(stderr, "native smoke fixture unavailable: p101_parse_negative_long_prefix\n");
+            }
+            else if(WIFEXITED(native_status))
+            {
+                if(WEXITSTATUS(native_status) != EXIT_SUCCESS)
+                {
+                    fprintf(stderr, "native smoke exited unsuccessfully: p101_parse_negative_long_prefix: %d\n", WEXITSTATUS(native_status));
+                }
+                EXPECT(WEXITSTATUS(native_status) == EXIT_SUCCESS);
+            }
+        }
+        p101_error_reset(err);
+    }
+}
+
+/* P101_TEST_CASE(p101_parse_negative_short) */
+static void test_p101_parse_negative_short(struct p101_env *env, struct p101_error *err)
+{
+#ifdef __linux__
+    static const int         errors[]      = {EIO};
+    static const char *const error_names[] = {"EIO"};
+#elif defined(__APPLE__)
+    static const int         errors[]      = {EIO};
+    static const char *const error_names[] = {"EIO"};
+#elif defined(__FreeBSD__)
+    static const int         errors[]      = {EIO};
+    static const char *const error_names[] = {"EIO"};
+#else
+    static const int         errors[]      = {EIO};
+    static const char *const error_names[] = {"EIO"};
+#endif
+
+    for(size_t index = 0U; index < sizeof(errors) / sizeof(errors[0]); index++)
+    {
+        struct fault_state state = {0, errors[index]};
+        int                failures_before;
+
+        failures_before = failures;
+        EXPECT(p101_error_has_no_error(err));
+        fault_resource_events = 0U;
+        errno                 = P101_TEST_ERRNO_SENTINEL;
+        p101_env_set_fault_injector(env, fail_next_call, &state);
+        short result = p101_parse_negative_short(env, err, NULL, 0);
+        (void)result;
+        EXPECT(state.checks == 1);
+        EXPECT(p101_error_is_errno(err, state.code));
+        EXPECT(errno == P101_TEST_ERRNO_SENTINEL);
+        EXPECT(result == (0));
+        EXPECT(fault_resource_events == 0U);
+        write_outcome("p101_parse_negative_short", "errno", error_names[index], state.code, failures == failures_before);
+        p101_error_reset(err);
+    }
+    p101_env_set_fault_injector(env, NULL, NULL);
+    {
+        int   native_status = 0;
+        pid_t native_pid    = fork();
+
+        EXPECT(native_pid >= 0);
+        if(native_pid == 0)
+        {
+            bool               native_passed = true;
+            struct p101_error *native_err    = NULL;
+            struct p101_env   *native_env    = NULL;
+            FILE              *native_stdin_result;
+
+            native_child_process = true;
+            failures             = 0;
+            (void)alarm(2U);
+            if(unsetenv("P101_CALL_LOG") != 0 || unsetenv("P101_RESOURCE_LOG") != 0)
+            {
+                fprintf(stderr, "native setup failed: cannot clear p101 logging environment\n");
+                native_child_status = 77;
+                goto native_child_done_;
+            }
+            native_stdin_result = freopen("/dev/null", "r", stdin);
+            if(native_stdin_result == NULL)
+            {
+                fprintf(stderr, "native setup failed: cannot make standard input deterministic\n");
+                native_child_status = 77;
+                goto native_child_done_;
+            }
+            native_err = p101_error_create(false);
+            if(native_err == NULL)
+            {
+                native_child_status = 77;
+                goto native_child_done_;
+            }
+            native_env = p101_env_create(native_err, NULL);
+            if(native_env == NULL)
+            {
+                native_child_status = 77;
+                goto native_child_done_;
+            }
+            short native_result = p101_parse_negative_short(native_env, native_err, "-1", 0);
+            (void)native_result;
+            if(p101_error_has_error(native_err))
+            {
+                bool native_error_declared = false;
+
+                for(size_t native_error_index = 0U; native_error_index < sizeof(errors) / sizeof(errors[0]); native_error_index++)
+                {
+                    if(p101_error_is_errno(native_err, errors[native_error_index]))
+                    {
+                        native_error_declared = true;
+                    }
+                }
+                if(!native_error_declared)
+                {
+                    fprintf(stderr, "native smoke produced an undeclared platform failure: p101_parse_negative_short: %s\n", p101_error_get_message(native_err));
+                    native_passed = false;
+                }
+                p101_error_reset(native_err);
+            }
+            native_child_status = native_passed ? EXIT_SUCCESS : EXIT_FAILURE;
+        native_child_done_:
+            p101_env_destroy(native_env);
+            p101_error_destroy(native_err);
+        }
+        if(native_pid > 0)
+        {
+            EXPECT(native_waitpid_nointr(native_pid, &native_status) == native_pid);
+            if(WIFSIGNALED(native_status))
+            {
+                fprintf(stderr, "native smoke terminated by signal: p101_parse_negative_short: %d\n", WTERMSIG(native_status));
+            }
+            EXPECT(WIFEXITED(native_status));
+            if(WIFEXITED(native_status) && WEXITSTATUS(native_status) == 77)
+            {
+                fprintf(stderr, "native smoke fixture unavailable: p101_parse_negative_short\n");
+            }
+            else if(WIFEXITED(native_status))
+            {
+                if(WEXITSTATUS(native_status) != EXIT_SUCCESS)
+                {
+                    fprintf(stderr, "native smoke exited unsuccessfully: p101_parse_negative_short: %d\n", WEXITSTATUS(native_status));
+                }
+                EXPECT(WEXITSTATUS(native_status) == EXIT_SUCCESS);
+            }
+        }
+        p101_error_reset(err);
+    }
+}
+
+/* P101_TEST_CASE(p101_parse_negative_short_n) */
+static void test_p101_parse_negative_short_n(struct p101_env *env, struct p101_error *err)
+{
+#ifdef __linux__
+    static const int         errors[]      = {EIO};
+    static const char *const error_names[] = {"EIO"};
+#elif defined(__APPLE__)
+    static const int         errors[]      = {EIO};
+    static const char *const error_names[] = {"EIO"};
+#elif defined(__FreeBSD__)
+    static const int         errors[]      = {EIO};
+    static const char *const error_names[] = {"EIO"};
+#else
+    static const int         errors[]      = {EIO};
+    static const char *const error_names[] = {"EIO"};
+#endif
+
+    for(size_t index = 0U; index < sizeof(errors) / sizeof(errors[0]); index++)
+    {
+        struct fault_state state = {0, errors[index]};
+        int                failures_before;
+
+        failures_before = failures;
+        EXPECT(p101_error_has_no_error(err));
+        fault_resource_events = 0U;
+        errno                 = P101_TEST_ERRNO_SENTINEL;
+        p101_env_set_fault_injector(env, fail_next_call, &state);
+        short result = p101_parse_negative_short_n(env, err, NULL, 0, 0);
+        (void)result;
+        EXPECT(state.checks == 1);
+        EXPECT(p101_error_is_errno(err, state.code));
+        EXPECT(errno == P101_TEST_ERRNO_SENTINEL);
+        EXPECT(result == (0));
+        EXPECT(fault_resource_events == 0U);
+        write_outcome("p101_parse_negative_short_n", "errno", error_names[index], state.code, failures == failures_before);
+        p101_error_reset(err);
+    }
+    p101_env_set_fault_injector(env, NULL, NULL);
+    {
+        int   native_status = 0;
+        pid_t native_pid    = fork();
+
+        EXPECT(native_pid >= 0);
+        if(native_pid == 0)
+        {
+            bool               native_passed = true;
+            struct p101_error *native_err    = NULL;
+            struct p101_env   *native_env    = NULL;
+            FILE              *native_stdin_result;
+
+            native_child_process = true;
+            failures             = 0;
+            (void)alarm(2U);
+            if(unsetenv("P101_CALL_LOG") != 0 || unsetenv("P101_RESOURCE_LOG") != 0)
+            {
+                fprintf(stderr, "native setup failed: cannot clear p101 logging environment\n");
+                native_child_status = 77;
+                goto native_child_done_;
+            }
+            native_stdin_result = freopen("/dev/null", "r", stdin);
+            if(native_stdin_result == NULL)
+            {
+                fprintf(stderr, "native setup failed: cannot make standard input deterministic\n");
+                native_child_status = 77;
+                goto native_child_done_;
+            }
+            native_err = p101_error_create(false);
+            if(native_err == NULL)
+            {
+                native_child_status = 77;
+                goto native_child_done_;
+            }
+            native_env = p101_env_create(native_err, NULL);
+            if(native_env == NULL)
+            {
+                native_child_status = 77;
+                goto native_child_done_;
+            }
+            short native_result = p101_parse_negative_short_n(native_env, native_err, "-1", 2, 0);
+            (void)native_result;
+            if(p101_error_has_error(native_err))
+            {
+                bool native_error_declared = false;
+
+                for(size_t native_error_index = 0U; native_error_index < sizeof(errors) / sizeof(errors[0]); native_error_index++)
+                {
+                    if(p101_error_is_errno(native_err, errors[native_error_index]))
+                    {
+                        native_error_declared = true;
+                    }
+                }
+                if(!native_error_declared)
+                {
+                    fprintf(stderr, "native smoke produced an undeclared platform failure: p101_parse_negative_short_n: %s\n", p101_error_get_message(native_err));
+                    native_passed = false;
+                }
+                p101_error_reset(native_err);
+            }
+            native_child_status = native_passed ? EXIT_SUCCESS : EXIT_FAILURE;
+        native_child_done_:
+            p101_env_destroy(native_env);
+            p101_error_destroy(native_err);
+        }
+        if(native_pid > 0)
+        {
+            EXPECT(native_waitpid_nointr(native_pid, &native_status) == native_pid);
+            if(WIFSIGNALED(native_status))
+            {
+                fprintf(stderr, "native smoke terminated by signal: p101_parse_negative_short_n: %d\n", WTERMSIG(native_status));
+            }
+            EXPECT(WIFEXITED(native_status));
+            if(WIFEXITED(native_status) && WEXITSTATUS(native_status) == 77)
+            {
+                fprintf(stderr, "native smoke fixture unavailable: p101_parse_negative_short_n\n");
+            }
+            else if(WIFEXITED(native_status))
+            {
+                if(WEXITSTATUS(native_status) != EXIT_SUCCESS)
+                {
+                    fprintf(stderr, "native smoke exited unsuccessfully: p101_parse_negative_short_n: %d\n", WEXITSTATUS(native_status));
+                }
+                EXPECT(WEXITSTATUS(native_status) == EXIT_SUCCESS);
+            }
+        }
+        p101_error_reset(err);
+    }
+}
+
+/* P101_TEST_CASE(p101_parse_negative_short_prefix) */
+static void test_p101_parse_negative_short_prefix(struct p101_env *env, struct p101_error *err)
+{
+#ifdef __linux__
+    static const int         errors[]      = {EIO};
+    static const char *const error_names[] = {"EIO"};
+#elif defined(__APPLE__)
+    static const int         errors[]      = {EIO};
+    static const char *const error_names[] = {"EIO"};
+#elif defined(__FreeBSD__)
+    static const int         errors[]      = {EIO};
+    static const char *const error_names[] = {"EIO"};
+#else
+    static const int         errors[]      = {EIO};
+    static const char *const error_names[] = {"EIO"};
+#endif
+
+    for(size_t index = 0U; index < sizeof(errors) / sizeof(errors[0]); index++)
+    {
+        struct fault_state state = {0, errors[index]};
+        int                failures_before;
+
+        failures_before = failures;
+        EXPECT(p101_error_has_no_error(err));
+        fault_resource_events = 0U;
+        errno                 = P101_TEST_ERRNO_SENTINEL;
+        p101_env_set_fault_injector(env, fail_next_call, &state);
+        short result = p101_parse_negative_short_prefix(env, err, NULL, NULL, 0);
+        (void)result;
+        EXPECT(state.checks == 1);
+        EXPECT(p101_error_is_errno(err, state.code));
+        EXPECT(errno == P101_TEST_ERRNO_SENTINEL);
+        EXPECT(result == (0));
+        EXPECT(fault_resource_events == 0U);
+        write_outcome("p101_parse_negative_short_prefix", "errno", error_names[index], state.code, failures == failures_before);
+        p101_error_reset(err);
+    }
+    p101_env_set_fault_injector(env, NULL, NULL);
+    {
+        int   native_status = 0;
+        pid_t native_pid    = fork();
+
+        EXPECT(native_pid >= 0);
+        if(native_pid == 0)
+        {
+            bool               native_passed = true;
+            struct p101_error *native_err    = NULL;
+            struct p101_env   *native_env    = NULL;
+            FILE              *native_stdin_result;
+
+            native_child_process = true;
+            failures             = 0;
+            (void)alarm(2U);
+            if(unsetenv("P101_CALL_LOG") != 0 || unsetenv("P101_RESOURCE_LOG") != 0)
+            {
+                fprintf(stderr, "native setup failed: cannot clear p101 logging environment\n");
+                native_child_status = 77;
+                goto native_child_done_;
+            }
+            native_stdin_result = freopen("/dev/null", "r", stdin);
+            if(native_stdin_result == NULL)
+            {
+                fprintf(stderr, "native setup failed: cannot make standard input deterministic\n");
+                native_child_status = 77;
+                goto native_child_done_;
+            }
+            native_err = p101_error_create(false);
+            if(native_err == NULL)
+            {
+                native_child_status = 77;
+                goto native_child_done_;
+            }
+            native_env = p101_env_create(native_err, NULL);
+            if(native_env == NULL)
+            {
+                native_child_status = 77;
+                goto native_child_done_;
+            }
+            const char *native_argument_3 = NULL;
+            short       native_result     = p101_parse_negative_short_prefix(native_env, native_err, "-1", &native_argument_3, 0);
+            (void)native_result;
+            if(p101_error_has_error(native_err))
+            {
+                bool native_error_declared = false;
+
+                for(size_t native_error_index = 0U; native_error_index < sizeof(errors) / sizeof(errors[0]); native_error_index++)
+                {
+                    if(p101_error_is_errno(native_err, errors[native_error_index]))
+                    {
+                        native_error_declared = true;
+                    }
+                }
+                if(!native_error_declared)
+                {
+                    fprintf(stderr, "native smoke produced an undeclared platform failure: p101_parse_negative_short_prefix: %s\n", p101_error_get_message(native_err));
+                    native_passed = false;
+                }
+                p101_error_reset(native_err);
+            }
+            native_child_status = native_passed ? EXIT_SUCCESS : EXIT_FAILURE;
+        native_child_done_:
+            p101_env_destroy(native_env);
+            p101_error_destroy(native_err);
+        }
+        if(native_pid > 0)
+        {
+            EXPECT(native_waitpid_nointr(native_pid, &native_status) == native_pid);
+            if(WIFSIGNALED(native_status))
+            {
+                fprintf(stderr, "native smoke terminated by signal: p101_parse_negative_short_prefix: %d\n", WTERMSIG(native_status));
+            }
+            EXPECT(WIFEXITED(native_status));
+            if(WIFEXITED(native_status) && WEXITSTATUS(native_status) == 77)
+            {
+                fprintf(stderr, "native smoke fixture unavailable: p101_parse_negative_short_prefix\n");
+            }
+            else if(WIFEXITED(native_status))
+            {
+                if(WEXITSTATUS(native_status) != EXIT_SUCCESS)
+                {
+                    fprintf(stderr, "native smoke exited unsuccessfully: p101_parse_negative_short_prefix: %d\n", WEXITSTATUS(native_status));
+                }
+                EXPECT(WEXITSTATUS(native_status) == EXIT_SUCCESS);
+            }
+        }
+        p101_error_reset(err);
+    }
+}
+
+/* P101_TEST_CASE(p101_parse_positive_char) */
+static void test_p101_parse_positive_char(struct p101_env *env, struct p101_error *err)
+{
+#ifdef __linux__
+    static const int         errors[]      = {EIO};
+    static const char *const error_names[] = {"EIO"};
+#elif defined(__APPLE__)
+    static const int         errors[]      = {EIO};
+    static const char *const error_names[] = {"EIO"};
+#elif defined(__FreeBSD__)
+    static const int         errors[]      = {EIO};
+    static const char *const error_names[] = {"EIO"};
+#else
+    static const int         errors[]      = {EIO};
+    static const char *const error_names[] = {"EIO"};
+#endif
+
+    for(size_t index = 0U; index < sizeof(errors) / sizeof(errors[0]); index++)
+    {
+        struct fault_state state = {0, errors[index]};
+        int                failures_before;
+
+        failures_before = failures;
+        EXPECT(p101_error_has_no_error(err));
+        fault_resource_events = 0U;
+        errno                 = P101_TEST_ERRNO_SENTINEL;
+        p101_env_set_fault_injector(env, fail_next_call, &state);
+        char result = p101_parse_positive_char(env, err, NULL, 0);
+        (void)result;
+        EXPECT(state.checks == 1);
+        EXPECT(p101_error_is_errno(err, state.code));
+        EXPECT(errno == P101_TEST_ERRNO_SENTINEL);
+        EXPECT(result == (0));
+        EXPECT(fault_resource_events == 0U);
+        write_outcome("p101_parse_positive_char", "errno", error_names[index], state.code, failures == failures_before);
+        p101_error_reset(err);
+    }
+    p101_env_set_fault_injector(env, NULL, NULL);
+    {
+        int   native_status = 0;
+        pid_t native_pid    = fork();
+
+        EXPECT(native_pid >= 0);
+        if(native_pid == 0)
+        {
+            bool               native_passed = true;
+            struct p101_error *native_err    = NULL;
+            struct p101_env   *native_env    = NULL;
+            FILE              *native_stdin_result;
+
+            native_child_process = true;
+            failures             = 0;
+            (void)alarm(2U);
+            if(unsetenv("P101_CALL_LOG") != 0 || unsetenv("P101_RESOURCE_LOG") != 0)
+            {
+                fprintf(stderr, "native setup failed: cannot clear p101 logging environment\n");
+                native_child_status = 77;
+                goto native_child_done_;
+            }
+            native_stdin_result = freopen("/dev/null", "r", stdin);
+            if(native_stdin_result == NULL)
+            {
+                fprintf(stderr, "native setup failed: cannot make standard input deterministic\n");
+                native_child_status = 77;
+                goto native_child_done_;
+            }
+            native_err = p101_error_create(false);
+            if(native_err == NULL)
+            {
+                native_child_status = 77;
+                goto native_child_done_;
+            }
+            native_env = p101_env_create(native_err, NULL);
+            if(native_env == NULL)
+            {
+                native_child_status = 77;
+                goto native_child_done_;
+            }
+            char native_result = p101_parse_positive_char(native_env, native_err, "1", 0);
+            (void)native_result;
+            if(p101_error_has_error(native_err))
+            {
+                bool native_error_declared = false;
+
+                for(size_t native_error_index = 0U; native_error_index < sizeof(errors) / sizeof(errors[0]); native_error_index++)
+                {
+                    if(p101_error_is_errno(native_err, errors[native_error_index]))
+                    {
+                        native_error_declared = true;
+                    }
+                }
+                if(!native_error_declared)
+                {
+                    fprintf(stderr, "native smoke produced an undeclared platform failure: p101_parse_positive_char: %s\n", p101_error_get_message(native_err));
+                    native_passed = false;
+                }
+                p101_error_reset(native_err);
+            }
+            native_child_status = native_passed ? EXIT_SUCCESS : EXIT_FAILURE;
+        native_child_done_:
+            p101_env_destroy(native_env);
+            p101_error_destroy(native_err);
+        }
+        if(native_pid > 0)
+        {
+            EXPECT(native_waitpid_nointr(native_pid, &native_status) == native_pid);
+            if(WIFSIGNALED(native_status))
+            {
+                fprintf(stderr, "native smoke terminated by signal: p101_parse_positive_char: %d\n", WTERMSIG(native_status));
+            }
+            EXPECT(WIFEXITED(native_status));
+            if(WIFEXITED(native_status) && WEXITSTATUS(native_status) == 77)
+            {
+                fprintf(stderr, "native smoke fixture unavailable: p101_parse_positive_char\n");
+            }
+            else if(WIFEXITED(native_status))
+            {
+                if(WEXITSTATUS(native_status) != EXIT_SUCCESS)
+                {
+                    fprintf(stderr, "native smoke exited unsuccessfully: p101_parse_positive_char: %d\n", WEXITSTATUS(native_status));
+                }
+                EXPECT(WEXITSTATUS(native_status) == EXIT_SUCCESS);
+            }
+        }
+        p101_error_reset(err);
+    }
+}
+
+/* P101_TEST_CASE(p101_parse_positive_char_n) */
+static void test_p101_parse_positive_char_n(struct p101_env *env, struct p101_error *err)
+{
+#ifdef __linux__
+    static const int         errors[]      = {EIO};
+    static const char *const error_names[] = {"EIO"};
+#elif defined(__APPLE__)
+    static const int         errors[]      = {EIO};
+    static const char *const error_names[] = {"EIO"};
+#elif defined(__FreeBSD__)
+    static const int         errors[]      = {EIO};
+    static const char *const error_names[] = {"EIO"};
+#else
+    static const int         errors[]      = {EIO};
+    static const char *const error_names[] = {"EIO"};
+#endif
+
+    for(size_t index = 0U; index < sizeof(errors) / sizeof(errors[0]); index++)
+    {
+        struct fault_state state = {0, errors[index]};
+        int                failures_before;
+
+        failures_before = failures;
+        EXPECT(p101_error_has_no_error(err));
+        fault_resource_events = 0U;
+        errno                 = P101_TEST_ERRNO_SENTINEL;
+        p101_env_set_fault_injector(env, fail_next_call, &state);
+        char result = p101_parse_positive_char_n(env, err, NULL, 0, 0);
+        (void)result;
+        EXPECT(state.checks == 1);
+        EXPECT(p101_error_is_errno(err, state.code));
+        EXPECT(errno == P101_TEST_ERRNO_SENTINEL);
+        EXPECT(result == (0));
+        EXPECT(fault_resource_events == 0U);
+        write_outcome("p101_parse_positive_char_n", "errno", error_names[index], state.code, failures == failures_before);
+        p101_error_reset(err);
+    }
+    p101_env_set_fault_injector(env, NULL, NULL);
+    {
+        int   native_status = 0;
+        pid_t native_pid    = fork();
+
+        EXPECT(native_pid >= 0);
+        if(native_pid == 0)
+        {
+            bool               native_passed = true;
+            struct p101_error *native_err    = NULL;
+            struct p101_env   *native_env    = NULL;
+            FILE              *native_stdin_result;
+
+            native_child_process = true;
+            failures             = 0;
+            (void)alarm(2U);
+            if(unsetenv("P101_CALL_LOG") != 0 || unsetenv("P101_RESOURCE_LOG") != 0)
+            {
+                fprintf(stderr, "native setup failed: cannot clear p101 logging environment\n");
+                native_child_status = 77;
+                goto native_child_done_;
+            }
+            native_stdin_result = freopen("/dev/null", "r", stdin);
+            if(native_stdin_result == NULL)
+            {
+                fprintf(stderr, "native setup failed: cannot make standard input deterministic\n");
+                native_child_status = 77;
+                goto native_child_done_;
+            }
+            native_err = p101_error_create(false);
+            if(native_err == NULL)
+            {
+                native_child_status = 77;
+                goto native_child_done_;
+            }
+            native_env = p101_env_create(native_err, NULL);
+            if(native_env == NULL)
+            {
+                native_child_status = 77;
+                goto native_child_done_;
+            }
+            char native_result = p101_parse_positive_char_n(native_env, native_err, "1", 1, 0);
+            (void)native_result;
+            if(p101_error_has_error(native_err))
+            {
+                bool native_error_declared = false;
+
+                for(size_t native_error_index = 0U; native_error_index < sizeof(errors) / sizeof(errors[0]); native_error_index++)
+                {
+                    if(p101_error_is_errno(native_err, errors[native_error_index]))
+                    {
+                        native_error_declared = true;
+                    }
+                }
+                if(!native_error_declared)
+                {
+                    fprintf(stderr, "native smoke produced an undeclared platform failure: p101_parse_positive_char_n: %s\n", p101_error_get_message(native_err));
+                    native_passed = false;
+                }
+                p101_error_reset(native_err);
+            }
+            native_child_status = native_passed ? EXIT_SUCCESS : EXIT_FAILURE;
+        native_child_done_:
+            p101_env_destroy(native_env);
+            p101_error_destroy(native_err);
+        }
+        if(native_pid > 0)
+        {
+            EXPECT(native_waitpid_nointr(native_pid, &native_status) == native_pid);
+            if(WIFSIGNALED(native_status))
+            {
+                fprintf(stderr, "native smoke terminated by signal: p101_parse_positive_char_n: %d\n", WTERMSIG(native_status));
+            }
+            EXPECT(WIFEXITED(native_status));
+            if(WIFEXITED(native_status) && WEXITSTATUS(native_status) == 77)
+            {
+                fprintf(stderr, "native smoke fixture unavailable: p101_parse_positive_char_n\n");
+            }
+            else if(WIFEXITED(native_status))
+            {
+                if(WEXITSTATUS(native_status) != EXIT_SUCCESS)
+                {
+                    fprintf(stderr, "native smoke exited unsuccessfully: p101_parse_positive_char_n: %d\n", WEXITSTATUS(native_status));
+                }
+                EXPECT(WEXITSTATUS(native_status) == EXIT_SUCCESS);
+            }
+        }
+        p101_error_reset(err);
+    }
+}
+
+/* P101_TEST_CASE(p101_parse_positive_char_prefix) */
+static void test_p101_parse_positive_char_prefix(struct p101_env *env, struct p101_error *err)
+{
+#ifdef __linux__
+    static const int         errors[]      = {EIO};
+    static const char *const error_names[] = {"EIO"};
+#elif defined(__APPLE__)
+    static const int         errors[]      = {EIO};
+    static const char *const error_names[] = {"EIO"};
+#elif defined(__FreeBSD__)
+    static const int         errors[]      = {EIO};
+    static const char *const error_names[] = {"EIO"};
+#else
+    static const int         errors[]      = {EIO};
+    static const char *const error_names[] = {"EIO"};
+#endif
+
+    for(size_t index = 0U; index < sizeof(errors) / sizeof(errors[0]); index++)
+    {
+        struct fault_state state = {0, errors[index]};
+        int                failures_before;
+
+        failures_before = failures;
+        EXPECT(p101_error_has_no_error(err));
+        fault_resource_events = 0U;
+        errno                 = P101_TEST_ERRNO_SENTINEL;
+        p101_env_set_fault_injector(env, fail_next_call, &state);
+        char result = p101_parse_positive_char_prefix(env, err, NULL, NULL, 0);
+        (void)result;
+        EXPECT(state.checks == 1);
+        EXPECT(p101_error_is_errno(err, state.code));
+        EXPECT(errno == P101_TEST_ERRNO_SENTINEL);
+        EXPECT(result == (0));
+        EXPECT(fault_resource_events == 0U);
+        write_outcome("p101_parse_positive_char_prefix", "errno", error_names[index], state.code, failures == failures_before);
+        p101_error_reset(err);
+    }
+    p101_env_set_fault_injector(env, NULL, NULL);
+    {
+        int   native_status = 0;
+        pid_t native_pid    = fork();
+
+        EXPECT(native_pid >= 0);
+        if(native_pid == 0)
+        {
+            bool               native_passed = true;
+            struct p101_error *native_err    = NULL;
+            struct p101_env   *native_env    = NULL;
+            FILE              *native_stdin_result;
+
+            native_child_process = true;
+            failures             = 0;
+            (void)alarm(2U);
+            if(unsetenv("P101_CALL_LOG") != 0 || unsetenv("P101_RESOURCE_LOG") != 0)
+            {
+                fprintf(stderr, "native setup failed: cannot clear p101 logging environment\n");
+                native_child_status = 77;
+                goto native_child_done_;
+            }
+            native_stdin_result = freopen("/dev/null", "r", stdin);
+            if(native_stdin_result == NULL)
+            {
+                fprintf(stderr, "native setup failed: cannot make standard input deterministic\n");
+                native_child_status = 77;
+                goto native_child_done_;
+            }
+            native_err = p101_error_create(false);
+            if(native_err == NULL)
+            {
+                native_child_status = 77;
+                goto native_child_done_;
+            }
+            native_env = p101_env_create(native_err, NULL);
+            if(native_env == NULL)
+            {
+                native_child_status = 77;
+                goto native_child_done_;
+            }
+            const char *native_argument_3 = NULL;
+            char        native_result     = p101_parse_positive_char_prefix(native_env, native_err, "1", &native_argument_3, 0);
+            (void)native_result;
+            if(p101_error_has_error(native_err))
+            {
+                bool native_error_declared = false;
+
+                for(size_t native_error_index = 0U; native_error_index < sizeof(errors) / sizeof(errors[0]); native_error_index++)
+                {
+                    if(p101_error_is_errno(native_err, errors[native_error_index]))
+                    {
+                        native_error_declared = true;
+                    }
+                }
+                if(!native_error_declared)
+                {
+                    fprintf(stderr, "native smoke produced an undeclared platform failure: p101_parse_positive_char_prefix: %s\n", p101_error_get_message(native_err));
+                    native_passed = false;
+                }
+                p101_error_reset(native_err);
+            }
+            native_child_status = native_passed ? EXIT_SUCCESS : EXIT_FAILURE;
+        native_child_done_:
+            p101_env_destroy(native_env);
+            p101_error_destroy(native_err);
+        }
+        if(native_pid > 0)
+        {
+            EXPECT(native_waitpid_nointr(native_pid, &native_status) == native_pid);
+            if(WIFSIGNALED(native_status))
+            {
+                fprintf(stderr, "native smoke terminated by signal: p101_parse_positive_char_prefix: %d\n", WTERMSIG(native_status));
+            }
+            EXPECT(WIFEXITED(native_status));
+            if(WIFEXITED(native_status) && WEXITSTATUS(native_status) == 77)
+            {
+                fprintf(stderr, "native smoke fixture unavailable: p101_parse_positive_char_prefix\n");
+            }
+            else if(WIFEXITED(native_status))
+            {
+                if(WEXITSTATUS(native_status) != EXIT_SUCCESS)
+                {
+                    fprintf(stderr, "native smoke exited unsuccessfully: p101_parse_positive_char_prefix: %d\n", WEXITSTATUS(native_status));
+                }
+                EXPECT(WEXITSTATUS(native_status) == EXIT_SUCCESS);
+            }
+        }
+        p101_error_reset(err);
+    }
+}
+
+/* P101_TEST_CASE(p101_parse_positive_int) */
+static void test_p101_parse_positive_int(struct p101_env *env, struct p101_error *err)
+{
+#ifdef __linux__
+    static const int         errors[]      = {EIO};
+    static const char *const error_names[] = {"EIO"};
+#elif defined(__APPLE__)
+    static const int         errors[]      = {EIO};
+    static const char *const error_names[] = {"EIO"};
+#elif defined(__FreeBSD__)
+    static const int         errors[]      = {EIO};
+    static const char *const error_names[] = {"EIO"};
+#else
+    static const int         errors[]      = {EIO};
+    static const char *const error_names[] = {"EIO"};
+#endif
+
+    for(size_t index = 0U; index < sizeof(errors) / sizeof(errors[0]); index++)
+    {
+        struct fault_state state = {0, errors[index]};
+        int                failures_before;
+
+        failures_before = failures;
+        EXPECT(p101_error_has_no_error(err));
+        fault_resource_events = 0U;
+        errno                 = P101_TEST_ERRNO_SENTINEL;
+        p101_env_set_fault_injector(env, fail_next_call, &state);
+        int result = p101_parse_positive_int(env, err, NULL, 0);
+        (void)result;
+        EXPECT(state.checks == 1);
+        EXPECT(p101_error_is_errno(err, state.code));
+        EXPECT(errno == P101_TEST_ERRNO_SENTINEL);
+        EXPECT(result == (0));
+        EXPECT(fault_resource_events == 0U);
+        write_outcome("p101_parse_positive_int", "errno", error_names[index], state.code, failures == failures_before);
+        p101_error_reset(err);
+    }
+    p101_env_set_fault_injector(env, NULL, NULL);
+    {
+        int   native_status = 0;
+        pid_t native_pid    = fork();
+
+        EXPECT(native_pid >= 0);
+        if(native_pid == 0)
+        {
+            bool               native_passed = true;
+            struct p101_error *native_err    = NULL;
+            struct p101_env   *native_env    = NULL;
+            FILE              *native_stdin_result;
+
+            native_child_process = true;
+            failures             = 0;
+            (void)alarm(2U);
+            if(unsetenv("P101_CALL_LOG") != 0 || unsetenv("P101_RESOURCE_LOG") != 0)
+            {
+                fprintf(stderr, "native setup failed: cannot clear p101 logging environment\n");
+                native_child_status = 77;
+                goto native_child_done_;
+            }
+            native_stdin_result = freopen("/dev/null", "r", stdin);
+            if(native_stdin_result == NULL)
+            {
+                fprintf(stderr, "native setup failed: cannot make standard input deterministic\n");
+                native_child_status = 77;
+                goto native_child_done_;
+            }
+            native_err = p101_error_create(false);
+            if(native_err == NULL)
+            {
+                native_child_status = 77;
+                goto native_child_done_;
+            }
+            native_env = p101_env_create(native_err, NULL);
+            if(native_env == NULL)
+            {
+                native_child_status = 77;
+                goto native_child_done_;
+            }
+            int native_result = p101_parse_positive_int(native_env, native_err, "1", 0);
+            (void)native_result;
+            if(p101_error_has_error(native_err))
+            {
+                bool native_error_declared = false;
+
+                for(size_t native_error_index = 0U; native_error_index < sizeof(errors) / sizeof(errors[0]); native_error_index++)
+                {
+                    if(p101_error_is_errno(native_err, errors[native_error_index]))
+                    {
+                        native_error_declared = true;
+                    }
+                }
+                if(!native_error_declared)
+                {
+                    fprintf(stderr, "native smoke produced an undeclared platform failure: p101_parse_positive_int: %s\n", p101_error_get_message(native_err));
+                    native_passed = false;
+                }
+                p101_error_reset(native_err);
+            }
+            native_child_status = native_passed ? EXIT_SUCCESS : EXIT_FAILURE;
+        native_child_done_:
+            p101_env_destroy(native_env);
+            p101_error_destroy(native_err);
+        }
+        if(native_pid > 0)
+        {
+            EXPECT(native_waitpid_nointr(native_pid, &native_status) == native_pid);
+            if(WIFSIGNALED(native_status))
+            {
+                fprintf(stderr, "native smoke terminated by signal: p101_parse_positive_int: %d\n", WTERMSIG(native_status));
+            }
+            EXPECT(WIFEXITED(native_status));
+            if(WIFEXITED(native_status) && WEXITSTATUS(native_status) == 77)
+            {
+                fprintf(stderr, "native smoke fixture unavailable: p101_parse_positive_int\n");
+            }
+            else if(WIFEXITED(native_status))
+            {
+                if(WEXITSTATUS(native_status) != EXIT_SUCCESS)
+                {
+                    fprintf(stderr, "native smoke exited unsuccessfully: p101_parse_positive_int: %d\n", WEXITSTATUS(native_status));
+                }
+                EXPECT(WEXITSTATUS(native_status) == EXIT_SUCCESS);
+            }
+        }
+        p101_error_reset(err);
+    }
+}
+
+/* P101_TEST_CASE(p101_parse_positive_int16_t) */
+static void test_p101_parse_positive_int16_t(struct p101_env *env, struct p101_error *err)
+{
+#ifdef __linux__
+    static const int         errors[]      = {EIO};
+    static const char *const error_names[] = {"EIO"};
+#elif defined(__APPLE__)
+    static const int         errors[]      = {EIO};
+    static const char *const error_names[] = {"EIO"};
+#elif defined(__FreeBSD__)
+    static const int         errors[]      = {EIO};
+    static const char *const error_names[] = {"EIO"};
+#else
+    static const int         errors[]      = {EIO};
+    static const char *const error_names[] = {"EIO"};
+#endif
+
+    for(size_t index = 0U; index < sizeof(errors) / sizeof(errors[0]); index++)
+    {
+        struct fault_state state = {0, errors[index]};
+        int                failures_before;
+
+        failures_before = failures;
+        EXPECT(p101_error_has_no_error(err));
+        fault_resource_events = 0U;
+        errno                 = P101_TEST_ERRNO_SENTINEL;
+        p101_env_set_fault_injector(env, fail_next_call, &state);
+        int16_t result = p101_parse_positive_int16_t(env, err, NULL, 0);
+        (void)result;
+        EXPECT(state.checks == 1);
+        EXPECT(p101_error_is_errno(err, state.code));
+        EXPECT(errno == P101_TEST_ERRNO_SENTINEL);
+        EXPECT(result == (0));
+        EXPECT(fault_resource_events == 0U);
+        write_outcome("p101_parse_positive_int16_t", "errno", error_names[index], state.code, failures == failures_before);
+        p101_error_reset(err);
+    }
+    p101_env_set_fault_injector(env, NULL, NULL);
+    {
+        int   native_status = 0;
+        pid_t native_pid    = fork();
+
+        EXPECT(native_pid >= 0);
+        if(native_pid == 0)
+        {
+            bool               native_passed = true;
+            struct p101_error *native_err    = NULL;
+            struct p101_env   *native_env    = NULL;
+            FILE              *native_stdin_result;
+
+            native_child_process = true;
+            failures             = 0;
+            (void)alarm(2U);
+            if(unsetenv("P101_CALL_LOG") != 0 || unsetenv("P101_RESOURCE_LOG") != 0)
+            {
+                fprintf(stderr, "native setup failed: cannot clear p101 logging environment\n");
+                native_child_status = 77;
+                goto native_child_done_;
+            }
+            native_stdin_result = freopen("/dev/null", "r", stdin);
+            if(native_stdin_result == NULL)
+            {
+                fprintf(stderr, "native setup failed: cannot make standard input deterministic\n");
+                native_child_status = 77;
+                goto native_child_done_;
+            }
+            native_err = p101_error_create(false);
+            if(native_err == NULL)
+            {
+                native_child_status = 77;
+                goto native_child_done_;
+            }
+            native_env = p101_env_create(native_err, NULL);
+            if(native_env == NULL)
+            {
+                native_child_status = 77;
+                goto native_child_done_;
+            }
+            int16_t native_result = p101_parse_positive_int16_t(native_env, native_err, "1", 0);
+            (void)native_result;
+            if(p101_error_has_error(native_err))
+            {
+                bool native_error_declared = false;
+
+                for(size_t native_error_index = 0U; native_error_index < sizeof(errors) / sizeof(errors[0]); native_error_index++)
+                {
+                    if(p101_error_is_errno(native_err, errors[native_error_index]))
+                    {
+                        native_error_declared = true;
+                    }
+                }
+                if(!native_error_declared)
+                {
+                    fprintf(stderr, "native smoke produced an undeclared platform failure: p101_parse_positive_int16_t: %s\n", p101_error_get_message(native_err));
+                    native_passed = false;
+                }
+                p101_error_reset(native_err);
+            }
+            native_child_status = native_passed ? EXIT_SUCCESS : EXIT_FAILURE;
+        native_child_done_:
+            p101_env_destroy(native_env);
+            p101_error_destroy(native_err);
+        }
+        if(native_pid > 0)
+        {
+            EXPECT(native_waitpid_nointr(native_pid, &native_status) == native_pid);
+            if(WIFSIGNALED(native_status))
+            {
+                fprintf(stderr, "native smoke terminated by signal: p101_parse_positive_int16_t: %d\n", WTERMSIG(native_status));
+            }
+            EXPECT(WIFEXITED(native_status));
+            if(WIFEXITED(native_status) && WEXITSTATUS(native_status) == 77)
+            {
+                fprintf(stderr, "native smoke fixture unavailable: p101_parse_positive_int16_t\n");
+            }
+            else if(WIFEXITED(native_status))
+            {
+                if(WEXITSTATUS(native_status) != EXIT_SUCCESS)
+                {
+                    fprintf(stderr, "native smoke exited unsuccessfully: p101_parse_positive_int16_t: %d\n", WEXITSTATUS(native_status));
+                }
+                EXPECT(WEXITSTATUS(native_status) == EXIT_SUCCESS);
+            }
+        }
+        p101_error_reset(err);
+    }
+}
+
+/* P101_TEST_CASE(p101_parse_positive_int16_t_n) */
+static void test_p101_parse_positive_int16_t_n(struct p101_env *env, struct p101_error *err)
+{
+#ifdef __linux__
+    static const int         errors[]      = {EIO};
+    static const char *const error_names[] = {"EIO"};
+#elif defined(__APPLE__)
+    static const int         errors[]      = {EIO};
+    static const char *const error_names[] = {"EIO"};
+#elif defined(__FreeBSD__)
+    static const int         errors[]      = {EIO};
+    static const char *const error_names[] = {"EIO"};
+#else
+    static const int         errors[]      = {EIO};
+    static const char *const error_names[] = {"EIO"};
+#endif
+
+    for(size_t index = 0U; index < sizeof(errors) / sizeof(errors[0]); index++)
+    {
+        struct fault_state state = {0, errors[index]};
+        int                failures_before;
+
+        failures_before = failures;
+        EXPECT(p101_error_has_no_error(err));
+        fault_resource_events = 0U;
+        errno                 = P101_TEST_ERRNO_SENTINEL;
+        p101_env_set_fault_injector(env, fail_next_call, &state);
+        int16_t result = p101_parse_positive_int16_t_n(env, err, NULL, 0, 0);
+        (void)result;
+        EXPECT(state.checks == 1);
+        EXPECT(p101_error_is_errno(err, state.code));
+        EXPECT(errno == P101_TEST_ERRNO_SENTINEL);
+        EXPECT(result == (0));
+        EXPECT(fault_resource_events == 0U);
+        write_outcome("p101_parse_positive_int16_t_n", "errno", error_names[index], state.code, failures == failures_before);
+        p101_error_reset(err);
+    }
+    p101_env_set_fault_injector(env, NULL, NULL);
+    {
+        int   native_status = 0;
+        pid_t native_pid    = fork();
+
+        EXPECT(native_pid >= 0);
+        if(native_pid == 0)
+        {
+            bool               native_passed = true;
+            struct p101_error *native_err    = NULL;
+            struct p101_env   *native_env    = NULL;
+            FILE              *native_stdin_result;
+
+            native_child_process = true;
+            failures             = 0;
+            (void)alarm(2U);
+            if(unsetenv("P101_CALL_LOG") != 0 || unsetenv("P101_RESOURCE_LOG") != 0)
+            {
+                fprintf(stderr, "native setup failed: cannot clear p101 logging environment\n");
+                native_child_status = 77;
+                goto native_child_done_;
+            }
+            native_stdin_result = freopen("/dev/null", "r", stdin);
+            if(native_stdin_result == NULL)
+            {
+                fprintf(stderr, "native setup failed: cannot make standard input deterministic\n");
+                native_child_status = 77;
+                goto native_child_done_;
+            }
+            native_err = p101_error_create(false);
+            if(native_err == NULL)
+            {
+                native_child_status = 77;
+                goto native_child_done_;
+            }
+            native_env = p101_env_create(native_err, NULL);
+            if(native_env == NULL)
+            {
+                native_child_status = 77;
+                goto native_child_done_;
+            }
+            int16_t native_result = p101_parse_positive_int16_t_n(native_env, native_err, "1", 1, 0);
+            (void)native_result;
+            if(p101_error_has_error(native_err))
+            {
+                bool native_error_declared = false;
+
+                for(size_t native_error_index = 0U; native_error_index < sizeof(errors) / sizeof(errors[0]); native_error_index++)
+                {
+                    if(p101_error_is_errno(native_err, errors[native_error_index]))
+                    {
+                        native_error_declared = true;
+                    }
+                }
+                if(!native_error_declared)
+                {
+                    fprintf(stderr, "native smoke produced an undeclared platform failure: p101_parse_positive_int16_t_n: %s\n", p101_error_get_message(native_err));
+                    native_passed = false;
+                }
+                p101_error_reset(native_err);
+            }
+            native_child_status = native_passed ? EXIT_SUCCESS : EXIT_FAILURE;
+        native_child_done_:
+            p101_env_destroy(native_env);
+            p101_error_destroy(native_err);
+        }
+        if(native_pid > 0)
+        {
+            EXPECT(native_waitpid_nointr(native_pid, &native_status) == native_pid);
+            if(WIFSIGNALED(native_status))
+            {
+                fprintf(stderr, "native smoke terminated by signal: p101_parse_positive_int16_t_n: %d\n", WTERMSIG(native_status));
+            }
+            EXPECT(WIFEXITED(native_status));
+            if(WIFEXITED(native_status) && WEXITSTATUS(native_status) == 77)
+            {
+                fprintf(stderr, "native smoke fixture unavailable: p101_parse_positive_int16_t_n\n");
+            }
+            else if(WIFEXITED(native_status))
+            {
+                if(WEXITSTATUS(native_status) != EXIT_SUCCESS)
+                {
+                    fprintf(stderr, "native smoke exited unsuccessfully: p101_parse_positive_int16_t_n: %d\n", WEXITSTATUS(native_status));
+                }
+                EXPECT(WEXITSTATUS(native_status) == EXIT_SUCCESS);
+            }
+        }
+        p101_error_reset(err);
+    }
+}
+
+/* P101_TEST_CASE(p101_parse_positive_int16_t_prefix) */
+static void test_p101_parse_positive_int16_t_prefix(struct p101_env *env, struct p101_error *err)
+{
+#ifdef __linux__
+    static const int         errors[]      = {EIO};
+    static const char *const error_names[] = {"EIO"};
+#elif defined(__APPLE__)
+    static const int         errors[]      = {EIO};
+    static const char *const error_names[] = {"EIO"};
+#elif defined(__FreeBSD__)
+    static const int         errors[]      = {EIO};
+    static const char *const error_names[] = {"EIO"};
+#else
+    static const int         errors[]      = {EIO};
+    static const char *const error_names[] = {"EIO"};
+#endif
+
+    for(size_t index = 0U; index < sizeof(errors) / sizeof(errors[0]); index++)
+    {
+        struct fault_state state = {0, errors[index]};
+        int                failures_before;
+
+        failures_before = failures;
+        EXPECT(p101_error_has_no_error(err));
+        fault_resource_events = 0U;
+        errno                 = P101_TEST_ERRNO_SENTINEL;
+        p101_env_set_fault_injector(env, fail_next_call, &state);
+        int16_t result = p101_parse_positive_int16_t_prefix(env, err, NULL, NULL, 0);
+        (void)result;
+        EXPECT(state.checks == 1);
+        EXPECT(p101_error_is_errno(err, state.code));
+        EXPECT(errno == P101_TEST_ERRNO_SENTINEL);
+        EXPECT(result == (0));
+        EXPECT(fault_resource_events == 0U);
+        write_outcome("p101_parse_positive_int16_t_prefix", "errno", error_names[index], state.code, failures == failures_before);
+        p101_error_reset(err);
+    }
+    p101_env_set_fault_injector(env, NULL, NULL);
+    {
+        int   native_status = 0;
+        pid_t native_pid    = fork();
+
+        EXPECT(native_pid >= 0);
+        if(native_pid == 0)
+        {
+            bool               native_passed = true;
+            struct p101_error *native_err    = NULL;
+            struct p101_env   *native_env    = NULL;
+            FILE              *native_stdin_result;
+
+            native_child_process = true;
+            failures             = 0;
+            (void)alarm(2U);
+            if(unsetenv("P101_CALL_LOG") != 0 || unsetenv("P101_RESOURCE_LOG") != 0)
+            {
+                fprintf(stderr, "native setup failed: cannot clear p101 logging environment\n");
+                native_child_status = 77;
+                goto native_child_done_;
+            }
+            native_stdin_result = freopen("/dev/null", "r", stdin);
+            if(native_stdin_result == NULL)
+            {
+                fprintf(stderr, "native setup failed: cannot make standard input deterministic\n");
+                native_child_status = 77;
+                goto native_child_done_;
+            }
+            native_err = p101_error_create(false);
+            if(native_err == NULL)
+            {
+                native_child_status = 77;
+                goto native_child_done_;
+            }
+            native_env = p101_env_create(native_err, NULL);
+            if(native_env == NULL)
+            {
+                native_child_status = 77;
+                goto native_child_done_;
+            }
+            const char *native_argument_3 = NULL;
+            int16_t     native_result     = p101_parse_positive_int16_t_prefix(native_env, native_err, "1", &native_argument_3, 0);
+            (void)native_result;
+            if(p101_error_has_error(native_err))
+            {
+                bool native_error_declared = false;
+
+                for(size_t native_error_index = 0U; native_error_index < sizeof(errors) / sizeof(errors[0]); native_error_index++)
+                {
+                    if(p101_error_is_errno(native_err, errors[native_error_index]))
+                    {
+                        native_error_declared = true;
+                    }
+                }
+                if(!native_error_declared)
+                {
+                    fprintf(stderr, "native smoke produced an undeclared platform failure: p101_parse_positive_int16_t_prefix: %s\n", p101_error_get_message(native_err));
+                    native_passed = false;
+                }
+                p101_error_reset(native_err);
+            }
+            native_child_status = native_passed ? EXIT_SUCCESS : EXIT_FAILURE;
+        native_child_done_:
+            p101_env_destroy(native_env);
+            p101_error_destroy(native_err);
+        }
+        if(native_pid > 0)
+        {
+            EXPECT(native_waitpid_nointr(native_pid, &native_status) == native_pid);
+            if(WIFSIGNALED(native_status))
+            {
+                fprintf(stderr, "native smoke terminated by signal: p101_parse_positive_int16_t_prefix: %d\n", WTERMSIG(native_status));
+            }
+            EXPECT(WIFEXITED(native_status));
+            if(WIFEXITED(native_status) && WEXITSTATUS(native_status) == 77)
+            {
+                fprintf(stderr, "native smoke fixture unavailable: p101_parse_positive_int16_t_prefix\n");
+            }
+            else if(WIFEXITED(native_status))
+            {
+                if(WEXITSTATUS(native_status) != EXIT_SUCCESS)
+                {
+                    fprintf(stderr, "native smoke exited unsuccessfully: p101_parse_positive_int16_t_prefix: %d\n", WEXITSTATUS(native_status));
+                }
+                EXPECT(WEXITSTATUS(native_status) == EXIT_SUCCESS);
+            }
+        }
+        p101_error_reset(err);
+    }
+}
+
+/* P101_TEST_CASE(p101_parse_positive_int32_t) */
+static void test_p101_parse_positive_int32_t(struct p101_env *env, struct p101_error *err)
+{
+#ifdef __linux__
+    static const int         errors[]      = {EIO};
+    static const char *const error_names[] = {"EIO"};
+#elif defined(__APPLE__)
+    static const int         errors[]      = {EIO};
+    static const char *const error_names[] = {"EIO"};
+#elif defined(__FreeBSD__)
+    static const int         errors[]      = {EIO};
+    static const char *const error_names[] = {"EIO"};
+#else
+    static const int         errors[]      = {EIO};
+    static const char *const error_names[] = {"EIO"};
+#endif
+
+    for(size_t index = 0U; index < sizeof(errors) / sizeof(errors[0]); index++)
+    {
+        struct fault_state state = {0, errors[index]};
+        int                failures_before;
+
+        failures_before = failures;
+        EXPECT(p101_error_has_no_error(err));
+        fault_resource_events = 0U;
+        errno                 = P101_TEST_ERRNO_SENTINEL;
+        p101_env_set_fault_injector(env, fail_next_call, &state);
+        int32_t result = p101_parse_positive_int32_t(env, err, NULL, 0);
+        (void)result;
+        EXPECT(state.checks == 1);
+        EXPECT(p101_error_is_errno(err, state.code));
+        EXPECT(errno == P101_TEST_ERRNO_SENTINEL);
+        EXPECT(result == (0));
+        EXPECT(fault_resource_events == 0U);
+        write_outcome("p101_parse_positive_int32_t", "errno", error_names[index], state.code, failures == failures_before);
+        p101_error_reset(err);
+    }
+    p101_env_set_fault_injector(env, NULL, NULL);
+    {
+        int   native_status = 0;
+        pid_t native_pid    = fork();
+
+        EXPECT(native_pid >= 0);
+        if(native_pid == 0)
+        {
+            bool               native_passed = true;
+            struct p101_error *native_err    = NULL;
+            struct p101_env   *native_env    = NULL;
+            FILE              *native_stdin_result;
+
+            native_child_process = true;
+            failures             = 0;
+            (void)alarm(2U);
+            if(unsetenv("P101_CALL_LOG") != 0 || unsetenv("P101_RESOURCE_LOG") != 0)
+            {
+                fprintf(stderr, "native setup failed: cannot clear p101 logging environment\n");
+                native_child_status = 77;
+                goto native_child_done_;
+            }
+            native_stdin_result = freopen("/dev/null", "r", stdin);
+            if(native_stdin_result == NULL)
+            {
+                fprintf(stderr, "native setup failed: cannot make standard input deterministic\n");
+                native_child_status = 77;
+                goto native_child_done_;
+            }
+            native_err = p101_error_create(false);
+            if(native_err == NULL)
+            {
+                native_child_status = 77;
+                goto native_child_done_;
+            }
+            native_env = p101_env_create(native_err, NULL);
+            if(native_env == NULL)
+            {
+                native_child_status = 77;
+                goto native_child_done_;
+            }
+            int32_t native_result = p101_parse_positive_int32_t(native_env, native_err, "1", 0);
+            (void)native_result;
+            if(p101_error_has_error(native_err))
+            {
+                bool native_error_declared = false;
+
+                for(size_t native_error_index = 0U; native_error_index < sizeof(errors) / sizeof(errors[0]); native_error_index++)
+                {
+                    if(p101_error_is_errno(native_err, errors[native_error_index]))
+                    {
+                        native_error_declared = true;
+                    }
+                }
+                if(!native_error_declared)
+                {
+                    fprintf(stderr, "native smoke produced an undeclared platform failure: p101_parse_positive_int32_t: %s\n", p101_error_get_message(native_err));
+                    native_passed = false;
+                }
+                p101_error_reset(native_err);
+            }
+            native_child_status = native_passed ? EXIT_SUCCESS : EXIT_FAILURE;
+        native_child_done_:
+            p101_env_destroy(native_env);
+            p101_error_destroy(native_err);
+        }
+        if(native_pid > 0)
+        {
+            EXPECT(native_waitpid_nointr(native_pid, &native_status) == native_pid);
+            if(WIFSIGNALED(native_status))
+            {
+                fprintf(stderr, "native smoke terminated by signal: p101_parse_positive_int32_t: %d\n", WTERMSIG(native_status));
+            }
+            EXPECT(WIFEXITED(native_status));
+            if(WIFEXITED(native_status) && WEXITSTATUS(native_status) == 77)
+            {
+                fprintf(stderr, "native smoke fixture unavailable: p101_parse_positive_int32_t\n");
+            }
+            else if(WIFEXITED(native_status))
+            {
+                if(WEXITSTATUS(native_status) != EXIT_SUCCESS)
+                {
+                    fprintf(stderr, "native smoke exited unsuccessfully: p101_parse_positive_int32_t: %d\n", WEXITSTATUS(native_status));
+                }
+                EXPECT(WEXITSTATUS(native_status) == EXIT_SUCCESS);
+            }
+        }
+        p101_error_reset(err);
+    }
+}
+
+/* P101_TEST_CASE(p101_parse_positive_int32_t_n) */
+static void test_p101_parse_positive_int32_t_n(struct p101_env *env, struct p101_error *err)
+{
+#ifdef __linux__
+    static const int         errors[]      = {EIO};
+    static const char *const error_names[] = {"EIO"};
+#elif defined(__APPLE__)
+    static const int         errors[]      = {EIO};
+    static const char *const error_names[] = {"EIO"};
+#elif defined(__FreeBSD__)
+    static const int         errors[]      = {EIO};
+    static const char *const error_names[] = {"EIO"};
+#else
+    static const int         errors[]      = {EIO};
+    static const char *const error_names[] = {"EIO"};
+#endif
+
+    for(size_t index = 0U; index < sizeof(errors) / sizeof(errors[0]); index++)
+    {
+        struct fault_state state = {0, errors[index]};
+        int                failures_before;
+
+        failures_before = failures;
+        EXPECT(p101_error_has_no_error(err));
+        fault_resource_events = 0U;
+        errno                 = P101_TEST_ERRNO_SENTINEL;
+        p101_env_set_fault_injector(env, fail_next_call, &state);
+        int32_t result = p101_parse_positive_int32_t_n(env, err, NULL, 0, 0);
+        (void)result;
+        EXPECT(state.checks == 1);
+        EXPECT(p101_error_is_errno(err, state.code));
+        EXPECT(errno == P101_TEST_ERRNO_SENTINEL);
+        EXPECT(result == (0));
+        EXPECT(fault_resource_events == 0U);
+        write_outcome("p101_parse_positive_int32_t_n", "errno", error_names[index], state.code, failures == failures_before);
+        p101_error_reset(err);
+    }
+    p101_env_set_fault_injector(env, NULL, NULL);
+    {
+        int   native_status = 0;
+        pid_t native_pid    = fork();
+
+        EXPECT(native_pid >= 0);
+        if(native_pid == 0)
+        {
+            bool               native_passed = true;
+            struct p101_error *native_err    = NULL;
+            struct p101_env   *native_env    = NULL;
+            FILE              *native_stdin_result;
+
+            native_child_process = true;
+            failures             = 0;
+            (void)alarm(2U);
+            if(unsetenv("P101_CALL_LOG") != 0 || unsetenv("P101_RESOURCE_LOG") != 0)
+            {
+                fprintf(stderr, "native setup failed: cannot clear p101 logging environment\n");
+                native_child_status = 77;
+                goto native_child_done_;
+            }
+            native_stdin_result = freopen("/dev/null", "r", stdin);
+            if(native_stdin_result == NULL)
+            {
+                fprintf(stderr, "native setup failed: cannot make standard input deterministic\n");
+                native_child_status = 77;
+                goto native_child_done_;
+            }
+            native_err = p101_error_create(false);
+            if(native_err == NULL)
+            {
+                native_child_status = 77;
+                goto native_child_done_;
+            }
+            native_env = p101_env_create(native_err, NULL);
+            if(native_env == NULL)
+            {
+                native_child_status = 77;
+                goto native_child_done_;
+            }
+            int32_t native_result = p101_parse_positive_int32_t_n(native_env, native_err, "1", 1, 0);
+            (void)native_result;
+            if(p101_error_has_error(native_err))
+            {
+                bool native_error_declared = false;
+
+                for(size_t native_error_index = 0U; native_error_index < sizeof(errors) / sizeof(errors[0]); native_error_index++)
+                {
+                    if(p101_error_is_errno(native_err, errors[native_error_index]))
+                    {
+                        native_error_declared = true;
+                    }
+                }
+                if(!native_error_declared)
+                {
+                    fprintf(stderr, "native smoke produced an undeclared platform failure: p101_parse_positive_int32_t_n: %s\n", p101_error_get_message(native_err));
+                    native_passed = false;
+                }
+                p101_error_reset(native_err);
+            }
+            native_child_status = native_passed ? EXIT_SUCCESS : EXIT_FAILURE;
+        native_child_done_:
+            p101_env_destroy(native_env);
+            p101_error_destroy(native_err);
+        }
+        if(native_pid > 0)
+        {
+            EXPECT(native_waitpid_nointr(native_pid, &native_status) == native_pid);
+            if(WIFSIGNALED(native_status))
+            {
+                fprintf(stderr, "native smoke terminated by signal: p101_parse_positive_int32_t_n: %d\n", WTERMSIG(native_status));
+            }
+            EXPECT(WIFEXITED(native_status));
+            if(WIFEXITED(native_status) && WEXITSTATUS(native_status) == 77)
+            {
+                fprintf(stderr, "native smoke fixture unavailable: p101_parse_positive_int32_t_n\n");
+            }
+            else if(WIFEXITED(native_status))
+            {
+                if(WEXITSTATUS(native_status) != EXIT_SUCCESS)
+                {
+                    fprintf(stderr, "native smoke exited unsuccessfully: p101_parse_positive_int32_t_n: %d\n", WEXITSTATUS(native_status));
+                }
+                EXPECT(WEXITSTATUS(native_status) == EXIT_SUCCESS);
+            }
+        }
+        p101_error_reset(err);
+    }
+}
+
+/* P101_TEST_CASE(p101_parse_positive_int32_t_prefix) */
+static void test_p101_parse_positive_int32_t_prefix(struct p101_env *env, struct p101_error *err)
+{
+#ifdef __linux__
+    static const int         errors[]      = {EIO};
+    static const char *const error_names[] = {"EIO"};
+#elif defined(__APPLE__)
+    static const int         errors[]      = {EIO};
+    static const char *const error_names[] = {"EIO"};
+#elif defined(__FreeBSD__)
+    static const int         errors[]      = {EIO};
+    static const char *const error_names[] = {"EIO"};
+#else
+    static const int         errors[]      = {EIO};
+    static const char *const error_names[] = {"EIO"};
+#endif
+
+    for(size_t index = 0U; index < sizeof(errors) / sizeof(errors[0]); index++)
+    {
+        struct fault_state state = {0, errors[index]};
+        int                failures_before;
+
+        failures_before = failures;
+        EXPECT(p101_error_has_no_error(err));
+        fault_resource_events = 0U;
+        errno                 = P101_TEST_ERRNO_SENTINEL;
+        p101_env_set_fault_injector(env, fail_next_call, &state);
+        int32_t result = p101_parse_positive_int32_t_prefix(env, err, NULL, NULL, 0);
+        (void)result;
+        EXPECT(state.checks == 1);
+        EXPECT(p101_error_is_errno(err, state.code));
+        EXPECT(errno == P101_TEST_ERRNO_SENTINEL);
+        EXPECT(result == (0));
+        EXPECT(fault_resource_events == 0U);
+        write_outcome("p101_parse_positive_int32_t_prefix", "errno", error_names[index], state.code, failures == failures_before);
+        p101_error_reset(err);
+    }
+    p101_env_set_fault_injector(env, NULL, NULL);
+    {
+        int   native_status = 0;
+        pid_t native_pid    = fork();
+
+        EXPECT(native_pid >= 0);
+        if(native_pid == 0)
+        {
+            bool               native_passed = true;
+            struct p101_error *native_err    = NULL;
+            struct p101_env   *native_env    = NULL;
+            FILE              *native_stdin_result;
+
+            native_child_process = true;
+            failures             = 0;
+            (void)alarm(2U);
+            if(unsetenv("P101_CALL_LOG") != 0 || unsetenv("P101_RESOURCE_LOG") != 0)
+            {
+                fprintf(stderr, "native setup failed: cannot clear p101 logging environment\n");
+                native_child_status = 77;
+                goto native_child_done_;
+            }
+            native_stdin_result = freopen("/dev/null", "r", stdin);
+            if(native_stdin_result == NULL)
+            {
+                fprintf(stderr, "native setup failed: cannot make standard input deterministic\n");
+                native_child_status = 77;
+                goto native_child_done_;
+            }
+            native_err = p101_error_create(false);
+            if(native_err == NULL)
+            {
+                native_child_status = 77;
+                goto native_child_done_;
+            }
+            native_env = p101_env_create(native_err, NULL);
+            if(native_env == NULL)
+            {
+                native_child_status = 77;
+                goto native_child_done_;
+            }
+            const char *native_argument_3 = NULL;
+            int32_t     native_result     = p101_parse_positive_int32_t_prefix(native_env, native_err, "1", &native_argument_3, 0);
+            (void)native_result;
+            if(p101_error_has_error(native_err))
+            {
+                bool native_error_declared = false;
+
+                for(size_t native_error_index = 0U; native_error_index < sizeof(errors) / sizeof(errors[0]); native_error_index++)
+                {
+                    if(p101_error_is_errno(native_err, errors[native_error_index]))
+                    {
+                        native_error_declared = true;
+                    }
+                }
+                if(!native_error_declared)
+                {
+                    fprintf(stderr, "native smoke produced an undeclared platform failure: p101_parse_positive_int32_t_prefix: %s\n", p101_error_get_message(native_err));
+                    native_passed = false;
+                }
+                p101_error_reset(native_err);
+            }
+            native_child_status = native_passed ? EXIT_SUCCESS : EXIT_FAILURE;
+        native_child_done_:
+            p101_env_destroy(native_env);
+            p101_error_destroy(native_err);
+        }
+        if(native_pid > 0)
+        {
+            EXPECT(native_waitpid_nointr(native_pid, &native_status) == native_pid);
+            if(WIFSIGNALED(native_status))
+            {
+                fprintf(stderr, "native smoke terminated by signal: p101_parse_positive_int32_t_prefix: %d\n", WTERMSIG(native_status));
+            }
+            EXPECT(WIFEXITED(native_status));
+            if(WIFEXITED(native_status) && WEXITSTATUS(native_status) == 77)
+            {
+                fprintf(stderr, "native smoke fixture unavailable: p101_parse_positive_int32_t_prefix\n");
+            }
+            else if(WIFEXITED(native_status))
+            {
+                if(WEXITSTATUS(native_status) != EXIT_SUCCESS)
+                {
+                    fprintf(stderr, "native smoke exited unsuccessfully: p101_parse_positive_int32_t_prefix: %d\n", WEXITSTATUS(native_status));
+                }
+                EXPECT(WEXITSTATUS(native_status) == EXIT_SUCCESS);
+            }
+        }
+        p101_error_reset(err);
+    }
+}
+
+/* P101_TEST_CASE(p101_parse_positive_int64_t) */
+static void test_p101_parse_positive_int64_t(struct p101_env *env, struct p101_error *err)
+{
+#ifdef __linux__
+    static const int         errors[]      = {EIO};
+    static const char *const error_names[] = {"EIO"};
+#elif defined(__APPLE__)
+    static const int         errors[]      = {EIO};
+    static const char *const error_names[] = {"EIO"};
+#elif defined(__FreeBSD__)
+    static const int         errors[]      = {EIO};
+    static const char *const error_names[] = {"EIO"};
+#else
+    static const int         errors[]      = {EIO};
+    static const char *const error_names[] = {"EIO"};
+#endif
+
+    for(size_t index = 0U; index < sizeof(errors) / sizeof(errors[0]); index++)
+    {
+        struct fault_state state = {0, errors[index]};
+        int                failures_before;
+
+        failures_before = failures;
+        EXPECT(p101_error_has_no_error(err));
+        fault_resource_events = 0U;
+        errno                 = P101_TEST_ERRNO_SENTINEL;
+        p101_env_set_fault_injector(env, fail_next_call, &state);
+        int64_t result = p101_parse_positive_int64_t(env, err, NULL, 0);
+        (void)result;
+        EXPECT(state.checks == 1);
+        EXPECT(p101_error_is_errno(err, state.code));
+        EXPECT(errno == P101_TEST_ERRNO_SENTINEL);
+        EXPECT(result == (0));
+        EXPECT(fault_resource_events == 0U);
+        write_outcome("p101_parse_positive_int64_t", "errno", error_names[index], state.code, failures == failures_before);
+        p101_error_reset(err);
+    }
+    p101_env_set_fault_injector(env, NULL, NULL);
+    {
+        int   native_status = 0;
+        pid_t native_pid    = fork();
+
+        EXPECT(native_pid >= 0);
+        if(native_pid == 0)
+        {
+            bool               native_passed = true;
+            struct p101_error *native_err    = NULL;
+            struct p101_env   *native_env    = NULL;
+            FILE              *native_stdin_result;
+
+            native_child_process = true;
+            failures             = 0;
+            (void)alarm(2U);
+            if(unsetenv("P101_CALL_LOG") != 0 || unsetenv("P101_RESOURCE_LOG") != 0)
+            {
+                fprintf(stderr, "native setup failed: cannot clear p101 logging environment\n");
+                native_child_status = 77;
+                goto native_child_done_;
+            }
+            native_stdin_result = freopen("/dev/null", "r", stdin);
+            if(native_stdin_result == NULL)
+            {
+                fprintf(stderr, "native setup failed: cannot make standard input deterministic\n");
+                native_child_status = 77;
+                goto native_child_done_;
+            }
+            native_err = p101_error_create(false);
+            if(native_err == NULL)
+            {
+                native_child_status = 77;
+                goto native_child_done_;
+            }
+            native_env = p101_env_create(native_err, NULL);
+            if(native_env == NULL)
+            {
+                native_child_status = 77;
+                goto native_child_done_;
+            }
+            int64_t native_result = p101_parse_positive_int64_t(native_env, native_err, "1", 0);
+            (void)native_result;
+            if(p101_error_has_error(native_err))
+            {
+                bool native_error_declared = false;
+
+                for(size_t native_error_index = 0U; native_error_index < sizeof(errors) / sizeof(errors[0]); native_error_index++)
+                {
+                    if(p101_error_is_errno(native_err, errors[native_error_index]))
+                    {
+                        native_error_declared = true;
+                    }
+                }
+                if(!native_error_declared)
+                {
+                    fprintf(stderr, "native smoke produced an undeclared platform failure: p101_parse_positive_int64_t: %s\n", p101_error_get_message(native_err));
+                    native_passed = false;
+                }
+                p101_error_reset(native_err);
+            }
+            native_child_status = native_passed ? EXIT_SUCCESS : EXIT_FAILURE;
+        native_child_done_:
+            p101_env_destroy(native_env);
+            p101_error_destroy(native_err);
+        }
+        if(native_pid > 0)
+        {
+            EXPECT(native_waitpid_nointr(native_pid, &native_status) == native_pid);
+            if(WIFSIGNALED(native_status))
+            {
+                fprintf(stderr, "native smoke terminated by signal: p101_parse_positive_int64_t: %d\n", WTERMSIG(native_status));
+            }
+            EXPECT(WIFEXITED(native_status));
+            if(WIFEXITED(native_status) && WEXITSTATUS(native_status) == 77)
+            {
+                fprintf(stderr, "native smoke fixture unavailable: p101_parse_positive_int64_t\n");
+            }
+            else if(WIFEXITED(native_status))
+            {
+                if(WEXITSTATUS(native_status) != EXIT_SUCCESS)
+                {
+                    fprintf(stderr, "native smoke exited unsuccessfully: p101_parse_positive_int64_t: %d\n", WEXITSTATUS(native_status));
+                }
+                EXPECT(WEXITSTATUS(native_status) == EXIT_SUCCESS);
+            }
+        }
+        p101_error_reset(err);
+    }
+}
+
+/* P101_TEST_CASE(p101_parse_positive_int64_t_n) */
+static void test_p101_parse_positive_int64_t_n(struct p101_env *env, struct p101_error *err)
+{
+#ifdef __linux__
+    static const int         errors[]      = {EIO};
+    static const char *const error_names[] = {"EIO"};
+#elif defined(__APPLE__)
+    static const int         errors[]      = {EIO};
+    static const char *const error_names[] = {"EIO"};
+#elif defined(__FreeBSD__)
+    static const int         errors[]      = {EIO};
+    static const char *const error_names[] = {"EIO"};
+#else
+    static const int         errors[]      = {EIO};
+    static const char *const error_names[] = {"EIO"};
+#endif
+
+    for(size_t index = 0U; index < sizeof(errors) / sizeof(errors[0]); index++)
+    {
+        struct fault_state state = {0, errors[index]};
+        int                failures_before;
+
+        failures_before = failures;
+        EXPECT(p101_error_has_no_error(err));
+        fault_resource_events = 0U;
+        errno                 = P101_TEST_ERRNO_SENTINEL;
+        p101_env_set_fault_injector(env, fail_next_call, &state);
+        int64_t result = p101_parse_positive_int64_t_n(env, err, NULL, 0, 0);
+        (void)result;
+        EXPECT(state.checks == 1);
+        EXPECT(p101_error_is_errno(err, state.code));
+        EXPECT(errno == P101_TEST_ERRNO_SENTINEL);
+        EXPECT(result == (0));
+        EXPECT(fault_resource_events == 0U);
+        write_outcome("p101_parse_positive_int64_t_n", "errno", error_names[index], state.code, failures == failures_before);
+        p101_error_reset(err);
+    }
+    p101_env_set_fault_injector(env, NULL, NULL);
+    {
+        int   native_status = 0;
+        pid_t native_pid    = fork();
+
+        EXPECT(native_pid >= 0);
+        if(native_pid == 0)
+        {
+            bool               native_passed = true;
+            struct p101_error *native_err    = NULL;
+            struct p101_env   *native_env    = NULL;
+            FILE              *native_stdin_result;
+
+            native_child_process = true;
+            failures             = 0;
+            (void)alarm(2U);
+            if(unsetenv("P101_CALL_LOG") != 0 || unsetenv("P101_RESOURCE_LOG") != 0)
+            {
+                fprintf(stderr, "native setup failed: cannot clear p101 logging environment\n");
+                native_child_status = 77;
+                goto native_child_done_;
+            }
+            native_stdin_result = freopen("/dev/null", "r", stdin);
+            if(native_stdin_result == NULL)
+            {
+                fprintf(stderr, "native setup failed: cannot make standard input deterministic\n");
+                native_child_status = 77;
+                goto native_child_done_;
+            }
+            native_err = p101_error_create(false);
+            if(native_err == NULL)
+            {
+                native_child_status = 77;
+                goto native_child_done_;
+            }
+            native_env = p101_env_create(native_err, NULL);
+            if(native_env == NULL)
+            {
+                native_child_status = 77;
+                goto native_child_done_;
+            }
+            int64_t native_result = p101_parse_positive_int64_t_n(native_env, native_err, "1", 1, 0);
+            (void)native_result;
+            if(p101_error_has_error(native_err))
+            {
+                bool native_error_declared = false;
+
+                for(size_t native_error_index = 0U; native_error_index < sizeof(errors) / sizeof(errors[0]); native_error_index++)
+                {
+                    if(p101_error_is_errno(native_err, errors[native_error_index]))
+                    {
+                        native_error_declared = true;
+                    }
+                }
+                if(!native_error_declared)
+                {
+                    fprintf(stderr, "native smoke produced an undeclared platform failure: p101_parse_positive_int64_t_n: %s\n", p101_error_get_message(native_err));
+                    native_passed = false;
+                }
+                p101_error_reset(native_err);
+            }
+            native_child_status = native_passed ? EXIT_SUCCESS : EXIT_FAILURE;
+        native_child_done_:
+            p101_env_destroy(native_env);
+            p101_error_destroy(native_err);
+        }
+        if(native_pid > 0)
+        {
+            EXPECT(native_waitpid_nointr(native_pid, &native_status) == native_pid);
+            if(WIFSIGNALED(native_status))
+            {
+                fprintf(stderr, "native smoke terminated by signal: p101_parse_positive_int64_t_n: %d\n", WTERMSIG(native_status));
+            }
+            EXPECT(WIFEXITED(native_status));
+            if(WIFEXITED(native_status) && WEXITSTATUS(native_status) == 77)
+            {
+                fprintf(stderr, "native smoke fixture unavailable: p101_parse_positive_int64_t_n\n");
+            }
+            else if(WIFEXITED(native_status))
+            {
+                if(WEXITSTATUS(native_status) != EXIT_SUCCESS)
+                {
+                    fprintf(stderr, "native smoke exited unsuccessfully: p101_parse_positive_int64_t_n: %d\n", WEXITSTATUS(native_status));
+                }
+                EXPECT(WEXITSTATUS(native_status) == EXIT_SUCCESS);
+            }
+        }
+        p101_error_reset(err);
+    }
+}
+
+/* P101_TEST_CASE(p101_parse_positive_int64_t_prefix) */
+static void test_p101_parse_positive_int64_t_prefix(struct p101_env *env, struct p101_error *err)
+{
+#ifdef __linux__
+    static const int         errors[]      = {EIO};
+    static const char *const error_names[] = {"EIO"};
+#elif defined(__APPLE__)
+    static const int         errors[]      = {EIO};
+    static const char *const error_names[] = {"EIO"};
+#elif defined(__FreeBSD__)
+    static const int         errors[]      = {EIO};
+    static const char *const error_names[] = {"EIO"};
+#else
+    static const int         errors[]      = {EIO};
+    static const char *const error_names[] = {"EIO"};
+#endif
+
+    for(size_t index = 0U; index < sizeof(errors) / sizeof(errors[0]); index++)
+    {
+        struct fault_state state = {0, errors[index]};
+        int                failures_before;
+
+        failures_before = failures;
+        EXPECT(p101_error_has_no_error(err));
+        fault_resource_events = 0U;
+        errno                 = P101_TEST_ERRNO_SENTINEL;
+        p101_env_set_fault_injector(env, fail_next_call, &state);
+        int64_t result = p101_parse_positive_int64_t_prefix(env, err, NULL, NULL, 0);
+        (void)result;
+        EXPECT(state.checks == 1);
+        EXPECT(p101_error_is_errno(err, state.code));
+        EXPECT(errno == P101_TEST_ERRNO_SENTINEL);
+        EXPECT(result == (0));
+        EXPECT(fault_resource_events == 0U);
+        write_outcome("p101_parse_positive_int64_t_prefix", "errno", error_names[index], state.code, failures == failures_before);
+        p101_error_reset(err);
+    }
+    p101_env_set_fault_injector(env, NULL, NULL);
+    {
+        int   native_status = 0;
+        pid_t native_pid    = fork();
+
+        EXPECT(native_pid >= 0);
+        if(native_pid == 0)
+        {
+            bool               native_passed = true;
+            struct p101_error *native_err    = NULL;
+            struct p101_env   *native_env    = NULL;
+            FILE              *native_stdin_result;
+
+            native_child_process = true;
+            failures             = 0;
+            (void)alarm(2U);
+            if(unsetenv("P101_CALL_LOG") != 0 || unsetenv("P101_RESOURCE_LOG") != 0)
+            {
+                fprintf(stderr, "native setup failed: cannot clear p101 logging environment\n");
+                native_child_status = 77;
+                goto native_child_done_;
+            }
+            native_stdin_result = freopen("/dev/null", "r", stdin);
+            if(native_stdin_result == NULL)
+            {
+                fprintf(stderr, "native setup failed: cannot make standard input deterministic\n");
+                native_child_status = 77;
+                goto native_child_done_;
+            }
+            native_err = p101_error_create(false);
+            if(native_err == NULL)
+            {
+                native_child_status = 77;
+                goto native_child_done_;
+            }
+            native_env = p101_env_create(native_err, NULL);
+            if(native_env == NULL)
+            {
+                native_child_status = 77;
+                goto native_child_done_;
+            }
+            const char *native_argument_3 = NULL;
+            int64_t     native_result     = p101_parse_positive_int64_t_prefix(native_env, native_err, "1", &native_argument_3, 0);
+            (void)native_result;
+            if(p101_error_has_error(native_err))
+            {
+                bool native_error_declared = false;
+
+                for(size_t native_error_index = 0U; native_error_index < sizeof(errors) / sizeof(errors[0]); native_error_index++)
+                {
+                    if(p101_error_is_errno(native_err, errors[native_error_index]))
+                    {
+                        native_error_declared = true;
+                    }
+                }
+                if(!native_error_declared)
+                {
+                    fprintf(stderr, "native smoke produced an undeclared platform failure: p101_parse_positive_int64_t_prefix: %s\n", p101_error_get_message(native_err));
+                    native_passed = false;
+                }
+                p101_error_reset(native_err);
+            }
+            native_child_status = native_passed ? EXIT_SUCCESS : EXIT_FAILURE;
+        native_child_done_:
+            p101_env_destroy(native_env);
+            p101_error_destroy(native_err);
+        }
+        if(native_pid > 0)
+        {
+            EXPECT(native_waitpid_nointr(native_pid, &native_status) == native_pid);
+            if(WIFSIGNALED(native_status))
+            {
+                fprintf(stderr, "native smoke terminated by signal: p101_parse_positive_int64_t_prefix: %d\n", WTERMSIG(native_status));
+            }
+            EXPECT(WIFEXITED(native_status));
+            if(WIFEXITED(native_status) && WEXITSTATUS(native_status) == 77)
+            {
+                fprintf(stderr, "native smoke fixture unavailable: p101_parse_positive_int64_t_prefix\n");
+            }
+            else if(WIFEXITED(native_status))
+            {
+                if(WEXITSTATUS(native_status) != EXIT_SUCCESS)
+                {
+                    fprintf(stderr, "native smoke exited unsuccessfully: p101_parse_positive_int64_t_prefix: %d\n", WEXITSTATUS(native_status));
+                }
+                EXPECT(WEXITSTATUS(native_status) == EXIT_SUCCESS);
+            }
+        }
+        p101_error_reset(err);
+    }
+}
+
+/* P101_TEST_CASE(p101_parse_positive_int8_t) */
+static void test_p101_parse_positive_int8_t(struct p101_env *env, struct p101_error *err)
+{
+#ifdef __linux__
+    static const int         errors[]      = {EIO};
+    static const char *const error_names[] = {"EIO"};
+#elif defined(__APPLE__)
+    static const int         errors[]      = {EIO};
+    static const char *const error_names[] = {"EIO"};
+#elif defined(__FreeBSD__)
+    static const int         errors[]      = {EIO};
+    static const char *const error_names[] = {"EIO"};
+#else
+    static const int         errors[]      = {EIO};
+    static const char *const error_names[] = {"EIO"};
+#endif
+
+    for(size_t index = 0U; index < sizeof(errors) / sizeof(errors[0]); index++)
+    {
+        struct fault_state state = {0, errors[index]};
+        int                failures_before;
+
+        failures_before = failures;
+        EXPECT(p101_error_has_no_error(err));
+        fault_resource_events = 0U;
+        errno                 = P101_TEST_ERRNO_SENTINEL;
+        p101_env_set_fault_injector(env, fail_next_call, &state);
+        int8_t result = p101_parse_positive_int8_t(env, err, NULL, 0);
+        (void)result;
+        EXPECT(state.checks == 1);
+        EXPECT(p101_error_is_errno(err, state.code));
+        EXPECT(errno == P101_TEST_ERRNO_SENTINEL);
+        EXPECT(result == (0));
+        EXPECT(fault_resource_events == 0U);
+        write_outcome("p101_parse_positive_int8_t", "errno", error_names[index], state.code, failures == failures_before);
+        p101_error_reset(err);
+    }
+    p101_env_set_fault_injector(env, NULL, NULL);
+    {
+        int   native_status = 0;
+        pid_t native_pid    = fork();
+
+        EXPECT(native_pid >= 0);
+        if(native_pid == 0)
+        {
+            bool               native_passed = true;
+            struct p101_error *native_err    = NULL;
+            struct p101_env   *native_env    = NULL;
+            FILE              *native_stdin_result;
+
+            native_child_process = true;
+            failures             = 0;
+            (void)alarm(2U);
+            if(unsetenv("P101_CALL_LOG") != 0 || unsetenv("P101_RESOURCE_LOG") != 0)
+            {
+                fprintf(stderr, "native setup failed: cannot clear p101 logging environment\n");
+                native_child_status = 77;
+                goto native_child_done_;
+            }
+            native_stdin_result = freopen("/dev/null", "r", stdin);
+            if(native_stdin_result == NULL)
+            {
+                fprintf(stderr, "native setup failed: cannot make standard input deterministic\n");
+                native_child_status = 77;
+                goto native_child_done_;
+            }
+            native_err = p101_error_create(false);
+            if(native_err == NULL)
+            {
+                native_child_status = 77;
+                goto native_child_done_;
+            }
+            native_env = p101_env_create(native_err, NULL);
+            if(native_env == NULL)
+            {
+                native_child_status = 77;
+                goto native_child_done_;
+            }
+            int8_t native_result = p101_parse_positive_int8_t(native_env, native_err, "1", 0);
+            (void)native_result;
+            if(p101_error_has_error(native_err))
+            {
+                bool native_error_declared = false;
+
+                for(size_t native_error_index = 0U; native_error_index < sizeof(errors) / sizeof(errors[0]); native_error_index++)
+                {
+                    if(p101_error_is_errno(native_err, errors[native_error_index]))
+                    {
+                        native_error_declared = true;
+                    }
+                }
+                if(!native_error_declared)
+                {
+                    fprintf(stderr, "native smoke produced an undeclared platform failure: p101_parse_positive_int8_t: %s\n", p101_error_get_message(native_err));
+                    native_passed = false;
+                }
+                p101_error_reset(native_err);
+            }
+            native_child_status = native_passed ? EXIT_SUCCESS : EXIT_FAILURE;
+        native_child_done_:
+            p101_env_destroy(native_env);
+            p101_error_destroy(native_err);
+        }
+        if(native_pid > 0)
+        {
+            EXPECT(native_waitpid_nointr(native_pid, &native_status) == native_pid);
+            if(WIFSIGNALED(native_status))
+            {
+                fprintf(stderr, "native smoke terminated by signal: p101_parse_positive_int8_t: %d\n", WTERMSIG(native_status));
+            }
+            EXPECT(WIFEXITED(native_status));
+            if(WIFEXITED(native_status) && WEXITSTATUS(native_status) == 77)
+            {
+                fprintf(stderr, "native smoke fixture unavailable: p101_parse_positive_int8_t\n");
+            }
+            else if(WIFEXITED(native_status))
+            {
+                if(WEXITSTATUS(native_status) != EXIT_SUCCESS)
+                {
+                    fprintf(stderr, "native smoke exited unsuccessfully: p101_parse_positive_int8_t: %d\n", WEXITSTATUS(native_status));
+                }
+                EXPECT(WEXITSTATUS(native_status) == EXIT_SUCCESS);
+            }
+        }
+        p101_error_reset(err);
+    }
+}
+
+/* P101_TEST_CASE(p101_parse_positive_int8_t_n) */
+static void test_p101_parse_positive_int8_t_n(struct p101_env *env, struct p101_error *err)
+{
+#ifdef __linux__
+    static const int         errors[]      = {EIO};
+    static const char *const error_names[] = {"EIO"};
+#elif defined(__APPLE__)
+    static const int         errors[]      = {EIO};
+    static const char *const error_names[] = {"EIO"};
+#elif defined(__FreeBSD__)
+    static const int         errors[]      = {EIO};
+    static const char *const error_names[] = {"EIO"};
+#else
+    static const int         errors[]      = {EIO};
+    static const char *const error_names[] = {"EIO"};
+#endif
+
+    for(size_t index = 0U; index < sizeof(errors) / sizeof(errors[0]); index++)
+    {
+        struct fault_state state = {0, errors[index]};
+        int                failures_before;
+
+        failures_before = failures;
+        EXPECT(p101_error_has_no_error(err));
+        fault_resource_events = 0U;
+        errno                 = P101_TEST_ERRNO_SENTINEL;
+        p101_env_set_fault_injector(env, fail_next_call, &state);
+        int8_t result = p101_parse_positive_int8_t_n(env, err, NULL, 0, 0);
+        (void)result;
+        EXPECT(state.checks == 1);
+        EXPECT(p101_error_is_errno(err, state.code));
+        EXPECT(errno == P101_TEST_ERRNO_SENTINEL);
+        EXPECT(result == (0));
+        EXPECT(fault_resource_events == 0U);
+        write_outcome("p101_parse_positive_int8_t_n", "errno", error_names[index], state.code, failures == failures_before);
+        p101_error_reset(err);
+    }
+    p101_env_set_fault_injector(env, NULL, NULL);
+    {
+        int   native_status = 0;
+        pid_t native_pid    = fork();
+
+        EXPECT(native_pid >= 0);
+        if(native_pid == 0)
+        {
+            bool               native_passed = true;
+            struct p101_error *native_err    = NULL;
+            struct p101_env   *native_env    = NULL;
+            FILE              *native_stdin_result;
+
+            native_child_process = true;
+            failures             = 0;
+            (void)alarm(2U);
+            if(unsetenv("P101_CALL_LOG") != 0 || unsetenv("P101_RESOURCE_LOG") != 0)
+            {
+                fprintf(stderr, "native setup failed: cannot clear p101 logging environment\n");
+                native_child_status = 77;
+                goto native_child_done_;
+            }
+            native_stdin_result = freopen("/dev/null", "r", stdin);
+            if(native_stdin_result == NULL)
+            {
+                fprintf(stderr, "native setup failed: cannot make standard input deterministic\n");
+                native_child_status = 77;
+                goto native_child_done_;
+            }
+            native_err = p101_error_create(false);
+            if(native_err == NULL)
+            {
+                native_child_status = 77;
+                goto native_child_done_;
+            }
+            native_env = p101_env_create(native_err, NULL);
+            if(native_env == NULL)
+            {
+                native_child_status = 77;
+                goto native_child_done_;
+            }
+            int8_t native_result = p101_parse_positive_int8_t_n(native_env, native_err, "1", 1, 0);
+            (void)native_result;
+            if(p101_error_has_error(native_err))
+            {
+                bool native_error_declared = false;
+
+                for(size_t native_error_index = 0U; native_error_index < sizeof(errors) / sizeof(errors[0]); native_error_index++)
+                {
+                    if(p101_error_is_errno(native_err, errors[native_error_index]))
+                    {
+                        native_error_declared = true;
+                    }
+                }
+                if(!native_error_declared)
+                {
+                    fprintf(stderr, "native smoke produced an undeclared platform failure: p101_parse_positive_int8_t_n: %s\n", p101_error_get_message(native_err));
+                    native_passed = false;
+                }
+                p101_error_reset(native_err);
+            }
+            native_child_status = native_passed ? EXIT_SUCCESS : EXIT_FAILURE;
+        native_child_done_:
+            p101_env_destroy(native_env);
+            p101_error_destroy(native_err);
+        }
+        if(native_pid > 0)
+        {
+            EXPECT(native_waitpid_nointr(native_pid, &native_status) == native_pid);
+            if(WIFSIGNALED(native_status))
+            {
+                fprintf(stderr, "native smoke terminated by signal: p101_parse_positive_int8_t_n: %d\n", WTERMSIG(native_status));
+            }
+            EXPECT(WIFEXITED(native_status));
+            if(WIFEXITED(native_status) && WEXITSTATUS(native_status) == 77)
+            {
+                fprintf(stderr, "native smoke fixture unavailable: p101_parse_positive_int8_t_n\n");
+            }
+            else if(WIFEXITED(native_status))
+            {
+                if(WEXITSTATUS(native_status) != EXIT_SUCCESS)
+                {
+                    fprintf(stderr, "native smoke exited unsuccessfully: p101_parse_positive_int8_t_n: %d\n", WEXITSTATUS(native_status));
+                }
+                EXPECT(WEXITSTATUS(native_status) == EXIT_SUCCESS);
+            }
+        }
+        p101_error_reset(err);
+    }
+}
+
+/* P101_TEST_CASE(p101_parse_positive_int8_t_prefix) */
+static void test_p101_parse_positive_int8_t_prefix(struct p101_env *env, struct p101_error *err)
+{
+#ifdef __linux__
+    static const int         errors[]      = {EIO};
+    static const char *const error_names[] = {"EIO"};
+#elif defined(__APPLE__)
+    static const int         errors[]      = {EIO};
+    static const char *const error_names[] = {"EIO"};
+#elif defined(__FreeBSD__)
+    static const int         errors[]      = {EIO};
+    static const char *const error_names[] = {"EIO"};
+#else
+    static const int         errors[]      = {EIO};
+    static const char *const error_names[] = {"EIO"};
+#endif
+
+    for(size_t index = 0U; index < sizeof(errors) / sizeof(errors[0]); index++)
+    {
+        struct fault_state state = {0, errors[index]};
+        int                failures_before;
+
+        failures_before = failures;
+        EXPECT(p101_error_has_no_error(err));
+        fault_resource_events = 0U;
+        errno                 = P101_TEST_ERRNO_SENTINEL;
+        p101_env_set_fault_injector(env, fail_next_call, &state);
+        int8_t result = p101_parse_positive_int8_t_prefix(env, err, NULL, NULL, 0);
+        (void)result;
+        EXPECT(state.checks == 1);
+        EXPECT(p101_error_is_errno(err, state.code));
+        EXPECT(errno == P101_TEST_ERRNO_SENTINEL);
+        EXPECT(result == (0));
+        EXPECT(fault_resource_events == 0U);
+        write_outcome("p101_parse_positive_int8_t_prefix", "errno", error_names[index], state.code, failures == failures_before);
+        p101_error_reset(err);
+    }
+    p101_env_set_fault_injector(env, NULL, NULL);
+    {
+        int   native_status = 0;
+        pid_t native_pid    = fork();
+
+        EXPECT(native_pid >= 0);
+        if(native_pid == 0)
+        {
+            bool               native_passed = true;
+            struct p101_error *native_err    = NULL;
+            struct p101_env   *native_env    = NULL;
+            FILE              *native_stdin_result;
+
+            native_child_process = true;
+            failures             = 0;
+            (void)alarm(2U);
+            if(unsetenv("P101_CALL_LOG") != 0 || unsetenv("P101_RESOURCE_LOG") != 0)
+            {
+                fprintf(stderr, "native setup failed: cannot clear p101 logging environment\n");
+                native_child_status = 77;
+                goto native_child_done_;
+            }
+            native_stdin_result = freopen("/dev/null", "r", stdin);
+            if(native_stdin_result == NULL)
+            {
+                fprintf(stderr, "native setup failed: cannot make standard input deterministic\n");
+                native_child_status = 77;
+                goto native_child_done_;
+            }
+            native_err = p101_error_create(false);
+            if(native_err == NULL)
+            {
+                native_child_status = 77;
+                goto native_child_done_;
+            }
+            native_env = p101_env_create(native_err, NULL);
+            if(native_env == NULL)
+            {
+                native_child_status = 77;
+                goto native_child_done_;
+            }
+            const char *native_argument_3 = NULL;
+            int8_t      native_result     = p101_parse_positive_int8_t_prefix(native_env, native_err, "1", &native_argument_3, 0);
+            (void)native_result;
+            if(p101_error_has_error(native_err))
+            {
+                bool native_error_declared = false;
+
+                for(size_t native_error_index = 0U; native_error_index < sizeof(errors) / sizeof(errors[0]); native_error_index++)
+                {
+                    if(p101_error_is_errno(native_err, errors[native_error_index]))
+                    {
+                        native_error_declared = true;
+                    }
+                }
+                if(!native_error_declared)
+                {
+                    fprintf(stderr, "native smoke produced an undeclared platform failure: p101_parse_positive_int8_t_prefix: %s\n", p101_error_get_message(native_err));
+                    native_passed = false;
+                }
+                p101_error_reset(native_err);
+            }
+            native_child_status = native_passed ? EXIT_SUCCESS : EXIT_FAILURE;
+        native_child_done_:
+            p101_env_destroy(native_env);
+            p101_error_destroy(native_err);
+        }
+        if(native_pid > 0)
+        {
+            EXPECT(native_waitpid_nointr(native_pid, &native_status) == native_pid);
+            if(WIFSIGNALED(native_status))
+            {
+                fprintf(stderr, "native smoke terminated by signal: p101_parse_positive_int8_t_prefix: %d\n", WTERMSIG(native_status));
+            }
+            EXPECT(WIFEXITED(native_status));
+            if(WIFEXITED(native_status) && WEXITSTATUS(native_status) == 77)
+            {
+                fprintf(stderr, "native smoke fixture unavailable: p101_parse_positive_int8_t_prefix\n");
+            }
+            else if(WIFEXITED(native_status))
+            {
+                if(WEXITSTATUS(native_status) != EXIT_SUCCESS)
+                {
+                    fprintf(stderr, "native smoke exited unsuccessfully: p101_parse_positive_int8_t_prefix: %d\n", WEXITSTATUS(native_status));
+                }
+                EXPECT(WEXITSTATUS(native_status) == EXIT_SUCCESS);
+            }
+        }
+        p101_error_reset(err);
+    }
+}
+
+/* P101_TEST_CASE(p101_parse_positive_int_n) */
+static void test_p101_parse_positive_int_n(struct p101_env *env, struct p101_error *err)
+{
+#ifdef __linux__
+    static const int         errors[]      = {EIO};
+    static const char *const error_names[] = {"EIO"};
+#elif defined(__APPLE__)
+    static const int         errors[]      = {EIO};
+    static const char *const error_names[] = {"EIO"};
+#elif defined(__FreeBSD__)
+    static const int         errors[]      = {EIO};
+    static const char *const error_names[] = {"EIO"};
+#else
+    static const int         errors[]      = {EIO};
+    static const char *const error_names[] = {"EIO"};
+#endif
+
+    for(size_t index = 0U; index < sizeof(errors) / sizeof(errors[0]); index++)
+    {
+        struct fault_state state = {0, errors[index]};
+        int                failures_before;
+
+        failures_before = failures;
+        EXPECT(p101_error_has_no_error(err));
+        fault_resource_events = 0U;
+        errno                 = P101_TEST_ERRNO_SENTINEL;
+        p101_env_set_fault_injector(env, fail_next_call, &state);
+        int result = p101_parse_positive_int_n(env, err, NULL, 0, 0);
+        (void)result;
+        EXPECT(state.checks == 1);
+        EXPECT(p101_error_is_errno(err, state.code));
+        EXPECT(errno == P101_TEST_ERRNO_SENTINEL);
+        EXPECT(result == (0));
+        EXPECT(fault_resource_events == 0U);
+        write_outcome("p101_parse_positive_int_n", "errno", error_names[index], state.code, failures == failures_before);
+        p101_error_reset(err);
+    }
+    p101_env_set_fault_injector(env, NULL, NULL);
+    {
+        int   native_status = 0;
+        pid_t native_pid    = fork();
+
+        EXPECT(native_pid >= 0);
+        if(native_pid == 0)
+        {
+            bool               native_passed = true;
+            struct p101_error *native_err    = NULL;
+            struct p101_env   *native_env    = NULL;
+            FILE              *native_stdin_result;
+
+            native_child_process = true;
+            failures             = 0;
+            (void)alarm(2U);
+            if(unsetenv("P101_CALL_LOG") != 0 || unsetenv("P101_RESOURCE_LOG") != 0)
+            {
+                fprintf(stderr, "native setup failed: cannot clear p101 logging environment\n");
+                native_child_status = 77;
+                goto native_child_done_;
+            }
+            native_stdin_result = freopen("/dev/null", "r", stdin);
+            if(native_stdin_result == NULL)
+            {
+                fprintf(stderr, "native setup failed: cannot make standard input deterministic\n");
+                native_child_status = 77;
+                goto native_child_done_;
+            }
+            native_err = p101_error_create(false);
+            if(native_err == NULL)
+            {
+                native_child_status = 77;
+                goto native_child_done_;
+            }
+            native_env = p101_env_create(native_err, NULL);
+            if(native_env == NULL)
+            {
+                native_child_status = 77;
+                goto native_child_done_;
+            }
+            int native_result = p101_parse_positive_int_n(native_env, native_err, "1", 1, 0);
+            (void)native_result;
+            if(p101_error_has_error(native_err))
+            {
+                bool native_error_declared = false;
+
+                for(size_t native_error_index = 0U; native_error_index < sizeof(errors) / sizeof(errors[0]); native_error_index++)
+                {
+                    if(p101_error_is_errno(native_err, errors[native_error_index]))
+                    {
+                        native_error_declared = true;
+                    }
+                }
+                if(!native_error_declared)
+                {
+                    fprintf(stderr, "native smoke produced an undeclared platform failure: p101_parse_positive_int_n: %s\n", p101_error_get_message(native_err));
+                    native_passed = false;
+                }
+                p101_error_reset(native_err);
+            }
+            native_child_status = native_passed ? EXIT_SUCCESS : EXIT_FAILURE;
+        native_child_done_:
+            p101_env_destroy(native_env);
+            p101_error_destroy(native_err);
+        }
+        if(native_pid > 0)
+        {
+            EXPECT(native_waitpid_nointr(native_pid, &native_status) == native_pid);
+            if(WIFSIGNALED(native_status))
+            {
+                fprintf(stderr, "native smoke terminated by signal: p101_parse_positive_int_n: %d\n", WTERMSIG(native_status));
+            }
+            EXPECT(WIFEXITED(native_status));
+            if(WIFEXITED(native_status) && WEXITSTATUS(native_status) == 77)
+            {
+                fprintf(stderr, "native smoke fixture unavailable: p101_parse_positive_int_n\n");
+            }
+            else if(WIFEXITED(native_status))
+            {
+                if(WEXITSTATUS(native_status) != EXIT_SUCCESS)
+                {
+                    fprintf(stderr, "native smoke exited unsuccessfully: p101_parse_positive_int_n: %d\n", WEXITSTATUS(native_status));
+                }
+                EXPECT(WEXITSTATUS(native_status) == EXIT_SUCCESS);
+            }
+        }
+        p101_error_reset(err);
+    }
+}
+
+/* P101_TEST_CASE(p101_parse_positive_int_prefix) */
+static void test_p101_parse_positive_int_prefix(struct p101_env *env, struct p101_error *err)
+{
+#ifdef __linux__
+    static const int         errors[]      = {EIO};
+    static const char *const error_names[] = {"EIO"};
+#elif defined(__APPLE__)
+    static const int         errors[]      = {EIO};
+    static const char *const error_names[] = {"EIO"};
+#elif defined(__FreeBSD__)
+    static const int         errors[]      = {EIO};
+    static const char *const error_names[] = {"EIO"};
+#else
+    static const int         errors[]      = {EIO};
+    static const char *const error_names[] = {"EIO"};
+#endif
+
+    for(size_t index = 0U; index < sizeof(errors) / sizeof(errors[0]); index++)
+    {
+        struct fault_state state = {0, errors[index]};
+        int                failures_before;
+
+        failures_before = failures;
+        EXPECT(p101_error_has_no_error(err));
+        fault_resource_events = 0U;
+        errno                 = P101_TEST_ERRNO_SENTINEL;
+        p101_env_set_fault_injector(env, fail_next_call, &state);
+        int result = p101_parse_positive_int_prefix(env, err, NULL, NULL, 0);
+        (void)result;
+        EXPECT(state.checks == 1);
+        EXPECT(p101_error_is_errno(err, state.code));
+        EXPECT(errno == P101_TEST_ERRNO_SENTINEL);
+        EXPECT(result == (0));
+        EXPECT(fault_resource_events == 0U);
+        write_outcome("p101_parse_positive_int_prefix", "errno", error_names[index], state.code, failures == failures_before);
+        p101_error_reset(err);
+    }
+    p101_env_set_fault_injector(env, NULL, NULL);
+    {
+        int   native_status = 0;
+        pid_t native_pid    = fork();
+
+        EXPECT(native_pid >= 0);
+        if(native_pid == 0)
+        {
+            bool               native_passed = true;
+            struct p101_error *native_err    = NULL;
+            struct p101_env   *native_env    = NULL;
+            FILE              *native_stdin_result;
+
+            native_child_process = true;
+            failures             = 0;
+            (void)alarm(2U);
+            if(unsetenv("P101_CALL_LOG") != 0 || unsetenv("P101_RESOURCE_LOG") != 0)
+            {
+                fprintf(stderr, "native setup failed: cannot clear p101 logging environment\n");
+                native_child_status = 77;
+                goto native_child_done_;
+            }
+            native_stdin_result = freopen("/dev/null", "r", stdin);
+            if(native_stdin_result == NULL)
+            {
+                fprintf(stderr, "native setup failed: cannot make standard input deterministic\n");
+                native_child_status = 77;
+                goto native_child_done_;
+            }
+            native_err = p101_error_create(false);
+            if(native_err == NULL)
+            {
+                native_child_status = 77;
+                goto native_child_done_;
+            }
+            native_env = p101_env_create(native_err, NULL);
+            if(native_env == NULL)
+            {
+                native_child_status = 77;
+                goto native_child_done_;
+            }
+            const char *native_argument_3 = NULL;
+            int         native_result     = p101_parse_positive_int_prefix(native_env, native_err, "1", &native_argument_3, 0);
+            (void)native_result;
+            if(p101_error_has_error(native_err))
+            {
+                bool native_error_declared = false;
+
+                for(size_t native_error_index = 0U; native_error_index < sizeof(errors) / sizeof(errors[0]); native_error_index++)
+                {
+                    if(p101_error_is_errno(native_err, errors[native_error_index]))
+                    {
+                        native_error_declared = true;
+                    }
+                }
+                if(!native_error_declared)
+                {
+                    fprintf(stderr, "native smoke produced an undeclared platform failure: p101_parse_positive_int_prefix: %s\n", p101_error_get_message(native_err));
+                    native_passed = false;
+                }
+                p101_error_reset(native_err);
+            }
+            native_child_status = native_passed ? EXIT_SUCCESS : EXIT_FAILURE;
+        native_child_done_:
+            p101_env_destroy(native_env);
+            p101_error_destroy(native_err);
+        }
+        if(native_pid > 0)
+        {
+            EXPECT(native_waitpid_nointr(native_pid, &native_status) == native_pid);
+            if(WIFSIGNALED(native_status))
+            {
+                fprintf(stderr, "native smoke terminated by signal: p101_parse_positive_int_prefix: %d\n", WTERMSIG(native_status));
+            }
+            EXPECT(WIFEXITED(native_status));
+            if(WIFEXITED(native_status) && WEXITSTATUS(native_status) == 77)
+            {
+                fprintf(stderr, "native smoke fixture unavailable: p101_parse_positive_int_prefix\n");
+            }
+            else if(WIFEXITED(native_status))
+            {
+                if(WEXITSTATUS(native_status) != EXIT_SUCCESS)
+                {
+                    fprintf(stderr, "native smoke exited unsuccessfully: p101_parse_positive_int_prefix: %d\n", WEXITSTATUS(native_status));
+                }
+                EXPECT(WEXITSTATUS(native_status) == EXIT_SUCCESS);
+            }
+        }
+        p101_error_reset(err);
+    }
+}
+
+/* P101_TEST_CASE(p101_parse_positive_long) */
+static void test_p101_parse_positive_long(struct p101_env *env, struct p101_error *err)
+{
+#ifdef __linux__
+    static const int         errors[]      = {EIO};
+    static const char *const error_names[] = {"EIO"};
+#elif defined(__APPLE__)
+    static const int         errors[]      = {EIO};
+    static const char *const error_names[] = {"EIO"};
+#elif defined(__FreeBSD__)
+    static const int         errors[]      = {EIO};
+    static const char *const error_names[] = {"EIO"};
+#else
+    static const int         errors[]      = {EIO};
+    static const char *const error_names[] = {"EIO"};
+#endif
+
+    for(size_t index = 0U; index < sizeof(errors) / sizeof(errors[0]); index++)
+    {
+        struct fault_state state = {0, errors[index]};
+        int                failures_before;
+
+        failures_before = failures;
+        EXPECT(p101_error_has_no_error(err));
+        fault_resource_events = 0U;
+        errno                 = P101_TEST_ERRNO_SENTINEL;
+        p101_env_set_fault_injector(env, fail_next_call, &state);
+        long result = p101_parse_positive_long(env, err, NULL, 0);
+        (void)result;
+        EXPECT(state.checks == 1);
+        EXPECT(p101_error_is_errno(err, state.code));
+        EXPECT(errno == P101_TEST_ERRNO_SENTINEL);
+        EXPECT(result == (0));
+        EXPECT(fault_resource_events == 0U);
+        write_outcome("p101_parse_positive_long", "errno", error_names[index], state.code, failures == failures_before);
+        p101_error_reset(err);
+    }
+    p101_env_set_fault_injector(env, NULL, NULL);
+    {
+        int   native_status = 0;
+        pid_t native_pid    = fork();
+
+        EXPECT(native_pid >= 0);
+        if(native_pid == 0)
+        {
+            bool               native_passed = true;
+            struct p101_error *native_err    = NULL;
+            struct p101_env   *native_env    = NULL;
+            FILE              *native_stdin_result;
+
+            native_child_process = true;
+            failures             = 0;
+            (void)alarm(2U);
+            if(unsetenv("P101_CALL_LOG") != 0 || unsetenv("P101_RESOURCE_LOG") != 0)
+            {
+                fprintf(stderr, "native setup failed: cannot clear p101 logging environment\n");
+                native_child_status = 77;
+                goto native_child_done_;
+            }
+            native_stdin_result = freopen("/dev/null", "r", stdin);
+            if(native_stdin_result == NULL)
+            {
+                fprintf(stderr, "native setup failed: cannot make standard input deterministic\n");
+                native_child_status = 77;
+                goto native_child_done_;
+            }
+            native_err = p101_error_create(false);
+            if(native_err == NULL)
+            {
+                native_child_status = 77;
+                goto native_child_done_;
+            }
+            native_env = p101_env_create(native_err, NULL);
+            if(native_env == NULL)
+            {
+                native_child_status = 77;
+                goto native_child_done_;
+            }
+            long native_result = p101_parse_positive_long(native_env, native_err, "1", 0);
+            (void)native_result;
+            if(p101_error_has_error(native_err))
+            {
+                bool native_error_declared = false;
+
+                for(size_t native_error_index = 0U; native_error_index < sizeof(errors) / sizeof(errors[0]); native_error_index++)
+                {
+                    if(p101_error_is_errno(native_err, errors[native_error_index]))
+                    {
+                        native_error_declared = true;
+                    }
+                }
+                if(!native_error_declared)
+                {
+                    fprintf(stderr, "native smoke produced an undeclared platform failure: p101_parse_positive_long: %s\n", p101_error_get_message(native_err));
+                    native_passed = false;
+                }
+                p101_error_reset(native_err);
+            }
+            native_child_status = native_passed ? EXIT_SUCCESS : EXIT_FAILURE;
+        native_child_done_:
+            p101_env_destroy(native_env);
+            p101_error_destroy(native_err);
+        }
+        if(native_pid > 0)
+        {
+            EXPECT(native_waitpid_nointr(native_pid, &native_status) == native_pid);
+            if(WIFSIGNALED(native_status))
+            {
+                fprintf(stderr, "native smoke terminated by signal: p101_parse_positive_long: %d\n", WTERMSIG(native_status));
+            }
+            EXPECT(WIFEXITED(native_status));
+            if(WIFEXITED(native_status) && WEXITSTATUS(native_status) == 77)
+            {
+                fprintf(stderr, "native smoke fixture unavailable: p101_parse_positive_long\n");
+            }
+            else if(WIFEXITED(native_status))
+            {
+                if(WEXITSTATUS(native_status) != EXIT_SUCCESS)
+                {
+                    fprintf(stderr, "native smoke exited unsuccessfully: p101_parse_positive_long: %d\n", WEXITSTATUS(native_status));
+                }
+                EXPECT(WEXITSTATUS(native_status) == EXIT_SUCCESS);
+            }
+        }
+        p101_error_reset(err);
+    }
+}
+
+/* P101_TEST_CASE(p101_parse_positive_long_long) */
+static void test_p101_parse_positive_long_long(struct p101_env *env, struct p101_error *err)
+{
+#ifdef __linux__
+    static const int         errors[]      = {EIO};
+    static const char *const error_names[] = {"EIO"};
+#elif defined(__APPLE__)
+    static const int         errors[]      = {EIO};
+    static const char *const error_names[] = {"EIO"};
+#elif defined(__FreeBSD__)
+    static const int         errors[]      = {EIO};
+    static const char *const error_names[] = {"EIO"};
+#else
+    static const int         errors[]      = {EIO};
+    static const char *const error_names[] = {"EIO"};
+#endif
+
+    for(size_t index = 0U; index < sizeof(errors) / sizeof(errors[0]); index++)
+    {
+        struct fault_state state = {0, errors[index]};
+        int                failures_before;
+
+        failures_before = failures;
+        EXPECT(p101_error_has_no_error(err));
+        fault_resource_events = 0U;
+        errno                 = P101_TEST_ERRNO_SENTINEL;
+        p101_env_set_fault_injector(env, fail_next_call, &state);
+        long long result = p101_parse_positive_long_long(env, err, NULL, 0);
+        (void)result;
+        EXPECT(state.checks == 1);
+        EXPECT(p101_error_is_errno(err, state.code));
+        EXPECT(errno == P101_TEST_ERRNO_SENTINEL);
+        EXPECT(result == (0));
+        EXPECT(fault_resource_events == 0U);
+        write_outcome("p101_parse_positive_long_long", "errno", error_names[index], state.code, failures == failures_before);
+        p101_error_reset(err);
+    }
+    p101_env_set_fault_injector(env, NULL, NULL);
+    {
+        int   native_status = 0;
+        pid_t native_pid    = fork();
+
+        EXPECT(native_pid >= 0);
+        if(native_pid == 0)
+        {
+            bool               native_passed = true;
+            struct p101_error *native_err    = NULL;
+            struct p101_env   *native_env    = NULL;
+            FILE              *native_stdin_result;
+
+            native_child_process = true;
+            failures             = 0;
+            (void)alarm(2U);
+            if(unsetenv("P101_CALL_LOG") != 0 || unsetenv("P101_RESOURCE_LOG") != 0)
+            {
+                fprintf(stderr, "native setup failed: cannot clear p101 logging environment\n");
+                native_child_status = 77;
+                goto native_child_done_;
+            }
+            native_stdin_result = freopen("/dev/null", "r", stdin);
+            if(native_stdin_result == NULL)
+            {
+                fprintf(stderr, "native setup failed: cannot make standard input deterministic\n");
+                native_child_status = 77;
+                goto native_child_done_;
+            }
+            native_err = p101_error_create(false);
+            if(native_err == NULL)
+            {
+                native_child_status = 77;
+                goto native_child_done_;
+            }
+            native_env = p101_env_create(native_err, NULL);
+            if(native_env == NULL)
+            {
+                native_child_status = 77;
+                goto native_child_done_;
+            }
+            long long native_result = p101_parse_positive_long_long(native_env, native_err, "1", 0);
+            (void)native_result;
+            if(p101_error_has_error(native_err))
+            {
+                bool native_error_declared = false;
+
+                for(size_t native_error_index = 0U; native_error_index < sizeof(errors) / sizeof(errors[0]); native_error_index++)
+                {
+                    if(p101_error_is_errno(native_err, errors[native_error_index]))
+                    {
+                        native_error_declared = true;
+                    }
+                }
+                if(!native_error_declared)
+                {
+                    fprintf(stderr, "native smoke produced an undeclared platform failure: p101_parse_positive_long_long: %s\n", p101_error_get_message(native_err));
+                    native_passed = false;
+                }
+                p101_error_reset(native_err);
+            }
+            native_child_status = native_passed ? EXIT_SUCCESS : EXIT_FAILURE;
+        native_child_done_:
+            p101_env_destroy(native_env);
+            p101_error_destroy(native_err);
+        }
+        if(native_pid > 0)
+        {
+            EXPECT(native_waitpid_nointr(native_pid, &native_status) == native_pid);
+            if(WIFSIGNALED(native_status))
+            {
+                fprintf(stderr, "native smoke terminated by signal: p101_parse_positive_long_long: %d\n", WTERMSIG(native_status));
+            }
+            EXPECT(WIFEXITED(native_status));
+            if(WIFEXITED(native_status) && WEXITSTATUS(native_status) == 77)
+            {
+                fprintf(stderr, "native smoke fixture unavailable: p101_parse_positive_long_long\n");
+            }
+            else if(WIFEXITED(native_status))
+            {
+                if(WEXITSTATUS(native_status) != EXIT_SUCCESS)
+                {
+                    fprintf(stderr, "native smoke exited unsuccessfully: p101_parse_positive_long_long: %d\n", WEXITSTATUS(native_status));
+                }
+                EXPECT(WEXITSTATUS(native_status) == EXIT_SUCCESS);
+            }
+        }
+        p101_error_reset(err);
+    }
+}
+
+/* P101_TEST_CASE(p101_parse_positive_long_long_n) */
+static void test_p101_parse_positive_long_long_n(struct p101_env *env, struct p101_error *err)
+{
+#ifdef __linux__
+    static const int         errors[]      = {EIO};
+    static const char *const error_names[] = {"EIO"};
+#elif defined(__APPLE__)
+    static const int         errors[]      = {EIO};
+    static const char *const error_names[] = {"EIO"};
+#elif defined(__FreeBSD__)
+    static const int         errors[]      = {EIO};
+    static const char *const error_names[] = {"EIO"};
+#else
+    static const int         errors[]      = {EIO};
+    static const char *const error_names[] = {"EIO"};
+#endif
+
+    for(size_t index = 0U; index < sizeof(errors) / sizeof(errors[0]); index++)
+    {
+        struct fault_state state = {0, errors[index]};
+        int                failures_before;
+
+        failures_before = failures;
+        EXPECT(p101_error_has_no_error(err));
+        fault_resource_events = 0U;
+        errno                 = P101_TEST_ERRNO_SENTINEL;
+        p101_env_set_fault_injector(env, fail_next_call, &state);
+        long long result = p101_parse_positive_long_long_n(env, err, NULL, 0, 0);
+        (void)result;
+        EXPECT(state.checks == 1);
+        EXPECT(p101_error_is_errno(err, state.code));
+        EXPECT(errno == P101_TEST_ERRNO_SENTINEL);
+        EXPECT(result == (0));
+        EXPECT(fault_resource_events == 0U);
+        write_outcome("p101_parse_positive_long_long_n", "errno", error_names[index], state.code, failures == failures_before);
+        p101_error_reset(err);
+    }
+    p101_env_set_fault_injector(env, NULL, NULL);
+    {
+        int   native_status = 0;
+        pid_t native_pid    = fork();
+
+        EXPECT(native_pid >= 0);
+        if(native_pid == 0)
+        {
+            bool               native_passed = true;
+            struct p101_error *native_err    = NULL;
+            struct p101_env   *native_env    = NULL;
+            FILE              *native_stdin_result;
+
+            native_child_process = true;
+            failures             = 0;
+            (void)alarm(2U);
+            if(unsetenv("P101_CALL_LOG") != 0 || unsetenv("P101_RESOURCE_LOG") != 0)
+            {
+                fprintf(stderr, "native setup failed: cannot clear p101 logging environment\n");
+                native_child_status = 77;
+                goto native_child_done_;
+            }
+            native_stdin_result = freopen("/dev/null", "r", stdin);
+            if(native_stdin_result == NULL)
+            {
+                fprintf(stderr, "native setup failed: cannot make standard input deterministic\n");
+                native_child_status = 77;
+                goto native_child_done_;
+            }
+            native_err = p101_error_create(false);
+            if(native_err == NULL)
+            {
+                native_child_status = 77;
+                goto native_child_done_;
+            }
+            native_env = p101_env_create(native_err, NULL);
+            if(native_env == NULL)
+            {
+                native_child_status = 77;
+                goto native_child_done_;
+            }
+            long long native_result = p101_parse_positive_long_long_n(native_env, native_err, "1", 1, 0);
+            (void)native_result;
+            if(p101_error_has_error(native_err))
+            {
+                bool native_error_declared = false;
+
+                for(size_t native_error_index = 0U; native_error_index < sizeof(errors) / sizeof(errors[0]); native_error_index++)
+                {
+                    if(p101_error_is_errno(native_err, errors[native_error_index]))
+                    {
+                        native_error_declared = true;
+                    }
+                }
+                if(!native_error_declared)
+                {
+                    fprintf(stderr, "native smoke produced an undeclared platform failure: p101_parse_positive_long_long_n: %s\n", p101_error_get_message(native_err));
+                    native_passed = false;
+                }
+                p101_error_reset(native_err);
+            }
+            native_child_status = native_passed ? EXIT_SUCCESS : EXIT_FAILURE;
+        native_child_done_:
+            p101_env_destroy(native_env);
+            p101_error_destroy(native_err);
+        }
+        if(native_pid > 0)
+        {
+            EXPECT(native_waitpid_nointr(native_pid, &native_status) == native_pid);
+            if(WIFSIGNALED(native_status))
+            {
+                fprintf(stderr, "native smoke terminated by signal: p101_parse_positive_long_long_n: %d\n", WTERMSIG(native_status));
+            }
+            EXPECT(WIFEXITED(native_status));
+            if(WIFEXITED(native_status) && WEXITSTATUS(native_status) == 77)
+            {
+                fprintf(stderr, "native smoke fixture unavailable: p101_parse_positive_long_long_n\n");
+            }
+            else if(WIFEXITED(native_status))
+            {
+                if(WEXITSTATUS(native_status) != EXIT_SUCCESS)
+                {
+                    fprintf(stderr, "native smoke exited unsuccessfully: p101_parse_positive_long_long_n: %d\n", WEXITSTATUS(native_status));
+                }
+                EXPECT(WEXITSTATUS(native_status) == EXIT_SUCCESS);
+            }
+        }
+        p101_error_reset(err);
+    }
+}
+
+/* P101_TEST_CASE(p101_parse_positive_long_long_prefix) */
+static void test_p101_parse_positive_long_long_prefix(struct p101_env *env, struct p101_error *err)
+{
+#ifdef __linux__
+    static const int         errors[]      = {EIO};
+    static const char *const error_names[] = {"EIO"};
+#elif defined(__APPLE__)
+    static const int         errors[]      = {EIO};
+    static const char *const error_names[] = {"EIO"};
+#elif defined(__FreeBSD__)
+    static const int         errors[]      = {EIO};
+    static const char *const error_names[] = {"EIO"};
+#else
+    static const int         errors[]      = {EIO};
+    static const char *const error_names[] = {"EIO"};
+#endif
+
+    for(size_t index = 0U; index < sizeof(errors) / sizeof(errors[0]); index++)
+    {
+        struct fault_state state = {0, errors[index]};
+        int                failures_before;
+
+        failures_before = failures;
+        EXPECT(p101_error_has_no_error(err));
+        fault_resource_events = 0U;
+        errno                 = P101_TEST_ERRNO_SENTINEL;
+        p101_env_set_fault_injector(env, fail_next_call, &state);
+        long long result = p101_parse_positive_long_long_prefix(env, err, NULL, NULL, 0);
+        (void)result;
+        EXPECT(state.checks == 1);
+        EXPECT(p101_error_is_errno(err, state.code));
+        EXPECT(errno == P101_TEST_ERRNO_SENTINEL);
+        EXPECT(result == (0));
+        EXPECT(fault_resource_events == 0U);
+        write_outcome("p101_parse_positive_long_long_prefix", "errno", error_names[index], state.code, failures == failures_before);
+        p101_error_reset(err);
+    }
+    p101_env_set_fault_injector(env, NULL, NULL);
+    {
+        int   native_status = 0;
+        pid_t native_pid    = fork();
+
+        EXPECT(native_pid >= 0);
+        if(native_pid == 0)
+        {
+            bool               native_passed = true;
+            struct p101_error *native_err    = NULL;
+            struct p101_env   *native_env    = NULL;
+            FILE              *native_stdin_result;
+
+            native_child_process = true;
+            failures             = 0;
+            (void)alarm(2U);
+            if(unsetenv("P101_CALL_LOG") != 0 || unsetenv("P101_RESOURCE_LOG") != 0)
+            {
+                fprintf(stderr, "native setup failed: cannot clear p101 logging environment\n");
+                native_child_status = 77;
+                goto native_child_done_;
+            }
+            native_stdin_result = freopen("/dev/null", "r", stdin);
+            if(native_stdin_result == NULL)
+            {
+                fprintf(stderr, "native setup failed: cannot make standard input deterministic\n");
+                native_child_status = 77;
+                goto native_child_done_;
+            }
+            native_err = p101_error_create(false);
+            if(native_err == NULL)
+            {
+                native_child_status = 77;
+                goto native_child_done_;
+            }
+            native_env = p101_env_create(native_err, NULL);
+            if(native_env == NULL)
+            {
+                native_child_status = 77;
+                goto native_child_done_;
+            }
+            const char *native_argument_3 = NULL;
+            long long   native_result     = p101_parse_positive_long_long_prefix(native_env, native_err, "1", &native_argument_3, 0);
+            (void)native_result;
+            if(p101_error_has_error(native_err))
+            {
+                bool native_error_declared = false;
+
+                for(size_t native_error_index = 0U; native_error_index < sizeof(errors) / sizeof(errors[0]); native_error_index++)
+                {
+                    if(p101_error_is_errno(native_err, errors[native_error_index]))
+                    {
+                        native_error_declared = true;
+                    }
+                }
+                if(!native_error_declared)
+                {
+                    fprintf(stderr, "native smoke produced an undeclared platform failure: p101_parse_positive_long_long_prefix: %s\n", p101_error_get_message(native_err));
+                    native_passed = false;
+                }
+                p101_error_reset(native_err);
+            }
+            native_child_status = native_passed ? EXIT_SUCCESS : EXIT_FAILURE;
+        native_child_done_:
+            p101_env_destroy(native_env);
+            p101_error_destroy(native_err);
+        }
+        if(native_pid > 0)
+        {
+            EXPECT(native_waitpid_nointr(native_pid, &native_status) == native_pid);
+            if(WIFSIGNALED(native_status))
+            {
+                fprintf(stderr, "native smoke terminated by signal: p101_parse_positive_long_long_prefix: %d\n", WTERMSIG(native_status));
+            }
+            EXPECT(WIFEXITED(native_status));
+            if(WIFEXITED(native_status) && WEXITSTATUS(native_status) == 77)
+            {
+                fprintf(stderr, "native smoke fixture unavailable: p101_parse_positive_long_long_prefix\n");
+            }
+            else if(WIFEXITED(native_status))
+            {
+                if(WEXITSTATUS(native_status) != EXIT_SUCCESS)
+                {
+                    fprintf(stderr, "native smoke exited unsuccessfully: p101_parse_positive_long_long_prefix: %d\n", WEXITSTATUS(native_status));
+                }
+                EXPECT(WEXITSTATUS(native_status) == EXIT_SUCCESS);
+            }
+        }
+        p101_error_reset(err);
+    }
+}
+
+/* P101_TEST_CASE(p101_parse_positive_long_n) */
+static void test_p101_parse_positive_long_n(struct p101_env *env, struct p101_error *err)
+{
+#ifdef __linux__
+    static const int         errors[]      = {EIO};
+    static const char *const error_names[] = {"EIO"};
+#elif defined(__APPLE__)
+    static const int         errors[]      = {EIO};
+    static const char *const error_names[] = {"EIO"};
+#elif defined(__FreeBSD__)
+    static const int         errors[]      = {EIO};
+    static const char *const error_names[] = {"EIO"};
+#else
+    static const int         errors[]      = {EIO};
+    static const char *const error_names[] = {"EIO"};
+#endif
+
+    for(size_t index = 0U; index < sizeof(errors) / sizeof(errors[0]); index++)
+    {
+        struct fault_state state = {0, errors[index]};
+        int                failures_before;
+
+        failures_before = failures;
+        EXPECT(p101_error_has_no_error(err));
+        fault_resource_events = 0U;
+        errno                 = P101_TEST_ERRNO_SENTINEL;
+        p101_env_set_fault_injector(env, fail_next_call, &state);
+        long result = p101_parse_positive_long_n(env, err, NULL, 0, 0);
+        (void)result;
+        EXPECT(state.checks == 1);
+        EXPECT(p101_error_is_errno(err, state.code));
+        EXPECT(errno == P101_TEST_ERRNO_SENTINEL);
+        EXPECT(result == (0));
+        EXPECT(fault_resource_events == 0U);
+        write_outcome("p101_parse_positive_long_n", "errno", error_names[index], state.code, failures == failures_before);
+        p101_error_reset(err);
+    }
+    p101_env_set_fault_injector(env, NULL, NULL);
+    {
+        int   native_status = 0;
+        pid_t native_pid    = fork();
+
+        EXPECT(native_pid >= 0);
+        if(native_pid == 0)
+        {
+            bool               native_passed = true;
+            struct p101_error *native_err    = NULL;
+            struct p101_env   *native_env    = NULL;
+            FILE              *native_stdin_result;
+
+            native_child_process = true;
+            failures             = 0;
+            (void)alarm(2U);
+            if(unsetenv("P101_CALL_LOG") != 0 || unsetenv("P101_RESOURCE_LOG") != 0)
+            {
+                fprintf(stderr, "native setup failed: cannot clear p101 logging environment\n");
+                native_child_status = 77;
+                goto native_child_done_;
+            }
+            native_stdin_result = freopen("/dev/null", "r", stdin);
+            if(native_stdin_result == NULL)
+            {
+                fprintf(stderr, "native setup failed: cannot make standard input deterministic\n");
+                native_child_status = 77;
+                goto native_child_done_;
+            }
+            native_err = p101_error_create(false);
+            if(native_err == NULL)
+            {
+                native_child_status = 77;
+                goto native_child_done_;
+            }
+            native_env = p101_env_create(native_err, NULL);
+            if(native_env == NULL)
+            {
+                native_child_status = 77;
+                goto native_child_done_;
+            }
+            long native_result = p101_parse_positive_long_n(native_env, native_err, "1", 1, 0);
+            (void)native_result;
+            if(p101_error_has_error(native_err))
+            {
+                bool native_error_declared = false;
+
+                for(size_t native_error_index = 0U; native_error_index < sizeof(errors) / sizeof(errors[0]); native_error_index++)
+                {
+                    if(p101_error_is_errno(native_err, errors[native_error_index]))
+                    {
+                        native_error_declared = true;
+                    }
+                }
+                if(!native_error_declared)
+                {
+                    fprintf(stderr, "native smoke produced an undeclared platform failure: p101_parse_positive_long_n: %s\n", p101_error_get_message(native_err));
+                    native_passed = false;
+                }
+                p101_error_reset(native_err);
+            }
+            native_child_status = native_passed ? EXIT_SUCCESS : EXIT_FAILURE;
+        native_child_done_:
+            p101_env_destroy(native_env);
+            p101_error_destroy(native_err);
+        }
+        if(native_pid > 0)
+        {
+            EXPECT(native_waitpid_nointr(native_pid, &native_status) == native_pid);
+            if(WIFSIGNALED(native_status))
+            {
+                fprintf(stderr, "native smoke terminated by signal: p101_parse_positive_long_n: %d\n", WTERMSIG(native_status));
+            }
+            EXPECT(WIFEXITED(native_status));
+            if(WIFEXITED(native_status) && WEXITSTATUS(native_status) == 77)
+            {
+                fprintf(stderr, "native smoke fixture unavailable: p101_parse_positive_long_n\n");
+            }
+            else if(WIFEXITED(native_status))
+            {
+                if(WEXITSTATUS(native_status) != EXIT_SUCCESS)
+                {
+                    fprintf(stderr, "native smoke exited unsuccessfully: p101_parse_positive_long_n: %d\n", WEXITSTATUS(native_status));
+                }
+                EXPECT(WEXITSTATUS(native_status) == EXIT_SUCCESS);
+            }
+        }
+        p101_error_reset(err);
+    }
+}
+
+/* P101_TEST_CASE(p101_parse_positive_long_prefix) */
+static void test_p101_parse_positive_long_prefix(struct p101_env *env, struct p101_error *err)
+{
+#ifdef __linux__
+    static const int         errors[]      = {EIO};
+    static const char *const error_names[] = {"EIO"};
+#elif defined(__APPLE__)
+    static const int         errors[]      = {EIO};
+    static const char *const error_names[] = {"EIO"};
+#elif defined(__FreeBSD__)
+    static const int         errors[]      = {EIO};
+    static const char *const error_names[] = {"EIO"};
+#else
+    static const int         errors[]      = {EIO};
+    static const char *const error_names[] = {"EIO"};
+#endif
+
+    for(size_t index = 0U; index < sizeof(errors) / sizeof(errors[0]); index++)
+    {
+        struct fault_state state = {0, errors[index]};
+        int                failures_before;
+
+        failures_before = failures;
+        EXPECT(p101_error_has_no_error(err));
+        fault_resource_events = 0U;
+        errno                 = P101_TEST_ERRNO_SENTINEL;
+        p101_env_set_fault_injector(env, fail_next_call, &state);
+        long result = p101_parse_positive_long_prefix(env, err, NULL, NULL, 0);
+        (void)result;
+        EXPECT(state.checks == 1);
+        EXPECT(p101_error_is_errno(err, state.code));
+        EXPECT(errno == P101_TEST_ERRNO_SENTINEL);
+        EXPECT(result == (0));
+        EXPECT(fault_resource_events == 0U);
+        write_outcome("p101_parse_positive_long_prefix", "errno", error_names[index], state.code, failures == failures_before);
+        p101_error_reset(err);
+    }
+    p101_env_set_fault_injector(env, NULL, NULL);
+    {
+        int   native_status = 0;
+        pid_t native_pid    = fork();
+
+        EXPECT(native_pid >= 0);
+        if(native_pid == 0)
+        {
+            bool               native_passed = true;
+            struct p101_error *native_err    = NULL;
+            struct p101_env   *native_env    = NULL;
+            FILE              *native_stdin_result;
+
+            native_child_process = true;
+            failures             = 0;
+            (void)alarm(2U);
+            if(unsetenv("P101_CALL_LOG") != 0 || unsetenv("P101_RESOURCE_LOG") != 0)
+            {
+                fprintf(stderr, "native setup failed: cannot clear p101 logging environment\n");
+                native_child_status = 77;
+                goto native_child_done_;
+            }
+            native_stdin_result = freopen("/dev/null", "r", stdin);
+            if(native_stdin_result == NULL)
+            {
+                fprintf(stderr, "native setup failed: cannot make standard input deterministic\n");
+                native_child_status = 77;
+                goto native_child_done_;
+            }
+            native_err = p101_error_create(false);
+            if(native_err == NULL)
+            {
+                native_child_status = 77;
+                goto native_child_done_;
+            }
+            native_env = p101_env_create(native_err, NULL);
+            if(native_env == NULL)
+            {
+                native_child_status = 77;
+                goto native_child_done_;
+            }
+            const char *native_argument_3 = NULL;
+            long        native_result     = p101_parse_positive_long_prefix(native_env, native_err, "1", &native_argument_3, 0);
+            (void)native_result;
+            if(p101_error_has_error(native_err))
+            {
+                bool native_error_declared = false;
+
+                for(size_t native_error_index = 0U; native_error_index < sizeof(errors) / sizeof(errors[0]); native_error_index++)
+                {
+                    if(p101_error_is_errno(native_err, errors[native_error_index]))
+                    {
+                        native_error_declared = true;
+                    }
+                }
+                if(!native_error_declared)
+                {
+                    fprintf(stderr, "native smoke produced an undeclared platform failure: p101_parse_positive_long_prefix: %s\n", p101_error_get_message(native_err));
+                    native_passed = false;
+                }
+                p101_error_reset(native_err);
+            }
+            native_child_status = native_passed ? EXIT_SUCCESS : EXIT_FAILURE;
+        native_child_done_:
+            p101_env_destroy(native_env);
+            p101_error_destroy(native_err);
+        }
+        if(native_pid > 0)
+        {
+            EXPECT(native_waitpid_nointr(native_pid, &native_status) == native_pid);
+            if(WIFSIGNALED(native_status))
+            {
+                fprintf(stderr, "native smoke terminated by signal: p101_parse_positive_long_prefix: %d\n", WTERMSIG(native_status));
+            }
+            EXPECT(WIFEXITED(native_status));
+            if(WIFEXITED(native_status) && WEXITSTATUS(native_status) == 77)
+            {
+                fprintf(stderr, "native smoke fixture unavailable: p101_parse_positive_long_prefix\n");
+            }
+            else if(WIFEXITED(native_status))
+            {
+                if(WEXITSTATUS(native_status) != EXIT_SUCCESS)
+                {
+                    fprintf(stderr, "native smoke exited unsuccessfully: p101_parse_positive_long_prefix: %d\n", WEXITSTATUS(native_status));
+                }
+                EXPECT(WEXITSTATUS(native_status) == EXIT_SUCCESS);
+            }
+        }
+        p101_error_reset(err);
+    }
+}
+
+/* P101_TEST_CASE(p101_parse_positive_short) */
+static void test_p101_parse_positive_short(struct p101_env *env, struct p101_error *err)
+{
+#ifdef __linux__
+    static const int         errors[]      = {EIO};
+    static const char *const error_names[] = {"EIO"};
+#elif defined(__APPLE__)
+    static const int         errors[]      = {EIO};
+    static const char *const error_names[] = {"EIO"};
+#elif defined(__FreeBSD__)
+    static const int         errors[]      = {EIO};
+    static const char *const error_names[] = {"EIO"};
+#else
+    static const int         errors[]      = {EIO};
+    static const char *const error_names[] = {"EIO"};
+#endif
+
+    for(size_t index = 0U; index < sizeof(errors) / sizeof(errors[0]); index++)
+    {
+        struct fault_state state = {0, errors[index]};
+        int                failures_before;
+
+        failures_before = failures;
+        EXPECT(p101_error_has_no_error(err));
+        fault_resource_events = 0U;
+        errno                 = P101_TEST_ERRNO_SENTINEL;
+        p101_env_set_fault_injector(env, fail_next_call, &state);
+        short result = p101_parse_positive_short(env, err, NULL, 0);
+        (void)result;
+        EXPECT(state.checks == 1);
+        EXPECT(p101_error_is_errno(err, state.code));
+        EXPECT(errno == P101_TEST_ERRNO_SENTINEL);
+        EXPECT(result == (0));
+        EXPECT(fault_resource_events == 0U);
+        write_outcome("p101_parse_positive_short", "errno", error_names[index], state.code, failures == failures_before);
+        p101_error_reset(err);
+    }
+    p101_env_set_fault_injector(env, NULL, NULL);
+    {
+        int   native_status = 0;
+        pid_t native_pid    = fork();
+
+        EXPECT(native_pid >= 0);
+        if(native_pid == 0)
+        {
+            bool               native_passed = true;
+            struct p101_error *native_err    = NULL;
+            struct p101_env   *native_env    = NULL;
+            FILE              *native_stdin_result;
+
+            native_child_process = true;
+            failures             = 0;
+            (void)alarm(2U);
+            if(unsetenv("P101_CALL_LOG") != 0 || unsetenv("P101_RESOURCE_LOG") != 0)
+            {
+                fprintf(stderr, "native setup failed: cannot clear p101 logging environment\n");
+                native_child_status = 77;
+                goto native_child_done_;
+            }
+            native_stdin_result = freopen("/dev/null", "r", stdin);
+            if(native_stdin_result == NULL)
+            {
+                fprintf(stderr, "native setup failed: cannot make standard input deterministic\n");
+                native_child_status = 77;
+                goto native_child_done_;
+            }
+            native_err = p101_error_create(false);
+            if(native_err == NULL)
+            {
+                native_child_status = 77;
+                goto native_child_done_;
+            }
+            native_env = p101_env_create(native_err, NULL);
+            if(native_env == NULL)
+            {
+                native_child_status = 77;
+                goto native_child_done_;
+            }
+            short native_result = p101_parse_positive_short(native_env, native_err, "1", 0);
+            (void)native_result;
+            if(p101_error_has_error(native_err))
+            {
+                bool native_error_declared = false;
+
+                for(size_t native_error_index = 0U; native_error_index < sizeof(errors) / sizeof(errors[0]); native_error_index++)
+                {
+                    if(p101_error_is_errno(native_err, errors[native_error_index]))
+                    {
+                        native_error_declared = true;
+                    }
+                }
+                if(!native_error_declared)
+                {
+                    fprintf(stderr, "native smoke produced an undeclared platform failure: p101_parse_positive_short: %s\n", p101_error_get_message(native_err));
+                    native_passed = false;
+                }
+                p101_error_reset(native_err);
+            }
+            native_child_status = native_passed ? EXIT_SUCCESS : EXIT_FAILURE;
+        native_child_done_:
+            p101_env_destroy(native_env);
+            p101_error_destroy(native_err);
+        }
+        if(native_pid > 0)
+        {
+            EXPECT(native_waitpid_nointr(native_pid, &native_status) == native_pid);
+            if(WIFSIGNALED(native_status))
+            {
+                fprintf(stderr, "native smoke terminated by signal: p101_parse_positive_short: %d\n", WTERMSIG(native_status));
+            }
+            EXPECT(WIFEXITED(native_status));
+            if(WIFEXITED(native_status) && WEXITSTATUS(native_status) == 77)
+            {
+                fprintf(stderr, "native smoke fixture unavailable: p101_parse_positive_short\n");
+            }
+            else if(WIFEXITED(native_status))
+            {
+                if(WEXITSTATUS(native_status) != EXIT_SUCCESS)
+                {
+                    fprintf(stderr, "native smoke exited unsuccessfully: p101_parse_positive_short: %d\n", WEXITSTATUS(native_status));
+                }
+                EXPECT(WEXITSTATUS(native_status) == EXIT_SUCCESS);
+            }
+        }
+        p101_error_reset(err);
+    }
+}
+
+/* P101_TEST_CASE(p101_parse_positive_short_n) */
+static void test_p101_parse_positive_short_n(struct p101_env *env, struct p101_error *err)
+{
+#ifdef __linux__
+    static const int         errors[]      = {EIO};
+    static const char *const error_names[] = {"EIO"};
+#elif defined(__APPLE__)
+    static const int         errors[]      = {EIO};
+    static const char *const error_names[] = {"EIO"};
+#elif defined(__FreeBSD__)
+    static const int         errors[]      = {EIO};
+    static const char *const error_names[] = {"EIO"};
+#else
+    static const int         errors[]      = {EIO};
+    static const char *const error_names[] = {"EIO"};
+#endif
+
+    for(size_t index = 0U; index < sizeof(errors) / sizeof(errors[0]); index++)
+    {
+        struct fault_state state = {0, errors[index]};
+        int                failures_before;
+
+        failures_before = failures;
+        EXPECT(p101_error_has_no_error(err));
+        fault_resource_events = 0U;
+        errno                 = P101_TEST_ERRNO_SENTINEL;
+        p101_env_set_fault_injector(env, fail_next_call, &state);
+        short result = p101_parse_positive_short_n(env, err, NULL, 0, 0);
+        (void)result;
+        EXPECT(state.checks == 1);
+        EXPECT(p101_error_is_errno(err, state.code));
+        EXPECT(errno == P101_TEST_ERRNO_SENTINEL);
+        EXPECT(result == (0));
+        EXPECT(fault_resource_events == 0U);
+        write_outcome("p101_parse_positive_short_n", "errno", error_names[index], state.code, failures == failures_before);
+        p101_error_reset(err);
+    }
+    p101_env_set_fault_injector(env, NULL, NULL);
+    {
+        int   native_status = 0;
+        pid_t native_pid    = fork();
+
+        EXPECT(native_pid >= 0);
+        if(native_pid == 0)
+        {
+            bool               native_passed = true;
+            struct p101_error *native_err    = NULL;
+            struct p101_env   *native_env    = NULL;
+            FILE              *native_stdin_result;
+
+            native_child_process = true;
+            failures             = 0;
+            (void)alarm(2U);
+            if(unsetenv("P101_CALL_LOG") != 0 || unsetenv("P101_RESOURCE_LOG") != 0)
+            {
+                fprintf(stderr, "native setup failed: cannot clear p101 logging environment\n");
+                native_child_status = 77;
+                goto native_child_done_;
+            }
+            native_stdin_result = freopen("/dev/null", "r", stdin);
+            if(native_stdin_result == NULL)
+            {
+                fprintf(stderr, "native setup failed: cannot make standard input deterministic\n");
+                native_child_status = 77;
+                goto native_child_done_;
+            }
+            native_err = p101_error_create(false);
+            if(native_err == NULL)
+            {
+                native_child_status = 77;
+                goto native_child_done_;
+            }
+            native_env = p101_env_create(native_err, NULL);
+            if(native_env == NULL)
+            {
+                native_child_status = 77;
+                goto native_child_done_;
+            }
+            short native_result = p101_parse_positive_short_n(native_env, native_err, "1", 1, 0);
+            (void)native_result;
+            if(p101_error_has_error(native_err))
+            {
+                bool native_error_declared = false;
+
+                for(size_t native_error_index = 0U; native_error_index < sizeof(errors) / sizeof(errors[0]); native_error_index++)
+                {
+                    if(p101_error_is_errno(native_err, errors[native_error_index]))
+                    {
+                        native_error_declared = true;
+                    }
+                }
+                if(!native_error_declared)
+                {
+                    fprintf(stderr, "native smoke produced an undeclared platform failure: p101_parse_positive_short_n: %s\n", p101_error_get_message(native_err));
+                    native_passed = false;
+                }
+                p101_error_reset(native_err);
+            }
+            native_child_status = native_passed ? EXIT_SUCCESS : EXIT_FAILURE;
+        native_child_done_:
+            p101_env_destroy(native_env);
+            p101_error_destroy(native_err);
+        }
+        if(native_pid > 0)
+        {
+            EXPECT(native_waitpid_nointr(native_pid, &native_status) == native_pid);
+            if(WIFSIGNALED(native_status))
+            {
+                fprintf(stderr, "native smoke terminated by signal: p101_parse_positive_short_n: %d\n", WTERMSIG(native_status));
+            }
+            EXPECT(WIFEXITED(native_status));
+            if(WIFEXITED(native_status) && WEXITSTATUS(native_status) == 77)
+            {
+                fprintf(stderr, "native smoke fixture unavailable: p101_parse_positive_short_n\n");
+            }
+            else if(WIFEXITED(native_status))
+            {
+                if(WEXITSTATUS(native_status) != EXIT_SUCCESS)
+                {
+                    fprintf(stderr, "native smoke exited unsuccessfully: p101_parse_positive_short_n: %d\n", WEXITSTATUS(native_status));
+                }
+                EXPECT(WEXITSTATUS(native_status) == EXIT_SUCCESS);
+            }
+        }
+        p101_error_reset(err);
+    }
+}
+
+/* P101_TEST_CASE(p101_parse_positive_short_prefix) */
+static void test_p101_parse_positive_short_prefix(struct p101_env *env, struct p101_error *err)
+{
+#ifdef __linux__
+    static const int         errors[]      = {EIO};
+    static const char *const error_names[] = {"EIO"};
+#elif defined(__APPLE__)
+    static const int         errors[]      = {EIO};
+    static const char *const error_names[] = {"EIO"};
+#elif defined(__FreeBSD__)
+    static const int         errors[]      = {EIO};
+    static const char *const error_names[] = {"EIO"};
+#else
+    static const int         errors[]      = {EIO};
+    static const char *const error_names[] = {"EIO"};
+#endif
+
+    for(size_t index = 0U; index < sizeof(errors) / sizeof(errors[0]); index++)
+    {
+        struct fault_state state = {0, errors[index]};
+        int                failures_before;
+
+        failures_before = failures;
+        EXPECT(p101_error_has_no_error(err));
+        fault_resource_events = 0U;
+        errno                 = P101_TEST_ERRNO_SENTINEL;
+        p101_env_set_fault_injector(env, fail_next_call, &state);
+        short result = p101_parse_positive_short_prefix(env, err, NULL, NULL, 0);
+        (void)result;
+        EXPECT(state.checks == 1);
+        EXPECT(p101_error_is_errno(err, state.code));
+        EXPECT(errno == P101_TEST_ERRNO_SENTINEL);
+        EXPECT(result == (0));
+        EXPECT(fault_resource_events == 0U);
+        write_outcome("p101_parse_positive_short_prefix", "errno", error_names[index], state.code, failures == failures_before);
+        p101_error_reset(err);
+    }
+    p101_env_set_fault_injector(env, NULL, NULL);
+    {
+        int   native_status = 0;
+        pid_t native_pid    = fork();
+
+        EXPECT(native_pid >= 0);
+        if(native_pid == 0)
+        {
+            bool               native_passed = true;
+            struct p101_error *native_err    = NULL;
+            struct p101_env   *native_env    = NULL;
+            FILE              *native_stdin_result;
+
+            native_child_process = true;
+            failures             = 0;
+            (void)alarm(2U);
+            if(unsetenv("P101_CALL_LOG") != 0 || unsetenv("P101_RESOURCE_LOG") != 0)
+            {
+                fprintf(stderr, "native setup failed: cannot clear p101 logging environment\n");
+                native_child_status = 77;
+                goto native_child_done_;
+            }
+            native_stdin_result = freopen("/dev/null", "r", stdin);
+            if(native_stdin_result == NULL)
+            {
+                fprintf(stderr, "native setup failed: cannot make standard input deterministic\n");
+                native_child_status = 77;
+                goto native_child_done_;
+            }
+            native_err = p101_error_create(false);
+            if(native_err == NULL)
+            {
+                native_child_status = 77;
+                goto native_child_done_;
+            }
+            native_env = p101_env_create(native_err, NULL);
+            if(native_env == NULL)
+            {
+                native_child_status = 77;
+                goto native_child_done_;
+            }
+            const char *native_argument_3 = NULL;
+            short       native_result     = p101_parse_positive_short_prefix(native_env, native_err, "1", &native_argument_3, 0);
+            (void)native_result;
+            if(p101_error_has_error(native_err))
+            {
+                bool native_error_declared = false;
+
+                for(size_t native_error_index = 0U; native_error_index < sizeof(errors) / sizeof(errors[0]); native_error_index++)
+                {
+                    if(p101_error_is_errno(native_err, errors[native_error_index]))
+                    {
+                        native_error_declared = true;
+                    }
+                }
+                if(!native_error_declared)
+                {
+                    fprintf(stderr, "native smoke produced an undeclared platform failure: p101_parse_positive_short_prefix: %s\n", p101_error_get_message(native_err));
+                    native_passed = false;
+                }
+                p101_error_reset(native_err);
+            }
+            native_child_status = native_passed ? EXIT_SUCCESS : EXIT_FAILURE;
+        native_child_done_:
+            p101_env_destroy(native_env);
+            p101_error_destroy(native_err);
+        }
+        if(native_pid > 0)
+        {
+            EXPECT(native_waitpid_nointr(native_pid, &native_status) == native_pid);
+            if(WIFSIGNALED(native_status))
+            {
+                fprintf(stderr, "native smoke terminated by signal: p101_parse_positive_short_prefix: %d\n", WTERMSIG(native_status));
+            }
+            EXPECT(WIFEXITED(native_status));
+            if(WIFEXITED(native_status) && WEXITSTATUS(native_status) == 77)
+            {
+                fprintf(stderr, "native smoke fixture unavailable: p101_parse_positive_short_prefix\n");
+            }
+            else if(WIFEXITED(native_status))
+            {
+                if(WEXITSTATUS(native_status) != EXIT_SUCCESS)
+                {
+                    fprintf(stderr, "native smoke exited unsuccessfully: p101_parse_positive_short_prefix: %d\n", WEXITSTATUS(native_status));
+                }
+                EXPECT(WEXITSTATUS(native_status) == EXIT_SUCCESS);
+            }
+        }
+        p101_error_reset(err);
+    }
+}
+
+/* P101_TEST_CASE(p101_parse_short) */
+static void test_p101_parse_short(struct p101_env *env, struct p101_error *err)
+{
+#ifdef __linux__
+    static const int         errors[]      = {EIO};
+    static const char *const error_names[] = {"EIO"};
+#elif defined(__APPLE__)
+    static const int         errors[]      = {EIO};
+    static const char *const error_names[] = {"EIO"};
+#elif defined(__FreeBSD__)
+    static const int         errors[]      = {EIO};
+    static const char *const error_names[] = {"EIO"};
+#else
+    static const int         errors[]      = {EIO};
+    static const char *const error_names[] = {"EIO"};
+#endif
+
+    for(size_t index = 0U; index < sizeof(errors) / sizeof(errors[0]); index++)
+    {
+        struct fault_state state = {0, errors[index]};
+        int                failures_before;
+
+        failures_before = failures;
+        EXPECT(p101_error_has_no_error(err));
+        fault_resource_events = 0U;
+        errno                 = P101_TEST_ERRNO_SENTINEL;
+        p101_env_set_fault_injector(env, fail_next_call, &state);
+        short result = p101_parse_short(env, err, NULL, 0);
+        (void)result;
+        EXPECT(state.checks == 1);
+        EXPECT(p101_error_is_errno(err, state.code));
+        EXPECT(errno == P101_TEST_ERRNO_SENTINEL);
+        EXPECT(result == (0));
+        EXPECT(fault_resource_events == 0U);
+        write_outcome("p101_parse_short", "errno", error_names[index], state.code, failures == failures_before);
+        p101_error_reset(err);
+    }
+    p101_env_set_fault_injector(env, NULL, NULL);
+    {
+        int   native_status = 0;
+        pid_t native_pid    = fork();
+
+        EXPECT(native_pid >= 0);
+        if(native_pid == 0)
+        {
+            bool               native_passed = true;
+            struct p101_error *native_err    = NULL;
+            struct p101_env   *native_env    = NULL;
+            FILE              *native_stdin_result;
+
+            native_child_process = true;
+            failures             = 0;
+            (void)alarm(2U);
+            if(unsetenv("P101_CALL_LOG") != 0 || unsetenv("P101_RESOURCE_LOG") != 0)
+            {
+                fprintf(stderr, "native setup failed: cannot clear p101 logging environment\n");
+                native_child_status = 77;
+                goto native_child_done_;
+            }
+            native_stdin_result = freopen("/dev/null", "r", stdin);
+            if(native_stdin_result == NULL)
+            {
+                fprintf(stderr, "native setup failed: cannot make standard input deterministic\n");
+                native_child_status = 77;
+                goto native_child_done_;
+            }
+            native_err = p101_error_create(false);
+            if(native_err == NULL)
+            {
+                native_child_status = 77;
+                goto native_child_done_;
+            }
+            native_env = p101_env_create(native_err, NULL);
+            if(native_env == NULL)
+            {
+                native_child_status = 77;
+                goto native_child_done_;
+            }
+            short native_result = p101_parse_short(native_env, native_err, "1", 0);
+            (void)native_result;
+            if(p101_error_has_error(native_err))
+            {
+                bool native_error_declared = false;
+
+                for(size_t native_error_index = 0U; native_error_index < sizeof(errors) / sizeof(errors[0]); native_error_index++)
+                {
+                    if(p101_error_is_errno(native_err, errors[native_error_index]))
+                    {
+                        native_error_declared = true;
+                    }
+                }
+                if(!native_error_declared)
+                {
+                    fprintf(stderr, "native smoke produced an undeclared platform failure: p101_parse_short: %s\n", p101_error_get_message(native_err));
+                    native_passed = false;
+                }
+                p101_error_reset(native_err);
+            }
+            native_child_status = native_passed ? EXIT_SUCCESS : EXIT_FAILURE;
+        native_child_done_:
+            p101_env_destroy(native_env);
+            p101_error_destroy(native_err);
+        }
+        if(native_pid > 0)
+        {
+            EXPECT(native_waitpid_nointr(native_pid, &native_status) == native_pid);
+            if(WIFSIGNALED(native_status))
+            {
+                fprintf(stderr, "native smoke terminated by signal: p101_parse_short: %d\n", WTERMSIG(native_status));
+            }
+            EXPECT(WIFEXITED(native_status));
+            if(WIFEXITED(native_status) && WEXITSTATUS(native_status) == 77)
+            {
+                fprintf(stderr, "native smoke fixture unavailable: p101_parse_short\n");
+            }
+            else if(WIFEXITED(native_status))
+            {
+                if(WEXITSTATUS(native_status) != EXIT_SUCCESS)
+                {
+                    fprintf(stderr, "native smoke exited unsuccessfully: p101_parse_short: %d\n", WEXITSTATUS(native_status));
+                }
+                EXPECT(WEXITSTATUS(native_status) == EXIT_SUCCESS);
+            }
+        }
+        p101_error_reset(err);
+    }
+}
+
+/* P101_TEST_CASE(p101_parse_short_n) */
+static void test_p101_parse_short_n(struct p101_env *env, struct p101_error *err)
+{
+#ifdef __linux__
+    static const int         errors[]      = {EIO};
+    static const char *const error_names[] = {"EIO"};
+#elif defined(__APPLE__)
+    static const int         errors[]      = {EIO};
+    static const char *const error_names[] = {"EIO"};
+#elif defined(__FreeBSD__)
+    static const int         errors[]      = {EIO};
+    static const char *const error_names[] = {"EIO"};
+#else
+    static const int         errors[]      = {EIO};
+    static const char *const error_names[] = {"EIO"};
+#endif
+
+    for(size_t index = 0U; index < sizeof(errors) / sizeof(errors[0]); index++)
+    {
+        struct fault_state state = {0, errors[index]};
+        int                failures_before;
+
+        failures_before = failures;
+        EXPECT(p101_error_has_no_error(err));
+        fault_resource_events = 0U;
+        errno                 = P101_TEST_ERRNO_SENTINEL;
+        p101_env_set_fault_injector(env, fail_next_call, &state);
+        short result = p101_parse_short_n(env, err, NULL, 0, 0);
+        (void)result;
+        EXPECT(state.checks == 1);
+        EXPECT(p101_error_is_errno(err, state.code));
+        EXPECT(errno == P101_TEST_ERRNO_SENTINEL);
+        EXPECT(result == (0));
+        EXPECT(fault_resource_events == 0U);
+        write_outcome("p101_parse_short_n", "errno", error_names[index], state.code, failures == failures_before);
+        p101_error_reset(err);
+    }
+    p101_env_set_fault_injector(env, NULL, NULL);
+    {
+        int   native_status = 0;
+        pid_t native_pid    = fork();
+
+        EXPECT(native_pid >= 0);
+        if(native_pid == 0)
+        {
+            bool               native_passed = true;
+            struct p101_error *native_err    = NULL;
+            struct p101_env   *native_env    = NULL;
+            FILE              *native_stdin_result;
+
+            native_child_process = true;
+            failures             = 0;
+            (void)alarm(2U);
+            if(unsetenv("P101_CALL_LOG") != 0 || unsetenv("P101_RESOURCE_LOG") != 0)
+            {
+                fprintf(stderr, "native setup failed: cannot clear p101 logging environment\n");
+                native_child_status = 77;
+                goto native_child_done_;
+            }
+            native_stdin_result = freopen("/dev/null", "r", stdin);
+            if(native_stdin_result == NULL)
+            {
+                fprintf(stderr, "native setup failed: cannot make standard input deterministic\n");
+                native_child_status = 77;
+                goto native_child_done_;
+            }
+            native_err = p101_error_create(false);
+            if(native_err == NULL)
+            {
+                native_child_status = 77;
+                goto native_child_done_;
+            }
+            native_env = p101_env_create(native_err, NULL);
+            if(native_env == NULL)
+            {
+                native_child_status = 77;
+                goto native_child_done_;
+            }
+            short native_result = p101_parse_short_n(native_env, native_err, "1", 1, 0);
+            (void)native_result;
+            if(p101_error_has_error(native_err))
+            {
+                bool native_error_declared = false;
+
+                for(size_t native_error_index = 0U; native_error_index < sizeof(errors) / sizeof(errors[0]); native_error_index++)
+                {
+                    if(p101_error_is_errno(native_err, errors[native_error_index]))
+                    {
+                        native_error_declared = true;
+                    }
+                }
+                if(!native_error_declared)
+                {
+                    fprintf(stderr, "native smoke produced an undeclared platform failure: p101_parse_short_n: %s\n", p101_error_get_message(native_err));
+                    native_passed = false;
+                }
+                p101_error_reset(native_err);
+            }
+            native_child_status = native_passed ? EXIT_SUCCESS : EXIT_FAILURE;
+        native_child_done_:
+            p101_env_destroy(native_env);
+            p101_error_destroy(native_err);
+        }
+        if(native_pid > 0)
+        {
+            EXPECT(native_waitpid_nointr(native_pid, &native_status) == native_pid);
+            if(WIFSIGNALED(native_status))
+            {
+                fprintf(stderr, "native smoke terminated by signal: p101_parse_short_n: %d\n", WTERMSIG(native_status));
+            }
+            EXPECT(WIFEXITED(native_status));
+            if(WIFEXITED(native_status) && WEXITSTATUS(native_status) == 77)
+            {
+                fprintf(stderr, "native smoke fixture unavailable: p101_parse_short_n\n");
+            }
+            else if(WIFEXITED(native_status))
+            {
+                if(WEXITSTATUS(native_status) != EXIT_SUCCESS)
+                {
+                    fprintf(stderr, "native smoke exited unsuccessfully: p101_parse_short_n: %d\n", WEXITSTATUS(native_status));
+                }
+                EXPECT(WEXITSTATUS(native_status) == EXIT_SUCCESS);
+            }
+        }
+        p101_error_reset(err);
+    }
+}
+
+/* P101_TEST_CASE(p101_parse_short_prefix) */
+static void test_p101_parse_short_prefix(struct p101_env *env, struct p101_error *err)
+{
+#ifdef __linux__
+    static const int         errors[]      = {EIO};
+    static const char *const error_names[] = {"EIO"};
+#elif defined(__APPLE__)
+    static const int         errors[]      = {EIO};
+    static const char *const error_names[] = {"EIO"};
+#elif defined(__FreeBSD__)
+    static const int         errors[]      = {EIO};
+    static const char *const error_names[] = {"EIO"};
+#else
+    static const int         errors[]      = {EIO};
+    static const char *const error_names[] = {"EIO"};
+#endif
+
+    for(size_t index = 0U; index < sizeof(errors) / sizeof(errors[0]); index++)
+    {
+        struct fault_state state = {0, errors[index]};
+        int                failures_before;
+
+        failures_before = failures;
+        EXPECT(p101_error_has_no_error(err));
+        fault_resource_events = 0U;
+        errno                 = P101_TEST_ERRNO_SENTINEL;
+        p101_env_set_fault_injector(env, fail_next_call, &state);
+        short result = p101_parse_short_prefix(env, err, NULL, NULL, 0);
+        (void)result;
+        EXPECT(state.checks == 1);
+        EXPECT(p101_error_is_errno(err, state.code));
+        EXPECT(errno == P101_TEST_ERRNO_SENTINEL);
+        EXPECT(result == (0));
+        EXPECT(fault_resource_events == 0U);
+        write_outcome("p101_parse_short_prefix", "errno", error_names[index], state.code, failures == failures_before);
+        p101_error_reset(err);
+    }
+    p101_env_set_fault_injector(env, NULL, NULL);
+    {
+        int   native_status = 0;
+        pid_t native_pid    = fork();
+
+        EXPECT(native_pid >= 0);
+        if(native_pid == 0)
+        {
+            bool               native_passed = true;
+            struct p101_error *native_err    = NULL;
+            struct p101_env   *native_env    = NULL;
+            FILE              *native_stdin_result;
+
+            native_child_process = true;
+            failures             = 0;
+            (void)alarm(2U);
+            if(unsetenv("P101_CALL_LOG") != 0 || unsetenv("P101_RESOURCE_LOG") != 0)
+            {
+                fprintf(stderr, "native setup failed: cannot clear p101 logging environment\n");
+                native_child_status = 77;
+                goto native_child_done_;
+            }
+            native_stdin_result = freopen("/dev/null", "r", stdin);
+            if(native_stdin_result == NULL)
+            {
+                fprintf(stderr, "native setup failed: cannot make standard input deterministic\n");
+                native_child_status = 77;
+                goto native_child_done_;
+            }
+            native_err = p101_error_create(false);
+            if(native_err == NULL)
+            {
+                native_child_status = 77;
+                goto native_child_done_;
+            }
+            native_env = p101_env_create(native_err, NULL);
+            if(native_env == NULL)
+            {
+                native_child_status = 77;
+                goto native_child_done_;
+            }
+            const char *native_argument_3 = NULL;
+            short       native_result     = p101_parse_short_prefix(native_env, native_err, "1", &native_argument_3, 0);
+            (void)native_result;
+            if(p101_error_has_error(native_err))
+            {
+                bool native_error_declared = false;
+
+                for(size_t native_error_index = 0U; native_error_index < sizeof(errors) / sizeof(errors[0]); native_error_index++)
+                {
+                    if(p101_error_is_errno(native_err, errors[native_error_index]))
+                    {
+                        native_error_declared = true;
+                    }
+                }
+                if(!native_error_declared)
+                {
+                    fprintf(stderr, "native smoke produced an undeclared platform failure: p101_parse_short_prefix: %s\n", p101_error_get_message(native_err));
+                    native_passed = false;
+                }
+                p101_error_reset(native_err);
+            }
+            native_child_status = native_passed ? EXIT_SUCCESS : EXIT_FAILURE;
+        native_child_done_:
+            p101_env_destroy(native_env);
+            p101_error_destroy(native_err);
+        }
+        if(native_pid > 0)
+        {
+            EXPECT(native_waitpid_nointr(native_pid, &native_status) == native_pid);
+            if(WIFSIGNALED(native_status))
+            {
+                fprintf(stderr, "native smoke terminated by signal: p101_parse_short_prefix: %d\n", WTERMSIG(native_status));
+            }
+            EXPECT(WIFEXITED(native_status));
+            if(WIFEXITED(native_status) && WEXITSTATUS(native_status) == 77)
+            {
+                fprintf(stderr, "native smoke fixture unavailable: p101_parse_short_prefix\n");
+            }
+            else if(WIFEXITED(native_status))
+            {
+                if(WEXITSTATUS(native_status) != EXIT_SUCCESS)
+                {
+                    fprintf(stderr, "native smoke exited unsuccessfully: p101_parse_short_prefix: %d\n", WEXITSTATUS(native_status));
+                }
+                EXPECT(WEXITSTATUS(native_status) == EXIT_SUCCESS);
+            }
+        }
+        p101_error_reset(err);
+    }
+}
+
+/* P101_TEST_CASE(p101_parse_uint128) */
+static void test_p101_parse_uint128(struct p101_env *env, struct p101_error *err)
+{
+#ifdef __linux__
+    static const int         errors[]      = {EIO};
+    static const char *const error_names[] = {"EIO"};
+#elif defined(__APPLE__)
+    static const int         errors[]      = {EIO};
+    static const char *const error_names[] = {"EIO"};
+#elif defined(__FreeBSD__)
+    static const int         errors[]      = {EIO};
+    static const char *const error_names[] = {"EIO"};
+#else
+    static const int         errors[]      = {EIO};
+    static const char *const error_names[] = {"EIO"};
+#endif
+
+    for(size_t index = 0U; index < sizeof(errors) / sizeof(errors[0]); index++)
+    {
+        struct fault_state state = {0, errors[index]};
+        int                failures_before;
+
+        failures_before = failures;
+        EXPECT(p101_error_has_no_error(err));
+        fault_resource_events = 0U;
+        errno                 = P101_TEST_ERRNO_SENTINEL;
+        p101_env_set_fault_injector(env, fail_next_call, &state);
+        struct p101_uint128 result = p101_parse_uint128(env, err, NULL, (struct p101_uint128){0, 0});
+        (void)result;
+        EXPECT(state.checks == 1);
+        EXPECT(p101_error_is_errno(err, state.code));
+        EXPECT(errno == P101_TEST_ERRNO_SENTINEL);
+        EXPECT(result.high == 0 && result.low == 0);
+        EXPECT(fault_resource_events == 0U);
+        write_outcome("p101_parse_uint128", "errno", error_names[index], state.code, failures == failures_before);
+        p101_error_reset(err);
+    }
+    p101_env_set_fault_injector(env, NULL, NULL);
+    {
+        int   native_status = 0;
+        pid_t native_pid    = fork();
+
+        EXPECT(native_pid >= 0);
+        if(native_pid == 0)
+        {
+            bool               native_passed = true;
+            struct p101_error *native_err    = NULL;
+            struct p101_env   *native_env    = NULL;
+            FILE              *native_stdin_result;
+
+            native_child_process = true;
+            failures             = 0;
+            (void)alarm(2U);
+            if(unsetenv("P101_CALL_LOG") != 0 || unsetenv("P101_RESOURCE_LOG") != 0)
+            {
+                fprintf(stderr, "native setup failed: cannot clear p101 logging environment\n");
+                native_child_status = 77;
+                goto native_child_done_;
+            }
+            native_stdin_result = freopen("/dev/null", "r", stdin);
+            if(native_stdin_result == NULL)
+            {
+                fprintf(stderr, "native setup failed: cannot make standard input deterministic\n");
+                native_child_status = 77;
+                goto native_child_done_;
+            }
+            native_err = p101_error_create(false);
+            if(native_err == NULL)
+            {
+                native_child_status = 77;
+                goto native_child_done_;
+            }
+            native_env = p101_env_create(native_err, NULL);
+            if(native_env == NULL)
+            {
+                native_child_status = 77;
+                goto native_child_done_;
+            }
+            struct p101_uint128 native_result = p101_parse_uint128(native_env, native_err, "1", (struct p101_uint128){0, 0});
+            (void)native_result;
+            if(p101_error_has_error(native_err))
+            {
+                bool native_error_declared = false;
+
+                for(size_t native_error_index = 0U; native_error_index < sizeof(errors) / sizeof(errors[0]); native_error_index++)
+                {
+                    if(p101_error_is_errno(native_err, errors[native_error_index]))
+                    {
+                        native_error_declared = true;
+                    }
+                }
+                if(!native_error_declared)
+                {
+                    fprintf(stderr, "native smoke produced an undeclared platform failure: p101_parse_uint128: %s\n", p101_error_get_message(native_err));
+                    native_passed = false;
+                }
+                p101_error_reset(native_err);
+            }
+            native_child_status = native_passed ? EXIT_SUCCESS : EXIT_FAILURE;
+        native_child_done_:
+            p101_env_destroy(native_env);
+            p101_error_destroy(native_err);
+        }
+        if(native_pid > 0)
+        {
+            EXPECT(native_waitpid_nointr(native_pid, &native_status) == native_pid);
+            if(WIFSIGNALED(native_status))
+            {
+                fprintf(stderr, "native smoke terminated by signal: p101_parse_uint128: %d\n", WTERMSIG(native_status));
+            }
+            EXPECT(WIFEXITED(native_status));
+            if(WIFEXITED(native_status) && WEXITSTATUS(native_status) == 77)
+            {
+                fprintf(stderr, "native smoke fixture unavailable: p101_parse_uint128\n");
+            }
+            else if(WIFEXITED(native_status))
+            {
+                if(WEXITSTATUS(native_status) != EXIT_SUCCESS)
+                {
+                    fprintf(stderr, "native smoke exited unsuccessfully: p101_parse_uint128: %d\n", WEXITSTATUS(native_status));
+                }
+                EXPECT(WEXITSTATUS(native_status) == EXIT_SUCCESS);
+            }
+        }
+        p101_error_reset(err);
+    }
+}
+
+/* P101_TEST_CASE(p101_parse_uint128_base) */
+static void test_p101_parse_uint128_base(struct p101_env *env, struct p101_error *err)
+{
+#ifdef __linux__
+    static const int         errors[]      = {EIO};
+    static const char *const error_names[] = {"EIO"};
+#elif defined(__APPLE__)
+    static const int         errors[]      = {EIO};
+    static const char *const error_names[] = {"EIO"};
+#elif defined(__FreeBSD__)
+    static const int         errors[]      = {EIO};
+    static const char *const error_names[] = {"EIO"};
+#else
+    static const int         errors[]      = {EIO};
+    static const char *const error_names[] = {"EIO"};
+#endif
+
+    for(size_t index = 0U; index < sizeof(errors) / sizeof(errors[0]); index++)
+    {
+        struct fault_state state = {0, errors[index]};
+        int                failures_before;
+
+        failures_before = failures;
+        EXPECT(p101_error_has_no_error(err));
+        fault_resource_events = 0U;
+        errno                 = P101_TEST_ERRNO_SENTINEL;
+        p101_env_set_fault_injector(env, fail_next_call, &state);
+        struct p101_uint128 result = p101_parse_uint128_base(env, err, NULL, 0, (struct p101_uint128){0, 0});
+        (void)result;
+        EXPECT(state.checks == 1);
+        EXPECT(p101_error_is_errno(err, state.code));
+        EXPECT(errno == P101_TEST_ERRNO_SENTINEL);
+        EXPECT(result.high == 0 && result.low == 0);
+        EXPECT(fault_resource_events == 0U);
+        write_outcome("p101_parse_uint128_base", "errno", error_names[index], state.code, failures == failures_before);
+        p101_error_reset(err);
+    }
+    p101_env_set_fault_injector(env, NULL, NULL);
+    {
+        int   native_status = 0;
+        pid_t native_pid    = fork();
+
+        EXPECT(native_pid >= 0);
+        if(native_pid == 0)
+        {
+            bool               native_passed = true;
+            struct p101_error *native_err    = NULL;
+            struct p101_env   *native_env    = NULL;
+            FILE              *native_stdin_result;
+
+            native_child_process = true;
+            failures             = 0;
+            (void)alarm(2U);
+            if(unsetenv("P101_CALL_LOG") != 0 || unsetenv("P101_RESOURCE_LOG") != 0)
+            {
+                fprintf(stderr, "native setup failed: cannot clear p101 logging environment\n");
+                native_child_status = 77;
+                goto native_child_done_;
+            }
+            native_stdin_result = freopen("/dev/null", "r", stdin);
+            if(native_stdin_result == NULL)
+            {
+                fprintf(stderr, "native setup failed: cannot make standard input deterministic\n");
+                native_child_status = 77;
+                goto native_child_done_;
+            }
+            native_err = p101_error_create(false);
+            if(native_err == NULL)
+            {
+                native_child_status = 77;
+                goto native_child_done_;
+            }
+            native_env = p101_env_create(native_err, NULL);
+            if(native_env == NULL)
+            {
+                native_child_status = 77;
+                goto native_child_done_;
+            }
+            struct p101_uint128 native_result = p101_parse_uint128_base(native_env, native_err, "0x1", 0, (struct p101_uint128){0, 0});
+            (void)native_result;
+            if(p101_error_has_error(native_err))
+            {
+                bool native_error_declared = false;
+
+                for(size_t native_error_index = 0U; native_error_index < sizeof(errors) / sizeof(errors[0]); native_error_index++)
+                {
+                    if(p101_error_is_errno(native_err, errors[native_error_index]))
+                    {
+                        native_error_declared = true;
+                    }
+                }
+                if(!native_error_declared)
+                {
+                    fprintf(stderr, "native smoke produced an undeclared platform failure: p101_parse_uint128_base: %s\n", p101_error_get_message(native_err));
+                    native_passed = false;
+                }
+                p101_error_reset(native_err);
+            }
+            native_child_status = native_passed ? EXIT_SUCCESS : EXIT_FAILURE;
+        native_child_done_:
+            p101_env_destroy(native_env);
+            p101_error_destroy(native_err);
+        }
+        if(native_pid > 0)
+        {
+            EXPECT(native_waitpid_nointr(native_pid, &native_status) == native_pid);
+            if(WIFSIGNALED(native_status))
+            {
+                fprintf(stderr, "native smoke terminated by signal: p101_parse_uint128_base: %d\n", WTERMSIG(native_status));
+            }
+            EXPECT(WIFEXITED(native_status));
+            if(WIFEXITED(native_status) && WEXITSTATUS(native_status) == 77)
+            {
+                fprintf(stderr, "native smoke fixture unavailable: p101_parse_uint128_base\n");
+            }
+            else if(WIFEXITED(native_status))
+            {
+                if(WEXITSTATUS(native_status) != EXIT_SUCCESS)
+                {
+                    fprintf(stderr, "native smoke exited unsuccessfully: p101_parse_uint128_base: %d\n", WEXITSTATUS(native_status));
+                }
+                EXPECT(WEXITSTATUS(native_status) == EXIT_SUCCESS);
+            }
+        }
+        p101_error_reset(err);
+    }
+}
+
+/* P101_TEST_CASE(p101_parse_uint16_t) */
+static void test_p101_parse_uint16_t(struct p101_env *env, struct p101_error *err)
+{
+#ifdef __linux__
+    static const int         errors[]      = {EIO};
+    static const char *const error_names[] = {"EIO"};
+#elif defined(__APPLE__)
+    static const int         errors[]      = {EIO};
+    static const char *const error_names[] = {"EIO"};
+#elif defined(__FreeBSD__)
+    static const int         errors[]      = {EIO};
+    static const char *const error_names[] = {"EIO"};
+#else
+    static const int         errors[]      = {EIO};
+    static const char *const error_names[] = {"EIO"};
+#endif
+
+    for(size_t index = 0U; index < sizeof(errors) / sizeof(errors[0]); index++)
+    {
+        struct fault_state state = {0, errors[index]};
+        int                failures_before;
+
+        failures_before = failures;
+        EXPECT(p101_error_has_no_error(err));
+        fault_resource_events = 0U;
+        errno                 = P101_TEST_ERRNO_SENTINEL;
+        p101_env_set_fault_injector(env, fail_next_call, &state);
+        uint16_t result = p101_parse_uint16_t(env, err, NULL, 0);
+        (void)result;
+        EXPECT(state.checks == 1);
+        EXPECT(p101_error_is_errno(err, state.code));
+        EXPECT(errno == P101_TEST_ERRNO_SENTINEL);
+        EXPECT(result == (0));
+        EXPECT(fault_resource_events == 0U);
+        write_outcome("p101_parse_uint16_t", "errno", error_names[index], state.code, failures == failures_before);
+        p101_error_reset(err);
+    }
+    p101_env_set_fault_injector(env, NULL, NULL);
+    {
+        int   native_status = 0;
+        pid_t native_pid    = fork();
+
+        EXPECT(native_pid >= 0);
+        if(native_pid == 0)
+        {
+            bool               native_passed = true;
+            struct p101_error *native_err    = NULL;
+            struct p101_env   *native_env    = NULL;
+            FILE              *native_stdin_result;
+
+            native_child_process = true;
+            failures             = 0;
+            (void)alarm(2U);
+            if(unsetenv("P101_CALL_LOG") != 0 || unsetenv("P101_RESOURCE_LOG") != 0)
+            {
+                fprintf(stderr, "native setup failed: cannot clear p101 logging environment\n");
+                native_child_status = 77;
+                goto native_child_done_;
+            }
+            native_stdin_result = freopen("/dev/null", "r", stdin);
+            if(native_stdin_result == NULL)
+            {
+                fprintf(stderr, "native setup failed: cannot make standard input deterministic\n");
+                native_child_status = 77;
+                goto native_child_done_;
+            }
+            native_err = p101_error_create(false);
+            if(native_err == NULL)
+            {
+                native_child_status = 77;
+                goto native_child_done_;
+            }
+            native_env = p101_env_create(native_err, NULL);
+            if(native_env == NULL)
+            {
+                native_child_status = 77;
+                goto native_child_done_;
+            }
+            uint16_t native_result = p101_parse_uint16_t(native_env, native_err, "1", 0);
+            (void)native_result;
+            if(p101_error_has_error(native_err))
+            {
+                bool native_error_declared = false;
+
+                for(size_t native_error_index = 0U; native_error_index < sizeof(errors) / sizeof(errors[0]); native_error_index++)
+                {
+                    if(p101_error_is_errno(native_err, errors[native_error_index]))
+                    {
+                        native_error_declared = true;
+                    }
+                }
+                if(!native_error_declared)
+                {
+                    fprintf(stderr, "native smoke produced an undeclared platform failure: p101_parse_uint16_t: %s\n", p101_error_get_message(native_err));
+                    native_passed = false;
+                }
+                p101_error_reset(native_err);
+            }
+            native_child_status = native_passed ? EXIT_SUCCESS : EXIT_FAILURE;
+        native_child_done_:
+            p101_env_destroy(native_env);
+            p101_error_destroy(native_err);
+        }
+        if(native_pid > 0)
+        {
+            EXPECT(native_waitpid_nointr(native_pid, &native_status) == native_pid);
+            if(WIFSIGNALED(native_status))
+            {
+                fprintf(stderr, "native smoke terminated by signal: p101_parse_uint16_t: %d\n", WTERMSIG(native_status));
+            }
+            EXPECT(WIFEXITED(native_status));
+            if(WIFEXITED(native_status) && WEXITSTATUS(native_status) == 77)
+            {
+                fprintf(stderr, "native smoke fixture unavailable: p101_parse_uint16_t\n");
+            }
+            else if(WIFEXITED(native_status))
+            {
+                if(WEXITSTATUS(native_status) != EXIT_SUCCESS)
+                {
+                    fprintf(stderr, "native smoke exited unsuccessfully: p101_parse_uint16_t: %d\n", WEXITSTATUS(native_status));
+                }
+                EXPECT(WEXITSTATUS(native_status) == EXIT_SUCCESS);
+            }
+        }
+        p101_error_reset(err);
+    }
+}
+
+/* P101_TEST_CASE(p101_parse_uint16_t_array) */
+static void test_p101_parse_uint16_t_array(struct p101_env *env, struct p101_error *err)
+{
+#ifdef __linux__
+    static const int         errors[]      = {EIO};
+    static const char *const error_names[] = {"EIO"};
+#elif defined(__APPLE__)
+    static const int         errors[]      = {EIO};
+    static const char *const error_names[] = {"EIO"};
+#elif defined(__FreeBSD__)
+    static const int         errors[]      = {EIO};
+    static const char *const error_names[] = {"EIO"};
+#else
+    static const int         errors[]      = {EIO};
+    static const char *const error_names[] = {"EIO"};
+#endif
+
+    for(size_t index = 0U; index < sizeof(errors) / sizeof(errors[0]); index++)
+    {
+        struct fault_state state = {0, errors[index]};
+        int                failures_before;
+
+        failures_before = failures;
+        EXPECT(p101_error_has_no_error(err));
+        fault_resource_events = 0U;
+        errno                 = P101_TEST_ERRNO_SENTINEL;
+        p101_env_set_fault_injector(env, fail_next_call, &state);
+        size_t result = p101_parse_uint16_t_array(env, err, NULL, 0, NULL, NULL);
+        (void)result;
+        EXPECT(state.checks == 1);
+        EXPECT(p101_error_is_errno(err, state.code));
+        EXPECT(errno == P101_TEST_ERRNO_SENTINEL);
+        EXPECT(result == (0));
+        EXPECT(fault_resource_events == 0U);
+        write_outcome("p101_parse_uint16_t_array", "errno", error_names[index], state.code, failures == failures_before);
+        p101_error_reset(err);
+    }
+    p101_env_set_fault_injector(env, NULL, NULL);
+    {
+        int   native_status = 0;
+        pid_t native_pid    = fork();
+
+        EXPECT(native_pid >= 0);
+        if(native_pid == 0)
+        {
+            bool               native_passed = true;
+            struct p101_error *native_err    = NULL;
+            struct p101_env   *native_env    = NULL;
+            FILE              *native_stdin_result;
+
+            native_child_process = true;
+            failures             = 0;
+            (void)alarm(2U);
+            if(unsetenv("P101_CALL_LOG") != 0 || unsetenv("P101_RESOURCE_LOG") != 0)
+            {
+                fprintf(stderr, "native setup failed: cannot clear p101 logging environment\n");
+                native_child_status = 77;
+                goto native_child_done_;
+            }
+            native_stdin_result = freopen("/dev/null", "r", stdin);
+            if(native_stdin_result == NULL)
+            {
+                fprintf(stderr, "native setup failed: cannot make standard input deterministic\n");
+                native_child_status = 77;
+                goto native_child_done_;
+            }
+            native_err = p101_error_create(false);
+            if(native_err == NULL)
+            {
+                native_child_status = 77;
+                goto native_child_done_;
+            }
+            native_env = p101_env_create(native_err, NULL);
+            if(native_env == NULL)
+            {
+                native_child_status = 77;
+                goto native_child_done_;
+            }
+            const char *const native_argument_2[]  = {"1"};
+            uint16_t          native_argument_4[1] = {0};
+            uint8_t           native_argument_5[1] = {0};
+            size_t            native_result        = p101_parse_uint16_t_array(native_env, native_err, native_argument_2, 1, native_argument_4, native_argument_5);
+            (void)native_result;
+            if(p101_error_has_error(native_err))
+            {
+                bool native_error_declared = false;
+
+                for(size_t native_error_index = 0U; native_error_index < sizeof(errors) / sizeof(errors[0]); native_error_index++)
+                {
+                    if(p101_error_is_errno(native_err, errors[native_error_index]))
+                    {
+                        native_error_declared = true;
+                    }
+                }
+                if(!native_error_declared)
+                {
+                    fprintf(stderr, "native smoke produced an undeclared platform failure: p101_parse_uint16_t_array: %s\n", p101_error_get_message(native_err));
+                    native_passed = false;
+                }
+                p101_error_reset(native_err);
+            }
+            native_child_status = native_passed ? EXIT_SUCCESS : EXIT_FAILURE;
+        native_child_done_:
+            p101_env_destroy(native_env);
+            p101_error_destroy(native_err);
+        }
+        if(native_pid > 0)
+        {
+            EXPECT(native_waitpid_nointr(native_pid, &native_status) == native_pid);
+            if(WIFSIGNALED(native_status))
+            {
+                fprintf(stderr, "native smoke terminated by signal: p101_parse_uint16_t_array: %d\n", WTERMSIG(native_status));
+            }
+            EXPECT(WIFEXITED(native_status));
+            if(WIFEXITED(native_status) && WEXITSTATUS(native_status) == 77)
+            {
+                fprintf(stderr, "native smoke fixture unavailable: p101_parse_uint16_t_array\n");
+            }
+            else if(WIFEXITED(native_status))
+            {
+                if(WEXITSTATUS(native_status) != EXIT_SUCCESS)
+                {
+                    fprintf(stderr, "native smoke exited unsuccessfully: p101_parse_uint16_t_array: %d\n", WEXITSTATUS(native_status));
+                }
+                EXPECT(WEXITSTATUS(native_status) == EXIT_SUCCESS);
+            }
+        }
+        p101_error_reset(err);
+    }
+}
+
+/* P101_TEST_CASE(p101_parse_uint16_t_base) */
+static void test_p101_parse_uint16_t_base(struct p101_env *env, struct p101_error *err)
+{
+#ifdef __linux__
+    static const int         errors[]      = {EIO};
+    static const char *const error_names[] = {"EIO"};
+#elif defined(__APPLE__)
+    static const int         errors[]      = {EIO};
+    static const char *const error_names[] = {"EIO"};
+#elif defined(__FreeBSD__)
+    static const int         errors[]      = {EIO};
+    static const char *const error_names[] = {"EIO"};
+#else
+    static const int         errors[]      = {EIO};
+    static const char *const error_names[] = {"EIO"};
+#endif
+
+    for(size_t index = 0U; index < sizeof(errors) / sizeof(errors[0]); index++)
+    {
+        struct fault_state state = {0, errors[index]};
+        int                failures_before;
+
+        failures_before = failures;
+        EXPECT(p101_error_has_no_error(err));
+        fault_resource_events = 0U;
+        errno                 = P101_TEST_ERRNO_SENTINEL;
+        p101_env_set_fault_injector(env, fail_next_call, &state);
+        uint16_t result = p101_parse_uint16_t_base(env, err, NULL, 0, 0);
+        (void)result;
+        EXPECT(state.checks == 1);
+        EXPECT(p101_error_is_errno(err, state.code));
+        EXPECT(errno == P101_TEST_ERRNO_SENTINEL);
+        EXPECT(result == (0));
+        EXPECT(fault_resource_events == 0U);
+        write_outcome("p101_parse_uint16_t_base", "errno", error_names[index], state.code, failures == failures_before);
+        p101_error_reset(err);
+    }
+    p101_env_set_fault_injector(env, NULL, NULL);
+    {
+        int   native_status = 0;
+        pid_t native_pid    = fork();
+
+        EXPECT(native_pid >= 0);
+        if(native_pid == 0)
+        {
+            bool               native_passed = true;
+            struct p101_error *native_err    = NULL;
+            struct p101_env   *native_env    = NULL;
+            FILE              *native_stdin_result;
+
+            native_child_process = true;
+            failures             = 0;
+            (void)alarm(2U);
+            if(unsetenv("P101_CALL_LOG") != 0 || unsetenv("P101_RESOURCE_LOG") != 0)
+            {
+                fprintf(stderr, "native setup failed: cannot clear p101 logging environment\n");
+                native_child_status = 77;
+                goto native_child_done_;
+            }
+            native_stdin_result = freopen("/dev/null", "r", stdin);
+            if(native_stdin_result == NULL)
+            {
+                fprintf(stderr, "native setup failed: cannot make standard input deterministic\n");
+                native_child_status = 77;
+                goto native_child_done_;
+            }
+            native_err = p101_error_create(false);
+            if(native_err == NULL)
+            {
+                native_child_status = 77;
+                goto native_child_done_;
+            }
+            native_env = p101_env_create(native_err, NULL);
+            if(native_env == NULL)
+            {
+                native_child_status = 77;
+                goto native_child_done_;
+            }
+            uint16_t native_result = p101_parse_uint16_t_base(native_env, native_err, "0x1", 0, 0);
+            (void)native_result;
+            if(p101_error_has_error(native_err))
+            {
+                bool native_error_declared = false;
+
+                for(size_t native_error_index = 0U; native_error_index < sizeof(errors) / sizeof(errors[0]); native_error_index++)
+                {
+                    if(p101_error_is_errno(native_err, errors[native_error_index]))
+                    {
+                        native_error_declared = true;
+                    }
+                }
+                if(!native_error_declared)
+                {
+                    fprintf(stderr, "native smoke produced an undeclared platform failure: p101_parse_uint16_t_base: %s\n", p101_error_get_message(native_err));
+                    native_passed = false;
+                }
+                p101_error_reset(native_err);
+            }
+            native_child_status = native_passed ? EXIT_SUCCESS : EXIT_FAILURE;
+        native_child_done_:
+            p101_env_destroy(native_env);
+            p101_error_destroy(native_err);
+        }
+        if(native_pid > 0)
+        {
+            EXPECT(native_waitpid_nointr(native_pid, &native_status) == native_pid);
+            if(WIFSIGNALED(native_status))
+            {
+                fprintf(stderr, "native smoke terminated by signal: p101_parse_uint16_t_base: %d\n", WTERMSIG(native_status));
+            }
+            EXPECT(WIFEXITED(native_status));
+            if(WIFEXITED(native_status) && WEXITSTATUS(native_status) == 77)
+            {
+                fprintf(stderr, "native smoke fixture unavailable: p101_parse_uint16_t_base\n");
+            }
+            else if(WIFEXITED(native_status))
+            {
+                if(WEXITSTATUS(native_status) != EXIT_SUCCESS)
+                {
+                    fprintf(stderr, "native smoke exited unsuccessfully: p101_parse_uint16_t_base: %d\n", WEXITSTATUS(native_status));
+                }
+                EXPECT(WEXITSTATUS(native_status) == EXIT_SUCCESS);
+            }
+        }
+        p101_error_reset(err);
+    }
+}
+
+/* P101_TEST_CASE(p101_parse_uint16_t_n) */
+static void test_p101_parse_uint16_t_n(struct p101_env *env, struct p101_error *err)
+{
+#ifdef __linux__
+    static const int         errors[]      = {EIO};
+    static const char *const error_names[] = {"EIO"};
+#elif defined(__APPLE__)
+    static const int         errors[]      = {EIO};
+    static const char *const error_names[] = {"EIO"};
+#elif defined(__FreeBSD__)
+    static const int         errors[]      = {EIO};
+    static const char *const error_names[] = {"EIO"};
+#else
+    static const int         errors[]      = {EIO};
+    static const char *const error_names[] = {"EIO"};
+#endif
+
+    for(size_t index = 0U; index < sizeof(errors) / sizeof(errors[0]); index++)
+    {
+        struct fault_state state = {0, errors[index]};
+        int                failures_before;
+
+        failures_before = failures;
+        EXPECT(p101_error_has_no_error(err));
+        fault_resource_events = 0U;
+        errno                 = P101_TEST_ERRNO_SENTINEL;
+        p101_env_set_fault_injector(env, fail_next_call, &state);
+        uint16_t result = p101_parse_uint16_t_n(env, err, NULL, 0, 0);
+        (void)result;
+        EXPECT(state.checks == 1);
+        EXPECT(p101_error_is_errno(err, state.code));
+        EXPECT(errno == P101_TEST_ERRNO_SENTINEL);
+        EXPECT(result == (0));
+        EXPECT(fault_resource_events == 0U);
+        write_outcome("p101_parse_uint16_t_n", "errno", error_names[index], state.code, failures == failures_before);
+        p101_error_reset(err);
+    }
+    p101_env_set_fault_injector(env, NULL, NULL);
+    {
+        int   native_status = 0;
+        pid_t native_pid    = fork();
+
+        EXPECT(native_pid >= 0);
+        if(native_pid == 0)
+        {
+            bool               native_passed = true;
+            struct p101_error *native_err    = NULL;
+            struct p101_env   *native_env    = NULL;
+            FILE              *native_stdin_result;
+
+            native_child_process = true;
+            failures             = 0;
+            (void)alarm(2U);
+            if(unsetenv("P101_CALL_LOG") != 0 || unsetenv("P101_RESOURCE_LOG") != 0)
+            {
+                fprintf(stderr, "native setup failed: cannot clear p101 logging environment\n");
+                native_child_status = 77;
+                goto native_child_done_;
+            }
+            native_stdin_result = freopen("/dev/null", "r", stdin);
+            if(native_stdin_result == NULL)
+            {
+                fprintf(stderr, "native setup failed: cannot make standard input deterministic\n");
+                native_child_status = 77;
+                goto native_child_done_;
+            }
+            native_err = p101_error_create(false);
+            if(native_err == NULL)
+            {
+                native_child_status = 77;
+                goto native_child_done_;
+            }
+            native_env = p101_env_create(native_err, NULL);
+            if(native_env == NULL)
+            {
+                native_child_status = 77;
+                goto native_child_done_;
+            }
+            uint16_t native_result = p101_parse_uint16_t_n(native_env, native_err, "1", 1, 0);
+            (void)native_result;
+            if(p101_error_has_error(native_err))
+            {
+                bool native_error_declared = false;
+
+                for(size_t native_error_index = 0U; native_error_index < sizeof(errors) / sizeof(errors[0]); native_error_index++)
+                {
+                    if(p101_error_is_errno(native_err, errors[native_error_index]))
+                    {
+                        native_error_declared = true;
+                    }
+                }
+                if(!native_error_declared)
+                {
+                    fprintf(stderr, "native smoke produced an undeclared platform failure: p101_parse_uint16_t_n: %s\n", p101_error_get_message(native_err));
+                    native_passed = false;
+                }
+                p101_error_reset(native_err);
+            }
+            native_child_status = native_passed ? EXIT_SUCCESS : EXIT_FAILURE;
+        native_child_done_:
+            p101_env_destroy(native_env);
+            p101_error_destroy(native_err);
+        }
+        if(native_pid > 0)
+        {
+            EXPECT(native_waitpid_nointr(native_pid, &native_status) == native_pid);
+            if(WIFSIGNALED(native_status))
+            {
+                fprintf(stderr, "native smoke terminated by signal: p101_parse_uint16_t_n: %d\n", WTERMSIG(native_status));
+            }
+            EXPECT(WIFEXITED(native_status));
+            if(WIFEXITED(native_status) && WEXITSTATUS(native_status) == 77)
+            {
+                fprintf(stderr, "native smoke fixture unavailable: p101_parse_uint16_t_n\n");
+            }
+            else if(WIFEXITED(native_status))
+            {
+                if(WEXITSTATUS(native_status) != EXIT_SUCCESS)
+                {
+                    fprintf(stderr, "native smoke exited unsuccessfully: p101_parse_uint16_t_n: %d\n", WEXITSTATUS(native_status));
+                }
+                EXPECT(WEXITSTATUS(native_status) == EXIT_SUCCESS);
+            }
+        }
+        p101_error_reset(err);
+    }
+}
+
+/* P101_TEST_CASE(p101_parse_uint16_t_prefix) */
+static void test_p101_parse_uint16_t_prefix(struct p101_env *env, struct p101_error *err)
+{
+#ifdef __linux__
+    static const int         errors[]      = {EIO};
+    static const char *const error_names[] = {"EIO"};
+#elif defined(__APPLE__)
+    static const int         errors[]      = {EIO};
+    static const char *const error_names[] = {"EIO"};
+#elif defined(__FreeBSD__)
+    static const int         errors[]      = {EIO};
+    static const char *const error_names[] = {"EIO"};
+#else
+    static const int         errors[]      = {EIO};
+    static const char *const error_names[] = {"EIO"};
+#endif
+
+    for(size_t index = 0U; index < sizeof(errors) / sizeof(errors[0]); index++)
+    {
+        struct fault_state state = {0, errors[index]};
+        int                failures_before;
+
+        failures_before = failures;
+        EXPECT(p101_error_has_no_error(err));
+        fault_resource_events = 0U;
+        errno                 = P101_TEST_ERRNO_SENTINEL;
+        p101_env_set_fault_injector(env, fail_next_call, &state);
+        uint16_t result = p101_parse_uint16_t_prefix(env, err, NULL, NULL, 0);
+        (void)result;
+        EXPECT(state.checks == 1);
+        EXPECT(p101_error_is_errno(err, state.code));
+        EXPECT(errno == P101_TEST_ERRNO_SENTINEL);
+        EXPECT(result == (0));
+        EXPECT(fault_resource_events == 0U);
+        write_outcome("p101_parse_uint16_t_prefix", "errno", error_names[index], state.code, failures == failures_before);
+        p101_error_reset(err);
+    }
+    p101_env_set_fault_injector(env, NULL, NULL);
+    {
+        int   native_status = 0;
+        pid_t native_pid    = fork();
+
+        EXPECT(native_pid >= 0);
+        if(native_pid == 0)
+        {
+            bool               native_passed = true;
+            struct p101_error *native_err    = NULL;
+            struct p101_env   *native_env    = NULL;
+            FILE              *native_stdin_result;
+
+            native_child_process = true;
+            failures             = 0;
+            (void)alarm(2U);
+            if(unsetenv("P101_CALL_LOG") != 0 || unsetenv("P101_RESOURCE_LOG") != 0)
+            {
+                fprintf(stderr, "native setup failed: cannot clear p101 logging environment\n");
+                native_child_status = 77;
+                goto native_child_done_;
+            }
+            native_stdin_result = freopen("/dev/null", "r", stdin);
+            if(native_stdin_result == NULL)
+            {
+                fprintf(stderr, "native setup failed: cannot make standard input deterministic\n");
+                native_child_status = 77;
+                goto native_child_done_;
+            }
+            native_err = p101_error_create(false);
+            if(native_err == NULL)
+            {
+                native_child_status = 77;
+                goto native_child_done_;
+            }
+            native_env = p101_env_create(native_err, NULL);
+            if(native_env == NULL)
+            {
+                native_child_status = 77;
+                goto native_child_done_;
+            }
+            const char *native_argument_3 = NULL;
+            uint16_t    native_result     = p101_parse_uint16_t_prefix(native_env, native_err, "1", &native_argument_3, 0);
+            (void)native_result;
+            if(p101_error_has_error(native_err))
+            {
+                bool native_error_declared = false;
+
+                for(size_t native_error_index = 0U; native_error_index < sizeof(errors) / sizeof(errors[0]); native_error_index++)
+                {
+                    if(p101_error_is_errno(native_err, errors[native_error_index]))
+                    {
+                        native_error_declared = true;
+                    }
+                }
+                if(!native_error_declared)
+                {
+                    fprintf(stderr, "native smoke produced an undeclared platform failure: p101_parse_uint16_t_prefix: %s\n", p101_error_get_message(native_err));
+                    native_passed = false;
+                }
+                p101_error_reset(native_err);
+            }
+            native_child_status = native_passed ? EXIT_SUCCESS : EXIT_FAILURE;
+        native_child_done_:
+            p101_env_destroy(native_env);
+            p101_error_destroy(native_err);
+        }
+        if(native_pid > 0)
+        {
+            EXPECT(native_waitpid_nointr(native_pid, &native_status) == native_pid);
+            if(WIFSIGNALED(native_status))
+            {
+                fprintf(stderr, "native smoke terminated by signal: p101_parse_uint16_t_prefix: %d\n", WTERMSIG(native_status));
+            }
+            EXPECT(WIFEXITED(native_status));
+            if(WIFEXITED(native_status) && WEXITSTATUS(native_status) == 77)
+            {
+                fprintf(stderr, "native smoke fixture unavailable: p101_parse_uint16_t_prefix\n");
+            }
+            else if(WIFEXITED(native_status))
+            {
+                if(WEXITSTATUS(native_status) != EXIT_SUCCESS)
+                {
+                    fprintf(stderr, "native smoke exited unsuccessfully: p101_parse_uint16_t_prefix: %d\n", WEXITSTATUS(native_status));
+                }
+                EXPECT(WEXITSTATUS(native_status) == EXIT_SUCCESS);
+            }
+        }
+        p101_error_reset(err);
+    }
+}
+
+/* P101_TEST_CASE(p101_parse_uint16_t_size) */
+static void test_p101_parse_uint16_t_size(struct p101_env *env, struct p101_error *err)
+{
+#ifdef __linux__
+    static const int         errors[]      = {EIO};
+    static const char *const error_names[] = {"EIO"};
+#elif defined(__APPLE__)
+    static const int         errors[]      = {EIO};
+    static const char *const error_names[] = {"EIO"};
+#elif defined(__FreeBSD__)
+    static const int         errors[]      = {EIO};
+    static const char *const error_names[] = {"EIO"};
+#else
+    static const int         errors[]      = {EIO};
+    static const char *const error_names[] = {"EIO"};
+#endif
+
+    for(size_t index = 0U; index < sizeof(errors) / sizeof(errors[0]); index++)
+    {
+        struct fault_state state = {0, errors[index]};
+        int                failures_before;
+
+        failures_before = failures;
+        EXPECT(p101_error_has_no_error(err));
+        fault_resource_events = 0U;
+        errno                 = P101_TEST_ERRNO_SENTINEL;
+        p101_env_set_fault_injector(env, fail_next_call, &state);
+        uint16_t result = p101_parse_uint16_t_size(env, err, NULL, 0);
+        (void)result;
+        EXPECT(state.checks == 1);
+        EXPECT(p101_error_is_errno(err, state.code));
+        EXPECT(errno == P101_TEST_ERRNO_SENTINEL);
+        EXPECT(result == (0));
+        EXPECT(fault_resource_events == 0U);
+        write_outcome("p101_parse_uint16_t_size", "errno", error_names[index], state.code, failures == failures_before);
+        p101_error_reset(err);
+    }
+    p101_env_set_fault_injector(env, NULL, NULL);
+    {
+        int   native_status = 0;
+        pid_t native_pid    = fork();
+
+        EXPECT(native_pid >= 0);
+        if(native_pid == 0)
+        {
+            bool               native_passed = true;
+            struct p101_error *native_err    = NULL;
+            struct p101_env   *native_env    = NULL;
+            FILE              *native_stdin_result;
+
+            native_child_process = true;
+            failures             = 0;
+            (void)alarm(2U);
+            if(unsetenv("P101_CALL_LOG") != 0 || unsetenv("P101_RESOURCE_LOG") != 0)
+            {
+                fprintf(stderr, "native setup failed: cannot clear p101 logging environment\n");
+                native_child_status = 77;
+                goto native_child_done_;
+            }
+            native_stdin_result = freopen("/dev/null", "r", stdin);
+            if(native_stdin_result == NULL)
+            {
+                fprintf(stderr, "native setup failed: cannot make standard input deterministic\n");
+                native_child_status = 77;
+                goto native_child_done_;
+            }
+            native_err = p101_error_create(false);
+            if(native_err == NULL)
+            {
+                native_child_status = 77;
+                goto native_child_done_;
+            }
+            native_env = p101_env_create(native_err, NULL);
+            if(native_env == NULL)
+            {
+                native_child_status = 77;
+                goto native_child_done_;
+            }
+            uint16_t native_result = p101_parse_uint16_t_size(native_env, native_err, "1K", 0);
+            (void)native_result;
+            if(p101_error_has_error(native_err))
+            {
+                bool native_error_declared = false;
+
+                for(size_t native_error_index = 0U; native_error_index < sizeof(errors) / sizeof(errors[0]); native_error_index++)
+                {
+                    if(p101_error_is_errno(native_err, errors[native_error_index]))
+                    {
+                        native_error_declared = true;
+                    }
+                }
+                if(!native_error_declared)
+                {
+                    fprintf(stderr, "native smoke produced an undeclared platform failure: p101_parse_uint16_t_size: %s\n", p101_error_get_message(native_err));
+                    native_passed = false;
+                }
+                p101_error_reset(native_err);
+            }
+            native_child_status = native_passed ? EXIT_SUCCESS : EXIT_FAILURE;
+        native_child_done_:
+            p101_env_destroy(native_env);
+            p101_error_destroy(native_err);
+        }
+        if(native_pid > 0)
+        {
+            EXPECT(native_waitpid_nointr(native_pid, &native_status) == native_pid);
+            if(WIFSIGNALED(native_status))
+            {
+                fprintf(stderr, "native smoke terminated by signal: p101_parse_uint16_t_size: %d\n", WTERMSIG(native_status));
+            }
+            EXPECT(WIFEXITED(native_status));
+            if(WIFEXITED(native_status) && WEXITSTATUS(native_status) == 77)
+            {
+                fprintf(stderr, "native smoke fixture unavailable: p101_parse_uint16_t_size\n");
+            }
+            else if(WIFEXITED(native_status))
+            {
+                if(WEXITSTATUS(native_status) != EXIT_SUCCESS)
+                {
+                    fprintf(stderr, "native smoke exited unsuccessfully: p101_parse_uint16_t_size: %d\n", WEXITSTATUS(native_status));
+                }
+                EXPECT(WEXITSTATUS(native_status) == EXIT_SUCCESS);
+            }
+        }
+        p101_error_reset(err);
+    }
+}
+
+/* P101_TEST_CASE(p101_parse_uint32_t) */
+static void test_p101_parse_uint32_t(struct p101_env *env, struct p101_error *err)
+{
+#ifdef __linux__
+    static const int         errors[]      = {EIO};
+    static const char *const error_names[] = {"EIO"};
+#elif defined(__APPLE__)
+    static const int         errors[]      = {EIO};
+    static const char *const error_names[] = {"EIO"};
+#elif defined(__FreeBSD__)
+    static const int         errors[]      = {EIO};
+    static const char *const error_names[] = {"EIO"};
+#else
+    static const int         errors[]      = {EIO};
+    static const char *const error_names[] = {"EIO"};
+#endif
+
+    for(size_t index = 0U; index < sizeof(errors) / sizeof(errors[0]); index++)
+    {
+        struct fault_state state = {0, errors[index]};
+        int                failures_before;
+
+        failures_before = failures;
+        EXPECT(p101_error_has_no_error(err));
+        fault_resource_events = 0U;
+        errno                 = P101_TEST_ERRNO_SENTINEL;
+        p101_env_set_fault_injector(env, fail_next_call, &state);
+        uint32_t result = p101_parse_uint32_t(env, err, NULL, 0);
+        (void)result;
+        EXPECT(state.checks == 1);
+        EXPECT(p101_error_is_errno(err, state.code));
+        EXPECT(errno == P101_TEST_ERRNO_SENTINEL);
+        EXPECT(result == (0));
+        EXPECT(fault_resource_events == 0U);
+        write_outcome("p101_parse_uint32_t", "errno", error_names[index], state.code, failures == failures_before);
+        p101_error_reset(err);
+    }
+    p101_env_set_fault_injector(env, NULL, NULL);
+    {
+        int   native_status = 0;
+        pid_t native_pid    = fork();
+
+        EXPECT(native_pid >= 0);
+        if(native_pid == 0)
+        {
+            bool               native_passed = true;
+            struct p101_error *native_err    = NULL;
+            struct p101_env   *native_env    = NULL;
+            FILE              *native_stdin_result;
+
+            native_child_process = true;
+            failures             = 0;
+            (void)alarm(2U);
+            if(unsetenv("P101_CALL_LOG") != 0 || unsetenv("P101_RESOURCE_LOG") != 0)
+            {
+                fprintf(stderr, "native setup failed: cannot clear p101 logging environment\n");
+                native_child_status = 77;
+                goto native_child_done_;
+            }
+            native_stdin_result = freopen("/dev/null", "r", stdin);
+            if(native_stdin_result == NULL)
+            {
+                fprintf(stderr, "native setup failed: cannot make standard input deterministic\n");
+                native_child_status = 77;
+                goto native_child_done_;
+            }
+            native_err = p101_error_create(false);
+            if(native_err == NULL)
+            {
+                native_child_status = 77;
+                goto native_child_done_;
+            }
+            native_env = p101_env_create(native_err, NULL);
+            if(native_env == NULL)
+            {
+                native_child_status = 77;
+                goto native_child_done_;
+            }
+            uint32_t native_result = p101_parse_uint32_t(native_env, native_err, "1", 0);
+            (void)native_result;
+            if(p101_error_has_error(native_err))
+            {
+                bool native_error_declared = false;
+
+                for(size_t native_error_index = 0U; native_error_index < sizeof(errors) / sizeof(errors[0]); native_error_index++)
+                {
+                    if(p101_error_is_errno(native_err, errors[native_error_index]))
+                    {
+                        native_error_declared = true;
+                    }
+                }
+                if(!native_error_declared)
+                {
+                    fprintf(stderr, "native smoke produced an undeclared platform failure: p101_parse_uint32_t: %s\n", p101_error_get_message(native_err));
+                    native_passed = false;
+                }
+                p101_error_reset(native_err);
+            }
+            native_child_status = native_passed ? EXIT_SUCCESS : EXIT_FAILURE;
+        native_child_done_:
+            p101_env_destroy(native_env);
+            p101_error_destroy(native_err);
+        }
+        if(native_pid > 0)
+        {
+            EXPECT(native_waitpid_nointr(native_pid, &native_status) == native_pid);
+            if(WIFSIGNALED(native_status))
+            {
+                fprintf(stderr, "native smoke terminated by signal: p101_parse_uint32_t: %d\n", WTERMSIG(native_status));
+            }
+            EXPECT(WIFEXITED(native_status));
+            if(WIFEXITED(native_status) && WEXITSTATUS(native_status) == 77)
+            {
+                fprintf(stderr, "native smoke fixture unavailable: p101_parse_uint32_t\n");
+            }
+            else if(WIFEXITED(native_status))
+            {
+                if(WEXITSTATUS(native_status) != EXIT_SUCCESS)
+                {
+                    fprintf(stderr, "native smoke exited unsuccessfully: p101_parse_uint32_t: %d\n", WEXITSTATUS(native_status));
+                }
+                EXPECT(WEXITSTATUS(native_status) == EXIT_SUCCESS);
+            }
+        }
+        p101_error_reset(err);
+    }
+}
+
+/* P101_TEST_CASE(p101_parse_uint32_t_array) */
+static void test_p101_parse_uint32_t_array(struct p101_env *env, struct p101_error *err)
+{
+#ifdef __linux__
+    static const int         errors[]      = {EIO};
+    static const char *const error_names[] = {"EIO"};
+#elif defined(__APPLE__)
+    static const int         errors[]      = {EIO};
+    static const char *const error_names[] = {"EIO"};
+#elif defined(__FreeBSD__)
+    static const int         errors[]      = {EIO};
+    static const char *const error_names[] = {"EIO"};
+#else
+    static const int         errors[]      = {EIO};
+    static const char *const error_names[] = {"EIO"};
+#endif
+
+    for(size_t index = 0U; index < sizeof(errors) / sizeof(errors[0]); index++)
+    {
+        struct fault_state state = {0, errors[index]};
+        int                failures_before;
+
+        failures_before = failures;
+        EXPECT(p101_error_has_no_error(err));
+        fault_resource_events = 0U;
+        errno                 = P101_TEST_ERRNO_SENTINEL;
+        p101_env_set_fault_injector(env, fail_next_call, &state);
+        size_t result = p101_parse_uint32_t_array(env, err, NULL, 0, NULL, NULL);
+        (void)result;
+        EXPECT(state.checks == 1);
+        EXPECT(p101_error_is_errno(err, state.code));
+        EXPECT(errno == P101_TEST_ERRNO_SENTINEL);
+        EXPECT(result == (0));
+        EXPECT(fault_resource_events == 0U);
+        write_outcome("p101_parse_uint32_t_array", "errno", error_names[index], state.code, failures == failures_before);
+        p101_error_reset(err);
+    }
+    p101_env_set_fault_injector(env, NULL, NULL);
+    {
+        int   native_status = 0;
+        pid_t native_pid    = fork();
+
+        EXPECT(native_pid >= 0);
+        if(native_pid == 0)
+        {
+            bool               native_passed = true;
+            struct p101_error *native_err    = NULL;
+            struct p101_env   *native_env    = NULL;
+            FILE              *native_stdin_result;
+
+            native_child_process = true;
+            failures             = 0;
+            (void)alarm(2U);
+            if(unsetenv("P101_CALL_LOG") != 0 || unsetenv("P101_RESOURCE_LOG") != 0)
+            {
+                fprintf(stderr, "native setup failed: cannot clear p101 logging environment\n");
+                native_child_status = 77;
+                goto native_child_done_;
+            }
+            native_stdin_result = freopen("/dev/null", "r", stdin);
+            if(native_stdin_result == NULL)
+            {
+                fprintf(stderr, "native setup failed: cannot make standard input deterministic\n");
+                native_child_status = 77;
+                goto native_child_done_;
+            }
+            native_err = p101_error_create(false);
+            if(native_err == NULL)
+            {
+                native_child_status = 77;
+                goto native_child_done_;
+            }
+            native_env = p101_env_create(native_err, NULL);
+            if(native_env == NULL)
+            {
+                native_child_status = 77;
+                goto native_child_done_;
+            }
+            const char *const native_argument_2[]  = {"1"};
+            uint32_t          native_argument_4[1] = {0};
+            uint8_t           native_argument_5[1] = {0};
+            size_t            native_result        = p101_parse_uint32_t_array(native_env, native_err, native_argument_2, 1, native_argument_4, native_argument_5);
+            (void)native_result;
+            if(p101_error_has_error(native_err))
+            {
+                bool native_error_declared = false;
+
+                for(size_t native_error_index = 0U; native_error_index < sizeof(errors) / sizeof(errors[0]); native_error_index++)
+                {
+                    if(p101_error_is_errno(native_err, errors[native_error_index]))
+                    {
+                        native_error_declared = true;
+                    }
+                }
+                if(!native_error_declared)
+                {
+                    fprintf(stderr, "native smoke produced an undeclared platform failure: p101_parse_uint32_t_array: %s\n", p101_error_get_message(native_err));
+                    native_passed = false;
+                }
+                p101_error_reset(native_err);
+            }
+            native_child_status = native_passed ? EXIT_SUCCESS : EXIT_FAILURE;
+        native_child_done_:
+            p101_env_destroy(native_env);
+            p101_error_destroy(native_err);
+        }
+        if(native_pid > 0)
+        {
+            EXPECT(native_waitpid_nointr(native_pid, &native_status) == native_pid);
+            if(WIFSIGNALED(native_status))
+            {
+                fprintf(stderr, "native smoke terminated by signal: p101_parse_uint32_t_array: %d\n", WTERMSIG(native_status));
+            }
+            EXPECT(WIFEXITED(native_status));
+            if(WIFEXITED(native_status) && WEXITSTATUS(native_status) == 77)
+            {
+                fprintf(stderr, "native smoke fixture unavailable: p101_parse_uint32_t_array\n");
+            }
+            else if(WIFEXITED(native_status))
+            {
+                if(WEXITSTATUS(native_status) != EXIT_SUCCESS)
+                {
+                    fprintf(stderr, "native smoke exited unsuccessfully: p101_parse_uint32_t_array: %d\n", WEXITSTATUS(native_status));
+                }
+                EXPECT(WEXITSTATUS(native_status) == EXIT_SUCCESS);
+            }
+        }
+        p101_error_reset(err);
+    }
+}
+
+/* P101_TEST_CASE(p101_parse_uint32_t_base) */
+static void test_p101_parse_uint32_t_base(struct p101_env *env, struct p101_error *err)
+{
+#ifdef __linux__
+    static const int         errors[]      = {EIO};
+    static const char *const error_names[] = {"EIO"};
+#elif defined(__APPLE__)
+    static const int         errors[]      = {EIO};
+    static const char *const error_names[] = {"EIO"};
+#elif defined(__FreeBSD__)
+    static const int         errors[]      = {EIO};
+    static const char *const error_names[] = {"EIO"};
+#else
+    static const int         errors[]      = {EIO};
+    static const char *const error_names[] = {"EIO"};
+#endif
+
+    for(size_t index = 0U; index < sizeof(errors) / sizeof(errors[0]); index++)
+    {
+        struct fault_state state = {0, errors[index]};
+        int                failures_before;
+
+        failures_before = failures;
+        EXPECT(p101_error_has_no_error(err));
+        fault_resource_events = 0U;
+        errno                 = P101_TEST_ERRNO_SENTINEL;
+        p101_env_set_fault_injector(env, fail_next_call, &state);
+        uint32_t result = p101_parse_uint32_t_base(env, err, NULL, 0, 0);
+        (void)result;
+        EXPECT(state.checks == 1);
+        EXPECT(p101_error_is_errno(err, state.code));
+        EXPECT(errno == P101_TEST_ERRNO_SENTINEL);
+        EXPECT(result == (0));
+        EXPECT(fault_resource_events == 0U);
+        write_outcome("p101_parse_uint32_t_base", "errno", error_names[index], state.code, failures == failures_before);
+        p101_error_reset(err);
+    }
+    p101_env_set_fault_injector(env, NULL, NULL);
+    {
+        int   native_status = 0;
+        pid_t native_pid    = fork();
+
+        EXPECT(native_pid >= 0);
+        if(native_pid == 0)
+        {
+            bool               native_passed = true;
+            struct p101_error *native_err    = NULL;
+            struct p101_env   *native_env    = NULL;
+            FILE              *native_stdin_result;
+
+            native_child_process = true;
+            failures             = 0;
+            (void)alarm(2U);
+            if(unsetenv("P101_CALL_LOG") != 0 || unsetenv("P101_RESOURCE_LOG") != 0)
+            {
+                fprintf(stderr, "native setup failed: cannot clear p101 logging environment\n");
+                native_child_status = 77;
+                goto native_child_done_;
+            }
+            native_stdin_result = freopen("/dev/null", "r", stdin);
+            if(native_stdin_result == NULL)
+            {
+                fprintf(stderr, "native setup failed: cannot make standard input deterministic\n");
+                native_child_status = 77;
+                goto native_child_done_;
+            }
+            native_err = p101_error_create(false);
+            if(native_err == NULL)
+            {
+                native_child_status = 77;
+                goto native_child_done_;
+            }
+            native_env = p101_env_create(native_err, NULL);
+            if(native_env == NULL)
+            {
+                native_child_status = 77;
+                goto native_child_done_;
+            }
+            uint32_t native_result = p101_parse_uint32_t_base(native_env, native_err, "0x1", 0, 0);
+            (void)native_result;
+            if(p101_error_has_error(native_err))
+            {
+                bool native_error_declared = false;
+
+                for(size_t native_error_index = 0U; native_error_index < sizeof(errors) / sizeof(errors[0]); native_error_index++)
+                {
+                    if(p101_error_is_errno(native_err, errors[native_error_index]))
+                    {
+                        native_error_declared = true;
+                    }
+                }
+                if(!native_error_declared)
+                {
+                    fprintf(stderr, "native smoke produced an undeclared platform failure: p101_parse_uint32_t_base: %s\n", p101_error_get_message(native_err));
+                    native_passed = false;
+                }
+                p101_error_reset(native_err);
+            }
+            native_child_status = native_passed ? EXIT_SUCCESS : EXIT_FAILURE;
+        native_child_done_:
+            p101_env_destroy(native_env);
+            p101_error_destroy(native_err);
+        }
+        if(native_pid > 0)
+        {
+            EXPECT(native_waitpid_nointr(native_pid, &native_status) == native_pid);
+            if(WIFSIGNALED(native_status))
+            {
+                fprintf(stderr, "native smoke terminated by signal: p101_parse_uint32_t_base: %d\n", WTERMSIG(native_status));
+            }
+            EXPECT(WIFEXITED(native_status));
+            if(WIFEXITED(native_status) && WEXITSTATUS(native_status) == 77)
+            {
+                fprintf(stderr, "native smoke fixture unavailable: p101_parse_uint32_t_base\n");
+            }
+            else if(WIFEXITED(native_status))
+            {
+                if(WEXITSTATUS(native_status) != EXIT_SUCCESS)
+                {
+                    fprintf(stderr, "native smoke exited unsuccessfully: p101_parse_uint32_t_base: %d\n", WEXITSTATUS(native_status));
+                }
+                EXPECT(WEXITSTATUS(native_status) == EXIT_SUCCESS);
+            }
+        }
+        p101_error_reset(err);
+    }
+}
+
+/* P101_TEST_CASE(p101_parse_uint32_t_n) */
+static void test_p101_parse_uint32_t_n(struct p101_env *env, struct p101_error *err)
+{
+#ifdef __linux__
+    static const int         errors[]      = {EIO};
+    static const char *const error_names[] = {"EIO"};
+#elif defined(__APPLE__)
+    static const int         errors[]      = {EIO};
+    static const char *const error_names[] = {"EIO"};
+#elif defined(__FreeBSD__)
+    static const int         errors[]      = {EIO};
+    static const char *const error_names[] = {"EIO"};
+#else
+    static const int         errors[]      = {EIO};
+    static const char *const error_names[] = {"EIO"};
+#endif
+
+    for(size_t index = 0U; index < sizeof(errors) / sizeof(errors[0]); index++)
+    {
+        struct fault_state state = {0, errors[index]};
+        int                failures_before;
+
+        failures_before = failures;
+        EXPECT(p101_error_has_no_error(err));
+        fault_resource_events = 0U;
+        errno                 = P101_TEST_ERRNO_SENTINEL;
+        p101_env_set_fault_injector(env, fail_next_call, &state);
+        uint32_t result = p101_parse_uint32_t_n(env, err, NULL, 0, 0);
+        (void)result;
+        EXPECT(state.checks == 1);
+        EXPECT(p101_error_is_errno(err, state.code));
+        EXPECT(errno == P101_TEST_ERRNO_SENTINEL);
+        EXPECT(result == (0));
+        EXPECT(fault_resource_events == 0U);
+        write_outcome("p101_parse_uint32_t_n", "errno", error_names[index], state.code, failures == failures_before);
+        p101_error_reset(err);
+    }
+    p101_env_set_fault_injector(env, NULL, NULL);
+    {
+        int   native_status = 0;
+        pid_t native_pid    = fork();
+
+        EXPECT(native_pid >= 0);
+        if(native_pid == 0)
+        {
+            bool               native_passed = true;
+            struct p101_error *native_err    = NULL;
+            struct p101_env   *native_env    = NULL;
+            FILE              *native_stdin_result;
+
+            native_child_process = true;
+            failures             = 0;
+            (void)alarm(2U);
+            if(unsetenv("P101_CALL_LOG") != 0 || unsetenv("P101_RESOURCE_LOG") != 0)
+            {
+                fprintf(stderr, "native setup failed: cannot clear p101 logging environment\n");
+                native_child_status = 77;
+                goto native_child_done_;
+            }
+            native_stdin_result = freopen("/dev/null", "r", stdin);
+            if(native_stdin_result == NULL)
+            {
+                fprintf(stderr, "native setup failed: cannot make standard input deterministic\n");
+                native_child_status = 77;
+                goto native_child_done_;
+            }
+            native_err = p101_error_create(false);
+            if(native_err == NULL)
+            {
+                native_child_status = 77;
+                goto native_child_done_;
+            }
+            native_env = p101_env_create(native_err, NULL);
+            if(native_env == NULL)
+            {
+                native_child_status = 77;
+                goto native_child_done_;
+            }
+            uint32_t native_result = p101_parse_uint32_t_n(native_env, native_err, "1", 1, 0);
+            (void)native_result;
+            if(p101_error_has_error(native_err))
+            {
+                bool native_error_declared = false;
+
+                for(size_t native_error_index = 0U; native_error_index < sizeof(errors) / sizeof(errors[0]); native_error_index++)
+                {
+                    if(p101_error_is_errno(native_err, errors[native_error_index]))
+                    {
+                        native_error_declared = true;
+                    }
+                }
+                if(!native_error_declared)
+                {
+                    fprintf(stderr, "native smoke produced an undeclared platform failure: p101_parse_uint32_t_n: %s\n", p101_error_get_message(native_err));
+                    native_passed = false;
+                }
+                p101_error_reset(native_err);
+            }
+            native_child_status = native_passed ? EXIT_SUCCESS : EXIT_FAILURE;
+        native_child_done_:
+            p101_env_destroy(native_env);
+            p101_error_destroy(native_err);
+        }
+        if(native_pid > 0)
+        {
+            EXPECT(native_waitpid_nointr(native_pid, &native_status) == native_pid);
+            if(WIFSIGNALED(native_status))
+            {
+                fprintf(stderr, "native smoke terminated by signal: p101_parse_uint32_t_n: %d\n", WTERMSIG(native_status));
+            }
+            EXPECT(WIFEXITED(native_status));
+            if(WIFEXITED(native_status) && WEXITSTATUS(native_status) == 77)
+            {
+                fprintf(stderr, "native smoke fixture unavailable: p101_parse_uint32_t_n\n");
+            }
+            else if(WIFEXITED(native_status))
+            {
+                if(WEXITSTATUS(native_status) != EXIT_SUCCESS)
+                {
+                    fprintf(stderr, "native smoke exited unsuccessfully: p101_parse_uint32_t_n: %d\n", WEXITSTATUS(native_status));
+                }
+                EXPECT(WEXITSTATUS(native_status) == EXIT_SUCCESS);
+            }
+        }
+        p101_error_reset(err);
+    }
+}
+
+/* P101_TEST_CASE(p101_parse_uint32_t_prefix) */
+static void test_p101_parse_uint32_t_prefix(struct p101_env *env, struct p101_error *err)
+{
+#ifdef __linux__
+    static const int         errors[]      = {EIO};
+    static const char *const error_names[] = {"EIO"};
+#elif defined(__APPLE__)
+    static const int         errors[]      = {EIO};
+    static const char *const error_names[] = {"EIO"};
+#elif defined(__FreeBSD__)
+    static const int         errors[]      = {EIO};
+    static const char *const error_names[] = {"EIO"};
+#else
+    static const int         errors[]      = {EIO};
+    static const char *const error_names[] = {"EIO"};
+#endif
+
+    for(size_t index = 0U; index < sizeof(errors) / sizeof(errors[0]); index++)
+    {
+        struct fault_state state = {0, errors[index]};
+        int                failures_before;
+
+        failures_before = failures;
+        EXPECT(p101_error_has_no_error(err));
+        fault_resource_events = 0U;
+        errno                 = P101_TEST_ERRNO_SENTINEL;
+        p101_env_set_fault_injector(env, fail_next_call, &state);
+        uint32_t result = p101_parse_uint32_t_prefix(env, err, NULL, NULL, 0);
+        (void)result;
+        EXPECT(state.checks == 1);
+        EXPECT(p101_error_is_errno(err, state.code));
+        EXPECT(errno == P101_TEST_ERRNO_SENTINEL);
+        EXPECT(result == (0));
+        EXPECT(fault_resource_events == 0U);
+        write_outcome("p101_parse_uint32_t_prefix", "errno", error_names[index], state.code, failures == failures_before);
+        p101_error_reset(err);
+    }
+    p101_env_set_fault_injector(env, NULL, NULL);
+    {
+        int   native_status = 0;
+        pid_t native_pid    = fork();
+
+        EXPECT(native_pid >= 0);
+        if(native_pid == 0)
+        {
+            bool               native_passed = true;
+            struct p101_error *native_err    = NULL;
+            struct p101_env   *native_env    = NULL;
+            FILE              *native_stdin_result;
+
+            native_child_process = true;
+            failures             = 0;
+            (void)alarm(2U);
+            if(unsetenv("P101_CALL_LOG") != 0 || unsetenv("P101_RESOURCE_LOG") != 0)
+            {
+                fprintf(stderr, "native setup failed: cannot clear p101 logging environment\n");
+                native_child_status = 77;
+                goto native_child_done_;
+            }
+            native_stdin_result = freopen("/dev/null", "r", stdin);
+            if(native_stdin_result == NULL)
+            {
+                fprintf(stderr, "native setup failed: cannot make standard input deterministic\n");
+                native_child_status = 77;
+                goto native_child_done_;
+            }
+            native_err = p101_error_create(false);
+            if(native_err == NULL)
+            {
+                native_child_status = 77;
+                goto native_child_done_;
+            }
+            native_env = p101_env_create(native_err, NULL);
+            if(native_env == NULL)
+            {
+                native_child_status = 77;
+                goto native_child_done_;
+            }
+            const char *native_argument_3 = NULL;
+            uint32_t    native_result     = p101_parse_uint32_t_prefix(native_env, native_err, "1", &native_argument_3, 0);
+            (void)native_result;
+            if(p101_error_has_error(native_err))
+            {
+                bool native_error_declared = false;
+
+                for(size_t native_error_index = 0U; native_error_index < sizeof(errors) / sizeof(errors[0]); native_error_index++)
+                {
+                    if(p101_error_is_errno(native_err, errors[native_error_index]))
+                    {
+                        native_error_declared = true;
+                    }
+                }
+                if(!native_error_declared)
+                {
+                    fprintf(stderr, "native smoke produced an undeclared platform failure: p101_parse_uint32_t_prefix: %s\n", p101_error_get_message(native_err));
+                    native_passed = false;
+                }
+                p101_error_reset(native_err);
+            }
+            native_child_status = native_passed ? EXIT_SUCCESS : EXIT_FAILURE;
+        native_child_done_:
+            p101_env_destroy(native_env);
+            p101_error_destroy(native_err);
+        }
+        if(native_pid > 0)
+        {
+            EXPECT(native_waitpid_nointr(native_pid, &native_status) == native_pid);
+            if(WIFSIGNALED(native_status))
+            {
+                fprintf(stderr, "native smoke terminated by signal: p101_parse_uint32_t_prefix: %d\n", WTERMSIG(native_status));
+            }
+            EXPECT(WIFEXITED(native_status));
+            if(WIFEXITED(native_status) && WEXITSTATUS(native_status) == 77)
+            {
+                fprintf(stderr, "native smoke fixture unavailable: p101_parse_uint32_t_prefix\n");
+            }
+            else if(WIFEXITED(native_status))
+            {
+                if(WEXITSTATUS(native_status) != EXIT_SUCCESS)
+                {
+                    fprintf(stderr, "native smoke exited unsuccessfully: p101_parse_uint32_t_prefix: %d\n", WEXITSTATUS(native_status));
+                }
+                EXPECT(WEXITSTATUS(native_status) == EXIT_SUCCESS);
+            }
+        }
+        p101_error_reset(err);
+    }
+}
+
+/* P101_TEST_CASE(p101_parse_uint32_t_size) */
+static void test_p101_parse_uint32_t_size(struct p101_env *env, struct p101_error *err)
+{
+#ifdef __linux__
+    static const int         errors[]      = {EIO};
+    static const char *const error_names[] = {"EIO"};
+#elif defined(__APPLE__)
+    static const int         errors[]      = {EIO};
+    static const char *const error_names[] = {"EIO"};
+#elif defined(__FreeBSD__)
+    static const int         errors[]      = {EIO};
+    static const char *const error_names[] = {"EIO"};
+#else
+    static const int         errors[]      = {EIO};
+    static const char *const error_names[] = {"EIO"};
+#endif
+
+    for(size_t index = 0U; index < sizeof(errors) / sizeof(errors[0]); index++)
+    {
+        struct fault_state state = {0, errors[index]};
+        int                failures_before;
+
+        failures_before = failures;
+        EXPECT(p101_error_has_no_error(err));
+        fault_resource_events = 0U;
+        errno                 = P101_TEST_ERRNO_SENTINEL;
+        p101_env_set_fault_injector(env, fail_next_call, &state);
+        uint32_t result = p101_parse_uint32_t_size(env, err, NULL, 0);
+        (void)result;
+        EXPECT(state.checks == 1);
+        EXPECT(p101_error_is_errno(err, state.code));
+        EXPECT(errno == P101_TEST_ERRNO_SENTINEL);
+        EXPECT(result == (0));
+        EXPECT(fault_resource_events == 0U);
+        write_outcome("p101_parse_uint32_t_size", "errno", error_names[index], state.code, failures == failures_before);
+        p101_error_reset(err);
+    }
+    p101_env_set_fault_injector(env, NULL, NULL);
+    {
+        int   native_status = 0;
+        pid_t native_pid    = fork();
+
+        EXPECT(native_pid >= 0);
+        if(native_pid == 0)
+        {
+            bool               native_passed = true;
+            struct p101_error *native_err    = NULL;
+            struct p101_env   *native_env    = NULL;
+            FILE              *native_stdin_result;
+
+            native_child_process = true;
+            failures             = 0;
+            (void)alarm(2U);
+            if(unsetenv("P101_CALL_LOG") != 0 || unsetenv("P101_RESOURCE_LOG") != 0)
+            {
+                fprintf(stderr, "native setup failed: cannot clear p101 logging environment\n");
+                native_child_status = 77;
+                goto native_child_done_;
+            }
+            native_stdin_result = freopen("/dev/null", "r", stdin);
+            if(native_stdin_result == NULL)
+            {
+                fprintf(stderr, "native setup failed: cannot make standard input deterministic\n");
+                native_child_status = 77;
+                goto native_child_done_;
+            }
+            native_err = p101_error_create(false);
+            if(native_err == NULL)
+            {
+                native_child_status = 77;
+                goto native_child_done_;
+            }
+            native_env = p101_env_create(native_err, NULL);
+            if(native_env == NULL)
+            {
+                native_child_status = 77;
+                goto native_child_done_;
+            }
+            uint32_t native_result = p101_parse_uint32_t_size(native_env, native_err, "1K", 0);
+            (void)native_result;
+            if(p101_error_has_error(native_err))
+            {
+                bool native_error_declared = false;
+
+                for(size_t native_error_index = 0U; native_error_index < sizeof(errors) / sizeof(errors[0]); native_error_index++)
+                {
+                    if(p101_error_is_errno(native_err, errors[native_error_index]))
+                    {
+                        native_error_declared = true;
+                    }
+                }
+                if(!native_error_declared)
+                {
+                    fprintf(stderr, "native smoke produced an undeclared platform failure: p101_parse_uint32_t_size: %s\n", p101_error_get_message(native_err));
+                    native_passed = false;
+                }
+                p101_error_reset(native_err);
+            }
+            native_child_status = native_passed ? EXIT_SUCCESS : EXIT_FAILURE;
+        native_child_done_:
+            p101_env_destroy(native_env);
+            p101_error_destroy(native_err);
+        }
+        if(native_pid > 0)
+        {
+            EXPECT(native_waitpid_nointr(native_pid, &native_status) == native_pid);
+            if(WIFSIGNALED(native_status))
+            {
+                fprintf(stderr, "native smoke terminated by signal: p101_parse_uint32_t_size: %d\n", WTERMSIG(native_status));
+            }
+            EXPECT(WIFEXITED(native_status));
+            if(WIFEXITED(native_status) && WEXITSTATUS(native_status) == 77)
+            {
+                fprintf(stderr, "native smoke fixture unavailable: p101_parse_uint32_t_size\n");
+            }
+            else if(WIFEXITED(native_status))
+            {
+                if(WEXITSTATUS(native_status) != EXIT_SUCCESS)
+                {
+                    fprintf(stderr, "native smoke exited unsuccessfully: p101_parse_uint32_t_size: %d\n", WEXITSTATUS(native_status));
+                }
+                EXPECT(WEXITSTATUS(native_status) == EXIT_SUCCESS);
+            }
+        }
+        p101_error_reset(err);
+    }
+}
+
+/* P101_TEST_CASE(p101_parse_uint64_t) */
+static void test_p101_parse_uint64_t(struct p101_env *env, struct p101_error *err)
+{
+#ifdef __linux__
+    static const int         errors[]      = {EIO};
+    static const char *const error_names[] = {"EIO"};
+#elif defined(__APPLE__)
+    static const int         errors[]      = {EIO};
+    static const char *const error_names[] = {"EIO"};
+#elif defined(__FreeBSD__)
+    static const int         errors[]      = {EIO};
+    static const char *const error_names[] = {"EIO"};
+#else
+    static const int         errors[]      = {EIO};
+    static const char *const error_names[] = {"EIO"};
+#endif
+
+    for(size_t index = 0U; index < sizeof(errors) / sizeof(errors[0]); index++)
+    {
+        struct fault_state state = {0, errors[index]};
+        int                failures_before;
+
+        failures_before = failures;
+        EXPECT(p101_error_has_no_error(err));
+        fault_resource_events = 0U;
+        errno                 = P101_TEST_ERRNO_SENTINEL;
+        p101_env_set_fault_injector(env, fail_next_call, &state);
+        uint64_t result = p101_parse_uint64_t(env, err, NULL, 0);
+        (void)result;
+        EXPECT(state.checks == 1);
+        EXPECT(p101_error_is_errno(err, state.code));
+        EXPECT(errno == P101_TEST_ERRNO_SENTINEL);
+        EXPECT(result == (0));
+        EXPECT(fault_resource_events == 0U);
+        write_outcome("p101_parse_uint64_t", "errno", error_names[index], state.code, failures == failures_before);
+        p101_error_reset(err);
+    }
+    p101_env_set_fault_injector(env, NULL, NULL);
+    {
+        int   native_status = 0;
+        pid_t native_pid    = fork();
+
+        EXPECT(native_pid >= 0);
+        if(native_pid == 0)
+        {
+            bool               native_passed = true;
+            struct p101_error *native_err    = NULL;
+            struct p101_env   *native_env    = NULL;
+            FILE              *native_stdin_result;
+
+            native_child_process = true;
+            failures             = 0;
+            (void)alarm(2U);
+            if(unsetenv("P101_CALL_LOG") != 0 || unsetenv("P101_RESOURCE_LOG") != 0)
+            {
+                fprintf(stderr, "native setup failed: cannot clear p101 logging environment\n");
+                native_child_status = 77;
+                goto native_child_done_;
+            }
+            native_stdin_result = freopen("/dev/null", "r", stdin);
+            if(native_stdin_result == NULL)
+            {
+                fprintf(stderr, "native setup failed: cannot make standard input deterministic\n");
+                native_child_status = 77;
+                goto native_child_done_;
+            }
+            native_err = p101_error_create(false);
+            if(native_err == NULL)
+            {
+                native_child_status = 77;
+                goto native_child_done_;
+            }
+            native_env = p101_env_create(native_err, NULL);
+            if(native_env == NULL)
+            {
+                native_child_status = 77;
+                goto native_child_done_;
+            }
+            uint64_t native_result = p101_parse_uint64_t(native_env, native_err, "1", 0);
+            (void)native_result;
+            if(p101_error_has_error(native_err))
+            {
+                bool native_error_declared = false;
+
+                for(size_t native_error_index = 0U; native_error_index < sizeof(errors) / sizeof(errors[0]); native_error_index++)
+                {
+                    if(p101_error_is_errno(native_err, errors[native_error_index]))
+                    {
+                        native_error_declared = true;
+                    }
+                }
+                if(!native_error_declared)
+                {
+                    fprintf(stderr, "native smoke produced an undeclared platform failure: p101_parse_uint64_t: %s\n", p101_error_get_message(native_err));
+                    native_passed = false;
+                }
+                p101_error_reset(native_err);
+            }
+            native_child_status = native_passed ? EXIT_SUCCESS : EXIT_FAILURE;
+        native_child_done_:
+            p101_env_destroy(native_env);
+            p101_error_destroy(native_err);
+        }
+        if(native_pid > 0)
+        {
+            EXPECT(native_waitpid_nointr(native_pid, &native_status) == native_pid);
+            if(WIFSIGNALED(native_status))
+            {
+                fprintf(stderr, "native smoke terminated by signal: p101_parse_uint64_t: %d\n", WTERMSIG(native_status));
+            }
+            EXPECT(WIFEXITED(native_status));
+            if(WIFEXITED(native_status) && WEXITSTATUS(native_status) == 77)
+            {
+                fprintf(stderr, "native smoke fixture unavailable: p101_parse_uint64_t\n");
+            }
+            else if(WIFEXITED(native_status))
+            {
+                if(WEXITSTATUS(native_status) != EXIT_SUCCESS)
+                {
+                    fprintf(stderr, "native smoke exited unsuccessfully: p101_parse_uint64_t: %d\n", WEXITSTATUS(native_status));
+                }
+                EXPECT(WEXITSTATUS(native_status) == EXIT_SUCCESS);
+            }
+        }
+        p101_error_reset(err);
+    }
+}
+
+/* P101_TEST_CASE(p101_parse_uint64_t_array) */
+static void test_p101_parse_uint64_t_array(struct p101_env *env, struct p101_error *err)
+{
+#ifdef __linux__
+    static const int         errors[]      = {EIO};
+    static const char *const error_names[] = {"EIO"};
+#elif defined(__APPLE__)
+    static const int         errors[]      = {EIO};
+    static const char *const error_names[] = {"EIO"};
+#elif defined(__FreeBSD__)
+    static const int         errors[]      = {EIO};
+    static const char *const error_names[] = {"EIO"};
+#else
+    static const int         errors[]      = {EIO};
+    static const char *const error_names[] = {"EIO"};
+#endif
+
+    for(size_t index = 0U; index < sizeof(errors) / sizeof(errors[0]); index++)
+    {
+        struct fault_state state = {0, errors[index]};
+        int                failures_before;
+
+        failures_before = failures;
+        EXPECT(p101_error_has_no_error(err));
+        fault_resource_events = 0U;
+        errno                 = P101_TEST_ERRNO_SENTINEL;
+        p101_env_set_fault_injector(env, fail_next_call, &state);
+        size_t result = p101_parse_uint64_t_array(env, err, NULL, 0, NULL, NULL);
+        (void)result;
+        EXPECT(state.checks == 1);
+        EXPECT(p101_error_is_errno(err, state.code));
+        EXPECT(errno == P101_TEST_ERRNO_SENTINEL);
+        EXPECT(result == (0));
+        EXPECT(fault_resource_events == 0U);
+        write_outcome("p101_parse_uint64_t_array", "errno", error_names[index], state.code, failures == failures_before);
+        p101_error_reset(err);
+    }
+    p101_env_set_fault_injector(env, NULL, NULL);
+    {
+        int   native_status = 0;
+        pid_t native_pid    = fork();
+
+        EXPECT(native_pid >= 0);
+        if(native_pid == 0)
+        {
+            bool               native_passed = true;
+            struct p101_error *native_err    = NULL;
+            struct p101_env   *native_env    = NULL;
+            FILE              *native_stdin_result;
+
+            native_child_process = true;
+            failures             = 0;
+            (void)alarm(2U);
+            if(unsetenv("P101_CALL_LOG") != 0 || unsetenv("P101_RESOURCE_LOG") != 0)
+            {
+                fprintf(stderr, "native setup failed: cannot clear p101 logging environment\n");
+                native_child_status = 77;
+                goto native_child_done_;
+            }
+            native_stdin_result = freopen("/dev/null", "r", stdin);
+            if(native_stdin_result == NULL)
+            {
+                fprintf(stderr, "native setup failed: cannot make standard input deterministic\n");
+                native_child_status = 77;
+                goto native_child_done_;
+            }
+            native_err = p101_error_create(false);
+            if(native_err == NULL)
+            {
+                native_child_status = 77;
+                goto native_child_done_;
+            }
+            native_env = p101_env_create(native_err, NULL);
+            if(native_env == NULL)
+            {
+                native_child_status = 77;
+                goto native_child_done_;
+            }
+            const char *const native_argument_2[]  = {"1"};
+            uint64_t          native_argument_4[1] = {0};
+            uint8_t           native_argument_5[1] = {0};
+            size_t            native_result        = p101_parse_uint64_t_array(native_env, native_err, native_argument_2, 1, native_argument_4, native_argument_5);
+            (void)native_result;
+            if(p101_error_has_error(native_err))
+            {
+                bool native_error_declared = false;
+
+                for(size_t native_error_index = 0U; native_error_index < sizeof(errors) / sizeof(errors[0]); native_error_index++)
+                {
+                    if(p101_error_is_errno(native_err, errors[native_error_index]))
+                    {
+                        native_error_declared = true;
+                    }
+                }
+                if(!native_error_declared)
+                {
+                    fprintf(stderr, "native smoke produced an undeclared platform failure: p101_parse_uint64_t_array: %s\n", p101_error_get_message(native_err));
+                    native_passed = false;
+                }
+                p101_error_reset(native_err);
+            }
+            native_child_status = native_passed ? EXIT_SUCCESS : EXIT_FAILURE;
+        native_child_done_:
+            p101_env_destroy(native_env);
+            p101_error_destroy(native_err);
+        }
+        if(native_pid > 0)
+        {
+            EXPECT(native_waitpid_nointr(native_pid, &native_status) == native_pid);
+            if(WIFSIGNALED(native_status))
+            {
+                fprintf(stderr, "native smoke terminated by signal: p101_parse_uint64_t_array: %d\n", WTERMSIG(native_status));
+            }
+            EXPECT(WIFEXITED(native_status));
+            if(WIFEXITED(native_status) && WEXITSTATUS(native_status) == 77)
+            {
+                fprintf(stderr, "native smoke fixture unavailable: p101_parse_uint64_t_array\n");
+            }
+            else if(WIFEXITED(native_status))
+            {
+                if(WEXITSTATUS(native_status) != EXIT_SUCCESS)
+                {
+                    fprintf(stderr, "native smoke exited unsuccessfully: p101_parse_uint64_t_array: %d\n", WEXITSTATUS(native_status));
+                }
+                EXPECT(WEXITSTATUS(native_status) == EXIT_SUCCESS);
+            }
+        }
+        p101_error_reset(err);
+    }
+}
+
+/* P101_TEST_CASE(p101_parse_uint64_t_base) */
+static void test_p101_parse_uint64_t_base(struct p101_env *env, struct p101_error *err)
+{
+#ifdef __linux__
+    static const int         errors[]      = {EIO};
+    static const char *const error_names[] = {"EIO"};
+#elif defined(__APPLE__)
+    static const int         errors[]      = {EIO};
+    static const char *const error_names[] = {"EIO"};
+#elif defined(__FreeBSD__)
+    static const int         errors[]      = {EIO};
+    static const char *const error_names[] = {"EIO"};
+#else
+    static const int         errors[]      = {EIO};
+    static const char *const error_names[] = {"EIO"};
+#endif
+
+    for(size_t index = 0U; index < sizeof(errors) / sizeof(errors[0]); index++)
+    {
+        struct fault_state state = {0, errors[index]};
+        int                failures_before;
+
+        failures_before = failures;
+        EXPECT(p101_error_has_no_error(err));
+        fault_resource_events = 0U;
+        errno                 = P101_TEST_ERRNO_SENTINEL;
+        p101_env_set_fault_injector(env, fail_next_call, &state);
+        uint64_t result = p101_parse_uint64_t_base(env, err, NULL, 0, 0);
+        (void)result;
+        EXPECT(state.checks == 1);
+        EXPECT(p101_error_is_errno(err, state.code));
+        EXPECT(errno == P101_TEST_ERRNO_SENTINEL);
+        EXPECT(result == (0));
+        EXPECT(fault_resource_events == 0U);
+        write_outcome("p101_parse_uint64_t_base", "errno", error_names[index], state.code, failures == failures_before);
+        p101_error_reset(err);
+    }
+    p101_env_set_fault_injector(env, NULL, NULL);
+    {
+        int   native_status = 0;
+        pid_t native_pid    = fork();
+
+        EXPECT(native_pid >= 0);
+        if(native_pid == 0)
+        {
+            bool               native_passed = true;
+            struct p101_error *native_err    = NULL;
+            struct p101_env   *native_env    = NULL;
+            FILE              *native_stdin_result;
+
+            native_child_process = true;
+            failures             = 0;
+            (void)alarm(2U);
+            if(unsetenv("P101_CALL_LOG") != 0 || unsetenv("P101_RESOURCE_LOG") != 0)
+            {
+                fprintf(stderr, "native setup failed: cannot clear p101 logging environment\n");
+                native_child_status = 77;
+                goto native_child_done_;
+            }
+            native_stdin_result = freopen("/dev/null", "r", stdin);
+            if(native_stdin_result == NULL)
+            {
+                fprintf(stderr, "native setup failed: cannot make standard input deterministic\n");
+                native_child_status = 77;
+                goto native_child_done_;
+            }
+            native_err = p101_error_create(false);
+            if(native_err == NULL)
+            {
+                native_child_status = 77;
+                goto native_child_done_;
+            }
+            native_env = p101_env_create(native_err, NULL);
+            if(native_env == NULL)
+            {
+                native_child_status = 77;
+                goto native_child_done_;
+            }
+            uint64_t native_result = p101_parse_uint64_t_base(native_env, native_err, "0x1", 0, 0);
+            (void)native_result;
+            if(p101_error_has_error(native_err))
+            {
+                bool native_error_declared = false;
+
+                for(size_t native_error_index = 0U; native_error_index < sizeof(errors) / sizeof(errors[0]); native_error_index++)
+                {
+                    if(p101_error_is_errno(native_err, errors[native_error_index]))
+                    {
+                        native_error_declared = true;
+                    }
+                }
+                if(!native_error_declared)
+                {
+                    fprintf(stderr, "native smoke produced an undeclared platform failure: p101_parse_uint64_t_base: %s\n", p101_error_get_message(native_err));
+                    native_passed = false;
+                }
+                p101_error_reset(native_err);
+            }
+            native_child_status = native_passed ? EXIT_SUCCESS : EXIT_FAILURE;
+        native_child_done_:
+            p101_env_destroy(native_env);
+            p101_error_destroy(native_err);
+        }
+        if(native_pid > 0)
+        {
+            EXPECT(native_waitpid_nointr(native_pid, &native_status) == native_pid);
+            if(WIFSIGNALED(native_status))
+            {
+                fprintf(stderr, "native smoke terminated by signal: p101_parse_uint64_t_base: %d\n", WTERMSIG(native_status));
+            }
+            EXPECT(WIFEXITED(native_status));
+            if(WIFEXITED(native_status) && WEXITSTATUS(native_status) == 77)
+            {
+                fprintf(stderr, "native smoke fixture unavailable: p101_parse_uint64_t_base\n");
+            }
+            else if(WIFEXITED(native_status))
+            {
+                if(WEXITSTATUS(native_status) != EXIT_SUCCESS)
+                {
+                    fprintf(stderr, "native smoke exited unsuccessfully: p101_parse_uint64_t_base: %d\n", WEXITSTATUS(native_status));
+                }
+                EXPECT(WEXITSTATUS(native_status) == EXIT_SUCCESS);
+            }
+        }
+        p101_error_reset(err);
+    }
+}
+
+/* P101_TEST_CASE(p101_parse_uint64_t_list) */
+static void test_p101_parse_uint64_t_list(struct p101_env *env, struct p101_error *err)
+{
+#ifdef __linux__
+    static const int         errors[]      = {EIO};
+    static const char *const error_names[] = {"EIO"};
+#elif defined(__APPLE__)
+    static const int         errors[]      = {EIO};
+    static const char *const error_names[] = {"EIO"};
+#elif defined(__FreeBSD__)
+    static const int         errors[]      = {EIO};
+    static const char *const error_names[] = {"EIO"};
+#else
+    static const int         errors[]      = {EIO};
+    static const char *const error_names[] = {"EIO"};
+#endif
+
+    for(size_t index = 0U; index < sizeof(errors) / sizeof(errors[0]); index++)
+    {
+        struct fault_state state = {0, errors[index]};
+        int                failures_before;
+
+        failures_before = failures;
+        EXPECT(p101_error_has_no_error(err));
+        fault_resource_events = 0U;
+        errno                 = P101_TEST_ERRNO_SENTINEL;
+        p101_env_set_fault_injector(env, fail_next_call, &state);
+        size_t result = p101_parse_uint64_t_list(env, err, NULL, NULL, NULL, 0);
+        (void)result;
+        EXPECT(state.checks == 1);
+        EXPECT(p101_error_is_errno(err, state.code));
+        EXPECT(errno == P101_TEST_ERRNO_SENTINEL);
+        EXPECT(result == (0));
+        EXPECT(fault_resource_events == 0U);
+        write_outcome("p101_parse_uint64_t_list", "errno", error_names[index], state.code, failures == failures_before);
+        p101_error_reset(err);
+    }
+    p101_env_set_fault_injector(env, NULL, NULL);
+    {
+        int   native_status = 0;
+        pid_t native_pid    = fork();
+
+        EXPECT(native_pid >= 0);
+        if(native_pid == 0)
+        {
+            bool               native_passed = true;
+            struct p101_error *native_err    = NULL;
+            struct p101_env   *native_env    = NULL;
+            FILE              *native_stdin_result;
+
+            native_child_process = true;
+            failures             = 0;
+            (void)alarm(2U);
+            if(unsetenv("P101_CALL_LOG") != 0 || unsetenv("P101_RESOURCE_LOG") != 0)
+            {
+                fprintf(stderr, "native setup failed: cannot clear p101 logging environment\n");
+                native_child_status = 77;
+                goto native_child_done_;
+            }
+            native_stdin_result = freopen("/dev/null", "r", stdin);
+            if(native_stdin_result == NULL)
+            {
+                fprintf(stderr, "native setup failed: cannot make standard input deterministic\n");
+                native_child_status = 77;
+                goto native_child_done_;
+            }
+            native_err = p101_error_create(false);
+            if(native_err == NULL)
+            {
+                native_child_status = 77;
+                goto native_child_done_;
+            }
+            native_env = p101_env_create(native_err, NULL);
+            if(native_env == NULL)
+            {
+                native_child_status = 77;
+                goto native_child_done_;
+            }
+            uint64_t native_argument_4[1] = {0};
+            size_t   native_result        = p101_parse_uint64_t_list(native_env, native_err, "1", ",", native_argument_4, 1);
+            (void)native_result;
+            if(p101_error_has_error(native_err))
+            {
+                bool native_error_declared = false;
+
+                for(size_t native_error_index = 0U; native_error_index < sizeof(errors) / sizeof(errors[0]); native_error_index++)
+                {
+                    if(p101_error_is_errno(native_err, errors[native_error_index]))
+                    {
+                        native_error_declared = true;
+                    }
+                }
+                if(!native_error_declared)
+                {
+                    fprintf(stderr, "native smoke produced an undeclared platform failure: p101_parse_uint64_t_list: %s\n", p101_error_get_message(native_err));
+                    native_passed = false;
+                }
+                p101_error_reset(native_err);
+            }
+            native_child_status = native_passed ? EXIT_SUCCESS : EXIT_FAILURE;
+        native_child_done_:
+            p101_env_destroy(native_env);
+            p101_error_destroy(native_err);
+        }
+        if(native_pid > 0)
+        {
+            EXPECT(native_waitpid_nointr(native_pid, &native_status) == native_pid);
+            if(WIFSIGNALED(native_status))
+            {
+                fprintf(stderr, "native smoke terminated by signal: p101_parse_uint64_t_list: %d\n", WTERMSIG(native_status));
+            }
+            EXPECT(WIFEXITED(native_status));
+            if(WIFEXITED(native_status) && WEXITSTATUS(native_status) == 77)
+            {
+                fprintf(stderr, "native smoke fixture unavailable: p101_parse_uint64_t_list\n");
+            }
+            else if(WIFEXITED(native_status))
+            {
+                if(WEXITSTATUS(native_status) != EXIT_SUCCESS)
+                {
+                    fprintf(stderr, "native smoke exited unsuccessfully: p101_parse_uint64_t_list: %d\n", WEXITSTATUS(native_status));
+                }
+                EXPECT(WEXITSTATUS(native_status) == EXIT_SUCCESS);
+            }
+        }
+        p101_error_reset(err);
+    }
+}
+
+/* P101_TEST_CASE(p101_parse_uint64_t_n) */
+static void test_p101_parse_uint64_t_n(struct p101_env *env, struct p101_error *err)
+{
+#ifdef __linux__
+    static const int         errors[]      = {EIO};
+    static const char *const error_names[] = {"EIO"};
+#elif defined(__APPLE__)
+    static const int         errors[]      = {EIO};
+    static const char *const error_names[] = {"EIO"};
+#elif defined(__FreeBSD__)
+    static const int         errors[]      = {EIO};
+    static const char *const error_names[] = {"EIO"};
+#else
+    static const int         errors[]      = {EIO};
+    static const char *const error_names[] = {"EIO"};
+#endif
+
+    for(size_t index = 0U; index < sizeof(errors) / sizeof(errors[0]); index++)
+    {
+        struct fault_state state = {0, errors[index]};
+        int                failures_before;
+
+        failures_before = failures;
+        EXPECT(p101_error_has_no_error(err));
+        fault_resource_events = 0U;
+        errno                 = P101_TEST_ERRNO_SENTINEL;
+        p101_env_set_fault_injector(env, fail_next_call, &state);
+        uint64_t result = p101_parse_uint64_t_n(env, err, NULL, 0, 0);
+        (void)result;
+        EXPECT(state.checks == 1);
+        EXPECT(p101_error_is_errno(err, state.code));
+        EXPECT(errno == P101_TEST_ERRNO_SENTINEL);
+        EXPECT(result == (0));
+        EXPECT(fault_resource_events == 0U);
+        write_outcome("p101_parse_uint64_t_n", "errno", error_names[index], state.code, failures == failures_before);
+        p101_error_reset(err);
+    }
+    p101_env_set_fault_injector(env, NULL, NULL);
+    {
+        int   native_status = 0;
+        pid_t native_pid    = fork();
+
+        EXPECT(native_pid >= 0);
+        if(native_pid == 0)
+        {
+            bool               native_passed = true;
+            struct p101_error *native_err    = NULL;
+            struct p101_env   *native_env    = NULL;
+            FILE              *native_stdin_result;
+
+            native_child_process = true;
+            failures             = 0;
+            (void)alarm(2U);
+            if(unsetenv("P101_CALL_LOG") != 0 || unsetenv("P101_RESOURCE_LOG") != 0)
+            {
+                fprintf(stderr, "native setup failed: cannot clear p101 logging environment\n");
+                native_child_status = 77;
+                goto native_child_done_;
+            }
+            native_stdin_result = freopen("/dev/null", "r", stdin);
+            if(native_stdin_result == NULL)
+            {
+                fprintf(stderr, "native setup failed: cannot make standard input deterministic\n");
+                native_child_status = 77;
+                goto native_child_done_;
+            }
+            native_err = p101_error_create(false);
+            if(native_err == NULL)
+            {
+                native_child_status = 77;
+                goto native_child_done_;
+            }
+            native_env = p101_env_create(native_err, NULL);
+            if(native_env == NULL)
+            {
+                native_child_status = 77;
+                goto native_child_done_;
+            }
+            uint64_t native_result = p101_parse_uint64_t_n(native_env, native_err, "1", 1, 0);
+            (void)native_result;
+            if(p101_error_has_error(native_err))
+            {
+                bool native_error_declared = false;
+
+                for(size_t native_error_index = 0U; native_error_index < sizeof(errors) / sizeof(errors[0]); native_error_index++)
+                {
+                    if(p101_error_is_errno(native_err, errors[native_error_index]))
+                    {
+                        native_error_declared = true;
+                    }
+                }
+                if(!native_error_declared)
+                {
+                    fprintf(stderr, "native smoke produced an undeclared platform failure: p101_parse_uint64_t_n: %s\n", p101_error_get_message(native_err));
+                    native_passed = false;
+                }
+                p101_error_reset(native_err);
+            }
+            native_child_status = native_passed ? EXIT_SUCCESS : EXIT_FAILURE;
+        native_child_done_:
+            p101_env_destroy(native_env);
+            p101_error_destroy(native_err);
+        }
+        if(native_pid > 0)
+        {
+            EXPECT(native_waitpid_nointr(native_pid, &native_status) == native_pid);
+            if(WIFSIGNALED(native_status))
+            {
+                fprintf(stderr, "native smoke terminated by signal: p101_parse_uint64_t_n: %d\n", WTERMSIG(native_status));
+            }
+            EXPECT(WIFEXITED(native_status));
+            if(WIFEXITED(native_status) && WEXITSTATUS(native_status) == 77)
+            {
+                fprintf(stderr, "native smoke fixture unavailable: p101_parse_uint64_t_n\n");
+            }
+            else if(WIFEXITED(native_status))
+            {
+                if(WEXITSTATUS(native_status) != EXIT_SUCCESS)
+                {
+                    fprintf(stderr, "native smoke exited unsuccessfully: p101_parse_uint64_t_n: %d\n", WEXITSTATUS(native_status));
+                }
+                EXPECT(WEXITSTATUS(native_status) == EXIT_SUCCESS);
+            }
+        }
+        p101_error_reset(err);
+    }
+}
+
+/* P101_TEST_CASE(p101_parse_uint64_t_prefix) */
+static void test_p101_parse_uint64_t_prefix(struct p101_env *env, struct p101_error *err)
+{
+#ifdef __linux__
+    static const int         errors[]      = {EIO};
+    static const char *const error_names[] = {"EIO"};
+#elif defined(__APPLE__)
+    static const int         errors[]      = {EIO};
+    static const char *const error_names[] = {"EIO"};
+#elif defined(__FreeBSD__)
+    static const int         errors[]      = {EIO};
+    static const char *const error_names[] = {"EIO"};
+#else
+    static const int         errors[]      = {EIO};
+    static const char *const error_names[] = {"EIO"};
+#endif
+
+    for(size_t index = 0U; index < sizeof(errors) / sizeof(errors[0]); index++)
+    {
+        struct fault_state state = {0, errors[index]};
+        int                failures_before;
+
+        failures_before = failures;
+        EXPECT(p101_error_has_no_error(err));
+        fault_resource_events = 0U;
+        errno                 = P101_TEST_ERRNO_SENTINEL;
+        p101_env_set_fault_injector(env, fail_next_call, &state);
+        uint64_t result = p101_parse_uint64_t_prefix(env, err, NULL, NULL, 0);
+        (void)result;
+        EXPECT(state.checks == 1);
+        EXPECT(p101_error_is_errno(err, state.code));
+        EXPECT(errno == P101_TEST_ERRNO_SENTINEL);
+        EXPECT(result == (0));
+        EXPECT(fault_resource_events == 0U);
+        write_outcome("p101_parse_uint64_t_prefix", "errno", error_names[index], state.code, failures == failures_before);
+        p101_error_reset(err);
+    }
+    p101_env_set_fault_injector(env, NULL, NULL);
+    {
+        int   native_status = 0;
+        pid_t native_pid    = fork();
+
+        EXPECT(native_pid >= 0);
+        if(native_pid == 0)
+        {
+            bool               native_passed = true;
+            struct p101_error *native_err    = NULL;
+            struct p101_env   *native_env    = NULL;
+            FILE              *native_stdin_result;
+
+            native_child_process = true;
+            failures             = 0;
+            (void)alarm(2U);
+            if(unsetenv("P101_CALL_LOG") != 0 || unsetenv("P101_RESOURCE_LOG") != 0)
+            {
+                fprintf(stderr, "native setup failed: cannot clear p101 logging environment\n");
+                native_child_status = 77;
+                goto native_child_done_;
+            }
+            native_stdin_result = freopen("/dev/null", "r", stdin);
+            if(native_stdin_result == NULL)
+            {
+                fprintf(stderr, "native setup failed: cannot make standard input deterministic\n");
+                native_child_status = 77;
+                goto native_child_done_;
+            }
+            native_err = p101_error_create(false);
+            if(native_err == NULL)
+            {
+                native_child_status = 77;
+                goto native_child_done_;
+            }
+            native_env = p101_env_create(native_err, NULL);
+            if(native_env == NULL)
+            {
+                native_child_status = 77;
+                goto native_child_done_;
+            }
+            const char *native_argument_3 = NULL;
+            uint64_t    native_result     = p101_parse_uint64_t_prefix(native_env, native_err, "1", &native_argument_3, 0);
+            (void)native_result;
+            if(p101_error_has_error(native_err))
+            {
+                bool native_error_declared = false;
+
+                for(size_t native_error_index = 0U; native_error_index < sizeof(errors) / sizeof(errors[0]); native_error_index++)
+                {
+                    if(p101_error_is_errno(native_err, errors[native_error_index]))
+                    {
+                        native_error_declared = true;
+                    }
+                }
+                if(!native_error_declared)
+                {
+                    fprintf(stderr, "native smoke produced an undeclared platform failure: p101_parse_uint64_t_prefix: %s\n", p101_error_get_message(native_err));
+                    native_passed = false;
+                }
+                p101_error_reset(native_err);
+            }
+            native_child_status = native_passed ? EXIT_SUCCESS : EXIT_FAILURE;
+        native_child_done_:
+            p101_env_destroy(native_env);
+            p101_error_destroy(native_err);
+        }
+        if(native_pid > 0)
+        {
+            EXPECT(native_waitpid_nointr(native_pid, &native_status) == native_pid);
+            if(WIFSIGNALED(native_status))
+            {
+                fprintf(stderr, "native smoke terminated by signal: p101_parse_uint64_t_prefix: %d\n", WTERMSIG(native_status));
+            }
+            EXPECT(WIFEXITED(native_status));
+            if(WIFEXITED(native_status) && WEXITSTATUS(native_status) == 77)
+            {
+                fprintf(stderr, "native smoke fixture unavailable: p101_parse_uint64_t_prefix\n");
+            }
+            else if(WIFEXITED(native_status))
+            {
+                if(WEXITSTATUS(native_status) != EXIT_SUCCESS)
+                {
+                    fprintf(stderr, "native smoke exited unsuccessfully: p101_parse_uint64_t_prefix: %d\n", WEXITSTATUS(native_status));
+                }
+                EXPECT(WEXITSTATUS(native_status) == EXIT_SUCCESS);
+            }
+        }
+        p101_error_reset(err);
+    }
+}
+
+/* P101_TEST_CASE(p101_parse_uint64_t_size) */
+static void test_p101_parse_uint64_t_size(struct p101_env *env, struct p101_error *err)
+{
+#ifdef __linux__
+    static const int         errors[]      = {EIO};
+    static const char *const error_names[] = {"EIO"};
+#elif defined(__APPLE__)
+    static const int         errors[]      = {EIO};
+    static const char *const error_names[] = {"EIO"};
+#elif defined(__FreeBSD__)
+    static const int         errors[]      = {EIO};
+    static const char *const error_names[] = {"EIO"};
+#else
+    static const int         errors[]      = {EIO};
+    static const char *const error_names[] = {"EIO"};
+#endif
+
+    for(size_t index = 0U; index < sizeof(errors) / sizeof(errors[0]); index++)
+    {
+        struct fault_state state = {0, errors[index]};
+        int                failures_before;
+
+        failures_before = failures;
+        EXPECT(p101_error_has_no_error(err));
+        fault_resource_events = 0U;
+        errno                 = P101_TEST_ERRNO_SENTINEL;
+        p101_env_set_fault_injector(env, fail_next_call, &state);
+        uint64_t result = p101_parse_uint64_t_size(env, err, NULL, 0);
+        (void)result;
+        EXPECT(state.checks == 1);
+        EXPECT(p101_error_is_errno(err, state.code));
+        EXPECT(errno == P101_TEST_ERRNO_SENTINEL);
+        EXPECT(result == (0));
+        EXPECT(fault_resource_events == 0U);
+        write_outcome("p101_parse_uint64_t_size", "errno", error_names[index], state.code, failures == failures_before);
+        p101_error_reset(err);
+    }
+    p101_env_set_fault_injector(env, NULL, NULL);
+    {
+        int   native_status = 0;
+        pid_t native_pid    = fork();
+
+        EXPECT(native_pid >= 0);
+        if(native_pid == 0)
+        {
+            bool               native_passed = true;
+            struct p101_error *native_err    = NULL;
+            struct p101_env   *native_env    = NULL;
+            FILE              *native_stdin_result;
+
+            native_child_process = true;
+            failures             = 0;
+            (void)alarm(2U);
+            if(unsetenv("P101_CALL_LOG") != 0 || unsetenv("P101_RESOURCE_LOG") != 0)
+            {
+                fprintf(stderr, "native setup failed: cannot clear p101 logging environment\n");
+                native_child_status = 77;
+                goto native_child_done_;
+            }
+            native_stdin_result = freopen("/dev/null", "r", stdin);
+            if(native_stdin_result == NULL)
+            {
+                fprintf(stderr, "native setup failed: cannot make standard input deterministic\n");
+                native_child_status = 77;
+                goto native_child_done_;
+            }
+            native_err = p101_error_create(false);
+            if(native_err == NULL)
+            {
+                native_child_status = 77;
+                goto native_child_done_;
+            }
+            native_env = p101_env_create(native_err, NULL);
+            if(native_env == NULL)
+            {
+                native_child_status = 77;
+                goto native_child_done_;
+            }
+            uint64_t native_result = p101_parse_uint64_t_size(native_env, native_err, "1K", 0);
+            (void)native_result;
+            if(p101_error_has_error(native_err))
+            {
+                bool native_error_declared = false;
+
+                for(size_t native_error_index = 0U; native_error_index < sizeof(errors) / sizeof(errors[0]); native_error_index++)
+                {
+                    if(p101_error_is_errno(native_err, errors[native_error_index]))
+                    {
+                        native_error_declared = true;
+                    }
+                }
+                if(!native_error_declared)
+                {
+                    fprintf(stderr, "native smoke produced an undeclared platform failure: p101_parse_uint64_t_size: %s\n", p101_error_get_message(native_err));
+                    native_passed = false;
+                }
+                p101_error_reset(native_err);
+            }
+            native_child_status = native_passed ? EXIT_SUCCESS : EXIT_FAILURE;
+        native_child_done_:
+            p101_env_destroy(native_env);
+            p101_error_destroy(native_err);
+        }
+        if(native_pid > 0)
+        {
+            EXPECT(native_waitpid_nointr(native_pid, &native_status) == native_pid);
+            if(WIFSIGNALED(native_status))
+            {
+                fprintf(stderr, "native smoke terminated by signal: p101_parse_uint64_t_size: %d\n", WTERMSIG(native_status));
+            }
+            EXPECT(WIFEXITED(native_status));
+            if(WIFEXITED(native_status) && WEXITSTATUS(native_status) == 77)
+            {
+                fprintf(stderr, "native smoke fixture unavailable: p101_parse_uint64_t_size\n");
+            }
+            else if(WIFEXITED(native_status))
+            {
+                if(WEXITSTATUS(native_status) != EXIT_SUCCESS)
+                {
+                    fprintf(stderr, "native smoke exited unsuccessfully: p101_parse_uint64_t_size: %d\n", WEXITSTATUS(native_status));
+                }
+                EXPECT(WEXITSTATUS(native_status) == EXIT_SUCCESS);
+            }
+        }
+        p101_error_reset(err);
+    }
+}
+
+/* P101_TEST_CASE(p101_parse_uint8_t) */
+static void test_p101_parse_uint8_t(struct p101_env *env, struct p101_error *err)
+{
+#ifdef __linux__
+    static const int         errors[]      = {EIO};
+    static const char *const error_names[] = {"EIO"};
+#elif defined(__APPLE__)
+    static const int         errors[]      = {EIO};
+    static const char *const error_names[] = {"EIO"};
+#elif defined(__FreeBSD__)
+    static const int         errors[]      = {EIO};
+    static const char *const error_names[] = {"EIO"};
+#else
+    static const int         errors[]      = {EIO};
+    static const char *const error_names[] = {"EIO"};
+#endif
+
+    for(size_t index = 0U; index < sizeof(errors) / sizeof(errors[0]); index++)
+    {
+        struct fault_state state = {0, errors[index]};
+        int                failures_before;
+
+        failures_before = failures;
+        EXPECT(p101_error_has_no_error(err));
+        fault_resource_events = 0U;
+        errno                 = P101_TEST_ERRNO_SENTINEL;
+        p101_env_set_fault_injector(env, fail_next_call, &state);
+        uint8_t result = p101_parse_uint8_t(env, err, NULL, 0);
+        (void)result;
+        EXPECT(state.checks == 1);
+        EXPECT(p101_error_is_errno(err, state.code));
+        EXPECT(errno == P101_TEST_ERRNO_SENTINEL);
+        EXPECT(result == (0));
+        EXPECT(fault_resource_events == 0U);
+        write_outcome("p101_parse_uint8_t", "errno", error_names[index], state.code, failures == failures_before);
+        p101_error_reset(err);
+    }
+    p101_env_set_fault_injector(env, NULL, NULL);
+    {
+        int   native_status = 0;
+        pid_t native_pid    = fork();
+
+        EXPECT(native_pid >= 0);
+        if(native_pid == 0)
+        {
+            bool               native_passed = true;
+            struct p101_error *native_err    = NULL;
+            struct p101_env   *native_env    = NULL;
+            FILE              *native_stdin_result;
+
+            native_child_process = true;
+            failures             = 0;
+            (void)alarm(2U);
+            if(unsetenv("P101_CALL_LOG") != 0 || unsetenv("P101_RESOURCE_LOG") != 0)
+            {
+                fprintf(stderr, "native setup failed: cannot clear p101 logging environment\n");
+                native_child_status = 77;
+                goto native_child_done_;
+            }
+            native_stdin_result = freopen("/dev/null", "r", stdin);
+            if(native_stdin_result == NULL)
+            {
+                fprintf(stderr, "native setup failed: cannot make standard input deterministic\n");
+                native_child_status = 77;
+                goto native_child_done_;
+            }
+            native_err = p101_error_create(false);
+            if(native_err == NULL)
+            {
+                native_child_status = 77;
+                goto native_child_done_;
+            }
+            native_env = p101_env_create(native_err, NULL);
+            if(native_env == NULL)
+            {
+                native_child_status = 77;
+                goto native_child_done_;
+            }
+            uint8_t native_result = p101_parse_uint8_t(native_env, native_err, "1", 0);
+            (void)native_result;
+            if(p101_error_has_error(native_err))
+            {
+                bool native_error_declared = false;
+
+                for(size_t native_error_index = 0U; native_error_index < sizeof(errors) / sizeof(errors[0]); native_error_index++)
+                {
+                    if(p101_error_is_errno(native_err, errors[native_error_index]))
+                    {
+                        native_error_declared = true;
+                    }
+                }
+                if(!native_error_declared)
+                {
+                    fprintf(stderr, "native smoke produced an undeclared platform failure: p101_parse_uint8_t: %s\n", p101_error_get_message(native_err));
+                    native_passed = false;
+                }
+                p101_error_reset(native_err);
+            }
+            native_child_status = native_passed ? EXIT_SUCCESS : EXIT_FAILURE;
+        native_child_done_:
+            p101_env_destroy(native_env);
+            p101_error_destroy(native_err);
+        }
+        if(native_pid > 0)
+        {
+            EXPECT(native_waitpid_nointr(native_pid, &native_status) == native_pid);
+            if(WIFSIGNALED(native_status))
+            {
+                fprintf(stderr, "native smoke terminated by signal: p101_parse_uint8_t: %d\n", WTERMSIG(native_status));
+            }
+            EXPECT(WIFEXITED(native_status));
+            if(WIFEXITED(native_status) && WEXITSTATUS(native_status) == 77)
+            {
+                fprintf(stderr, "native smoke fixture unavailable: p101_parse_uint8_t\n");
+            }
+            else if(WIFEXITED(native_status))
+            {
+                if(WEXITSTATUS(native_status) != EXIT_SUCCESS)
+                {
+                    fprintf(stderr, "native smoke exited unsuccessfully: p101_parse_uint8_t: %d\n", WEXITSTATUS(native_status));
+                }
+                EXPECT(WEXITSTATUS(native_status) == EXIT_SUCCESS);
+            }
+        }
+        p101_error_reset(err);
+    }
+}
+
+/* P101_TEST_CASE(p101_parse_uint8_t_array) */
+static void test_p101_parse_uint8_t_array(struct p101_env *env, struct p101_error *err)
+{
+#ifdef __linux__
+    static const int         errors[]      = {EIO};
+    static const char *const error_names[] = {"EIO"};
+#elif defined(__APPLE__)
+    static const int         errors[]      = {EIO};
+    static const char *const error_names[] = {"EIO"};
+#elif defined(__FreeBSD__)
+    static const int         errors[]      = {EIO};
+    static const char *const error_names[] = {"EIO"};
+#else
+    static const int         errors[]      = {EIO};
+    static const char *const error_names[] = {"EIO"};
+#endif
+
+    for(size_t index = 0U; index < sizeof(errors) / sizeof(errors[0]); index++)
+    {
+        struct fault_state state = {0, errors[index]};
+        int                failures_before;
+
+        failures_before = failures;
+        EXPECT(p101_error_has_no_error(err));
+        fault_resource_events = 0U;
+        errno                 = P101_TEST_ERRNO_SENTINEL;
+        p101_env_set_fault_injector(env, fail_next_call, &state);
+        size_t result = p101_parse_uint8_t_array(env, err, NULL, 0, NULL, NULL);
+        (void)result;
+        EXPECT(state.checks == 1);
+        EXPECT(p101_error_is_errno(err, state.code));
+        EXPECT(errno == P101_TEST_ERRNO_SENTINEL);
+        EXPECT(result == (0));
+        EXPECT(fault_resource_events == 0U);
+        write_outcome("p101_parse_uint8_t_array", "errno", error_names[index], state.code, failures == failures_before);
+        p101_error_reset(err);
+    }
+    p101_env_set_fault_injector(env, NULL, NULL);
+    {
+        int   native_status = 0;
+        pid_t native_pid    = fork();
+
+        EXPECT(native_pid >= 0);
+        if(native_pid == 0)
+        {
+            bool               native_passed = true;
+            struct p101_error *native_err    = NULL;
+            struct p101_env   *native_env    = NULL;
+            FILE              *native_stdin_result;
+
+            native_child_process = true;
+            failures             = 0;
+            (void)alarm(2U);
+            if(unsetenv("P101_CALL_LOG") != 0 || unsetenv("P101_RESOURCE_LOG") != 0)
+            {
+                fprintf(stderr, "native setup failed: cannot clear p101 logging environment\n");
+                native_child_status = 77;
+                goto native_child_done_;
+            }
+            native_stdin_result = freopen("/dev/null", "r", stdin);
+            if(native_stdin_result == NULL)
+            {
+                fprintf(stderr, "native setup failed: cannot make standard input deterministic\n");
+                native_child_status = 77;
+                goto native_child_done_;
+            }
+            native_err = p101_error_create(false);
+            if(native_err == NULL)
+            {
+                native_child_status = 77;
+                goto native_child_done_;
+            }
+            native_env = p101_env_create(native_err, NULL);
+            if(native_env == NULL)
+            {
+                native_child_status = 77;
+                goto native_child_done_;
+            }
+            const char *const native_argument_2[]  = {"1"};
+            uint8_t           native_argument_4[1] = {0};
+            uint8_t           native_argument_5[1] = {0};
+            size_t            native_result        = p101_parse_uint8_t_array(native_env, native_err, native_argument_2, 1, native_argument_4, native_argument_5);
+            (void)native_result;
+            if(p101_error_has_error(native_err))
+            {
+                bool native_error_declared = false;
+
+                for(size_t native_error_index = 0U; native_error_index < sizeof(errors) / sizeof(errors[0]); native_error_index++)
+                {
+                    if(p101_error_is_errno(native_err, errors[native_error_index]))
+                    {
+                        native_error_declared = true;
+                    }
+                }
+                if(!native_error_declared)
+                {
+                    fprintf(stderr, "native smoke produced an undeclared platform failure: p101_parse_uint8_t_array: %s\n", p101_error_get_message(native_err));
+                    native_passed = false;
+                }
+                p101_error_reset(native_err);
+            }
+            native_child_status = native_passed ? EXIT_SUCCESS : EXIT_FAILURE;
+        native_child_done_:
+            p101_env_destroy(native_env);
+            p101_error_destroy(native_err);
+        }
+        if(native_pid > 0)
+        {
+            EXPECT(native_waitpid_nointr(native_pid, &native_status) == native_pid);
+            if(WIFSIGNALED(native_status))
+            {
+                fprintf(stderr, "native smoke terminated by signal: p101_parse_uint8_t_array: %d\n", WTERMSIG(native_status));
+            }
+            EXPECT(WIFEXITED(native_status));
+            if(WIFEXITED(native_status) && WEXITSTATUS(native_status) == 77)
+            {
+                fprintf(stderr, "native smoke fixture unavailable: p101_parse_uint8_t_array\n");
+            }
+            else if(WIFEXITED(native_status))
+            {
+                if(WEXITSTATUS(native_status) != EXIT_SUCCESS)
+                {
+                    fprintf(stderr, "native smoke exited unsuccessfully: p101_parse_uint8_t_array: %d\n", WEXITSTATUS(native_status));
+                }
+                EXPECT(WEXITSTATUS(native_status) == EXIT_SUCCESS);
+            }
+        }
+        p101_error_reset(err);
+    }
+}
+
+/* P101_TEST_CASE(p101_parse_uint8_t_base) */
+static void test_p101_parse_uint8_t_base(struct p101_env *env, struct p101_error *err)
+{
+#ifdef __linux__
+    static const int         errors[]      = {EIO};
+    static const char *const error_names[] = {"EIO"};
+#elif defined(__APPLE__)
+    static const int         errors[]      = {EIO};
+    static const char *const error_names[] = {"EIO"};
+#elif defined(__FreeBSD__)
+    static const int         errors[]      = {EIO};
+    static const char *const error_names[] = {"EIO"};
+#else
+    static const int         errors[]      = {EIO};
+    static const char *const error_names[] = {"EIO"};
+#endif
+
+    for(size_t index = 0U; index < sizeof(errors) / sizeof(errors[0]); index++)
+    {
+        struct fault_state state = {0, errors[index]};
+        int                failures_before;
+
+        failures_before = failures;
+        EXPECT(p101_error_has_no_error(err));
+        fault_resource_events = 0U;
+        errno                 = P101_TEST_ERRNO_SENTINEL;
+        p101_env_set_fault_injector(env, fail_next_call, &state);
+        uint8_t result = p101_parse_uint8_t_base(env, err, NULL, 0, 0);
+        (void)result;
+        EXPECT(state.checks == 1);
+        EXPECT(p101_error_is_errno(err, state.code));
+        EXPECT(errno == P101_TEST_ERRNO_SENTINEL);
+        EXPECT(result == (0));
+        EXPECT(fault_resource_events == 0U);
+        write_outcome("p101_parse_uint8_t_base", "errno", error_names[index], state.code, failures == failures_before);
+        p101_error_reset(err);
+    }
+    p101_env_set_fault_injector(env, NULL, NULL);
+    {
+        int   native_status = 0;
+        pid_t native_pid    = fork();
+
+        EXPECT(native_pid >= 0);
+        if(native_pid == 0)
+        {
+            bool               native_passed = true;
+            struct p101_error *native_err    = NULL;
+            struct p101_env   *native_env    = NULL;
+            FILE              *native_stdin_result;
+
+            native_child_process = true;
+            failures             = 0;
+            (void)alarm(2U);
+            if(unsetenv("P101_CALL_LOG") != 0 || unsetenv("P101_RESOURCE_LOG") != 0)
+            {
+                fprintf(stderr, "native setup failed: cannot clear p101 logging environment\n");
+                native_child_status = 77;
+                goto native_child_done_;
+            }
+            native_stdin_result = freopen("/dev/null", "r", stdin);
+            if(native_stdin_result == NULL)
+            {
+                fprintf(stderr, "native setup failed: cannot make standard input deterministic\n");
+                native_child_status = 77;
+                goto native_child_done_;
+            }
+            native_err = p101_error_create(false);
+            if(native_err == NULL)
+            {
+                native_child_status = 77;
+                goto native_child_done_;
+            }
+            native_env = p101_env_create(native_err, NULL);
+            if(native_env == NULL)
+            {
+                native_child_status = 77;
+                goto native_child_done_;
+            }
+            uint8_t native_result = p101_parse_uint8_t_base(native_env, native_err, "0x1", 0, 0);
+            (void)native_result;
+            if(p101_error_has_error(native_err))
+            {
+                bool native_error_declared = false;
+
+                for(size_t native_error_index = 0U; native_error_index < sizeof(errors) / sizeof(errors[0]); native_error_index++)
+                {
+                    if(p101_error_is_errno(native_err, errors[native_error_index]))
+                    {
+                        native_error_declared = true;
+                    }
+                }
+                if(!native_error_declared)
+                {
+                    fprintf(stderr, "native smoke produced an undeclared platform failure: p101_parse_uint8_t_base: %s\n", p101_error_get_message(native_err));
+                    native_passed = false;
+                }
+                p101_error_reset(native_err);
+            }
+            native_child_status = native_passed ? EXIT_SUCCESS : EXIT_FAILURE;
+        native_child_done_:
+            p101_env_destroy(native_env);
+            p101_error_destroy(native_err);
+        }
+        if(native_pid > 0)
+        {
+            EXPECT(native_waitpid_nointr(native_pid, &native_status) == native_pid);
+            if(WIFSIGNALED(native_status))
+            {
+                fprintf(stderr, "native smoke terminated by signal: p101_parse_uint8_t_base: %d\n", WTERMSIG(native_status));
+            }
+            EXPECT(WIFEXITED(native_status));
+            if(WIFEXITED(native_status) && WEXITSTATUS(native_status) == 77)
+            {
+                fprintf(stderr, "native smoke fixture unavailable: p101_parse_uint8_t_base\n");
+            }
+            else if(WIFEXITED(native_status))
+            {
+                if(WEXITSTATUS(native_status) != EXIT_SUCCESS)
+                {
+                    fprintf(stderr, "native smoke exited unsuccessfully: p101_parse_uint8_t_base: %d\n", WEXITSTATUS(native_status));
+                }
+                EXPECT(WEXITSTATUS(native_status) == EXIT_SUCCESS);
+            }
+        }
+        p101_error_reset(err);
+    }
+}
+
+/* P101_TEST_CASE(p101_parse_uint8_t_n) */
+static void test_p101_parse_uint8_t_n(struct p101_env *env, struct p101_error *err)
+{
+#ifdef __linux__
+    static const int         errors[]      = {EIO};
+    static const char *const error_names[] = {"EIO"};
+#elif defined(__APPLE__)
+    static const int         errors[]      = {EIO};
+    static const char *const error_names[] = {"EIO"};
+#elif defined(__FreeBSD__)
+    static const int         errors[]      = {EIO};
+    static const char *const error_names[] = {"EIO"};
+#else
+    static const int         errors[]      = {EIO};
+    static const char *const error_names[] = {"EIO"};
+#endif
+
+    for(size_t index = 0U; index < sizeof(errors) / sizeof(errors[0]); index++)
+    {
+        struct fault_state state = {0, errors[index]};
+        int                failures_before;
+
+        failures_before = failures;
+        EXPECT(p101_error_has_no_error(err));
+        fault_resource_events = 0U;
+        errno                 = P101_TEST_ERRNO_SENTINEL;
+        p101_env_set_fault_injector(env, fail_next_call, &state);
+        uint8_t result = p101_parse_uint8_t_n(env, err, NULL, 0, 0);
+        (void)result;
+        EXPECT(state.checks == 1);
+        EXPECT(p101_error_is_errno(err, state.code));
+        EXPECT(errno == P101_TEST_ERRNO_SENTINEL);
+        EXPECT(result == (0));
+        EXPECT(fault_resource_events == 0U);
+        write_outcome("p101_parse_uint8_t_n", "errno", error_names[index], state.code, failures == failures_before);
+        p101_error_reset(err);
+    }
+    p101_env_set_fault_injector(env, NULL, NULL);
+    {
+        int   native_status = 0;
+        pid_t native_pid    = fork();
+
+        EXPECT(native_pid >= 0);
+        if(native_pid == 0)
+        {
+            bool               native_passed = true;
+            struct p101_error *native_err    = NULL;
+            struct p101_env   *native_env    = NULL;
+            FILE              *native_stdin_result;
+
+            native_child_process = true;
+            failures             = 0;
+            (void)alarm(2U);
+            if(unsetenv("P101_CALL_LOG") != 0 || unsetenv("P101_RESOURCE_LOG") != 0)
+            {
+                fprintf(stderr, "native setup failed: cannot clear p101 logging environment\n");
+                native_child_status = 77;
+                goto native_child_done_;
+            }
+            native_stdin_result = freopen("/dev/null", "r", stdin);
+            if(native_stdin_result == NULL)
+            {
+                fprintf(stderr, "native setup failed: cannot make standard input deterministic\n");
+                native_child_status = 77;
+                goto native_child_done_;
+            }
+            native_err = p101_error_create(false);
+            if(native_err == NULL)
+            {
+                native_child_status = 77;
+                goto native_child_done_;
+            }
+            native_env = p101_env_create(native_err, NULL);
+            if(native_env == NULL)
+            {
+                native_child_status = 77;
+                goto native_child_done_;
+            }
+            uint8_t native_result = p101_parse_uint8_t_n(native_env, native_err, "1", 1, 0);
+            (void)native_result;
+            if(p101_error_has_error(native_err))
+            {
+                bool native_error_declared = false;
+
+                for(size_t native_error_index = 0U; native_error_index < sizeof(errors) / sizeof(errors[0]); native_error_index++)
+                {
+                    if(p101_error_is_errno(native_err, errors[native_error_index]))
+                    {
+                        native_error_declared = true;
+                    }
+                }
+                if(!native_error_declared)
+                {
+                    fprintf(stderr, "native smoke produced an undeclared platform failure: p101_parse_uint8_t_n: %s\n", p101_error_get_message(native_err));
+                    native_passed = false;
+                }
+                p101_error_reset(native_err);
+            }
+            native_child_status = native_passed ? EXIT_SUCCESS : EXIT_FAILURE;
+        native_child_done_:
+            p101_env_destroy(native_env);
+            p101_error_destroy(native_err);
+        }
+        if(native_pid > 0)
+        {
+            EXPECT(native_waitpid_nointr(native_pid, &native_status) == native_pid);
+            if(WIFSIGNALED(native_status))
+            {
+                fprintf(stderr, "native smoke terminated by signal: p101_parse_uint8_t_n: %d\n", WTERMSIG(native_status));
+            }
+            EXPECT(WIFEXITED(native_status));
+            if(WIFEXITED(native_status) && WEXITSTATUS(native_status) == 77)
+            {
+                fprintf(stderr, "native smoke fixture unavailable: p101_parse_uint8_t_n\n");
+            }
+            else if(WIFEXITED(native_status))
+            {
+                if(WEXITSTATUS(native_status) != EXIT_SUCCESS)
+                {
+                    fprintf(stderr, "native smoke exited unsuccessfully: p101_parse_uint8_t_n: %d\n", WEXITSTATUS(native_status));
+                }
+                EXPECT(WEXITSTATUS(native_status) == EXIT_SUCCESS);
+            }
+        }
+        p101_error_reset(err);
+    }
+}
+
+/* P101_TEST_CASE(p101_parse_uint8_t_prefix) */
+static void test_p101_parse_uint8_t_prefix(struct p101_env *env, struct p101_error *err)
+{
+#ifdef __linux__
+    static const int         errors[]      = {EIO};
+    static const char *const error_names[] = {"EIO"};
+#elif defined(__APPLE__)
+    static const int         errors[]      = {EIO};
+    static const char *const error_names[] = {"EIO"};
+#elif defined(__FreeBSD__)
+    static const int         errors[]      = {EIO};
+    static const char *const error_names[] = {"EIO"};
+#else
+    static const int         errors[]      = {EIO};
+    static const char *const error_names[] = {"EIO"};
+#endif
+
+    for(size_t index = 0U; index < sizeof(errors) / sizeof(errors[0]); index++)
+    {
+        struct fault_state state = {0, errors[index]};
+        int                failures_before;
+
+        failures_before = failures;
+        EXPECT(p101_error_has_no_error(err));
+        fault_resource_events = 0U;
+        errno                 = P101_TEST_ERRNO_SENTINEL;
+        p101_env_set_fault_injector(env, fail_next_call, &state);
+        uint8_t result = p101_parse_uint8_t_prefix(env, err, NULL, NULL, 0);
+        (void)result;
+        EXPECT(state.checks == 1);
+        EXPECT(p101_error_is_errno(err, state.code));
+        EXPECT(errno == P101_TEST_ERRNO_SENTINEL);
+        EXPECT(result == (0));
+        EXPECT(fault_resource_events == 0U);
+        write_outcome("p101_parse_uint8_t_prefix", "errno", error_names[index], state.code, failures == failures_before);
+        p101_error_reset(err);
+    }
+    p101_env_set_fault_injector(env, NULL, NULL);
+    {
+        int   native_status = 0;
+        pid_t native_pid    = fork();
+
+        EXPECT(native_pid >= 0);
+        if(native_pid == 0)
+        {
+            bool               native_passed = true;
+            struct p101_error *native_err    = NULL;
+            struct p101_env   *native_env    = NULL;
+            FILE              *native_stdin_result;
+
+            native_child_process = true;
+            failures             = 0;
+            (void)alarm(2U);
+            if(unsetenv("P101_CALL_LOG") != 0 || unsetenv("P101_RESOURCE_LOG") != 0)
+            {
+                fprintf(stderr, "native setup failed: cannot clear p101 logging environment\n");
+                native_child_status = 77;
+                goto native_child_done_;
+            }
+            native_stdin_result = freopen("/dev/null", "r", stdin);
+            if(native_stdin_result == NULL)
+            {
+                fprintf(stderr, "native setup failed: cannot make standard input deterministic\n");
+                native_child_status = 77;
+                goto native_child_done_;
+            }
+            native_err = p101_error_create(false);
+            if(native_err == NULL)
+            {
+                native_child_status = 77;
+                goto native_child_done_;
+            }
+            native_env = p101_env_create(native_err, NULL);
+            if(native_env == NULL)
+            {
+                native_child_status = 77;
+                goto native_child_done_;
+            }
+            const char *native_argument_3 = NULL;
+            uint8_t     native_result     = p101_parse_uint8_t_prefix(native_env, native_err, "1", &native_argument_3, 0);
+            (void)native_result;
+            if(p101_error_has_error(native_err))
+            {
+                bool native_error_declared = false;
+
+                for(size_t native_error_index = 0U; native_error_index < sizeof(errors) / sizeof(errors[0]); native_error_index++)
+                {
+                    if(p101_error_is_errno(native_err, errors[native_error_index]))
+                    {
+                        native_error_declared = true;
+                    }
+                }
+                if(!native_error_declared)
+                {
+                    fprintf(stderr, "native smoke produced an undeclared platform failure: p101_parse_uint8_t_prefix: %s\n", p101_error_get_message(native_err));
+                    native_passed = false;
+                }
+                p101_error_reset(native_err);
+            }
+            native_child_status = native_passed ? EXIT_SUCCESS : EXIT_FAILURE;
+        native_child_done_:
+            p101_env_destroy(native_env);
+            p101_error_destroy(native_err);
+        }
+        if(native_pid > 0)
+        {
+            EXPECT(native_waitpid_nointr(native_pid, &native_status) == native_pid);
+            if(WIFSIGNALED(native_status))
+            {
+                fprintf(stderr, "native smoke terminated by signal: p101_parse_uint8_t_prefix: %d\n", WTERMSIG(native_status));
+            }
+            EXPECT(WIFEXITED(native_status));
+            if(WIFEXITED(native_status) && WEXITSTATUS(native_status) == 77)
+            {
+                fprintf(stderr, "native smoke fixture unavailable: p101_parse_uint8_t_prefix\n");
+            }
+            else if(WIFEXITED(native_status))
+            {
+                if(WEXITSTATUS(native_status) != EXIT_SUCCESS)
+                {
+                    fprintf(stderr, "native smoke exited unsuccessfully: p101_parse_uint8_t_prefix: %d\n", WEXITSTATUS(native_status));
+                }
+                EXPECT(WEXITSTATUS(native_status) == EXIT_SUCCESS);
+            }
+        }
+        p101_error_reset(err);
+    }
+}
+
+/* P101_TEST_CASE(p101_parse_uint8_t_size) */
+static void test_p101_parse_uint8_t_size(struct p101_env *env, struct p101_error *err)
+{
+#ifdef __linux__
+    static const int         errors[]      = {EIO};
+    static const char *const error_names[] = {"EIO"};
+#elif defined(__APPLE__)
+    static const int         errors[]      = {EIO};
+    static const char *const error_names[] = {"EIO"};
+#elif defined(__FreeBSD__)
+    static const int         errors[]      = {EIO};
+    static const char *const error_names[] = {"EIO"};
+#else
+    static const int         errors[]      = {EIO};
+    static const char *const error_names[] = {"EIO"};
+#endif
+
+    for(size_t index = 0U; index < sizeof(errors) / sizeof(errors[0]); index++)
+    {
+        struct fault_state state = {0, errors[index]};
+        int                failures_before;
+
+        failures_before = failures;
+        EXPECT(p101_error_has_no_error(err));
+        fault_resource_events = 0U;
+        errno                 = P101_TEST_ERRNO_SENTINEL;
+        p101_env_set_fault_injector(env, fail_next_call, &state);
+        uint8_t result = p101_parse_uint8_t_size(env, err, NULL, 0);
+        (void)result;
+        EXPECT(state.checks == 1);
+        EXPECT(p101_error_is_errno(err, state.code));
+        EXPECT(errno == P101_TEST_ERRNO_SENTINEL);
+        EXPECT(result == (0));
+        EXPECT(fault_resource_events == 0U);
+        write_outcome("p101_parse_uint8_t_size", "errno", error_names[index], state.code, failures == failures_before);
+        p101_error_reset(err);
+    }
+    p101_env_set_fault_injector(env, NULL, NULL);
+    {
+        int   native_status = 0;
+        pid_t native_pid    = fork();
+
+        EXPECT(native_pid >= 0);
+        if(native_pid == 0)
+        {
+            bool               native_passed = true;
+            struct p101_error *native_err    = NULL;
+            struct p101_env   *native_env    = NULL;
+            FILE              *native_stdin_result;
+
+            native_child_process = true;
+            failures             = 0;
+            (void)alarm(2U);
+            if(unsetenv("P101_CALL_LOG") != 0 || unsetenv("P101_RESOURCE_LOG") != 0)
+            {
+                fprintf(stderr, "native setup failed: cannot clear p101 logging environment\n");
+                native_child_status = 77;
+                goto native_child_done_;
+            }
+            native_stdin_result = freopen("/dev/null", "r", stdin);
+            if(native_stdin_result == NULL)
+            {
+                fprintf(stderr, "native setup failed: cannot make standard input deterministic\n");
+                native_child_status = 77;
+                goto native_child_done_;
+            }
+            native_err = p101_error_create(false);
+            if(native_err == NULL)
+            {
+                native_child_status = 77;
+                goto native_child_done_;
+            }
+            native_env = p101_env_create(native_err, NULL);
+            if(native_env == NULL)
+            {
+                native_child_status = 77;
+                goto native_child_done_;
+            }
+            uint8_t native_result = p101_parse_uint8_t_size(native_env, native_err, "1", 0);
+            (void)native_result;
+            if(p101_error_has_error(native_err))
+            {
+                bool native_error_declared = false;
+
+                for(size_t native_error_index = 0U; native_error_index < sizeof(errors) / sizeof(errors[0]); native_error_index++)
+                {
+                    if(p101_error_is_errno(native_err, errors[native_error_index]))
+                    {
+                        native_error_declared = true;
+                    }
+                }
+                if(!native_error_declared)
+                {
+                    fprintf(stderr, "native smoke produced an undeclared platform failure: p101_parse_uint8_t_size: %s\n", p101_error_get_message(native_err));
+                    native_passed = false;
+                }
+                p101_error_reset(native_err);
+            }
+            native_child_status = native_passed ? EXIT_SUCCESS : EXIT_FAILURE;
+        native_child_done_:
+            p101_env_destroy(native_env);
+            p101_error_destroy(native_err);
+        }
+        if(native_pid > 0)
+        {
+            EXPECT(native_waitpid_nointr(native_pid, &native_status) == native_pid);
+            if(WIFSIGNALED(native_status))
+            {
+                fprintf(stderr, "native smoke terminated by signal: p101_parse_uint8_t_size: %d\n", WTERMSIG(native_status));
+            }
+            EXPECT(WIFEXITED(native_status));
+            if(WIFEXITED(native_status) && WEXITSTATUS(native_status) == 77)
+            {
+                fprintf(stderr, "native smoke fixture unavailable: p101_parse_uint8_t_size\n");
+            }
+            else if(WIFEXITED(native_status))
+            {
+                if(WEXITSTATUS(native_status) != EXIT_SUCCESS)
+                {
+                    fprintf(stderr, "native smoke exited unsuccessfully: p101_parse_uint8_t_size: %d\n", WEXITSTATUS(native_status));
+                }
+                EXPECT(WEXITSTATUS(native_status) == EXIT_SUCCESS);
+            }
+        }
+        p101_error_reset(err);
+    }
+}
+
+/* P101_TEST_CASE(p101_parse_unsigned_char) */
+static void test_p101_parse_unsigned_char(struct p101_env *env, struct p101_error *err)
+{
+#ifdef __linux__
+    static const int         errors[]      = {EIO};
+    static const char *const error_names[] = {"EIO"};
+#elif defined(__APPLE__)
+    static const int         errors[]      = {EIO};
+    static const char *const error_names[] = {"EIO"};
+#elif defined(__FreeBSD__)
+    static const int         errors[]      = {EIO};
+    static const char *const error_names[] = {"EIO"};
+#else
+    static const int         errors[]      = {EIO};
+    static const char *const error_names[] = {"EIO"};
+#endif
+
+    for(size_t index = 0U; index < sizeof(errors) / sizeof(errors[0]); index++)
+    {
+        struct fault_state state = {0, errors[index]};
+        int                failures_before;
+
+        failures_before = failures;
+        EXPECT(p101_error_has_no_error(err));
+        fault_resource_events = 0U;
+        errno                 = P101_TEST_ERRNO_SENTINEL;
+        p101_env_set_fault_injector(env, fail_next_call, &state);
+        unsigned char result = p101_parse_unsigned_char(env, err, NULL, 0);
+        (void)result;
+        EXPECT(state.checks == 1);
+        EXPECT(p101_error_is_errno(err, state.code));
+        EXPECT(errno == P101_TEST_ERRNO_SENTINEL);
+        EXPECT(result == (0));
+        EXPECT(fault_resource_events == 0U);
+        write_outcome("p101_parse_unsigned_char", "errno", error_names[index], state.code, failures == failures_before);
+        p101_error_reset(err);
+    }
+    p101_env_set_fault_injector(env, NULL, NULL);
+    {
+        int   native_status = 0;
+        pid_t native_pid    = fork();
+
+        EXPECT(native_pid >= 0);
+        if(native_pid == 0)
+        {
+            bool               native_passed = true;
+            struct p101_error *native_err    = NULL;
+            struct p101_env   *native_env    = NULL;
+            FILE              *native_stdin_result;
+
+            native_child_process = true;
+            failures             = 0;
+            (void)alarm(2U);
+            if(unsetenv("P101_CALL_LOG") != 0 || unsetenv("P101_RESOURCE_LOG") != 0)
+            {
+                fprintf(stderr, "native setup failed: cannot clear p101 logging environment\n");
+                native_child_status = 77;
+                goto native_child_done_;
+            }
+            native_stdin_result = freopen("/dev/null", "r", stdin);
+            if(native_stdin_result == NULL)
+            {
+                fprintf(stderr, "native setup failed: cannot make standard input deterministic\n");
+                native_child_status = 77;
+                goto native_child_done_;
+            }
+            native_err = p101_error_create(false);
+            if(native_err == NULL)
+            {
+                native_child_status = 77;
+                goto native_child_done_;
+            }
+            native_env = p101_env_create(native_err, NULL);
+            if(native_env == NULL)
+            {
+                native_child_status = 77;
+                goto native_child_done_;
+            }
+            unsigned char native_result = p101_parse_unsigned_char(native_env, native_err, "1", 0);
+            (void)native_result;
+            if(p101_error_has_error(native_err))
+            {
+                bool native_error_declared = false;
+
+                for(size_t native_error_index = 0U; native_error_index < sizeof(errors) / sizeof(errors[0]); native_error_index++)
+                {
+                    if(p101_error_is_errno(native_err, errors[native_error_index]))
+                    {
+                        native_error_declared = true;
+                    }
+                }
+                if(!native_error_declared)
+                {
+                    fprintf(stderr, "native smoke produced an undeclared platform failure: p101_parse_unsigned_char: %s\n", p101_error_get_message(native_err));
+                    native_passed = false;
+                }
+                p101_error_reset(native_err);
+            }
+            native_child_status = native_passed ? EXIT_SUCCESS : EXIT_FAILURE;
+        native_child_done_:
+            p101_env_destroy(native_env);
+            p101_error_destroy(native_err);
+        }
+        if(native_pid > 0)
+        {
+            EXPECT(native_waitpid_nointr(native_pid, &native_status) == native_pid);
+            if(WIFSIGNALED(native_status))
+            {
+                fprintf(stderr, "native smoke terminated by signal: p101_parse_unsigned_char: %d\n", WTERMSIG(native_status));
+            }
+            EXPECT(WIFEXITED(native_status));
+            if(WIFEXITED(native_status) && WEXITSTATUS(native_status) == 77)
+            {
+                fprintf(stderr, "native smoke fixture unavailable: p101_parse_unsigned_char\n");
+            }
+            else if(WIFEXITED(native_status))
+            {
+                if(WEXITSTATUS(native_status) != EXIT_SUCCESS)
+                {
+                    fprintf(stderr, "native smoke exited unsuccessfully: p101_parse_unsigned_char: %d\n", WEXITSTATUS(native_status));
+                }
+                EXPECT(WEXITSTATUS(native_status) == EXIT_SUCCESS);
+            }
+        }
+        p101_error_reset(err);
+    }
+}
+
+/* P101_TEST_CASE(p101_parse_unsigned_char_n) */
+static void test_p101_parse_unsigned_char_n(struct p101_env *env, struct p101_error *err)
+{
+#ifdef __linux__
+    static const int         errors[]      = {EIO};
+    static const char *const error_names[] = {"EIO"};
+#elif defined(__APPLE__)
+    static const int         errors[]      = {EIO};
+    static const char *const error_names[] = {"EIO"};
+#elif defined(__FreeBSD__)
+    static const int         errors[]      = {EIO};
+    static const char *const error_names[] = {"EIO"};
+#else
+    static const int         errors[]      = {EIO};
+    static const char *const error_names[] = {"EIO"};
+#endif
+
+    for(size_t index = 0U; index < sizeof(errors) / sizeof(errors[0]); index++)
+    {
+        struct fault_state state = {0, errors[index]};
+        int                failures_before;
+
+        failures_before = failures;
+        EXPECT(p101_error_has_no_error(err));
+        fault_resource_events = 0U;
+        errno                 = P101_TEST_ERRNO_SENTINEL;
+        p101_env_set_fault_injector(env, fail_next_call, &state);
+        unsigned char result = p101_parse_unsigned_char_n(env, err, NULL, 0, 0);
+        (void)result;
+        EXPECT(state.checks == 1);
+        EXPECT(p101_error_is_errno(err, state.code));
+        EXPECT(errno == P101_TEST_ERRNO_SENTINEL);
+        EXPECT(result == (0));
+        EXPECT(fault_resource_events == 0U);
+        write_outcome("p101_parse_unsigned_char_n", "errno", error_names[index], state.code, failures == failures_before);
+        p101_error_reset(err);
+    }
+    p101_env_set_fault_injector(env, NULL, NULL);
+    {
+        int   native_status = 0;
+        pid_t native_pid    = fork();
+
+        EXPECT(native_pid >= 0);
+        if(native_pid == 0)
+        {
+            bool               native_passed = true;
+            struct p101_error *native_err    = NULL;
+            struct p101_env   *native_env    = NULL;
+            FILE              *native_stdin_result;
+
+            native_child_process = true;
+            failures             = 0;
+            (void)alarm(2U);
+            if(unsetenv("P101_CALL_LOG") != 0 || unsetenv("P101_RESOURCE_LOG") != 0)
+            {
+                fprintf(stderr, "native setup failed: cannot clear p101 logging environment\n");
+                native_child_status = 77;
+                goto native_child_done_;
+            }
+            native_stdin_result = freopen("/dev/null", "r", stdin);
+            if(native_stdin_result == NULL)
+            {
+                fprintf(stderr, "native setup failed: cannot make standard input deterministic\n");
+                native_child_status = 77;
+                goto native_child_done_;
+            }
+            native_err = p101_error_create(false);
+            if(native_err == NULL)
+            {
+                native_child_status = 77;
+                goto native_child_done_;
+            }
+            native_env = p101_env_create(native_err, NULL);
+            if(native_env == NULL)
+            {
+                native_child_status = 77;
+                goto native_child_done_;
+            }
+            unsigned char native_result = p101_parse_unsigned_char_n(native_env, native_err, "1", 1, 0);
+            (void)native_result;
+            if(p101_error_has_error(native_err))
+            {
+                bool native_error_declared = false;
+
+                for(size_t native_error_index = 0U; native_error_index < sizeof(errors) / sizeof(errors[0]); native_error_index++)
+                {
+                    if(p101_error_is_errno(native_err, errors[native_error_index]))
+                    {
+                        native_error_declared = true;
+                    }
+                }
+                if(!native_error_declared)
+                {
+                    fprintf(stderr, "native smoke produced an undeclared platform failure: p101_parse_unsigned_char_n: %s\n", p101_error_get_message(native_err));
+                    native_passed = false;
+                }
+                p101_error_reset(native_err);
+            }
+            native_child_status = native_passed ? EXIT_SUCCESS : EXIT_FAILURE;
+        native_child_done_:
+            p101_env_destroy(native_env);
+            p101_error_destroy(native_err);
+        }
+        if(native_pid > 0)
+        {
+            EXPECT(native_waitpid_nointr(native_pid, &native_status) == native_pid);
+            if(WIFSIGNALED(native_status))
+            {
+                fprintf(stderr, "native smoke terminated by signal: p101_parse_unsigned_char_n: %d\n", WTERMSIG(native_status));
+            }
+            EXPECT(WIFEXITED(native_status));
+            if(WIFEXITED(native_status) && WEXITSTATUS(native_status) == 77)
+            {
+                fprintf(stderr, "native smoke fixture unavailable: p101_parse_unsigned_char_n\n");
+            }
+            else if(WIFEXITED(native_status))
+            {
+                if(WEXITSTATUS(native_status) != EXIT_SUCCESS)
+                {
+                    fprintf(stderr, "native smoke exited unsuccessfully: p101_parse_unsigned_char_n: %d\n", WEXITSTATUS(native_status));
+                }
+                EXPECT(WEXITSTATUS(native_status) == EXIT_SUCCESS);
+            }
+        }
+        p101_error_reset(err);
+    }
+}
+
+/* P101_TEST_CASE(p101_parse_unsigned_char_prefix) */
+static void test_p101_parse_unsigned_char_prefix(struct p101_env *env, struct p101_error *err)
+{
+#ifdef __linux__
+    static const int         errors[]      = {EIO};
+    static const char *const error_names[] = {"EIO"};
+#elif defined(__APPLE__)
+    static const int         errors[]      = {EIO};
+    static const char *const error_names[] = {"EIO"};
+#elif defined(__FreeBSD__)
+    static const int         errors[]      = {EIO};
+    static const char *const error_names[] = {"EIO"};
+#else
+    static const int         errors[]      = {EIO};
+    static const char *const error_names[] = {"EIO"};
+#endif
+
+    for(size_t index = 0U; index < sizeof(errors) / sizeof(errors[0]); index++)
+    {
+        struct fault_state state = {0, errors[index]};
+        int                failures_before;
+
+        failures_before = failures;
+        EXPECT(p101_error_has_no_error(err));
+        fault_resource_events = 0U;
+        errno                 = P101_TEST_ERRNO_SENTINEL;
+        p101_env_set_fault_injector(env, fail_next_call, &state);
+        unsigned char result = p101_parse_unsigned_char_prefix(env, err, NULL, NULL, 0);
+        (void)result;
+        EXPECT(state.checks == 1);
+        EXPECT(p101_error_is_errno(err, state.code));
+        EXPECT(errno == P101_TEST_ERRNO_SENTINEL);
+        EXPECT(result == (0));
+        EXPECT(fault_resource_events == 0U);
+        write_outcome("p101_parse_unsigned_char_prefix", "errno", error_names[index], state.code, failures == failures_before);
+        p101_error_reset(err);
+    }
+    p101_env_set_fault_injector(env, NULL, NULL);
+    {
+        int   native_status = 0;
+        pid_t native_pid    = fork();
+
+        EXPECT(native_pid >= 0);
+        if(native_pid == 0)
+        {
+            bool               native_passed = true;
+            struct p101_error *native_err    = NULL;
+            struct p101_env   *native_env    = NULL;
+            FILE              *native_stdin_result;
+
+            native_child_process = true;
+            failures             = 0;
+            (void)alarm(2U);
+            if(unsetenv("P101_CALL_LOG") != 0 || unsetenv("P101_RESOURCE_LOG") != 0)
+            {
+                fprintf(stderr, "native setup failed: cannot clear p101 logging environment\n");
+                native_child_status = 77;
+                goto native_child_done_;
+            }
+            native_stdin_result = freopen("/dev/null", "r", stdin);
+            if(native_stdin_result == NULL)
+            {
+                fprintf(stderr, "native setup failed: cannot make standard input deterministic\n");
+                native_child_status = 77;
+                goto native_child_done_;
+            }
+            native_err = p101_error_create(false);
+            if(native_err == NULL)
+            {
+                native_child_status = 77;
+                goto native_child_done_;
+            }
+            native_env = p101_env_create(native_err, NULL);
+            if(native_env == NULL)
+            {
+                native_child_status = 77;
+                goto native_child_done_;
+            }
+            const char   *native_argument_3 = NULL;
+            unsigned char native_result     = p101_parse_unsigned_char_prefix(native_env, native_err, "1", &native_argument_3, 0);
+            (void)native_result;
+            if(p101_error_has_error(native_err))
+            {
+                bool native_error_declared = false;
+
+                for(size_t native_error_index = 0U; native_error_index < sizeof(errors) / sizeof(errors[0]); native_error_index++)
+                {
+                    if(p101_error_is_errno(native_err, errors[native_error_index]))
+                    {
+                        native_error_declared = true;
+                    }
+                }
+                if(!native_error_declared)
+                {
+                    fprintf(stderr, "native smoke produced an undeclared platform failure: p101_parse_unsigned_char_prefix: %s\n", p101_error_get_message(native_err));
+                    native_passed = false;
+                }
+                p101_error_reset(native_err);
+            }
+            native_child_status = native_passed ? EXIT_SUCCESS : EXIT_FAILURE;
+        native_child_done_:
+            p101_env_destroy(native_env);
+            p101_error_destroy(native_err);
+        }
+        if(native_pid > 0)
+        {
+            EXPECT(native_waitpid_nointr(native_pid, &native_status) == native_pid);
+            if(WIFSIGNALED(native_status))
+            {
+                fprintf(stderr, "native smoke terminated by signal: p101_parse_unsigned_char_prefix: %d\n", WTERMSIG(native_status));
+            }
+            EXPECT(WIFEXITED(native_status));
+            if(WIFEXITED(native_status) && WEXITSTATUS(native_status) == 77)
+            {
+                fprintf(stderr, "native smoke fixture unavailable: p101_parse_unsigned_char_prefix\n");
+            }
+            else if(WIFEXITED(native_status))
+            {
+                if(WEXITSTATUS(native_status) != EXIT_SUCCESS)
+                {
+                    fprintf(stderr, "native smoke exited unsuccessfully: p101_parse_unsigned_char_prefix: %d\n", WEXITSTATUS(native_status));
+                }
+                EXPECT(WEXITSTATUS(native_status) == EXIT_SUCCESS);
+            }
+        }
+        p101_error_reset(err);
+    }
+}
+
+/* P101_TEST_CASE(p101_parse_unsigned_int) */
+static void test_p101_parse_unsigned_int(struct p101_env *env, struct p101_error *err)
+{
+#ifdef __linux__
+    static const int         errors[]      = {EIO};
+    static const char *const error_names[] = {"EIO"};
+#elif defined(__APPLE__)
+    static const int         errors[]      = {EIO};
+    static const char *const error_names[] = {"EIO"};
+#elif defined(__FreeBSD__)
+    static const int         errors[]      = {EIO};
+    static const char *const error_names[] = {"EIO"};
+#else
+    static const int         errors[]      = {EIO};
+    static const char *const error_names[] = {"EIO"};
+#endif
+
+    for(size_t index = 0U; index < sizeof(errors) / sizeof(errors[0]); index++)
+    {
+        struct fault_state state = {0, errors[index]};
+        int                failures_before;
+
+        failures_before = failures;
+        EXPECT(p101_error_has_no_error(err));
+        fault_resource_events = 0U;
+        errno                 = P101_TEST_ERRNO_SENTINEL;
+        p101_env_set_fault_injector(env, fail_next_call, &state);
+        unsigned int result = p101_parse_unsigned_int(env, err, NULL, 0);
+        (void)result;
+        EXPECT(state.checks == 1);
+        EXPECT(p101_error_is_errno(err, state.code));
+        EXPECT(errno == P101_TEST_ERRNO_SENTINEL);
+        EXPECT(result == (0));
+        EXPECT(fault_resource_events == 0U);
+        write_outcome("p101_parse_unsigned_int", "errno", error_names[index], state.code, failures == failures_before);
+        p101_error_reset(err);
+    }
+    p101_env_set_fault_injector(env, NULL, NULL);
+    {
+        int   native_status = 0;
+        pid_t native_pid    = fork();
+
+        EXPECT(native_pid >= 0);
+        if(native_pid == 0)
+        {
+            bool               native_passed = true;
+            struct p101_error *native_err    = NULL;
+            struct p101_env   *native_env    = NULL;
+            FILE              *native_stdin_result;
+
+            native_child_process = true;
+            failures             = 0;
+            (void)alarm(2U);
+            if(unsetenv("P101_CALL_LOG") != 0 || unsetenv("P101_RESOURCE_LOG") != 0)
+            {
+                fprintf(stderr, "native setup failed: cannot clear p101 logging environment\n");
+                native_child_status = 77;
+                goto native_child_done_;
+            }
+            native_stdin_result = freopen("/dev/null", "r", stdin);
+            if(native_stdin_result == NULL)
+            {
+                fprintf(stderr, "native setup failed: cannot make standard input deterministic\n");
+                native_child_status = 77;
+                goto native_child_done_;
+            }
+            native_err = p101_error_create(false);
+            if(native_err == NULL)
+            {
+                native_child_status = 77;
+                goto native_child_done_;
+            }
+            native_env = p101_env_create(native_err, NULL);
+            if(native_env == NULL)
+            {
+                native_child_status = 77;
+                goto native_child_done_;
+            }
+            unsigned int native_result = p101_parse_unsigned_int(native_env, native_err, "1", 0);
+            (void)native_result;
+            if(p101_error_has_error(native_err))
+            {
+                bool native_error_declared = false;
+
+                for(size_t native_error_index = 0U; native_error_index < sizeof(errors) / sizeof(errors[0]); native_error_index++)
+                {
+                    if(p101_error_is_errno(native_err, errors[native_error_index]))
+                    {
+                        native_error_declared = true;
+                    }
+                }
+                if(!native_error_declared)
+                {
+                    fprintf(stderr, "native smoke produced an undeclared platform failure: p101_parse_unsigned_int: %s\n", p101_error_get_message(native_err));
+                    native_passed = false;
+                }
+                p101_error_reset(native_err);
+            }
+            native_child_status = native_passed ? EXIT_SUCCESS : EXIT_FAILURE;
+        native_child_done_:
+            p101_env_destroy(native_env);
+            p101_error_destroy(native_err);
+        }
+        if(native_pid > 0)
+        {
+            EXPECT(native_waitpid_nointr(native_pid, &native_status) == native_pid);
+            if(WIFSIGNALED(native_status))
+            {
+                fprintf(stderr, "native smoke terminated by signal: p101_parse_unsigned_int: %d\n", WTERMSIG(native_status));
+            }
+            EXPECT(WIFEXITED(native_status));
+            if(WIFEXITED(native_status) && WEXITSTATUS(native_status) == 77)
+            {
+                fprintf(stderr, "native smoke fixture unavailable: p101_parse_unsigned_int\n");
+            }
+            else if(WIFEXITED(native_status))
+            {
+                if(WEXITSTATUS(native_status) != EXIT_SUCCESS)
+                {
+                    fprintf(stderr, "native smoke exited unsuccessfully: p101_parse_unsigned_int: %d\n", WEXITSTATUS(native_status));
+                }
+                EXPECT(WEXITSTATUS(native_status) == EXIT_SUCCESS);
+            }
+        }
+        p101_error_reset(err);
+    }
+}
+
+/* P101_TEST_CASE(p101_parse_unsigned_int_n) */
+static void test_p101_parse_unsigned_int_n(struct p101_env *env, struct p101_error *err)
+{
+#ifdef __linux__
+    static const int         errors[]      = {EIO};
+    static const char *const error_names[] = {"EIO"};
+#elif defined(__APPLE__)
+    static const int         errors[]      = {EIO};
+    static const char *const error_names[] = {"EIO"};
+#elif defined(__FreeBSD__)
+    static const int         errors[]      = {EIO};
+    static const char *const error_names[] = {"EIO"};
+#else
+    static const int         errors[]      = {EIO};
+    static const char *const error_names[] = {"EIO"};
+#endif
+
+    for(size_t index = 0U; index < sizeof(errors) / sizeof(errors[0]); index++)
+    {
+        struct fault_state state = {0, errors[index]};
+        int                failures_before;
+
+        failures_before = failures;
+        EXPECT(p101_error_has_no_error(err));
+        fault_resource_events = 0U;
+        errno                 = P101_TEST_ERRNO_SENTINEL;
+        p101_env_set_fault_injector(env, fail_next_call, &state);
+        unsigned int result = p101_parse_unsigned_int_n(env, err, NULL, 0, 0);
+        (void)result;
+        EXPECT(state.checks == 1);
+        EXPECT(p101_error_is_errno(err, state.code));
+        EXPECT(errno == P101_TEST_ERRNO_SENTINEL);
+        EXPECT(result == (0));
+        EXPECT(fault_resource_events == 0U);
+        write_outcome("p101_parse_unsigned_int_n", "errno", error_names[index], state.code, failures == failures_before);
+        p101_error_reset(err);
+    }
+    p101_env_set_fault_injector(env, NULL, NULL);
+    {
+        int   native_status = 0;
+        pid_t native_pid    = fork();
+
+        EXPECT(native_pid >= 0);
+        if(native_pid == 0)
+        {
+            bool               native_passed = true;
+            struct p101_error *native_err    = NULL;
+            struct p101_env   *native_env    = NULL;
+            FILE              *native_stdin_result;
+
+            native_child_process = true;
+            failures             = 0;
+            (void)alarm(2U);
+            if(unsetenv("P101_CALL_LOG") != 0 || unsetenv("P101_RESOURCE_LOG") != 0)
+            {
+                fprintf(stderr, "native setup failed: cannot clear p101 logging environment\n");
+                native_child_status = 77;
+                goto native_child_done_;
+            }
+            native_stdin_result = freopen("/dev/null", "r", stdin);
+            if(native_stdin_result == NULL)
+            {
+                fprintf(stderr, "native setup failed: cannot make standard input deterministic\n");
+                native_child_status = 77;
+                goto native_child_done_;
+            }
+            native_err = p101_error_create(false);
+            if(native_err == NULL)
+            {
+                native_child_status = 77;
+                goto native_child_done_;
+            }
+            native_env = p101_env_create(native_err, NULL);
+            if(native_env == NULL)
+            {
+                native_child_status = 77;
+                goto native_child_done_;
+            }
+            unsigned int native_result = p101_parse_unsigned_int_n(native_env, native_err, "1", 1, 0);
+            (void)native_result;
+            if(p101_error_has_error(native_err))
+            {
+                bool native_error_declared = false;
+
+                for(size_t native_error_index = 0U; native_error_index < sizeof(errors) / sizeof(errors[0]); native_error_index++)
+                {
+                    if(p101_error_is_errno(native_err, errors[native_error_index]))
+                    {
+                        native_error_declared = true;
+                    }
+                }
+                if(!native_error_declared)
+                {
+                    fprintf(stderr, "native smoke produced an undeclared platform failure: p101_parse_unsigned_int_n: %s\n", p101_error_get_message(native_err));
+                    native_passed = false;
+                }
+                p101_error_reset(native_err);
+            }
+            native_child_status = native_passed ? EXIT_SUCCESS : EXIT_FAILURE;
+        native_child_done_:
+            p101_env_destroy(native_env);
+            p101_error_destroy(native_err);
+        }
+        if(native_pid > 0)
+        {
+            EXPECT(native_waitpid_nointr(native_pid, &native_status) == native_pid);
+            if(WIFSIGNALED(native_status))
+            {
+                fprintf(stderr, "native smoke terminated by signal: p101_parse_unsigned_int_n: %d\n", WTERMSIG(native_status));
+            }
+            EXPECT(WIFEXITED(native_status));
+            if(WIFEXITED(native_status) && WEXITSTATUS(native_status) == 77)
+            {
+                fprintf(stderr, "native smoke fixture unavailable: p101_parse_unsigned_int_n\n");
+            }
+            else if(WIFEXITED(native_status))
+            {
+                if(WEXITSTATUS(native_status) != EXIT_SUCCESS)
+                {
+                    fprintf(stderr, "native smoke exited unsuccessfully: p101_parse_unsigned_int_n: %d\n", WEXITSTATUS(native_status));
+                }
+                EXPECT(WEXITSTATUS(native_status) == EXIT_SUCCESS);
+            }
+        }
+        p101_error_reset(err);
+    }
+}
+
+/* P101_TEST_CASE(p101_parse_unsigned_int_prefix) */
+static void test_p101_parse_unsigned_int_prefix(struct p101_env *env, struct p101_error *err)
+{
+#ifdef __linux__
+    static const int         errors[]      = {EIO};
+    static const char *const error_names[] = {"EIO"};
+#elif defined(__APPLE__)
+    static const int         errors[]      = {EIO};
+    static const char *const error_names[] = {"EIO"};
+#elif defined(__FreeBSD__)
+    static const int         errors[]      = {EIO};
+    static const char *const error_names[] = {"EIO"};
+#else
+    static const int         errors[]      = {EIO};
+    static const char *const error_names[] = {"EIO"};
+#endif
+
+    for(size_t index = 0U; index < sizeof(errors) / sizeof(errors[0]); index++)
+    {
+        struct fault_state state = {0, errors[index]};
+        int                failures_before;
+
+        failures_before = failures;
+        EXPECT(p101_error_has_no_error(err));
+        fault_resource_events = 0U;
+        errno                 = P101_TEST_ERRNO_SENTINEL;
+        p101_env_set_fault_injector(env, fail_next_call, &state);
+        unsigned int result = p101_parse_unsigned_int_prefix(env, err, NULL, NULL, 0);
+        (void)result;
+        EXPECT(state.checks == 1);
+        EXPECT(p101_error_is_errno(err, state.code));
+        EXPECT(errno == P101_TEST_ERRNO_SENTINEL);
+        EXPECT(result == (0));
+        EXPECT(fault_resource_events == 0U);
+        write_outcome("p101_parse_unsigned_int_prefix", "errno", error_names[index], state.code, failures == failures_before);
+        p101_error_reset(err);
+    }
+    p101_env_set_fault_injector(env, NULL, NULL);
+    {
+        int   native_status = 0;
+        pid_t native_pid    = fork();
+
+        EXPECT(native_pid >= 0);
+        if(native_pid == 0)
+        {
+            bool               native_passed = true;
+            struct p101_error *native_err    = NULL;
+            struct p101_env   *native_env    = NULL;
+            FILE              *native_stdin_result;
+
+            native_child_process = true;
+            failures             = 0;
+            (void)alarm(2U);
+            if(unsetenv("P101_CALL_LOG") != 0 || unsetenv("P101_RESOURCE_LOG") != 0)
+            {
+                fprintf(stderr, "native setup failed: cannot clear p101 logging environment\n");
+                native_child_status = 77;
+                goto native_child_done_;
+            }
+            native_stdin_result = freopen("/dev/null", "r", stdin);
+            if(native_stdin_result == NULL)
+            {
+                fprintf(stderr, "native setup failed: cannot make standard input deterministic\n");
+                native_child_status = 77;
+                goto native_child_done_;
+            }
+            native_err = p101_error_create(false);
+            if(native_err == NULL)
+            {
+                native_child_status = 77;
+                goto native_child_done_;
+            }
+            native_env = p101_env_create(native_err, NULL);
+            if(native_env == NULL)
+            {
+                native_child_status = 77;
+                goto native_child_done_;
+            }
+            const char  *native_argument_3 = NULL;
+            unsigned int native_result     = p101_parse_unsigned_int_prefix(native_env, native_err, "1", &native_argument_3, 0);
+            (void)native_result;
+            if(p101_error_has_error(native_err))
+            {
+                bool native_error_declared = false;
+
+                for(size_t native_error_index = 0U; native_error_index < sizeof(errors) / sizeof(errors[0]); native_error_index++)
+                {
+                    if(p101_error_is_errno(native_err, errors[native_error_index]))
+                    {
+                        native_error_declared = true;
+                    }
+                }
+                if(!native_error_declared)
+                {
+                    fprintf(stderr, "native smoke produced an undeclared platform failure: p101_parse_unsigned_int_prefix: %s\n", p101_error_get_message(native_err));
+                    native_passed = false;
+                }
+                p101_error_reset(native_err);
+            }
+            native_child_status = native_passed ? EXIT_SUCCESS : EXIT_FAILURE;
+        native_child_done_:
+            p101_env_destroy(native_env);
+            p101_error_destroy(native_err);
+        }
+        if(native_pid > 0)
+        {
+            EXPECT(native_waitpid_nointr(native_pid, &native_status) == native_pid);
+            if(WIFSIGNALED(native_status))
+            {
+                fprintf(stderr, "native smoke terminated by signal: p101_parse_unsigned_int_prefix: %d\n", WTERMSIG(native_status));
+            }
+            EXPECT(WIFEXITED(native_status));
+            if(WIFEXITED(native_status) && WEXITSTATUS(native_status) == 77)
+            {
+                fprintf(stderr, "native smoke fixture unavailable: p101_parse_unsigned_int_prefix\n");
+            }
+            else if(WIFEXITED(native_status))
+            {
+                if(WEXITSTATUS(native_status) != EXIT_SUCCESS)
+                {
+                    fprintf(stderr, "native smoke exited unsuccessfully: p101_parse_unsigned_int_prefix: %d\n", WEXITSTATUS(native_status));
+                }
+                EXPECT(WEXITSTATUS(native_status) == EXIT_SUCCESS);
+            }
+        }
+        p101_error_reset(err);
+    }
+}
+
+/* P101_TEST_CASE(p101_parse_unsigned_long) */
+static void test_p101_parse_unsigned_long(struct p101_env *env, struct p101_error *err)
+{
+#ifdef __linux__
+    static const int         errors[]      = {EIO};
+    static const char *const error_names[] = {"EIO"};
+#elif defined(__APPLE__)
+    static const int         errors[]      = {EIO};
+    static const char *const error_names[] = {"EIO"};
+#elif defined(__FreeBSD__)
+    static const int         errors[]      = {EIO};
+    static const char *const error_names[] = {"EIO"};
+#else
+    static const int         errors[]      = {EIO};
+    static const char *const error_names[] = {"EIO"};
+#endif
+
+    for(size_t index = 0U; index < sizeof(errors) / sizeof(errors[0]); index++)
+    {
+        struct fault_state state = {0, errors[index]};
+        int                failures_before;
+
+        failures_before = failures;
+        EXPECT(p101_error_has_no_error(err));
+        fault_resource_events = 0U;
+        errno                 = P101_TEST_ERRNO_SENTINEL;
+        p101_env_set_fault_injector(env, fail_next_call, &state);
+        unsigned long result = p101_parse_unsigned_long(env, err, NULL, 0);
+        (void)result;
+        EXPECT(state.checks == 1);
+        EXPECT(p101_error_is_errno(err, state.code));
+        EXPECT(errno == P101_TEST_ERRNO_SENTINEL);
+        EXPECT(result == (0));
+        EXPECT(fault_resource_events == 0U);
+        write_outcome("p101_parse_unsigned_long", "errno", error_names[index], state.code, failures == failures_before);
+        p101_error_reset(err);
+    }
+    p101_env_set_fault_injector(env, NULL, NULL);
+    {
+        int   native_status = 0;
+        pid_t native_pid    = fork();
+
+        EXPECT(native_pid >= 0);
+        if(native_pid == 0)
+        {
+            bool               native_passed = true;
+            struct p101_error *native_err    = NULL;
+            struct p101_env   *native_env    = NULL;
+            FILE              *native_stdin_result;
+
+            native_child_process = true;
+            failures             = 0;
+            (void)alarm(2U);
+            if(unsetenv("P101_CALL_LOG") != 0 || unsetenv("P101_RESOURCE_LOG") != 0)
+            {
+                fprintf(stderr, "native setup failed: cannot clear p101 logging environment\n");
+                native_child_status = 77;
+                goto native_child_done_;
+            }
+            native_stdin_result = freopen("/dev/null", "r", stdin);
+            if(native_stdin_result == NULL)
+            {
+                fprintf(stderr, "native setup failed: cannot make standard input deterministic\n");
+                native_child_status = 77;
+                goto native_child_done_;
+            }
+            native_err = p101_error_create(false);
+            if(native_err == NULL)
+            {
+                native_child_status = 77;
+                goto native_child_done_;
+            }
+            native_env = p101_env_create(native_err, NULL);
+            if(native_env == NULL)
+            {
+                native_child_status = 77;
+                goto native_child_done_;
+            }
+            unsigned long native_result = p101_parse_unsigned_long(native_env, native_err, "1", 0);
+            (void)native_result;
+            if(p101_error_has_error(native_err))
+            {
+                bool native_error_declared = false;
+
+                for(size_t native_error_index = 0U; native_error_index < sizeof(errors) / sizeof(errors[0]); native_error_index++)
+                {
+                    if(p101_error_is_errno(native_err, errors[native_error_index]))
+                    {
+                        native_error_declared = true;
+                    }
+                }
+                if(!native_error_declared)
+                {
+                    fprintf(stderr, "native smoke produced an undeclared platform failure: p101_parse_unsigned_long: %s\n", p101_error_get_message(native_err));
+                    native_passed = false;
+                }
+                p101_error_reset(native_err);
+            }
+            native_child_status = native_passed ? EXIT_SUCCESS : EXIT_FAILURE;
+        native_child_done_:
+            p101_env_destroy(native_env);
+            p101_error_destroy(native_err);
+        }
+        if(native_pid > 0)
+        {
+            EXPECT(native_waitpid_nointr(native_pid, &native_status) == native_pid);
+            if(WIFSIGNALED(native_status))
+            {
+                fprintf(stderr, "native smoke terminated by signal: p101_parse_unsigned_long: %d\n", WTERMSIG(native_status));
+            }
+            EXPECT(WIFEXITED(native_status));
+            if(WIFEXITED(native_status) && WEXITSTATUS(native_status) == 77)
+            {
+                fprintf(stderr, "native smoke fixture unavailable: p101_parse_unsigned_long\n");
+            }
+            else if(WIFEXITED(native_status))
+            {
+                if(WEXITSTATUS(native_status) != EXIT_SUCCESS)
+                {
+                    fprintf(stderr, "native smoke exited unsuccessfully: p101_parse_unsigned_long: %d\n", WEXITSTATUS(native_status));
+                }
+                EXPECT(WEXITSTATUS(native_status) == EXIT_SUCCESS);
+            }
+        }
+        p101_error_reset(err);
+    }
+}
+
+/* P101_TEST_CASE(p101_parse_unsigned_long_long) */
+static void test_p101_parse_unsigned_long_long(struct p101_env *env, struct p101_error *err)
+{
+#ifdef __linux__
+    static const int         errors[]      = {EIO};
+    static const char *const error_names[] = {"EIO"};
+#elif defined(__APPLE__)
+    static const int         errors[]      = {EIO};
+    static const char *const error_names[] = {"EIO"};
+#elif defined(__FreeBSD__)
+    static const int         errors[]      = {EIO};
+    static const char *const error_names[] = {"EIO"};
+#else
+    static const int         errors[]      = {EIO};
+    static const char *const error_names[] = {"EIO"};
+#endif
+
+    for(size_t index = 0U; index < sizeof(errors) / sizeof(errors[0]); index++)
+    {
+        struct fault_state state = {0, errors[index]};
+        int                failures_before;
+
+        failures_before = failures;
+        EXPECT(p101_error_has_no_error(err));
+        fault_resource_events = 0U;
+        errno                 = P101_TEST_ERRNO_SENTINEL;
+        p101_env_set_fault_injector(env, fail_next_call, &state);
+        unsigned long long result = p101_parse_unsigned_long_long(env, err, NULL, 0);
+        (void)result;
+        EXPECT(state.checks == 1);
+        EXPECT(p101_error_is_errno(err, state.code));
+        EXPECT(errno == P101_TEST_ERRNO_SENTINEL);
+        EXPECT(result == (0));
+        EXPECT(fault_resource_events == 0U);
+        write_outcome("p101_parse_unsigned_long_long", "errno", error_names[index], state.code, failures == failures_before);
+        p101_error_reset(err);
+    }
+    p101_env_set_fault_injector(env, NULL, NULL);
+    {
+        int   native_status = 0;
+        pid_t native_pid    = fork();
+
+        EXPECT(native_pid >= 0);
+        if(native_pid == 0)
+        {
+            bool               native_passed = true;
+            struct p101_error *native_err    = NULL;
+            struct p101_env   *native_env    = NULL;
+            FILE              *native_stdin_result;
+
+            native_child_process = true;
+            failures             = 0;
+            (void)alarm(2U);
+            if(unsetenv("P101_CALL_LOG") != 0 || unsetenv("P101_RESOURCE_LOG") != 0)
+            {
+                fprintf(stderr, "native setup failed: cannot clear p101 logging environment\n");
+                native_child_status = 77;
+                goto native_child_done_;
+            }
+            native_stdin_result = freopen("/dev/null", "r", stdin);
+            if(native_stdin_result == NULL)
+            {
+                fprintf(stderr, "native setup failed: cannot make standard input deterministic\n");
+                native_child_status = 77;
+                goto native_child_done_;
+            }
+            native_err = p101_error_create(false);
+            if(native_err == NULL)
+            {
+                native_child_status = 77;
+                goto native_child_done_;
+            }
+            native_env = p101_env_create(native_err, NULL);
+            if(native_env == NULL)
+            {
+                native_child_status = 77;
+                goto native_child_done_;
+            }
+            unsigned long long native_result = p101_parse_unsigned_long_long(native_env, native_err, "1", 0);
+            (void)native_result;
+            if(p101_error_has_error(native_err))
+            {
+                bool native_error_declared = false;
+
+                for(size_t native_error_index = 0U; native_error_index < sizeof(errors) / sizeof(errors[0]); native_error_index++)
+                {
+                    if(p101_error_is_errno(native_err, errors[native_error_index]))
+                    {
+                        native_error_declared = true;
+                    }
+                }
+                if(!native_error_declared)
+                {
+                    fprintf(stderr, "native smoke produced an undeclared platform failure: p101_parse_unsigned_long_long: %s\n", p101_error_get_message(native_err));
+                    native_passed = false;
+                }
+                p101_error_reset(native_err);
+            }
+            native_child_status = native_passed ? EXIT_SUCCESS : EXIT_FAILURE;
+        native_child_done_:
+            p101_env_destroy(native_env);
+            p101_error_destroy(native_err);
+        }
+        if(native_pid > 0)
+        {
+            EXPECT(native_waitpid_nointr(native_pid, &native_status) == native_pid);
+            if(WIFSIGNALED(native_status))
+            {
+                fprintf(stderr, "native smoke terminated by signal: p101_parse_unsigned_long_long: %d\n", WTERMSIG(native_status));
+            }
+            EXPECT(WIFEXITED(native_status));
+            if(WIFEXITED(native_status) && WEXITSTATUS(native_status) == 77)
+            {
+                fprintf(stderr, "native smoke fixture unavailable: p101_parse_unsigned_long_long\n");
+            }
+            else if(WIFEXITED(native_status))
+            {
+                if(WEXITSTATUS(native_status) != EXIT_SUCCESS)
+                {
+                    fprintf(stderr, "native smoke exited unsuccessfully: p101_parse_unsigned_long_long: %d\n", WEXITSTATUS(native_status));
+                }
+                EXPECT(WEXITSTATUS(native_status) == EXIT_SUCCESS);
+            }
+        }
+        p101_error_reset(err);
+    }
+}
+
+/* P101_TEST_CASE(p101_parse_unsigned_long_long_n) */
+static void test_p101_parse_unsigned_long_long_n(struct p101_env *env, struct p101_error *err)
+{
+#ifdef __linux__
+    static const int         errors[]      = {EIO};
+    static const char *const error_names[] = {"EIO"};
+#elif defined(__APPLE__)
+    static const int         errors[]      = {EIO};
+    static const char *const error_names[] = {"EIO"};
+#elif defined(__FreeBSD__)
+    static const int         errors[]      = {EIO};
+    static const char *const error_names[] = {"EIO"};
+#else
+    static const int         errors[]      = {EIO};
+    static const char *const error_names[] = {"EIO"};
+#endif
+
+    for(size_t index = 0U; index < sizeof(errors) / sizeof(errors[0]); index++)
+    {
+        struct fault_state state = {0, errors[index]};
+        int                failures_before;
+
+        failures_before = failures;
+        EXPECT(p101_error_has_no_error(err));
+        fault_resource_events = 0U;
+        errno                 = P101_TEST_ERRNO_SENTINEL;
+        p101_env_set_fault_injector(env, fail_next_call, &state);
+        unsigned long long result = p101_parse_unsigned_long_long_n(env, err, NULL, 0, 0);
+        (void)result;
+        EXPECT(state.checks == 1);
+        EXPECT(p101_error_is_errno(err, state.code));
+        EXPECT(errno == P101_TEST_ERRNO_SENTINEL);
+        EXPECT(result == (0));
+        EXPECT(fault_resource_events == 0U);
+        write_outcome("p101_parse_unsigned_long_long_n", "errno", error_names[index], state.code, failures == failures_before);
+        p101_error_reset(err);
+    }
+    p101_env_set_fault_injector(env, NULL, NULL);
+    {
+        int   native_status = 0;
+        pid_t native_pid    = fork();
+
+        EXPECT(native_pid >= 0);
+        if(native_pid == 0)
+        {
+            bool               native_passed = true;
+            struct p101_error *native_err    = NULL;
+            struct p101_env   *native_env    = NULL;
+            FILE              *native_stdin_result;
+
+            native_child_process = true;
+            failures             = 0;
+            (void)alarm(2U);
+            if(unsetenv("P101_CALL_LOG") != 0 || unsetenv("P101_RESOURCE_LOG") != 0)
+            {
+                fprintf(stderr, "native setup failed: cannot clear p101 logging environment\n");
+                native_child_status = 77;
+                goto native_child_done_;
+            }
+            native_stdin_result = freopen("/dev/null", "r", stdin);
+            if(native_stdin_result == NULL)
+            {
+                fprintf(stderr, "native setup failed: cannot make standard input deterministic\n");
+                native_child_status = 77;
+                goto native_child_done_;
+            }
+            native_err = p101_error_create(false);
+            if(native_err == NULL)
+            {
+                native_child_status = 77;
+                goto native_child_done_;
+            }
+            native_env = p101_env_create(native_err, NULL);
+            if(native_env == NULL)
+            {
+                native_child_status = 77;
+                goto native_child_done_;
+            }
+            unsigned long long native_result = p101_parse_unsigned_long_long_n(native_env, native_err, "1", 1, 0);
+            (void)native_result;
+            if(p101_error_has_error(native_err))
+            {
+                bool native_error_declared = false;
+
+                for(size_t native_error_index = 0U; native_error_index < sizeof(errors) / sizeof(errors[0]); native_error_index++)
+                {
+                    if(p101_error_is_errno(native_err, errors[native_error_index]))
+                    {
+                        native_error_declared = true;
+                    }
+                }
+                if(!native_error_declared)
+                {
+                    fprintf(stderr, "native smoke produced an undeclared platform failure: p101_parse_unsigned_long_long_n: %s\n", p101_error_get_message(native_err));
+                    native_passed = false;
+                }
+                p101_error_reset(native_err);
+            }
+            native_child_status = native_passed ? EXIT_SUCCESS : EXIT_FAILURE;
+        native_child_done_:
+            p101_env_destroy(native_env);
+            p101_error_destroy(native_err);
+        }
+        if(native_pid > 0)
+        {
+            EXPECT(native_waitpid_nointr(native_pid, &native_status) == native_pid);
+            if(WIFSIGNALED(native_status))
+            {
+                fprintf(stderr, "native smoke terminated by signal: p101_parse_unsigned_long_long_n: %d\n", WTERMSIG(native_status));
+            }
+            EXPECT(WIFEXITED(native_status));
+            if(WIFEXITED(native_status) && WEXITSTATUS(native_status) == 77)
+            {
+                fprintf(stderr, "native smoke fixture unavailable: p101_parse_unsigned_long_long_n\n");
+            }
+            else if(WIFEXITED(native_status))
+            {
+                if(WEXITSTATUS(native_status) != EXIT_SUCCESS)
+                {
+                    fprintf(stderr, "native smoke exited unsuccessfully: p101_parse_unsigned_long_long_n: %d\n", WEXITSTATUS(native_status));
+                }
+                EXPECT(WEXITSTATUS(native_status) == EXIT_SUCCESS);
+            }
+        }
+        p101_error_reset(err);
+    }
+}
+
+/* P101_TEST_CASE(p101_parse_unsigned_long_long_prefix) */
+static void test_p101_parse_unsigned_long_long_prefix(struct p101_env *env, struct p101_error *err)
+{
+#ifdef __linux__
+    static const int         errors[]      = {EIO};
+    static const char *const error_names[] = {"EIO"};
+#elif defined(__APPLE__)
+    static const int         errors[]      = {EIO};
+    static const char *const error_names[] = {"EIO"};
+#elif defined(__FreeBSD__)
+    static const int         errors[]      = {EIO};
+    static const char *const error_names[] = {"EIO"};
+#else
+    static const int         errors[]      = {EIO};
+    static const char *const error_names[] = {"EIO"};
+#endif
+
+    for(size_t index = 0U; index < sizeof(errors) / sizeof(errors[0]); index++)
+    {
+        struct fault_state state = {0, errors[index]};
+        int                failures_before;
+
+        failures_before = failures;
+        EXPECT(p101_error_has_no_error(err));
+        fault_resource_events = 0U;
+        errno                 = P101_TEST_ERRNO_SENTINEL;
+        p101_env_set_fault_injector(env, fail_next_call, &state);
+        unsigned long long result = p101_parse_unsigned_long_long_prefix(env, err, NULL, NULL, 0);
+        (void)result;
+        EXPECT(state.checks == 1);
+        EXPECT(p101_error_is_errno(err, state.code));
+        EXPECT(errno == P101_TEST_ERRNO_SENTINEL);
+        EXPECT(result == (0));
+        EXPECT(fault_resource_events == 0U);
+        write_outcome("p101_parse_unsigned_long_long_prefix", "errno", error_names[index], state.code, failures == failures_before);
+        p101_error_reset(err);
+    }
+    p101_env_set_fault_injector(env, NULL, NULL);
+    {
+        int   native_status = 0;
+        pid_t native_pid    = fork();
+
+        EXPECT(native_pid >= 0);
+        if(native_pid == 0)
+        {
+            bool               native_passed = true;
+            struct p101_error *native_err    = NULL;
+            struct p101_env   *native_env    = NULL;
+            FILE              *native_stdin_result;
+
+            native_child_process = true;
+            failures             = 0;
+            (void)alarm(2U);
+            if(unsetenv("P101_CALL_LOG") != 0 || unsetenv("P101_RESOURCE_LOG") != 0)
+            {
+                fprintf(stderr, "native setup failed: cannot clear p101 logging environment\n");
+                native_child_status = 77;
+                goto native_child_done_;
+            }
+            native_stdin_result = freopen("/dev/null", "r", stdin);
+            if(native_stdin_result == NULL)
+            {
+                fprintf(stderr, "native setup failed: cannot make standard input deterministic\n");
+                native_child_status = 77;
+                goto native_child_done_;
+            }
+            native_err = p101_error_create(false);
+            if(native_err == NULL)
+            {
+                native_child_status = 77;
+                goto native_child_done_;
+            }
+            native_env = p101_env_create(native_err, NULL);
+            if(native_env == NULL)
+            {
+                native_child_status = 77;
+                goto native_child_done_;
+            }
+            const char        *native_argument_3 = NULL;
+            unsigned long long native_result     = p101_parse_unsigned_long_long_prefix(native_env, native_err, "1", &native_argument_3, 0);
+            (void)native_result;
+            if(p101_error_has_error(native_err))
+            {
+                bool native_error_declared = false;
+
+                for(size_t native_error_index = 0U; native_error_index < sizeof(errors) / sizeof(errors[0]); native_error_index++)
+                {
+                    if(p101_error_is_errno(native_err, errors[native_error_index]))
+                    {
+                        native_error_declared = true;
+                    }
+                }
+                if(!native_error_declared)
+                {
+                    fprintf(stderr, "native smoke produced an undeclared platform failure: p101_parse_unsigned_long_long_prefix: %s\n", p101_error_get_message(native_err));
+                    native_passed = false;
+                }
+                p101_error_reset(native_err);
+            }
+            native_child_status = native_passed ? EXIT_SUCCESS : EXIT_FAILURE;
+        native_child_done_:
+            p101_env_destroy(native_env);
+            p101_error_destroy(native_err);
+        }
+        if(native_pid > 0)
+        {
+            EXPECT(native_waitpid_nointr(native_pid, &native_status) == native_pid);
+            if(WIFSIGNALED(native_status))
+            {
+                fprintf(stderr, "native smoke terminated by signal: p101_parse_unsigned_long_long_prefix: %d\n", WTERMSIG(native_status));
+            }
+            EXPECT(WIFEXITED(native_status));
+            if(WIFEXITED(native_status) && WEXITSTATUS(native_status) == 77)
+            {
+                fprintf(stderr, "native smoke fixture unavailable: p101_parse_unsigned_long_long_prefix\n");
+            }
+            else if(WIFEXITED(native_status))
+            {
+                if(WEXITSTATUS(native_status) != EXIT_SUCCESS)
+                {
+                    fprintf(stderr, "native smoke exited unsuccessfully: p101_parse_unsigned_long_long_prefix: %d\n", WEXITSTATUS(native_status));
+                }
+                EXPECT(WEXITSTATUS(native_status) == EXIT_SUCCESS);
+            }
+        }
+        p101_error_reset(err);
+    }
+}
+
+/* P101_TEST_CASE(p101_parse_unsigned_long_n) */
+static void test_p101_parse_unsigned_long_n(struct p101_env *env, struct p101_error *err)
+{
+#ifdef __linux__
+    static const int         errors[]      = {EIO};
+    static const char *const error_names[] = {"EIO"};
+#elif defined(__APPLE__)
+    static const int         errors[]      = {EIO};
+    static const char *const error_names[] = {"EIO"};
+#elif defined(__FreeBSD__)
+    static const int         errors[]      = {EIO};
+    static const char *const error_names[] = {"EIO"};
+#else
+    static const int         errors[]      = {EIO};
+    static const char *const error_names[] = {"EIO"};
+#endif
+
+    for(size_t index = 0U; index < sizeof(errors) / sizeof(errors[0]); index++)
+    {
+        struct fault_state state = {0, errors[index]};
+        int                failures_before;
+
+        failures_before = failures;
+        EXPECT(p101_error_has_no_error(err));
+        fault_resource_events = 0U;
+        errno                 = P101_TEST_ERRNO_SENTINEL;
+        p101_env_set_fault_injector(env, fail_next_call, &state);
+        unsigned long result = p101_parse_unsigned_long_n(env, err, NULL, 0, 0);
+        (void)result;
+        EXPECT(state.checks == 1);
+        EXPECT(p101_error_is_errno(err, state.code));
+        EXPECT(errno == P101_TEST_ERRNO_SENTINEL);
+        EXPECT(result == (0));
+        EXPECT(fault_resource_events == 0U);
+        write_outcome("p101_parse_unsigned_long_n", "errno", error_names[index], state.code, failures == failures_before);
+        p101_error_reset(err);
+    }
+    p101_env_set_fault_injector(env, NULL, NULL);
+    {
+        int   native_status = 0;
+        pid_t native_pid    = fork();
+
+        EXPECT(native_pid >= 0);
+        if(native_pid == 0)
+        {
+            bool               native_passed = true;
+            struct p101_error *native_err    = NULL;
+            struct p101_env   *native_env    = NULL;
+            FILE              *native_stdin_result;
+
+            native_child_process = true;
+            failures             = 0;
+            (void)alarm(2U);
+            if(unsetenv("P101_CALL_LOG") != 0 || unsetenv("P101_RESOURCE_LOG") != 0)
+            {
+                fprintf(stderr, "native setup failed: cannot clear p101 logging environment\n");
+                native_child_status = 77;
+                goto native_child_done_;
+            }
+            native_stdin_result = freopen("/dev/null", "r", stdin);
+            if(native_stdin_result == NULL)
+            {
+                fprintf(stderr, "native setup failed: cannot make standard input deterministic\n");
+                native_child_status = 77;
+                goto native_child_done_;
+            }
+            native_err = p101_error_create(false);
+            if(native_err == NULL)
+            {
+                native_child_status = 77;
+                goto native_child_done_;
+            }
+            native_env = p101_env_create(native_err, NULL);
+            if(native_env == NULL)
+            {
+                native_child_status = 77;
+                goto native_child_done_;
+            }
+            unsigned long native_result = p101_parse_unsigned_long_n(native_env, native_err, "1", 1, 0);
+            (void)native_result;
+            if(p101_error_has_error(native_err))
+            {
+                bool native_error_declared = false;
+
+                for(size_t native_error_index = 0U; native_error_index < sizeof(errors) / sizeof(errors[0]); native_error_index++)
+                {
+                    if(p101_error_is_errno(native_err, errors[native_error_index]))
+                    {
+                        native_error_declared = true;
+                    }
+                }
+                if(!native_error_declared)
+                {
+                    fprintf(stderr, "native smoke produced an undeclared platform failure: p101_parse_unsigned_long_n: %s\n", p101_error_get_message(native_err));
+                    native_passed = false;
+                }
+                p101_error_reset(native_err);
+            }
+            native_child_status = native_passed ? EXIT_SUCCESS : EXIT_FAILURE;
+        native_child_done_:
+            p101_env_destroy(native_env);
+            p101_error_destroy(native_err);
+        }
+        if(native_pid > 0)
+        {
+            EXPECT(native_waitpid_nointr(native_pid, &native_status) == native_pid);
+            if(WIFSIGNALED(native_status))
+            {
+                fprintf(stderr, "native smoke terminated by signal: p101_parse_unsigned_long_n: %d\n", WTERMSIG(native_status));
+            }
+            EXPECT(WIFEXITED(native_status));
+            if(WIFEXITED(native_status) && WEXITSTATUS(native_status) == 77)
+            {
+                fprintf(stderr, "native smoke fixture unavailable: p101_parse_unsigned_long_n\n");
+            }
+            else if(WIFEXITED(native_status))
+            {
+                if(WEXITSTATUS(native_status) != EXIT_SUCCESS)
+                {
+                    fprintf(stderr, "native smoke exited unsuccessfully: p101_parse_unsigned_long_n: %d\n", WEXITSTATUS(native_status));
+                }
+                EXPECT(WEXITSTATUS(native_status) == EXIT_SUCCESS);
+            }
+        }
+        p101_error_reset(err);
+    }
+}
+
+/* P101_TEST_CASE(p101_parse_unsigned_long_prefix) */
+static void test_p101_parse_unsigned_long_prefix(struct p101_env *env, struct p101_error *err)
+{
+#ifdef __linux__
+    static const int         errors[]      = {EIO};
+    static const char *const error_names[] = {"EIO"};
+#elif defined(__APPLE__)
+    static const int         errors[]      = {EIO};
+    static const char *const error_names[] = {"EIO"};
+#elif defined(__FreeBSD__)
+    static const int         errors[]      = {EIO};
+    static const char *const error_names[] = {"EIO"};
+#else
+    static const int         errors[]      = {EIO};
+    static const char *const error_names[] = {"EIO"};
+#endif
+
+    for(size_t index = 0U; index < sizeof(errors) / sizeof(errors[0]); index++)
+    {
+        struct fault_state state = {0, errors[index]};
+        int                failures_before;
+
+        failures_before = failures;
+        EXPECT(p101_error_has_no_error(err));
+        fault_resource_events = 0U;
+        errno                 = P101_TEST_ERRNO_SENTINEL;
+        p101_env_set_fault_injector(env, fail_next_call, &state);
+        unsigned long result = p101_parse_unsigned_long_prefix(env, err, NULL, NULL, 0);
+        (void)result;
+        EXPECT(state.checks == 1);
+        EXPECT(p101_error_is_errno(err, state.code));
+        EXPECT(errno == P101_TEST_ERRNO_SENTINEL);
+        EXPECT(result == (0));
+        EXPECT(fault_resource_events == 0U);
+        write_outcome("p101_parse_unsigned_long_prefix", "errno", error_names[index], state.code, failures == failures_before);
+        p101_error_reset(err);
+    }
+    p101_env_set_fault_injector(env, NULL, NULL);
+    {
+        int   native_status = 0;
+        pid_t native_pid    = fork();
+
+        EXPECT(native_pid >= 0);
+        if(native_pid == 0)
+        {
+            bool               native_passed = true;
+            struct p101_error *native_err    = NULL;
+            struct p101_env   *native_env    = NULL;
+            FILE              *native_stdin_result;
+
+            native_child_process = true;
+            failures             = 0;
+            (void)alarm(2U);
+            if(unsetenv("P101_CALL_LOG") != 0 || unsetenv("P101_RESOURCE_LOG") != 0)
+            {
+                fprintf(stderr, "native setup failed: cannot clear p101 logging environment\n");
+                native_child_status = 77;
+                goto native_child_done_;
+            }
+            native_stdin_result = freopen("/dev/null", "r", stdin);
+            if(native_stdin_result == NULL)
+            {
+                fprintf(stderr, "native setup failed: cannot make standard input deterministic\n");
+                native_child_status = 77;
+                goto native_child_done_;
+            }
+            native_err = p101_error_create(false);
+            if(native_err == NULL)
+            {
+                native_child_status = 77;
+                goto native_child_done_;
+            }
+            native_env = p101_env_create(native_err, NULL);
+            if(native_env == NULL)
+            {
+                native_child_status = 77;
+                goto native_child_done_;
+            }
+            const char   *native_argument_3 = NULL;
+            unsigned long native_result     = p101_parse_unsigned_long_prefix(native_env, native_err, "1", &native_argument_3, 0);
+            (void)native_result;
+            if(p101_error_has_error(native_err))
+            {
+                bool native_error_declared = false;
+
+                for(size_t native_error_index = 0U; native_error_index < sizeof(errors) / sizeof(errors[0]); native_error_index++)
+                {
+                    if(p101_error_is_errno(native_err, errors[native_error_index]))
+                    {
+                        native_error_declared = true;
+                    }
+                }
+                if(!native_error_declared)
+                {
+                    fprintf(stderr, "native smoke produced an undeclared platform failure: p101_parse_unsigned_long_prefix: %s\n", p101_error_get_message(native_err));
+                    native_passed = false;
+                }
+                p101_error_reset(native_err);
+            }
+            native_child_status = native_passed ? EXIT_SUCCESS : EXIT_FAILURE;
+        native_child_done_:
+            p101_env_destroy(native_env);
+            p101_error_destroy(native_err);
+        }
+        if(native_pid > 0)
+        {
+            EXPECT(native_waitpid_nointr(native_pid, &native_status) == native_pid);
+            if(WIFSIGNALED(native_status))
+            {
+                fprintf(stderr, "native smoke terminated by signal: p101_parse_unsigned_long_prefix: %d\n", WTERMSIG(native_status));
+            }
+            EXPECT(WIFEXITED(native_status));
+            if(WIFEXITED(native_status) && WEXITSTATUS(native_status) == 77)
+            {
+                fprintf(stderr, "native smoke fixture unavailable: p101_parse_unsigned_long_prefix\n");
+            }
+            else if(WIFEXITED(native_status))
+            {
+                if(WEXITSTATUS(native_status) != EXIT_SUCCESS)
+                {
+                    fprintf(stderr, "native smoke exited unsuccessfully: p101_parse_unsigned_long_prefix: %d\n", WEXITSTATUS(native_status));
+                }
+                EXPECT(WEXITSTATUS(native_status) == EXIT_SUCCESS);
+            }
+        }
+        p101_error_reset(err);
+    }
+}
+
+/* P101_TEST_CASE(p101_parse_unsigned_short) */
+static void test_p101_parse_unsigned_short(struct p101_env *env, struct p101_error *err)
+{
+#ifdef __linux__
+    static const int         errors[]      = {EIO};
+    static const char *const error_names[] = {"EIO"};
+#elif defined(__APPLE__)
+    static const int         errors[]      = {EIO};
+    static const char *const error_names[] = {"EIO"};
+#elif defined(__FreeBSD__)
+    static const int         errors[]      = {EIO};
+    static const char *const error_names[] = {"EIO"};
+#else
+    static const int         errors[]      = {EIO};
+    static const char *const error_names[] = {"EIO"};
+#endif
+
+    for(size_t index = 0U; index < sizeof(errors) / sizeof(errors[0]); index++)
+    {
+        struct fault_state state = {0, errors[index]};
+        int                failures_before;
+
+        failures_before = failures;
+        EXPECT(p101_error_has_no_error(err));
+        fault_resource_events = 0U;
+        errno                 = P101_TEST_ERRNO_SENTINEL;
+        p101_env_set_fault_injector(env, fail_next_call, &state);
+        unsigned short result = p101_parse_unsigned_short(env, err, NULL, 0);
+        (void)result;
+        EXPECT(state.checks == 1);
+        EXPECT(p101_error_is_errno(err, state.code));
+        EXPECT(errno == P101_TEST_ERRNO_SENTINEL);
+        EXPECT(result == (0));
+        EXPECT(fault_resource_events == 0U);
+        write_outcome("p101_parse_unsigned_short", "errno", error_names[index], state.code, failures == failures_before);
+        p101_error_reset(err);
+    }
+    p101_env_set_fault_injector(env, NULL, NULL);
+    {
+        int   native_status = 0;
+        pid_t native_pid    = fork();
+
+        EXPECT(native_pid >= 0);
+        if(native_pid == 0)
+        {
+            bool               native_passed = true;
+            struct p101_error *native_err    = NULL;
+            struct p101_env   *native_env    = NULL;
+            FILE              *native_stdin_result;
+
+            native_child_process = true;
+            failures             = 0;
+            (void)alarm(2U);
+            if(unsetenv("P101_CALL_LOG") != 0 || unsetenv("P101_RESOURCE_LOG") != 0)
+            {
+                fprintf(stderr, "native setup failed: cannot clear p101 logging environment\n");
+                native_child_status = 77;
+                goto native_child_done_;
+            }
+            native_stdin_result = freopen("/dev/null", "r", stdin);
+            if(native_stdin_result == NULL)
+            {
+                fprintf(stderr, "native setup failed: cannot make standard input deterministic\n");
+                native_child_status = 77;
+                goto native_child_done_;
+            }
+            native_err = p101_error_create(false);
+            if(native_err == NULL)
+            {
+                native_child_status = 77;
+                goto native_child_done_;
+            }
+            native_env = p101_env_create(native_err, NULL);
+            if(native_env == NULL)
+            {
+                native_child_status = 77;
+                goto native_child_done_;
+            }
+            unsigned short native_result = p101_parse_unsigned_short(native_env, native_err, "1", 0);
+            (void)native_result;
+            if(p101_error_has_error(native_err))
+            {
+                bool native_error_declared = false;
+
+                for(size_t native_error_index = 0U; native_error_index < sizeof(errors) / sizeof(errors[0]); native_error_index++)
+                {
+                    if(p101_error_is_errno(native_err, errors[native_error_index]))
+                    {
+                        native_error_declared = true;
+                    }
+                }
+                if(!native_error_declared)
+                {
+                    fprintf(stderr, "native smoke produced an undeclared platform failure: p101_parse_unsigned_short: %s\n", p101_error_get_message(native_err));
+                    native_passed = false;
+                }
+                p101_error_reset(native_err);
+            }
+            native_child_status = native_passed ? EXIT_SUCCESS : EXIT_FAILURE;
+        native_child_done_:
+            p101_env_destroy(native_env);
+            p101_error_destroy(native_err);
+        }
+        if(native_pid > 0)
+        {
+            EXPECT(native_waitpid_nointr(native_pid, &native_status) == native_pid);
+            if(WIFSIGNALED(native_status))
+            {
+                fprintf(stderr, "native smoke terminated by signal: p101_parse_unsigned_short: %d\n", WTERMSIG(native_status));
+            }
+            EXPECT(WIFEXITED(native_status));
+            if(WIFEXITED(native_status) && WEXITSTATUS(native_status) == 77)
+            {
+                fprintf(stderr, "native smoke fixture unavailable: p101_parse_unsigned_short\n");
+            }
+            else if(WIFEXITED(native_status))
+            {
+                if(WEXITSTATUS(native_status) != EXIT_SUCCESS)
+                {
+                    fprintf(stderr, "native smoke exited unsuccessfully: p101_parse_unsigned_short: %d\n", WEXITSTATUS(native_status));
+                }
+                EXPECT(WEXITSTATUS(native_status) == EXIT_SUCCESS);
+            }
+        }
+        p101_error_reset(err);
+    }
+}
+
+/* P101_TEST_CASE(p101_parse_unsigned_short_n) */
+static void test_p101_parse_unsigned_short_n(struct p101_env *env, struct p101_error *err)
+{
+#ifdef __linux__
+    static const int         errors[]      = {EIO};
+    static const char *const error_names[] = {"EIO"};
+#elif defined(__APPLE__)
+    static const int         errors[]      = {EIO};
+    static const char *const error_names[] = {"EIO"};
+#elif defined(__FreeBSD__)
+    static const int         errors[]      = {EIO};
+    static const char *const error_names[] = {"EIO"};
+#else
+    static const int         errors[]      = {EIO};
+    static const char *const error_names[] = {"EIO"};
+#endif
+
+    for(size_t index = 0U; index < sizeof(errors) / sizeof(errors[0]); index++)
+    {
+        struct fault_state state = {0, errors[index]};
+        int                failures_before;
+
+        failures_before = failures;
+        EXPECT(p101_error_has_no_error(err));
+        fault_resource_events = 0U;
+        errno                 = P101_TEST_ERRNO_SENTINEL;
+        p101_env_set_fault_injector(env, fail_next_call, &state);
+        unsigned short result = p101_parse_unsigned_short_n(env, err, NULL, 0, 0);
+        (void)result;
+        EXPECT(state.checks == 1);
+        EXPECT(p101_error_is_errno(err, state.code));
+        EXPECT(errno == P101_TEST_ERRNO_SENTINEL);
+        EXPECT(result == (0));
+        EXPECT(fault_resource_events == 0U);
+        write_outcome("p101_parse_unsigned_short_n", "errno", error_names[index], state.code, failures == failures_before);
+        p101_error_reset(err);
+    }
+    p101_env_set_fault_injector(env, NULL, NULL);
+    {
+        int   native_status = 0;
+        pid_t native_pid    = fork();
+
+        EXPECT(native_pid >= 0);
+        if(native_pid == 0)
+        {
+            bool               native_passed = true;
+            struct p101_error *native_err    = NULL;
+            struct p101_env   *native_env    = NULL;
+            FILE              *native_stdin_result;
+
+            native_child_process = true;
+            failures             = 0;
+            (void)alarm(2U);
+            if(unsetenv("P101_CALL_LOG") != 0 || unsetenv("P101_RESOURCE_LOG") != 0)
+            {
+                fprintf(stderr, "native setup failed: cannot clear p101 logging environment\n");
+                native_child_status = 77;
+                goto native_child_done_;
+            }
+            native_stdin_result = freopen("/dev/null", "r", stdin);
+            if(native_stdin_result == NULL)
+            {
+                fprintf(stderr, "native setup failed: cannot make standard input deterministic\n");
+                native_child_status = 77;
+                goto native_child_done_;
+            }
+            native_err = p101_error_create(false);
+            if(native_err == NULL)
+            {
+                native_child_status = 77;
+                goto native_child_done_;
+            }
+            native_env = p101_env_create(native_err, NULL);
+            if(native_env == NULL)
+            {
+                native_child_status = 77;
+                goto native_child_done_;
+            }
+            unsigned short native_result = p101_parse_unsigned_short_n(native_env, native_err, "1", 1, 0);
+            (void)native_result;
+            if(p101_error_has_error(native_err))
+            {
+                bool native_error_declared = false;
+
+                for(size_t native_error_index = 0U; native_error_index < sizeof(errors) / sizeof(errors[0]); native_error_index++)
+                {
+                    if(p101_error_is_errno(native_err, errors[native_error_index]))
+                    {
+                        native_error_declared = true;
+                    }
+                }
+                if(!native_error_declared)
+                {
+                    fprintf(stderr, "native smoke produced an undeclared platform failure: p101_parse_unsigned_short_n: %s\n", p101_error_get_message(native_err));
+                    native_passed = false;
+                }
+                p101_error_reset(native_err);
+            }
+            native_child_status = native_passed ? EXIT_SUCCESS : EXIT_FAILURE;
+        native_child_done_:
+            p101_env_destroy(native_env);
+            p101_error_destroy(native_err);
+        }
+        if(native_pid > 0)
+        {
+            EXPECT(native_waitpid_nointr(native_pid, &native_status) == native_pid);
+            if(WIFSIGNALED(native_status))
+            {
+                fprintf(stderr, "native smoke terminated by signal: p101_parse_unsigned_short_n: %d\n", WTERMSIG(native_status));
+            }
+            EXPECT(WIFEXITED(native_status));
+            if(WIFEXITED(native_status) && WEXITSTATUS(native_status) == 77)
+            {
+                fprintf(stderr, "native smoke fixture unavailable: p101_parse_unsigned_short_n\n");
+            }
+            else if(WIFEXITED(native_status))
+            {
+                if(WEXITSTATUS(native_status) != EXIT_SUCCESS)
+                {
+                    fprintf(stderr, "native smoke exited unsuccessfully: p101_parse_unsigned_short_n: %d\n", WEXITSTATUS(native_status));
+                }
+                EXPECT(WEXITSTATUS(native_status) == EXIT_SUCCESS);
+            }
+        }
+        p101_error_reset(err);
+    }
+}
+
+/* P101_TEST_CASE(p101_parse_unsigned_short_prefix) */
+static void test_p101_parse_unsigned_short_prefix(struct p101_env *env, struct p101_error *err)
+{
+#ifdef __linux__
+    static const int         errors[]      = {EIO};
+    static const char *const error_names[] = {"EIO"};
+#elif defined(__APPLE__)
+    static const int         errors[]      = {EIO};
+    static const char *const error_names[] = {"EIO"};
+#elif defined(__FreeBSD__)
+    static const int         errors[]      = {EIO};
+    static const char *const error_names[] = {"EIO"};
+#else
+    static const int         errors[]      = {EIO};
+    static const char *const error_names[] = {"EIO"};
+#endif
+
+    for(size_t index = 0U; index < sizeof(errors) / sizeof(errors[0]); index++)
+    {
+        struct fault_state state = {0, errors[index]};
+        int                failures_before;
+
+        failures_before = failures;
+        EXPECT(p101_error_has_no_error(err));
+        fault_resource_events = 0U;
+        errno                 = P101_TEST_ERRNO_SENTINEL;
+        p101_env_set_fault_injector(env, fail_next_call, &state);
+        unsigned short result = p101_parse_unsigned_short_prefix(env, err, NULL, NULL, 0);
+        (void)result;
+        EXPECT(state.checks == 1);
+        EXPECT(p101_error_is_errno(err, state.code));
+        EXPECT(errno == P101_TEST_ERRNO_SENTINEL);
+        EXPECT(result == (0));
+        EXPECT(fault_resource_events == 0U);
+        write_outcome("p101_parse_unsigned_short_prefix", "errno", error_names[index], state.code, failures == failures_before);
+        p101_error_reset(err);
+    }
+    p101_env_set_fault_injector(env, NULL, NULL);
+    {
+        int   native_status = 0;
+        pid_t native_pid    = fork();
+
+        EXPECT(native_pid >= 0);
+        if(native_pid == 0)
+        {
+            bool               native_passed = true;
+            struct p101_error *native_err    = NULL;
+            struct p101_env   *native_env    = NULL;
+            FILE              *native_stdin_result;
+
+            native_child_process = true;
+            failures             = 0;
+            (void)alarm(2U);
+            if(unsetenv("P101_CALL_LOG") != 0 || unsetenv("P101_RESOURCE_LOG") != 0)
+            {
+                fprintf(stderr, "native setup failed: cannot clear p101 logging environment\n");
+                native_child_status = 77;
+                goto native_child_done_;
+            }
+            native_stdin_result = freopen("/dev/null", "r", stdin);
+            if(native_stdin_result == NULL)
+            {
+                fprintf(stderr, "native setup failed: cannot make standard input deterministic\n");
+                native_child_status = 77;
+                goto native_child_done_;
+            }
+            native_err = p101_error_create(false);
+            if(native_err == NULL)
+            {
+                native_child_status = 77;
+                goto native_child_done_;
+            }
+            native_env = p101_env_create(native_err, NULL);
+            if(native_env == NULL)
+            {
+                native_child_status = 77;
+                goto native_child_done_;
+            }
+            const char    *native_argument_3 = NULL;
+            unsigned short native_result     = p101_parse_unsigned_short_prefix(native_env, native_err, "1", &native_argument_3, 0);
+            (void)native_result;
+            if(p101_error_has_error(native_err))
+            {
+                bool native_error_declared = false;
+
+                for(size_t native_error_index = 0U; native_error_index < sizeof(errors) / sizeof(errors[0]); native_error_index++)
+                {
+                    if(p101_error_is_errno(native_err, errors[native_error_index]))
+                    {
+                        native_error_declared = true;
+                    }
+                }
+                if(!native_error_declared)
+                {
+                    fprintf(stderr, "native smoke produced an undeclared platform failure: p101_parse_unsigned_short_prefix: %s\n", p101_error_get_message(native_err));
+                    native_passed = false;
+                }
+                p101_error_reset(native_err);
+            }
+            native_child_status = native_passed ? EXIT_SUCCESS : EXIT_FAILURE;
+        native_child_done_:
+            p101_env_destroy(native_env);
+            p101_error_destroy(native_err);
+        }
+        if(native_pid > 0)
+        {
+            EXPECT(native_waitpid_nointr(native_pid, &native_status) == native_pid);
+            if(WIFSIGNALED(native_status))
+            {
+                fprintf(stderr, "native smoke terminated by signal: p101_parse_unsigned_short_prefix: %d\n", WTERMSIG(native_status));
+            }
+            EXPECT(WIFEXITED(native_status));
+            if(WIFEXITED(native_status) && WEXITSTATUS(native_status) == 77)
+            {
+                fprintf(stderr, "native smoke fixture unavailable: p101_parse_unsigned_short_prefix\n");
+            }
+            else if(WIFEXITED(native_status))
+            {
+                if(WEXITSTATUS(native_status) != EXIT_SUCCESS)
+                {
+                    fprintf(stderr, "native smoke exited unsuccessfully: p101_parse_unsigned_short_prefix: %d\n", WEXITSTATUS(native_status));
+                }
+                EXPECT(WEXITSTATUS(native_status) == EXIT_SUCCESS);
+            }
+        }
+        p101_error_reset(err);
+    }
+}
+
+int main(void)
+{
+    const char        *outcome_path;
+    struct p101_error *err = NULL;
+    struct p101_env   *env = NULL;
+    int                status;
+
+    outcome_path = getenv("P101_WRAPPER_OUTCOME_LOG");
+    if(outcome_path != NULL && outcome_path[0] != '\0')
+    {
+        outcome_stream = fopen(outcome_path, "a");
+        if(outcome_stream == NULL)
+        {
+            fprintf(stderr, "FAIL: cannot open wrapper outcome receipt\n");
+            failures++;
+        }
+    }
+    if(failures == 0)
+    {
+        err = p101_error_create(false);
+    }
+    if(err != NULL)
+    {
+        env = p101_env_create(err, NULL);
+    }
+    if(env == NULL)
+    {
+        failures++;
+    }
+    else
+    {
+        p101_env_set_fd_observer(env, count_fd_event, NULL);
+        p101_env_set_alloc_observer(env, count_alloc_event, NULL);
+        p101_env_set_resource_observer(env, count_resource_event, NULL);
+        if(!native_child_process)
+        {
+            test_p101_format_char(env, err);
+        }
+        if(!native_child_process)
+        {
+            test_p101_format_int(env, err);
+        }
+        if(!native_child_process)
+        {
+            test_p101_format_int16_t(env, err);
+        }
+        if(!native_child_process)
+        {
+            test_p101_format_int32_t(env, err);
+        }
+        if(!native_child_process)
+        {
+            test_p101_format_int64_t(env, err);
+        }
+        if(!native_child_process)
+        {
+            test_p101_format_int8_t(env, err);
+        }
+        if(!native_child_process)
+        {
+            test_p101_format_long(env, err);
+        }
+        if(!native_child_process)
+        {
+            test_p101_format_long_long(env, err);
+        }
+        if(!native_child_process)
+        {
+            test_p101_format_short(env, err);
+        }
+        if(!native_child_process)
+        {
+            test_p101_format_signed_char(env, err);
+        }
+        if(!native_child_process)
+        {
+            test_p101_format_uint16_t(env, err);
+        }
+        if(!native_child_process)
+        {
+            test_p101_format_uint32_t(env, err);
+        }
+        if(!native_child_process)
+        {
+            test_p101_format_uint64_t(env, err);
+        }
+        if(!native_child_process)
+        {
+            test_p101_format_uint8_t(env, err);
+        }
+        if(!native_child_process)
+        {
+            test_p101_format_unsigned_char(env, err);
+        }
+        if(!native_child_process)
+        {
+            test_p101_format_unsigned_int(env, err);
+        }
+        if(!native_child_process)
+        {
+            test_p101_format_unsigned_long(env, err);
+        }
+        if(!native_child_process)
+        {
+            test_p101_format_unsigned_long_long(env, err);
+        }
+        if(!native_child_process)
+        {
+            test_p101_format_unsigned_short(env, err);
+        }
+        if(!native_child_process)
+        {
+            test_p101_parse_char(env, err);
+        }
+        if(!native_child_process)
+        {
+            test_p101_parse_char_n(env, err);
+        }
+        if(!native_child_process)
+        {
+            test_p101_parse_char_prefix(env, err);
+        }
+        if(!native_child_process)
+        {
+            test_p101_parse_duration(env, err);
+        }
+        if(!native_child_process)
+        {
+            test_p101_parse_duration_timespec(env, err);
+        }
+        if(!native_child_process)
+        {
+            test_p101_parse_hex_id(env, err);
+        }
+        if(!native_child_process)
+        {
+            test_p101_parse_int(env, err);
+        }
+        if(!native_child_process)
+        {
+            test_p101_parse_int16_t(env, err);
+        }
+        if(!native_child_process)
+        {
+            test_p101_parse_int16_t_array(env, err);
+        }
+        if(!native_child_process)
+        {
+            test_p101_parse_int16_t_base(env, err);
+        }
+        if(!native_child_process)
+        {
+            test_p101_parse_int16_t_n(env, err);
+        }
+        if(!native_child_process)
+        {
+            test_p101_parse_int16_t_prefix(env, err);
+        }
+        if(!native_child_process)
+        {
+            test_p101_parse_int32_t(env, err);
+        }
+        if(!native_child_process)
+        {
+            test_p101_parse_int32_t_array(env, err);
+        }
+        if(!native_child_process)
+        {
+            test_p101_parse_int32_t_base(env, err);
+        }
+        if(!native_child_process)
+        {
+            test_p101_parse_int32_t_n(env, err);
+        }
+        if(!native_child_process)
+        {
+            test_p101_parse_int32_t_prefix(env, err);
+        }
+        if(!native_child_process)
         {
-            test_p101_parse_int16_t(env, err);
+            test_p101_parse_int64_t(env, err);
         }
         if(!native_child_process)
         {
-            test_p101_parse_int32_t(env, err);
+            test_p101_parse_int64_t_array(env, err);
         }
         if(!native_child_process)
         {
-            test_p101_parse_int64_t(env, err);
+            test_p101_parse_int64_t_base(env, err);
+        }
+        if(!native_child_process)
+        {
+            test_p101_parse_int64_t_list(env, err);
+        }
+        if(!native_child_process)
+        {
+            test_p101_parse_int64_t_n(env, err);
+        }
+        if(!native_child_process)
+        {
+            test_p101_parse_int64_t_prefix(env, err);
         }
         if(!native_child_process)
         {
             test_p101_parse_int8_t(env, err);
         }
         if(!native_child_process)
+        {
+            test_p101_parse_int8_t_array(env, err);
+        }
+        if(!native_child_process)
+        {
+            test_p101_parse_int8_t_base(env, err);
+        }
+        if(!native_child_process)
+        {
+            test_p101_parse_int8_t_n(env, err);
+        }
+        if(!native_child_process)
+        {
+            test_p101_parse_int8_t_prefix(env, err);
+        }
+        if(!native_child_process)
+        {
+            test_p101_parse_int_n(env, err);
+        }
+        if(!native_child_process)
+        {
+            test_p101_parse_int_prefix(env, err);
+        }
+        if(!native_child_process)
         {
             test_p101_parse_long(env, err);
         }
@@ -4867,10 +20227,34 @@ int main(void)
             test_p101_parse_long_long(env, err);
         }
         if(!native_child_process)
+        {
+            test_p101_parse_long_long_n(env, err);
+        }
+        if(!native_child_process)
+        {
+            test_p101_parse_long_long_prefix(env, err);
+        }
+        if(!native_child_process)
+        {
+            test_p101_parse_long_n(env, err);
+        }
+        if(!native_child_process)
+        {
+            test_p101_parse_long_prefix(env, err);
+        }
+        if(!native_child_process)
         {
             test_p101_parse_negative_char(env, err);
         }
         if(!native_child_process)
+        {
+            test_p101_parse_negative_char_n(env, err);
+        }
+        if(!native_child_process)
+        {
+            test_p101_parse_negative_char_prefix(env, err);
+        }
+        if(!native_child_process)
         {
             test_p101_parse_negative_int(env, err);
         }
@@ -4879,18 +20263,58 @@ int main(void)
             test_p101_parse_negative_int16_t(env, err);
         }
         if(!native_child_process)
+        {
+            test_p101_parse_negative_int16_t_n(env, err);
+        }
+        if(!native_child_process)
+        {
+            test_p101_parse_negative_int16_t_prefix(env, err);
+        }
+        if(!native_child_process)
         {
             test_p101_parse_negative_int32_t(env, err);
         }
         if(!native_child_process)
+        {
+            test_p101_parse_negative_int32_t_n(env, err);
+        }
+        if(!native_child_process)
+        {
+            test_p101_parse_negative_int32_t_prefix(env, err);
+        }
+        if(!native_child_process)
         {
             test_p101_parse_negative_int64_t(env, err);
         }
         if(!native_child_process)
+        {
+            test_p101_parse_negative_int64_t_n(env, err);
+        }
+        if(!native_child_process)
+        {
+            test_p101_parse_negative_int64_t_prefix(env, err);
+        }
+        if(!native_child_process)
         {
             test_p101_parse_negative_int8_t(env, err);
         }
         if(!native_child_process)
+        {
+            test_p101_parse_negative_int8_t_n(env, err);
+        }
+        if(!native_child_process)
+        {
+            test_p101_parse_negative_int8_t_prefix(env, err);
+        }
+        if(!native_child_process)
+        {
+            test_p101_parse_negative_int_n(env, err);
+        }
+        if(!native_child_process)
+        {
+            test_p101_parse_negative_int_prefix(env, err);
+        }
+        if(!native_child_process)
         {
             test_p101_parse_negative_long(env, err);
         }
@@ -4899,14 +20323,46 @@ int main(void)
             test_p101_parse_negative_long_long(env, err);
         }
         if(!native_child_process)
+        {
+            test_p101_parse_negative_long_long_n(env, err);
+        }
+        if(!native_child_process)
+        {
+            test_p101_parse_negative_long_long_prefix(env, err);
+        }
+        if(!native_child_process)
+        {
+            test_p101_parse_negative_long_n(env, err);
+        }
+        if(!native_child_process)
+        {
+            test_p101_parse_negative_long_prefix(env, err);
+        }
+        if(!native_child_process)
         {
             test_p101_parse_negative_short(env, err);
         }
         if(!native_child_process)
+        {
+            test_p101_parse_negative_short_n(env, err);
+        }
+        if(!native_child_process)
+        {
+            test_p101_parse_negative_short_prefix(env, err);
+        }
+        if(!native_child_process)
         {
             test_p101_parse_positive_char(env, err);
         }
         if(!native_child_process)
+        {
+            test_p101_parse_positive_char_n(env, err);
+        }
+        if(!native_child_process)
+        {
+            test_p101_parse_positive_char_prefix(env, err);
+        }
+        if(!native_child_process)
         {
             test_p101_parse_positive_int(env, err);
         }
@@ -4915,18 +20371,58 @@ int main(void)
             test_p101_parse_positive_int16_t(env, err);
         }
         if(!native_child_process)
+        {
+            test_p101_parse_positive_int16_t_n(env, err);
+        }
+        if(!native_child_process)
+        {
+            test_p101_parse_positive_int16_t_prefix(env, err);
+        }
+        if(!native_child_process)
         {
             test_p101_parse_positive_int32_t(env, err);
         }
         if(!native_child_process)
+        {
+            test_p101_parse_positive_int32_t_n(env, err);
+        }
+        if(!native_child_process)
+        {
+            test_p101_parse_positive_int32_t_prefix(env, err);
+        }
+        if(!native_child_process)
         {
             test_p101_parse_positive_int64_t(env, err);
         }
         if(!native_child_process)
+        {
+            test_p101_parse_positive_int64_t_n(env, err);
+        }
+        if(!native_child_process)
+        {
+            test_p101_parse_positive_int64_t_prefix(env, err);
+        }
+        if(!native_child_process)
         {
             test_p101_parse_positive_int8_t(env, err);
         }
         if(!native_child_process)
+        {
+            test_p101_parse_positive_int8_t_n(env, err);
+        }
+        if(!native_child_process)
+        {
+            test_p101_parse_positive_int8_t_prefix(env, err);
+        }
+        if(!native_child_process)
+        {
+            test_p101_parse_positive_int_n(env, err);
+        }
+        if(!native_child_process)
+        {
+            test_p101_parse_positive_int_prefix(env, err);
+        }
+        if(!native_child_process)
         {
             test_p101_parse_positive_long(env, err);
         }
@@ -4935,38 +20431,178 @@ int main(void)
             test_p101_parse_positive_long_long(env, err);
         }
         if(!native_child_process)
+        {
+            test_p101_parse_positive_long_long_n(env, err);
+        }
+        if(!native_child_process)
+        {
+            test_p101_parse_positive_long_long_prefix(env, err);
+        }
+        if(!native_child_process)
+        {
+            test_p101_parse_positive_long_n(env, err);
+        }
+        if(!native_child_process)
+        {
+            test_p101_parse_positive_long_prefix(env, err);
+        }
+        if(!native_child_process)
         {
             test_p101_parse_positive_short(env, err);
         }
         if(!native_child_process)
+        {
+            test_p101_parse_positive_short_n(env, err);
+        }
+        if(!native_child_process)
+        {
+            test_p101_parse_positive_short_prefix(env, err);
+        }
+        if(!native_child_process)
         {
             test_p101_parse_short(env, err);
         }
         if(!native_child_process)
+        {
+            test_p101_parse_short_n(env, err);
+        }
+        if(!native_child_process)
+        {
+            test_p101_parse_short_prefix(env, err);
+        }
+        if(!native_child_process)
+        {
+            test_p101_parse_uint128(env, err);
+        }
+        if(!native_child_process)
+        {
+            test_p101_parse_uint128_base(env, err);
+        }
+        if(!native_child_process)
         {
             test_p101_parse_uint16_t(env, err);
         }
         if(!native_child_process)
+        {
+            test_p101_parse_uint16_t_array(env, err);
+        }
+        if(!native_child_process)
+        {
+            test_p101_parse_uint16_t_base(env, err);
+        }
+        if(!native_child_process)
+        {
+            test_p101_parse_uint16_t_n(env, err);
+        }
+        if(!native_child_process)
+        {
+            test_p101_parse_uint16_t_prefix(env, err);
+        }
+        if(!native_child_process)
+        {
+            test_p101_parse_uint16_t_size(env, err);
+        }
+        if(!native_child_process)
         {
             test_p101_parse_uint32_t(env, err);
         }
         if(!native_child_process)
+        {
+            test_p101_parse_uint32_t_array(env, err);
+        }
+        if(!native_child_process)
+        {
+            test_p101_parse_uint32_t_base(env, err);
+        }
+        if(!native_child_process)
+        {
+            test_p101_parse_uint32_t_n(env, err);
+        }
+        if(!native_child_process)
+        {
+            test_p101_parse_uint32_t_prefix(env, err);
+        }
+        if(!native_child_process)
+        {
+            test_p101_parse_uint32_t_size(env, err);
+        }
+        if(!native_child_process)
         {
             test_p101_parse_uint64_t(env, err);
         }
         if(!native_child_process)
+        {
+            test_p101_parse_uint64_t_array(env, err);
+        }
+        if(!native_child_process)
+        {
+            test_p101_parse_uint64_t_base(env, err);
+        }
+        if(!native_child_process)
+        {
+            test_p101_parse_uint64_t_list(env, err);
+        }
+        if(!native_child_process)
+        {
+            test_p101_parse_uint64_t_n(env, err);
+        }
+        if(!native_child_process)
+        {
+            test_p101_parse_uint64_t_prefix(env, err);
+        }
+        if(!native_child_process)
+        {
+            test_p101_parse_uint64_t_size(env, err);
+        }
+        if(!native_child_process)
         {
             test_p101_parse_uint8_t(env, err);
         }
         if(!native_child_process)
+        {
+            test_p101_parse_uint8_t_array(env, err);
+        }
+        if(!native_child_process)
+        {
+            test_p101_parse_uint8_t_base(env, err);
+        }
+        if(!native_child_process)
+        {
+            test_p101_parse_uint8_t_n(env, err);
+        }
+        if(!native_child_process)
+        {
+            test_p101_parse_uint8_t_prefix(env, err);
+        }
+        if(!native_child_process)
+        {
+            test_p101_parse_uint8_t_size(env, err);
+        }
+        if(!native_child_process)
         {
             test_p101_parse_unsigned_char(env, err);
         }
         if(!native_child_process)
+        {
+            test_p101_parse_unsigned_char_n(env, err);
+        }
+        if(!native_child_process)
+        {
+            test_p101_parse_unsigned_char_prefix(env, err);
+        }
+        if(!native_child_process)
         {
             test_p101_parse_unsigned_int(env, err);
         }
         if(!native_child_process)
+        {
+            test_p101_parse_unsigned_int_n(env, err);
+        }
+        if(!native_child_process)
+        {
+            test_p101_parse_unsigned_int_prefix(env, err);
+        }
+        if(!native_child_process)
         {
             test_p101_parse_unsigned_long(env, err);
         }
@@ -4975,9 +20611,33 @@ int main(void)
             test_p101_parse_unsigned_long_long(env, err);
         }
         if(!native_child_process)
+        {
+            test_p101_parse_unsigned_long_long_n(env, err);
+        }
+        if(!native_child_process)
+        {
+            test_p101_parse_unsigned_long_long_prefix(env, err);
+        }
+        if(!native_child_process)
+        {
+            test_p101_parse_unsigned_long_n(env, err);
+        }
+        if(!native_child_process)
+        {
+            test_p101_parse_unsigned_long_prefix(env, err);
+        }
+        if(!native_child_process)
         {
             test_p101_parse_unsigned_short(env, err);
         }
+        if(!native_child_process)
+        {
+            test_p101_parse_unsigned_short_n(env, err);
+        }
+        if(!native_child_process)
+        {
+            test_p101_parse_unsigned_short_prefix(env, err);
+        }
     }
     p101_env_destroy(env);
     p101_error_destroy(err);
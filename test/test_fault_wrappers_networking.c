@@ -9,7 +9,9 @@
 #include <math.h>
 #include <netinet/in.h>
 #include <p101_convert/errors.h>
+#include <p101_convert/floating.h>
 #include <p101_convert/integer.h>
+#include <p101_convert/lpm.h>
 #include <p101_convert/networking.h>
 #include <p101_env/env.h>
 #include <p101_error/error.h>
@@ -192,6 +194,136 @@ static void count_resource_event(const struct p101_env *env, p101_env_resource_k
     fault_resource_events++;
 }
 
+/* P101_TEST_CASE(p101_compact_address_to_sockaddr) */
+static void test_p101_compact_address_to_sockaddr(struct p101_env *env, struct p101_error *err)
+{
+#ifdef __linux__
+    static const int         errors[]      = {EIO};
+    static const char *const error_names[] = {"EIO"};
+#elif defined(__APPLE__)
+    static const int         errors[]      = {EIO};
+    static const char *const error_names[] = {"EIO"};
+#elif defined(__FreeBSD__)
+    static const int         errors[]      = {EIO};
+    static const char *const error_names[] = {"EIO"};
+#else
+    static const int         errors[]      = {EIO};
+    static const char *const error_names[] = {"EIO"};
+#endif
+
+    for(size_t index = 0U; index < sizeof(errors) / sizeof(errors[0]); index++)
+    {
+        struct fault_state state = {0, errors[index]};
+        int                failures_before;
+
+        failures_before = failures;
+        EXPECT(p101_error_has_no_error(err));
+        fault_resource_events = 0U;
+        errno                 = P101_TEST_ERRNO_SENTINEL;
+        p101_env_set_fault_injector(env, fail_next_call, &state);
+        socklen_t result = p101_compact_address_to_sockaddr(env, err, NULL, NULL);
+        (void)result;
+        EXPECT(state.checks == 1);
+        EXPECT(p101_error_is_errno(err, state.code));
+        EXPECT(errno == P101_TEST_ERRNO_SENTINEL);
+        EXPECT(result == (0));
+        EXPECT(fault_resource_events == 0U);
+        write_outcome("p101_compact_address_to_sockaddr", "errno", error_names[index], state.code, failures == failures_before);
+        p101_error_reset(err);
+    }
+    p101_env_set_fault_injector(env, NULL, NULL);
+    {
+        int   native_status = 0;
+        pid_t native_pid    = fork();
+
+        EXPECT(native_pid >= 0);
+        if(native_pid == 0)
+        {
+            bool               native_passed = true;
+            struct p101_error *native_err    = NULL;
+            struct p101_env   *native_env    = NULL;
+            FILE              *native_stdin_result;
+
+            native_child_process = true;
+            failures             = 0;
+            (void)alarm(2U);
+            if(unsetenv("P101_CALL_LOG") != 0 || unsetenv("P101_RESOURCE_LOG") != 0)
+            {
+                fprintf(stderr, "native setup failed: cannot clear p101 logging environment\n");
+                native_child_status = 77;
+                goto native_child_done_;
+            }
+            native_stdin_result = freopen("/dev/null", "r", stdin);
+            if(native_stdin_result == NULL)
+            {
+                fprintf(stderr, "native setup failed: cannot make standard input deterministic\n");
+                native_child_status = 77;
+                goto native_child_done_;
+            }
+            native_err = p101_error_create(false);
+            if(native_err == NULL)
+            {
+                native_child_status = 77;
+                goto native_child_done_;
+            }
+            native_env = p101_env_create(native_err, NULL);
+            if(native_env == NULL)
+            {
+                native_child_status = 77;
+                goto native_child_done_;
+            }
+            struct p101_compact_address native_argument_2 = {.family = P101_COMPACT_ADDRESS_IPV4};
+            struct sockaddr_storage     native_argument_3 = {0};
+            socklen_t                   native_result     = p101_compact_address_to_sockaddr(native_env, native_err, &native_argument_2, &native_argument_3);
+            (void)native_result;
+            if(p101_error_has_error(native_err))
+            {
+                bool native_error_declared = false;
+
+                for(size_t native_error_index = 0U; native_error_index < sizeof(errors) / sizeof(errors[0]); native_error_index++)
+                {
+                    if(p101_error_is_errno(native_err, errors[native_error_index]))
+                    {
+                        native_error_declared = true;
+                    }
+                }
+                if(!native_error_declared)
+                {
+                    fprintf(stderr, "native smoke produced an undeclared platform failure: p101_compact_address_to_sockaddr: %s\n", p101_error_get_message(native_err));
+                    native_passed = false;
+                }
+                p101_error_reset(native_err);
+            }
+            native_child_status = native_passed ? EXIT_SUCCESS : EXIT_FAILURE;
+        native_child_done_:
+            p101_env_destroy(native_env);
+            p101_error_destroy(native_err);
+        }
+        if(native_pid > 0)
+        {
+            EXPECT(native_waitpid_nointr(native_pid, &native_status) == native_pid);
+            if(WIFSIGNALED(native_status))
+            {
+                fprintf(stderr, "native smoke terminated by signal: p101_compact_address_to_sockaddr: %d\n", WTERMSIG(native_status));
+            }
+            EXPECT(WIFEXITED(native_status));
+            if(WIFEXITED(native_status) && WEXITSTATUS(native_status) == 77)
+            {
+                fprintf(stderr, "native smoke fixture unavailable: p101_compact_address_to_sockaddr\n");
+            }
+            else if(WIFEXITED(native_status))
+            {
+                if(WEXITSTATUS(native_status) != EXIT_SUCCESS)
+                {
+                    fprintf(stderr, "native smoke exited unsuccessfully: p101_compact_address_to_sockaddr: %d\n", WEXITSTATUS(native_status));
+                }
+                EXPECT(WEXITSTATUS(native_status) == EXIT_SUCCESS);
+            }
+        }
+        p101_error_reset(err);
+    }
+}
+
 /* P101_TEST_CASE(p101_convert_address) */
 static void test_p101_convert_address(struct p101_env *env, struct p101_error *err)
 {
@@ -219,14 +351,662 @@ static void test_p101_convert_address(struct p101_env *env, struct p101_error *e
         fault_resource_events = 0U;
         errno                 = P101_TEST_ERRNO_SENTINEL;
         p101_env_set_fault_injector(env, fail_next_call, &state);
-        socklen_t result = p101_convert_address(env, err, NULL, NULL);
+        socklen_t result = p101_convert_address(env, err, NULL, NULL);
+        (void)result;
+        EXPECT(state.checks == 1);
+        EXPECT(p101_error_is_errno(err, state.code));
+        EXPECT(errno == P101_TEST_ERRNO_SENTINEL);
+        EXPECT(result == (0));
+        EXPECT(fault_resource_events == 0U);
+        write_outcome("p101_convert_address", "errno", error_names[index], state.code, failures == failures_before);
+        p101_error_reset(err);
+    }
+    p101_env_set_fault_injector(env, NULL, NULL);
+    {
+        int   native_status = 0;
+        pid_t native_pid    = fork();
+
+        EXPECT(native_pid >= 0);
+        if(native_pid == 0)
+        {
+            bool               native_passed = true;
+            struct p101_error *native_err    = NULL;
+            struct p101_env   *native_env    = NULL;
+            FILE              *native_stdin_result;
+
+            native_child_process = true;
+            failures             = 0;
+            (void)alarm(2U);
+            if(unsetenv("P101_CALL_LOG") != 0 || unsetenv("P101_RESOURCE_LOG") != 0)
+            {
+                fprintf(stderr, "native setup failed: cannot clear p101 logging environment\n");
+                native_child_status = 77;
+                goto native_child_done_;
+            }
+            native_stdin_result = freopen("/dev/null", "r", stdin);
+            if(native_stdin_result == NULL)
+            {
+                fprintf(stderr, "native setup failed: cannot make standard input deterministic\n");
+                native_child_status = 77;
+                goto native_child_done_;
+            }
+            native_err = p101_error_create(false);
+            if(native_err == NULL)
+            {
+                native_child_status = 77;
+                goto native_child_done_;
+            }
+            native_env = p101_env_create(native_err, NULL);
+            if(native_env == NULL)
+            {
+                native_child_status = 77;
+                goto native_child_done_;
+            }
+            struct sockaddr_storage native_argument_3 = {0};
+            socklen_t               native_result     = p101_convert_address(native_env, native_err, "127.0.0.1", &native_argument_3);
+            (void)native_result;
+            if(p101_error_has_error(native_err))
+            {
+                bool native_error_declared = false;
+
+                for(size_t native_error_index = 0U; native_error_index < sizeof(errors) / sizeof(errors[0]); native_error_index++)
+                {
+                    if(p101_error_is_errno(native_err, errors[native_error_index]))
+                    {
+                        native_error_declared = true;
+                    }
+                }
+                if(!native_error_declared)
+                {
+                    fprintf(stderr, "native smoke produced an undeclared platform failure: p101_convert_address: %s\n", p101_error_get_message(native_err));
+                    native_passed = false;
+                }
+                p101_error_reset(native_err);
+            }
+            native_child_status = native_passed ? EXIT_SUCCESS : EXIT_FAILURE;
+        native_child_done_:
+            p101_env_destroy(native_env);
+            p101_error_destroy(native_err);
+        }
+        if(native_pid > 0)
+        {
+            EXPECT(native_waitpid_nointr(native_pid, &native_status) == native_pid);
+            if(WIFSIGNALED(native_status))
+            {
+                fprintf(stderr, "native smoke terminated by signal: p101_convert_address: %d\n", WTERMSIG(native_status));
+            }
+            EXPECT(WIFEXITED(native_status));
+            if(WIFEXITED(native_status) && WEXITSTATUS(native_status) == 77)
+            {
+                fprintf(stderr, "native smoke fixture unavailable: p101_convert_address\n");
+            }
+            else if(WIFEXITED(native_status))
+            {
+                if(WEXITSTATUS(native_status) != EXIT_SUCCESS)
+                {
+                    fprintf(stderr, "native smoke exited unsuccessfully: p101_convert_address: %d\n", WEXITSTATUS(native_status));
+                }
+                EXPECT(WEXITSTATUS(native_status) == EXIT_SUCCESS);
+            }
+        }
+        p101_error_reset(err);
+    }
+}
+
+/* P101_TEST_CASE(p101_convert_address_array) */
+static void test_p101_convert_address_array(struct p101_env *env, struct p101_error *err)
+{
+#ifdef __linux__
+    static const int         errors[]      = {EIO};
+    static const char *const error_names[] = {"EIO"};
+#elif defined(__APPLE__)
+    static const int         errors[]      = {EIO};
+    static const char *const error_names[] = {"EIO"};
+#elif defined(__FreeBSD__)
+    static const int         errors[]      = {EIO};
+    static const char *const error_names[] = {"EIO"};
+#else
+    static const int         errors[]      = {EIO};
+    static const char *const error_names[] = {"EIO"};
+#endif
+
+    for(size_t index = 0U; index < sizeof(errors) / sizeof(errors[0]); index++)
+    {
+        struct fault_state state = {0, errors[index]};
+        int                failures_before;
+
+        failures_before = failures;
+        EXPECT(p101_error_has_no_error(err));
+        fault_resource_events = 0U;
+        errno                 = P101_TEST_ERRNO_SENTINEL;
+        p101_env_set_fault_injector(env, fail_next_call, &state);
+        size_t result = p101_convert_address_array(env, err, NULL, 0, NULL, NULL, NULL);
+        (void)result;
+        EXPECT(state.checks == 1);
+        EXPECT(p101_error_is_errno(err, state.code));
+        EXPECT(errno == P101_TEST_ERRNO_SENTINEL);
+        EXPECT(result == (0));
+        EXPECT(fault_resource_events == 0U);
+        write_outcome("p101_convert_address_array", "errno", error_names[index], state.code, failures == failures_before);
+        p101_error_reset(err);
+    }
+    p101_env_set_fault_injector(env, NULL, NULL);
+    {
+        int   native_status = 0;
+        pid_t native_pid    = fork();
+
+        EXPECT(native_pid >= 0);
+        if(native_pid == 0)
+        {
+            bool               native_passed = true;
+            struct p101_error *native_err    = NULL;
+            struct p101_env   *native_env    = NULL;
+            FILE              *native_stdin_result;
+
+            native_child_process = true;
+            failures             = 0;
+            (void)alarm(2U);
+            if(unsetenv("P101_CALL_LOG") != 0 || unsetenv("P101_RESOURCE_LOG") != 0)
+            {
+                fprintf(stderr, "native setup failed: cannot clear p101 logging environment\n");
+                native_child_status = 77;
+                goto native_child_done_;
+            }
+            native_stdin_result = freopen("/dev/null", "r", stdin);
+            if(native_stdin_result == NULL)
+            {
+                fprintf(stderr, "native setup failed: cannot make standard input deterministic\n");
+                native_child_status = 77;
+                goto native_child_done_;
+            }
+            native_err = p101_error_create(false);
+            if(native_err == NULL)
+            {
+                native_child_status = 77;
+                goto native_child_done_;
+            }
+            native_env = p101_env_create(native_err, NULL);
+            if(native_env == NULL)
+            {
+                native_child_status = 77;
+                goto native_child_done_;
+            }
+            const char *const       native_argument_2[]  = {"127.0.0.1"};
+            struct sockaddr_storage native_argument_4[1] = {0};
+            socklen_t               native_argument_5[1] = {0};
+            uint8_t                 native_argument_6[1] = {0};
+            size_t                  native_result        = p101_convert_address_array(native_env, native_err, native_argument_2, 1, native_argument_4, native_argument_5, native_argument_6);
+            (void)native_result;
+            if(p101_error_has_error(native_err))
+            {
+                bool native_error_declared = false;
+
+                for(size_t native_error_index = 0U; native_error_index < sizeof(errors) / sizeof(errors[0]); native_error_index++)
+                {
+                    if(p101_error_is_errno(native_err, errors[native_error_index]))
+                    {
+                        native_error_declared = true;
+                    }
+                }
+                if(!native_error_declared)
+                {
+                    fprintf(stderr, "native smoke produced an undeclared platform failure: p101_convert_address_array: %s\n", p101_error_get_message(native_err));
+                    native_passed = false;
+                }
+                p101_error_reset(native_err);
+            }
+            native_child_status = native_passed ? EXIT_SUCCESS : EXIT_FAILURE;
+        native_child_done_:
+            p101_env_destroy(native_env);
+            p101_error_destroy(native_err);
+        }
+        if(native_pid > 0)
+        {
+            EXPECT(native_waitpid_nointr(native_pid, &native_status) == native_pid);
+            if(WIFSIGNALED(native_status))
+            {
+                fprintf(stderr, "native smoke terminated by signal: p101_convert_address_array: %d\n", WTERMSIG(native_status));
+            }
+            EXPECT(WIFEXITED(native_status));
+            if(WIFEXITED(native_status) && WEXITSTATUS(native_status) == 77)
+            {
+                fprintf(stderr, "native smoke fixture unavailable: p101_convert_address_array\n");
+            }
+            else if(WIFEXITED(native_status))
+            {
+                if(WEXITSTATUS(native_status) != EXIT_SUCCESS)
+                {
+                    fprintf(stderr, "native smoke exited unsuccessfully: p101_convert_address_array: %d\n", WEXITSTATUS(native_status));
+                }
+                EXPECT(WEXITSTATUS(native_status) == EXIT_SUCCESS);
+            }
+        }
+        p101_error_reset(err);
+    }
+}
+
+/* P101_TEST_CASE(p101_convert_cidr) */
+static void test_p101_convert_cidr(struct p101_env *env, struct p101_error *err)
+{
+#ifdef __linux__
+    static const int         errors[]      = {EIO};
+    static const char *const error_names[] = {"EIO"};
+#elif defined(__APPLE__)
+    static const int         errors[]      = {EIO};
+    static const char *const error_names[] = {"EIO"};
+#elif defined(__FreeBSD__)
+    static const int         errors[]      = {EIO};
+    static const char *const error_names[] = {"EIO"};
+#else
+    static const int         errors[]      = {EIO};
+    static const char *const error_names[] = {"EIO"};
+#endif
+
+    for(size_t index = 0U; index < sizeof(errors) / sizeof(errors[0]); index++)
+    {
+        struct fault_state state = {0, errors[index]};
+        int                failures_before;
+
+        failures_before = failures;
+        EXPECT(p101_error_has_no_error(err));
+        fault_resource_events = 0U;
+        errno                 = P101_TEST_ERRNO_SENTINEL;
+        p101_env_set_fault_injector(env, fail_next_call, &state);
+        bool result = p101_convert_cidr(env, err, NULL, false, NULL);
+        (void)result;
+        EXPECT(state.checks == 1);
+        EXPECT(p101_error_is_errno(err, state.code));
+        EXPECT(errno == P101_TEST_ERRNO_SENTINEL);
+        EXPECT(result == (false));
+        EXPECT(fault_resource_events == 0U);
+        write_outcome("p101_convert_cidr", "errno", error_names[index], state.code, failures == failures_before);
+        p101_error_reset(err);
+    }
+    p101_env_set_fault_injector(env, NULL, NULL);
+    {
+        int   native_status = 0;
+        pid_t native_pid    = fork();
+
+        EXPECT(native_pid >= 0);
+        if(native_pid == 0)
+        {
+            bool               native_passed = true;
+            struct p101_error *native_err    = NULL;
+            struct p101_env   *native_env    = NULL;
+            FILE              *native_stdin_result;
+
+            native_child_process = true;
+            failures             = 0;
+            (void)alarm(2U);
+            if(unsetenv("P101_CALL_LOG") != 0 || unsetenv("P101_RESOURCE_LOG") != 0)
+            {
+                fprintf(stderr, "native setup failed: cannot clear p101 logging environment\n");
+                native_child_status = 77;
+                goto native_child_done_;
+            }
+            native_stdin_result = freopen("/dev/null", "r", stdin);
+            if(native_stdin_result == NULL)
+            {
+                fprintf(stderr, "native setup failed: cannot make standard input deterministic\n");
+                native_child_status = 77;
+                goto native_child_done_;
+            }
+            native_err = p101_error_create(false);
+            if(native_err == NULL)
+            {
+                native_child_status = 77;
+                goto native_child_done_;
+            }
+            native_env = p101_env_create(native_err, NULL);
+            if(native_env == NULL)
+            {
+                native_child_status = 77;
+                goto native_child_done_;
+            }
+            struct p101_cidr native_argument_4 = {0};
+            bool             native_result     = p101_convert_cidr(native_env, native_err, "10.0.0.0/8", true, &native_argument_4);
+            (void)native_result;
+            if(p101_error_has_error(native_err))
+            {
+                bool native_error_declared = false;
+
+                for(size_t native_error_index = 0U; native_error_index < sizeof(errors) / sizeof(errors[0]); native_error_index++)
+                {
+                    if(p101_error_is_errno(native_err, errors[native_error_index]))
+                    {
+                        native_error_declared = true;
+                    }
+                }
+                if(!native_error_declared)
+                {
+                    fprintf(stderr, "native smoke produced an undeclared platform failure: p101_convert_cidr: %s\n", p101_error_get_message(native_err));
+                    native_passed = false;
+                }
+                p101_error_reset(native_err);
+            }
+            native_child_status = native_passed ? EXIT_SUCCESS : EXIT_FAILURE;
+        native_child_done_:
+            p101_env_destroy(native_env);
+            p101_error_destroy(native_err);
+        }
+        if(native_pid > 0)
+        {
+            EXPECT(native_waitpid_nointr(native_pid, &native_status) == native_pid);
+            if(WIFSIGNALED(native_status))
+            {
+                fprintf(stderr, "native smoke terminated by signal: p101_convert_cidr: %d\n", WTERMSIG(native_status));
+            }
+            EXPECT(WIFEXITED(native_status));
+            if(WIFEXITED(native_status) && WEXITSTATUS(native_status) == 77)
+            {
+                fprintf(stderr, "native smoke fixture unavailable: p101_convert_cidr\n");
+            }
+            else if(WIFEXITED(native_status))
+            {
+                if(WEXITSTATUS(native_status) != EXIT_SUCCESS)
+                {
+                    fprintf(stderr, "native smoke exited unsuccessfully: p101_convert_cidr: %d\n", WEXITSTATUS(native_status));
+                }
+                EXPECT(WEXITSTATUS(native_status) == EXIT_SUCCESS);
+            }
+        }
+        p101_error_reset(err);
+    }
+}
+
+/* P101_TEST_CASE(p101_convert_compact_address) */
+static void test_p101_convert_compact_address(struct p101_env *env, struct p101_error *err)
+{
+#ifdef __linux__
+    static const int         errors[]      = {EIO};
+    static const char *const error_names[] = {"EIO"};
+#elif defined(__APPLE__)
+    static const int         errors[]      = {EIO};
+    static const char *const error_names[] = {"EIO"};
+#elif defined(__FreeBSD__)
+    static const int         errors[]      = {EIO};
+    static const char *const error_names[] = {"EIO"};
+#else
+    static const int         errors[]      = {EIO};
+    static const char *const error_names[] = {"EIO"};
+#endif
+
+    for(size_t index = 0U; index < sizeof(errors) / sizeof(errors[0]); index++)
+    {
+        struct fault_state state = {0, errors[index]};
+        int                failures_before;
+
+        failures_before = failures;
+        EXPECT(p101_error_has_no_error(err));
+        fault_resource_events = 0U;
+        errno                 = P101_TEST_ERRNO_SENTINEL;
+        p101_env_set_fault_injector(env, fail_next_call, &state);
+        bool result = p101_convert_compact_address(env, err, NULL, NULL);
+        (void)result;
+        EXPECT(state.checks == 1);
+        EXPECT(p101_error_is_errno(err, state.code));
+        EXPECT(errno == P101_TEST_ERRNO_SENTINEL);
+        EXPECT(result == (false));
+        EXPECT(fault_resource_events == 0U);
+        write_outcome("p101_convert_compact_address", "errno", error_names[index], state.code, failures == failures_before);
+        p101_error_reset(err);
+    }
+    p101_env_set_fault_injector(env, NULL, NULL);
+    {
+        int   native_status = 0;
+        pid_t native_pid    = fork();
+
+        EXPECT(native_pid >= 0);
+        if(native_pid == 0)
+        {
+            bool               native_passed = true;
+            struct p101_error *native_err    = NULL;
+            struct p101_env   *native_env    = NULL;
+            FILE              *native_stdin_result;
+
+            native_child_process = true;
+            failures             = 0;
+            (void)alarm(2U);
+            if(unsetenv("P101_CALL_LOG") != 0 || unsetenv("P101_RESOURCE_LOG") != 0)
+            {
+                fprintf(stderr, "native setup failed: cannot clear p101 logging environment\n");
+                native_child_status = 77;
+                goto native_child_done_;
+            }
+            native_stdin_result = freopen("/dev/null", "r", stdin);
+            if(native_stdin_result == NULL)
+            {
+                fprintf(stderr, "native setup failed: cannot make standard input deterministic\n");
+                native_child_status = 77;
+                goto native_child_done_;
+            }
+            native_err = p101_error_create(false);
+            if(native_err == NULL)
+            {
+                native_child_status = 77;
+                goto native_child_done_;
+            }
+            native_env = p101_env_create(native_err, NULL);
+            if(native_env == NULL)
+            {
+                native_child_status = 77;
+                goto native_child_done_;
+            }
+            struct p101_compact_address native_argument_3 = {0};
+            bool                        native_result     = p101_convert_compact_address(native_env, native_err, "127.0.0.1", &native_argument_3);
+            (void)native_result;
+            if(p101_error_has_error(native_err))
+            {
+                bool native_error_declared = false;
+
+                for(size_t native_error_index = 0U; native_error_index < sizeof(errors) / sizeof(errors[0]); native_error_index++)
+                {
+                    if(p101_error_is_errno(native_err, errors[native_error_index]))
+                    {
+                        native_error_declared = true;
+                    }
+                }
+                if(!native_error_declared)
+                {
+                    fprintf(stderr, "native smoke produced an undeclared platform failure: p101_convert_compact_address: %s\n", p101_error_get_message(native_err));
+                    native_passed = false;
+                }
+                p101_error_reset(native_err);
+            }
+            native_child_status = native_passed ? EXIT_SUCCESS : EXIT_FAILURE;
+        native_child_done_:
+            p101_env_destroy(native_env);
+            p101_error_destroy(native_err);
+        }
+        if(native_pid > 0)
+        {
+            EXPECT(native_waitpid_nointr(native_pid, &native_status) == native_pid);
+            if(WIFSIGNALED(native_status))
+            {
+                fprintf(stderr, "native smoke terminated by signal: p101_convert_compact_address: %d\n", WTERMSIG(native_status));
+            }
+            EXPECT(WIFEXITED(native_status));
+            if(WIFEXITED(native_status) && WEXITSTATUS(native_status) == 77)
+            {
+                fprintf(stderr, "native smoke fixture unavailable: p101_convert_compact_address\n");
+            }
+            else if(WIFEXITED(native_status))
+            {
+                if(WEXITSTATUS(native_status) != EXIT_SUCCESS)
+                {
+                    fprintf(stderr, "native smoke exited unsuccessfully: p101_convert_compact_address: %d\n", WEXITSTATUS(native_status));
+                }
+                EXPECT(WEXITSTATUS(native_status) == EXIT_SUCCESS);
+            }
+        }
+        p101_error_reset(err);
+    }
+}
+
+/* P101_TEST_CASE(p101_convert_endpoint) */
+static void test_p101_convert_endpoint(struct p101_env *env, struct p101_error *err)
+{
+#ifdef __linux__
+    static const int         errors[]      = {EIO};
+    static const char *const error_names[] = {"EIO"};
+#elif defined(__APPLE__)
+    static const int         errors[]      = {EIO};
+    static const char *const error_names[] = {"EIO"};
+#elif defined(__FreeBSD__)
+    static const int         errors[]      = {EIO};
+    static const char *const error_names[] = {"EIO"};
+#else
+    static const int         errors[]      = {EIO};
+    static const char *const error_names[] = {"EIO"};
+#endif
+
+    for(size_t index = 0U; index < sizeof(errors) / sizeof(errors[0]); index++)
+    {
+        struct fault_state state = {0, errors[index]};
+        int                failures_before;
+
+        failures_before = failures;
+        EXPECT(p101_error_has_no_error(err));
+        fault_resource_events = 0U;
+        errno                 = P101_TEST_ERRNO_SENTINEL;
+        p101_env_set_fault_injector(env, fail_next_call, &state);
+        socklen_t result = p101_convert_endpoint(env, err, NULL, 0, NULL);
+        (void)result;
+        EXPECT(state.checks == 1);
+        EXPECT(p101_error_is_errno(err, state.code));
+        EXPECT(errno == P101_TEST_ERRNO_SENTINEL);
+        EXPECT(result == (0));
+        EXPECT(fault_resource_events == 0U);
+        write_outcome("p101_convert_endpoint", "errno", error_names[index], state.code, failures == failures_before);
+        p101_error_reset(err);
+    }
+    p101_env_set_fault_injector(env, NULL, NULL);
+    {
+        int   native_status = 0;
+        pid_t native_pid    = fork();
+
+        EXPECT(native_pid >= 0);
+        if(native_pid == 0)
+        {
+            bool               native_passed = true;
+            struct p101_error *native_err    = NULL;
+            struct p101_env   *native_env    = NULL;
+            FILE              *native_stdin_result;
+
+            native_child_process = true;
+            failures             = 0;
+            (void)alarm(2U);
+            if(unsetenv("P101_CALL_LOG") != 0 || unsetenv("P101_RESOURCE_LOG") != 0)
+            {
+                fprintf(stderr, "native setup failed: cannot clear p101 logging environment\n");
+                native_child_status = 77;
+                goto native_child_done_;
+            }
+            native_stdin_result = freopen("/dev/null", "r", stdin);
+            if(native_stdin_result == NULL)
+            {
+                fprintf(stderr, "native setup failed: cannot make standard input deterministic\n");
+                native_child_status = 77;
+                goto native_child_done_;
+            }
+            native_err = p101_error_create(false);
+            if(native_err == NULL)
+            {
+                native_child_status = 77;
+                goto native_child_done_;
+            }
+            native_env = p101_env_create(native_err, NULL);
+            if(native_env == NULL)
+            {
+                native_child_status = 77;
+                goto native_child_done_;
+            }
+            struct sockaddr_storage native_argument_4 = {0};
+            socklen_t               native_result     = p101_convert_endpoint(native_env, native_err, "127.0.0.1:80", 12, &native_argument_4);
+            (void)native_result;
+            if(p101_error_has_error(native_err))
+            {
+                bool native_error_declared = false;
+
+                for(size_t native_error_index = 0U; native_error_index < sizeof(errors) / sizeof(errors[0]); native_error_index++)
+                {
+                    if(p101_error_is_errno(native_err, errors[native_error_index]))
+                    {
+                        native_error_declared = true;
+                    }
+                }
+                if(!native_error_declared)
+                {
+                    fprintf(stderr, "native smoke produced an undeclared platform failure: p101_convert_endpoint: %s\n", p101_error_get_message(native_err));
+                    native_passed = false;
+                }
+                p101_error_reset(native_err);
+            }
+            native_child_status = native_passed ? EXIT_SUCCESS : EXIT_FAILURE;
+        native_child_done_:
+            p101_env_destroy(native_env);
+            p101_error_destroy(native_err);
+        }
+        if(native_pid > 0)
+        {
+            EXPECT(native_waitpid_nointr(native_pid, &native_status) == native_pid);
+            if(WIFSIGNALED(native_status))
+            {
+                fprintf(stderr, "native smoke terminated by signal: p101_convert_endpoint: %d\n", WTERMSIG(native_status));
+            }
+            EXPECT(WIFEXITED(native_status));
+            if(WIFEXITED(native_status) && WEXITSTATUS(native_status) == 77)
+            {
+                fprintf(stderr, "native smoke fixture unavailable: p101_convert_endpoint\n");
+            }
+            else if(WIFEXITED(native_status))
+            {
+                if(WEXITSTATUS(native_status) != EXIT_SUCCESS)
+                {
+                    fprintf(stderr, "native smoke exited unsuccessfully: p101_convert_endpoint: %d\n", WEXITSTATUS(native_status));
+                }
+                EXPECT(WEXITSTATUS(native_status) == EXIT_SUCCESS);
+            }
+        }
+        p101_error_reset(err);
+    }
+}
+
+/* P101_TEST_CASE(p101_format_address) */
+static void test_p101_format_address(struct p101_env *env, struct p101_error *err)
+{
+#ifdef __linux__
+    static const int         errors[]      = {EIO};
+    static const char *const error_names[] = {"EIO"};
+#elif defined(__APPLE__)
+    static const int         errors[]      = {EIO};
+    static const char *const error_names[] = {"EIO"};
+#elif defined(__FreeBSD__)
+    static const int         errors[]      = {EIO};
+    static const char *const error_names[] = {"EIO"};
+#else
+    static const int         errors[]      = {EIO};
+    static const char *const error_names[] = {"EIO"};
+#endif
+
+    for(size_t index = 0U; index < sizeof(errors) / sizeof(errors[0]); index++)
+    {
+        struct fault_state state = {0, errors[index]};
+        int                failures_before;
+
+        failures_before = failures;
+        EXPECT(p101_error_has_no_error(err));
+        fault_resource_events = 0U;
+        errno                 = P101_TEST_ERRNO_SENTINEL;
+        p101_env_set_fault_injector(env, fail_next_call, &state);
+        size_t result = p101_format_address(env, err, NULL, NULL, 0);
         (void)result;
         EXPECT(state.checks == 1);
         EXPECT(p101_error_is_errno(err, state.code));
         EXPECT(errno == P101_TEST_ERRNO_SENTINEL);
         EXPECT(result == (0));
         EXPECT(fault_resource_events == 0U);
-        write_outcome("p101_convert_address", "errno", error_names[index], state.code, failures == failures_before);
+        write_outcome("p101_format_address", "errno", error_names[index], state.code, failures == failures_before);
         p101_error_reset(err);
     }
     p101_env_set_fault_injector(env, NULL, NULL);
@@ -270,8 +1050,9 @@ static void test_p101_convert_address(struct p101_env *env, struct p101_error *e
                 native_child_status = 77;
                 goto native_child_done_;
             }
-            struct sockaddr_storage native_argument_3 = {0};
-            socklen_t               native_result     = p101_convert_address(native_env, native_err, "127.0.0.1", &native_argument_3);
+            struct sockaddr_in native_argument_2                          = {.sin_family = AF_INET};
+            char               native_argument_3[P101_ENDPOINT_TEXT_SIZE] = {0};
+            size_t             native_result                              = p101_format_address(native_env, native_err, (const struct sockaddr *)&native_argument_2, native_argument_3, sizeof(native_argument_3));
             (void)native_result;
             if(p101_error_has_error(native_err))
             {
@@ -286,7 +1067,7 @@ static void test_p101_convert_address(struct p101_env *env, struct p101_error *e
                 }
                 if(!native_error_declared)
                 {
-                    fprintf(stderr, "native smoke produced an undeclared platform failure: p101_convert_address: %s\n", p101_error_get_message(native_err));
+                    fprintf(stderr, "native smoke produced an undeclared platform failure: p101_format_address: %s\n", p101_error_get_message(native_err));
                     native_passed = false;
                 }
                 p101_error_reset(native_err);
@@ -301,18 +1082,148 @@ static void test_p101_convert_address(struct p101_env *env, struct p101_error *e
             EXPECT(native_waitpid_nointr(native_pid, &native_status) == native_pid);
             if(WIFSIGNALED(native_status))
             {
-                fprintf(stderr, "native smoke terminated by signal: p101_convert_address: %d\n", WTERMSIG(native_status));
+                fprintf(stderr, "native smoke terminated by signal: p101_format_address: %d\n", WTERMSIG(native_status));
             }
             EXPECT(WIFEXITED(native_status));
             if(WIFEXITED(native_status) && WEXITSTATUS(native_status) == 77)
             {
-                fprintf(stderr, "native smoke fixture unavailable: p101_convert_address\n");
+                fprintf(stderr, "native smoke fixture unavailable: p101_format_address\n");
             }
             else if(WIFEXITED(native_status))
             {
                 if(WEXITSTATUS(native_status) != EXIT_SUCCESS)
                 {
-                    fprintf(stderr, "native smoke exited unsuccessfully: p101_convert_address: %d\n", WEXITSTATUS(native_status));
+                    fprintf(stderr, "native smoke exited unsuccessfully: p101_format_address: %d\n", WEXITSTATUS(native_status));
+                }
+                EXPECT(WEXITSTATUS(native_status) == EXIT_SUCCESS);
+            }
+        }
+        p101_error_reset(err);
+    }
+}
+
+/* P101_TEST_CASE(p101_format_endpoint) */
+static void test_p101_format_endpoint(struct p101_env *env, struct p101_error *err)
+{
+#ifdef __linux__
+    static const int         errors[]      = {EIO};
+    static const char *const error_names[] = {"EIO"};
+#elif defined(__APPLE__)
+    static const int         errors[]      = {EIO};
+    static const char *const error_names[] = {"EIO"};
+#elif defined(__FreeBSD__)
+    static const int         errors[]      = {EIO};
+    static const char *const error_names[] = {"EIO"};
+#else
+    static const int         errors[]      = {EIO};
+    static const char *const error_names[] = {"EIO"};
+#endif
+
+    for(size_t index = 0U; index < sizeof(errors) / sizeof(errors[0]); index++)
+    {
+        struct fault_state state = {0, errors[index]};
+        int                failures_before;
+
+        failures_before = failures;
+        EXPECT(p101_error_has_no_error(err));
+        fault_resource_events = 0U;
+        errno                 = P101_TEST_ERRNO_SENTINEL;
+        p101_env_set_fault_injector(env, fail_next_call, &state);
+        size_t result = p101_format_endpoint(env, err, NULL, NULL, 0);
+        (void)result;
+        EXPECT(state.checks == 1);
+        EXPECT(p101_error_is_errno(err, state.code));
+        EXPECT(errno == P101_TEST_ERRNO_SENTINEL);
+        EXPECT(result == (0));
+        EXPECT(fault_resource_events == 0U);
+        write_outcome("p101_format_endpoint", "errno", error_names[index], state.code, failures == failures_before);
+        p101_error_reset(err);
+    }
+    p101_env_set_fault_injector(env, NULL, NULL);
+    {
+        int   native_status = 0;
+        pid_t native_pid    = fork();
+
+        EXPECT(native_pid >= 0);
+        if(native_pid == 0)
+        {
+            bool               native_passed = true;
+            struct p101_error *native_err    = NULL;
+            struct p101_env   *native_env    = NULL;
+            FILE              *native_stdin_result;
+
+            native_child_process = true;
+            failures             = 0;
+            (void)alarm(2U);
+            if(unsetenv("P101_CALL_LOG") != 0 || unsetenv("P101_RESOURCE_LOG") != 0)
+            {
+                fprintf(stderr, "native setup failed: cannot clear p101 logging environment\n");
+                native_child_status = 77;
+                goto native_child_done_;
+            }
+            native_stdin_result = freopen("/dev/null", "r", stdin);
+            if(native_stdin_result == NULL)
+            {
+                fprintf(stderr, "native setup failed: cannot make standard input deterministic\n");
+                native_child_status = 77;
+                goto native_child_done_;
+            }
+            native_err = p101_error_create(false);
+            if(native_err == NULL)
+            {
+                native_child_status = 77;
+                goto native_child_done_;
+            }
+            native_env = p101_env_create(native_err, NULL);
+            if(native_env == NULL)
+            {
+                native_child_status = 77;
+                goto native_child_done_;
+            }
+            struct sockaddr_in native_argument_2                          = {.sin_family = AF_INET};
+            char               native_argument_3[P101_ENDPOINT_TEXT_SIZE] = {0};
+            size_t             native_result                              = p101_format_endpoint(native_env, native_err, (const struct sockaddr *)&native_argument_2, native_argument_3, sizeof(native_argument_3));
+            (void)native_result;
+            if(p101_error_has_error(native_err))
+            {
+                bool native_error_declared = false;
+
+                for(size_t native_error_index = 0U; native_error_index < sizeof(errors) / sizeof(errors[0]); native_error_index++)
+                {
+                    if(p101_error_is_errno(native_err, errors[native_error_index]))
+                    {
+                        native_error_declared = true;
+                    }
+                }
+                if(!native_error_declared)
+                {
+                    fprintf(stderr, "native smoke produced an undeclared platform failure: p101_format_endpoint: %s\n", p101_error_get_message(native_err));
+                    native_passed = false;
+                }
+                p101_error_reset(native_err);
+            }
+            native_child_status = native_passed ? EXIT_SUCCESS : EXIT_FAILURE;
+        native_child_done_:
+            p101_env_destroy(native_env);
+            p101_error_destroy(native_err);
+        }
+        if(native_pid > 0)
+        {
+            EXPECT(native_waitpid_nointr(native_pid, &native_status) == native_pid);
+            if(WIFSIGNALED(native_status))
+            {
+                fprintf(stderr, "native smoke terminated by signal: p101_format_endpoint: %d\n", WTERMSIG(native_status));
+            }
+            EXPECT(WIFEXITED(native_status));
+            if(WIFEXITED(native_status) && WEXITSTATUS(native_status) == 77)
+            {
+                fprintf(stderr, "native smoke fixture unavailable: p101_format_endpoint\n");
+            }
+            else if(WIFEXITED(native_status))
+            {
+                if(WEXITSTATUS(native_status) != EXIT_SUCCESS)
+                {
+                    fprintf(stderr, "native smoke exited unsuccessfully: p101_format_endpoint: %d\n", WEXITSTATUS(native_status));
                 }
                 EXPECT(WEXITSTATUS(native_status) == EXIT_SUCCESS);
             }
@@ -484,10 +1395,38 @@ int main(void)
         p101_env_set_alloc_observer(env, count_alloc_event, NULL);
         p101_env_set_resource_observer(env, count_resource_event, NULL);
         if(!native_child_process)
+        {
+            test_p101_compact_address_to_sockaddr(env, err);
+        }
+        if(!native_child_process)
         {
             test_p101_convert_address(env, err);
         }
         if(!native_child_process)
+        {
+            test_p101_convert_address_array(env, err);
+        }
+        if(!native_child_process)
+        {
+            test_p101_convert_cidr(env, err);
+        }
+        if(!native_child_process)
+        {
+            test_p101_convert_compact_address(env, err);
+        }
+        if(!native_child_process)
+        {
+            test_p101_convert_endpoint(env, err);
+        }
+        if(!native_child_process)
+        {
+            test_p101_format_address(env, err);
+        }
+        if(!native_child_process)
+        {
+            test_p101_format_endpoint(env, err);
+        }
+        if(!native_child_process)
         {
             test_p101_parse_in_port_t(env, err);
         }
@@ -0,0 +1,334 @@
+/*
+ * Unity tests for src/floating.c -- p101_parse_double() and p101_parse_float().
+ *
+ * A parser that is off by one unit in the last place is wrong in a way nobody
+ * sees until two machines disagree about a threshold, so results are compared
+ * bit for bit: against hand-picked values at the rounding and range edges, and
+ * against the C library's strtod()/strtof() (which glibc and the BSDs round
+ * correctly) over random text aimed at every path of the conversion. The
+ * error half of the contract follows test_integer.c: bad text raises and
+ * returns the caller's default_value.
+ */
+#include "p101_convert/errors.h"
+#include "unity.h"
+#include <errno.h>
+#include <locale.h>
+#include <math.h>
+#include <p101_convert/floating.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+enum
+{
+    RANDOM_CASES  = 200000,
+    RANDOM_SEED   = 101,
+    TEXT_CAPACITY = 2200
+};
+
+static struct p101_error *error;
+static struct p101_env   *env;
+
+void setUp(void)
+{
+    error = p101_error_create(false);
+    env   = p101_env_create(error, NULL);
+}
+
+void tearDown(void)
+{
+    p101_env_destroy(env);
+    p101_error_destroy(error);
+}
+
+/* Each case in a table-driven test needs a clean error slate. */
+static void reset(void)
+{
+    p101_error_reset(error);
+}
+
+static uint64_t double_bits(double value)
+{
+    uint64_t bits;
+
+    memcpy(&bits, &value, sizeof(bits));
+    return bits;
+}
+
+static uint32_t float_bits(float value)
+{
+    uint32_t bits;
+
+    memcpy(&bits, &value, sizeof(bits));
+    return bits;
+}
+
+/* xorshift64: fast, and the same sequence on every platform. */
+static uint64_t next_random(uint64_t *state)
+{
+    *state ^= *state << 13U;
+    *state ^= *state >> 7U;
+    *state ^= *state << 17U;
+    return *state;
+}
+
+static void append_digits(uint64_t *state, char **cursor, size_t count)
+{
+    for(size_t i = 0; i < count; i++)
+    {
+        **cursor = (char)('0' + (next_random(state) % 10U));
+        (*cursor)++;
+    }
+}
+
+/*
+ * Shortest and longer round-trip text of random doubles and floats (the fast
+ * paths), long digit strings with wide exponents (truncated mantissas and the
+ * decimal fallback), and numbers near the subnormal and overflow edges.
+ */
+static void random_text(uint64_t *state, char *text)
+{
+    char    *cursor;
+    uint64_t bits;
+    double   value;
+    float    narrow;
+
+    cursor = text;
+    if(next_random(state) % 2U == 0U)
+    {
+        *cursor = '-';
+        cursor++;
+    }
+
+    switch(next_random(state) % 5U)
+    {
+        case 0:
+            bits = next_random(state) & UINT64_C(0x7FEFFFFFFFFFFFFF);
+            memcpy(&value, &bits, sizeof(value));
+            snprintf(cursor, TEXT_CAPACITY - 1U, "%.*g", (int)(next_random(state) % 19U) + 1, value);
+            break;
+        case 1:
+            bits = next_random(state) & UINT64_C(0x7F7FFFFF);
+            memcpy(&narrow, &bits, sizeof(narrow));
+            snprintf(cursor, TEXT_CAPACITY - 1U, "%.*g", (int)(next_random(state) % 10U) + 1, (double)narrow);
+            break;
+        case 2:
+            append_digits(state, &cursor, (next_random(state) % 40U) + 1U);
+            *cursor = '.';
+            cursor++;
+            append_digits(state, &cursor, next_random(state) % 40U);
+            snprintf(cursor, TEXT_CAPACITY / 2U, "e%d", (int)(next_random(state) % 700U) - 350);
+            break;
+        case 3:
+            snprintf(cursor, TEXT_CAPACITY - 1U, "%.*e", (int)(next_random(state) % 25U), (double)(next_random(state) % 4096U) * 4.9406564584124654e-324);
+            break;
+        default:
+            snprintf(cursor, TEXT_CAPACITY - 1U, "%.*e", (int)(next_random(state) % 25U), 1.7976931348623157e308 / (double)((next_random(state) % 3U) + 1U));
+            break;
+    }
+}
+
+static void test_parse_double_reads_decimal_text(void)
+{
+    static const struct
+    {
+        const char *text;
+        double      expected;
+    } cases[] = {
+        {"0",                        0.0                    },
+        {"1",                        1.0                    },
+        {"  \t-2.5",                 -2.5                   },
+        {"+0.125",                   0.125                  },
+        {".5",                       0.5                    },
+        {"5.",                       5.0                    },
+        {"1e3",                      1000.0                 },
+        {"1E+3",                     1000.0                 },
+        {"25e-2",                    0.25                   },
+        {"0.1",                      0.1                    },
+        {"6.02214076e23",            6.02214076e23          },
+        {"000123.4500",              123.45                 },
+        {"9007199254740993",         9007199254740992.0     },
+        {"9007199254740995",         9007199254740996.0     },
+        {"123456789012345678901234", 1.2345678901234568e23  },
+        {"1.7976931348623157e308",   1.7976931348623157e308 },
+        {"2.2250738585072014e-308",  2.2250738585072014e-308},
+        {"4.9406564584124654e-324",  4.9406564584124654e-324},
+        {"2.4703282292062328e-324",  4.9406564584124654e-324},
+    };
+
+    for(size_t i = 0; i < sizeof(cases) / sizeof(cases[0]); i++)
+    {
+        reset();
+        TEST_ASSERT_EQUAL_HEX64_MESSAGE(double_bits(cases[i].expected), double_bits(p101_parse_double(env, error, cases[i].text, -7.0)), cases[i].text);
+        TEST_ASSERT_FALSE_MESSAGE(p101_error_has_error(error), cases[i].text);
+    }
+
+    reset();
+    TEST_ASSERT_EQUAL_HEX64(double_bits(-0.0), double_bits(p101_parse_double(env, error, "-0", 1.0)));
+    TEST_ASSERT_EQUAL_HEX64(double_bits(0.0), double_bits(p101_parse_double(env, error, "0e99999999", 1.0)));
+    TEST_ASSERT_FALSE(p101_error_has_error(error));
+}
+
+static void test_parse_double_breaks_ties_on_distant_digits(void)
+{
+    static char text[TEXT_CAPACITY];
+
+    // 2^53 + 1 is exactly half way between two doubles; a single non-zero
+    // digit two thousand places later, far past what the fallback keeps, has
+    // to push it up.
+    strcpy(text, "9007199254740993.");
+    memset(&text[strlen(text)], '0', TEXT_CAPACITY - 20U);
+    text[TEXT_CAPACITY - 2U] = '\0';
+    TEST_ASSERT_EQUAL_HEX64(double_bits(9007199254740992.0), double_bits(p101_parse_double(env, error, text, -7.0)));
+    text[TEXT_CAPACITY - 3U] = '1';
+    TEST_ASSERT_EQUAL_HEX64(double_bits(9007199254740994.0), double_bits(p101_parse_double(env, error, text, -7.0)));
+    TEST_ASSERT_FALSE(p101_error_has_error(error));
+}
+
+static void test_parse_double_accepts_infinity_and_nan(void)
+{
+    TEST_ASSERT_EQUAL_HEX64(double_bits(HUGE_VAL), double_bits(p101_parse_double(env, error, "inf", 0.0)));
+    TEST_ASSERT_EQUAL_HEX64(double_bits(-HUGE_VAL), double_bits(p101_parse_double(env, error, " -Infinity", 0.0)));
+    TEST_ASSERT_TRUE(isnan(p101_parse_double(env, error, "NaN", 0.0)));
+    TEST_ASSERT_EQUAL_HEX32(float_bits(-HUGE_VALF), float_bits(p101_parse_float(env, error, "-INF", 0.0F)));
+    TEST_ASSERT_TRUE(isnan(p101_parse_float(env, error, "nan", 0.0F)));
+    TEST_ASSERT_FALSE(p101_error_has_error(error));
+}
+
+static void test_parse_double_rejects_malformed_and_overflowing_text(void)
+{
+    static const char *const syntax[] = {"", " ", "+", "-", ".", "e5", "1e", "1e+", "1.5 ", "1.5x", "1,5", "1..5", "0x1p3", "nan(1)", "infin", "infinityy", "--1", "1e5.5"};
+    static const char *const range[]  = {"1e309", "-1.7976931348623159e308", "1e99999999999999999999", "2.4703282292062327e-324", "-1e-400", "1e-99999"};
+
+    for(size_t i = 0; i < sizeof(syntax) / sizeof(syntax[0]); i++)
+    {
+        reset();
+        TEST_ASSERT_EQUAL_HEX64_MESSAGE(double_bits(-7.0), double_bits(p101_parse_double(env, error, syntax[i], -7.0)), syntax[i]);
+        TEST_ASSERT_TRUE_MESSAGE(p101_error_is_error(error, P101_ERROR_USER, P101_CONVERT_ERROR_SYNTAX), syntax[i]);
+        reset();
+        TEST_ASSERT_EQUAL_HEX32_MESSAGE(float_bits(-7.0F), float_bits(p101_parse_float(env, error, syntax[i], -7.0F)), syntax[i]);
+        TEST_ASSERT_TRUE_MESSAGE(p101_error_is_error(error, P101_ERROR_USER, P101_CONVERT_ERROR_SYNTAX), syntax[i]);
+    }
+    for(size_t i = 0; i < sizeof(range) / sizeof(range[0]); i++)
+    {
+        reset();
+        TEST_ASSERT_EQUAL_HEX64_MESSAGE(double_bits(-7.0), double_bits(p101_parse_double(env, error, range[i], -7.0)), range[i]);
+        TEST_ASSERT_TRUE_MESSAGE(p101_error_is_error(error, P101_ERROR_USER, P101_CONVERT_ERROR_RANGE), range[i]);
+    }
+    reset();
+    TEST_ASSERT_EQUAL_HEX64(double_bits(-7.0), double_bits(p101_parse_double(env, error, NULL, -7.0)));
+    TEST_ASSERT_TRUE(p101_error_has_error(error));
+}
+
+static void test_parse_float_rounds_to_float(void)
+{
+    static const struct
+    {
+        const char *text;
+        float       expected;
+    } cases[] = {
+        {"0.1",                               0.1F            },
+        {"16777217",                          16777216.0F     },
+        {"16777219",                          16777220.0F     },
+        {"3.4028235e38",                      3.4028235e38F   },
+        {"1.17549435e-38",                    1.17549435e-38F },
+        {"1.4e-45",                           1.40129846e-45F },
+        {"0.3333333333333333333333333333333", 0.33333334F     },
+        {"-1.00000005960464477539062500001",  -1.00000012F    },
+    };
+    static const char *const range[] = {"3.4028236e38", "1e39", "7e-46", "-1e-50"};
+
+    for(size_t i = 0; i < sizeof(cases) / sizeof(cases[0]); i++)
+    {
+        reset();
+        TEST_ASSERT_EQUAL_HEX32_MESSAGE(float_bits(cases[i].expected), float_bits(p101_parse_float(env, error, cases[i].text, -7.0F)), cases[i].text);
+        TEST_ASSERT_FALSE_MESSAGE(p101_error_has_error(error), cases[i].text);
+    }
+    for(size_t i = 0; i < sizeof(range) / sizeof(range[0]); i++)
+    {
+        reset();
+        TEST_ASSERT_EQUAL_HEX32_MESSAGE(float_bits(-7.0F), float_bits(p101_parse_float(env, error, range[i], -7.0F)), range[i]);
+        TEST_ASSERT_TRUE_MESSAGE(p101_error_is_error(error, P101_ERROR_USER, P101_CONVERT_ERROR_RANGE), range[i]);
+    }
+}
+
+static void test_parse_double_and_float_match_strtod(void)
+{
+    static char text[TEXT_CAPACITY];
+    uint64_t    state;
+
+    state = RANDOM_SEED;
+    for(int i = 0; i < RANDOM_CASES; i++)
+    {
+        double expected;
+        float  expected_float;
+        bool   out_of_range;
+
+        random_text(&state, text);
+        errno        = 0;
+        expected     = strtod(text, NULL);
+        out_of_range = isinf(expected) || (errno == ERANGE && expected == 0.0);
+        reset();
+        if(out_of_range)
+        {
+            TEST_ASSERT_EQUAL_HEX64_MESSAGE(double_bits(-7.0), double_bits(p101_parse_double(env, error, text, -7.0)), text);
+            TEST_ASSERT_TRUE_MESSAGE(p101_error_is_error(error, P101_ERROR_USER, P101_CONVERT_ERROR_RANGE), text);
+        }
+        else
+        {
+            TEST_ASSERT_EQUAL_HEX64_MESSAGE(double_bits(expected), double_bits(p101_parse_double(env, error, text, -7.0)), text);
+            TEST_ASSERT_FALSE_MESSAGE(p101_error_has_error(error), text);
+        }
+
+        errno          = 0;
+        expected_float = strtof(text, NULL);
+        out_of_range   = isinf(expected_float) || (errno == ERANGE && expected_float == 0.0F);
+        reset();
+        if(out_of_range)
+        {
+            TEST_ASSERT_EQUAL_HEX32_MESSAGE(float_bits(-7.0F), float_bits(p101_parse_float(env, error, text, -7.0F)), text);
+            TEST_ASSERT_TRUE_MESSAGE(p101_error_is_error(error, P101_ERROR_USER, P101_CONVERT_ERROR_RANGE), text);
+        }
+        else
+        {
+            TEST_ASSERT_EQUAL_HEX32_MESSAGE(float_bits(expected_float), float_bits(p101_parse_float(env, error, text, -7.0F)), text);
+            TEST_ASSERT_FALSE_MESSAGE(p101_error_has_error(error), text);
+        }
+    }
+}
+
+static void test_parse_double_ignores_the_locale(void)
+{
+    static const char *const locales[] = {"de_DE.UTF-8", "de_DE.utf8", "fr_FR.UTF-8", "fr_FR.utf8"};
+    const char              *found;
+
+    found = NULL;
+    for(size_t i = 0; found == NULL && i < sizeof(locales) / sizeof(locales[0]); i++)
+    {
+        found = setlocale(LC_NUMERIC, locales[i]);
+    }
+    if(found == NULL)
+    {
+        TEST_IGNORE_MESSAGE("no locale with a decimal comma is installed");
+    }
+
+    TEST_ASSERT_EQUAL_HEX64(double_bits(1.5), double_bits(p101_parse_double(env, error, "1.5", -7.0)));
+    TEST_ASSERT_FALSE(p101_error_has_error(error));
+    TEST_ASSERT_EQUAL_HEX64(double_bits(-7.0), double_bits(p101_parse_double(env, error, "1,5", -7.0)));
+    TEST_ASSERT_TRUE(p101_error_is_error(error, P101_ERROR_USER, P101_CONVERT_ERROR_SYNTAX));
+    setlocale(LC_NUMERIC, "C");
+}
+
+int main(void)
+{
+    UNITY_BEGIN();
+    RUN_TEST(test_parse_double_reads_decimal_text);
+    RUN_TEST(test_parse_double_breaks_ties_on_distant_digits);
+    RUN_TEST(test_parse_double_accepts_infinity_and_nan);
+    RUN_TEST(test_parse_double_rejects_malformed_and_overflowing_text);
+    RUN_TEST(test_parse_float_rounds_to_float);
+    RUN_TEST(test_parse_double_and_float_match_strtod);
+    RUN_TEST(test_parse_double_ignores_the_locale);
+    return UNITY_END();
+}
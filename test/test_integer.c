@@ -18,9 +18,13 @@
  */
 #include "p101_convert/errors.h"
 #include "unity.h"
+#include <inttypes.h>
 #include <limits.h>
 #include <p101_convert/integer.h>
 #include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
 
 static struct p101_error *error;
 static struct p101_env   *env;
@@ -142,12 +146,106 @@ static void test_parse_int_rejects_below_min(void)
 
 static void test_parse_int_rejects_intmax_overflow(void)
 {
-    /* Too wide even for strtoimax: ERANGE comes back from the p101_c wrapper,
-     * and the function bails out with the caller's default, not a clamp. */
+    /* Too wide even for intmax_t: the scanner reports a range error, and the
+     * function bails out with the caller's default, not a clamp. */
     TEST_ASSERT_EQUAL_INT(-1, p101_parse_int(env, error, "99999999999999999999999999", -1));
     TEST_ASSERT_TRUE(p101_error_has_error(error));
 }
 
+static void test_parse_long_literals_cross_the_overflow_check_exactly(void)
+{
+    /* The scanner skips the overflow test for the first 18 digits, so pin the
+     * cases where that boundary matters: leading zeros that push a small value
+     * past 18 digits, and the exact 19/20-digit limits on either side. */
+    TEST_ASSERT_EQUAL_INT64(42, p101_parse_int64_t(env, error, "0000000000000000000000042", 0));
+    TEST_ASSERT_FALSE(p101_error_has_error(error));
+    reset();
+    TEST_ASSERT_EQUAL_INT64(INT64_MIN, p101_parse_int64_t(env, error, "-00000009223372036854775808", 0));
+    TEST_ASSERT_FALSE(p101_error_has_error(error));
+    reset();
+    TEST_ASSERT_EQUAL_INT64(INT64_MAX, p101_parse_int64_t(env, error, "9223372036854775807", 0));
+    TEST_ASSERT_FALSE(p101_error_has_error(error));
+    reset();
+    TEST_ASSERT_EQUAL_INT64(0, p101_parse_int64_t(env, error, "-9223372036854775809", 0));
+    TEST_ASSERT_TRUE(p101_error_is_error(error, P101_ERROR_USER, P101_CONVERT_ERROR_RANGE));
+    reset();
+    TEST_ASSERT_EQUAL_UINT64(UINT64_MAX, p101_parse_uint64_t(env, error, "18446744073709551615", 0));
+    TEST_ASSERT_FALSE(p101_error_has_error(error));
+    reset();
+    TEST_ASSERT_EQUAL_UINT64(0, p101_parse_uint64_t(env, error, "18446744073709551616", 0));
+    TEST_ASSERT_TRUE(p101_error_is_error(error, P101_ERROR_USER, P101_CONVERT_ERROR_RANGE));
+}
+
+static void test_parse_finds_a_non_digit_anywhere_in_an_eight_digit_word(void)
+{
+    /* Long literals are converted eight digits per word, so a bad byte must be
+     * noticed at every position of the word, including the characters just
+     * either side of '0'..'9' in ASCII. */
+    static const char *const bad[] = {"x234567890123", "1234567/90123", "12345678:0123", "123456789012345 ", "1234567890123456\t"};
+    size_t                   i;
+
+    for(i = 0; i < sizeof(bad) / sizeof(bad[0]); i++)
+    {
+        reset();
+        TEST_ASSERT_EQUAL_INT64_MESSAGE(-1, p101_parse_int64_t(env, error, bad[i], -1), bad[i]);
+        TEST_ASSERT_TRUE_MESSAGE(p101_error_is_error(error, P101_ERROR_USER, P101_CONVERT_ERROR_SYNTAX), bad[i]);
+        reset();
+        TEST_ASSERT_EQUAL_UINT64_MESSAGE(1, p101_parse_uint64_t_n(env, error, bad[i], strlen(bad[i]), 1), bad[i]);
+        TEST_ASSERT_TRUE_MESSAGE(p101_error_is_error(error, P101_ERROR_USER, P101_CONVERT_ERROR_SYNTAX), bad[i]);
+    }
+}
+
+static void test_parse_wide_literals_of_every_length(void)
+{
+    /* 1, 12, 123, ... up to 19 digits: every split between whole eight-digit
+     * words and the scalar tail. */
+    static const char digits[] = "1234567890123456789";
+    uint64_t          expected;
+    size_t            length;
+
+    expected = 0;
+    for(length = 1; length < sizeof(digits); length++)
+    {
+        expected = (expected * 10U) + (uint64_t)(digits[length - 1] - '0');
+        reset();
+        TEST_ASSERT_EQUAL_UINT64(expected, p101_parse_uint64_t_n(env, error, digits, length, 0));
+        TEST_ASSERT_FALSE(p101_error_has_error(error));
+        TEST_ASSERT_EQUAL_INT64((int64_t)expected, p101_parse_long_long_n(env, error, digits, length, 0));
+        TEST_ASSERT_FALSE(p101_error_has_error(error));
+    }
+    TEST_ASSERT_EQUAL_UINT64(expected, p101_parse_uint64_t(env, error, digits, 0));
+    TEST_ASSERT_FALSE(p101_error_has_error(error));
+}
+
+static void test_parse_n_finds_a_non_digit_in_every_lane_of_a_long_field(void)
+{
+    /* Fields of sixteen or more bytes may be classified sixteen lanes at a
+     * time; a bad byte in any lane must stop the digits there. */
+    static const char digits[] = "1234567890123456789";
+    char              field[sizeof(digits)];
+    size_t            i;
+
+    memcpy(field, digits, sizeof(digits));
+
+    for(i = 0; i + 1 < sizeof(field); i++)
+    {
+        field[i] = 'x';
+        reset();
+        TEST_ASSERT_EQUAL_UINT64(1, p101_parse_uint64_t_n(env, error, field, sizeof(field) - 1, 1));
+        TEST_ASSERT_TRUE(p101_error_is_error(error, P101_ERROR_USER, P101_CONVERT_ERROR_SYNTAX));
+        reset();
+        TEST_ASSERT_EQUAL_INT64(-1, p101_parse_int64_t(env, error, field, -1));
+        TEST_ASSERT_TRUE(p101_error_is_error(error, P101_ERROR_USER, P101_CONVERT_ERROR_SYNTAX));
+        field[i] = digits[i];
+    }
+}
+
+static void test_parse_int_accepts_every_c_locale_blank(void)
+{
+    TEST_ASSERT_EQUAL_INT(5, p101_parse_int(env, error, " \t\n\v\f\r5", -1));
+    TEST_ASSERT_FALSE(p101_error_has_error(error));
+}
+
 static void test_parse_int8_and_int16_ranges(void)
 {
     TEST_ASSERT_EQUAL_INT8(INT8_MAX, p101_parse_int8_t(env, error, "127", 0));
@@ -318,6 +416,915 @@ static void test_negative_char_is_independent_of_plain_char_signedness(void)
     TEST_ASSERT_FALSE(p101_error_has_error(error));
 }
 
+/* ----------------------------------------------------------- length-bounded */
+
+static void test_parse_n_reads_only_the_given_field(void)
+{
+    static const char buffer[] = "8080,443";
+
+    TEST_ASSERT_EQUAL_UINT16(8080, p101_parse_uint16_t_n(env, error, buffer, 4, 0));
+    TEST_ASSERT_FALSE(p101_error_has_error(error));
+    reset();
+    TEST_ASSERT_EQUAL_UINT16(443, p101_parse_uint16_t_n(env, error, buffer + 5, 3, 0));
+    TEST_ASSERT_FALSE(p101_error_has_error(error));
+}
+
+static void test_parse_n_does_not_need_a_terminator(void)
+{
+    /* No NUL anywhere: a parser that peeks at str[length] reads past the array,
+     * which the sanitizer builds turn into a hard failure. */
+    static const char digits[] = {' ', '-', '4', '2'};
+
+    TEST_ASSERT_EQUAL_INT32(-42, p101_parse_int32_t_n(env, error, digits, sizeof(digits), 0));
+    TEST_ASSERT_FALSE(p101_error_has_error(error));
+}
+
+static void test_parse_n_rejects_trailing_bytes_inside_the_length(void)
+{
+    TEST_ASSERT_EQUAL_INT(-1, p101_parse_int_n(env, error, "12a", 3, -1));
+    TEST_ASSERT_TRUE(p101_error_is_error(error, P101_ERROR_USER, P101_CONVERT_ERROR_SYNTAX));
+    reset();
+    /* An embedded NUL is data, not a terminator. */
+    TEST_ASSERT_EQUAL_INT(-1, p101_parse_int_n(env, error, "12\0", 3, -1));
+    TEST_ASSERT_TRUE(p101_error_is_error(error, P101_ERROR_USER, P101_CONVERT_ERROR_SYNTAX));
+}
+
+static void test_parse_n_rejects_an_empty_field(void)
+{
+    TEST_ASSERT_EQUAL_INT(-1, p101_parse_int_n(env, error, "42", 0, -1));
+    TEST_ASSERT_TRUE(p101_error_is_error(error, P101_ERROR_USER, P101_CONVERT_ERROR_SYNTAX));
+    reset();
+    TEST_ASSERT_EQUAL_INT(-1, p101_parse_int_n(env, error, "  +", 3, -1));
+    TEST_ASSERT_TRUE(p101_error_is_error(error, P101_ERROR_USER, P101_CONVERT_ERROR_SYNTAX));
+}
+
+static void test_parse_n_applies_the_same_range_rules(void)
+{
+    TEST_ASSERT_EQUAL_INT64(INT64_MIN, p101_parse_int64_t_n(env, error, "-9223372036854775808", 20, 0));
+    TEST_ASSERT_FALSE(p101_error_has_error(error));
+    reset();
+    TEST_ASSERT_EQUAL_INT64(0, p101_parse_int64_t_n(env, error, "9223372036854775808", 19, 0));
+    TEST_ASSERT_TRUE(p101_error_is_error(error, P101_ERROR_USER, P101_CONVERT_ERROR_RANGE));
+    reset();
+    TEST_ASSERT_EQUAL_UINT64(UINT64_MAX, p101_parse_uint64_t_n(env, error, "18446744073709551615", 20, 0));
+    TEST_ASSERT_FALSE(p101_error_has_error(error));
+    reset();
+    TEST_ASSERT_EQUAL_UINT64(0, p101_parse_uint64_t_n(env, error, "18446744073709551616", 20, 0));
+    TEST_ASSERT_TRUE(p101_error_is_error(error, P101_ERROR_USER, P101_CONVERT_ERROR_RANGE));
+    reset();
+    TEST_ASSERT_EQUAL_UINT32(0, p101_parse_uint32_t_n(env, error, "4294967296", 10, 0));
+    TEST_ASSERT_TRUE(p101_error_is_error(error, P101_ERROR_USER, P101_CONVERT_ERROR_RANGE));
+    reset();
+    /* Overflow wins over trailing garbage, as it does for strtoimax(). */
+    TEST_ASSERT_EQUAL_INT(-1, p101_parse_int_n(env, error, "99999999999999999999x", 21, -1));
+    TEST_ASSERT_TRUE(p101_error_is_error(error, P101_ERROR_USER, P101_CONVERT_ERROR_RANGE));
+}
+
+static void test_parse_n_refuses_negative_unsigned_input(void)
+{
+    TEST_ASSERT_EQUAL_UINT(9, p101_parse_unsigned_int_n(env, error, " -0", 3, 9));
+    TEST_ASSERT_TRUE(p101_error_is_error(error, P101_ERROR_USER, P101_CONVERT_ERROR_RANGE));
+    reset();
+    TEST_ASSERT_EQUAL_INT(0, p101_parse_negative_int_n(env, error, "-0", 2, 0));
+    TEST_ASSERT_TRUE(p101_error_has_error(error));
+    reset();
+    TEST_ASSERT_EQUAL_INT(-3, p101_parse_negative_int_n(env, error, "-3", 2, 0));
+    TEST_ASSERT_FALSE(p101_error_has_error(error));
+}
+
+static void test_parse_n_null_input_raises_and_returns_default(void)
+{
+    TEST_ASSERT_EQUAL_INT(7, p101_parse_int_n(env, error, NULL, 0, 7));
+    TEST_ASSERT_TRUE(p101_error_has_error(error));
+}
+
+
+/* -------------------------------------------------------------------- prefix */
+
+static void test_parse_prefix_returns_the_first_unconsumed_byte(void)
+{
+    const char *input;
+    const char *end;
+
+    input = " 123ms";
+    end   = NULL;
+    TEST_ASSERT_EQUAL_INT(123, p101_parse_int_prefix(env, error, input, &end, -1));
+    TEST_ASSERT_FALSE(p101_error_has_error(error));
+    TEST_ASSERT_EQUAL_PTR(input + 4, end);
+
+    input = "42,rest";
+    TEST_ASSERT_EQUAL_UINT64(42, p101_parse_uint64_t_prefix(env, error, input, &end, 0));
+    TEST_ASSERT_FALSE(p101_error_has_error(error));
+    TEST_ASSERT_EQUAL_STRING(",rest", end);
+
+    input = "-9223372036854775808";
+    TEST_ASSERT_EQUAL_INT64(INT64_MIN, p101_parse_int64_t_prefix(env, error, input, &end, 0));
+    TEST_ASSERT_FALSE(p101_error_has_error(error));
+    TEST_ASSERT_EQUAL_PTR(input + strlen(input), end);
+}
+
+static void test_parse_prefix_still_needs_a_digit_and_a_fitting_value(void)
+{
+    const char *input;
+    const char *end;
+
+    input = "ms";
+    TEST_ASSERT_EQUAL_INT(-1, p101_parse_int_prefix(env, error, input, &end, -1));
+    TEST_ASSERT_TRUE(p101_error_is_error(error, P101_ERROR_USER, P101_CONVERT_ERROR_SYNTAX));
+    TEST_ASSERT_EQUAL_PTR(input, end);
+    reset();
+    input = "256,";
+    TEST_ASSERT_EQUAL_UINT8(9, p101_parse_uint8_t_prefix(env, error, input, &end, 9));
+    TEST_ASSERT_TRUE(p101_error_is_error(error, P101_ERROR_USER, P101_CONVERT_ERROR_RANGE));
+    TEST_ASSERT_EQUAL_PTR(input, end);
+    reset();
+    input = "-1x";
+    TEST_ASSERT_EQUAL_UINT(9, p101_parse_unsigned_int_prefix(env, error, input, &end, 9));
+    TEST_ASSERT_TRUE(p101_error_is_error(error, P101_ERROR_USER, P101_CONVERT_ERROR_RANGE));
+    TEST_ASSERT_EQUAL_PTR(input, end);
+    reset();
+    input = "5";
+    TEST_ASSERT_EQUAL_INT(-1, p101_parse_negative_int_prefix(env, error, input, &end, -1));
+    TEST_ASSERT_TRUE(p101_error_has_error(error));
+    TEST_ASSERT_EQUAL_PTR(input, end);
+}
+
+static void test_parse_prefix_null_arguments_raise(void)
+{
+    const char *end;
+
+    TEST_ASSERT_EQUAL_INT(7, p101_parse_int_prefix(env, error, NULL, &end, 7));
+    TEST_ASSERT_TRUE(p101_error_has_error(error));
+    reset();
+    TEST_ASSERT_EQUAL_INT(7, p101_parse_int_prefix(env, error, "1", NULL, 7));
+    TEST_ASSERT_TRUE(p101_error_has_error(error));
+}
+
+
+/* --------------------------------------------------------------------- radix */
+
+static void test_parse_base_reads_each_prefix(void)
+{
+    TEST_ASSERT_EQUAL_UINT32(0x1FU, p101_parse_uint32_t_base(env, error, "0x1f", 0, 1));
+    TEST_ASSERT_EQUAL_UINT32(0755U, p101_parse_uint32_t_base(env, error, "0o755", 0, 1));
+    TEST_ASSERT_EQUAL_UINT32(0755U, p101_parse_uint32_t_base(env, error, "0755", 0, 1));
+    TEST_ASSERT_EQUAL_UINT32(10U, p101_parse_uint32_t_base(env, error, "0B1010", 0, 1));
+    TEST_ASSERT_EQUAL_UINT32(1010U, p101_parse_uint32_t_base(env, error, " +1010", 0, 1));
+    TEST_ASSERT_EQUAL_UINT32(0U, p101_parse_uint32_t_base(env, error, "0", 0, 1));
+    TEST_ASSERT_EQUAL_INT16(-0x80, p101_parse_int16_t_base(env, error, "-0x80", 0, 1));
+    TEST_ASSERT_EQUAL_UINT32(0xABCDU, p101_parse_uint32_t_base(env, error, "0XAbCd", 16, 1));
+    TEST_ASSERT_EQUAL_UINT32(0xABCDU, p101_parse_uint32_t_base(env, error, "abcd", 16, 1));
+    TEST_ASSERT_EQUAL_UINT32(0777U, p101_parse_uint32_t_base(env, error, "0o777", 8, 1));
+    TEST_ASSERT_EQUAL_UINT32(5U, p101_parse_uint32_t_base(env, error, "0b101", 2, 1));
+    TEST_ASSERT_EQUAL_UINT32(46655U, p101_parse_uint32_t_base(env, error, "zzz", 36, 1));
+    TEST_ASSERT_FALSE(p101_error_has_error(error));
+}
+
+static void test_parse_base_rejects_what_the_radix_does_not_allow(void)
+{
+    static const struct
+    {
+        const char  *text;
+        unsigned int base;
+    } bad[] = {
+        {"0x",    0 },
+        {"0b",    2 },
+        {"0b2",   0 },
+        {"089",   0 },
+        {"0x1g",  16},
+        {"0o17",  16},
+        {"12",    2 },
+        {"ff ",   16},
+        {"",      0 },
+        {"-",     0 },
+        {"0x-1",  0 },
+        {"0x 1",  0 },
+        {" 0 x1", 0 },
+    };
+    size_t i;
+
+    for(i = 0; i < sizeof(bad) / sizeof(bad[0]); i++)
+    {
+        reset();
+        TEST_ASSERT_EQUAL_INT32_MESSAGE(7, p101_parse_int32_t_base(env, error, bad[i].text, bad[i].base, 7), bad[i].text);
+        TEST_ASSERT_TRUE_MESSAGE(p101_error_is_error(error, P101_ERROR_USER, P101_CONVERT_ERROR_SYNTAX), bad[i].text);
+    }
+}
+
+static void test_parse_base_decodes_sixteen_digit_ids_like_strtoull(void)
+{
+    static const char *const ids[] = {"0000000000000000", "00f067aa0ba902b7", "FFFFFFFFFFFFFFFF", "0123456789abcdef", "FEDCBA9876543210", "a3ce929d0e0e4736", "8000000000000000", "0x7fffffffffffffff"};
+    size_t                   i;
+
+    for(i = 0; i < sizeof(ids) / sizeof(ids[0]); i++)
+    {
+        TEST_ASSERT_EQUAL_UINT64_MESSAGE(strtoull(ids[i], NULL, 16), p101_parse_uint64_t_base(env, error, ids[i], 16, 1), ids[i]);
+        TEST_ASSERT_FALSE_MESSAGE(p101_error_has_error(error), ids[i]);
+    }
+
+    /* A non-digit in any of the sixteen lanes must fall back and be refused. */
+    for(i = 0; i < 16; i++)
+    {
+        char text[17];
+
+        memcpy(text, "0123456789abcdef", sizeof(text));
+        text[i] = (i % 2U == 0U) ? 'g' : (char)('0' - 0x20);
+        reset();
+        TEST_ASSERT_EQUAL_UINT64(1U, p101_parse_uint64_t_base(env, error, text, 16, 1));
+        TEST_ASSERT_TRUE(p101_error_is_error(error, P101_ERROR_USER, P101_CONVERT_ERROR_SYNTAX));
+    }
+}
+
+static void test_parse_base_applies_the_target_range(void)
+{
+    TEST_ASSERT_EQUAL_INT64(INT64_MIN, p101_parse_int64_t_base(env, error, "-0x8000000000000000", 0, 1));
+    TEST_ASSERT_EQUAL_INT64(INT64_MAX, p101_parse_int64_t_base(env, error, "0x7FFFFFFFFFFFFFFF", 0, 1));
+    TEST_ASSERT_EQUAL_UINT8(UINT8_MAX, p101_parse_uint8_t_base(env, error, "0b11111111", 0, 1));
+    TEST_ASSERT_EQUAL_INT8(INT8_MIN, p101_parse_int8_t_base(env, error, "-200", 8, 1));
+    TEST_ASSERT_FALSE(p101_error_has_error(error));
+
+    TEST_ASSERT_EQUAL_INT64(1, p101_parse_int64_t_base(env, error, "0x8000000000000000", 0, 1));
+    TEST_ASSERT_TRUE(p101_error_is_error(error, P101_ERROR_USER, P101_CONVERT_ERROR_RANGE));
+    reset();
+    TEST_ASSERT_EQUAL_UINT64(1U, p101_parse_uint64_t_base(env, error, "0x10000000000000000", 0, 1));
+    TEST_ASSERT_TRUE(p101_error_is_error(error, P101_ERROR_USER, P101_CONVERT_ERROR_RANGE));
+    reset();
+    TEST_ASSERT_EQUAL_UINT8(1U, p101_parse_uint8_t_base(env, error, "0x100", 0, 1));
+    TEST_ASSERT_TRUE(p101_error_is_error(error, P101_ERROR_USER, P101_CONVERT_ERROR_RANGE));
+    reset();
+    TEST_ASSERT_EQUAL_UINT16(1U, p101_parse_uint16_t_base(env, error, "-0x0", 0, 1));
+    TEST_ASSERT_TRUE(p101_error_is_error(error, P101_ERROR_USER, P101_CONVERT_ERROR_RANGE));
+}
+
+static void test_parse_base_refuses_an_unsupported_base(void)
+{
+    static const unsigned int bases[] = {1, 37, 64, UINT32_MAX};
+    size_t                    i;
+
+    for(i = 0; i < sizeof(bases) / sizeof(bases[0]); i++)
+    {
+        reset();
+        TEST_ASSERT_EQUAL_INT32(7, p101_parse_int32_t_base(env, error, "10", bases[i], 7));
+        TEST_ASSERT_TRUE(p101_error_has_error(error));
+        TEST_ASSERT_FALSE(p101_error_is_error(error, P101_ERROR_USER, P101_CONVERT_ERROR_SYNTAX));
+    }
+    reset();
+    TEST_ASSERT_EQUAL_UINT64(7U, p101_parse_uint64_t_base(env, error, NULL, 16, 7));
+    TEST_ASSERT_TRUE(p101_error_has_error(error));
+}
+
+/* ------------------------------------------------------------------- 128-bit */
+
+static const struct p101_uint128 wide_default = {7, 7};
+
+static void assert_wide(uint64_t high, uint64_t low, struct p101_uint128 value)
+{
+    TEST_ASSERT_EQUAL_HEX64(high, value.high);
+    TEST_ASSERT_EQUAL_HEX64(low, value.low);
+}
+
+static void test_parse_uint128_reads_the_full_decimal_range(void)
+{
+    assert_wide(0, 0, p101_parse_uint128(env, error, "0", wide_default));
+    assert_wide(0, UINT64_MAX, p101_parse_uint128(env, error, "18446744073709551615", wide_default));
+    assert_wide(1, 0, p101_parse_uint128(env, error, "18446744073709551616", wide_default));
+    assert_wide(0x0013426172C74D82U, 0x2B878FE800000000U, p101_parse_uint128(env, error, " +100000000000000000000000000000000000", wide_default));
+    assert_wide(UINT64_MAX, UINT64_MAX, p101_parse_uint128(env, error, "340282366920938463463374607431768211455", wide_default));
+    assert_wide(UINT64_MAX, UINT64_MAX, p101_parse_uint128(env, error, "000340282366920938463463374607431768211455", wide_default));
+    TEST_ASSERT_FALSE(p101_error_has_error(error));
+}
+
+static void test_parse_uint128_applies_the_integer_rules(void)
+{
+    static const char *const range[] = {"340282366920938463463374607431768211456", "999999999999999999999999999999999999999999", "-1", "-0"};
+    static const char *const syntax[] = {"", " ", "12x", "1 ", "0x10", "+", "12345678901234567a"};
+    size_t                   i;
+
+    for(i = 0; i < sizeof(range) / sizeof(range[0]); i++)
+    {
+        reset();
+        assert_wide(7, 7, p101_parse_uint128(env, error, range[i], wide_default));
+        TEST_ASSERT_TRUE_MESSAGE(p101_error_is_error(error, P101_ERROR_USER, P101_CONVERT_ERROR_RANGE), range[i]);
+    }
+    for(i = 0; i < sizeof(syntax) / sizeof(syntax[0]); i++)
+    {
+        reset();
+        assert_wide(7, 7, p101_parse_uint128(env, error, syntax[i], wide_default));
+        TEST_ASSERT_TRUE_MESSAGE(p101_error_is_error(error, P101_ERROR_USER, P101_CONVERT_ERROR_SYNTAX), syntax[i]);
+    }
+    reset();
+    assert_wide(7, 7, p101_parse_uint128(env, error, NULL, wide_default));
+    TEST_ASSERT_TRUE(p101_error_has_error(error));
+}
+
+static void test_parse_uint128_base_reads_trace_ids_and_prefixes(void)
+{
+    assert_wide(0x4BF92F3577B34DA6U, 0xA3CE929D0E0E4736U, p101_parse_uint128_base(env, error, "4bf92f3577b34da6a3ce929d0e0e4736", 16, wide_default));
+    assert_wide(0x4BF92F3577B34DA6U, 0xA3CE929D0E0E4736U, p101_parse_uint128_base(env, error, "0X4BF92F3577B34DA6A3CE929D0E0E4736", 0, wide_default));
+    assert_wide(UINT64_MAX, UINT64_MAX, p101_parse_uint128_base(env, error, "0x0ffffffffffffffffffffffffffffffff", 16, wide_default));
+    assert_wide(0x1U, 0x23456789ABCDEF01U, p101_parse_uint128_base(env, error, "123456789abcdef01", 16, wide_default));
+    assert_wide(0, 0x1FU, p101_parse_uint128_base(env, error, "0x1f", 0, wide_default));
+    assert_wide(0, 0755U, p101_parse_uint128_base(env, error, "0755", 0, wide_default));
+    assert_wide(UINT64_C(1) << 63U, 0, p101_parse_uint128_base(env, error, "0b1" "000000000000000000000000000000000000000000000000000000000000000" "0000000000000000000000000000000000000000000000000000000000000000", 0, wide_default));
+    assert_wide(0, 1U, p101_parse_uint128_base(env, error, "1", 36, wide_default));
+    TEST_ASSERT_FALSE(p101_error_has_error(error));
+
+    assert_wide(7, 7, p101_parse_uint128_base(env, error, "100000000000000000000000000000000", 16, wide_default));
+    TEST_ASSERT_TRUE(p101_error_is_error(error, P101_ERROR_USER, P101_CONVERT_ERROR_RANGE));
+    reset();
+    assert_wide(7, 7, p101_parse_uint128_base(env, error, "4bf92f3577b34da6-3ce929d0e0e4736", 16, wide_default));
+    TEST_ASSERT_TRUE(p101_error_is_error(error, P101_ERROR_USER, P101_CONVERT_ERROR_SYNTAX));
+    reset();
+    assert_wide(7, 7, p101_parse_uint128_base(env, error, "10", 37, wide_default));
+    TEST_ASSERT_TRUE(p101_error_has_error(error));
+    TEST_ASSERT_FALSE(p101_error_is_error(error, P101_ERROR_USER, P101_CONVERT_ERROR_SYNTAX));
+}
+
+static void test_parse_hex_id_decodes_trace_and_span_ids(void)
+{
+    static const uint8_t trace[16] = {0x4B, 0xF9, 0x2F, 0x35, 0x77, 0xB3, 0x4D, 0xA6, 0xA3, 0xCE, 0x92, 0x9D, 0x0E, 0x0E, 0x47, 0x36};
+    static const uint8_t span[8]   = {0x00, 0xF0, 0x67, 0xAA, 0x0B, 0xA9, 0x02, 0xB7};
+    static const uint8_t odd[3]    = {0xAB, 0xCD, 0xEF};
+    uint8_t              id[16];
+
+    TEST_ASSERT_TRUE(p101_parse_hex_id(env, error, "4bf92f3577b34da6a3ce929d0e0e4736", id, sizeof(id)));
+    TEST_ASSERT_EQUAL_HEX8_ARRAY(trace, id, sizeof(trace));
+    TEST_ASSERT_TRUE(p101_parse_hex_id(env, error, "4BF92F3577B34DA6A3CE929D0E0E4736", id, sizeof(id)));
+    TEST_ASSERT_EQUAL_HEX8_ARRAY(trace, id, sizeof(trace));
+    TEST_ASSERT_TRUE(p101_parse_hex_id(env, error, "00f067aa0ba902b7", id, sizeof(span)));
+    TEST_ASSERT_EQUAL_HEX8_ARRAY(span, id, sizeof(span));
+    TEST_ASSERT_TRUE(p101_parse_hex_id(env, error, "aBcDeF", id, sizeof(odd)));
+    TEST_ASSERT_EQUAL_HEX8_ARRAY(odd, id, sizeof(odd));
+    TEST_ASSERT_FALSE(p101_error_has_error(error));
+}
+
+static void test_parse_hex_id_refuses_anything_but_exact_hex(void)
+{
+    static const uint8_t     zeros[17] = {0};
+    static const char *const bad[]     = {"", "4bf92f3577b34da6a3ce929d0e0e473", "4bf92f3577b34da6a3ce929d0e0e47360", " 4bf92f3577b34da6a3ce929d0e0e473", "0x4bf92f3577b34da6a3ce929d0e0e47"};
+    uint8_t                  id[17];
+    size_t                   i;
+
+    for(i = 0; i < sizeof(bad) / sizeof(bad[0]); i++)
+    {
+        reset();
+        memset(id, 0xFF, sizeof(id));
+        TEST_ASSERT_FALSE_MESSAGE(p101_parse_hex_id(env, error, bad[i], id, 16), bad[i]);
+        TEST_ASSERT_TRUE_MESSAGE(p101_error_is_error(error, P101_ERROR_USER, P101_CONVERT_ERROR_SYNTAX), bad[i]);
+        TEST_ASSERT_EQUAL_HEX8_ARRAY(zeros, id, 16);
+    }
+
+    /* A bad character in every position, inside the kernel and in the tail. */
+    for(i = 0; i < 34; i++)
+    {
+        char text[35];
+
+        memcpy(text, "0123456789abcdef0123456789ABCDEF01", sizeof(text));
+        text[i] = (i % 2U == 0U) ? 'g' : ' ';
+        reset();
+        memset(id, 0xFF, sizeof(id));
+        TEST_ASSERT_FALSE(p101_parse_hex_id(env, error, text, id, sizeof(id)));
+        TEST_ASSERT_TRUE(p101_error_is_error(error, P101_ERROR_USER, P101_CONVERT_ERROR_SYNTAX));
+        TEST_ASSERT_EQUAL_HEX8_ARRAY(zeros, id, sizeof(id));
+    }
+
+    reset();
+    TEST_ASSERT_FALSE(p101_parse_hex_id(env, error, NULL, id, 16));
+    TEST_ASSERT_TRUE(p101_error_has_error(error));
+    reset();
+    TEST_ASSERT_FALSE(p101_parse_hex_id(env, error, "00", NULL, 1));
+    TEST_ASSERT_TRUE(p101_error_has_error(error));
+    reset();
+    TEST_ASSERT_FALSE(p101_parse_hex_id(env, error, "", id, 0));
+    TEST_ASSERT_TRUE(p101_error_has_error(error));
+}
+
+/* --------------------------------------------------------------------- sizes */
+
+static void test_parse_size_applies_si_and_iec_units(void)
+{
+    static const struct
+    {
+        const char *text;
+        uint64_t    bytes;
+    } sizes[] = {
+        {"0",                      0                             },
+        {"4096",                   4096                          },
+        {"512B",                   512                           },
+        {"64K",                    64000                         },
+        {"64k",                    64000                         },
+        {"64KiB",                  65536                         },
+        {"64Ki",                   65536                         },
+        {"512MB",                  512000000                     },
+        {"1.5GiB",                 UINT64_C(1610612736)          },
+        {"1.5G",                   UINT64_C(1500000000)          },
+        {" +2TiB",                 UINT64_C(2199023255552)       },
+        {"0.25KiB",                256                           },
+        {"1.0009765625KiB",        1025                          },
+        {"2.50MB",                 2500000                       },
+        {"3P",                     UINT64_C(3000000000000000)    },
+        {"15EiB",                  UINT64_C(17293822569102704640)},
+        {"18.446744073709551615E", UINT64_MAX                    },
+    };
+    size_t i;
+
+    for(i = 0; i < sizeof(sizes) / sizeof(sizes[0]); i++)
+    {
+        TEST_ASSERT_EQUAL_UINT64_MESSAGE(sizes[i].bytes, p101_parse_uint64_t_size(env, error, sizes[i].text, 1), sizes[i].text);
+        TEST_ASSERT_FALSE_MESSAGE(p101_error_has_error(error), sizes[i].text);
+    }
+}
+
+static void test_parse_size_checks_the_range_after_scaling(void)
+{
+    static const char *const range[] = {"4294967296", "10G", "4GiB", "4.294967296G", "-1K", "-0"};
+
+    TEST_ASSERT_EQUAL_UINT32(UINT32_MAX, p101_parse_uint32_t_size(env, error, "4.294967295G", 1));
+    TEST_ASSERT_EQUAL_UINT16(UINT16_MAX, p101_parse_uint16_t_size(env, error, "65535B", 1));
+    TEST_ASSERT_EQUAL_UINT8(250, p101_parse_uint8_t_size(env, error, "0.25K", 1));
+    TEST_ASSERT_FALSE(p101_error_has_error(error));
+
+    for(size_t i = 0; i < sizeof(range) / sizeof(range[0]); i++)
+    {
+        reset();
+        TEST_ASSERT_EQUAL_UINT32_MESSAGE(7, p101_parse_uint32_t_size(env, error, range[i], 7), range[i]);
+        TEST_ASSERT_TRUE_MESSAGE(p101_error_is_error(error, P101_ERROR_USER, P101_CONVERT_ERROR_RANGE), range[i]);
+    }
+    reset();
+    TEST_ASSERT_EQUAL_UINT8(7, p101_parse_uint8_t_size(env, error, "0.5KiB", 7));
+    TEST_ASSERT_TRUE(p101_error_is_error(error, P101_ERROR_USER, P101_CONVERT_ERROR_RANGE));
+    reset();
+    TEST_ASSERT_EQUAL_UINT64(7, p101_parse_uint64_t_size(env, error, "16EiB", 7));
+    TEST_ASSERT_TRUE(p101_error_is_error(error, P101_ERROR_USER, P101_CONVERT_ERROR_RANGE));
+    reset();
+    TEST_ASSERT_EQUAL_UINT64(7, p101_parse_uint64_t_size(env, error, "18446744073709551616", 7));
+    TEST_ASSERT_TRUE(p101_error_is_error(error, P101_ERROR_USER, P101_CONVERT_ERROR_RANGE));
+}
+
+static void test_parse_size_rejects_malformed_sizes(void)
+{
+    static const char *const syntax[] = {"", "K", ".5K", "1.K", "1.5", "0.1KiB", "1.0001K", "10 G", "10G ", "10Gb", "10iB", "10KB B", "10X", "1e3", "0x10K", "1.5.5K", "1.00000000000000000001K"};
+
+    for(size_t i = 0; i < sizeof(syntax) / sizeof(syntax[0]); i++)
+    {
+        reset();
+        TEST_ASSERT_EQUAL_UINT64_MESSAGE(7, p101_parse_uint64_t_size(env, error, syntax[i], 7), syntax[i]);
+        TEST_ASSERT_TRUE_MESSAGE(p101_error_is_error(error, P101_ERROR_USER, P101_CONVERT_ERROR_SYNTAX), syntax[i]);
+    }
+    reset();
+    TEST_ASSERT_EQUAL_UINT64(7, p101_parse_uint64_t_size(env, error, NULL, 7));
+    TEST_ASSERT_TRUE(p101_error_has_error(error));
+}
+
+/* ----------------------------------------------------------------- durations */
+
+static void test_parse_duration_reads_simple_and_compound_units(void)
+{
+    static const struct
+    {
+        const char *text;
+        int64_t     nanoseconds;
+    } durations[] = {
+        {"0",                         0                     },
+        {"-0",                        0                     },
+        {"0s",                        0                     },
+        {"250ms",                     250000000             },
+        {"5s",                        INT64_C(5000000000)   },
+        {"1h30m",                     INT64_C(5400000000000)},
+        {"  +2m3s",                   INT64_C(123000000000) },
+        {"1.5h",                      INT64_C(5400000000000)},
+        {"1h0.5m1s",                  INT64_C(3631000000000)},
+        {"1s1h",                      INT64_C(3601000000000)},
+        {"7ns",                       7                     },
+        {"3us",                       3000                  },
+        {"3\xC2\xB5s",                3000                  },
+        {"3\xCE\xBCs",                3000                  },
+        {"1.9ns",                     1                     },
+        {"0.333333333333333333h",     INT64_C(1199999999999)},
+        {"-1.5s",                     INT64_C(-1500000000)  },
+        {".5s",                       500000000             },
+        {"1.s",                       INT64_C(1000000000)   },
+        {"1.h.5m",                    INT64_C(3630000000000)},
+        {"2562047h47m16.854775807s",  INT64_MAX             },
+        {"-2562047h47m16.854775808s", INT64_MIN             },
+    };
+    size_t i;
+
+    for(i = 0; i < sizeof(durations) / sizeof(durations[0]); i++)
+    {
+        TEST_ASSERT_EQUAL_INT64_MESSAGE(durations[i].nanoseconds, p101_parse_duration(env, error, durations[i].text, 1), durations[i].text);
+        TEST_ASSERT_FALSE_MESSAGE(p101_error_has_error(error), durations[i].text);
+    }
+}
+
+static void test_parse_duration_rejects_malformed_and_overflowing_text(void)
+{
+    static const char *const syntax[] = {"", "+", "5", "1h30", "5 s", "5s ", "1h 30m", ".s", "-.s", "1h.m", ".", "5x", "5S", "5sec", "1d", "--5s", "5s-", "0x10s"};
+    static const char *const range[]  = {"2562047h47m16.854775808s", "2562048h", "9223372036854775808ns", "99999999999999999999s", "-2562047h47m16.854775809s", "1h2562047h"};
+
+    for(size_t i = 0; i < sizeof(syntax) / sizeof(syntax[0]); i++)
+    {
+        reset();
+        TEST_ASSERT_EQUAL_INT64_MESSAGE(-7, p101_parse_duration(env, error, syntax[i], -7), syntax[i]);
+        TEST_ASSERT_TRUE_MESSAGE(p101_error_is_error(error, P101_ERROR_USER, P101_CONVERT_ERROR_SYNTAX), syntax[i]);
+    }
+    for(size_t i = 0; i < sizeof(range) / sizeof(range[0]); i++)
+    {
+        reset();
+        TEST_ASSERT_EQUAL_INT64_MESSAGE(-7, p101_parse_duration(env, error, range[i], -7), range[i]);
+        TEST_ASSERT_TRUE_MESSAGE(p101_error_is_error(error, P101_ERROR_USER, P101_CONVERT_ERROR_RANGE), range[i]);
+    }
+    reset();
+    TEST_ASSERT_EQUAL_INT64(-7, p101_parse_duration(env, error, NULL, -7));
+    TEST_ASSERT_TRUE(p101_error_has_error(error));
+}
+
+static void test_parse_duration_timespec_normalises_the_result(void)
+{
+    static const struct timespec fallback = {9, 9};
+    struct timespec              ts;
+
+    ts = p101_parse_duration_timespec(env, error, "1h30m0.25s", fallback);
+    TEST_ASSERT_EQUAL_INT64(5400, (int64_t)ts.tv_sec);
+    TEST_ASSERT_EQUAL_INT64(250000000, ts.tv_nsec);
+    ts = p101_parse_duration_timespec(env, error, "-1.5s", fallback);
+    TEST_ASSERT_EQUAL_INT64(-2, (int64_t)ts.tv_sec);
+    TEST_ASSERT_EQUAL_INT64(500000000, ts.tv_nsec);
+    ts = p101_parse_duration_timespec(env, error, "-250ms", fallback);
+    TEST_ASSERT_EQUAL_INT64(-1, (int64_t)ts.tv_sec);
+    TEST_ASSERT_EQUAL_INT64(750000000, ts.tv_nsec);
+    ts = p101_parse_duration_timespec(env, error, "-2s", fallback);
+    TEST_ASSERT_EQUAL_INT64(-2, (int64_t)ts.tv_sec);
+    TEST_ASSERT_EQUAL_INT64(0, ts.tv_nsec);
+    TEST_ASSERT_FALSE(p101_error_has_error(error));
+
+    ts = p101_parse_duration_timespec(env, error, "5 s", fallback);
+    TEST_ASSERT_EQUAL_INT64(9, (int64_t)ts.tv_sec);
+    TEST_ASSERT_EQUAL_INT64(9, ts.tv_nsec);
+    TEST_ASSERT_TRUE(p101_error_is_error(error, P101_ERROR_USER, P101_CONVERT_ERROR_SYNTAX));
+}
+
+/* ------------------------------------------------------------------ try_parse */
+
+static void test_try_parse_reports_status_without_an_error_object(void)
+{
+    int32_t  value;
+    uint16_t port;
+
+    value = 5;
+    TEST_ASSERT_EQUAL_INT(P101_CONVERT_STATUS_OK, p101_try_parse_int32_t(" -42", &value));
+    TEST_ASSERT_EQUAL_INT32(-42, value);
+    TEST_ASSERT_EQUAL_INT(P101_CONVERT_STATUS_SYNTAX, p101_try_parse_int32_t("42x", &value));
+    TEST_ASSERT_EQUAL_INT(P101_CONVERT_STATUS_SYNTAX, p101_try_parse_int32_t("", &value));
+    TEST_ASSERT_EQUAL_INT(P101_CONVERT_STATUS_SYNTAX, p101_try_parse_int32_t(NULL, &value));
+    TEST_ASSERT_EQUAL_INT(P101_CONVERT_STATUS_RANGE, p101_try_parse_int32_t("2147483648", &value));
+    TEST_ASSERT_EQUAL_INT32(-42, value);
+    TEST_ASSERT_EQUAL_INT(P101_CONVERT_STATUS_RANGE, p101_try_parse_uint16_t("-0", &port));
+    TEST_ASSERT_EQUAL_INT(P101_CONVERT_STATUS_RANGE, p101_try_parse_positive_int("0", NULL));
+    TEST_ASSERT_EQUAL_INT(P101_CONVERT_STATUS_OK, p101_try_parse_negative_int64_t("-9223372036854775808", NULL));
+}
+
+static void test_try_parse_agrees_with_the_raising_parsers(void)
+{
+    static const char *const inputs[] = {"0", "+255", "256", "-1", " 65535", "65536", "12 ", "", "99999999999999999999"};
+    size_t                   i;
+
+    for(i = 0; i < sizeof(inputs) / sizeof(inputs[0]); i++)
+    {
+        uint16_t                 tried;
+        uint16_t                 raised;
+        enum p101_convert_status status;
+
+        tried  = 0;
+        status = p101_try_parse_uint16_t(inputs[i], &tried);
+        reset();
+        raised = p101_parse_uint16_t(env, error, inputs[i], 0);
+        if(status == P101_CONVERT_STATUS_OK)
+        {
+            TEST_ASSERT_FALSE_MESSAGE(p101_error_has_error(error), inputs[i]);
+            TEST_ASSERT_EQUAL_UINT16_MESSAGE(raised, tried, inputs[i]);
+        }
+        else
+        {
+            TEST_ASSERT_TRUE_MESSAGE(p101_error_is_error(error, P101_ERROR_USER, status), inputs[i]);
+        }
+    }
+}
+
+/* -------------------------------------------------------------------- batch */
+
+static void test_parse_array_reports_each_element_separately(void)
+{
+    static const char *const strs[] = {"1", "x", "4294967296", NULL, " +42", "-1", "4294967295"};
+    uint32_t                 out[]  = {0, 7, 7, 7, 0, 7, 0};
+    uint8_t                  status[sizeof(strs) / sizeof(strs[0])];
+
+    TEST_ASSERT_EQUAL_size_t(3, p101_parse_uint32_t_array(env, error, strs, sizeof(strs) / sizeof(strs[0]), out, status));
+    TEST_ASSERT_FALSE(p101_error_has_error(error));
+    TEST_ASSERT_EQUAL_UINT8(0, status[0]);
+    TEST_ASSERT_EQUAL_UINT32(1, out[0]);
+    TEST_ASSERT_EQUAL_UINT8(P101_CONVERT_ERROR_SYNTAX, status[1]);
+    TEST_ASSERT_EQUAL_UINT32(7, out[1]);
+    TEST_ASSERT_EQUAL_UINT8(P101_CONVERT_ERROR_RANGE, status[2]);
+    TEST_ASSERT_EQUAL_UINT32(7, out[2]);
+    TEST_ASSERT_EQUAL_UINT8(P101_CONVERT_ERROR_SYNTAX, status[3]);
+    TEST_ASSERT_EQUAL_UINT32(7, out[3]);
+    TEST_ASSERT_EQUAL_UINT8(0, status[4]);
+    TEST_ASSERT_EQUAL_UINT32(42, out[4]);
+    TEST_ASSERT_EQUAL_UINT8(P101_CONVERT_ERROR_RANGE, status[5]);
+    TEST_ASSERT_EQUAL_UINT32(7, out[5]);
+    TEST_ASSERT_EQUAL_UINT8(0, status[6]);
+    TEST_ASSERT_EQUAL_UINT32(UINT32_MAX, out[6]);
+}
+
+static void test_parse_array_matches_the_single_string_parsers(void)
+{
+    static const char *const strs[] = {"-9223372036854775808", "9223372036854775808", "-129", "127", "12a"};
+    int64_t                  wide[5];
+    int8_t                   narrow[5];
+    uint8_t                  status[5];
+    size_t                   i;
+
+    TEST_ASSERT_EQUAL_size_t(3, p101_parse_int64_t_array(env, error, strs, 5, wide, status));
+    for(i = 0; i < 5; i++)
+    {
+        int64_t single;
+
+        reset();
+        single = p101_parse_int64_t(env, error, strs[i], 0);
+        TEST_ASSERT_EQUAL_MESSAGE(p101_error_has_error(error), status[i] != 0U, strs[i]);
+        if(status[i] == 0U)
+        {
+            TEST_ASSERT_EQUAL_INT64(single, wide[i]);
+        }
+        else
+        {
+            TEST_ASSERT_TRUE_MESSAGE(p101_error_is_error(error, P101_ERROR_USER, (int)status[i]), strs[i]);
+        }
+    }
+    reset();
+    TEST_ASSERT_EQUAL_size_t(1, p101_parse_int8_t_array(env, error, strs, 5, narrow, status));
+    TEST_ASSERT_EQUAL_UINT8(P101_CONVERT_ERROR_RANGE, status[0]);
+    TEST_ASSERT_EQUAL_UINT8(P101_CONVERT_ERROR_RANGE, status[2]);
+    TEST_ASSERT_EQUAL_INT8(INT8_MAX, narrow[3]);
+    TEST_ASSERT_EQUAL_UINT8(P101_CONVERT_ERROR_SYNTAX, status[4]);
+}
+
+static void test_parse_array_null_arrays_raise(void)
+{
+    uint64_t out[1];
+    uint8_t  status[1];
+
+    TEST_ASSERT_EQUAL_size_t(0, p101_parse_uint64_t_array(env, error, NULL, 0, NULL, NULL));
+    TEST_ASSERT_FALSE(p101_error_has_error(error));
+    TEST_ASSERT_EQUAL_size_t(0, p101_parse_uint64_t_array(env, error, NULL, 1, out, status));
+    TEST_ASSERT_TRUE(p101_error_has_error(error));
+}
+
+/* --------------------------------------------------------------------- lists */
+
+static void test_parse_list_splits_and_converts(void)
+{
+    uint64_t ports[4];
+    int64_t  values[4];
+
+    TEST_ASSERT_EQUAL_size_t(3, p101_parse_uint64_t_list(env, error, "80,443,8080", ",", ports, 4));
+    TEST_ASSERT_FALSE(p101_error_has_error(error));
+    TEST_ASSERT_EQUAL_UINT64(80, ports[0]);
+    TEST_ASSERT_EQUAL_UINT64(443, ports[1]);
+    TEST_ASSERT_EQUAL_UINT64(8080, ports[2]);
+    TEST_ASSERT_EQUAL_size_t(4, p101_parse_int64_t_list(env, error, "1 -2,\t+3 -9223372036854775808", " ,", values, 4));
+    TEST_ASSERT_FALSE(p101_error_has_error(error));
+    TEST_ASSERT_EQUAL_INT64(1, values[0]);
+    TEST_ASSERT_EQUAL_INT64(-2, values[1]);
+    TEST_ASSERT_EQUAL_INT64(3, values[2]);
+    TEST_ASSERT_EQUAL_INT64(INT64_MIN, values[3]);
+}
+
+static void test_parse_list_applies_the_per_token_rules(void)
+{
+    static const char *const bad_syntax[] = {"", "1,,2", "1,2,", "1 ,2", "1,x", "1;2"};
+    static const char *const bad_range[]  = {"1,18446744073709551616", "1,-1", "1,2,3,4,5"};
+    uint64_t                 out[4];
+    size_t                   i;
+
+    for(i = 0; i < sizeof(bad_syntax) / sizeof(bad_syntax[0]); i++)
+    {
+        reset();
+        TEST_ASSERT_EQUAL_size_t_MESSAGE(0, p101_parse_uint64_t_list(env, error, bad_syntax[i], ",", out, 4), bad_syntax[i]);
+        TEST_ASSERT_TRUE_MESSAGE(p101_error_is_error(error, P101_ERROR_USER, P101_CONVERT_ERROR_SYNTAX), bad_syntax[i]);
+    }
+    for(i = 0; i < sizeof(bad_range) / sizeof(bad_range[0]); i++)
+    {
+        reset();
+        TEST_ASSERT_EQUAL_size_t_MESSAGE(0, p101_parse_uint64_t_list(env, error, bad_range[i], ",", out, 4), bad_range[i]);
+        TEST_ASSERT_TRUE_MESSAGE(p101_error_is_error(error, P101_ERROR_USER, P101_CONVERT_ERROR_RANGE), bad_range[i]);
+    }
+}
+
+static void test_parse_list_rejects_empty_whitespace_tokens(void)
+{
+    static const struct
+    {
+        const char *text;
+        const char *delimiters;
+    } bad[] = {
+        {"1  2",   " "   },
+        {"1\t\t2", " \t" },
+        {"1 \t2",  " \t" },
+        {" 1 2",   " "   },
+        {"1 2 ",   " "   },
+        {"1, 2",   ", "  },
+        {"1 ,2",   ", "  },
+        {"1,,2",   ", "  },
+    };
+    int64_t out[4];
+    size_t  i;
+
+    TEST_ASSERT_EQUAL_size_t(3, p101_parse_int64_t_list(env, error, "1,2 -3", ", ", out, 4));
+    TEST_ASSERT_FALSE(p101_error_has_error(error));
+    TEST_ASSERT_EQUAL_INT64(-3, out[2]);
+    TEST_ASSERT_EQUAL_size_t(2, p101_parse_int64_t_list(env, error, "1, 2", ",", out, 4));
+    TEST_ASSERT_FALSE(p101_error_has_error(error));
+
+    for(i = 0; i < sizeof(bad) / sizeof(bad[0]); i++)
+    {
+        uint64_t unsigned_out[4];
+
+        reset();
+        TEST_ASSERT_EQUAL_size_t_MESSAGE(0, p101_parse_int64_t_list(env, error, bad[i].text, bad[i].delimiters, out, 4), bad[i].text);
+        TEST_ASSERT_TRUE_MESSAGE(p101_error_is_error(error, P101_ERROR_USER, P101_CONVERT_ERROR_SYNTAX), bad[i].text);
+        reset();
+        TEST_ASSERT_EQUAL_size_t_MESSAGE(0, p101_parse_uint64_t_list(env, error, bad[i].text, bad[i].delimiters, unsigned_out, 4), bad[i].text);
+        TEST_ASSERT_TRUE_MESSAGE(p101_error_is_error(error, P101_ERROR_USER, P101_CONVERT_ERROR_SYNTAX), bad[i].text);
+    }
+}
+
+static void test_parse_list_null_arguments_raise(void)
+{
+    int64_t out[1];
+
+    TEST_ASSERT_EQUAL_size_t(0, p101_parse_int64_t_list(env, error, NULL, ",", out, 1));
+    TEST_ASSERT_TRUE(p101_error_has_error(error));
+    reset();
+    TEST_ASSERT_EQUAL_size_t(0, p101_parse_int64_t_list(env, error, "1", NULL, out, 1));
+    TEST_ASSERT_TRUE(p101_error_has_error(error));
+}
+
+/* ---------------------------------------------------------------- formatting */
+
+static void test_format_every_digit_count_matches_snprintf(void)
+{
+    uint64_t power;
+
+    /* 10^k - 1, 10^k and 10^k + 1 for every k: each side of every change in
+     * the digit count. */
+    for(power = 1;; power *= 10U)
+    {
+        static const int64_t offsets[] = {-1, 0, 1};
+        size_t               i;
+
+        for(i = 0; i < sizeof(offsets) / sizeof(offsets[0]); i++)
+        {
+            uint64_t value;
+            char     expected[P101_INTEGER_TEXT_SIZE];
+            char     text[P101_INTEGER_TEXT_SIZE];
+
+            value = power + (uint64_t)offsets[i];
+            snprintf(expected, sizeof(expected), "%" PRIu64, value);
+            TEST_ASSERT_EQUAL_size_t_MESSAGE(strlen(expected), p101_format_uint64_t(env, error, value, text, sizeof(text)), expected);
+            TEST_ASSERT_EQUAL_STRING(expected, text);
+
+            snprintf(expected, sizeof(expected), "%" PRId64, (int64_t)value);
+            TEST_ASSERT_EQUAL_size_t_MESSAGE(strlen(expected), p101_format_int64_t(env, error, (int64_t)value, text, sizeof(text)), expected);
+            TEST_ASSERT_EQUAL_STRING(expected, text);
+
+            snprintf(expected, sizeof(expected), "%" PRId64, -(int64_t)(value / 2U));
+            TEST_ASSERT_EQUAL_size_t_MESSAGE(strlen(expected), p101_format_int64_t(env, error, -(int64_t)(value / 2U), text, sizeof(text)), expected);
+            TEST_ASSERT_EQUAL_STRING(expected, text);
+        }
+        if(power > UINT64_MAX / 10U)
+        {
+            break;
+        }
+    }
+    TEST_ASSERT_FALSE(p101_error_has_error(error));
+}
+
+static void test_format_writes_the_limits_of_every_type(void)
+{
+    char text[P101_INTEGER_TEXT_SIZE];
+
+    TEST_ASSERT_EQUAL_size_t(20, p101_format_int64_t(env, error, INT64_MIN, text, sizeof(text)));
+    TEST_ASSERT_EQUAL_STRING("-9223372036854775808", text);
+    TEST_ASSERT_EQUAL_size_t(20, p101_format_uint64_t(env, error, UINT64_MAX, text, sizeof(text)));
+    TEST_ASSERT_EQUAL_STRING("18446744073709551615", text);
+    TEST_ASSERT_EQUAL_size_t(1, p101_format_uint64_t(env, error, 0, text, sizeof(text)));
+    TEST_ASSERT_EQUAL_STRING("0", text);
+    p101_format_int8_t(env, error, INT8_MIN, text, sizeof(text));
+    TEST_ASSERT_EQUAL_STRING("-128", text);
+    p101_format_uint8_t(env, error, UINT8_MAX, text, sizeof(text));
+    TEST_ASSERT_EQUAL_STRING("255", text);
+    p101_format_int16_t(env, error, INT16_MIN, text, sizeof(text));
+    TEST_ASSERT_EQUAL_STRING("-32768", text);
+    p101_format_uint16_t(env, error, UINT16_MAX, text, sizeof(text));
+    TEST_ASSERT_EQUAL_STRING("65535", text);
+    p101_format_int32_t(env, error, INT32_MIN, text, sizeof(text));
+    TEST_ASSERT_EQUAL_STRING("-2147483648", text);
+    p101_format_uint32_t(env, error, UINT32_MAX, text, sizeof(text));
+    TEST_ASSERT_EQUAL_STRING("4294967295", text);
+    p101_format_signed_char(env, error, SCHAR_MIN, text, sizeof(text));
+    TEST_ASSERT_EQUAL_STRING("-128", text);
+    p101_format_unsigned_char(env, error, UCHAR_MAX, text, sizeof(text));
+    TEST_ASSERT_EQUAL_STRING("255", text);
+    p101_format_char(env, error, 'A', text, sizeof(text));
+    TEST_ASSERT_EQUAL_STRING("65", text);
+    TEST_ASSERT_FALSE(p101_error_has_error(error));
+}
+
+static void test_format_matches_snprintf_for_the_c_types(void)
+{
+    char text[P101_INTEGER_TEXT_SIZE];
+    char expected[P101_INTEGER_TEXT_SIZE];
+
+    snprintf(expected, sizeof(expected), "%d", SHRT_MIN);
+    p101_format_short(env, error, SHRT_MIN, text, sizeof(text));
+    TEST_ASSERT_EQUAL_STRING(expected, text);
+    snprintf(expected, sizeof(expected), "%u", (unsigned int)USHRT_MAX);
+    p101_format_unsigned_short(env, error, USHRT_MAX, text, sizeof(text));
+    TEST_ASSERT_EQUAL_STRING(expected, text);
+    snprintf(expected, sizeof(expected), "%d", INT_MIN);
+    p101_format_int(env, error, INT_MIN, text, sizeof(text));
+    TEST_ASSERT_EQUAL_STRING(expected, text);
+    snprintf(expected, sizeof(expected), "%u", UINT_MAX);
+    p101_format_unsigned_int(env, error, UINT_MAX, text, sizeof(text));
+    TEST_ASSERT_EQUAL_STRING(expected, text);
+    snprintf(expected, sizeof(expected), "%ld", LONG_MIN);
+    p101_format_long(env, error, LONG_MIN, text, sizeof(text));
+    TEST_ASSERT_EQUAL_STRING(expected, text);
+    snprintf(expected, sizeof(expected), "%lu", ULONG_MAX);
+    p101_format_unsigned_long(env, error, ULONG_MAX, text, sizeof(text));
+    TEST_ASSERT_EQUAL_STRING(expected, text);
+    snprintf(expected, sizeof(expected), "%lld", LLONG_MIN);
+    p101_format_long_long(env, error, LLONG_MIN, text, sizeof(text));
+    TEST_ASSERT_EQUAL_STRING(expected, text);
+    snprintf(expected, sizeof(expected), "%llu", ULLONG_MAX);
+    p101_format_unsigned_long_long(env, error, ULLONG_MAX, text, sizeof(text));
+    TEST_ASSERT_EQUAL_STRING(expected, text);
+    TEST_ASSERT_FALSE(p101_error_has_error(error));
+}
+
+static void test_format_round_trips_through_the_parser(void)
+{
+    static const int32_t values[] = {0, 1, -1, 9, -10, 99, 100, -12345, INT32_MAX, INT32_MIN};
+    size_t               i;
+
+    for(i = 0; i < sizeof(values) / sizeof(values[0]); i++)
+    {
+        char text[P101_INTEGER_TEXT_SIZE];
+
+        TEST_ASSERT_NOT_EQUAL(0, p101_format_int32_t(env, error, values[i], text, sizeof(text)));
+        TEST_ASSERT_EQUAL_INT32(values[i], p101_parse_int32_t(env, error, text, 7));
+        TEST_ASSERT_FALSE(p101_error_has_error(error));
+    }
+}
+
+static void test_format_buffer_too_small_raises_range(void)
+{
+    char text[8];
+
+    TEST_ASSERT_EQUAL_size_t(7, p101_format_int32_t(env, error, -123456, text, 8));
+    TEST_ASSERT_EQUAL_STRING("-123456", text);
+
+    memset(text, 'x', sizeof(text));
+    TEST_ASSERT_EQUAL_size_t(0, p101_format_int32_t(env, error, -123456, text, 7));
+    TEST_ASSERT_TRUE(p101_error_is_error(error, P101_ERROR_USER, P101_CONVERT_ERROR_RANGE));
+    TEST_ASSERT_EQUAL_STRING("", text);
+
+    reset();
+    memset(text, 'x', sizeof(text));
+    TEST_ASSERT_EQUAL_size_t(0, p101_format_uint8_t(env, error, 0, text, 0));
+    TEST_ASSERT_TRUE(p101_error_is_error(error, P101_ERROR_USER, P101_CONVERT_ERROR_RANGE));
+    TEST_ASSERT_EQUAL_CHAR('x', text[0]);
+}
+
+static void test_format_preserves_an_existing_error(void)
+{
+    char text[P101_INTEGER_TEXT_SIZE];
+
+    P101_ERROR_RAISE_USER(error, "sentinel", 99);
+    text[0] = 'x';
+    TEST_ASSERT_EQUAL_size_t(0, p101_format_int32_t(env, error, 42, text, sizeof(text)));
+    TEST_ASSERT_TRUE(p101_error_is_error(error, P101_ERROR_USER, 99));
+    TEST_ASSERT_EQUAL_CHAR('x', text[0]);
+}
+
+static void test_format_null_buffer_raises(void)
+{
+    TEST_ASSERT_EQUAL_size_t(0, p101_format_uint64_t(env, error, 1, NULL, P101_INTEGER_TEXT_SIZE));
+    TEST_ASSERT_TRUE(p101_error_has_error(error));
+}
+
 int main(void)
 {
     UNITY_BEGIN();
@@ -333,6 +1340,11 @@ int main(void)
     RUN_TEST(test_parse_int_rejects_above_max);
     RUN_TEST(test_parse_int_rejects_below_min);
     RUN_TEST(test_parse_int_rejects_intmax_overflow);
+    RUN_TEST(test_parse_long_literals_cross_the_overflow_check_exactly);
+    RUN_TEST(test_parse_finds_a_non_digit_anywhere_in_an_eight_digit_word);
+    RUN_TEST(test_parse_wide_literals_of_every_length);
+    RUN_TEST(test_parse_n_finds_a_non_digit_in_every_lane_of_a_long_field);
+    RUN_TEST(test_parse_int_accepts_every_c_locale_blank);
     RUN_TEST(test_parse_int8_and_int16_ranges);
     RUN_TEST(test_parse_negative_int_requires_a_negative);
     RUN_TEST(test_parse_positive_int_requires_positive);
@@ -343,5 +1355,47 @@ int main(void)
     RUN_TEST(test_null_input_raises_and_returns_default);
     RUN_TEST(test_all_public_integer_widths);
     RUN_TEST(test_negative_char_is_independent_of_plain_char_signedness);
+    RUN_TEST(test_parse_n_reads_only_the_given_field);
+    RUN_TEST(test_parse_n_does_not_need_a_terminator);
+    RUN_TEST(test_parse_n_rejects_trailing_bytes_inside_the_length);
+    RUN_TEST(test_parse_n_rejects_an_empty_field);
+    RUN_TEST(test_parse_n_applies_the_same_range_rules);
+    RUN_TEST(test_parse_n_refuses_negative_unsigned_input);
+    RUN_TEST(test_parse_n_null_input_raises_and_returns_default);
+    RUN_TEST(test_parse_prefix_returns_the_first_unconsumed_byte);
+    RUN_TEST(test_parse_prefix_still_needs_a_digit_and_a_fitting_value);
+    RUN_TEST(test_parse_prefix_null_arguments_raise);
+    RUN_TEST(test_parse_base_reads_each_prefix);
+    RUN_TEST(test_parse_base_rejects_what_the_radix_does_not_allow);
+    RUN_TEST(test_parse_base_decodes_sixteen_digit_ids_like_strtoull);
+    RUN_TEST(test_parse_base_applies_the_target_range);
+    RUN_TEST(test_parse_base_refuses_an_unsupported_base);
+    RUN_TEST(test_parse_uint128_reads_the_full_decimal_range);
+    RUN_TEST(test_parse_uint128_applies_the_integer_rules);
+    RUN_TEST(test_parse_uint128_base_reads_trace_ids_and_prefixes);
+    RUN_TEST(test_parse_hex_id_decodes_trace_and_span_ids);
+    RUN_TEST(test_parse_hex_id_refuses_anything_but_exact_hex);
+    RUN_TEST(test_parse_size_applies_si_and_iec_units);
+    RUN_TEST(test_parse_size_checks_the_range_after_scaling);
+    RUN_TEST(test_parse_size_rejects_malformed_sizes);
+    RUN_TEST(test_parse_duration_reads_simple_and_compound_units);
+    RUN_TEST(test_parse_duration_rejects_malformed_and_overflowing_text);
+    RUN_TEST(test_parse_duration_timespec_normalises_the_result);
+    RUN_TEST(test_try_parse_reports_status_without_an_error_object);
+    RUN_TEST(test_try_parse_agrees_with_the_raising_parsers);
+    RUN_TEST(test_parse_array_reports_each_element_separately);
+    RUN_TEST(test_parse_array_matches_the_single_string_parsers);
+    RUN_TEST(test_parse_array_null_arrays_raise);
+    RUN_TEST(test_parse_list_splits_and_converts);
+    RUN_TEST(test_parse_list_applies_the_per_token_rules);
+    RUN_TEST(test_parse_list_rejects_empty_whitespace_tokens);
+    RUN_TEST(test_parse_list_null_arguments_raise);
+    RUN_TEST(test_format_every_digit_count_matches_snprintf);
+    RUN_TEST(test_format_writes_the_limits_of_every_type);
+    RUN_TEST(test_format_matches_snprintf_for_the_c_types);
+    RUN_TEST(test_format_round_trips_through_the_parser);
+    RUN_TEST(test_format_buffer_too_small_raises_range);
+    RUN_TEST(test_format_preserves_an_existing_error);
+    RUN_TEST(test_format_null_buffer_raises);
     return UNITY_END();
 }
@@ -0,0 +1,359 @@
+/*
+ * Unity tests for src/lpm.c -- the longest-prefix-match table.
+ *
+ * A table answers "which rule covers this address", usually for an ACL or a
+ * route, so a wrong answer silently applies the wrong policy. Beyond a few
+ * hand-picked tables, every lookup is checked against a linear scan of the
+ * prefixes over tables of nested, overlapping and duplicate prefixes in both
+ * families, which is where a compressed trie goes wrong.
+ */
+#include "p101_convert/errors.h"
+#include "unity.h"
+#include <arpa/inet.h>
+#include <netinet/in.h>
+#include <p101_convert/lpm.h>
+#include <p101_convert/networking.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/un.h>
+
+static struct p101_error *error;
+static struct p101_env   *env;
+static void              *memory;
+
+void setUp(void)
+{
+    error  = p101_error_create(false);
+    env    = p101_env_create(error, NULL);
+    memory = NULL;
+}
+
+void tearDown(void)
+{
+    free(memory);
+    p101_env_destroy(env);
+    p101_error_destroy(error);
+}
+
+static const struct p101_lpm *build(const struct p101_cidr *prefixes, size_t count)
+{
+    const struct p101_lpm *lpm;
+    size_t                 size;
+
+    size = p101_lpm_size(env, error, prefixes, count);
+    TEST_ASSERT_FALSE(p101_error_has_error(error));
+    TEST_ASSERT_NOT_EQUAL(0, size);
+    free(memory);
+    memory = malloc(size);
+    TEST_ASSERT_NOT_NULL(memory);
+    lpm = p101_lpm_build(env, error, prefixes, count, memory, size);
+    TEST_ASSERT_FALSE(p101_error_has_error(error));
+    TEST_ASSERT_EQUAL_PTR(memory, lpm);
+    return lpm;
+}
+
+static size_t lookup_text(const struct p101_lpm *lpm, const char *text)
+{
+    struct sockaddr_storage     addr;
+    struct p101_compact_address compact;
+    size_t                      index;
+
+    TEST_ASSERT_NOT_EQUAL(0, p101_convert_address(env, error, text, &addr));
+    TEST_ASSERT_TRUE(p101_convert_compact_address(env, error, text, &compact));
+    index = p101_lpm_lookup(env, error, lpm, (const struct sockaddr *)&addr);
+    TEST_ASSERT_FALSE(p101_error_has_error(error));
+    TEST_ASSERT_EQUAL_size_t(index, p101_lpm_lookup_compact(env, error, lpm, &compact));
+    TEST_ASSERT_FALSE(p101_error_has_error(error));
+    return index;
+}
+
+/* ------------------------------------------------------------ lookups */
+
+static void test_lpm_finds_the_longest_prefix(void)
+{
+    static const char *const cidrs[] = {
+        "10.0.0.0/8",
+        "10.1.0.0/16",
+        "10.1.2.0/24",
+        "0.0.0.0/0",
+        "2001:db8::/32",
+        "2001:db8:1::/48",
+        "::1/128",
+        "10.1.2.3/32",
+        "10.1.2.128/25",
+    };
+    struct p101_cidr       prefixes[sizeof(cidrs) / sizeof(cidrs[0])];
+    const struct p101_lpm *lpm;
+
+    for(size_t i = 0; i < sizeof(cidrs) / sizeof(cidrs[0]); i++)
+    {
+        TEST_ASSERT_TRUE(p101_convert_cidr(env, error, cidrs[i], true, &prefixes[i]));
+    }
+    lpm = build(prefixes, sizeof(prefixes) / sizeof(prefixes[0]));
+
+    TEST_ASSERT_EQUAL_size_t(0, lookup_text(lpm, "10.200.0.1"));
+    TEST_ASSERT_EQUAL_size_t(1, lookup_text(lpm, "10.1.255.255"));
+    TEST_ASSERT_EQUAL_size_t(2, lookup_text(lpm, "10.1.2.0"));
+    TEST_ASSERT_EQUAL_size_t(2, lookup_text(lpm, "10.1.2.127"));
+    TEST_ASSERT_EQUAL_size_t(7, lookup_text(lpm, "10.1.2.3"));
+    TEST_ASSERT_EQUAL_size_t(8, lookup_text(lpm, "10.1.2.128"));
+    TEST_ASSERT_EQUAL_size_t(3, lookup_text(lpm, "192.0.2.1"));
+    TEST_ASSERT_EQUAL_size_t(3, lookup_text(lpm, "255.255.255.255"));
+    TEST_ASSERT_EQUAL_size_t(4, lookup_text(lpm, "2001:db8:ffff::1"));
+    TEST_ASSERT_EQUAL_size_t(5, lookup_text(lpm, "2001:db8:1:2::3"));
+    TEST_ASSERT_EQUAL_size_t(6, lookup_text(lpm, "::1"));
+    TEST_ASSERT_EQUAL_size_t(P101_LPM_NO_MATCH, lookup_text(lpm, "::2"));
+    TEST_ASSERT_EQUAL_size_t(P101_LPM_NO_MATCH, lookup_text(lpm, "2001:db9::"));
+}
+
+static void test_lpm_reports_the_first_duplicate(void)
+{
+    struct p101_cidr       prefixes[3];
+    const struct p101_lpm *lpm;
+
+    TEST_ASSERT_TRUE(p101_convert_cidr(env, error, "192.0.2.0/24", true, &prefixes[0]));
+    TEST_ASSERT_TRUE(p101_convert_cidr(env, error, "192.0.2.0/24", true, &prefixes[1]));
+    TEST_ASSERT_TRUE(p101_convert_cidr(env, error, "192.0.2.0/24", true, &prefixes[2]));
+    lpm = build(prefixes, 3);
+    TEST_ASSERT_EQUAL_size_t(0, lookup_text(lpm, "192.0.2.99"));
+}
+
+static void test_lpm_empty_and_single_family_tables(void)
+{
+    struct p101_cidr       prefix;
+    const struct p101_lpm *lpm;
+
+    lpm = build(NULL, 0);
+    TEST_ASSERT_EQUAL_size_t(P101_LPM_NO_MATCH, lookup_text(lpm, "0.0.0.0"));
+    TEST_ASSERT_EQUAL_size_t(P101_LPM_NO_MATCH, lookup_text(lpm, "::"));
+
+    TEST_ASSERT_TRUE(p101_convert_cidr(env, error, "::/0", true, &prefix));
+    lpm = build(&prefix, 1);
+    TEST_ASSERT_EQUAL_size_t(P101_LPM_NO_MATCH, lookup_text(lpm, "1.2.3.4"));
+    TEST_ASSERT_EQUAL_size_t(0, lookup_text(lpm, "ffff::1"));
+}
+
+/* A small LCG so the tables are the same on every run and platform. */
+static uint32_t next_random(uint32_t *state)
+{
+    *state = (*state * 1664525U) + 1013904223U;
+    return *state >> 8U;
+}
+
+static bool covers(const struct p101_cidr *prefix, const struct p101_compact_address *address)
+{
+    unsigned int length;
+    unsigned int i;
+
+    if(prefix->network.family != address->family)
+    {
+        return false;
+    }
+
+    length = prefix->prefix_length;
+    for(i = 0; i < length / 8U; i++)
+    {
+        if(prefix->network.address[i] != address->address[i])
+        {
+            return false;
+        }
+    }
+
+    return length % 8U == 0U || ((prefix->network.address[i] ^ address->address[i]) & (0xFFU << (8U - length % 8U)) & 0xFFU) == 0U;
+}
+
+static size_t scan(const struct p101_cidr *prefixes, size_t count, const struct p101_compact_address *address)
+{
+    size_t best;
+
+    best = P101_LPM_NO_MATCH;
+    for(size_t i = 0; i < count; i++)
+    {
+        if(covers(&prefixes[i], address) && (best == P101_LPM_NO_MATCH || prefixes[i].prefix_length > prefixes[best].prefix_length))
+        {
+            best = i;
+        }
+    }
+
+    return best;
+}
+
+/* Random bits drawn from a few fixed networks so prefixes nest and collide. */
+static void random_address(uint32_t *state, uint8_t family, struct p101_compact_address *address)
+{
+    static const uint8_t bases[4][16] = {
+        {10,   0,    0, 0},
+        {192,  168,  1, 0},
+        {0x20, 0x01, 0x0D, 0xB8},
+        {0xFE, 0x80},
+    };
+    unsigned int size;
+    unsigned int fixed;
+
+    memset(address, 0, sizeof(*address));
+    address->family = family;
+    size            = family == P101_COMPACT_ADDRESS_IPV4 ? 4U : 16U;
+    fixed           = next_random(state) % (size / 2U + 1U);
+    for(unsigned int i = 0; i < size; i++)
+    {
+        address->address[i] = i < fixed ? bases[(family == P101_COMPACT_ADDRESS_IPV4 ? 0U : 2U) + (next_random(state) & 1U)][i] : (uint8_t)next_random(state);
+    }
+}
+
+static void test_lpm_matches_a_linear_scan(void)
+{
+    enum
+    {
+        PREFIXES = 3000,
+        LOOKUPS  = 20000
+    };
+    static struct p101_cidr prefixes[PREFIXES];
+    const struct p101_lpm  *lpm;
+    uint32_t                state;
+
+    state = 101;
+    for(size_t i = 0; i < PREFIXES; i++)
+    {
+        uint8_t      family;
+        unsigned int length;
+
+        memset(&prefixes[i], 0, sizeof(prefixes[i]));
+        family = (next_random(&state) & 1U) != 0U ? P101_COMPACT_ADDRESS_IPV4 : P101_COMPACT_ADDRESS_IPV6;
+        length = next_random(&state) % ((family == P101_COMPACT_ADDRESS_IPV4 ? 32U : 128U) + 1U);
+        random_address(&state, family, &prefixes[i].network);
+        prefixes[i].prefix_length = (uint8_t)length;
+        for(unsigned int bit = length; bit < 128U; bit++)
+        {
+            prefixes[i].network.address[bit / 8U] &= (uint8_t) ~(0x80U >> (bit % 8U));
+        }
+        if(i % 10U == 9U)
+        {
+            prefixes[i] = prefixes[next_random(&state) % i];
+        }
+    }
+    lpm = build(prefixes, PREFIXES);
+
+    for(size_t i = 0; i < LOOKUPS; i++)
+    {
+        struct p101_compact_address address;
+
+        if(i % 2U == 0U)
+        {
+            address = prefixes[next_random(&state) % PREFIXES].network;
+            address.address[(next_random(&state) % (address.family == P101_COMPACT_ADDRESS_IPV4 ? 4U : 16U))] ^= (uint8_t)next_random(&state);
+        }
+        else
+        {
+            random_address(&state, (next_random(&state) & 1U) != 0U ? P101_COMPACT_ADDRESS_IPV4 : P101_COMPACT_ADDRESS_IPV6, &address);
+        }
+        TEST_ASSERT_EQUAL_size_t(scan(prefixes, PREFIXES, &address), p101_lpm_lookup_compact(env, error, lpm, &address));
+    }
+}
+
+/* ------------------------------------------------------------ errors */
+
+static void test_lpm_rejects_bad_prefixes(void)
+{
+    struct p101_cidr prefix;
+
+    memset(&prefix, 0, sizeof(prefix));
+    TEST_ASSERT_EQUAL_size_t(0, p101_lpm_size(env, error, &prefix, 1));
+    TEST_ASSERT_TRUE(p101_error_is_error(error, P101_ERROR_USER, P101_CONVERT_ERROR_ADDRESS));
+    p101_error_reset(error);
+
+    prefix.network.family = P101_COMPACT_ADDRESS_IPV4;
+    prefix.prefix_length  = 33;
+    TEST_ASSERT_EQUAL_size_t(0, p101_lpm_size(env, error, &prefix, 1));
+    TEST_ASSERT_TRUE(p101_error_is_error(error, P101_ERROR_USER, P101_CONVERT_ERROR_ADDRESS));
+    p101_error_reset(error);
+
+    TEST_ASSERT_TRUE(p101_convert_cidr(env, error, "10.1.2.3/8", false, &prefix));
+    prefix.network.address[3] = 3;
+    TEST_ASSERT_EQUAL_size_t(0, p101_lpm_size(env, error, &prefix, 1));
+    TEST_ASSERT_TRUE(p101_error_is_error(error, P101_ERROR_USER, P101_CONVERT_ERROR_ADDRESS));
+    p101_error_reset(error);
+
+    TEST_ASSERT_EQUAL_size_t(0, p101_lpm_size(env, error, NULL, 1));
+    TEST_ASSERT_TRUE(p101_error_has_error(error));
+}
+
+static void test_lpm_build_checks_the_memory(void)
+{
+    struct p101_cidr prefix;
+    size_t           size;
+
+    TEST_ASSERT_TRUE(p101_convert_cidr(env, error, "10.0.0.0/8", true, &prefix));
+    size   = p101_lpm_size(env, error, &prefix, 1);
+    memory = malloc(size);
+    TEST_ASSERT_NOT_NULL(memory);
+
+    TEST_ASSERT_NULL(p101_lpm_build(env, error, &prefix, 1, memory, size - 1U));
+    TEST_ASSERT_TRUE(p101_error_is_error(error, P101_ERROR_USER, P101_CONVERT_ERROR_RANGE));
+    p101_error_reset(error);
+
+    TEST_ASSERT_NULL(p101_lpm_build(env, error, &prefix, 1, (char *)memory + 1, size - 1U));
+    TEST_ASSERT_TRUE(p101_error_has_error(error));
+    p101_error_reset(error);
+
+    TEST_ASSERT_NULL(p101_lpm_build(env, error, &prefix, 1, NULL, size));
+    TEST_ASSERT_TRUE(p101_error_has_error(error));
+}
+
+static void test_lpm_lookup_rejects_other_families(void)
+{
+    struct sockaddr_un          sun;
+    struct p101_compact_address compact;
+    const struct p101_lpm      *lpm;
+
+    lpm = build(NULL, 0);
+    memset(&sun, 0, sizeof(sun));
+    sun.sun_family = AF_UNIX;
+    TEST_ASSERT_EQUAL_size_t(P101_LPM_NO_MATCH, p101_lpm_lookup(env, error, lpm, (const struct sockaddr *)&sun));
+    TEST_ASSERT_TRUE(p101_error_is_error(error, P101_ERROR_USER, P101_CONVERT_ERROR_ADDRESS));
+    p101_error_reset(error);
+
+    memset(&compact, 0, sizeof(compact));
+    TEST_ASSERT_EQUAL_size_t(P101_LPM_NO_MATCH, p101_lpm_lookup_compact(env, error, lpm, &compact));
+    TEST_ASSERT_TRUE(p101_error_is_error(error, P101_ERROR_USER, P101_CONVERT_ERROR_ADDRESS));
+    p101_error_reset(error);
+
+    TEST_ASSERT_EQUAL_size_t(P101_LPM_NO_MATCH, p101_lpm_lookup(env, error, NULL, (const struct sockaddr *)&sun));
+    TEST_ASSERT_TRUE(p101_error_has_error(error));
+}
+
+static void test_lpm_preserves_an_existing_error(void)
+{
+    struct p101_cidr            prefix;
+    struct sockaddr_storage     addr;
+    struct p101_compact_address compact;
+    const struct p101_lpm      *lpm;
+    size_t                      size;
+
+    TEST_ASSERT_TRUE(p101_convert_cidr(env, error, "10.0.0.0/8", true, &prefix));
+    TEST_ASSERT_NOT_EQUAL(0, p101_convert_address(env, error, "10.1.2.3", &addr));
+    TEST_ASSERT_TRUE(p101_convert_compact_address(env, error, "10.1.2.3", &compact));
+    size = p101_lpm_size(env, error, &prefix, 1);
+    lpm  = build(&prefix, 1);
+
+    P101_ERROR_RAISE_USER(error, "sentinel", 99);
+    TEST_ASSERT_EQUAL_size_t(0, p101_lpm_size(env, error, &prefix, 1));
+    TEST_ASSERT_NULL(p101_lpm_build(env, error, &prefix, 1, memory, size));
+    TEST_ASSERT_EQUAL_size_t(P101_LPM_NO_MATCH, p101_lpm_lookup(env, error, lpm, (const struct sockaddr *)&addr));
+    TEST_ASSERT_EQUAL_size_t(P101_LPM_NO_MATCH, p101_lpm_lookup_compact(env, error, lpm, &compact));
+    TEST_ASSERT_TRUE(p101_error_is_error(error, P101_ERROR_USER, 99));
+}
+
+int main(void)
+{
+    UNITY_BEGIN();
+    RUN_TEST(test_lpm_finds_the_longest_prefix);
+    RUN_TEST(test_lpm_reports_the_first_duplicate);
+    RUN_TEST(test_lpm_empty_and_single_family_tables);
+    RUN_TEST(test_lpm_matches_a_linear_scan);
+    RUN_TEST(test_lpm_rejects_bad_prefixes);
+    RUN_TEST(test_lpm_build_checks_the_memory);
+    RUN_TEST(test_lpm_lookup_rejects_other_families);
+    RUN_TEST(test_lpm_preserves_an_existing_error);
+    return UNITY_END();
+}
@@ -124,6 +124,29 @@ static void test_convert_address_ipv4_edges(void)
     TEST_ASSERT_EQUAL_INT(AF_INET, addr.ss_family);
 }
 
+static void test_convert_address_ipv4_stores_each_octet_in_order(void)
+{
+    /* The octets are stored as they are scanned, so a distinct value in every
+     * position catches a byte landing in the wrong place. */
+    static const char *const literals[] = {"1.2.3.4", "10.0.0.255", "255.0.0.1", "0.128.64.32", "9.99.199.249"};
+    size_t                   i;
+
+    for(i = 0; i < sizeof(literals) / sizeof(literals[0]); i++)
+    {
+        struct sockaddr_storage   addr;
+        struct in_addr            expected;
+        const struct sockaddr_in *got;
+
+        poison(&addr);
+        TEST_ASSERT_EQUAL_UINT_MESSAGE(sizeof(struct sockaddr_in), p101_convert_address(env, error, literals[i], &addr), literals[i]);
+        TEST_ASSERT_FALSE_MESSAGE(p101_error_has_error(error), literals[i]);
+        TEST_ASSERT_EQUAL_INT(1, inet_pton(AF_INET, literals[i], &expected));
+        got = (const struct sockaddr_in *)(const void *)&addr;
+        TEST_ASSERT_EQUAL_MEMORY_MESSAGE(&expected, &got->sin_addr, sizeof(expected), literals[i]);
+        TEST_ASSERT_EQUAL_UINT16_MESSAGE(0, got->sin_port, literals[i]);
+    }
+}
+
 static void test_convert_address_ipv6(void)
 {
     struct sockaddr_storage    addr;
@@ -154,10 +177,49 @@ static void test_convert_address_ipv6_loopback(void)
     TEST_ASSERT_EQUAL_INT(AF_INET6, addr.ss_family);
 }
 
+static void test_convert_address_ipv6_forms(void)
+{
+    /* Every shape RFC 4291 allows: full, "::" at the start, middle and end,
+     * mixed case, and an embedded IPv4 tail with and without compression. */
+    static const char *const literals[] = {"1:2:3:4:5:6:7:8", "::", "::2:3:4:5:6:7:8", "1:2:3:4:5:6:7::", "2001:DB8:0:0:8:800:200C:417A", "ff01::101", "fe80::", "1:2:3:4:5:6:1.2.3.4", "::13.1.68.3", "::FFFF:129.144.52.38", "0:0:0:0:0:0:0:0"};
+    size_t                   i;
+
+    for(i = 0; i < sizeof(literals) / sizeof(literals[0]); i++)
+    {
+        struct sockaddr_storage    addr;
+        struct in6_addr            expected;
+        const struct sockaddr_in6 *got;
+
+        poison(&addr);
+        TEST_ASSERT_EQUAL_UINT_MESSAGE(sizeof(struct sockaddr_in6), p101_convert_address(env, error, literals[i], &addr), literals[i]);
+        TEST_ASSERT_FALSE_MESSAGE(p101_error_has_error(error), literals[i]);
+        TEST_ASSERT_EQUAL_INT(1, inet_pton(AF_INET6, literals[i], &expected));
+        got = (const struct sockaddr_in6 *)(const void *)&addr;
+        TEST_ASSERT_EQUAL_MEMORY_MESSAGE(&expected, &got->sin6_addr, sizeof(expected), literals[i]);
+    }
+}
+
+static void test_convert_address_rejects_malformed_ipv6(void)
+{
+    /* Each breaks exactly one rule: group count, "::" count or width, group
+     * length, colon placement, the IPv4 tail, or a zone suffix. */
+    static const char *const not_ipv6[] = {"1:2:3:4:5:6:7:8:9", "1:2:3:4:5:6:7::8", "1::2::3", ":::", ":1::", "1:", "12345::", "::g", "1:2:3:4:5:6:7:1.2.3.4", "::01.2.3.4", "::1.2.3", "::1.2.3.4:5", "fe80::1%eth0"};
+    size_t                   i;
+    struct sockaddr_storage  addr;
+
+    for(i = 0; i < sizeof(not_ipv6) / sizeof(not_ipv6[0]); i++)
+    {
+        poison(&addr);
+        TEST_ASSERT_EQUAL_UINT_MESSAGE(0, p101_convert_address(env, error, not_ipv6[i], &addr), not_ipv6[i]);
+        TEST_ASSERT_EQUAL_INT_MESSAGE(AF_UNSPEC, addr.ss_family, not_ipv6[i]);
+        TEST_ASSERT_TRUE_MESSAGE(p101_error_is_error(error, P101_ERROR_USER, P101_CONVERT_ERROR_ADDRESS), not_ipv6[i]);
+    }
+}
+
 static void test_convert_address_is_not_confused_by_near_misses(void)
 {
-    /* These are NOT valid IPv4 -- inet_pton is stricter than inet_addr, which
-     * is exactly why the library uses it. None may come back as AF_INET. */
+    /* These are NOT valid IPv4 -- the library follows inet_pton, which is
+     * stricter than inet_addr. None may come back as AF_INET. */
     static const char *const not_ipv4[] = {"1.2.3", "1.2.3.4.5", "256.1.1.1", "01.02.03.04", "1.2.3.4 ", "1.2.3.4x", "0x7f.0.0.1", "localhost"};
     size_t                   i;
     struct sockaddr_storage  addr;
@@ -190,6 +252,23 @@ static void test_convert_address_unix_path(void)
 #endif
 }
 
+static void test_convert_address_unix_path_made_of_address_characters(void)
+{
+    /* The '/' decides the family, however much of the rest looks like an
+     * IPv4 or IPv6 literal. */
+    static const char *const paths[] = {"./1.2.3.4", "/::1", "1.2.3.4/", "fe80::/sock", "./0"};
+    size_t                   i;
+    struct sockaddr_storage  addr;
+
+    for(i = 0; i < sizeof(paths) / sizeof(paths[0]); i++)
+    {
+        poison(&addr);
+        TEST_ASSERT_EQUAL_UINT_MESSAGE(offsetof(struct sockaddr_un, sun_path) + strlen(paths[i]) + 1U, p101_convert_address(env, error, paths[i], &addr), paths[i]);
+        TEST_ASSERT_FALSE_MESSAGE(p101_error_has_error(error), paths[i]);
+        TEST_ASSERT_EQUAL_INT_MESSAGE(AF_UNIX, addr.ss_family, paths[i]);
+    }
+}
+
 static void test_convert_address_unix_path_at_the_limit(void)
 {
     struct sockaddr_storage addr;
@@ -258,6 +337,588 @@ static void test_convert_address_preserves_an_existing_error(void)
     TEST_ASSERT_EQUAL_INT(AF_UNSPEC, addr.ss_family);
 }
 
+/* ------------------------------------------------------------ p101_convert_address_array */
+
+static void test_convert_address_array_matches_single_conversions(void)
+{
+    static const char *const addresses[] = {"10.1.2.3", "fe80::1", "/tmp/p101.sock", "01.2.3.4", "::ffff:1.2.3.4", "localhost", NULL, "./s"};
+    struct sockaddr_storage  out[sizeof(addresses) / sizeof(addresses[0])];
+    socklen_t                lengths[sizeof(addresses) / sizeof(addresses[0])];
+    uint8_t                  status[sizeof(addresses) / sizeof(addresses[0])];
+    size_t                   i;
+
+    memset(out, 0xA5, sizeof(out));
+    TEST_ASSERT_EQUAL_size_t(5, p101_convert_address_array(env, error, addresses, sizeof(addresses) / sizeof(addresses[0]), out, lengths, status));
+    TEST_ASSERT_FALSE(p101_error_has_error(error));
+
+    for(i = 0; i < sizeof(addresses) / sizeof(addresses[0]); i++)
+    {
+        struct sockaddr_storage expected;
+        socklen_t               expected_length;
+
+        poison(&expected);
+        expected_length = p101_convert_address(env, error, addresses[i], &expected);
+        p101_error_reset(error);
+        TEST_ASSERT_EQUAL_UINT_MESSAGE(expected_length, lengths[i], addresses[i]);
+        TEST_ASSERT_EQUAL_INT_MESSAGE(expected.ss_family, out[i].ss_family, addresses[i]);
+        TEST_ASSERT_EQUAL_UINT8_MESSAGE(expected_length == 0 ? P101_CONVERT_STATUS_ADDRESS : P101_CONVERT_STATUS_OK, status[i], addresses[i]);
+        if(expected_length != 0)
+        {
+            TEST_ASSERT_EQUAL_MEMORY_MESSAGE(&expected, &out[i], expected_length, addresses[i]);
+        }
+    }
+}
+
+static void test_convert_address_array_zeroes_only_the_family_sockaddr(void)
+{
+    static const char *const addresses[] = {"192.0.2.1"};
+    struct sockaddr_storage  out[1];
+    socklen_t                lengths[1];
+    uint8_t                  status[1];
+    const unsigned char     *bytes;
+    size_t                   i;
+
+    memset(out, 0xA5, sizeof(out));
+    TEST_ASSERT_EQUAL_size_t(1, p101_convert_address_array(env, error, addresses, 1, out, lengths, status));
+    bytes = (const unsigned char *)&out[0];
+    for(i = sizeof(struct sockaddr_in); i < sizeof(out[0]); i++)
+    {
+        TEST_ASSERT_EQUAL_HEX8(0xA5, bytes[i]);
+    }
+    TEST_ASSERT_EACH_EQUAL_HEX8(0, ((const struct sockaddr_in *)(const void *)&out[0])->sin_zero, sizeof(((struct sockaddr_in *)NULL)->sin_zero));
+}
+
+static void test_convert_address_array_null_arrays_raise(void)
+{
+    static const char *const addresses[] = {"::1"};
+    struct sockaddr_storage  out[1];
+    uint8_t                  status[1];
+
+    TEST_ASSERT_EQUAL_size_t(0, p101_convert_address_array(env, error, addresses, 1, out, NULL, status));
+    TEST_ASSERT_TRUE(p101_error_has_error(error));
+    p101_error_reset(error);
+
+    TEST_ASSERT_EQUAL_size_t(0, p101_convert_address_array(env, error, NULL, 0, NULL, NULL, NULL));
+    TEST_ASSERT_FALSE(p101_error_has_error(error));
+}
+
+/* ------------------------------------------------------------ p101_convert_endpoint */
+
+static void test_convert_endpoint_ipv4(void)
+{
+    static const char         endpoint[] = "10.0.0.1:8080";
+    struct sockaddr_storage   addr;
+    struct in_addr            expected;
+    const struct sockaddr_in *got;
+
+    poison(&addr);
+    TEST_ASSERT_EQUAL_UINT(sizeof(struct sockaddr_in), p101_convert_endpoint(env, error, endpoint, sizeof(endpoint) - 1, &addr));
+    TEST_ASSERT_FALSE(p101_error_has_error(error));
+    got = (const struct sockaddr_in *)(const void *)&addr;
+    TEST_ASSERT_EQUAL_INT(AF_INET, got->sin_family);
+    TEST_ASSERT_EQUAL_UINT16(htons(8080), got->sin_port);
+    TEST_ASSERT_EQUAL_INT(1, inet_pton(AF_INET, "10.0.0.1", &expected));
+    TEST_ASSERT_EQUAL_MEMORY(&expected, &got->sin_addr, sizeof(expected));
+}
+
+static void test_convert_endpoint_bracketed_ipv6(void)
+{
+    static const char          endpoint[] = "[2001:db8::1]:443";
+    struct sockaddr_storage    addr;
+    struct in6_addr            expected;
+    const struct sockaddr_in6 *got;
+
+    poison(&addr);
+    TEST_ASSERT_EQUAL_UINT(sizeof(struct sockaddr_in6), p101_convert_endpoint(env, error, endpoint, sizeof(endpoint) - 1, &addr));
+    TEST_ASSERT_FALSE(p101_error_has_error(error));
+    got = (const struct sockaddr_in6 *)(const void *)&addr;
+    TEST_ASSERT_EQUAL_INT(AF_INET6, got->sin6_family);
+    TEST_ASSERT_EQUAL_UINT16(htons(443), got->sin6_port);
+    TEST_ASSERT_EQUAL_INT(1, inet_pton(AF_INET6, "2001:db8::1", &expected));
+    TEST_ASSERT_EQUAL_MEMORY(&expected, &got->sin6_addr, sizeof(expected));
+}
+
+static void test_convert_endpoint_reads_only_length_bytes(void)
+{
+    /* Two endpoints back to back with no terminator between them: each
+     * length must end the parse exactly where it says. */
+    static const char       buffer[] = {'1', '.', '2', '.', '3', '.', '4', ':', '8', '0', '[', ':', ':', '1', ']', ':', '6', '5', '5', '3', '5'};
+    struct sockaddr_storage addr;
+
+    poison(&addr);
+    TEST_ASSERT_EQUAL_UINT(sizeof(struct sockaddr_in), p101_convert_endpoint(env, error, buffer, 10, &addr));
+    TEST_ASSERT_EQUAL_UINT16(htons(80), ((const struct sockaddr_in *)(const void *)&addr)->sin_port);
+
+    poison(&addr);
+    TEST_ASSERT_EQUAL_UINT(sizeof(struct sockaddr_in6), p101_convert_endpoint(env, error, buffer + 10, sizeof(buffer) - 10, &addr));
+    TEST_ASSERT_EQUAL_UINT16(htons(65535), ((const struct sockaddr_in6 *)(const void *)&addr)->sin6_port);
+}
+
+static void test_convert_endpoint_rejects_bad_addresses(void)
+{
+    static const char *const bad[] = {"2001:db8::1:443", "[1.2.3.4]:80", "[::1:80", "::1]:80", "01.2.3.4:80", "localhost:80", "/tmp/sock:80", ":80", "[]:80"};
+    struct sockaddr_storage  addr;
+    size_t                   i;
+
+    for(i = 0; i < sizeof(bad) / sizeof(bad[0]); i++)
+    {
+        poison(&addr);
+        TEST_ASSERT_EQUAL_UINT_MESSAGE(0, p101_convert_endpoint(env, error, bad[i], strlen(bad[i]), &addr), bad[i]);
+        TEST_ASSERT_EQUAL_INT_MESSAGE(AF_UNSPEC, addr.ss_family, bad[i]);
+        TEST_ASSERT_TRUE_MESSAGE(p101_error_is_error(error, P101_ERROR_USER, P101_CONVERT_ERROR_ADDRESS), bad[i]);
+    }
+}
+
+static void test_convert_endpoint_rejects_bad_ports(void)
+{
+    static const char *const syntax[] = {"1.2.3.4", "1.2.3.4:", "1.2.3.4:+80", "1.2.3.4: 80", "1.2.3.4:80x", "[::1]:99999x", "[::1]"};
+    static const char *const range[]  = {"1.2.3.4:65536", "[::1]:100000", "1.2.3.4:99999999999999999999"};
+    struct sockaddr_storage  addr;
+    size_t                   i;
+
+    for(i = 0; i < sizeof(syntax) / sizeof(syntax[0]); i++)
+    {
+        poison(&addr);
+        TEST_ASSERT_EQUAL_UINT_MESSAGE(0, p101_convert_endpoint(env, error, syntax[i], strlen(syntax[i]), &addr), syntax[i]);
+        TEST_ASSERT_TRUE_MESSAGE(p101_error_is_error(error, P101_ERROR_USER, P101_CONVERT_ERROR_SYNTAX), syntax[i]);
+    }
+    for(i = 0; i < sizeof(range) / sizeof(range[0]); i++)
+    {
+        poison(&addr);
+        TEST_ASSERT_EQUAL_UINT_MESSAGE(0, p101_convert_endpoint(env, error, range[i], strlen(range[i]), &addr), range[i]);
+        TEST_ASSERT_TRUE_MESSAGE(p101_error_is_error(error, P101_ERROR_USER, P101_CONVERT_ERROR_RANGE), range[i]);
+    }
+}
+
+/* ------------------------------------------------------------ p101_convert_cidr */
+
+static void test_convert_cidr_ipv4_and_ipv6(void)
+{
+    static const struct
+    {
+        const char *cidr;
+        const char *network;
+        int         family;
+        uint8_t     prefix_length;
+    } cases[] = {
+        {"10.0.0.0/8",        "10.0.0.0",       AF_INET,  8  },
+        {"192.168.1.0/24",    "192.168.1.0",    AF_INET,  24 },
+        {"0.0.0.0/0",         "0.0.0.0",        AF_INET,  0  },
+        {"192.0.2.1/32",      "192.0.2.1",      AF_INET,  32 },
+        {"2001:db8::/32",     "2001:db8::",     AF_INET6, 32 },
+        {"fe80::/10",         "fe80::",         AF_INET6, 10 },
+        {"::/0",              "::",             AF_INET6, 0  },
+        {"2001:db8::1/128",   "2001:db8::1",    AF_INET6, 128},
+        {"::ffff:0.0.0.0/96", "::ffff:0.0.0.0", AF_INET6, 96 },
+    };
+    size_t i;
+
+    for(i = 0; i < sizeof(cases) / sizeof(cases[0]); i++)
+    {
+        struct p101_cidr cidr;
+        uint8_t          expected[16] = {0};
+
+        memset(&cidr, 0xA5, sizeof(cidr));
+        TEST_ASSERT_TRUE_MESSAGE(p101_convert_cidr(env, error, cases[i].cidr, true, &cidr), cases[i].cidr);
+        TEST_ASSERT_FALSE_MESSAGE(p101_error_has_error(error), cases[i].cidr);
+        TEST_ASSERT_EQUAL_INT(1, inet_pton(cases[i].family, cases[i].network, expected));
+        TEST_ASSERT_EQUAL_UINT8_MESSAGE(cases[i].family == AF_INET ? P101_COMPACT_ADDRESS_IPV4 : P101_COMPACT_ADDRESS_IPV6, cidr.network.family, cases[i].cidr);
+        TEST_ASSERT_EQUAL_MEMORY_MESSAGE(expected, cidr.network.address, sizeof(expected), cases[i].cidr);
+        TEST_ASSERT_EQUAL_UINT8_MESSAGE(cases[i].prefix_length, cidr.prefix_length, cases[i].cidr);
+    }
+}
+
+static void test_convert_cidr_host_bits(void)
+{
+    struct p101_cidr cidr;
+    struct in_addr   expected;
+
+    TEST_ASSERT_FALSE(p101_convert_cidr(env, error, "10.1.2.3/8", true, &cidr));
+    TEST_ASSERT_TRUE(p101_error_is_error(error, P101_ERROR_USER, P101_CONVERT_ERROR_ADDRESS));
+    TEST_ASSERT_EQUAL_UINT8(P101_COMPACT_ADDRESS_NONE, cidr.network.family);
+    p101_error_reset(error);
+
+    TEST_ASSERT_TRUE(p101_convert_cidr(env, error, "10.1.2.3/12", false, &cidr));
+    TEST_ASSERT_EQUAL_INT(1, inet_pton(AF_INET, "10.0.0.0", &expected));
+    TEST_ASSERT_EQUAL_MEMORY(&expected, cidr.network.address, sizeof(expected));
+    TEST_ASSERT_EQUAL_UINT8(12, cidr.prefix_length);
+
+    TEST_ASSERT_FALSE(p101_convert_cidr(env, error, "2001:db8::1/127", true, &cidr));
+    TEST_ASSERT_TRUE(p101_error_is_error(error, P101_ERROR_USER, P101_CONVERT_ERROR_ADDRESS));
+}
+
+static void test_convert_cidr_rejects_bad_text(void)
+{
+    static const struct
+    {
+        const char *cidr;
+        uint64_t    code;
+    } cases[] = {
+        {"10.0.0.0",     P101_CONVERT_ERROR_SYNTAX },
+        {"10.0.0.0/",    P101_CONVERT_ERROR_SYNTAX },
+        {"10.0.0.0/08",  P101_CONVERT_ERROR_SYNTAX },
+        {"10.0.0.0/+8",  P101_CONVERT_ERROR_SYNTAX },
+        {"10.0.0.0/8/8", P101_CONVERT_ERROR_SYNTAX },
+        {"10.0.0.0/33",  P101_CONVERT_ERROR_RANGE  },
+        {"::/129",       P101_CONVERT_ERROR_RANGE  },
+        {"10.0.0/8",     P101_CONVERT_ERROR_ADDRESS},
+        {"/8",           P101_CONVERT_ERROR_ADDRESS},
+        {"/tmp/sock",    P101_CONVERT_ERROR_ADDRESS},
+        {"[::]/0",       P101_CONVERT_ERROR_ADDRESS},
+    };
+    size_t i;
+
+    for(i = 0; i < sizeof(cases) / sizeof(cases[0]); i++)
+    {
+        struct p101_cidr cidr;
+
+        p101_error_reset(error);
+        TEST_ASSERT_FALSE_MESSAGE(p101_convert_cidr(env, error, cases[i].cidr, false, &cidr), cases[i].cidr);
+        TEST_ASSERT_TRUE_MESSAGE(p101_error_is_error(error, P101_ERROR_USER, cases[i].code), cases[i].cidr);
+    }
+}
+
+/* ------------------------------------------------------------ compact addresses */
+
+static void test_compact_address_is_small(void)
+{
+    TEST_ASSERT_EQUAL_size_t(24, sizeof(struct p101_compact_address));
+}
+
+static void test_convert_compact_address_ipv4(void)
+{
+    struct p101_compact_address compact;
+    struct in_addr              expected;
+    static const uint8_t        zeroes[12] = {0};
+
+    memset(&compact, 0xA5, sizeof(compact));
+    TEST_ASSERT_TRUE(p101_convert_compact_address(env, error, "192.0.2.33", &compact));
+    TEST_ASSERT_FALSE(p101_error_has_error(error));
+    TEST_ASSERT_EQUAL_UINT8(P101_COMPACT_ADDRESS_IPV4, compact.family);
+    TEST_ASSERT_EQUAL_INT(1, inet_pton(AF_INET, "192.0.2.33", &expected));
+    TEST_ASSERT_EQUAL_MEMORY(&expected, compact.address, sizeof(expected));
+    TEST_ASSERT_EQUAL_MEMORY(zeroes, &compact.address[4], sizeof(zeroes));
+    TEST_ASSERT_EQUAL_UINT16(0, compact.port);
+    TEST_ASSERT_EQUAL_UINT32(0, compact.scope_id);
+    TEST_ASSERT_EQUAL_UINT8(0, compact.reserved);
+}
+
+static void test_convert_compact_address_ipv6(void)
+{
+    struct p101_compact_address compact;
+    struct in6_addr             expected;
+
+    memset(&compact, 0xA5, sizeof(compact));
+    TEST_ASSERT_TRUE(p101_convert_compact_address(env, error, "2001:db8::ff00:42:8329", &compact));
+    TEST_ASSERT_EQUAL_UINT8(P101_COMPACT_ADDRESS_IPV6, compact.family);
+    TEST_ASSERT_EQUAL_INT(1, inet_pton(AF_INET6, "2001:db8::ff00:42:8329", &expected));
+    TEST_ASSERT_EQUAL_MEMORY(&expected, compact.address, sizeof(expected));
+    TEST_ASSERT_EQUAL_UINT8(0, compact.reserved);
+}
+
+static void test_convert_compact_address_rejects_paths_and_text(void)
+{
+    static const char *const    not_literals[]                              = {"/tmp/p101.sock", "localhost", "01.2.3.4", "", "1::2::3"};
+    static const uint8_t        zeroes[sizeof(struct p101_compact_address)] = {0};
+    struct p101_compact_address compact;
+    size_t                      i;
+
+    for(i = 0; i < sizeof(not_literals) / sizeof(not_literals[0]); i++)
+    {
+        memset(&compact, 0xA5, sizeof(compact));
+        p101_error_reset(error);
+        TEST_ASSERT_FALSE_MESSAGE(p101_convert_compact_address(env, error, not_literals[i], &compact), not_literals[i]);
+        TEST_ASSERT_TRUE_MESSAGE(p101_error_is_error(error, P101_ERROR_USER, P101_CONVERT_ERROR_ADDRESS), not_literals[i]);
+        TEST_ASSERT_EQUAL_MEMORY_MESSAGE(zeroes, &compact, sizeof(compact), not_literals[i]);
+    }
+}
+
+static void test_compact_address_round_trips_through_sockaddr(void)
+{
+    static const char *const literals[] = {"10.0.0.1", "fe80::1"};
+    size_t                   i;
+
+    for(i = 0; i < sizeof(literals) / sizeof(literals[0]); i++)
+    {
+        struct p101_compact_address compact;
+        struct sockaddr_storage     expected;
+        struct sockaddr_storage     addr;
+        socklen_t                   expected_length;
+
+        TEST_ASSERT_TRUE(p101_convert_compact_address(env, error, literals[i], &compact));
+        compact.port     = htons(8080);
+        compact.scope_id = compact.family == P101_COMPACT_ADDRESS_IPV6 ? 3U : 0U;
+
+        poison(&expected);
+        expected_length = p101_convert_address(env, error, literals[i], &expected);
+        if(expected.ss_family == AF_INET)
+        {
+            ((struct sockaddr_in *)(void *)&expected)->sin_port = htons(8080);
+        }
+        else
+        {
+            ((struct sockaddr_in6 *)(void *)&expected)->sin6_port     = htons(8080);
+            ((struct sockaddr_in6 *)(void *)&expected)->sin6_scope_id = 3U;
+        }
+
+        memset(&addr, 0xA5, sizeof(addr));
+        TEST_ASSERT_EQUAL_UINT_MESSAGE(expected_length, p101_compact_address_to_sockaddr(env, error, &compact, &addr), literals[i]);
+        TEST_ASSERT_FALSE(p101_error_has_error(error));
+        TEST_ASSERT_EQUAL_MEMORY_MESSAGE(&expected, &addr, expected_length, literals[i]);
+    }
+}
+
+static void test_compact_address_to_sockaddr_rejects_an_empty_address(void)
+{
+    struct p101_compact_address compact;
+    struct sockaddr_storage     addr;
+
+    memset(&compact, 0, sizeof(compact));
+    poison(&addr);
+    TEST_ASSERT_EQUAL_UINT(0, p101_compact_address_to_sockaddr(env, error, &compact, &addr));
+    TEST_ASSERT_EQUAL_INT(AF_UNSPEC, addr.ss_family);
+    TEST_ASSERT_TRUE(p101_error_is_error(error, P101_ERROR_USER, P101_CONVERT_ERROR_ADDRESS));
+}
+
+static void test_compact_address_to_sockaddr_preserves_an_existing_error(void)
+{
+    struct p101_compact_address compact;
+    struct sockaddr_storage     addr;
+    struct sockaddr_storage     poisoned;
+
+    TEST_ASSERT_TRUE(p101_convert_compact_address(env, error, "10.20.30.40", &compact));
+    poison(&addr);
+    poison(&poisoned);
+    P101_ERROR_RAISE_USER(error, "sentinel", 99);
+    TEST_ASSERT_EQUAL_UINT(0, p101_compact_address_to_sockaddr(env, error, &compact, &addr));
+    TEST_ASSERT_EQUAL_MEMORY(&poisoned, &addr, sizeof(addr));
+
+    memset(&compact, 0, sizeof(compact));
+    TEST_ASSERT_EQUAL_UINT(0, p101_compact_address_to_sockaddr(env, error, &compact, &addr));
+    TEST_ASSERT_TRUE(p101_error_is_error(error, P101_ERROR_USER, 99));
+    TEST_ASSERT_EQUAL_MEMORY(&poisoned, &addr, sizeof(addr));
+}
+
+/* ------------------------------------------------------------ p101_format_address / p101_format_endpoint */
+
+static void test_format_address_ipv4_every_octet(void)
+{
+    unsigned int octet;
+
+    for(octet = 0; octet <= 255U; octet++)
+    {
+        struct sockaddr_in addr;
+        char               expected[INET_ADDRSTRLEN];
+        char               text[INET_ADDRSTRLEN];
+        const uint8_t      bytes[4] = {(uint8_t)octet, 0, 255, (uint8_t)(255U - octet)};
+
+        memset(&addr, 0, sizeof(addr));
+        addr.sin_family = AF_INET;
+        memcpy(&addr.sin_addr, bytes, sizeof(bytes));
+        TEST_ASSERT_NOT_NULL(inet_ntop(AF_INET, &addr.sin_addr, expected, sizeof(expected)));
+        TEST_ASSERT_EQUAL_size_t(strlen(expected), p101_format_address(env, error, (const struct sockaddr *)&addr, text, sizeof(text)));
+        TEST_ASSERT_FALSE(p101_error_has_error(error));
+        TEST_ASSERT_EQUAL_STRING(expected, text);
+    }
+}
+
+static void test_format_address_ipv6_is_canonical(void)
+{
+    static const struct
+    {
+        const char *literal;
+        const char *canonical;
+    } cases[] = {
+        {"::",                                      "::"                                    },
+        {"::1",                                     "::1"                                   },
+        {"1::",                                     "1::"                                   },
+        {"2001:DB8:0:0:0:0:2:1",                    "2001:db8::2:1"                         },
+        {"2001:0db8:0000:0000:0000:0000:0000:0001", "2001:db8::1"                           },
+        {"2001:db8:0:1:1:1:1:1",                    "2001:db8:0:1:1:1:1:1"                  },
+        {"2001:0:0:1:0:0:0:1",                      "2001:0:0:1::1"                         },
+        {"2001:db8:0:0:1:0:0:1",                    "2001:db8::1:0:0:1"                     },
+        {"1:0:0:2:3:0:0:4",                         "1::2:3:0:0:4"                          },
+        {"fe80::1:0:0",                             "fe80::1:0:0"                           },
+        {"ffff:ffff:ffff:ffff:ffff:ffff:ffff:ffff", "ffff:ffff:ffff:ffff:ffff:ffff:ffff:ffff"},
+        {"::ffff:192.0.2.1",                        "::ffff:192.0.2.1"                      },
+        {"::ffff:0:0",                              "::ffff:0.0.0.0"                        },
+        {"::192.0.2.1",                             "::c000:201"                            },
+        {"::1:ffff:c000:201",                       "::1:ffff:c000:201"                     },
+    };
+    size_t i;
+
+    for(i = 0; i < sizeof(cases) / sizeof(cases[0]); i++)
+    {
+        struct sockaddr_in6 addr;
+        char                text[INET6_ADDRSTRLEN];
+
+        memset(&addr, 0, sizeof(addr));
+        addr.sin6_family = AF_INET6;
+        TEST_ASSERT_EQUAL_INT_MESSAGE(1, inet_pton(AF_INET6, cases[i].literal, &addr.sin6_addr), cases[i].literal);
+        TEST_ASSERT_EQUAL_size_t_MESSAGE(strlen(cases[i].canonical), p101_format_address(env, error, (const struct sockaddr *)&addr, text, sizeof(text)), cases[i].literal);
+        TEST_ASSERT_EQUAL_STRING_MESSAGE(cases[i].canonical, text, cases[i].literal);
+    }
+}
+
+/*
+ * Every pattern of zero and non-zero groups, which covers every placement of
+ * the "::" run, against the C library. inet_ntop() also writes a dotted-quad
+ * tail for the deprecated IPv4-compatible form (::a.b.c.d), which RFC 5952
+ * does not, so those patterns are skipped.
+ */
+static void test_format_address_ipv6_matches_inet_ntop(void)
+{
+    unsigned int pattern;
+
+    for(pattern = 0; pattern < 256U; pattern++)
+    {
+        struct sockaddr_in6 addr;
+        char                expected[INET6_ADDRSTRLEN];
+        char                text[INET6_ADDRSTRLEN];
+        unsigned int        group;
+
+        if((pattern & 0x3FU) == 0U && (pattern & 0x40U) != 0U)
+        {
+            continue;
+        }
+
+        memset(&addr, 0, sizeof(addr));
+        addr.sin6_family = AF_INET6;
+        for(group = 0; group < 8U; group++)
+        {
+            if((pattern & (1U << group)) != 0U)
+            {
+                addr.sin6_addr.s6_addr[group * 2U]        = (uint8_t)(group * 0x11U);
+                addr.sin6_addr.s6_addr[(group * 2U) + 1U] = (uint8_t)(0x0FU + group);
+            }
+        }
+
+        TEST_ASSERT_NOT_NULL(inet_ntop(AF_INET6, &addr.sin6_addr, expected, sizeof(expected)));
+        TEST_ASSERT_EQUAL_size_t_MESSAGE(strlen(expected), p101_format_address(env, error, (const struct sockaddr *)&addr, text, sizeof(text)), expected);
+        TEST_ASSERT_EQUAL_STRING(expected, text);
+    }
+}
+
+static void test_format_endpoint_round_trips_through_convert_endpoint(void)
+{
+    static const char *const endpoints[] = {"192.0.2.1:80", "0.0.0.0:0", "255.255.255.255:65535", "[2001:db8::1]:443", "[::]:0", "[::ffff:10.0.0.1]:65535"};
+    size_t                   i;
+
+    for(i = 0; i < sizeof(endpoints) / sizeof(endpoints[0]); i++)
+    {
+        struct sockaddr_storage addr;
+        char                    text[P101_ENDPOINT_TEXT_SIZE];
+
+        TEST_ASSERT_NOT_EQUAL_UINT(0, p101_convert_endpoint(env, error, endpoints[i], strlen(endpoints[i]), &addr));
+        TEST_ASSERT_EQUAL_size_t_MESSAGE(strlen(endpoints[i]), p101_format_endpoint(env, error, (const struct sockaddr *)&addr, text, sizeof(text)), endpoints[i]);
+        TEST_ASSERT_FALSE(p101_error_has_error(error));
+        TEST_ASSERT_EQUAL_STRING(endpoints[i], text);
+    }
+}
+
+static void test_format_endpoint_longest_text_fits(void)
+{
+    static const char *const longest = "[ffff:ffff:ffff:ffff:ffff:ffff:ffff:ffff]:65535";
+    struct sockaddr_storage  addr;
+    char                     text[P101_ENDPOINT_TEXT_SIZE];
+
+    TEST_ASSERT_LESS_THAN_size_t(sizeof(text), strlen(longest));
+    TEST_ASSERT_NOT_EQUAL_UINT(0, p101_convert_endpoint(env, error, longest, strlen(longest), &addr));
+    TEST_ASSERT_EQUAL_size_t(strlen(longest), p101_format_endpoint(env, error, (const struct sockaddr *)&addr, text, sizeof(text)));
+    TEST_ASSERT_EQUAL_STRING(longest, text);
+}
+
+static void test_format_unix_address_is_its_path(void)
+{
+    struct sockaddr_storage addr;
+    char                    text[sizeof(((struct sockaddr_un *)0)->sun_path) + 1];
+
+    TEST_ASSERT_NOT_EQUAL_UINT(0, p101_convert_address(env, error, "/tmp/p101.sock", &addr));
+    TEST_ASSERT_EQUAL_size_t(strlen("/tmp/p101.sock"), p101_format_address(env, error, (const struct sockaddr *)&addr, text, sizeof(text)));
+    TEST_ASSERT_EQUAL_STRING("/tmp/p101.sock", text);
+    TEST_ASSERT_EQUAL_size_t(strlen("/tmp/p101.sock"), p101_format_endpoint(env, error, (const struct sockaddr *)&addr, text, sizeof(text)));
+    TEST_ASSERT_EQUAL_STRING("/tmp/p101.sock", text);
+}
+
+static void test_format_unix_address_without_a_path_is_an_error(void)
+{
+    struct sockaddr_un sun;
+    char               text[sizeof(sun.sun_path) + 1];
+
+    /* An unnamed socket, as getpeername() reports an unbound client. */
+    memset(&sun, 0, sizeof(sun));
+    sun.sun_family = AF_UNIX;
+    text[0]        = 'x';
+    TEST_ASSERT_EQUAL_size_t(0, p101_format_address(env, error, (const struct sockaddr *)&sun, text, sizeof(text)));
+    TEST_ASSERT_TRUE(p101_error_is_error(error, P101_ERROR_USER, P101_CONVERT_ERROR_ADDRESS));
+    TEST_ASSERT_EQUAL_STRING("", text);
+
+    /* A Linux abstract socket: the name follows a leading NUL. */
+    p101_error_reset(error);
+    memcpy(&sun.sun_path[1], "p101", sizeof("p101"));
+    text[0] = 'x';
+    TEST_ASSERT_EQUAL_size_t(0, p101_format_endpoint(env, error, (const struct sockaddr *)&sun, text, sizeof(text)));
+    TEST_ASSERT_TRUE(p101_error_is_error(error, P101_ERROR_USER, P101_CONVERT_ERROR_ADDRESS));
+    TEST_ASSERT_EQUAL_STRING("", text);
+}
+
+static void test_format_address_buffer_too_small(void)
+{
+    struct sockaddr_storage addr;
+    char                    text[sizeof("10.20.30.40")];
+
+    TEST_ASSERT_NOT_EQUAL_UINT(0, p101_convert_address(env, error, "10.20.30.40", &addr));
+    TEST_ASSERT_EQUAL_size_t(sizeof(text) - 1U, p101_format_address(env, error, (const struct sockaddr *)&addr, text, sizeof(text)));
+    TEST_ASSERT_EQUAL_STRING("10.20.30.40", text);
+
+    memset(text, 'x', sizeof(text));
+    TEST_ASSERT_EQUAL_size_t(0, p101_format_address(env, error, (const struct sockaddr *)&addr, text, sizeof(text) - 1U));
+    TEST_ASSERT_TRUE(p101_error_is_error(error, P101_ERROR_USER, P101_CONVERT_ERROR_RANGE));
+    TEST_ASSERT_EQUAL_STRING("", text);
+
+    p101_error_reset(error);
+    memset(text, 'x', sizeof(text));
+    TEST_ASSERT_EQUAL_size_t(0, p101_format_endpoint(env, error, (const struct sockaddr *)&addr, text, 0));
+    TEST_ASSERT_TRUE(p101_error_is_error(error, P101_ERROR_USER, P101_CONVERT_ERROR_RANGE));
+    TEST_ASSERT_EQUAL_CHAR('x', text[0]);
+}
+
+static void test_format_address_preserves_an_existing_error(void)
+{
+    struct sockaddr_storage addr;
+    char                    text[P101_ENDPOINT_TEXT_SIZE];
+
+    TEST_ASSERT_NOT_EQUAL_UINT(0, p101_convert_address(env, error, "10.20.30.40", &addr));
+    P101_ERROR_RAISE_USER(error, "sentinel", 99);
+    text[0] = 'x';
+    TEST_ASSERT_EQUAL_size_t(0, p101_format_address(env, error, (const struct sockaddr *)&addr, text, sizeof(text)));
+    TEST_ASSERT_EQUAL_size_t(0, p101_format_endpoint(env, error, (const struct sockaddr *)&addr, text, sizeof(text)));
+    TEST_ASSERT_TRUE(p101_error_is_error(error, P101_ERROR_USER, 99));
+    TEST_ASSERT_EQUAL_CHAR('x', text[0]);
+}
+
+static void test_format_address_rejects_other_families_and_null(void)
+{
+    struct sockaddr_storage addr;
+    char                    text[P101_ENDPOINT_TEXT_SIZE];
+
+    memset(&addr, 0, sizeof(addr));
+    addr.ss_family = AF_UNSPEC;
+    text[0]        = 'x';
+    TEST_ASSERT_EQUAL_size_t(0, p101_format_address(env, error, (const struct sockaddr *)&addr, text, sizeof(text)));
+    TEST_ASSERT_TRUE(p101_error_is_error(error, P101_ERROR_USER, P101_CONVERT_ERROR_ADDRESS));
+    TEST_ASSERT_EQUAL_STRING("", text);
+
+    p101_error_reset(error);
+    TEST_ASSERT_EQUAL_size_t(0, p101_format_endpoint(env, error, NULL, text, sizeof(text)));
+    TEST_ASSERT_TRUE(p101_error_has_error(error));
+
+    p101_error_reset(error);
+    addr.ss_family = AF_INET;
+    TEST_ASSERT_EQUAL_size_t(0, p101_format_address(env, error, (const struct sockaddr *)&addr, NULL, sizeof(text)));
+    TEST_ASSERT_TRUE(p101_error_has_error(error));
+}
+
 int main(void)
 {
     UNITY_BEGIN();
@@ -266,15 +927,47 @@ int main(void)
     RUN_TEST(test_parse_in_port_t_rejects_garbage);
     RUN_TEST(test_convert_address_ipv4);
     RUN_TEST(test_convert_address_ipv4_edges);
+    RUN_TEST(test_convert_address_ipv4_stores_each_octet_in_order);
     RUN_TEST(test_convert_address_ipv6);
     RUN_TEST(test_convert_address_ipv6_loopback);
+    RUN_TEST(test_convert_address_ipv6_forms);
+    RUN_TEST(test_convert_address_rejects_malformed_ipv6);
     RUN_TEST(test_convert_address_is_not_confused_by_near_misses);
     RUN_TEST(test_convert_address_unix_path);
+    RUN_TEST(test_convert_address_unix_path_made_of_address_characters);
     RUN_TEST(test_convert_address_unix_path_at_the_limit);
     RUN_TEST(test_convert_address_rejects_overlong_unix_path);
     RUN_TEST(test_convert_address_empty_string);
     RUN_TEST(test_convert_address_null_storage_raises);
     RUN_TEST(test_convert_address_null_text_initializes_storage);
     RUN_TEST(test_convert_address_preserves_an_existing_error);
+    RUN_TEST(test_convert_address_array_matches_single_conversions);
+    RUN_TEST(test_convert_address_array_zeroes_only_the_family_sockaddr);
+    RUN_TEST(test_convert_address_array_null_arrays_raise);
+    RUN_TEST(test_convert_endpoint_ipv4);
+    RUN_TEST(test_convert_endpoint_bracketed_ipv6);
+    RUN_TEST(test_convert_endpoint_reads_only_length_bytes);
+    RUN_TEST(test_convert_endpoint_rejects_bad_addresses);
+    RUN_TEST(test_convert_endpoint_rejects_bad_ports);
+    RUN_TEST(test_convert_cidr_ipv4_and_ipv6);
+    RUN_TEST(test_convert_cidr_host_bits);
+    RUN_TEST(test_convert_cidr_rejects_bad_text);
+    RUN_TEST(test_compact_address_is_small);
+    RUN_TEST(test_convert_compact_address_ipv4);
+    RUN_TEST(test_convert_compact_address_ipv6);
+    RUN_TEST(test_convert_compact_address_rejects_paths_and_text);
+    RUN_TEST(test_compact_address_round_trips_through_sockaddr);
+    RUN_TEST(test_compact_address_to_sockaddr_rejects_an_empty_address);
+    RUN_TEST(test_compact_address_to_sockaddr_preserves_an_existing_error);
+    RUN_TEST(test_format_address_ipv4_every_octet);
+    RUN_TEST(test_format_address_ipv6_is_canonical);
+    RUN_TEST(test_format_address_ipv6_matches_inet_ntop);
+    RUN_TEST(test_format_endpoint_round_trips_through_convert_endpoint);
+    RUN_TEST(test_format_endpoint_longest_text_fits);
+    RUN_TEST(test_format_unix_address_is_its_path);
+    RUN_TEST(test_format_unix_address_without_a_path_is_an_error);
+    RUN_TEST(test_format_address_buffer_too_small);
+    RUN_TEST(test_format_address_preserves_an_existing_error);
+    RUN_TEST(test_format_address_rejects_other_families_and_null);
     return UNITY_END();
 }